@@ -3,10 +3,14 @@
 #endif()
 
 include(CheckCSourceRuns)
+include(CheckCSourceCompiles)
 
 option(ENABLE_SSE "Enable compile-time SSE4.1 support." ON)
 option(ENABLE_AVX "Enable compile-time AVX support."  ON)
 option(ENABLE_AVX2 "Enable compile-time AVX2 support."  ON)
+option(ENABLE_AVX512 "Enable AVX-512 kernels selected at run time."  ON)
+option(ENABLE_AESNI "Enable AES-NI ciphering selected at run time."  ON)
+option(ENABLE_PCLMUL "Enable carry-less multiply integrity selected at run time."  ON)
 
 if (ENABLE_SSE)
     #
@@ -99,6 +103,79 @@ if (ENABLE_SSE)
       endif()
   endif()
 
+  if (ENABLE_AVX512)
+
+      #
+      # Check compiler for AVX-512 intrinsics. The kernels are only used if the
+      # running CPU supports them, so the build host does not need to.
+      #
+      if (CMAKE_COMPILER_IS_GNUCC OR CMAKE_COMPILER_IS_CLANG )
+          set(CMAKE_REQUIRED_FLAGS "-mavx512f -mavx512bw")
+          check_c_source_compiles("
+          #include <immintrin.h>
+          int main()
+          {
+            short src[32] = {1};
+            short dst[32];
+            __m512i a = _mm512_loadu_si512(src);
+            _mm512_storeu_si512(dst, _mm512_add_epi16(a, a));
+            return dst[0] - 2;
+          }"
+          HAVE_AVX512)
+      endif()
+
+      if (HAVE_AVX512)
+          message(STATUS "AVX-512 kernels are enabled - used only if the running CPU supports them")
+      endif()
+  endif()
+
+endif()
+
+if (ENABLE_AESNI)
+
+    #
+    # Check compiler for AES-NI intrinsics. As for AVX-512, the running CPU is
+    # checked before they are used.
+    #
+    if (CMAKE_COMPILER_IS_GNUCC OR CMAKE_COMPILER_IS_CLANG )
+        set(CMAKE_REQUIRED_FLAGS "-maes")
+        check_c_source_compiles("
+        #include <wmmintrin.h>
+        int main()
+        {
+          __m128i a = _mm_setzero_si128();
+          a = _mm_aesenc_si128(a, a);
+          return _mm_cvtsi128_si32(_mm_aesenclast_si128(a, a));
+        }"
+        HAVE_AESNI)
+    endif()
+
+    if (HAVE_AESNI)
+        message(STATUS "AES-NI is enabled - used only if the running CPU supports it")
+    endif()
+endif()
+
+if (ENABLE_PCLMUL)
+
+    #
+    # Check compiler for the carry-less multiply intrinsic, also checked on the
+    # running CPU before it is used.
+    #
+    if (CMAKE_COMPILER_IS_GNUCC OR CMAKE_COMPILER_IS_CLANG )
+        set(CMAKE_REQUIRED_FLAGS "-mpclmul")
+        check_c_source_compiles("
+        #include <wmmintrin.h>
+        int main()
+        {
+          __m128i a = _mm_setzero_si128();
+          return _mm_cvtsi128_si32(_mm_clmulepi64_si128(a, a, 0x00));
+        }"
+        HAVE_PCLMUL)
+    endif()
+
+    if (HAVE_PCLMUL)
+        message(STATUS "PCLMULQDQ is enabled - used only if the running CPU supports it")
+    endif()
 endif()
 
-mark_as_advanced(HAVE_SSE, HAVE_AVX, HAVE_AVX2)
+mark_as_advanced(HAVE_SSE, HAVE_AVX, HAVE_AVX2, HAVE_AVX512, HAVE_AESNI, HAVE_PCLMUL)
@@ -139,28 +139,27 @@ struct LIBLTE_BYTE_MSG_STRUCT{
     }
 };
 
+// Bit messages are packed MSB first, N_bits counts the valid bits from msg
 struct LIBLTE_BIT_MSG_STRUCT{
     uint32  N_bits;
-    uint8   buffer[LIBLTE_MAX_MSG_SIZE_BITS];
+    uint8   buffer[LIBLTE_MAX_MSG_SIZE_BYTES];
     uint8  *msg;
 
     LIBLTE_BIT_MSG_STRUCT():N_bits(0)
     {
-      msg = &buffer[LIBLTE_MSG_HEADER_OFFSET];
-      while( (uint64_t)(msg) % 8 > 0) {
-        msg++;
-      }
+      msg = &buffer[LIBLTE_MSG_HEADER_OFFSET/8];
     }
     LIBLTE_BIT_MSG_STRUCT(const LIBLTE_BIT_MSG_STRUCT& buf){
+      msg    = &buffer[LIBLTE_MSG_HEADER_OFFSET/8];
       N_bits = buf.N_bits;
-      memcpy(msg, buf.msg, N_bits);
+      memcpy(msg, buf.msg, (N_bits+7)/8);
     }
     LIBLTE_BIT_MSG_STRUCT & operator= (const LIBLTE_BIT_MSG_STRUCT & buf){
       // avoid self assignment
       if (&buf == this)
         return *this;
       N_bits = buf.N_bits;
-      memcpy(msg, buf.msg, N_bits);
+      memcpy(msg, buf.msg, (N_bits+7)/8);
       return *this;
     }
     uint32 get_headroom()
@@ -170,11 +169,95 @@ struct LIBLTE_BIT_MSG_STRUCT{
     void reset()
     {
       N_bits = 0;
-      msg = &buffer[LIBLTE_MSG_HEADER_OFFSET];
-      while( (uint64_t)(msg) % 8 > 0) {
-        msg++;
-      }
+      msg = &buffer[LIBLTE_MSG_HEADER_OFFSET/8];
+    }
+};
+
+// Cursor into a packed bit message. It is used by the pack/unpack routines
+// like a pointer to bits: it can be advanced, compared and subtracted (giving
+// a number of bits), and dereferenced to access a single bit.
+class LIBLTE_BIT_PTR{
+public:
+    class bit_ref{
+    public:
+        bit_ref(uint8 *byte_, uint32 bit_) : byte(byte_), mask(0x80 >> bit_) {}
+        operator uint8() const
+        {
+          return (*byte & mask) ? 1 : 0;
+        }
+        bit_ref & operator= (uint8 value)
+        {
+          if(value) {
+            *byte |= mask;
+          } else {
+            *byte &= ~mask;
+          }
+          return *this;
+        }
+        bit_ref & operator= (const bit_ref &ref)
+        {
+          return *this = (uint8) ref;
+        }
+    private:
+        uint8 *byte;
+        uint8  mask;
+    };
+
+    uint8  *byte;
+    uint32  bit;
+
+    LIBLTE_BIT_PTR() : byte(NULL), bit(0) {}
+    LIBLTE_BIT_PTR(uint8 *ptr) : byte(ptr), bit(0) {}
+
+    bit_ref operator* () const
+    {
+      return bit_ref(byte, bit);
+    }
+    bit_ref operator[] (int32 n) const
+    {
+      return *(*this + n);
+    }
+    LIBLTE_BIT_PTR & operator+= (int32 n)
+    {
+      int32 pos = (int32) bit + n;
+      byte += (pos - (pos & 7)) / 8;
+      bit   = pos & 7;
+      return *this;
+    }
+    LIBLTE_BIT_PTR & operator-= (int32 n)
+    {
+      return *this += -n;
+    }
+    LIBLTE_BIT_PTR operator+ (int32 n) const
+    {
+      LIBLTE_BIT_PTR ptr = *this;
+      return ptr += n;
+    }
+    LIBLTE_BIT_PTR operator- (int32 n) const
+    {
+      LIBLTE_BIT_PTR ptr = *this;
+      return ptr += -n;
+    }
+    int32 operator- (const LIBLTE_BIT_PTR &ptr) const
+    {
+      return (int32) (byte - ptr.byte)*8 + (int32) bit - (int32) ptr.bit;
+    }
+    LIBLTE_BIT_PTR & operator++ ()
+    {
+      return *this += 1;
     }
+    LIBLTE_BIT_PTR operator++ (int)
+    {
+      LIBLTE_BIT_PTR ptr = *this;
+      *this += 1;
+      return ptr;
+    }
+    bool operator== (const LIBLTE_BIT_PTR &ptr) const { return byte == ptr.byte && bit == ptr.bit; }
+    bool operator!= (const LIBLTE_BIT_PTR &ptr) const { return !(*this == ptr); }
+    bool operator<  (const LIBLTE_BIT_PTR &ptr) const { return (*this - ptr) <  0; }
+    bool operator<= (const LIBLTE_BIT_PTR &ptr) const { return (*this - ptr) <= 0; }
+    bool operator>  (const LIBLTE_BIT_PTR &ptr) const { return (*this - ptr) >  0; }
+    bool operator>= (const LIBLTE_BIT_PTR &ptr) const { return (*this - ptr) >= 0; }
 };
 
 
@@ -199,10 +282,38 @@ void liblte_value_2_bits(uint32   value,
 uint32 liblte_bits_2_value(uint8  **bits,
                            uint32   N_bits);
 
+/*********************************************************************
+    Name: liblte_value_2_bits
+
+    Description: Writes a value MSB first into a packed bit message
+*********************************************************************/
+void liblte_value_2_bits(uint32           value,
+                         LIBLTE_BIT_PTR  *bits,
+                         uint32           N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_2_value
+
+    Description: Reads a value MSB first from a packed bit message
+*********************************************************************/
+uint32 liblte_bits_2_value(LIBLTE_BIT_PTR  *bits,
+                           uint32           N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_copy
+
+    Description: Copies bits between packed bit messages, at any
+                 bit offset
+*********************************************************************/
+void liblte_bits_copy(LIBLTE_BIT_PTR  dst,
+                      LIBLTE_BIT_PTR  src,
+                      uint32          N_bits);
+
 /*********************************************************************
     Name: liblte_pack
 
-    Description: Pack a bit array into a byte array
+    Description: Copy a bit message into a byte message, zero padding
+                 the last byte
 *********************************************************************/
 void liblte_pack(LIBLTE_BIT_MSG_STRUCT  *bits,
                  LIBLTE_BYTE_MSG_STRUCT *bytes);
@@ -210,11 +321,26 @@ void liblte_pack(LIBLTE_BIT_MSG_STRUCT  *bits,
 /*********************************************************************
     Name: liblte_unpack
 
-    Description: Unpack a byte array into a bit array
+    Description: Copy a byte message into a bit message
 *********************************************************************/
 void liblte_unpack(LIBLTE_BYTE_MSG_STRUCT *bytes,
                    LIBLTE_BIT_MSG_STRUCT  *bits);
 
+/*********************************************************************
+    Name: liblte_pack
+
+    Description: Copy a bit message into a byte array, zero padding
+                 the last byte. Returns the number of bytes
+*********************************************************************/
+uint32 liblte_pack(LIBLTE_BIT_MSG_STRUCT *bits, uint8 *bytes);
+
+/*********************************************************************
+    Name: liblte_unpack
+
+    Description: Copy a byte array into a bit message
+*********************************************************************/
+void liblte_unpack(uint8 *bytes, uint32 N_bytes, LIBLTE_BIT_MSG_STRUCT *bits);
+
 /*********************************************************************
     Name: liblte_pack
 
@@ -244,4 +370,19 @@ void liblte_align_up(uint8_t **ptr, uint32_t align);
 *********************************************************************/
 void liblte_align_up_zero(uint8_t **ptr, uint32_t align);
 
+/*********************************************************************
+    Name: liblte_align_up
+
+    Description: Aligns a bit cursor to a multibit boundary
+*********************************************************************/
+void liblte_align_up(LIBLTE_BIT_PTR *ptr, uint32_t align);
+
+/*********************************************************************
+    Name: liblte_align_up_zero
+
+    Description:  Aligns a bit cursor to a multibit boundary and zeros
+                  bits skipped
+*********************************************************************/
+void liblte_align_up_zero(LIBLTE_BIT_PTR *ptr, uint32_t align);
+
 #endif /* __LIBLTE_COMMON_H__ */
@@ -104,8 +104,8 @@ typedef struct{
 }LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg);
 
 /*********************************************************************
@@ -165,8 +165,8 @@ typedef struct{
 }LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info);
 
 /*********************************************************************
@@ -208,8 +208,8 @@ typedef struct{
 }LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg);
 
 /*********************************************************************
@@ -237,8 +237,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
-                                            uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
+                                            LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(LIBLTE_BIT_PTR *ie_ptr,
                                               uint16  *rnti);
 
 /*********************************************************************
@@ -254,8 +254,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_BYTE_MSG_STRUCT  *ded_info_cdma2000,
-                                                             uint8                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8                  **ie_ptr,
+                                                             LIBLTE_BIT_PTR         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(LIBLTE_BIT_PTR         *ie_ptr,
                                                                LIBLTE_BYTE_MSG_STRUCT  *ded_info_cdma2000);
 
 /*********************************************************************
@@ -271,8 +271,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_BYTE_MSG_STRUCT  *ded_info_nas,
-                                                        uint8                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8                  **ie_ptr,
+                                                        LIBLTE_BIT_PTR         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(LIBLTE_BIT_PTR         *ie_ptr,
                                                           LIBLTE_BYTE_MSG_STRUCT  *ded_info_nas);
 
 /*********************************************************************
@@ -311,8 +311,8 @@ static const int8 liblte_rrc_filter_coefficient_num[LIBLTE_RRC_FILTER_COEFFICIEN
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFICIENT_ENUM   filter_coeff,
-                                                        uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8                              **ie_ptr,
+                                                        LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                           LIBLTE_RRC_FILTER_COEFFICIENT_ENUM  *filter_coeff);
 
 /*********************************************************************
@@ -328,8 +328,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
-                                          uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
+                                          LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(LIBLTE_BIT_PTR *ie_ptr,
                                             uint8  *mmec);
 
 /*********************************************************************
@@ -345,8 +345,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config,
-                                                       uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
+                                                       LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                          uint8  *neigh_cell_config);
 
 /*********************************************************************
@@ -381,8 +381,8 @@ typedef struct{
 }LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg,
-                                                  uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8                             **ie_ptr,
+                                                  LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                     LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg);
 
 /*********************************************************************
@@ -398,8 +398,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
-                                                         uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
+                                                         LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                            uint32  *rand);
 
 /*********************************************************************
@@ -429,8 +429,8 @@ static const char liblte_rrc_rat_type_text[LIBLTE_RRC_RAT_TYPE_N_ITEMS][20] = {
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_type,
-                                              uint8                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_ptr,
+                                              LIBLTE_BIT_PTR           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(LIBLTE_BIT_PTR           *ie_ptr,
                                                 LIBLTE_RRC_RAT_TYPE_ENUM  *rat_type);
 
 /*********************************************************************
@@ -446,8 +446,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_pt
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_transaction_id,
-                                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr,
+                                                                LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                   uint8  *rrc_transaction_id);
 
 /*********************************************************************
@@ -468,8 +468,8 @@ typedef struct{
 }LIBLTE_RRC_S_TMSI_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
-                                            uint8                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
+                                            LIBLTE_BIT_PTR           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(LIBLTE_BIT_PTR           *ie_ptr,
                                               LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi);
 
 /*********************************************************************
@@ -614,8 +614,8 @@ typedef struct{
 }LIBLTE_RRC_PDCP_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params,
-                                                 uint8                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8                            **ie_ptr,
+                                                 LIBLTE_BIT_PTR            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(LIBLTE_BIT_PTR                   *ie_ptr,
                                                    LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params);
 
 typedef struct{
@@ -624,8 +624,8 @@ typedef struct{
 }LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -639,8 +639,8 @@ typedef struct{
 }LIBLTE_RRC_RF_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *params,
-                                               uint8                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **ie_ptr,
+                                               LIBLTE_BIT_PTR              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(LIBLTE_BIT_PTR              *ie_ptr,
                                                  LIBLTE_RRC_RF_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -649,8 +649,8 @@ typedef struct{
 }LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info);
 
 typedef struct{
@@ -659,8 +659,8 @@ typedef struct{
 }LIBLTE_RRC_MEAS_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -675,8 +675,8 @@ typedef struct{
 }LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT;
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params);
 
 typedef struct{
@@ -693,7 +693,7 @@ typedef struct{
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT  *ue_eutra_capability,
                                                          LIBLTE_BIT_MSG_STRUCT                  *msg);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT  *ue_eutra_capability);
 
 
@@ -800,8 +800,8 @@ typedef struct{
 }LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants);
 
 /*********************************************************************
@@ -830,8 +830,8 @@ static const double liblte_rrc_allowed_meas_bandwidth_num[LIBLTE_RRC_ALLOWED_MEA
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM   allowed_meas_bw,
-                                                            uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8                                  **ie_ptr,
+                                                            LIBLTE_BIT_PTR                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                               LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM  *allowed_meas_bw);
 
 /*********************************************************************
@@ -847,8 +847,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
+                                                LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   uint8  *hysteresis);
 
 /*********************************************************************
@@ -1571,8 +1571,8 @@ typedef struct{
 }LIBLTE_RRC_MEAS_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg);
 
 /*********************************************************************
@@ -1590,8 +1590,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8
 // Meas Gap Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg);
 
 /*********************************************************************
@@ -1607,8 +1607,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
-                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
+                                             LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                uint8  *meas_id);
 
 /*********************************************************************
@@ -1627,8 +1627,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
 // Meas ID To Add Mod List structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list);
 
 /*********************************************************************
@@ -1645,8 +1645,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8
 // Meas Object CDMA2000 structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000);
 
 /*********************************************************************
@@ -1663,8 +1663,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8
 // Meas Object EUTRA structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra);
 
 /*********************************************************************
@@ -1681,8 +1681,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8
 // Meas Object GERAN struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran);
 
 /*********************************************************************
@@ -1697,8 +1697,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
-                                                    uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
+                                                    LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                       uint8  *meas_object_id);
 
 /*********************************************************************
@@ -1716,8 +1716,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
 // Meas Object To Add Mod List structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                 uint8                                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8                                         **ie_ptr,
+                                                                 LIBLTE_BIT_PTR                                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(LIBLTE_BIT_PTR                                *ie_ptr,
                                                                    LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list);
 
 /*********************************************************************
@@ -1736,8 +1736,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8
 // Meas Object UTRA structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra);
 
 /*********************************************************************
@@ -1770,8 +1770,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8
 // Quantity Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc);
 
 /*********************************************************************
@@ -1789,8 +1789,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8
 // Report Config EUTRA structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra);
 
 /*********************************************************************
@@ -1805,8 +1805,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
-                                                      uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
+                                                      LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                         uint8  *report_cnfg_id);
 
 /*********************************************************************
@@ -1824,8 +1824,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
 // Report Config Inter RAT structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat);
 
 /*********************************************************************
@@ -1843,8 +1843,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8
 // Report Config To Add Mod List structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                   uint8                                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8                                           **ie_ptr,
+                                                                   LIBLTE_BIT_PTR                                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(LIBLTE_BIT_PTR                                  *ie_ptr,
                                                                      LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list);
 
 /*********************************************************************
@@ -1860,8 +1860,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_ENUM   report_int,
-                                                     uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8                           **ie_ptr,
+                                                     LIBLTE_BIT_PTR                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(LIBLTE_BIT_PTR                  *ie_ptr,
                                                        LIBLTE_RRC_REPORT_INTERVAL_ENUM  *report_int);
 
 /*********************************************************************
@@ -1877,8 +1877,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
+                                                LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   uint8  *rsrp_range);
 
 /*********************************************************************
@@ -1894,8 +1894,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
+                                                LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   uint8  *rsrq_range);
 
 /*********************************************************************
@@ -1914,8 +1914,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_ENUM   time_to_trigger,
-                                                     uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8                           **ie_ptr,
+                                                     LIBLTE_BIT_PTR                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(LIBLTE_BIT_PTR                  *ie_ptr,
                                                        LIBLTE_RRC_TIME_TO_TRIGGER_ENUM  *time_to_trigger);
 
 /*********************************************************************
@@ -1930,8 +1930,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_spect_em,
-                                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_ptr,
+                                                                  LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                     uint8  *add_spect_em);
 
 /*********************************************************************
@@ -1947,8 +1947,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_p
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
-                                                          uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
+                                                          LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                             uint16  *arfcn);
 
 /*********************************************************************
@@ -1965,8 +1965,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
+                                                       LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                          uint16  *arfcn);
 
 /*********************************************************************
@@ -1982,8 +1982,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
+                                                       LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                          uint16  *arfcn);
 
 /*********************************************************************
@@ -2000,8 +2000,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
-                                                      uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
+                                                      LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                         uint16  *arfcn);
 
 /*********************************************************************
@@ -2018,8 +2018,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM   bc_cdma2000,
-                                                         uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8                               **ie_ptr,
+                                                         LIBLTE_BIT_PTR                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                            LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM  *bc_cdma2000);
 
 /*********************************************************************
@@ -2036,8 +2036,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM   bi_geran,
-                                                          uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8                                **ie_ptr,
+                                                          LIBLTE_BIT_PTR                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                             LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM  *bi_geran);
 
 /*********************************************************************
@@ -2053,8 +2053,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8
 // Carrier Freq CDMA2000 struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq);
 
 /*********************************************************************
@@ -2074,8 +2074,8 @@ typedef struct{
 }LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq);
 
 /*********************************************************************
@@ -2094,8 +2094,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8
 // Carrier Freqs GERAN structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs);
 
 /*********************************************************************
@@ -2111,8 +2111,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM   cdma2000_type,
-                                                   uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8                         **ie_ptr,
+                                                   LIBLTE_BIT_PTR                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                      LIBLTE_RRC_CDMA2000_TYPE_ENUM  *cdma2000_type);
 
 /*********************************************************************
@@ -2127,8 +2127,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
-                                                   uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
+                                                   LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                      uint32  *cell_id);
 
 /*********************************************************************
@@ -2145,8 +2145,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
 // Cell Index List struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list);
 
 /*********************************************************************
@@ -2164,8 +2164,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_resel_prio,
-                                                               uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
+                                                               LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                  uint8  *cell_resel_prio);
 
 /*********************************************************************
@@ -2205,12 +2205,12 @@ typedef struct{
 }LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param,
-                                                                   uint8                                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8                                           **ie_ptr,
+                                                                   LIBLTE_BIT_PTR                                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(LIBLTE_BIT_PTR                                  *ie_ptr,
                                                                      LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param,
-                                                                        uint8                                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8                                                **ie_ptr,
+                                                                        LIBLTE_BIT_PTR                                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_BIT_PTR                                       *ie_ptr,
                                                                           LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param);
 
 /*********************************************************************
@@ -2234,8 +2234,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2255,8 +2255,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2277,8 +2277,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2298,8 +2298,8 @@ typedef struct{
 }LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id);
 
 /*********************************************************************
@@ -2315,8 +2315,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
-                                                  uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
+                                                  LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint32  *csg_id);
 
 /*********************************************************************
@@ -2819,8 +2819,8 @@ typedef struct{
 }LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info);
 
 /*********************************************************************
@@ -2851,8 +2851,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8
 // Mobility State Parameters struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params);
 
 /*********************************************************************
@@ -2867,8 +2867,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
-                                                  uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
+                                                  LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint16  *phys_cell_id);
 
 /*********************************************************************
@@ -2886,8 +2886,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
 // Phys Cell ID Range struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range);
 
 /*********************************************************************
@@ -2917,8 +2917,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
+                                                           LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint16  *phys_cell_id);
 
 /*********************************************************************
@@ -2934,8 +2934,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
 // Phys Cell ID GERAN struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id);
 
 /*********************************************************************
@@ -2950,8 +2950,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
+                                                           LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint16  *phys_cell_id);
 
 /*********************************************************************
@@ -2966,8 +2966,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
-                                                           uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
+                                                           LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint8  *phys_cell_id);
 
 /*********************************************************************
@@ -2984,8 +2984,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
 // PLMN Identity struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id,
-                                                   uint8                           **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8                           **ie_ptr,
+                                                   LIBLTE_BIT_PTR                  *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(LIBLTE_BIT_PTR                  *ie_ptr,
                                                      LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id);
 
 /*********************************************************************
@@ -3001,8 +3001,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8
 // Pre Registration Info HRPD struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd,
-                                                                uint8                                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8                                        **ie_ptr,
+                                                                LIBLTE_BIT_PTR                               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(LIBLTE_BIT_PTR                               *ie_ptr,
                                                                   LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd);
 
 /*********************************************************************
@@ -3019,8 +3019,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
-                                                uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
+                                                LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   int8   *q_qual_min);
 
 /*********************************************************************
@@ -3036,8 +3036,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
-                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
+                                                  LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     int16  *q_rx_lev_min);
 
 /*********************************************************************
@@ -3056,8 +3056,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_ENUM   q_offset_range,
-                                                    uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8                          **ie_ptr,
+                                                    LIBLTE_BIT_PTR                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(LIBLTE_BIT_PTR                 *ie_ptr,
                                                       LIBLTE_RRC_Q_OFFSET_RANGE_ENUM  *q_offset_range);
 
 /*********************************************************************
@@ -3074,8 +3074,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_range_inter_rat,
-                                                              uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
+                                                              LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                 int8   *q_offset_range_inter_rat);
 
 /*********************************************************************
@@ -3090,8 +3090,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
-                                                           uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
+                                                           LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint8  *resel_thresh);
 
 /*********************************************************************
@@ -3107,8 +3107,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thresh_q,
-                                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
+                                                             LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                uint8  *resel_thresh_q);
 
 /*********************************************************************
@@ -3124,8 +3124,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
-                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
+                                                  LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint8  *s_cell_idx);
 
 /*********************************************************************
@@ -3141,8 +3141,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
-                                                     uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
+                                                     LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                        uint8  *serv_cell_idx);
 
 /*********************************************************************
@@ -3161,8 +3161,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
 // Speed State Scale Factors struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors);
 
 /*********************************************************************
@@ -3196,8 +3196,8 @@ typedef struct{
 }LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000);
 
 /*********************************************************************
@@ -3213,8 +3213,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
-                                                        uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
+                                                        LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                           uint16  *tac);
 
 /*********************************************************************
@@ -3230,8 +3230,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
-                                                   uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
+                                                   LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                      uint8  *t_resel);
 
 /*********************************************************************
@@ -3247,8 +3247,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_chaining_count,
-                                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
+                                                             LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                uint8  *next_hop_chaining_count);
 
 /*********************************************************************
@@ -3294,8 +3294,8 @@ typedef struct{
 }LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg);
 
 /*********************************************************************
@@ -3311,8 +3311,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
-                                                 uint8  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
+                                                 LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                    uint16  *short_mac_i);
 
 /*********************************************************************
@@ -3370,12 +3370,12 @@ typedef struct{
 }LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM   antenna_ports_cnt,
-                                                         uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8                               **ie_ptr,
+                                                         LIBLTE_BIT_PTR                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                            LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM  *antenna_ports_cnt);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR                           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info);
 
 /*********************************************************************
@@ -3426,8 +3426,8 @@ typedef struct{
 }LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg,
-                                                       uint8                               **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8                               **ie_ptr,
+                                                       LIBLTE_BIT_PTR                      *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                          LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg);
 
 /*********************************************************************
@@ -3470,8 +3470,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
-                                                  uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
+                                                  LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint8  *drb_id);
 
 /*********************************************************************
@@ -3545,8 +3545,8 @@ typedef struct{
 }LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR                           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg);
 
 /*********************************************************************
@@ -3840,8 +3840,8 @@ typedef struct{
 }LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg);
 
 /*********************************************************************
@@ -3899,8 +3899,8 @@ typedef struct{
 }LIBLTE_RRC_PDCP_CONFIG_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg,
-                                                 uint8                         **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8                         **ie_ptr,
+                                                 LIBLTE_BIT_PTR                *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg);
 
 /*********************************************************************
@@ -3931,12 +3931,12 @@ static const double liblte_rrc_pdsch_config_p_a_num[LIBLTE_RRC_PDSCH_CONFIG_P_A_
 // PDSCH Config Common struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM   p_a,
-                                                            uint8                            **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8                            **ie_ptr,
+                                                            LIBLTE_BIT_PTR                   *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(LIBLTE_BIT_PTR                   *ie_ptr,
                                                               LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM  *p_a);
 
 /*********************************************************************
@@ -3953,8 +3953,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8
 // PHICH Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config,
-                                                  uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8                          **ie_ptr,
+                                                  LIBLTE_BIT_PTR                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(LIBLTE_BIT_PTR                 *ie_ptr,
                                                     LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config);
 
 /*********************************************************************
@@ -4106,8 +4106,8 @@ typedef struct{
 }LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded);
 
 /*********************************************************************
@@ -4124,8 +4124,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
-                                           uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
+                                           LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(LIBLTE_BIT_PTR *ie_ptr,
                                              int8   *p_max);
 
 /*********************************************************************
@@ -4142,16 +4142,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
 // PRACH Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg,
-                                                  uint8                          **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8                          **ie_ptr,
+                                                  LIBLTE_BIT_PTR                 *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(LIBLTE_BIT_PTR                 *ie_ptr,
                                                     LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_idx,
-                                                            uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
+                                                            LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                               uint8  *prach_cnfg_idx);
 
 /*********************************************************************
@@ -4167,8 +4167,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_ant_port_1,
-                                                             uint8 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
+                                                             LIBLTE_BIT_PTR *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                bool   *presence_ant_port_1);
 
 /*********************************************************************
@@ -4186,12 +4186,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
 // PUCCH Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR                           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg);
 
 /*********************************************************************
@@ -4210,12 +4210,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8
 // PUSCH Config structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR                           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg);
 
 /*********************************************************************
@@ -4232,8 +4232,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8
 // RACH Config Common structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg,
-                                                        uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8                                **ie_ptr,
+                                                        LIBLTE_BIT_PTR                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg);
 
 /*********************************************************************
@@ -4249,8 +4249,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8
 // RACH Config Dedicated struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg);
 
 /*********************************************************************
@@ -4320,12 +4320,12 @@ typedef struct{
 // RR Config Common struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg);
 
 /*********************************************************************
@@ -4826,8 +4826,8 @@ typedef struct{
 }LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg,
-                                                         uint8                                 **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8                                 **ie_ptr,
+                                                         LIBLTE_BIT_PTR                        *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg);
 
 /*********************************************************************
@@ -4843,8 +4843,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8
 // RLC Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg,
-                                                uint8                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        **ie_ptr,
+                                                LIBLTE_BIT_PTR               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(LIBLTE_BIT_PTR               *ie_ptr,
                                                   LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg);
 
 /*********************************************************************
@@ -4861,8 +4861,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        *
 // RLF Timers and Constants struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants,
-                                                              uint8                                      **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8                                      **ie_ptr,
+                                                              LIBLTE_BIT_PTR                             *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(LIBLTE_BIT_PTR                             *ie_ptr,
                                                                 LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants);
 
 /*********************************************************************
@@ -4891,8 +4891,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8
 // Scheduling Request Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg,
-                                                               uint8                                       **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8                                       **ie_ptr,
+                                                               LIBLTE_BIT_PTR                              *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg);
 
 /*********************************************************************
@@ -4910,12 +4910,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8
 // Sounding RS UL Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg,
-                                                          uint8                                  **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8                                  **ie_ptr,
+                                                          LIBLTE_BIT_PTR                         *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg);
 
 /*********************************************************************
@@ -4932,8 +4932,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8
 // SPS Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg,
-                                                uint8                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        **ie_ptr,
+                                                LIBLTE_BIT_PTR               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(LIBLTE_BIT_PTR               *ie_ptr,
                                                   LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg);
 
 /*********************************************************************
@@ -4951,8 +4951,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        *
 // TDD Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg,
-                                                uint8                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        **ie_ptr,
+                                                LIBLTE_BIT_PTR               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(LIBLTE_BIT_PTR               *ie_ptr,
                                                   LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg);
 
 /*********************************************************************
@@ -4969,8 +4969,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        *
 // Structs
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM   time_alignment_timer,
-                                                          uint8                                **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8                                **ie_ptr,
+                                                          LIBLTE_BIT_PTR                       *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                             LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM  *time_alignment_timer);
 
 /*********************************************************************
@@ -4987,8 +4987,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8
 // TPC PDCCH Config struct defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg,
-                                                      uint8                              **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8                              **ie_ptr,
+                                                      LIBLTE_BIT_PTR                     *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg);
 
 /*********************************************************************
@@ -5020,8 +5020,8 @@ typedef struct{
 }LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info,
-                                                     uint8                             **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8                             **ie_ptr,
+                                                     LIBLTE_BIT_PTR                    *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info);
 
 /*********************************************************************
@@ -5040,12 +5040,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8
 // Uplink Power Control structs defined above
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl,
-                                                             uint8                                     **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8                                     **ie_ptr,
+                                                             LIBLTE_BIT_PTR                            *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl);
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl,
-                                                                uint8                                        **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8                                        **ie_ptr,
+                                                                LIBLTE_BIT_PTR                               *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(LIBLTE_BIT_PTR                               *ie_ptr,
                                                                   LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl);
 
 /*********************************************************************
@@ -5140,8 +5140,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2);
 
 /*********************************************************************
@@ -5231,8 +5231,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3);
 
 /*********************************************************************
@@ -5262,8 +5262,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4);
 
 /*********************************************************************
@@ -5312,8 +5312,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5);
 
 /*********************************************************************
@@ -5361,8 +5361,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6);
 
 /*********************************************************************
@@ -5398,8 +5398,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7);
 
 /*********************************************************************
@@ -5461,8 +5461,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8);
 
 /*********************************************************************
@@ -5484,8 +5484,8 @@ typedef struct{
 
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9,
-                                                           uint8                                   **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8                                   **ie_ptr,
+                                                           LIBLTE_BIT_PTR                          *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9);
 
 /*********************************************************************
@@ -5546,8 +5546,8 @@ typedef struct{
 }LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT;
 // Functions
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13,
-                                                            uint8                                    **ie_ptr);
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8                                    **ie_ptr,
+                                                            LIBLTE_BIT_PTR                           *ie_ptr);
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13);
 
 /*******************************************************************************
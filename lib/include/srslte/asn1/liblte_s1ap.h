@@ -588,9 +588,9 @@ static const char liblte_s1ap_criticality_text[LIBLTE_S1AP_CRITICALITY_N_ITEMS][
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
   LIBLTE_S1AP_CRITICALITY_ENUM                                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CRITICALITY_ENUM                                 *ie);
 
 /*******************************************************************************
@@ -602,9 +602,9 @@ uint16_t local;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
   LIBLTE_S1AP_LOCAL_STRUCT                                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LOCAL_STRUCT                                     *ie);
 
 /*******************************************************************************
@@ -632,9 +632,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -646,9 +646,9 @@ uint16_t ProtocolExtensionID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -668,9 +668,9 @@ static const char liblte_s1ap_triggeringmessage_text[LIBLTE_S1AP_TRIGGERINGMESSA
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                           *ie);
 
 /*******************************************************************************
@@ -690,9 +690,9 @@ static const char liblte_s1ap_presence_text[LIBLTE_S1AP_PRESENCE_N_ITEMS][80] =
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
   LIBLTE_S1AP_PRESENCE_ENUM                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRESENCE_ENUM                                    *ie);
 
 /*******************************************************************************
@@ -704,9 +704,9 @@ uint16_t ProtocolIE_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -718,9 +718,9 @@ uint8_t ProcedureCode;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -734,9 +734,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -750,9 +750,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -768,9 +768,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -784,9 +784,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                *ie);
 
 /*******************************************************************************
@@ -800,9 +800,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -816,9 +816,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT              *ie);
 
 /*******************************************************************************
@@ -832,9 +832,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -848,9 +848,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                *ie);
 
 /*******************************************************************************
@@ -864,9 +864,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -878,9 +878,9 @@ uint32_t BitRate;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
   LIBLTE_S1AP_BITRATE_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_BITRATE_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -911,9 +911,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                               *ie);
 
 /*******************************************************************************
@@ -1010,9 +1010,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                       *ie);
 
 /*******************************************************************************
@@ -1041,9 +1041,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                *ie);
 
 /*******************************************************************************
@@ -1056,9 +1056,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -1072,9 +1072,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -1088,9 +1088,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -1111,9 +1111,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT            *ie);
 
 /*******************************************************************************
@@ -1127,9 +1127,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -1143,9 +1143,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -1163,9 +1163,9 @@ static const char liblte_s1ap_cndomain_text[LIBLTE_S1AP_CNDOMAIN_N_ITEMS][80] =
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
   LIBLTE_S1AP_CNDOMAIN_ENUM                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CNDOMAIN_ENUM                                    *ie);
 
 /*******************************************************************************
@@ -1178,9 +1178,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -1203,9 +1203,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT           *ie);
 
 /*******************************************************************************
@@ -1226,9 +1226,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                           *ie);
 
 /*******************************************************************************
@@ -1249,9 +1249,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT            *ie);
 
 /*******************************************************************************
@@ -1264,9 +1264,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -1279,9 +1279,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
   LIBLTE_S1AP_MACROENB_ID_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MACROENB_ID_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -1294,9 +1294,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -1325,9 +1325,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
   LIBLTE_S1AP_ENB_ID_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENB_ID_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -1341,9 +1341,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
   LIBLTE_S1AP_ENBNAME_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENBNAME_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -1357,9 +1357,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -1384,9 +1384,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                               *ie);
 
 /*******************************************************************************
@@ -1398,9 +1398,9 @@ uint16_t ExtendedRNC_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -1431,9 +1431,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                      *ie);
 
 /*******************************************************************************
@@ -1454,9 +1454,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT              *ie);
 
 /*******************************************************************************
@@ -1468,9 +1468,9 @@ uint32_t HFN;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
   LIBLTE_S1AP_HFN_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_HFN_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -1484,9 +1484,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
   LIBLTE_S1AP_IMSI_STRUCT                                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_IMSI_STRUCT                                      *ie);
 
 /*******************************************************************************
@@ -1499,9 +1499,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -1514,9 +1514,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
   LIBLTE_S1AP_LAC_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LAC_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -1530,9 +1530,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT           *ie);
 
 /*******************************************************************************
@@ -1546,9 +1546,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -1562,9 +1562,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
   LIBLTE_S1AP_LHN_ID_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LHN_ID_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -1590,9 +1590,9 @@ static const char liblte_s1ap_loggingduration_text[LIBLTE_S1AP_LOGGINGDURATION_N
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                             *ie);
 
 /*******************************************************************************
@@ -1617,9 +1617,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                          *ie);
 
 /*******************************************************************************
@@ -1640,9 +1640,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT               *ie);
 
 /*******************************************************************************
@@ -1665,9 +1665,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                        *ie);
 
 /*******************************************************************************
@@ -1680,9 +1680,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -1695,9 +1695,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -1711,9 +1711,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
   LIBLTE_S1AP_MMENAME_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MMENAME_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -1726,9 +1726,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -1740,9 +1740,9 @@ uint32_t MME_UE_S1AP_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -1756,9 +1756,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -1772,9 +1772,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
   LIBLTE_S1AP_NAS_PDU_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_NAS_PDU_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -1788,9 +1788,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT            *ie);
 
 /*******************************************************************************
@@ -1802,9 +1802,9 @@ uint16_t NumberOfBroadcasts;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -1833,9 +1833,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                          *ie);
 
 /*******************************************************************************
@@ -1862,9 +1862,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                               *ie);
 
 /*******************************************************************************
@@ -1876,9 +1876,9 @@ uint16_t PDCP_SN;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
   LIBLTE_S1AP_PDCP_SN_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PDCP_SN_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -1891,9 +1891,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -1911,9 +1911,9 @@ static const char liblte_s1ap_pre_emptionvulnerability_text[LIBLTE_S1AP_PRE_EMPT
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                    *ie);
 
 /*******************************************************************************
@@ -1934,9 +1934,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                  *ie);
 
 /*******************************************************************************
@@ -1949,9 +1949,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -1963,9 +1963,9 @@ uint8_t RelativeMMECapacity;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -1978,9 +1978,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
   LIBLTE_S1AP_RAC_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RAC_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -2020,9 +2020,9 @@ static const char liblte_s1ap_reportintervalmdt_text[LIBLTE_S1AP_REPORTINTERVALM
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                           *ie);
 
 /*******************************************************************************
@@ -2043,9 +2043,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                              *ie);
 
 /*******************************************************************************
@@ -2057,9 +2057,9 @@ uint16_t RNC_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
   LIBLTE_S1AP_RNC_ID_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RNC_ID_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -2090,9 +2090,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                 *ie);
 
 /*******************************************************************************
@@ -2104,9 +2104,9 @@ uint8_t Routing_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -2129,9 +2129,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                   *ie);
 
 /*******************************************************************************
@@ -2145,9 +2145,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT      *ie);
 
 /*******************************************************************************
@@ -2170,9 +2170,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                       *ie);
 
 /*******************************************************************************
@@ -2186,9 +2186,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT *ie);
 
 /*******************************************************************************
@@ -2200,9 +2200,9 @@ uint8_t SubscriberProfileIDforRFP;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -2225,9 +2225,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                   *ie);
 
 /*******************************************************************************
@@ -2241,9 +2241,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT *ie);
 
 /*******************************************************************************
@@ -2255,9 +2255,9 @@ uint8_t Threshold_RSRQ;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -2269,9 +2269,9 @@ uint16_t Time_UE_StayedInCell;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -2286,9 +2286,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -2319,9 +2319,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                              *ie);
 
 /*******************************************************************************
@@ -2333,9 +2333,9 @@ uint8_t TrafficLoadReductionIndication;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT            *ie);
 
 /*******************************************************************************
@@ -2349,9 +2349,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -2364,9 +2364,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -2380,9 +2380,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -2415,9 +2415,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                           *ie);
 
 /*******************************************************************************
@@ -2438,9 +2438,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                          *ie);
 
 /*******************************************************************************
@@ -2463,9 +2463,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                         *ie);
 
 /*******************************************************************************
@@ -2479,9 +2479,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -2508,9 +2508,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                               *ie);
 
 /*******************************************************************************
@@ -2523,9 +2523,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
   LIBLTE_S1AP_CI_STRUCT                                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CI_STRUCT                                        *ie);
 
 /*******************************************************************************
@@ -2548,9 +2548,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                     *ie);
 
 /*******************************************************************************
@@ -2568,9 +2568,9 @@ static const char liblte_s1ap_csgmembershipstatus_text[LIBLTE_S1AP_CSGMEMBERSHIP
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                         *ie);
 
 /*******************************************************************************
@@ -2583,9 +2583,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -2599,9 +2599,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -2615,9 +2615,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT             *ie);
 
 /*******************************************************************************
@@ -2629,9 +2629,9 @@ uint32_t ENB_UE_S1AP_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -2644,9 +2644,9 @@ uint8_t E_RAB_ID;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -2663,9 +2663,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -2677,9 +2677,9 @@ uint16_t EUTRANRoundTripDelayEstimationInfo;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT        *ie);
 
 /*******************************************************************************
@@ -2693,9 +2693,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -2708,9 +2708,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
   LIBLTE_S1AP_GTP_TEID_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GTP_TEID_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -2733,9 +2733,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                              *ie);
 
 /*******************************************************************************
@@ -2764,9 +2764,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                            *ie);
 
 /*******************************************************************************
@@ -2780,9 +2780,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT             *ie);
 
 //TODO: Type undefined NULL
@@ -2810,9 +2810,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT           *ie);
 
 /*******************************************************************************
@@ -2837,9 +2837,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                            *ie);
 
 /*******************************************************************************
@@ -2869,9 +2869,9 @@ static const char liblte_s1ap_logginginterval_text[LIBLTE_S1AP_LOGGINGINTERVAL_N
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                             *ie);
 
 /*******************************************************************************
@@ -2896,9 +2896,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                *ie);
 
 /*******************************************************************************
@@ -2927,9 +2927,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                *ie);
 
 /*******************************************************************************
@@ -2958,9 +2958,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                *ie);
 
 /*******************************************************************************
@@ -2973,9 +2973,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -2988,9 +2988,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
   LIBLTE_S1AP_MME_CODE_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MME_CODE_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -3004,9 +3004,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -3018,9 +3018,9 @@ uint16_t NumberofBroadcastRequest;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -3046,9 +3046,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -3060,9 +3060,9 @@ uint16_t PDCP_SNExtended;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -3080,9 +3080,9 @@ static const char liblte_s1ap_pre_emptioncapability_text[LIBLTE_S1AP_PRE_EMPTION
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                       *ie);
 
 /*******************************************************************************
@@ -3094,9 +3094,9 @@ uint8_t QCI;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
   LIBLTE_S1AP_QCI_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_QCI_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -3117,9 +3117,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                     *ie);
 
 /*******************************************************************************
@@ -3144,9 +3144,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                      *ie);
 
 /*******************************************************************************
@@ -3160,9 +3160,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -3174,9 +3174,9 @@ uint16_t RepetitionPeriod;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -3189,9 +3189,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
   LIBLTE_S1AP_SECURITYKEY_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SECURITYKEY_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -3204,9 +3204,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -3220,9 +3220,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT *ie);
 
 /*******************************************************************************
@@ -3243,9 +3243,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                  *ie);
 
 /*******************************************************************************
@@ -3259,9 +3259,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -3274,9 +3274,9 @@ uint8_t StratumLevel;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -3289,9 +3289,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
   LIBLTE_S1AP_TAC_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAC_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -3305,9 +3305,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -3320,9 +3320,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
   LIBLTE_S1AP_TBCD_STRING_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TBCD_STRING_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -3336,9 +3336,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT      *ie);
 
 /*******************************************************************************
@@ -3350,9 +3350,9 @@ uint8_t Threshold_RSRP;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -3364,9 +3364,9 @@ uint16_t Time_UE_StayedInCell_EnhancedGranularity;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT  *ie);
 
 /*******************************************************************************
@@ -3379,9 +3379,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -3404,9 +3404,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                             *ie);
 
 /*******************************************************************************
@@ -3422,9 +3422,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -3440,9 +3440,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -3455,9 +3455,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -3473,9 +3473,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -3498,9 +3498,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT              *ie);
 
 /*******************************************************************************
@@ -3513,9 +3513,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -3529,9 +3529,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -3554,9 +3554,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                          *ie);
 
 /*******************************************************************************
@@ -3579,9 +3579,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                        *ie);
 
 /*******************************************************************************
@@ -3595,9 +3595,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -3613,9 +3613,9 @@ static const char liblte_s1ap_concurrentwarningmessageindicator_text[LIBLTE_S1AP
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM           *ie);
 
 /*******************************************************************************
@@ -3631,9 +3631,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -3650,9 +3650,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT            *ie);
 
 /*******************************************************************************
@@ -3666,9 +3666,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                 *ie);
 
 /*******************************************************************************
@@ -3680,9 +3680,9 @@ uint32_t ExtendedRepetitionPeriod;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -3696,9 +3696,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -3716,9 +3716,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -3730,9 +3730,9 @@ uint32_t HFNModified;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -3748,9 +3748,9 @@ static const char liblte_s1ap_killallwarningmessages_text[LIBLTE_S1AP_KILLALLWAR
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                      *ie);
 
 /*******************************************************************************
@@ -3764,9 +3764,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -3781,9 +3781,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -3799,9 +3799,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -3830,9 +3830,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -3845,9 +3845,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
   LIBLTE_S1AP_M_TMSI_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M_TMSI_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -3861,9 +3861,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT               *ie);
 
 /*******************************************************************************
@@ -3876,9 +3876,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -3892,9 +3892,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT         *ie);
 
 /*******************************************************************************
@@ -3910,9 +3910,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -3926,9 +3926,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -3940,9 +3940,9 @@ uint8_t nextHopChainingCount;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -3958,9 +3958,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -3974,9 +3974,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -3992,9 +3992,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -4010,9 +4010,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
   LIBLTE_S1AP_TAI_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAI_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -4027,9 +4027,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -4044,9 +4044,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT *ie);
 
 /*******************************************************************************
@@ -4061,9 +4061,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -4077,9 +4077,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -4096,9 +4096,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -4127,9 +4127,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -4147,9 +4147,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -4163,9 +4163,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
   LIBLTE_S1AP_BPLMNS_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_BPLMNS_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -4203,9 +4203,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
   LIBLTE_S1AP_CAUSE_STRUCT                                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CAUSE_STRUCT                                     *ie);
 
 /*******************************************************************************
@@ -4222,9 +4222,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -4243,9 +4243,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
   LIBLTE_S1AP_CGI_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CGI_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -4261,9 +4261,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -4277,9 +4277,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT            *ie);
 
 /*******************************************************************************
@@ -4295,9 +4295,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -4311,9 +4311,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
   LIBLTE_S1AP_EPLMNS_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EPLMNS_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -4329,9 +4329,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_E_RABITEM_STRUCT                                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABITEM_STRUCT                                 *ie);
 
 /*******************************************************************************
@@ -4347,9 +4347,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -4365,9 +4365,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -4383,9 +4383,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -4401,9 +4401,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
   LIBLTE_S1AP_LAI_STRUCT                                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LAI_STRUCT                                       *ie);
 
 /*******************************************************************************
@@ -4419,9 +4419,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -4435,9 +4435,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -4458,9 +4458,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                *ie);
 
 /*******************************************************************************
@@ -4495,9 +4495,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                          *ie);
 
 /*******************************************************************************
@@ -4509,9 +4509,9 @@ uint8_t PriorityLevel;
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -4525,9 +4525,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -4542,9 +4542,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -4558,9 +4558,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -4576,9 +4576,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -4592,9 +4592,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -4609,9 +4609,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -4627,9 +4627,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -4643,9 +4643,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT *ie);
 
 /*******************************************************************************
@@ -4659,9 +4659,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -4677,9 +4677,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -4693,9 +4693,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -4712,9 +4712,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT            *ie);
 
 /*******************************************************************************
@@ -4730,9 +4730,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -4748,9 +4748,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -4765,9 +4765,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -4783,9 +4783,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -4799,9 +4799,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -4814,9 +4814,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
   LIBLTE_S1AP_CSG_ID_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CSG_ID_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -4831,9 +4831,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -4854,9 +4854,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT     *ie);
 
 /*******************************************************************************
@@ -4871,9 +4871,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -4887,9 +4887,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -4903,9 +4903,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -4922,9 +4922,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
   LIBLTE_S1AP_GUMMEI_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GUMMEI_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -4940,9 +4940,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                 *ie);
 
 /*******************************************************************************
@@ -4956,9 +4956,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT          *ie);
 
 /*******************************************************************************
@@ -4988,9 +4988,9 @@ static const char liblte_s1ap_reportamountmdt_text[LIBLTE_S1AP_REPORTAMOUNTMDT_N
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                             *ie);
 
 /*******************************************************************************
@@ -5007,9 +5007,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -5025,9 +5025,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
   LIBLTE_S1AP_S_TMSI_STRUCT                                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_S_TMSI_STRUCT                                    *ie);
 
 /*******************************************************************************
@@ -5041,9 +5041,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -5057,9 +5057,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -5079,9 +5079,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -5099,9 +5099,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT     *ie);
 
 /*******************************************************************************
@@ -5130,9 +5130,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -5151,9 +5151,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT      *ie);
 
 /*******************************************************************************
@@ -5167,9 +5167,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -5183,9 +5183,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -5200,9 +5200,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -5216,9 +5216,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -5232,9 +5232,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
   LIBLTE_S1AP_ECGILIST_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ECGILIST_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -5250,9 +5250,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT            *ie);
 
 /*******************************************************************************
@@ -5269,9 +5269,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -5285,9 +5285,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
   LIBLTE_S1AP_E_RABLIST_STRUCT                                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABLIST_STRUCT                                 *ie);
 
 /*******************************************************************************
@@ -5301,9 +5301,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -5316,9 +5316,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -5334,9 +5334,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -5350,9 +5350,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -5384,9 +5384,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -5400,9 +5400,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -5417,9 +5417,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -5435,9 +5435,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -5469,9 +5469,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
   LIBLTE_S1AP_TARGETID_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TARGETID_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -5503,9 +5503,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                           *ie);
 
 //TODO: Type pLMNWide NULL
@@ -5542,9 +5542,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -5558,9 +5558,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -5575,9 +5575,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
   LIBLTE_S1AP_CELLTYPE_STRUCT                                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLTYPE_STRUCT                                  *ie);
 
 /*******************************************************************************
@@ -5591,9 +5591,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -5607,9 +5607,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                *ie);
 
 /*******************************************************************************
@@ -5627,9 +5627,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -5646,9 +5646,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT          *ie);
 
 /*******************************************************************************
@@ -5665,9 +5665,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                               *ie);
 
 /*******************************************************************************
@@ -5681,9 +5681,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -5699,9 +5699,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -5716,9 +5716,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -5732,9 +5732,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT       *ie);
 
 /*******************************************************************************
@@ -5748,9 +5748,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                          *ie);
 
 /*******************************************************************************
@@ -5764,9 +5764,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -5789,9 +5789,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -5823,9 +5823,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -5841,9 +5841,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -5857,9 +5857,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -5890,9 +5890,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                              *ie);
 
 /*******************************************************************************
@@ -5906,9 +5906,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -5930,9 +5930,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -5948,9 +5948,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT            *ie);
 
 /*******************************************************************************
@@ -5970,9 +5970,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                              *ie);
 
 /*******************************************************************************
@@ -6001,9 +6001,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
   LIBLTE_S1AP_MDTMODE_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MDTMODE_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -6024,9 +6024,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT *ie);
 
 /*******************************************************************************
@@ -6040,9 +6040,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -6059,9 +6059,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -6075,9 +6075,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -6109,9 +6109,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                *ie);
 
 /*******************************************************************************
@@ -6126,9 +6126,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT   *ie);
 
 /*******************************************************************************
@@ -6146,9 +6146,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -6180,9 +6180,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                *ie);
 
 /*******************************************************************************
@@ -6211,9 +6211,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
   LIBLTE_S1AP_SONINFORMATION_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SONINFORMATION_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -6230,9 +6230,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -6253,9 +6253,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                *ie);
 
 /*******************************************************************************
@@ -6281,9 +6281,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT       *ie);
 
 /*******************************************************************************
@@ -6297,9 +6297,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                *ie);
 
 /*******************************************************************************
@@ -6322,9 +6322,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6342,9 +6342,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6369,9 +6369,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -6387,9 +6387,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT            *ie);
 
 /*******************************************************************************
@@ -6406,9 +6406,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6425,9 +6425,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6446,9 +6446,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT             *ie);
 
 /*******************************************************************************
@@ -6465,9 +6465,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -6484,9 +6484,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT         *ie);
 
 /*******************************************************************************
@@ -6501,9 +6501,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT               *ie);
 
 /*******************************************************************************
@@ -6518,9 +6518,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT             *ie);
 
 /*******************************************************************************
@@ -6540,9 +6540,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT               *ie);
 
 /*******************************************************************************
@@ -6559,9 +6559,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6576,9 +6576,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_TAIITEM_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAIITEM_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -6592,9 +6592,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT  *ie);
 
 /*******************************************************************************
@@ -6608,9 +6608,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT *ie);
 
 /*******************************************************************************
@@ -6623,9 +6623,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -6654,9 +6654,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
   LIBLTE_S1AP_RESETTYPE_STRUCT                                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_RESETTYPE_STRUCT                                 *ie);
 
 /*******************************************************************************
@@ -6670,9 +6670,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT          *ie);
 
 /*******************************************************************************
@@ -6686,9 +6686,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6702,9 +6702,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -6718,9 +6718,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6734,9 +6734,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6750,9 +6750,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT             *ie);
 
 /*******************************************************************************
@@ -6766,9 +6766,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -6782,9 +6782,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT         *ie);
 
 /*******************************************************************************
@@ -6798,9 +6798,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT               *ie);
 
 /*******************************************************************************
@@ -6814,9 +6814,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT             *ie);
 
 /*******************************************************************************
@@ -6830,9 +6830,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT               *ie);
 
 /*******************************************************************************
@@ -6846,9 +6846,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -6862,9 +6862,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
   LIBLTE_S1AP_TAILIST_STRUCT                                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_TAILIST_STRUCT                                   *ie);
 
 /*******************************************************************************
@@ -6878,9 +6878,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT            *ie);
 
 /*******************************************************************************
@@ -6892,9 +6892,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -6906,9 +6906,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -6920,9 +6920,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -6934,9 +6934,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT         *ie);
 
 /*******************************************************************************
@@ -6948,9 +6948,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT         *ie);
 
 /*******************************************************************************
@@ -6962,9 +6962,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -6976,9 +6976,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT         *ie);
 
 /*******************************************************************************
@@ -6990,9 +6990,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -7004,9 +7004,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -7018,9 +7018,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7032,9 +7032,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -7046,9 +7046,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7060,9 +7060,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT        *ie);
 
 /*******************************************************************************
@@ -7074,9 +7074,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7088,9 +7088,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7102,9 +7102,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7116,9 +7116,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -7130,9 +7130,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -7144,9 +7144,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -7158,9 +7158,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7172,9 +7172,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT      *ie);
 
 /*******************************************************************************
@@ -7186,9 +7186,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -7200,9 +7200,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7214,9 +7214,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -7228,9 +7228,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT             *ie);
 
 /*******************************************************************************
@@ -7242,9 +7242,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT             *ie);
 
 /*******************************************************************************
@@ -7256,9 +7256,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7270,9 +7270,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -7284,9 +7284,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -7298,9 +7298,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -7312,9 +7312,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -7326,9 +7326,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7340,9 +7340,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7354,9 +7354,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7368,9 +7368,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT           *ie);
 
 /*******************************************************************************
@@ -7382,9 +7382,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -7396,9 +7396,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -7410,9 +7410,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7424,9 +7424,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -7438,9 +7438,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT             *ie);
 
 /*******************************************************************************
@@ -7452,9 +7452,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT             *ie);
 
 /*******************************************************************************
@@ -7466,9 +7466,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -7480,9 +7480,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -7494,9 +7494,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -7508,9 +7508,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -7522,9 +7522,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7536,9 +7536,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7550,9 +7550,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -7564,9 +7564,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -7578,9 +7578,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -7592,9 +7592,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -7606,9 +7606,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7620,9 +7620,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7634,9 +7634,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT            *ie);
 
 /*******************************************************************************
@@ -7648,9 +7648,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT   *ie);
 
 /*******************************************************************************
@@ -7662,9 +7662,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7676,9 +7676,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7690,9 +7690,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT        *ie);
 
 /*******************************************************************************
@@ -7704,9 +7704,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -7718,9 +7718,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -7734,9 +7734,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7749,9 +7749,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT              *ie);
 
 /*******************************************************************************
@@ -7767,9 +7767,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7783,9 +7783,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT           *ie);
 
 /*******************************************************************************
@@ -7803,9 +7803,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -7818,9 +7818,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                         *ie);
 
 /*******************************************************************************
@@ -7834,9 +7834,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT             *ie);
 
 /*******************************************************************************
@@ -7850,9 +7850,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT        *ie);
 
 /*******************************************************************************
@@ -7865,9 +7865,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT *ie);
 
 /*******************************************************************************
@@ -7887,9 +7887,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -7903,9 +7903,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT      *ie);
 
 /*******************************************************************************
@@ -7919,9 +7919,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT               *ie);
 
 /*******************************************************************************
@@ -7955,9 +7955,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -7969,9 +7969,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -7988,9 +7988,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT        *ie);
 
 /*******************************************************************************
@@ -8004,9 +8004,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -8018,9 +8018,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT             *ie);
 
 /*******************************************************************************
@@ -8032,9 +8032,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -8050,9 +8050,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -8072,9 +8072,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -8086,9 +8086,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -8100,9 +8100,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT       *ie);
 
 /*******************************************************************************
@@ -8119,9 +8119,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT          *ie);
 
 /*******************************************************************************
@@ -8136,9 +8136,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -8154,9 +8154,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT         *ie);
 
 /*******************************************************************************
@@ -8172,9 +8172,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT  *ie);
 
 /*******************************************************************************
@@ -8186,9 +8186,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT      *ie);
 
 /*******************************************************************************
@@ -8202,9 +8202,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT *ie);
 
 /*******************************************************************************
@@ -8216,9 +8216,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT    *ie);
 
 /*******************************************************************************
@@ -8237,9 +8237,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT               *ie);
 
 /*******************************************************************************
@@ -8251,9 +8251,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT  *ie);
 
 /*******************************************************************************
@@ -8270,9 +8270,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT            *ie);
 
 /*******************************************************************************
@@ -8288,9 +8288,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT    *ie);
 
 /*******************************************************************************
@@ -8302,9 +8302,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT        *ie);
 
 /*******************************************************************************
@@ -8321,9 +8321,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT        *ie);
 
 /*******************************************************************************
@@ -8335,9 +8335,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -8354,9 +8354,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT           *ie);
 
 /*******************************************************************************
@@ -8370,9 +8370,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT           *ie);
 
 /*******************************************************************************
@@ -8390,9 +8390,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT          *ie);
 
 /*******************************************************************************
@@ -8422,9 +8422,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT      *ie);
 
 /*******************************************************************************
@@ -8440,9 +8440,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT     *ie);
 
 /*******************************************************************************
@@ -8459,9 +8459,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT      *ie);
 
 /*******************************************************************************
@@ -8477,9 +8477,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT     *ie);
 
 /*******************************************************************************
@@ -8496,9 +8496,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT    *ie);
 
 /*******************************************************************************
@@ -8517,9 +8517,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT              *ie);
 
 /*******************************************************************************
@@ -8556,9 +8556,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -8581,9 +8581,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                *ie);
 
 /*******************************************************************************
@@ -8599,9 +8599,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT          *ie);
 
 /*******************************************************************************
@@ -8614,9 +8614,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT *ie);
 
 /*******************************************************************************
@@ -8629,9 +8629,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT *ie);
 
 /*******************************************************************************
@@ -8651,9 +8651,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -8672,9 +8672,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -8694,9 +8694,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -8713,9 +8713,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -8735,9 +8735,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT            *ie);
 
 /*******************************************************************************
@@ -8751,9 +8751,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT *ie);
 
 /*******************************************************************************
@@ -8770,9 +8770,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT     *ie);
 
 /*******************************************************************************
@@ -8790,9 +8790,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT            *ie);
 
 /*******************************************************************************
@@ -8806,9 +8806,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT *ie);
 
 /*******************************************************************************
@@ -8825,9 +8825,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT     *ie);
 
 /*******************************************************************************
@@ -8852,9 +8852,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT         *ie);
 
 /*******************************************************************************
@@ -8869,9 +8869,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT        *ie);
 
 /*******************************************************************************
@@ -8886,9 +8886,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -8903,9 +8903,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -8920,9 +8920,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                        *ie);
 
 /*******************************************************************************
@@ -8938,9 +8938,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT            *ie);
 
 /*******************************************************************************
@@ -8955,9 +8955,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -8976,9 +8976,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -8993,9 +8993,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT          *ie);
 
 /*******************************************************************************
@@ -9010,9 +9010,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT *ie);
 
 /*******************************************************************************
@@ -9029,9 +9029,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -9048,9 +9048,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                     *ie);
 
 /*******************************************************************************
@@ -9064,9 +9064,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -9096,9 +9096,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT        *ie);
 
 /*******************************************************************************
@@ -9116,9 +9116,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT       *ie);
 
 /*******************************************************************************
@@ -9131,9 +9131,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT      *ie);
 
 /*******************************************************************************
@@ -9147,9 +9147,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT          *ie);
 
 /*******************************************************************************
@@ -9163,9 +9163,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT          *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT          *ie);
 
 /*******************************************************************************
@@ -9177,9 +9177,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                    *ie);
 
 /*******************************************************************************
@@ -9197,9 +9197,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                       *ie);
 
 /*******************************************************************************
@@ -9217,9 +9217,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                      *ie);
 
 /*******************************************************************************
@@ -9236,9 +9236,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT              *ie);
 
 /*******************************************************************************
@@ -9254,9 +9254,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT *ie);
 
 /*******************************************************************************
@@ -9272,9 +9272,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT   *ie);
 
 /*******************************************************************************
@@ -9288,9 +9288,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT *ie);
 
 /*******************************************************************************
@@ -9304,9 +9304,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT *ie);
 
 /*******************************************************************************
@@ -9319,9 +9319,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT      *ie);
 
 /*******************************************************************************
@@ -9334,9 +9334,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT           *ie);
 
 /*******************************************************************************
@@ -9349,9 +9349,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT           *ie);
 
 /*******************************************************************************
@@ -9364,9 +9364,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -9379,9 +9379,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT    *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT    *ie);
 
 /*******************************************************************************
@@ -9394,9 +9394,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT           *ie);
 
 /*******************************************************************************
@@ -9409,9 +9409,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT           *ie);
 
 /*******************************************************************************
@@ -9424,9 +9424,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT     *ie);
 
 /*******************************************************************************
@@ -9439,9 +9439,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT         *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT         *ie);
 
 /*******************************************************************************
@@ -9454,9 +9454,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT *ie);
 
 /*******************************************************************************
@@ -9469,9 +9469,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT       *ie);
 
 /*******************************************************************************
@@ -9484,9 +9484,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT     *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT     *ie);
 
 /*******************************************************************************
@@ -9499,9 +9499,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT       *ie);
 
 /*******************************************************************************
@@ -9514,9 +9514,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT           *ie);
 
 /*******************************************************************************
@@ -9529,9 +9529,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                           *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                           *ie);
 
 /*******************************************************************************
@@ -9547,9 +9547,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                  *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                  *ie);
 
 /*******************************************************************************
@@ -9563,9 +9563,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                             *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                             *ie);
 
 /*******************************************************************************
@@ -9585,9 +9585,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT       *ie);
 
 /*******************************************************************************
@@ -9613,9 +9613,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -9657,9 +9657,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                   *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                   *ie);
 
 /*******************************************************************************
@@ -9689,9 +9689,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -9718,9 +9718,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT      *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT      *ie);
 
 /*******************************************************************************
@@ -9737,9 +9737,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                 *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                 *ie);
 
 /*******************************************************************************
@@ -9759,9 +9759,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                *ie);
 
 /*******************************************************************************
@@ -9778,9 +9778,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                *ie);
 
 /*******************************************************************************
@@ -9800,9 +9800,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT               *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT               *ie);
 
 /*******************************************************************************
@@ -9824,9 +9824,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT              *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT              *ie);
 
 /*******************************************************************************
@@ -9870,9 +9870,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT        *ie);
 
 /*******************************************************************************
@@ -9891,9 +9891,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT       *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT       *ie);
 
 /*******************************************************************************
@@ -9915,9 +9915,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                            *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                            *ie);
 
 /*******************************************************************************
@@ -9941,9 +9941,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT        *ie,
-  uint8_t                                                     **ptr);
+  LIBLTE_BIT_PTR                                              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequestacknowledge(
-  uint8_t                                                     **ptr,
+  LIBLTE_BIT_PTR                                              *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT        *ie);
 
 /*******************************************************************************
@@ -10009,9 +10009,9 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
   uint32_t                      len,
   uint32_t                      ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM  crit,
-  uint8_t                     **ptr);
+  LIBLTE_BIT_PTR              *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
-  uint8_t                     **ptr,
+  LIBLTE_BIT_PTR              *ptr,
   uint32_t                     *ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM *crit,
   uint32_t                     *len);
@@ -10187,9 +10187,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg,
-  uint8_t                             **ptr);
+  LIBLTE_BIT_PTR                      *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_PTR                      *ptr,
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg);
 
 /*******************************************************************************
@@ -10237,9 +10237,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                               **ptr);
+  LIBLTE_BIT_PTR                        *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
-  uint8_t                               **ptr,
+  LIBLTE_BIT_PTR                        *ptr,
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg);
 
 /*******************************************************************************
@@ -10314,9 +10314,9 @@ typedef struct{
 
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                             **ptr);
+  LIBLTE_BIT_PTR                      *ptr);
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_successfuloutcome(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_PTR                      *ptr,
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg);
 
 /*******************************************************************************
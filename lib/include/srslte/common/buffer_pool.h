@@ -28,9 +28,10 @@
 #define BUFFER_POOL_H
 
 #include <pthread.h>
-#include <vector>
-#include <stack>
-#include <algorithm>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <new>
 
 /*******************************************************************************
                               INCLUDES
@@ -46,6 +47,18 @@ namespace srslte {
  * Preallocates a large number of buffer_t and provides allocate and
  * deallocate functions. Provides quick object creation and deletion as well
  * as object reuse. 
+ * 
+ * Free buffers are kept in a lock-free stack (a free list linked through the 
+ * preallocated nodes) so that allocate and deallocate are O(1) and never block. 
+ * The head of the stack carries a tag, incremented on every update, to avoid 
+ * the ABA problem. 
+ * 
+ * Buffers are default constructed, or constructed on consecutive chunks of a 
+ * single slab of memory if a buffer size is given. 
+ * 
+ * If SRSLTE_BUFFER_POOL_LOG_ENABLED is defined, the pool also tracks which 
+ * buffers are in use, who allocated them, and detects double deallocations. 
+ * 
  * Singleton class of byte_buffer_t (but other pools of different type can be created)
  *****************************************************************************/
 
@@ -56,90 +69,194 @@ public:
   // non-static methods
   buffer_pool(uint32_t nof_buffers = POOL_SIZE)
   {
-    pthread_mutex_init(&mutex, NULL);
+    init_nodes(nof_buffers);
+    slab = NULL; 
     for(uint32_t i=0;i<nof_buffers;i++) {
-      buffer_t *b = new buffer_t;
-      available.push(b);
+      new (&nodes[i].buffer) buffer_t();
+    }
+  }
+  
+  buffer_pool(uint32_t nof_buffers, uint32_t buffer_size)
+  {
+    init_nodes(nof_buffers);
+    slab = new uint8_t[nof_buffers*buffer_size]; 
+    for(uint32_t i=0;i<nof_buffers;i++) {
+      new (&nodes[i].buffer) buffer_t(&slab[i*buffer_size], buffer_size);
     }
-    capacity = nof_buffers; 
   }
 
   ~buffer_pool() { 
     // this destructor assumes all buffers have been properly deallocated 
-    while(available.size()) {
-      delete available.top();
-      available.pop();
+    for(uint32_t i=0;i<capacity;i++) {
+      nodes[i].buffer.~buffer_t();
+    }
+    operator delete(nodes); 
+    if (slab) {
+      delete [] slab; 
     }
   }
   
   void print_all_buffers()
   {
-    printf("%d buffers in queue\n", (int) used.size());
-    for (uint32_t i=0;i<used.size();i++) {
-      printf("%s\n", strlen(used[i]->debug_name)?used[i]->debug_name:"Undefined");
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    printf("%d buffers in queue\n", (int) (capacity - nof_available));
+    for (uint32_t i=0;i<capacity;i++) {
+      if (nodes[i].in_use) {
+        printf("%s\n", strlen(nodes[i].buffer.debug_name)?nodes[i].buffer.debug_name:"Undefined");
+      }
     }
+#endif
   }
   
+  uint32_t nof_available_buffers()
+  {
+    return nof_available; 
+  }
+
+  bool owns(buffer_t *b)
+  {
+    return index_of(b) != NIL; 
+  }
 
   buffer_t* allocate(const char *debug_name = NULL)
   {
-    pthread_mutex_lock(&mutex);
-    buffer_t* b = NULL;
-
-    if(available.size() > 0)
-    {
-      b = available.top();
-      used.push_back(b);
-      available.pop();
-      
-      if (available.size() < capacity/20) {
-        printf("Warning buffer pool capacity is %f %%\n", (float) available.size()/capacity);
+    uint64_t old_head, new_head;
+    uint32_t idx; 
+    
+    do {
+      old_head = head; 
+      idx      = (uint32_t) old_head; 
+      if (idx == NIL) {
+        printf("Error - buffer pool is empty\n");
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+        print_all_buffers();
+#endif
+        return NULL; 
       }
+      // nodes are never freed, a stale next is discarded by the tag check 
+      new_head = next_tag(old_head) | nodes[idx].next; 
+    } while (!__sync_bool_compare_and_swap(&head, old_head, new_head));
+    
+    uint32_t available = __sync_sub_and_fetch(&nof_available, 1);
+    if (available < capacity/20) {
+      printf("Warning buffer pool capacity is %f %%\n", (float) available/capacity);
+    }
+    
+    buffer_t *b = &nodes[idx].buffer;
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    nodes[idx].in_use = true; 
     if (debug_name) {
       strncpy(b->debug_name, debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
       b->debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN-1] = 0;
     }
 #endif
-      
-    } else {
-      printf("Error - buffer pool is empty\n");
-      
-#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
-      print_all_buffers();
-#endif
-    }
-
-    pthread_mutex_unlock(&mutex);
     return b;
   }
   
   bool deallocate(buffer_t *b)
   {
-    bool ret = false; 
-    pthread_mutex_lock(&mutex);
-    typename std::vector<buffer_t*>::iterator elem = std::find(used.begin(), used.end(), b);
-    if (elem != used.end()) {
-      used.erase(elem); 
-      available.push(b);
-      ret = true; 
-    } else {
+    uint64_t old_head, new_head;
+    uint32_t idx = index_of(b); 
+    
+    if (idx == NIL) {
       printf("Error deallocating from buffer pool: buffer not created in this pool.\n");
+      return false; 
     }
-    pthread_mutex_unlock(&mutex);
-    return ret; 
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    if (!__sync_bool_compare_and_swap(&nodes[idx].in_use, true, false)) {
+      printf("Error deallocating from buffer pool: buffer already deallocated.\n");
+      return false; 
+    }
+#endif
+    
+    do {
+      old_head = head; 
+      nodes[idx].next = (uint32_t) old_head; 
+      new_head = next_tag(old_head) | idx; 
+    } while (!__sync_bool_compare_and_swap(&head, old_head, new_head));
+    
+    __sync_add_and_fetch(&nof_available, 1);
+    return true; 
   }
 
   
 private:  
   static const int       POOL_SIZE = 2048;
-  std::stack<buffer_t*>  available;
-  std::vector<buffer_t*> used; 
-  pthread_mutex_t        mutex;  
-  uint32_t capacity;
+  static const uint32_t  NIL       = 0xffffffff; 
+  
+  typedef struct {
+    buffer_t          buffer; 
+    volatile uint32_t next; 
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    volatile bool     in_use; 
+#endif
+  } node_t; 
+  
+  void init_nodes(uint32_t nof_buffers)
+  {
+    nodes    = (node_t*) operator new(sizeof(node_t)*nof_buffers);
+    capacity = nof_buffers; 
+    for(uint32_t i=0;i<nof_buffers;i++) {
+      nodes[i].next   = (i+1 < nof_buffers)?i+1:NIL;
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+      nodes[i].in_use = false; 
+#endif
+    }
+    head          = nof_buffers?0:NIL;
+    nof_available = nof_buffers; 
+  }
+  
+  // Upper 32 bits of the head are the tag, lower 32 bits the index of the first free node
+  static uint64_t next_tag(uint64_t h) 
+  {
+    return ((h>>32)+1)<<32; 
+  }
+  
+  // Returns the index of the node containing b, or NIL if b does not belong to this pool 
+  uint32_t index_of(buffer_t *b) 
+  {
+    uint8_t *ptr   = (uint8_t*) b; 
+    uint8_t *first = (uint8_t*) nodes; 
+    if (ptr < first || ptr >= first + capacity*sizeof(node_t)) {
+      return NIL; 
+    }
+    uint32_t idx = (ptr - first)/sizeof(node_t); 
+    if (&nodes[idx].buffer != b) {
+      return NIL; 
+    }
+    return idx; 
+  }
+  
+  node_t                *nodes; 
+  uint8_t               *slab; 
+  volatile uint64_t      head; 
+  volatile uint32_t      nof_available; 
+  uint32_t               capacity;
 };
 
 
+/******************************************************************************
+ * Byte buffer pool
+ *
+ * Buffers are taken from one of several size classes, each one a slab of 
+ * memory shared by all its buffers. allocate() returns a buffer of the largest 
+ * class (SRSLTE_MAX_BUFFER_SIZE_BYTES), while allocate_bytes() returns a buffer 
+ * of the smallest class with room for the requested number of bytes after the 
+ * headroom, plus a small margin for trailers such as the PDCP MAC-I. 
+ * reallocate() reuses a buffer for a new message if it is large enough and 
+ * not shared, and swaps it for one of the right class otherwise. 
+ * 
+ * Each thread keeps a small cache of free buffers per class, so most allocations 
+ * and deallocations do not touch the shared pools at all. Buffers move between 
+ * the cache and the shared pool in batches of half the cache size, and the whole 
+ * cache returns to the shared pool when the thread exits. The cache is bypassed 
+ * when buffer tracking (SRSLTE_BUFFER_POOL_LOG_ENABLED) is enabled. 
+ * 
+ * A buffer can be shared by taking extra references with add_ref(). Every 
+ * reference is dropped with deallocate() and the buffer returns to the pool 
+ * with the last one. 
+ *****************************************************************************/
+
 class byte_buffer_pool {
 public: 
   // Singleton static methods
@@ -147,20 +264,152 @@ public:
   static byte_buffer_pool*   get_instance(void);
   static void                cleanup(void); 
   byte_buffer_pool() {
-    pool = new buffer_pool<byte_buffer_t>;
+    for (uint32_t i=0;i<NOF_CLASSES;i++) {
+      pools[i] = new buffer_pool<byte_buffer_t>(class_nof_buffers[i], class_size[i]);
+    }
+    generation = __sync_add_and_fetch(&generation_cnt, 1); 
+    pthread_key_create(&cache_key, flush_cache); 
   }
   ~byte_buffer_pool() {
-    delete pool; 
+    pthread_key_delete(cache_key); 
+    for (uint32_t i=0;i<NOF_CLASSES;i++) {
+      delete pools[i]; 
+    }
   }
   byte_buffer_t* allocate(const char *debug_name = NULL) {
-    return pool->allocate(debug_name);
+    return allocate_class(NOF_CLASSES-1, debug_name); 
+  }
+  byte_buffer_t* allocate_bytes(uint32_t nof_bytes, const char *debug_name = NULL) {
+    for (uint32_t i=0;i<NOF_CLASSES-1;i++) {
+      if (fits(nof_bytes, class_size[i])) {
+        byte_buffer_t *b = allocate_class(i, debug_name); 
+        if (b) {
+          return b; 
+        }
+      }
+    }
+    return allocate_class(NOF_CLASSES-1, debug_name); 
+  }
+  byte_buffer_t* reallocate(byte_buffer_t *b, uint32_t nof_bytes, const char *debug_name = NULL) {
+    if (b->nof_refs == 1 && fits(nof_bytes, b->get_buffer_size())) {
+      b->reset(); 
+      return b; 
+    }
+    deallocate(b); 
+    return allocate_bytes(nof_bytes, debug_name); 
+  }
+  void add_ref(byte_buffer_t *b) {
+    __sync_add_and_fetch(&b->nof_refs, 1); 
+  }
+  uint32_t nof_available_buffers() {
+    uint32_t n = 0; 
+    for (uint32_t i=0;i<NOF_CLASSES;i++) {
+      n += pools[i]->nof_available_buffers(); 
+    }
+    return n; 
   }
   void deallocate(byte_buffer_t *b) {
+    uint32_t c = class_of(b); 
+    if (!pools[c]->owns(b)) {
+      printf("Error deallocating from byte buffer pool: buffer not created in this pool.\n");
+      return; 
+    }
+    if (__sync_sub_and_fetch(&b->nof_refs, 1) > 0) {
+      return; 
+    }
+    b->nof_refs = 1; 
     b->reset();
-    pool->deallocate(b);
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    pools[c]->deallocate(b);
+#else
+    thread_cache_t *cache = get_cache(c); 
+    if (cache->count == CACHE_SIZE) {
+      // Return half of the cache to the shared pool
+      while (cache->count > CACHE_SIZE/2) {
+        pools[c]->deallocate(cache->buffers[--cache->count]);
+      }
+    }
+    cache->buffers[cache->count++] = b; 
+#endif
   }
 private:
-  buffer_pool<byte_buffer_t> *pool; 
+  static const uint32_t NOF_CLASSES = 3; 
+  static const uint32_t CACHE_SIZE  = 32; 
+  static const uint32_t TAILROOM    = 16; 
+  static const uint32_t class_size[NOF_CLASSES]; 
+  static const uint32_t class_nof_buffers[NOF_CLASSES]; 
+  
+  typedef struct {
+    uint32_t       generation; 
+    uint32_t       count; 
+    byte_buffer_t *buffers[CACHE_SIZE]; 
+  } thread_cache_t; 
+  
+  byte_buffer_t* allocate_class(uint32_t c, const char *debug_name) {
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    return pools[c]->allocate(debug_name);
+#else
+    thread_cache_t *cache = get_cache(c); 
+    if (cache->count == 0) {
+      // Refill half of the cache from the shared pool
+      while (cache->count < CACHE_SIZE/2 && pools[c]->nof_available_buffers() > 0) {
+        byte_buffer_t *b = pools[c]->allocate(); 
+        if (!b) {
+          break; 
+        }
+        cache->buffers[cache->count++] = b; 
+      }
+      if (cache->count == 0) {
+        return pools[c]->allocate(debug_name);
+      }
+    }
+    return cache->buffers[--cache->count]; 
+#endif
+  }
+  
+  static bool fits(uint32_t nof_bytes, uint32_t size) {
+    return nof_bytes + TAILROOM <= size - byte_buffer_t::headroom(size); 
+  }
+  
+  uint32_t class_of(byte_buffer_t *b) {
+    for (uint32_t i=0;i<NOF_CLASSES-1;i++) {
+      if (b->get_buffer_size() == class_size[i]) {
+        return i; 
+      }
+    }
+    return NOF_CLASSES-1; 
+  }
+  
+  // Caches filled by a previous instance of the pool are discarded. The key makes 
+  // flush_cache() run when the thread exits.
+  thread_cache_t* get_cache(uint32_t c) {
+    if (cache[c].generation != generation) {
+      cache[c].generation = generation; 
+      cache[c].count      = 0; 
+      pthread_setspecific(cache_key, this); 
+    }
+    return &cache[c]; 
+  }
+  
+  // Returns the buffers cached by an exiting thread to the shared pools. Thread-local 
+  // storage is still valid while the key destructors run.
+  static void flush_cache(void *arg) {
+    byte_buffer_pool *pool = (byte_buffer_pool*) arg; 
+    for (uint32_t c=0;c<NOF_CLASSES;c++) {
+      if (cache[c].generation == pool->generation) {
+        while (cache[c].count > 0) {
+          pool->pools[c]->deallocate(cache[c].buffers[--cache[c].count]);
+        }
+      }
+    }
+  }
+  
+  static __thread thread_cache_t cache[NOF_CLASSES]; 
+  static uint32_t                generation_cnt; 
+  
+  buffer_pool<byte_buffer_t> *pools[NOF_CLASSES]; 
+  uint32_t                    generation; 
+  pthread_key_t               cache_key; 
 };
 
 
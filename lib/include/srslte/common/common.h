@@ -31,6 +31,7 @@
                               INCLUDES
 *******************************************************************************/
 
+#include <assert.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -50,13 +51,16 @@
 #define SRSLTE_MAX_BUFFER_SIZE_BYTES 12756
 #define SRSLTE_BUFFER_HEADER_OFFSET  1024
 
-#define SRSLTE_BUFFER_POOL_LOG_ENABLED
-
+// Buffer tracking in the buffer pool is enabled with the ENABLE_BUFFER_POOL_LOG CMake option
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
 #define pool_allocate (pool->allocate(__FUNCTION__))
+#define pool_allocate_bytes(nof_bytes) (pool->allocate_bytes(nof_bytes, __FUNCTION__))
+#define pool_reallocate(buf, nof_bytes) (pool->reallocate(buf, nof_bytes, __FUNCTION__))
 #define SRSLTE_BUFFER_POOL_LOG_NAME_LEN 128
 #else
 #define pool_allocate (pool->allocate())
+#define pool_allocate_bytes(nof_bytes) (pool->allocate_bytes(nof_bytes))
+#define pool_reallocate(buf, nof_bytes) (pool->reallocate(buf, nof_bytes))
 #endif
 
 #include "srslte/srslte.h"
@@ -114,43 +118,43 @@ static const char rb_id_text[RB_ID_N_ITEMS][20] = { "SRB0",
  *
  * Generic buffers with headroom to accommodate packet headers and custom
  * copy constructors & assignment operators for quick copying. Byte buffer
- * holds a next pointer to support linked lists.
+ * holds a next pointer to support linked lists, and a reference count so that
+ * several holders can share a pool buffer (see byte_buffer_pool::add_ref()).
+ * 
+ * A byte buffer does not own its storage: pool buffers point into the slab of 
+ * their size class, and inline_byte_buffer_t below carries a full-size array 
+ * for buffers on the stack or inside other objects. Small buffers have a 
+ * proportionally smaller headroom. Assigning a buffer whose payload does not 
+ * fit in the tailroom of the destination is an error.
  *****************************************************************************/
 class byte_buffer_t{
+  friend class byte_buffer_pool;
 public:
-    uint32_t    N_bytes;
-    uint8_t     buffer[SRSLTE_MAX_BUFFER_SIZE_BYTES];
-    uint8_t    *msg;
+    uint32_t       N_bytes;
+    uint8_t       *buffer;
+    uint8_t       *msg;
+    byte_buffer_t *next;
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
     char        debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN];
 #endif
 
-    byte_buffer_t():N_bytes(0)
+    byte_buffer_t(uint8_t *storage, uint32_t size):N_bytes(0)
     {
-      timestamp_is_set = false; 
-      msg  = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
-      next = NULL; 
-#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
-      debug_name[0] = 0;
-#endif
-    }
-    byte_buffer_t(const byte_buffer_t& buf)
-    {
-      N_bytes = buf.N_bytes;
-      memcpy(msg, buf.msg, N_bytes);
+      init(storage, size);
     }
     byte_buffer_t & operator= (const byte_buffer_t & buf)
     {
       // avoid self assignment
       if (&buf == this)
         return *this;
+      assert(buf.N_bytes <= buffer_size - get_headroom());
       N_bytes = buf.N_bytes;
       memcpy(msg, buf.msg, N_bytes);
       return *this;
     }
     void reset()
     {
-      msg       = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
+      msg       = &buffer[headroom(buffer_size)];
       N_bytes   = 0;
       timestamp_is_set = false; 
     }
@@ -158,6 +162,19 @@ public:
     {
       return msg-buffer;
     }
+    uint32_t get_tailroom()
+    {
+      return buffer_size-(msg-buffer)-N_bytes;
+    }
+    uint32_t get_buffer_size()
+    {
+      return buffer_size;
+    }
+    // Headroom of an empty buffer of the given size
+    static uint32_t headroom(uint32_t size)
+    {
+      return size >= SRSLTE_MAX_BUFFER_SIZE_BYTES?SRSLTE_BUFFER_HEADER_OFFSET:size/4;
+    }
     long get_latency_us()
     {
       if(!timestamp_is_set)
@@ -175,6 +192,21 @@ public:
 
 private:
   
+  // Copies would share the storage, use operator= or inline_byte_buffer_t
+  byte_buffer_t(const byte_buffer_t& buf);
+  
+  void init(uint8_t *storage, uint32_t size)
+  {
+    buffer      = storage;
+    buffer_size = size;
+    nof_refs    = 1;
+    timestamp_is_set = false; 
+    msg  = &buffer[headroom(buffer_size)];
+    next = NULL; 
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    debug_name[0] = 0;
+#endif
+  }
   
   void get_time_interval(struct timeval * tdata) {
 
@@ -189,7 +221,34 @@ private:
   
     struct timeval timestamp[3];
     bool           timestamp_is_set; 
-    byte_buffer_t *next;
+    uint32_t       buffer_size;
+    volatile int32_t nof_refs;
+};
+
+// Byte buffer with full-size inline storage, for buffers that do not come from the pool
+class inline_byte_buffer_t : public byte_buffer_t {
+public:
+    inline_byte_buffer_t():byte_buffer_t(storage, SRSLTE_MAX_BUFFER_SIZE_BYTES) {}
+    inline_byte_buffer_t(const byte_buffer_t& buf):byte_buffer_t(storage, SRSLTE_MAX_BUFFER_SIZE_BYTES)
+    {
+      byte_buffer_t::operator=(buf);
+    }
+    inline_byte_buffer_t(const inline_byte_buffer_t& buf):byte_buffer_t(storage, SRSLTE_MAX_BUFFER_SIZE_BYTES)
+    {
+      byte_buffer_t::operator=(buf);
+    }
+    inline_byte_buffer_t & operator= (const byte_buffer_t & buf)
+    {
+      byte_buffer_t::operator=(buf);
+      return *this;
+    }
+    inline_byte_buffer_t & operator= (const inline_byte_buffer_t & buf)
+    {
+      byte_buffer_t::operator=(buf);
+      return *this;
+    }
+private:
+    uint8_t storage[SRSLTE_MAX_BUFFER_SIZE_BYTES];
 };
 
 struct bit_buffer_t{
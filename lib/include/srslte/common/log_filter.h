@@ -70,10 +70,12 @@ public:
 private:
   logger *logger_h;
   bool    do_tti;
+  int     service_id;   // Registered with logger_h in deferred mode, -1 otherwise
 
+  void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, const char *message, va_list args,
+               bool has_hex, uint8_t *hex, int size);
   void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, char *msg);
   void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, char *msg, uint8_t *hex, int size);
-  void all_log_line(srslte::LOG_LEVEL_ENUM level, uint32_t tti, std::string file, int line, char *msg);
   std::string now_time();
   std::string hex_string(uint8_t *hex, int size);
 };
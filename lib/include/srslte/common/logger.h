@@ -30,16 +30,27 @@
  *              and runs a thread to read messages and write to file.
  *              Multiple producers, single consumer. If full, producers
  *              increase queue size. If empty, consumer blocks.
+ *
+ *              In deferred mode, log_filter objects do not format
+ *              messages. Each calling thread writes binary records
+ *              (timestamp, TTI, level, format string, raw arguments and
+ *              hex payload) into its own lock-free ring and the logger
+ *              thread formats them. Records are dropped if a ring is full.
  *****************************************************************************/
 
 #ifndef LOGGER_H
 #define LOGGER_H
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <deque>
+#include <vector>
 #include <string>
+#include "srslte/common/log.h"
 #include "srslte/common/threads.h"
 
+#define LOGGER_MAX_SERVICES 128
+
 namespace srslte {
 
 typedef std::string* str_ptr;
@@ -50,13 +61,28 @@ public:
   logger();
   logger(std::string file);
   ~logger();
-  void init(std::string file);
+  void init(std::string file, bool deferred = false);
   void log(const char *msg);
   void log(str_ptr msg);
 
+  // Deferred mode interface, used by log_filter
+  bool     is_deferred();
+  int      register_service(std::string name);
+  void     log_deferred(int service, LOG_LEVEL_ENUM level, uint32_t tti, bool do_tti,
+                        const char *format, va_list args,
+                        bool has_hex, uint8_t *hex, int hex_len);
+  uint64_t get_nof_dropped();
+
 private:
+  class log_ring;
+
   void run_thread(); 
   void flush();
+  void write_strings(std::deque<str_ptr> *strings);
+  void drain_rings();
+  void write_record(void *record);
+  log_ring* get_ring();
+  static void close_ring(void *ring);
 
   FILE*                 logfile;
   bool                  inited;
@@ -67,6 +93,18 @@ private:
   pthread_mutex_t       mutex;
   pthread_t             thread;
   std::deque<str_ptr> buffer;
+
+  bool                    deferred;
+  pthread_key_t           ring_key;
+  pthread_mutex_t         rings_mutex;
+  std::vector<log_ring*>  rings;
+  uint64_t                nof_dropped_closed;
+  uint64_t                nof_dropped_reported;
+  std::string             services[LOGGER_MAX_SERVICES];
+  int                     nof_services;
+  char                   *line;
+  int64_t                 line_sec;
+  char                    line_time[16];
 };
 
 } // namespace srsue
@@ -27,6 +27,8 @@
 /******************************************************************************
  *  File:         msg_queue.h
  *  Description:  Thread-safe bounded circular buffer of srsue_byte_buffer pointers.
+ *                Writers never lock. Readers are serialized by a mutex that
+ *                writers never take, since RLC reset reads from another thread.
  *  Reference:
  *****************************************************************************/
 
@@ -34,6 +36,7 @@
 #define MSG_QUEUE_H
 
 #include "srslte/common/common.h"
+#include "srslte/common/ring_queue.h"
 #include <pthread.h>
 
 namespace srslte {
@@ -42,108 +45,75 @@ class msg_queue
 {
 public:
   msg_queue(uint32_t capacity_ = 128)
-    :head(0)
-    ,tail(0)
+    :q(capacity_)
     ,unread(0)
     ,unread_bytes(0)
-    ,capacity(capacity_)
   {
-    buf = new byte_buffer_t*[capacity];
-    pthread_mutex_init(&mutex, NULL);
-    pthread_cond_init(&not_empty, NULL);
-    pthread_cond_init(&not_full, NULL);
+    pthread_mutex_init(&read_mutex, NULL);
   }
 
   ~msg_queue()
   {
-    delete [] buf;
+    pthread_mutex_destroy(&read_mutex);
   }
 
   void write(byte_buffer_t *msg)
   {
-    pthread_mutex_lock(&mutex);
-    while(is_full()) {
-      pthread_cond_wait(&not_full, &mutex);
-    }
-    buf[head] = msg;
-    head = (head+1)%capacity;
-    unread++;
-    unread_bytes += msg->N_bytes;
-    
-    pthread_cond_signal(&not_empty);
-    pthread_mutex_unlock(&mutex);
+    // Counted before they are visible so that the counters never underflow
+    __atomic_add_fetch(&unread, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&unread_bytes, msg->N_bytes, __ATOMIC_RELAXED);
+    q.push(msg);
   }
 
   void read(byte_buffer_t **msg)
   {
-    pthread_mutex_lock(&mutex);
-    while(is_empty()) {
-      pthread_cond_wait(&not_empty, &mutex);
-    }
-    *msg = buf[tail];
-    tail = (tail+1)%capacity;
-    unread--;
-    unread_bytes -= (*msg)->N_bytes;
-
-    pthread_cond_signal(&not_full);
-    pthread_mutex_unlock(&mutex);
+    pthread_mutex_lock(&read_mutex);
+    *msg = q.wait_pop();
+    pthread_mutex_unlock(&read_mutex);
+    consumed(*msg);
   }
 
   bool try_read(byte_buffer_t **msg)
   {
-    pthread_mutex_lock(&mutex);
-    if(is_empty())
-    {
-      pthread_mutex_unlock(&mutex);
-      return false;
-    }else{
-      *msg = buf[tail];
-      tail = (tail+1)%capacity;
-      unread--;
-      unread_bytes -= (*msg)->N_bytes;
-      pthread_cond_signal(&not_full);
-      pthread_mutex_unlock(&mutex);
-      return true;
+    pthread_mutex_lock(&read_mutex);
+    bool ret = q.try_pop(msg);
+    pthread_mutex_unlock(&read_mutex);
+    if (ret) {
+      consumed(*msg);
     }
+    return ret;
   }
 
   uint32_t size()
   {
-    pthread_mutex_lock(&mutex);
-    uint32_t r = unread;
-    pthread_mutex_unlock(&mutex);
-    return r; 
+    return __atomic_load_n(&unread, __ATOMIC_RELAXED);
   }
 
   uint32_t size_bytes()
   {
-    pthread_mutex_lock(&mutex);
-    uint32_t r = unread_bytes;
-    pthread_mutex_unlock(&mutex);
-    return r; 
+    return __atomic_load_n(&unread_bytes, __ATOMIC_RELAXED);
   }
 
   uint32_t size_tail_bytes()
   {
-    pthread_mutex_lock(&mutex);
-    uint32_t r = buf[tail]->N_bytes;
-    pthread_mutex_unlock(&mutex);
-    return r; 
+    byte_buffer_t *msg = NULL;
+    pthread_mutex_lock(&read_mutex);
+    uint32_t r = q.front(&msg) ? msg->N_bytes : 0;
+    pthread_mutex_unlock(&read_mutex);
+    return r;
   }
 
 private:
-  bool     is_empty() const { return unread == 0; }
-  bool     is_full() const { return unread == capacity; }
-
-  pthread_cond_t        not_empty;
-  pthread_cond_t        not_full;
-  pthread_mutex_t       mutex;
-  byte_buffer_t **buf;
-  uint32_t              capacity;
+  void consumed(byte_buffer_t *msg)
+  {
+    __atomic_sub_fetch(&unread_bytes, msg->N_bytes, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&unread, 1, __ATOMIC_RELAXED);
+  }
+
+  mpsc_queue<byte_buffer_t*> q;
+  pthread_mutex_t       read_mutex;
   uint32_t              unread;
   uint32_t              unread_bytes;
-  uint32_t              head;
-  uint32_t              tail;
 };
 
 } // namespace srsue
@@ -0,0 +1,344 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         ring_queue.h
+ *  Description:  Bounded lock-free ring queues for hand-offs between threads.
+ *
+ *                spsc_queue: one producer and one consumer thread.
+ *                mpsc_queue: any number of producers and one consumer thread.
+ *                Each cell carries a sequence number that tells producers
+ *                when it is free and the consumer when it is written
+ *                (D. Vyukov's bounded queue).
+ *
+ *                Push and pop never take a lock. Blocking calls wait on a
+ *                futex only when the queue is empty (pop) or full (push),
+ *                and the other side only makes a system call when somebody
+ *                is waiting. The capacity is rounded up to a power of 2.
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+namespace srslte {
+
+/* Blocks threads until notified. Waiters read the sequence number, flag that they are
+ * waiting and sleep only if their condition is still false and the sequence number has
+ * not changed since. Only the first notification after a waiter flags itself makes the
+ * system call.
+ */
+class queue_waiter
+{
+public:
+  queue_waiter() : seq(0), waiting(0) {}
+
+  template<class predicate>
+  void wait_until(predicate &ready) {
+    while (!ready()) {
+      uint32_t s = __atomic_load_n(&seq, __ATOMIC_ACQUIRE);
+      __atomic_store_n(&waiting, 1, __ATOMIC_SEQ_CST);
+      if (!ready()) {
+        syscall(SYS_futex, &seq, FUTEX_WAIT_PRIVATE, s, NULL, NULL, 0);
+      }
+    }
+  }
+  // Called after making the condition true
+  void notify() {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&waiting, __ATOMIC_RELAXED) && __atomic_exchange_n(&waiting, 0, __ATOMIC_SEQ_CST)) {
+      __atomic_add_fetch(&seq, 1, __ATOMIC_RELEASE);
+      syscall(SYS_futex, &seq, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+    }
+  }
+private:
+  uint32_t seq;
+  uint32_t waiting;
+};
+
+template<typename myobj>
+class spsc_queue
+{
+public:
+  spsc_queue(uint32_t capacity_ = 1024) : head(0), tail(0) {
+    capacity = 1;
+    while (capacity < capacity_) {
+      capacity *= 2;
+    }
+    buf = new myobj[capacity];
+  }
+  ~spsc_queue() {
+    delete [] buf;
+  }
+
+  // Producer side. Returns the number of objects pushed, less than n if the queue is full.
+  uint32_t try_push(const myobj *values, uint32_t n) {
+    uint32_t t    = tail;
+    uint32_t free = capacity - (t - __atomic_load_n(&head, __ATOMIC_ACQUIRE));
+    n = n < free ? n : free;
+    for (uint32_t i=0;i<n;i++) {
+      buf[(t + i)&(capacity-1)] = values[i];
+    }
+    if (n) {
+      __atomic_store_n(&tail, t + n, __ATOMIC_RELEASE);
+      not_empty.notify();
+    }
+    return n;
+  }
+  bool try_push(const myobj &value) {
+    return try_push(&value, 1) == 1;
+  }
+  void push(const myobj &value) {
+    not_full_pred pred(this);
+    while (!try_push(value)) {
+      not_full.wait_until(pred);
+    }
+  }
+
+  // Consumer side. Returns the number of objects popped, 0 if the queue is empty.
+  uint32_t try_pop(myobj *values, uint32_t max_n) {
+    uint32_t h = head;
+    uint32_t n = __atomic_load_n(&tail, __ATOMIC_ACQUIRE) - h;
+    n = n < max_n ? n : max_n;
+    for (uint32_t i=0;i<n;i++) {
+      values[i] = buf[(h + i)&(capacity-1)];
+    }
+    if (n) {
+      __atomic_store_n(&head, h + n, __ATOMIC_RELEASE);
+      not_full.notify();
+    }
+    return n;
+  }
+  bool try_pop(myobj *value) {
+    return try_pop(value, 1) == 1;
+  }
+  // Blocks until at least one object is available
+  uint32_t wait_pop(myobj *values, uint32_t max_n) {
+    not_empty_pred pred(this);
+    uint32_t n;
+    while ((n = try_pop(values, max_n)) == 0) {
+      not_empty.wait_until(pred);
+    }
+    return n;
+  }
+  myobj wait_pop() {
+    myobj value;
+    wait_pop(&value, 1);
+    return value;
+  }
+  // Returns the oldest object without removing it
+  bool front(myobj *value) {
+    if (__atomic_load_n(&tail, __ATOMIC_ACQUIRE) == head) {
+      return false;
+    }
+    *value = buf[head&(capacity-1)];
+    return true;
+  }
+
+  uint32_t size() {
+    return __atomic_load_n(&tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  }
+  bool empty() {
+    return size() == 0;
+  }
+  uint32_t max_size() {
+    return capacity;
+  }
+
+private:
+  struct not_empty_pred {
+    not_empty_pred(spsc_queue *q_) : q(q_) {}
+    bool operator()() { return q->size() > 0; }
+    spsc_queue *q;
+  };
+  struct not_full_pred {
+    not_full_pred(spsc_queue *q_) : q(q_) {}
+    bool operator()() { return q->size() < q->capacity; }
+    spsc_queue *q;
+  };
+
+  myobj        *buf;
+  uint32_t      capacity;
+  uint8_t       pad0[64];
+  uint32_t      head;       // Written by the consumer only
+  uint8_t       pad1[64];
+  uint32_t      tail;       // Written by the producer only
+  uint8_t       pad2[64];
+  queue_waiter  not_empty;
+  queue_waiter  not_full;
+};
+
+template<typename myobj>
+class mpsc_queue
+{
+public:
+  mpsc_queue(uint32_t capacity_ = 1024) : head(0), tail(0) {
+    capacity = 1;
+    while (capacity < capacity_) {
+      capacity *= 2;
+    }
+    cells = new cell_t[capacity];
+    for (uint32_t i=0;i<capacity;i++) {
+      cells[i].seq = i;
+    }
+  }
+  ~mpsc_queue() {
+    delete [] cells;
+  }
+
+  // Producer side. Claims up to n consecutive cells with a single compare-and-swap.
+  // Returns the number of objects pushed, less than n if the queue is full.
+  uint32_t try_push(const myobj *values, uint32_t n) {
+    uint32_t t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+    uint32_t k;
+    while (true) {
+      uint32_t free = capacity - (t - __atomic_load_n(&head, __ATOMIC_ACQUIRE));
+      k = n < free ? n : free;
+      if (k == 0) {
+        return 0;
+      }
+      // Cells are freed in order, so the last claimed cell being free means all of them are
+      uint32_t last = t + k - 1;
+      int32_t  diff = (int32_t) (__atomic_load_n(&cells[last&(capacity-1)].seq, __ATOMIC_ACQUIRE) - last);
+      if (diff == 0) {
+        if (__atomic_compare_exchange_n(&tail, &t, t + k, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+          break;
+        }
+      } else {
+        // Another producer claimed the cells first
+        t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+      }
+    }
+    for (uint32_t i=0;i<k;i++) {
+      cell_t *c = &cells[(t + i)&(capacity-1)];
+      c->value = values[i];
+      __atomic_store_n(&c->seq, t + i + 1, __ATOMIC_RELEASE);
+    }
+    not_empty.notify();
+    return k;
+  }
+  bool try_push(const myobj &value) {
+    return try_push(&value, 1) == 1;
+  }
+  void push(const myobj &value) {
+    not_full_pred pred(this);
+    while (!try_push(value)) {
+      not_full.wait_until(pred);
+    }
+  }
+
+  // Consumer side. Returns the number of objects popped, 0 if the queue is empty.
+  uint32_t try_pop(myobj *values, uint32_t max_n) {
+    uint32_t n = 0;
+    while (n < max_n) {
+      cell_t *c = &cells[head&(capacity-1)];
+      if (__atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) != head + 1) {
+        break;
+      }
+      values[n++] = c->value;
+      __atomic_store_n(&c->seq, head + capacity, __ATOMIC_RELEASE);
+      __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+    }
+    if (n) {
+      not_full.notify();
+    }
+    return n;
+  }
+  bool try_pop(myobj *value) {
+    return try_pop(value, 1) == 1;
+  }
+  // Blocks until at least one object is available
+  uint32_t wait_pop(myobj *values, uint32_t max_n) {
+    not_empty_pred pred(this);
+    uint32_t n;
+    while ((n = try_pop(values, max_n)) == 0) {
+      not_empty.wait_until(pred);
+    }
+    return n;
+  }
+  myobj wait_pop() {
+    myobj value;
+    wait_pop(&value, 1);
+    return value;
+  }
+  // Returns the oldest object without removing it
+  bool front(myobj *value) {
+    cell_t *c = &cells[head&(capacity-1)];
+    if (__atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) != head + 1) {
+      return false;
+    }
+    *value = c->value;
+    return true;
+  }
+
+  // Number of claimed cells, including those being written
+  uint32_t size() {
+    return __atomic_load_n(&tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  }
+  bool empty() {
+    cell_t *c = &cells[__atomic_load_n(&head, __ATOMIC_ACQUIRE)&(capacity-1)];
+    return __atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) != __atomic_load_n(&head, __ATOMIC_ACQUIRE) + 1;
+  }
+  uint32_t max_size() {
+    return capacity;
+  }
+
+private:
+  typedef struct {
+    uint32_t seq;
+    myobj    value;
+  } cell_t;
+
+  struct not_empty_pred {
+    not_empty_pred(mpsc_queue *q_) : q(q_) {}
+    bool operator()() { return !q->empty(); }
+    mpsc_queue *q;
+  };
+  struct not_full_pred {
+    not_full_pred(mpsc_queue *q_) : q(q_) {}
+    bool operator()() { return q->size() < q->capacity; }
+    mpsc_queue *q;
+  };
+
+  cell_t       *cells;
+  uint32_t      capacity;
+  uint8_t       pad0[64];
+  uint32_t      head;       // Written by the consumer only
+  uint8_t       pad1[64];
+  uint32_t      tail;       // Next cell to be claimed by a producer
+  uint8_t       pad2[64];
+  queue_waiter  not_empty;
+  queue_waiter  not_full;
+};
+
+} // namespace srslte
+
+#endif // RING_QUEUE_H
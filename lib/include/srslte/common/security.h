@@ -94,6 +94,57 @@ uint8_t security_generate_k_up( uint8_t                       *k_enb,
                                 uint8_t                       *k_up_enc,
                                 uint8_t                       *k_up_int);
 
+/******************************************************************************
+ * AES-128 keys for EEA2/EIA2
+ * The key schedule and the CMAC subkeys are expanded once, when a bearer's keys
+ * are configured, and reused for every PDU. AES-NI is used if the CPU has it.
+ *****************************************************************************/
+
+typedef struct{
+  uint8_t rk[11][16];  // Round keys
+  uint8_t k1[16];      // CMAC subkeys
+  uint8_t k2[16];
+  bool    aesni;       // Set if the CPU supports AES-NI
+}security_aes_key_t;
+
+// One PDU of a batch: COUNT, message and, for integrity, where to write the MAC
+typedef struct{
+  uint32_t  count;
+  uint8_t  *msg;
+  uint32_t  msg_len;
+  uint8_t  *mac;
+}security_pdu_t;
+
+void security_aes_key_init(security_aes_key_t *k,
+                           uint8_t            *key);
+
+/******************************************************************************
+ * Ciphering
+ * EEA1 and EEA2 cipher and decipher in place. The batch version of EEA2
+ * pipelines the AES blocks of all the PDUs, so short PDUs are as cheap per byte
+ * as long ones. EEA1 and EIA1 keep no global state and can run on any thread.
+ *****************************************************************************/
+
+uint8_t security_128_eea1( uint8_t  *key,
+                           uint32_t  count,
+                           uint8_t   bearer,
+                           uint8_t   direction,
+                           uint8_t  *msg,
+                           uint32_t  msg_len);
+
+uint8_t security_128_eea2( security_aes_key_t *k,
+                           uint32_t            count,
+                           uint8_t             bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len);
+
+void security_128_eea2_batch( security_aes_key_t *k,
+                              uint8_t             bearer,
+                              uint8_t             direction,
+                              security_pdu_t     *pdus,
+                              uint32_t            nof_pdus);
+
 /******************************************************************************
  * Integrity Protection
  *****************************************************************************/
@@ -114,6 +165,21 @@ uint8_t security_128_eia2( uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *mac);
 
+uint8_t security_128_eia2( security_aes_key_t *k,
+                           uint32_t            count,
+                           uint8_t             bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len,
+                           uint8_t            *mac);
+
+// Computes the MACs of several PDUs, running their CMAC chains side by side
+void security_128_eia2_batch( security_aes_key_t *k,
+                              uint8_t             bearer,
+                              uint8_t             direction,
+                              security_pdu_t     *pdus,
+                              uint32_t            nof_pdus);
+
 /******************************************************************************
  * Authentication
  *****************************************************************************/
@@ -10,6 +10,9 @@
 * Document 2: SNOW 3G Specification"
 *---------------------------------------------------------*/
 
+#ifndef SNOW_3G_H
+#define SNOW_3G_H
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -69,3 +72,41 @@ void snow3g_f8( u8 *key, u32 count, u32 bearer, u32 dir, \
 u8* snow3g_f9( u8* key, u32 count, u32 fresh, u32 dir, \
                  u8 *data, u64 length);
 
+/* Reentrant SNOW 3G.
+* The functions above keep the LFSR and FSM in globals and f9 returns a
+* static buffer, so they cannot run on more than one thread. The functions
+* below keep that state in a snow3g_ctx_t owned by the caller, replace the
+* S-boxes, MULalpha and DIValpha by table lookups and, if the CPU supports
+* it, evaluate the f9 polynomial with carry-less multiplications. Their
+* output is identical to that of the functions above.
+*/
+
+typedef struct {
+  u32 s[16];        /* LFSR, s[(t+i)%16] holds s_i */
+  u32 t;
+  u32 r1, r2, r3;   /* FSM */
+} snow3g_ctx_t;
+
+/* Initialization, as snow3g_initialize(), followed by the clocking that
+* snow3g_generate_keystream() does before its first word.
+*/
+
+void snow3g_initialize_r(snow3g_ctx_t *ctx, u32 k[4], u32 IV[4]);
+
+/* Generation of Keystream, as snow3g_generate_keystream(). Each call
+* continues the keystream where the previous one stopped.
+*/
+
+void snow3g_generate_keystream_r(snow3g_ctx_t *ctx, u32 n, u32 *z);
+
+/* f8, as snow3g_f8(). Only the (length+7)/8 bytes of data are written. */
+
+void snow3g_f8_r( u8 *key, u32 count, u32 bearer, u32 dir, \
+                  u8 *data, u32 length );
+
+/* f9, as snow3g_f9(), with the 32 bit MAC written to mac. */
+
+void snow3g_f9_r( u8* key, u32 count, u32 fresh, u32 dir, \
+                  u8 *data, u64 length, u8 *mac );
+
+#endif // SNOW_3G_H
@@ -0,0 +1,133 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         task_pool.h
+ *  Description:  Pool of threads running short tasks pushed in batches. 
+ *                Every thread has its own queue. Tasks are spread over the 
+ *                queues and a thread whose queue is empty steals from the 
+ *                others. A thread waiting for a batch runs the queued tasks 
+ *                of that batch meanwhile, so that a batch completes even 
+ *                without threads. It never runs the tasks of other batches, 
+ *                which could delay it past the deadline of its own.
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <deque>
+#include <vector>
+
+#include "srslte/common/threads.h"
+
+namespace srslte {
+
+class task_pool
+{
+public:
+  
+  class task
+  {
+  public:
+    virtual ~task() {}
+    // arg is the argument of the thread running the task, see init() and wait() 
+    virtual void run_task(void *arg) = 0; 
+  };
+  
+  // Tasks whose completion is waited for together. It must be waited for before it goes out of scope 
+  class batch
+  {
+  public:
+    batch() : nof_pending(0), nof_queued(0) {}
+    ~batch() { assert(nof_pending == 0); }
+  private:
+    friend class task_pool; 
+    volatile int nof_pending; 
+    volatile int nof_queued; 
+  };
+  
+  task_pool();
+  ~task_pool();
+  
+  // Starts one thread for each element of thread_args, which is passed to the tasks it runs 
+  bool     init(std::vector<void*> &thread_args, int prio = -1);
+  void     stop();
+  uint32_t get_nof_threads();
+  
+  void     push(batch *b, task *t);
+  // Runs queued tasks of b with arg until all tasks of b have finished 
+  void     wait(batch *b, void *arg);
+  
+private:
+  
+  typedef struct {
+    task  *t; 
+    batch *b; 
+  } entry_t; 
+  
+  class task_queue
+  {
+  public:
+    task_queue()  { pthread_mutex_init(&mutex, NULL); }
+    ~task_queue() { pthread_mutex_destroy(&mutex); }
+    pthread_mutex_t     mutex; 
+    std::deque<entry_t> q; 
+  };
+  
+  class runner : public thread
+  {
+  public:
+    virtual ~runner() {}
+    task_pool *parent; 
+    uint32_t   id; 
+    void      *arg; 
+  private:
+    void run_thread(); 
+  };
+  
+  bool pop(uint32_t first, entry_t *e);
+  bool pop_batch(batch *b, entry_t *e);
+  void run(entry_t *e, void *arg);
+  void sleep(batch *b); 
+  
+  std::vector<task_queue*> queues; 
+  std::vector<runner*>     runners; 
+  
+  volatile uint32_t next_queue; 
+  volatile int      nof_queued; 
+  volatile int      nof_sleeping; 
+  bool              running; 
+  pthread_mutex_t   mutex; 
+  pthread_cond_t    cvar; 
+};
+
+} // namespace srslte
+
+#endif // TASK_POOL_H
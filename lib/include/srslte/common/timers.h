@@ -29,6 +29,12 @@
  *  File:         timers.h
  *  Description:  Manually incremented timers. Call a callback function upon
  *                expiry.
+ *
+ *                Running timers of a timers object are kept in a hashed
+ *                timing wheel indexed by their expiry step, so start, stop
+ *                and step_all() do not depend on the number of timers.
+ *                Timers that do not belong to a timers object are stepped
+ *                individually with step().
  *  Reference:
  *****************************************************************************/
 
@@ -37,9 +43,13 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <pthread.h>
 #include <vector>
+#include <algorithm>
 #include <time.h>
 
+#define TIMERS_WHEEL_SIZE 1024
+
 namespace srslte {
   
 class timer_callback 
@@ -54,25 +64,58 @@ public:
   class timer
   {
   public:
-    timer(uint32_t id_=0) {id = id_; counter = 0; timeout = 0; running = false; callback = NULL; }
+    timer(uint32_t id_=0) {
+      id = id_; counter = 0; timeout = 0; running = false; callback = NULL;
+      parent = NULL; start = 0; expiry = 0; firing = false; linked = false; prev = NULL; next = NULL;
+    }
     void set(timer_callback *callback_, uint32_t timeout_) {
+      lock();
       callback = callback_; 
       timeout = timeout_; 
-      reset();
+      reset_locked();
+      unlock();
     }
     bool is_running() {
-      return (counter < timeout) && running; 
+      lock();
+      bool ret = running && get_counter() < timeout;
+      unlock();
+      return ret;
     }
     bool is_expired() {
-      return callback && (counter >= timeout || !running); 
+      lock();
+      bool ret = callback && (get_counter() >= timeout || !running);
+      unlock();
+      return ret;
     }
     uint32_t get_timeout() {
       return timeout; 
     }
     void reset() {
-      counter = 0; 
+      lock();
+      reset_locked();
+      unlock();
     }
     void step() {
+      if (parent) {
+        // Timers of a timers object advance with step_all(). Move this one a step forward.
+        lock();
+        if (!running) {
+          unlock();
+          return;
+        }
+        uint32_t c = get_counter() + 1;
+        stop_locked();
+        counter = c;
+        running = counter < timeout;
+        if (running) {
+          start_locked();
+        }
+        unlock();
+        if (!running && callback) {
+          callback->timer_expired(id);
+        }
+        return;
+      }
       if (running) {
         counter++; 
         if (is_expired()) {
@@ -84,30 +127,129 @@ public:
       }
     }
     void stop() {
-      running = false; 
+      lock();
+      stop_locked();
+      unlock();
     }
     void run() {
-      running = true; 
+      lock();
+      if (!running && !firing) {
+        running = true;
+        start_locked();
+      }
+      unlock();
     }
     uint32_t id; 
   private: 
+    friend class timers;
+
+    void lock() {
+      if (parent) {
+        pthread_mutex_lock(&parent->mutex);
+      }
+    }
+    void unlock() {
+      if (parent) {
+        pthread_mutex_unlock(&parent->mutex);
+      }
+    }
+    uint32_t get_counter() {
+      return (parent && running) ? counter + (parent->now - start) : counter;
+    }
+    // Adds a running timer to the wheel. It expires on the step where the counter reaches the timeout.
+    void start_locked() {
+      if (parent) {
+        start  = parent->now;
+        expiry = start + (timeout > counter ? timeout - counter : 1);
+        parent->link(this);
+      }
+    }
+    void stop_locked() {
+      if (parent && running) {
+        counter = get_counter();
+        parent->unlink(this);
+      }
+      running = false;
+      firing  = false;
+    }
+    void reset_locked() {
+      if (firing) {
+        // Reset by a callback before its own callback was called, keeps running as if not expired
+        firing  = false;
+        running = true;
+        counter = 0;
+        start_locked();
+      } else if (parent && running) {
+        parent->unlink(this);
+        counter = 0;
+        start_locked();
+      } else {
+        counter = 0;
+      }
+    }
+
     timer_callback *callback; 
     uint32_t timeout; 
     uint32_t counter; 
     bool running; 
+
+    timers  *parent;
+    uint32_t start;     // Value of now when the timer was started
+    uint32_t expiry;    // Value of now when the timer expires
+    bool     firing;    // Expired in the current step, callback pending
+    bool     linked;    // In the wheel. Running timers without a callback never expire and leave it.
+    timer   *prev;
+    timer   *next;
   };
   
-  timers(uint32_t nof_timers_) : timer_list(nof_timers_) {
+  timers(uint32_t nof_timers_) : timer_list(nof_timers_), wheel(TIMERS_WHEEL_SIZE, (timer*) NULL) {
     nof_timers = nof_timers_; 
     next_timer = 0;
+    now = 0;
+    pthread_mutex_init(&mutex, NULL);
     for (uint32_t i=0;i<nof_timers;i++) {
       timer_list[i].id = i; 
+      timer_list[i].parent = this;
     }
   }
+  ~timers() {
+    pthread_mutex_destroy(&mutex);
+  }
   
+  // Advances all running timers one step and calls the callbacks of the expired ones, in id order.
+  // A timer stopped or reset by an earlier callback of the same step does not expire.
   void step_all() {
-    for (uint32_t i=0;i<nof_timers;i++) {
-      get(i)->step();
+    pthread_mutex_lock(&mutex);
+    now++;
+    expired.clear();
+    timer *t = wheel[now%TIMERS_WHEEL_SIZE];
+    while (t) {
+      timer *next = t->next;
+      if (t->expiry == now) {
+        unlink(t);
+        if (t->callback) {
+          t->counter = t->get_counter();
+          t->running = false;
+          t->firing  = true;
+          expired.push_back(t);
+        }
+      }
+      t = next;
+    }
+    pthread_mutex_unlock(&mutex);
+
+    if (expired.size() > 1) {
+      std::sort(expired.begin(), expired.end(), compare_id);
+    }
+    for (uint32_t i=0;i<expired.size();i++) {
+      t = expired[i];
+      pthread_mutex_lock(&mutex);
+      bool fire = t->firing;
+      t->firing = false;
+      pthread_mutex_unlock(&mutex);
+      if (fire && t->callback) {
+        t->callback->timer_expired(t->id);
+      }
     }
   }
   void stop_all() {
@@ -141,9 +283,43 @@ public:
     return next_timer++;
   }
 private:
+  static bool compare_id(const timer *a, const timer *b) {
+    return a->id < b->id;
+  }
+  void link(timer *t) {
+    timer **head = &wheel[t->expiry%TIMERS_WHEEL_SIZE];
+    t->linked = true;
+    t->prev = NULL;
+    t->next = *head;
+    if (*head) {
+      (*head)->prev = t;
+    }
+    *head = t;
+  }
+  void unlink(timer *t) {
+    if (!t->linked) {
+      return;
+    }
+    t->linked = false;
+    if (t->prev) {
+      t->prev->next = t->next;
+    } else {
+      wheel[t->expiry%TIMERS_WHEEL_SIZE] = t->next;
+    }
+    if (t->next) {
+      t->next->prev = t->prev;
+    }
+    t->prev = NULL;
+    t->next = NULL;
+  }
+
   uint32_t nof_timers; 
   uint32_t next_timer;
   std::vector<timer>   timer_list;   
+  std::vector<timer*>  wheel;
+  std::vector<timer*>  expired;
+  uint32_t             now;
+  pthread_mutex_t      mutex;
 };
 
 } // namespace srslte
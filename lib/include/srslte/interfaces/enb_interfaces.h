@@ -63,6 +63,7 @@ public:
   virtual int rach_detected(uint32_t tti, uint32_t preamble_idx, uint32_t time_adv) = 0; 
   
   virtual int cqi_info(uint32_t tti, uint16_t rnti, uint32_t cqi_value) = 0; 
+  virtual int cqi_subband_info(uint32_t tti, uint16_t rnti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi_value) = 0; 
   virtual int snr_info(uint32_t tti, uint16_t rnti, float snr_db) = 0; 
   virtual int ack_info(uint32_t tti, uint16_t rnti, bool ack) = 0;
   virtual int crc_info(uint32_t tti, uint16_t rnti, uint32_t nof_bytes, bool crc_res) = 0; 
@@ -181,6 +182,7 @@ public:
                                uint8_t *k_rrc_int_,
                                srslte::CIPHERING_ALGORITHM_ID_ENUM cipher_algo_,
                                srslte::INTEGRITY_ALGORITHM_ID_ENUM integ_algo_) = 0;
+  virtual void enable_encryption(uint16_t rnti, uint32_t lcid) = 0;
 };
 
 // PDCP interface for RLC
@@ -47,12 +47,15 @@ typedef struct {
 }rf_metrics_t;
 
 typedef struct {
-  rf_metrics_t    rf;
-  phy_metrics_t   phy[ENB_METRICS_MAX_USERS];
-  mac_metrics_t   mac[ENB_METRICS_MAX_USERS];
-  rrc_metrics_t   rrc; 
-  s1ap_metrics_t  s1ap;
-  bool            running;
+  rf_metrics_t         rf;
+  phy_metrics_t        phy[ENB_METRICS_MAX_USERS];
+  phy_stage_metrics_t  phy_ul_stage;
+  phy_stage_metrics_t  phy_dl_stage;
+  phy_ue_mem_metrics_t phy_ue_mem;
+  mac_metrics_t        mac[ENB_METRICS_MAX_USERS];
+  rrc_metrics_t        rrc;
+  s1ap_metrics_t       s1ap;
+  bool                 running;
 }enb_metrics_t;
 
 // ENB interface
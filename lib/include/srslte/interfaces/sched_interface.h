@@ -42,7 +42,7 @@ public:
   const static int MAX_RAR_LIST        = 8;
   const static int MAX_BC_LIST         = 8;
   const static int MAX_RLC_PDU_LIST    = 8;
-  const static int MAX_PHICH_LIST      = 8; 
+  const static int MAX_PHICH_LIST      = 32; 
   
   typedef struct {
     uint32_t len; 
@@ -50,12 +50,20 @@ public:
   } cell_cfg_sib_t;
   
   
+  typedef enum {
+    SCHED_POLICY_RR = 0,   // Round-robin 
+    SCHED_POLICY_PF,       // Proportional fair 
+    SCHED_POLICY_MAX_CI,   // Maximum throughput (max C/I) 
+  } sched_policy_t; 
+  
   typedef struct {
     int pdsch_mcs; 
     int pdsch_max_mcs; 
     int pusch_mcs; 
     int pusch_max_mcs; 
     int nof_ctrl_symbols; 
+    sched_policy_t policy; 
+    int pf_window_ms;      // Averaging window of the UE throughput in the PF metric 
   } sched_args_t; 
 
     
@@ -227,6 +235,7 @@ public:
   virtual int dl_ack_info(uint32_t tti, uint16_t rnti, bool ack) = 0; 
   virtual int dl_rach_info(uint32_t tti, uint32_t ra_id, uint16_t rnti, uint32_t estimated_size) = 0; 
   virtual int dl_cqi_info(uint32_t tti, uint16_t rnti, uint32_t cqi_value) = 0; 
+  virtual int dl_cqi_subband_info(uint32_t tti, uint16_t rnti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi_value) = 0; 
   
   /* UL information */
   virtual int ul_crc_info(uint32_t tti, uint16_t rnti, bool crc) = 0; 
@@ -160,6 +160,7 @@ class pdcp_interface_gw
 {
 public:
   virtual void write_sdu(uint32_t lcid, srslte::byte_buffer_t *sdu) = 0;
+  virtual void write_sdu_batch(uint32_t lcid, srslte::byte_buffer_t **sdus, uint32_t nof_sdus) = 0;
 };
 
 // PDCP interface for RRC
@@ -174,6 +175,7 @@ public:
                                uint8_t *k_rrc_int_,
                                srslte::CIPHERING_ALGORITHM_ID_ENUM cipher_algo_,
                                srslte::INTEGRITY_ALGORITHM_ID_ENUM integ_algo_) = 0;
+  virtual void enable_encryption(uint32_t lcid) = 0;
 };
 
 // PDCP interface for RLC
@@ -39,18 +39,25 @@
 #include "srslte/config.h"
 #include "srslte/phy/common/phy_common.h"
 
+/* c_bytes holds the sequence packed MSB first and is always present. Sequences generated
+ * with the _packed functions only have c_bytes, which is enough for the scrambling
+ * functions and takes 1/56th of the memory of the other representations together.
+ */
 typedef struct SRSLTE_API {
   uint8_t *c;
   uint8_t *c_bytes;
   float *c_float;
   short *c_short;
   uint32_t len;
+  uint32_t max_len;
 } srslte_sequence_t;
 
 SRSLTE_API int srslte_sequence_init(srslte_sequence_t *q, uint32_t len);
 
 SRSLTE_API void srslte_sequence_free(srslte_sequence_t *q);
 
+SRSLTE_API uint32_t srslte_sequence_nof_bytes(srslte_sequence_t *q);
+
 SRSLTE_API int srslte_sequence_LTE_pr(srslte_sequence_t *q, 
                                       uint32_t len, 
                                       uint32_t seed);
@@ -58,6 +65,14 @@ SRSLTE_API int srslte_sequence_LTE_pr(srslte_sequence_t *q,
 SRSLTE_API void srslte_sequence_set_LTE_pr(srslte_sequence_t *q, 
                                            uint32_t seed); 
 
+SRSLTE_API void srslte_sequence_gen_LTE_pr_packed(uint8_t *c_packed, 
+                                                  uint32_t len, 
+                                                  uint32_t seed);
+
+SRSLTE_API int srslte_sequence_LTE_pr_packed(srslte_sequence_t *q, 
+                                             uint32_t len, 
+                                             uint32_t seed);
+
 SRSLTE_API int srslte_sequence_pbch(srslte_sequence_t *seq, 
                                     srslte_cp_t cp, 
                                     uint32_t cell_id);
@@ -92,4 +107,22 @@ SRSLTE_API int srslte_sequence_pucch(srslte_sequence_t *seq,
                                      uint16_t rnti, 
                                      uint32_t nslot, 
                                      uint32_t cell_id); 
+
+SRSLTE_API int srslte_sequence_pdsch_packed(srslte_sequence_t *seq, 
+                                            uint16_t rnti, 
+                                            int q,
+                                            uint32_t nslot, 
+                                            uint32_t cell_id, 
+                                            uint32_t len);
+
+SRSLTE_API int srslte_sequence_pusch_packed(srslte_sequence_t *seq, 
+                                            uint16_t rnti, 
+                                            uint32_t nslot, 
+                                            uint32_t cell_id, 
+                                            uint32_t len);
+
+SRSLTE_API int srslte_sequence_pucch_packed(srslte_sequence_t *seq, 
+                                            uint16_t rnti, 
+                                            uint32_t nslot, 
+                                            uint32_t cell_id); 
 #endif
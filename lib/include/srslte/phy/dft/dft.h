@@ -86,6 +86,14 @@ SRSLTE_API int srslte_dft_plan_r(srslte_dft_plan_t *plan,
                                  int dft_points, 
                                  srslte_dft_dir_t dir);
 
+/* Plans nof_dfts complex transforms of dft_points samples each, stored one after
+ * the other. They run together with srslte_dft_run_c_zerocopy(), without options. */
+
+SRSLTE_API int srslte_dft_plan_c_batch(srslte_dft_plan_t *plan, 
+                                       int dft_points, 
+                                       int nof_dfts, 
+                                       srslte_dft_dir_t dir);
+
 SRSLTE_API void srslte_dft_plan_free(srslte_dft_plan_t *plan);
 
 /* Set options */
@@ -89,6 +89,8 @@ typedef struct SRSLTE_API {
     
   float tx_amp;
   
+  bool users_shared; 
+  
 } srslte_enb_dl_t;
 
 typedef struct {
@@ -106,6 +108,14 @@ typedef struct {
   uint32_t n_dmrs;  
 } srslte_enb_dl_phich_t; 
 
+/* Encoding state for one PDSCH grant. The grants of a subframe can be encoded concurrently, 
+ * each with its own encoder, into the resource grid of an srslte_enb_dl_t. 
+ */
+typedef struct SRSLTE_API {
+  srslte_pdsch_t     pdsch;
+  srslte_pdsch_cfg_t pdsch_cfg; 
+} srslte_enb_dl_pdsch_enc_t; 
+
 /* This function shall be called just after the initial synchronization */
 SRSLTE_API int srslte_enb_dl_init(srslte_enb_dl_t *q, 
                                   srslte_cell_t cell);
@@ -150,13 +160,33 @@ SRSLTE_API int srslte_enb_dl_add_rnti(srslte_enb_dl_t *q,
 SRSLTE_API void srslte_enb_dl_rem_rnti(srslte_enb_dl_t *q, 
                                       uint16_t rnti); 
 
+SRSLTE_API void srslte_enb_dl_share_users(srslte_enb_dl_t *q, 
+                                          srslte_enb_dl_t *src); 
+
+SRSLTE_API uint32_t srslte_enb_dl_user_nof_bytes(srslte_enb_dl_t *q, 
+                                                 uint16_t rnti); 
+
 SRSLTE_API int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q, 
                                        srslte_ra_dl_grant_t *grant, 
                                        srslte_softbuffer_tx_t *softbuffer,
                                        uint16_t rnti,
                                        uint32_t rv_idx, 
                                        uint32_t sf_idx, 
-                                       uint8_t *data); 
+                                       uint8_t *data);
+
+SRSLTE_API int srslte_enb_dl_pdsch_enc_init(srslte_enb_dl_pdsch_enc_t *e, 
+                                            srslte_cell_t cell); 
+
+SRSLTE_API void srslte_enb_dl_pdsch_enc_free(srslte_enb_dl_pdsch_enc_t *e); 
+
+SRSLTE_API int srslte_enb_dl_put_pdsch_enc(srslte_enb_dl_t *q, 
+                                           srslte_enb_dl_pdsch_enc_t *e, 
+                                           srslte_ra_dl_grant_t *grant, 
+                                           srslte_softbuffer_tx_t *softbuffer,
+                                           uint16_t rnti, 
+                                           uint32_t rv_idx, 
+                                           uint32_t sf_idx, 
+                                           uint8_t *data); 
 
 SRSLTE_API int srslte_enb_dl_put_pdcch_dl(srslte_enb_dl_t *q, 
                                           srslte_ra_dl_dci_t *grant, 
@@ -85,6 +85,7 @@ typedef struct SRSLTE_API {
   
   // Configuration for each user
   srslte_enb_ul_user_t **users; 
+  bool                   users_shared; 
   
 } srslte_enb_ul_t;
 
@@ -99,6 +100,16 @@ typedef struct {
   bool                    needs_pdcch; 
 } srslte_enb_ul_pusch_t; 
 
+/* Decoding state for one PUSCH grant. The grants of a subframe can be decoded concurrently, 
+ * each with its own decoder, while sharing the subframe and the user sequences of an srslte_enb_ul_t. 
+ */
+typedef struct SRSLTE_API {
+  srslte_pusch_t     pusch;
+  srslte_pusch_cfg_t pusch_cfg; 
+  srslte_chest_ul_t  chest;
+  cf_t              *ce; 
+} srslte_enb_ul_pusch_dec_t; 
+
 /* This function shall be called just after the initial synchronization */
 SRSLTE_API int srslte_enb_ul_init(srslte_enb_ul_t *q, 
                                   srslte_cell_t cell, 
@@ -120,6 +131,12 @@ SRSLTE_API int srslte_enb_ul_cfg_ue(srslte_enb_ul_t *q, uint16_t rnti,
                                     srslte_pucch_sched_t *pucch_sched,
                                     srslte_refsignal_srs_cfg_t *srs_cfg);
 
+SRSLTE_API void srslte_enb_ul_share_users(srslte_enb_ul_t *q, 
+                                          srslte_enb_ul_t *src); 
+
+SRSLTE_API uint32_t srslte_enb_ul_user_nof_bytes(srslte_enb_ul_t *q, 
+                                                 uint16_t rnti); 
+
 
 SRSLTE_API void srslte_enb_ul_fft(srslte_enb_ul_t *q, 
                                   cf_t *signal_buffer); 
@@ -140,6 +157,24 @@ SRSLTE_API int srslte_enb_ul_get_pusch(srslte_enb_ul_t *q,
                                        srslte_uci_data_t *uci_data,
                                        uint32_t tti); 
 
+SRSLTE_API int srslte_enb_ul_pusch_dec_init(srslte_enb_ul_pusch_dec_t *d, 
+                                            srslte_cell_t cell, 
+                                            srslte_refsignal_dmrs_pusch_cfg_t *pusch_cfg,
+                                            srslte_pucch_cfg_t *pucch_cfg); 
+
+SRSLTE_API void srslte_enb_ul_pusch_dec_free(srslte_enb_ul_pusch_dec_t *d); 
+
+SRSLTE_API int srslte_enb_ul_get_pusch_dec(srslte_enb_ul_t *q, 
+                                           srslte_enb_ul_pusch_dec_t *d, 
+                                           srslte_ra_ul_grant_t *grant, 
+                                           srslte_softbuffer_rx_t *softbuffer,
+                                           uint16_t rnti, 
+                                           uint32_t rv_idx, 
+                                           uint32_t current_tx_nb,
+                                           uint8_t *data, 
+                                           srslte_uci_data_t *uci_data,
+                                           uint32_t tti); 
+
 SRSLTE_API int srslte_enb_ul_detect_prach(srslte_enb_ul_t *q, 
                                           uint32_t tti, 
                                           uint32_t freq_offset, 
@@ -55,9 +55,24 @@
 #include "srslte/phy/fec/turbodecoder_sse.h"
 #endif
 
+#ifdef LV_HAVE_AVX2
+#include "srslte/phy/fec/turbodecoder_avx.h"
+#endif
+
+typedef enum SRSLTE_API {
+  SRSLTE_TDEC_AUTO = 0, 
+  SRSLTE_TDEC_GEN, 
+  SRSLTE_TDEC_SSE, 
+  SRSLTE_TDEC_AVX2
+} srslte_tdec_impl_t; 
+
 typedef struct SRSLTE_API {
+  srslte_tdec_impl_t impl; 
 #ifdef LV_HAVE_SSE
   srslte_tdec_sse_t tdec_sse;
+#ifdef LV_HAVE_AVX2
+  srslte_tdec_avx_t tdec_avx;
+#endif
 #else
   float *input_conv; 
   srslte_tdec_gen_t tdec_gen;
@@ -67,6 +82,14 @@ typedef struct SRSLTE_API {
 SRSLTE_API int srslte_tdec_init(srslte_tdec_t * h, 
                                 uint32_t max_long_cb);
 
+SRSLTE_API int srslte_tdec_init_impl(srslte_tdec_t * h, 
+                                     uint32_t max_long_cb, 
+                                     srslte_tdec_impl_t impl);
+
+SRSLTE_API srslte_tdec_impl_t srslte_tdec_get_impl(srslte_tdec_t * h);
+
+SRSLTE_API const char* srslte_tdec_impl_string(srslte_tdec_impl_t impl);
+
 SRSLTE_API void srslte_tdec_free(srslte_tdec_t * h);
 
 SRSLTE_API int srslte_tdec_reset(srslte_tdec_t * h, uint32_t long_cb);
@@ -75,6 +98,10 @@ SRSLTE_API void srslte_tdec_iteration(srslte_tdec_t * h,
                                       int16_t* input, 
                                       uint32_t long_cb);
 
+SRSLTE_API void srslte_tdec_half_iteration(srslte_tdec_t * h, 
+                                           int16_t* input, 
+                                           uint32_t long_cb);
+
 SRSLTE_API void srslte_tdec_decision(srslte_tdec_t * h, 
                                      uint8_t *output, 
                                      uint32_t long_cb);
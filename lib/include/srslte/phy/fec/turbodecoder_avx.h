@@ -0,0 +1,109 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/**********************************************************************************************
+ *  File:         turbodecoder_avx.h
+ *
+ *  Description:  Turbo Decoder.
+ *                AVX2 implementation of the MAX-LOG-MAP constituent decoder. Each 256-bit
+ *                register holds the 8 trellis states (16-bit) of two windows of the code
+ *                block, so that the forward and backward recursions of both halves run in
+ *                parallel. Window boundary metrics are initialized from the previous
+ *                iteration (next iteration initialization). Code blocks shorter than 1024 bits
+ *                are decoded in a single window.
+ *
+ *  Reference:    3GPP TS 36.212 version 10.0.0 Release 10 Sec. 5.1.3.2
+ *********************************************************************************************/
+
+#ifndef TURBODECODER_AVX_
+#define TURBODECODER_AVX_
+
+#include "srslte/config.h"
+#include "srslte/phy/fec/tc_interl.h"
+#include "srslte/phy/fec/cbsegm.h"
+
+/* Code blocks of at least this length are split in two windows */
+#define SRSLTE_TDEC_AVX_MIN_LONG_CB_WINDOWED 1024
+
+typedef struct SRSLTE_API {
+  int max_long_cb;
+  int16_t *alpha;
+  int16_t *branch;
+} map_avx_t;
+
+typedef struct SRSLTE_API {
+  int max_long_cb;
+
+  map_avx_t dec;
+
+  /* State metrics at the window boundary for each constituent decoder */
+  int16_t win_alpha[2][8];
+  int16_t win_beta[2][8];
+
+  int16_t *app1;
+  int16_t *app2;
+  int16_t *ext1;
+  int16_t *ext2;
+  int16_t *syst;
+  int16_t *parity0;
+  int16_t *parity1;
+  
+  int current_cbidx; 
+  srslte_tc_interl_t interleaver[SRSLTE_NOF_TC_CB_SIZES];
+  int n_iter;
+  bool half_it;
+} srslte_tdec_avx_t;
+
+SRSLTE_API int srslte_tdec_avx_init(srslte_tdec_avx_t * h, 
+                                    uint32_t max_long_cb);
+
+SRSLTE_API void srslte_tdec_avx_free(srslte_tdec_avx_t * h);
+
+SRSLTE_API int srslte_tdec_avx_reset(srslte_tdec_avx_t * h, uint32_t long_cb);
+
+SRSLTE_API void srslte_tdec_avx_half_iteration(srslte_tdec_avx_t * h, 
+                                               int16_t * input, 
+                                               uint32_t long_cb);
+
+SRSLTE_API void srslte_tdec_avx_iteration(srslte_tdec_avx_t * h, 
+                                          int16_t * input, 
+                                          uint32_t long_cb);
+
+SRSLTE_API void srslte_tdec_avx_decision(srslte_tdec_avx_t * h, 
+                                         uint8_t *output, 
+                                         uint32_t long_cb);
+
+SRSLTE_API void srslte_tdec_avx_decision_byte(srslte_tdec_avx_t * h, 
+                                              uint8_t *output, 
+                                              uint32_t long_cb); 
+
+SRSLTE_API int srslte_tdec_avx_run_all(srslte_tdec_avx_t * h, 
+                                       int16_t * input, 
+                                       uint8_t *output,
+                                       uint32_t nof_iterations, 
+                                       uint32_t long_cb);
+
+#endif
@@ -67,6 +67,7 @@ typedef struct SRSLTE_API {
 
   int current_cbidx; 
   srslte_tc_interl_t interleaver[SRSLTE_NOF_TC_CB_SIZES];
+  bool half_it; 
 } srslte_tdec_gen_t;
 
 SRSLTE_API int srslte_tdec_gen_init(srslte_tdec_gen_t * h, 
@@ -76,6 +77,10 @@ SRSLTE_API void srslte_tdec_gen_free(srslte_tdec_gen_t * h);
 
 SRSLTE_API int srslte_tdec_gen_reset(srslte_tdec_gen_t * h, uint32_t long_cb);
 
+SRSLTE_API void srslte_tdec_gen_half_iteration(srslte_tdec_gen_t * h, 
+                                               float * input, 
+                                               uint32_t long_cb);
+
 SRSLTE_API void srslte_tdec_gen_iteration(srslte_tdec_gen_t * h, 
                                       float * input, 
                                       uint32_t long_cb);
@@ -71,6 +71,7 @@ typedef struct SRSLTE_API {
   int current_cbidx; 
   srslte_tc_interl_t interleaver[SRSLTE_NOF_TC_CB_SIZES];
   int n_iter;
+  bool half_it;
 } srslte_tdec_sse_t;
 
 SRSLTE_API int srslte_tdec_sse_init(srslte_tdec_sse_t * h, 
@@ -80,6 +81,10 @@ SRSLTE_API void srslte_tdec_sse_free(srslte_tdec_sse_t * h);
 
 SRSLTE_API int srslte_tdec_sse_reset(srslte_tdec_sse_t * h, uint32_t long_cb);
 
+SRSLTE_API void srslte_tdec_sse_half_iteration(srslte_tdec_sse_t * h, 
+                                               int16_t * input, 
+                                               uint32_t long_cb);
+
 SRSLTE_API void srslte_tdec_sse_iteration(srslte_tdec_sse_t * h, 
                                       int16_t * input, 
                                       uint32_t long_cb);
@@ -92,6 +97,13 @@ SRSLTE_API void srslte_tdec_sse_decision_byte(srslte_tdec_sse_t * h,
                                           uint8_t *output, 
                                           uint32_t long_cb); 
 
+SRSLTE_API void srslte_tdec_sse_deinterleave_input(int16_t *input, 
+                                                   int16_t *syst, 
+                                                   int16_t *parity0, 
+                                                   int16_t *parity1, 
+                                                   int16_t *app2, 
+                                                   uint32_t long_cb);
+
 SRSLTE_API int srslte_tdec_sse_run_all(srslte_tdec_sse_t * h, 
                                    int16_t * input, 
                                    uint8_t *output,
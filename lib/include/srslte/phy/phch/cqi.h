@@ -147,4 +147,7 @@ SRSLTE_API int srslte_cqi_hl_get_subband_size(int num_prbs);
 
 SRSLTE_API int srslte_cqi_hl_get_no_subbands(int num_prbs);
 
+SRSLTE_API uint32_t srslte_cqi_hl_get_subband_cqi(srslte_cqi_hl_subband_t *msg, 
+                                                  uint32_t subband_idx);
+
 #endif // CQI_
@@ -72,6 +72,7 @@ typedef struct SRSLTE_API {
   
   // This is to generate the scrambling seq for multiple CRNTIs
   srslte_pdsch_user_t **users;
+  srslte_sequence_t tmp_seq;
   
   srslte_sch_t dl_sch;
   
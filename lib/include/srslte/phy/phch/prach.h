@@ -44,6 +44,8 @@
 #include "srslte/phy/common/phy_common.h"
 
 
+#define SRSLTE_PRACH_DECIM_FFT_SIZE 1536  // 1.92 MHz, bins of 1.25 kHz
+
 /** Generation and detection of RACH signals for uplink.
  *  Currently only supports preamble formats 0-3.
  *  Does not currently support high speed flag.
@@ -78,16 +80,37 @@ typedef struct SRSLTE_API {
   cf_t *ifft_in;
   cf_t *ifft_out;
   cf_t *prach_bins;
-  cf_t *corr_spec;
-  float *corr;
+  cf_t *corr_spec;            // Chirped correlation spectra with each root, N_roots*corr_size
+  cf_t *corr_out;
+  float *corr;                // N_roots*N_zc
 
   // PRACH IFFT
   srslte_dft_plan_t *fft;
   srslte_dft_plan_t *ifft;
 
-  // ZC-sequence FFT and IFFT
+  // ZC-sequence FFT
   srslte_dft_plan_t *zc_fft;
+
+  // The N_zc-point IFFTs of the correlations with all the roots run at once, as
+  // convolutions with a chirp over corr_size points (Bluestein), since N_zc is prime
+  uint32_t corr_size;
+  cf_t    *corr_chirp;
+  cf_t    *corr_kernel;       // Spectrum of the chirp, divided by corr_size
+  srslte_dft_plan_t *corr_fft;
   srslte_dft_plan_t *zc_ifft;
+
+  // Decimating detector front end. The PRACH band is shifted to DC, low-pass filtered
+  // and decimated to SRSLTE_PRACH_DECIM_FFT_SIZE samples, whose FFT holds the N_zc bins.
+  bool     decimate;
+  uint32_t decim_factor;      // 0 if N_ifft_prach is not a larger multiple of the FFT size
+  uint32_t decim_ntaps;
+  float   *decim_taps;
+  float   *decim_eq;          // Inverse of the filter response on the N_zc bins
+  cf_t    *decim_nco;
+  int      decim_nco_offset;  // freq_offset decim_nco was generated for, -1 if none
+  cf_t    *decim_in;          // Shifted signal, circularly extended by half the filter
+  cf_t    *decim_out;
+  srslte_dft_plan_t *decim_fft;
   
   cf_t *signal_fft; 
   float detect_factor; 
@@ -163,6 +186,9 @@ SRSLTE_API int srslte_prach_detect_offset(srslte_prach_t *p,
 SRSLTE_API void srslte_prach_set_detect_factor(srslte_prach_t *p, 
                                                float factor); 
 
+SRSLTE_API void srslte_prach_set_decimation(srslte_prach_t *p, 
+                                            bool enable); 
+
 SRSLTE_API int srslte_prach_free(srslte_prach_t *p);
 
 SRSLTE_API int srslte_prach_print_seqs(srslte_prach_t *p);
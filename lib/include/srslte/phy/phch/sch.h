@@ -35,6 +35,8 @@
 #ifndef SCH_
 #define SCH_
 
+#include <pthread.h>
+
 #include "srslte/config.h"
 #include "srslte/phy/common/phy_common.h"
 #include "srslte/phy/fec/rm_turbo.h"
@@ -53,12 +55,49 @@
 #define SRSLTE_TX_NULL 100
 #endif
 
+#define SRSLTE_SCH_MAX_CB_THREADS 8
+
+/* Decoder objects of a thread decoding the code blocks of a transport block in parallel */
+typedef struct SRSLTE_API {
+  srslte_tdec_t decoder; 
+  srslte_crc_t crc_tb;
+  srslte_crc_t crc_cb;
+  uint8_t *cb_in; 
+  uint32_t half_its_sum; 
+  uint32_t half_its_saved; 
+  uint32_t half_its_max; 
+  uint32_t nof_cb;
+  uint32_t job_id; 
+  pthread_t thread; 
+  void *sch; 
+} srslte_sch_cb_worker_t;
+
+/* Transport block being decoded by the code block workers */
+typedef struct SRSLTE_API {
+  srslte_softbuffer_rx_t *softbuffer; 
+  srslte_cbsegm_t *cb_segm; 
+  uint32_t Qm; 
+  uint32_t rv; 
+  uint32_t nof_e_bits; 
+  int16_t *e_bits; 
+  uint8_t *data; 
+  uint8_t *parity; 
+  uint32_t next_cb; 
+  uint32_t *cb_half_its; // Half iterations of each code block, for the average 
+  bool has_budget; 
+  int32_t budget; // Half iterations left for the remaining code blocks 
+  volatile bool failed; 
+} srslte_sch_cb_job_t;
+
 /* DL-SCH AND UL-SCH common functions */
 typedef struct SRSLTE_API {
   
   uint32_t max_iterations; 
   uint32_t nof_iterations; 
   float average_nof_iterations; 
+  uint32_t iteration_budget; 
+  uint32_t nof_half_its_spent; 
+  uint32_t nof_half_its_saved; 
   
   /* buffers */
   uint8_t *cb_in; 
@@ -76,6 +115,17 @@ typedef struct SRSLTE_API {
   
   srslte_uci_cqi_pusch_t uci_cqi;
   
+  /* Parallel code block decoding */
+  uint32_t nof_cb_workers; 
+  srslte_sch_cb_worker_t cb_workers[SRSLTE_SCH_MAX_CB_THREADS];
+  srslte_sch_cb_job_t cb_job; 
+  uint32_t cb_job_id; 
+  uint32_t cb_nof_active; 
+  bool cb_running; 
+  pthread_mutex_t cb_mutex; 
+  pthread_cond_t cb_cvar_start; 
+  pthread_cond_t cb_cvar_done; 
+  
 } srslte_sch_t;
 
 SRSLTE_API int srslte_sch_init(srslte_sch_t *q);
@@ -86,10 +136,20 @@ SRSLTE_API void srslte_sch_free(srslte_sch_t *q);
 SRSLTE_API void srslte_sch_set_max_noi(srslte_sch_t *q, 
                                        uint32_t max_iterations); 
 
+SRSLTE_API void srslte_sch_set_iteration_budget(srslte_sch_t *q, 
+                                               uint32_t nof_iterations); 
+
+SRSLTE_API int srslte_sch_set_nof_cb_threads(srslte_sch_t *q, 
+                                             uint32_t nof_threads); 
+
 SRSLTE_API float srslte_sch_average_noi(srslte_sch_t *q);
 
 SRSLTE_API uint32_t srslte_sch_last_noi(srslte_sch_t *q);
 
+SRSLTE_API float srslte_sch_last_noi_spent(srslte_sch_t *q);
+
+SRSLTE_API float srslte_sch_last_noi_saved(srslte_sch_t *q);
+
 SRSLTE_API int srslte_dlsch_encode(srslte_sch_t *q, 
                                    srslte_pdsch_cfg_t *cfg,
                                    srslte_softbuffer_tx_t *softbuffer,
@@ -42,6 +42,7 @@ extern "C" {
 #include <stdio.h>
 #include <stdint.h>
 #include "srslte/config.h"
+#include "srslte/phy/utils/vector_simd.h"
 
 
 #define SRSLTE_MAX(a,b) ((a)>(b)?(a):(b))
@@ -53,6 +54,16 @@ extern "C" {
 // Exponential moving average
 #define SRSLTE_VEC_EMA(data, average, alpha) ((alpha)*(data)+(1-alpha)*(average))
 
+/* Selects the SIMD kernels used by the vector primitives, the demodulator and the
+ * decoders. Fails if the level is not supported by the running CPU. */
+SRSLTE_API int srslte_simd_set_level(srslte_simd_level_t level);
+SRSLTE_API srslte_simd_level_t srslte_simd_get_level();
+
+/* Primitives with SIMD kernels and the level of the kernel in use */
+SRSLTE_API uint32_t srslte_vec_nof_kernels();
+SRSLTE_API const char* srslte_vec_kernel_name(uint32_t idx);
+SRSLTE_API srslte_simd_level_t srslte_vec_kernel_level(uint32_t idx);
+
 /** Return the sum of all the elements */
 SRSLTE_API int srslte_vec_acc_ii(int *x, uint32_t len);
 SRSLTE_API float srslte_vec_acc_ff(float *x, uint32_t len);
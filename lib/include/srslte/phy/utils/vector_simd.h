@@ -35,22 +35,62 @@ extern "C" {
 #include <stdint.h>
 #include "srslte/config.h"
 
+/* Instruction set levels of the SIMD kernels. Each level implies the previous ones. */
+typedef enum SRSLTE_API {
+  SRSLTE_SIMD_GENERIC = 0,
+  SRSLTE_SIMD_SSE41,
+  SRSLTE_SIMD_AVX2,
+  SRSLTE_SIMD_AVX512,
+  SRSLTE_SIMD_NOF_LEVELS
+} srslte_simd_level_t;
+
+/* Kernels are built for every level supported by the compiler, regardless of the
+ * instruction set of the rest of the build, and selected at run time. */
+#ifdef LV_HAVE_SSE
+#define SRSLTE_TARGET_SSE41  __attribute__((target("sse4.1")))
+#else
+#define SRSLTE_TARGET_SSE41
+#endif
+#ifdef LV_HAVE_AVX2
+#define SRSLTE_TARGET_AVX2   __attribute__((target("avx2")))
+#else
+#define SRSLTE_TARGET_AVX2
+#endif
+#ifdef LV_HAVE_AVX512
+#define SRSLTE_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+#define SRSLTE_TARGET_AVX512
+#endif
+
+/* Highest level supported by both the build and the running CPU */
+SRSLTE_API srslte_simd_level_t srslte_simd_cpu_level();
+
+SRSLTE_API const char* srslte_simd_level_string(srslte_simd_level_t level);
+
+SRSLTE_API int srslte_simd_level_parse(const char *str, srslte_simd_level_t *level);
+
 SRSLTE_API int srslte_vec_dot_prod_sss_sse(short *x, short *y, uint32_t len); 
 
 SRSLTE_API int srslte_vec_dot_prod_sss_avx(short *x, short *y, uint32_t len); 
 
+SRSLTE_API int srslte_vec_dot_prod_sss_avx512(short *x, short *y, uint32_t len);
+
 
   
 SRSLTE_API void srslte_vec_sum_sss_sse(short *x, short *y, short *z, uint32_t len);
 
 SRSLTE_API void srslte_vec_sum_sss_avx(short *x, short *y, short *z, uint32_t len);
 
+SRSLTE_API void srslte_vec_sum_sss_avx512(short *x, short *y, short *z, uint32_t len);
+
 
 
 SRSLTE_API void srslte_vec_sub_sss_sse(short *x, short *y, short *z, uint32_t len); 
 
 SRSLTE_API void srslte_vec_sub_sss_avx(short *x, short *y, short *z, uint32_t len);
 
+SRSLTE_API void srslte_vec_sub_sss_avx512(short *x, short *y, short *z, uint32_t len);
+
 
 
 
@@ -59,11 +99,15 @@ SRSLTE_API void srslte_vec_prod_sss_sse(short *x, short *y, short *z, uint32_t l
 
 SRSLTE_API void srslte_vec_prod_sss_avx(short *x, short *y, short *z, uint32_t len);
 
+SRSLTE_API void srslte_vec_prod_sss_avx512(short *x, short *y, short *z, uint32_t len);
+
 
 SRSLTE_API void srslte_vec_sc_div2_sss_sse(short *x, int n_rightshift, short *z, uint32_t len); 
 
 SRSLTE_API  void srslte_vec_sc_div2_sss_avx(short *x, int k, short *z, uint32_t len);
 
+SRSLTE_API void srslte_vec_sc_div2_sss_avx512(short *x, int k, short *z, uint32_t len);
+
 
 
 
@@ -72,9 +116,17 @@ SRSLTE_API void srslte_vec_lut_sss_sse(short *x, unsigned short *lut, short *y,
 
 SRSLTE_API void srslte_vec_convert_fi_sse(float *x, int16_t *z, float scale, uint32_t len); 
 
+SRSLTE_API void srslte_vec_convert_fi_avx(float *x, int16_t *z, float scale, uint32_t len);
 
+SRSLTE_API void srslte_vec_convert_fi_avx512(float *x, int16_t *z, float scale, uint32_t len);
+
+
+
+SRSLTE_API void srslte_vec_mult_scalar_cf_f_sse(cf_t *z, const cf_t *x, const float h, const uint32_t len);
 
 SRSLTE_API void srslte_vec_mult_scalar_cf_f_avx( cf_t *z,const cf_t *x,const float h,const uint32_t len);
+
+SRSLTE_API void srslte_vec_mult_scalar_cf_f_avx512(cf_t *z, const cf_t *x, const float h, const uint32_t len);
 #ifdef __cplusplus
 }
 #endif
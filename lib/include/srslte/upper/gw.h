@@ -42,11 +42,11 @@ namespace srslte {
 class gw
     :public srsue::gw_interface_pdcp
     ,public srsue::gw_interface_nas
-    ,public thread
 {
 public:
   gw();
-  void init(srsue::pdcp_interface_gw *pdcp_, srsue::rrc_interface_gw *rrc_, srsue::ue_interface *ue_, log *gw_log_);
+  void init(srsue::pdcp_interface_gw *pdcp_, srsue::rrc_interface_gw *rrc_, srsue::ue_interface *ue_, log *gw_log_, 
+            uint32_t nof_tun_queues_ = 1);
   void stop();
 
   void get_metrics(gw_metrics_t &m);
@@ -56,10 +56,21 @@ public:
 
   // NAS interface
   error_t setup_if_addr(uint32_t ip_addr, char *err_str);
+
+  // Reads IP packets from already open file descriptors, one per TUN queue, instead of
+  // creating the TUN device. On success, the descriptors are closed by stop()
+  error_t setup_if_fds(const int32 *fds, uint32_t nof_fds, uint32_t mtu_);
+  
+  static const uint32_t GW_MAX_TUN_QUEUES  = 8;
   
 private:
   
   static const int GW_THREAD_PRIO = 7; 
+  // Maximum number of IP packets read from a TUN queue before handing them to PDCP
+  static const uint32_t GW_READ_BATCH      = 32;
+  static const int      GW_POLL_TIMEOUT_MS = 100;
+  // MTU assumed when the one of the TUN interface cannot be read
+  static const uint32_t GW_DEFAULT_MTU     = 1500;
   
   srsue::pdcp_interface_gw  *pdcp;
   srsue::rrc_interface_gw   *rrc;
@@ -67,19 +78,36 @@ private:
 
   byte_buffer_pool   *pool;
   log                *gw_log;
-  bool                running;
   bool                run_enable;
-  int32               tun_fd;
+  uint32_t            nof_tun_queues;
+  int32               tun_fds[GW_MAX_TUN_QUEUES];
   struct ifreq        ifr;
   int32               sock;
   bool                if_up;
+  uint32_t            mtu;      // Every IP packet read from the TUN device fits a buffer of this size
 
   long                ul_tput_bytes;
   long                dl_tput_bytes;
   struct timeval      metrics_time[3];
 
-  void                run_thread();
   error_t     init_if(char *err_str);
+  void        close_tun_fds(uint32_t nof_fds);
+  void        start_readers();
+  
+  /* Thread reading IP packets from one queue of the TUN device */
+  class tun_reader : public thread {
+  public: 
+    tun_reader() : running(false), started(false) {}
+    void start_reader(gw *parent_, uint32_t queue_idx_);
+    void stop();
+  private:
+    void run_thread();
+    gw      *parent; 
+    uint32_t queue_idx; 
+    bool     running; 
+    bool     started; 
+  };
+  tun_reader          readers[GW_MAX_TUN_QUEUES];
 };
 
 } // namespace srsue
@@ -52,12 +52,14 @@ public:
   // RRC interface
   void reset();
   void write_sdu(uint32_t lcid, byte_buffer_t *sdu);
+  void write_sdu_batch(uint32_t lcid, byte_buffer_t **sdus, uint32_t nof_sdus);
   void add_bearer(uint32_t lcid, LIBLTE_RRC_PDCP_CONFIG_STRUCT *cnfg = NULL);
   void config_security(uint32_t lcid,
                        uint8_t *k_rrc_enc,
                        uint8_t *k_rrc_int,
                        CIPHERING_ALGORITHM_ID_ENUM cipher_algo,
                        INTEGRITY_ALGORITHM_ID_ENUM integ_algo);
+  void enable_encryption(uint32_t lcid);
 
   // RLC interface
   void write_pdu(uint32_t lcid, byte_buffer_t *sdu);
@@ -43,6 +43,8 @@ namespace srslte {
 
 #define PDCP_CONTROL_MAC_I 0x00000000
 
+#define PDCP_MAX_BATCH 32 // PDUs ciphered per call by write_sdu_batch()
+
 #define PDCP_PDU_TYPE_PDCP_STATUS_REPORT                0x0
 #define PDCP_PDU_TYPE_INTERSPERSED_ROHC_FEEDBACK_PACKET 0x1
 
@@ -76,10 +78,12 @@ public:
 
   // RRC interface
   void write_sdu(byte_buffer_t *sdu);
+  void write_sdu_batch(byte_buffer_t **sdus, uint32_t nof_sdus);
   void config_security(uint8_t *k_rrc_enc_,
                        uint8_t *k_rrc_int_,
                        CIPHERING_ALGORITHM_ID_ENUM cipher_algo_,
                        INTEGRITY_ALGORITHM_ID_ENUM integ_algo_);
+  void enable_encryption();
 
   // RLC interface
   void write_pdu(byte_buffer_t *pdu);
@@ -95,6 +99,7 @@ private:
   bool                active;
   uint32_t            lcid;
   bool                do_security;
+  bool                do_encryption;
   u_int8_t            direction;
 
   uint8_t             sn_len;
@@ -106,9 +111,22 @@ private:
   uint8_t             k_rrc_enc[32];
   uint8_t             k_rrc_int[32];
 
+  // EEA2/EIA2 key schedules, expanded once in config_security()
+  security_aes_key_t  k_enc_aes;
+  security_aes_key_t  k_int_aes;
+
   CIPHERING_ALGORITHM_ID_ENUM cipher_algo;
   INTEGRITY_ALGORITHM_ID_ENUM integ_algo;
 
+  // Serializes SDUs written from several threads, so that SNs are sent to RLC in order
+  pthread_mutex_t     tx_mutex;
+
+  void write_sdu_nolock(byte_buffer_t *sdu);
+  void pack_data_pdu(byte_buffer_t *sdu, security_pdu_t *pdu);
+  void cipher(security_pdu_t *pdus, uint32_t nof_pdus, uint8_t dir);
+  uint8_t  rx_direction();
+  uint32_t get_rx_count(uint32_t sn, uint32_t sn_bits);
+
   void integrity_generate(uint8_t  *key_128,
                           uint32_t  count,
                           uint8_t   rb_id,
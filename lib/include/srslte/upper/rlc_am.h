@@ -34,6 +34,7 @@
 #include "srslte/common/msg_queue.h"
 #include "srslte/common/timeout.h"
 #include "srslte/upper/rlc_common.h"
+#include <string.h>
 #include <map>
 #include <deque>
 #include <list>
@@ -42,6 +43,7 @@ namespace srslte {
 
 
 
+// In the rx window buf is the first of a list of buffers, one per SDU fragment
 struct rlc_amd_rx_pdu_t{
   rlc_amd_pdu_header_t  header;
   byte_buffer_t         *buf;
@@ -53,7 +55,9 @@ struct rlc_amd_rx_pdu_segments_t{
 
 struct rlc_amd_tx_pdu_t{
   rlc_amd_pdu_header_t  header;
-  byte_buffer_t        *buf;
+  byte_buffer_t        *sdu;         // First SDU of the PDU data (see rlc_sdu_chain_copy())
+  uint32_t              sdu_offset;
+  uint32_t              N_bytes;
   uint32_t              retx_count;
   bool                  is_acked;
 };
@@ -65,6 +69,112 @@ struct rlc_amd_retx_t{
   uint32_t  so_end;
 };
 
+/* Bitmap over the AM SN space. Runs of set or cleared SNs are found a 64-bit
+ * word at a time. Ranges [start, end) wrap around RLC_AM_SN_SPACE and are empty
+ * when start == end.
+ */
+class rlc_am_bitmap
+{
+public:
+  rlc_am_bitmap() { clear(); }
+
+  bool has(uint32_t sn) { return (words[sn/64] >> (sn%64)) & 1; }
+  void set(uint32_t sn) { words[sn/64] |= 1ULL << (sn%64); }
+  void reset(uint32_t sn) { words[sn/64] &= ~(1ULL << (sn%64)); }
+  void clear() { memset(words, 0, sizeof(words)); }
+
+  // Clears all SNs in [start, end) and returns how many of them were set
+  uint32_t reset(uint32_t start, uint32_t end)
+  {
+    uint32_t len = (end + RLC_AM_SN_SPACE - start)%RLC_AM_SN_SPACE;
+    uint32_t n   = 0;
+    while(len > 0) {
+      uint32_t off  = start%64;
+      uint32_t bits = (64-off < len) ? 64-off : len;
+      uint64_t mask = (bits == 64 ? ~0ULL : ((1ULL << bits) - 1)) << off;
+      n += __builtin_popcountll(words[start/64] & mask);
+      words[start/64] &= ~mask;
+      len  -= bits;
+      start = (start + bits)%RLC_AM_SN_SPACE;
+    }
+    return n;
+  }
+
+  // First SN in [start, end) that is set (not set), or end if there is none
+  uint32_t next_set(uint32_t start, uint32_t end)   { return scan(start, end, 0); }
+  uint32_t next_unset(uint32_t start, uint32_t end) { return scan(start, end, ~0ULL); }
+
+private:
+  uint64_t words[RLC_AM_SN_SPACE/64];
+
+  uint32_t scan(uint32_t sn, uint32_t end, uint64_t flip)
+  {
+    uint32_t len = (end + RLC_AM_SN_SPACE - sn)%RLC_AM_SN_SPACE;
+    uint32_t n   = 0;
+    while(n < len) {
+      uint64_t w = (words[sn/64] ^ flip) >> (sn%64);
+      if(w) {
+        uint32_t k = __builtin_ctzll(w);
+        return (n + k < len) ? sn + k : end;
+      }
+      uint32_t bits = 64 - sn%64;
+      n += bits;
+      sn = (sn + bits)%RLC_AM_SN_SPACE;
+    }
+    return end;
+  }
+};
+
+/* Tx/Rx window holding one slot per SN, indexed directly by the SN. Inserting and
+ * removing PDUs only flips bits, so a busy bearer does not allocate per PDU as
+ * std::map did. The slots are allocated on first use since every RLC entity
+ * carries an AM instance, used or not.
+ */
+template<class T>
+class rlc_am_window
+{
+public:
+  rlc_am_window() : slots(NULL), count(0) {}
+  ~rlc_am_window() { delete [] slots; }
+
+  bool     has(uint32_t sn) { return active.has(sn); }
+  uint32_t size()           { return count; }
+
+  // Returns the slot of sn, adding sn to the window if it was not there
+  T& operator[](uint32_t sn)
+  {
+    if(!slots)
+      slots = new T[RLC_AM_SN_SPACE];
+    if(!active.has(sn)) {
+      active.set(sn);
+      count++;
+    }
+    return slots[sn];
+  }
+
+  // Removing an SN leaves its slot as is, to be overwritten by the next insertion
+  void erase(uint32_t sn)
+  {
+    if(active.has(sn)) {
+      active.reset(sn);
+      count--;
+    }
+  }
+  void erase(uint32_t start, uint32_t end) { count -= active.reset(start, end); }
+  void clear() { active.clear(); count = 0; }
+
+  uint32_t next_present(uint32_t start, uint32_t end) { return active.next_set(start, end); }
+  uint32_t next_missing(uint32_t start, uint32_t end) { return active.next_unset(start, end); }
+
+private:
+  rlc_am_window(const rlc_am_window&);
+  rlc_am_window& operator=(const rlc_am_window&);
+
+  T            *slots;
+  rlc_am_bitmap active;
+  uint32_t      count;
+};
+
 
 class rlc_am
     :public rlc_common
@@ -92,6 +202,9 @@ public:
   int      read_pdu(uint8_t *payload, uint32_t nof_bytes);
   void     write_pdu(uint8_t *payload, uint32_t nof_bytes);
 
+  // SDU bytes copied by the entity, in either direction
+  uint64_t get_copied_bytes();
+
 private:
 
   byte_buffer_pool          *pool;
@@ -103,19 +216,22 @@ private:
   // TX SDU buffers
   msg_queue      tx_sdu_queue;
   byte_buffer_t *tx_sdu;
+  uint32_t       tx_sdu_offset;  // Bytes of tx_sdu already in PDUs
 
   // PDU being resegmented
   rlc_amd_tx_pdu_t tx_pdu_segments;
 
   // Tx and Rx windows
-  std::map<uint32_t, rlc_amd_tx_pdu_t>          tx_window;
-  std::deque<rlc_amd_retx_t>                    retx_queue;
-  std::map<uint32_t, rlc_amd_rx_pdu_t>          rx_window;
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t> rx_segments;
+  rlc_am_window<rlc_amd_tx_pdu_t>           tx_window;
+  std::deque<rlc_amd_retx_t>                retx_queue;
+  rlc_am_window<rlc_amd_rx_pdu_t>           rx_window;
+  rlc_am_window<rlc_amd_rx_pdu_segments_t>  rx_segments;
 
   // RX SDU buffers
   byte_buffer_t *rx_sdu;
 
+  uint64_t       copied_bytes;
+
   // Mutexes
   pthread_mutex_t     mutex;
 
@@ -189,6 +305,8 @@ private:
   void handle_control_pdu(uint8_t *payload, uint32_t nof_bytes);
 
   void reassemble_rx_sdus();
+  void reassemble_fragment(byte_buffer_t *frag, bool sdu_end);
+  void free_fragments(byte_buffer_t *frag);
 
   bool inside_tx_window(uint16_t sn);
   bool inside_rx_window(uint16_t sn);
@@ -27,6 +27,8 @@
 #ifndef RLC_COMMON_H
 #define RLC_COMMON_H
 
+#include "srslte/common/buffer_pool.h"
+
 namespace srslte {
 
 /****************************************************************************
@@ -35,6 +37,7 @@ namespace srslte {
  ***************************************************************************/
 
 #define RLC_AM_WINDOW_SIZE  512
+#define RLC_AM_SN_SPACE     1024
 
 typedef enum{
   RLC_MODE_TM = 0,
@@ -150,6 +153,44 @@ struct rlc_status_pdu_t{
   rlc_status_pdu_t(){N_nack=0; ack_sn=0;}
 };
 
+/****************************************************************************
+ * SDU chains
+ * PDU data is a run of bytes of consecutive SDUs, linked through
+ * byte_buffer_t::next, starting at an offset into the first SDU. Every SDU of
+ * the run holds a reference for the PDU, so it is copied from the SDU buffers
+ * straight into the MAC payload as many times as it is (re)transmitted.
+ ***************************************************************************/
+
+// Copies len bytes of the chain starting offset bytes into sdu to dst
+inline void rlc_sdu_chain_copy(byte_buffer_t *sdu, uint32_t offset, uint32_t len, uint8_t *dst)
+{
+  while(sdu && offset >= sdu->N_bytes) {
+    offset -= sdu->N_bytes;
+    sdu     = sdu->next;
+  }
+  while(sdu && len > 0) {
+    uint32_t n = SRSLTE_MIN(sdu->N_bytes - offset, len);
+    memcpy(dst, &sdu->msg[offset], n);
+    dst   += n;
+    len   -= n;
+    offset = 0;
+    sdu    = sdu->next;
+  }
+}
+
+// Drops the references held on the SDUs of a run of len bytes
+inline void rlc_sdu_chain_release(byte_buffer_pool *pool, byte_buffer_t *sdu, uint32_t offset, uint32_t len)
+{
+  while(sdu && len > 0) {
+    uint32_t       n    = SRSLTE_MIN(sdu->N_bytes - offset, len);
+    byte_buffer_t *next = sdu->next;
+    pool->deallocate(sdu);
+    len   -= n;
+    offset = 0;
+    sdu    = next;
+  }
+}
+
 /****************************************************************************
  * RLC Common interface
  * Common interface for all RLC entities
@@ -41,7 +41,7 @@ namespace srslte {
 
 struct rlc_umd_pdu_t{
   rlc_umd_pdu_header_t  header;
-  byte_buffer_t        *buf;
+  byte_buffer_t        *buf;    // List of buffers, one per SDU fragment
 };
 
 class rlc_um
@@ -89,6 +89,7 @@ private:
   // TX SDU buffers
   msg_queue           tx_sdu_queue;
   byte_buffer_t      *tx_sdu;
+  uint32_t            tx_sdu_offset; // Bytes of tx_sdu already sent
 
   // Rx window
   std::map<uint32_t, rlc_umd_pdu_t>  rx_window;
@@ -136,6 +137,10 @@ private:
   int  build_data_pdu(uint8_t *payload, uint32_t nof_bytes);
   void handle_data_pdu(uint8_t *payload, uint32_t nof_bytes);
   void reassemble_rx_sdus();
+  void reassemble_pdu(const char *stage);
+  void append_rx_sdu(byte_buffer_t *frag);
+  void drop_rx_sdu();
+  void free_fragments(byte_buffer_t *frag);
   bool inside_reordering_window(uint16_t sn);
   void debug_state();
 };
@@ -147,6 +152,7 @@ private:
 void        rlc_um_read_data_pdu_header(byte_buffer_t *pdu, rlc_umd_sn_size_t sn_size, rlc_umd_pdu_header_t *header);
 void        rlc_um_read_data_pdu_header(uint8_t *payload, uint32_t nof_bytes, rlc_umd_sn_size_t sn_size, rlc_umd_pdu_header_t *header);
 void        rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, byte_buffer_t *pdu);
+void        rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, uint8_t **payload);
 
 uint32_t    rlc_um_packed_length(rlc_umd_pdu_header_t *header);
 bool        rlc_um_start_aligned(uint8_t fi);
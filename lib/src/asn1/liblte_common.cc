@@ -93,44 +93,145 @@ uint32 liblte_bits_2_value(uint8  **bits,
 }
 
 /*********************************************************************
-    Name: liblte_pack
+    Name: liblte_value_2_bits
 
-    Description: Pack a bit array into a byte array
+    Description: Writes a value MSB first into a packed bit message
 *********************************************************************/
-void liblte_pack(LIBLTE_BIT_MSG_STRUCT  *bits,
-                 LIBLTE_BYTE_MSG_STRUCT *bytes)
+void liblte_value_2_bits(uint32           value,
+                         LIBLTE_BIT_PTR  *bits,
+                         uint32           N_bits)
 {
-    uint8_t* bit_ptr = bits->msg;
-    uint32_t i;
+    uint8  *byte = bits->byte;
+    uint32  bit  = bits->bit;
+    uint32  n;
+    uint32  shift;
+    uint8   mask;
 
-    for(i=0; i<bits->N_bits/8; i++)
+    while(N_bits > 0)
     {
-        bytes->msg[i] = liblte_bits_2_value(&bit_ptr, 8);
+        n      = (8 - bit < N_bits) ? 8 - bit : N_bits;
+        shift  = 8 - bit - n;
+        mask   = ((1 << n) - 1) << shift;
+        N_bits -= n;
+        *byte  = (*byte & ~mask) | (((value >> N_bits) << shift) & mask);
+        bit   += n;
+        if(8 == bit)
+        {
+            byte++;
+            bit = 0;
+        }
     }
-    bytes->N_bytes = bits->N_bits/8;
-    if(bits->N_bits%8 > 0)
+    bits->byte = byte;
+    bits->bit  = bit;
+}
+
+/*********************************************************************
+    Name: liblte_bits_2_value
+
+    Description: Reads a value MSB first from a packed bit message
+*********************************************************************/
+uint32 liblte_bits_2_value(LIBLTE_BIT_PTR  *bits,
+                           uint32           N_bits)
+{
+    uint8  *byte  = bits->byte;
+    uint32  bit   = bits->bit;
+    uint32  value = 0;
+    uint32  n;
+
+    while(N_bits > 0)
     {
-        bytes->msg[bytes->N_bytes] = liblte_bits_2_value(&bit_ptr, bits->N_bits%8);
-        bytes->N_bytes++;
+        n       = (8 - bit < N_bits) ? 8 - bit : N_bits;
+        value   = (value << n) | ((*byte >> (8 - bit - n)) & ((1 << n) - 1));
+        N_bits -= n;
+        bit    += n;
+        if(8 == bit)
+        {
+            byte++;
+            bit = 0;
+        }
     }
+    bits->byte = byte;
+    bits->bit  = bit;
+
+    return(value);
+}
+
+/*********************************************************************
+    Name: liblte_bits_copy
+
+    Description: Copies bits between packed bit messages, at any
+                 bit offset
+*********************************************************************/
+void liblte_bits_copy(LIBLTE_BIT_PTR  dst,
+                      LIBLTE_BIT_PTR  src,
+                      uint32          N_bits)
+{
+    uint32 i;
+
+    if(0 == dst.bit && 0 == src.bit)
+    {
+        memmove(dst.byte, src.byte, N_bits/8);
+        dst += N_bits & ~7;
+        src += N_bits & ~7;
+    }else{
+        for(i=0; i<N_bits/8; i++)
+        {
+            liblte_value_2_bits(liblte_bits_2_value(&src, 8), &dst, 8);
+        }
+    }
+    liblte_value_2_bits(liblte_bits_2_value(&src, N_bits%8), &dst, N_bits%8);
+}
+
+/*********************************************************************
+    Name: liblte_pack
+
+    Description: Copy a bit message into a byte message, zero padding
+                 the last byte
+*********************************************************************/
+void liblte_pack(LIBLTE_BIT_MSG_STRUCT  *bits,
+                 LIBLTE_BYTE_MSG_STRUCT *bytes)
+{
+    bytes->N_bytes = liblte_pack(bits, bytes->msg);
 }
 
 /*********************************************************************
     Name: liblte_unpack
 
-    Description: Unpack a byte array into a bit array
+    Description: Copy a byte message into a bit message
 *********************************************************************/
 void liblte_unpack(LIBLTE_BYTE_MSG_STRUCT *bytes,
                    LIBLTE_BIT_MSG_STRUCT  *bits)
 {
-    uint8_t *bit_ptr = bits->msg;
-    uint32_t i;
+    liblte_unpack(bytes->msg, bytes->N_bytes, bits);
+}
+
+/*********************************************************************
+    Name: liblte_pack
 
-    for(i=0; i<bytes->N_bytes; i++)
+    Description: Copy a bit message into a byte array, zero padding
+                 the last byte. Returns the number of bytes
+*********************************************************************/
+uint32 liblte_pack(LIBLTE_BIT_MSG_STRUCT *bits, uint8 *bytes)
+{
+    uint32 N_bytes = (bits->N_bits+7)/8;
+
+    memcpy(bytes, bits->msg, N_bytes);
+    if(bits->N_bits%8 > 0)
     {
-        liblte_value_2_bits(bytes->msg[i], &bit_ptr, 8);
+        bytes[N_bytes-1] &= 0xFF << (8 - bits->N_bits%8);
     }
-    bits->N_bits = bytes->N_bytes*8;
+    return(N_bytes);
+}
+
+/*********************************************************************
+    Name: liblte_unpack
+
+    Description: Copy a byte array into a bit message
+*********************************************************************/
+void liblte_unpack(uint8 *bytes, uint32 N_bytes, LIBLTE_BIT_MSG_STRUCT *bits)
+{
+    memcpy(bits->msg, bytes, N_bytes);
+    bits->N_bits = N_bytes*8;
 }
 
 /*********************************************************************
@@ -196,3 +297,38 @@ void liblte_align_up_zero(uint8_t **ptr, uint32_t align)
     (*ptr)++;
   }
 }
+
+/*********************************************************************
+    Name: liblte_align_up
+
+    Description: Aligns a bit cursor to a multibit boundary
+*********************************************************************/
+void liblte_align_up(LIBLTE_BIT_PTR *ptr, uint32_t align)
+{
+  uint32_t pad = ((uint64_t)ptr->byte*8 + ptr->bit) % align;
+  if(pad > 0)
+  {
+    *ptr += align - pad;
+  }
+}
+
+/*********************************************************************
+    Name: liblte_align_up_zero
+
+    Description:  Aligns a bit cursor to a multibit boundary and zeros
+                  bits skipped
+*********************************************************************/
+void liblte_align_up_zero(LIBLTE_BIT_PTR *ptr, uint32_t align)
+{
+  uint32_t pad = ((uint64_t)ptr->byte*8 + ptr->bit) % align;
+  if(pad > 0)
+  {
+    pad = align - pad;
+    while(pad > 0)
+    {
+      uint32_t n = pad < 32 ? pad : 32;
+      liblte_value_2_bits(0, ptr, n);
+      pad -= n;
+    }
+  }
+}
@@ -116,7 +116,7 @@ static void liblte_rrc_log_print(const char *format, ...) {
 /*********************************************************************
     Description: Simply consume non-critical extensions for rel > r8
 *********************************************************************/
-void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, uint8 **ie_ptr)
+void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, LIBLTE_BIT_PTR *ie_ptr)
 {
   uint32 i=0;
   uint32 elem_flags=0;
@@ -174,7 +174,7 @@ void liblte_rrc_warning_not_handled(bool opt, const char *func_name)
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -190,7 +190,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -218,7 +218,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -242,7 +242,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -280,7 +280,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -302,7 +302,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBF
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -343,7 +343,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
-                                            uint8  **ie_ptr)
+                                            LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -356,7 +356,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(LIBLTE_BIT_PTR *ie_ptr,
                                               uint16  *rnti)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -381,7 +381,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_cdma2000,
-                                                             uint8                         **ie_ptr)
+                                                             LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -411,7 +411,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_SIMPLE_BYTE_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                                LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -453,7 +453,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_nas,
-                                                        uint8                         **ie_ptr)
+                                                        LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -483,7 +483,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_SIMPLE_BYTE_MSG_S
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                           LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_nas)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -524,7 +524,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFICIENT_ENUM   filter_coeff,
-                                                        uint8                              **ie_ptr)
+                                                        LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -540,7 +540,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                           LIBLTE_RRC_FILTER_COEFFICIENT_ENUM  *filter_coeff)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -570,7 +570,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
-                                          uint8 **ie_ptr)
+                                          LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -583,7 +583,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(LIBLTE_BIT_PTR *ie_ptr,
                                             uint8  *mmec)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -608,7 +608,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config,
-                                                       uint8 **ie_ptr)
+                                                       LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -621,7 +621,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                          uint8  *neigh_cell_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -645,7 +645,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg,
-                                                  uint8                             **ie_ptr)
+                                                  LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -680,7 +680,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                     LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -728,7 +728,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
-                                                         uint8  **ie_ptr)
+                                                         LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -741,7 +741,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                            uint32  *rand)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -767,7 +767,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_type,
-                                              uint8                    **ie_ptr)
+                                              LIBLTE_BIT_PTR           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -783,7 +783,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_typ
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(LIBLTE_BIT_PTR           *ie_ptr,
                                                 LIBLTE_RRC_RAT_TYPE_ENUM  *rat_type)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -813,7 +813,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_pt
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_transaction_id,
-                                                                uint8 **ie_ptr)
+                                                                LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -826,7 +826,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_tran
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                   uint8  *rrc_transaction_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -852,7 +852,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
-                                            uint8                    **ie_ptr)
+                                            LIBLTE_BIT_PTR           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -867,7 +867,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(LIBLTE_BIT_PTR           *ie_ptr,
                                               LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -903,7 +903,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -934,7 +934,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -969,7 +969,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -985,7 +985,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAM
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1003,7 +1003,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *params,
-                                               uint8                       **ie_ptr)
+                                               LIBLTE_BIT_PTR              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1024,7 +1024,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *par
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(LIBLTE_BIT_PTR              *ie_ptr,
                                                  LIBLTE_RRC_RF_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1047,7 +1047,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **i
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1070,7 +1070,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1095,7 +1095,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1115,7 +1115,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1137,7 +1137,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1152,7 +1152,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1179,7 +1179,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAP
                                                          LIBLTE_BIT_MSG_STRUCT                 *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(ue_eutra_capability   != NULL &&
        msg                   != NULL)
@@ -1211,7 +1211,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAP
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                            LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT *ue_eutra_capability)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1257,7 +1257,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1279,7 +1279,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMER
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1315,7 +1315,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM   allowed_meas_bw,
-                                                            uint8                                  **ie_ptr)
+                                                            LIBLTE_BIT_PTR                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1328,7 +1328,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_M
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                               LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM  *allowed_meas_bw)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1353,7 +1353,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1367,7 +1367,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   uint8  *hysteresis)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1405,7 +1405,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1534,7 +1534,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1673,7 +1673,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1702,7 +1702,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1742,7 +1742,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
-                                             uint8 **ie_ptr)
+                                             LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1755,7 +1755,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                uint8  *meas_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1782,7 +1782,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1810,7 +1810,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1849,7 +1849,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1917,7 +1917,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1994,7 +1994,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2091,7 +2091,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2199,7 +2199,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2232,7 +2232,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2275,7 +2275,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
-                                                    uint8 **ie_ptr)
+                                                    LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2288,7 +2288,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                       uint8  *meas_object_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2313,7 +2313,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                 uint8                                         **ie_ptr)
+                                                                 LIBLTE_BIT_PTR                                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2350,7 +2350,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8                                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(LIBLTE_BIT_PTR                                *ie_ptr,
                                                                    LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2401,7 +2401,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2476,7 +2476,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2573,7 +2573,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2622,7 +2622,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2694,7 +2694,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2801,7 +2801,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2921,7 +2921,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
-                                                      uint8 **ie_ptr)
+                                                      LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2934,7 +2934,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                         uint8  *report_cnfg_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2959,7 +2959,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3047,7 +3047,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3146,7 +3146,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                   uint8                                           **ie_ptr)
+                                                                   LIBLTE_BIT_PTR                                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3178,7 +3178,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_RE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8                                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(LIBLTE_BIT_PTR                                  *ie_ptr,
                                                                      LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3220,7 +3220,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_ENUM   report_int,
-                                                     uint8                           **ie_ptr)
+                                                     LIBLTE_BIT_PTR                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3233,7 +3233,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(LIBLTE_BIT_PTR                  *ie_ptr,
                                                        LIBLTE_RRC_REPORT_INTERVAL_ENUM  *report_int)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3258,7 +3258,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3271,7 +3271,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   uint8  *rsrp_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3296,7 +3296,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3309,7 +3309,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   uint8  *rsrq_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3336,7 +3336,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_ENUM   time_to_trigger,
-                                                     uint8                           **ie_ptr)
+                                                     LIBLTE_BIT_PTR                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3349,7 +3349,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(LIBLTE_BIT_PTR                  *ie_ptr,
                                                        LIBLTE_RRC_TIME_TO_TRIGGER_ENUM  *time_to_trigger)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3373,7 +3373,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_spect_em,
-                                                                  uint8 **ie_ptr)
+                                                                  LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3386,7 +3386,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_sp
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                     uint8  *add_spect_em)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3411,7 +3411,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_p
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
-                                                          uint8  **ie_ptr)
+                                                          LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3424,7 +3424,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                             uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3450,7 +3450,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr)
+                                                       LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3463,7 +3463,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                          uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3488,7 +3488,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr)
+                                                       LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3501,7 +3501,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                          uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3527,7 +3527,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
-                                                      uint8  **ie_ptr)
+                                                      LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3540,7 +3540,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                         uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3565,7 +3565,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM   bc_cdma2000,
-                                                         uint8                               **ie_ptr)
+                                                         LIBLTE_BIT_PTR                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3581,7 +3581,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                            LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM  *bc_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3609,7 +3609,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM   bi_geran,
-                                                          uint8                                **ie_ptr)
+                                                          LIBLTE_BIT_PTR                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3622,7 +3622,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICA
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                             LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM  *bi_geran)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3646,7 +3646,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3661,7 +3661,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3687,7 +3687,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3702,7 +3702,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3728,7 +3728,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3758,7 +3758,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQ
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3798,7 +3798,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM   cdma2000_type,
-                                                   uint8                         **ie_ptr)
+                                                   LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3811,7 +3811,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                      LIBLTE_RRC_CDMA2000_TYPE_ENUM  *cdma2000_type)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3835,7 +3835,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
-                                                   uint8  **ie_ptr)
+                                                   LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3848,7 +3848,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                      uint32  *cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3873,7 +3873,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3895,7 +3895,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3930,7 +3930,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_resel_prio,
-                                                               uint8 **ie_ptr)
+                                                               LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3943,7 +3943,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_rese
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                  uint8  *cell_resel_prio)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3969,7 +3969,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param,
-                                                                   uint8                                           **ie_ptr)
+                                                                   LIBLTE_BIT_PTR                                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3995,7 +3995,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CS
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8                                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(LIBLTE_BIT_PTR                                  *ie_ptr,
                                                                      LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4023,7 +4023,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param,
-                                                                        uint8                                                **ie_ptr)
+                                                                        LIBLTE_BIT_PTR                                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4037,7 +4037,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_R
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8                                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_BIT_PTR                                       *ie_ptr,
                                                                           LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4062,7 +4062,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4077,7 +4077,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4103,7 +4103,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4118,7 +4118,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4144,7 +4144,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4160,7 +4160,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4187,7 +4187,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4206,7 +4206,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4235,7 +4235,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
-                                                  uint8  **ie_ptr)
+                                                  LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4248,7 +4248,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint32  *csg_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4273,7 +4273,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4350,7 +4350,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4447,7 +4447,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4464,7 +4464,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4491,7 +4491,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
-                                                  uint8  **ie_ptr)
+                                                  LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4504,7 +4504,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint16  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4529,7 +4529,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              opt;
@@ -4553,7 +4553,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4597,7 +4597,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr)
+                                                           LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4610,7 +4610,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint16  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4634,7 +4634,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4649,7 +4649,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4674,7 +4674,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr)
+                                                           LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4687,7 +4687,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint16  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4711,7 +4711,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
-                                                           uint8 **ie_ptr)
+                                                           LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4724,7 +4724,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint8  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4748,7 +4748,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id,
-                                                   uint8                           **ie_ptr)
+                                                   LIBLTE_BIT_PTR                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint8             mcc_opt = true;
@@ -4785,7 +4785,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(LIBLTE_BIT_PTR                  *ie_ptr,
                                                      LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4835,7 +4835,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd,
-                                                                uint8                                        **ie_ptr)
+                                                                LIBLTE_BIT_PTR                               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -4873,7 +4873,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_R
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8                                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(LIBLTE_BIT_PTR                               *ie_ptr,
                                                                   LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4921,7 +4921,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4934,7 +4934,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                   int8   *q_qual_min)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4959,7 +4959,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
-                                                  uint8 **ie_ptr)
+                                                  LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4972,7 +4972,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     int16  *q_rx_lev_min)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4999,7 +4999,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_ENUM   q_offset_range,
-                                                    uint8                          **ie_ptr)
+                                                    LIBLTE_BIT_PTR                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5012,7 +5012,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_EN
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(LIBLTE_BIT_PTR                 *ie_ptr,
                                                       LIBLTE_RRC_Q_OFFSET_RANGE_ENUM  *q_offset_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5038,7 +5038,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_range_inter_rat,
-                                                              uint8 **ie_ptr)
+                                                              LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5051,7 +5051,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_r
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                 int8   *q_offset_range_inter_rat)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5075,7 +5075,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
-                                                           uint8 **ie_ptr)
+                                                           LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5088,7 +5088,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                              uint8  *resel_thresh)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5113,7 +5113,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thresh_q,
-                                                             uint8 **ie_ptr)
+                                                             LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5126,7 +5126,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thres
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                uint8  *resel_thresh_q)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5151,7 +5151,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
-                                                  uint8 **ie_ptr)
+                                                  LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5164,7 +5164,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint8  *s_cell_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5189,7 +5189,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
-                                                     uint8 **ie_ptr)
+                                                     LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5202,7 +5202,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                        uint8  *serv_cell_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5228,7 +5228,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5243,7 +5243,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5278,7 +5278,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5301,7 +5301,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5335,7 +5335,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
-                                                        uint8  **ie_ptr)
+                                                        LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5348,7 +5348,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                           uint16  *tac)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5373,7 +5373,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
-                                                   uint8 **ie_ptr)
+                                                   LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5386,7 +5386,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                      uint8  *t_resel)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5411,7 +5411,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_chaining_count,
-                                                             uint8 **ie_ptr)
+                                                             LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5424,7 +5424,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_ch
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                uint8  *next_hop_chaining_count)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5449,7 +5449,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5471,7 +5471,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5504,7 +5504,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
-                                                 uint8  **ie_ptr)
+                                                 LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5517,7 +5517,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                    uint16  *short_mac_i)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5542,7 +5542,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM   antenna_ports_cnt,
-                                                         uint8                               **ie_ptr)
+                                                         LIBLTE_BIT_PTR                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5555,7 +5555,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                            LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM  *antenna_ports_cnt)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5571,7 +5571,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR                           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5624,7 +5624,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_I
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5687,7 +5687,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_PTR                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5745,7 +5745,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(LIBLTE_BIT_PTR                      *ie_ptr,
                                                          LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5833,7 +5833,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
-                                                  uint8 **ie_ptr)
+                                                  LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5846,7 +5846,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                     uint8  *drb_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5870,7 +5870,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR                           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5903,7 +5903,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5951,7 +5951,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              ext = false;
@@ -6088,7 +6088,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6239,7 +6239,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_PTR                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6299,7 +6299,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(LIBLTE_BIT_PTR                *ie_ptr,
                                                    LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6374,7 +6374,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6389,7 +6389,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6406,7 +6406,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM   p_a,
-                                                            uint8                            **ie_ptr)
+                                                            LIBLTE_BIT_PTR                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6419,7 +6419,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8                            **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(LIBLTE_BIT_PTR                   *ie_ptr,
                                                               LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM  *p_a)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6443,7 +6443,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_PTR                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6458,7 +6458,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(LIBLTE_BIT_PTR                 *ie_ptr,
                                                     LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6484,7 +6484,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              ext = false;
@@ -6576,7 +6576,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSIC
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6683,7 +6683,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
-                                           uint8 **ie_ptr)
+                                           LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6696,7 +6696,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(LIBLTE_BIT_PTR *ie_ptr,
                                              int8   *p_max)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6721,7 +6721,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6739,7 +6739,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6759,7 +6759,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_PTR                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6784,7 +6784,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(LIBLTE_BIT_PTR                 *ie_ptr,
                                                     LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6811,7 +6811,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_idx,
-                                                            uint8 **ie_ptr)
+                                                            LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6824,7 +6824,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_i
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                               uint8  *prach_cnfg_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6849,7 +6849,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_ant_port_1,
-                                                             uint8 **ie_ptr)
+                                                             LIBLTE_BIT_PTR *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6862,7 +6862,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_an
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(LIBLTE_BIT_PTR *ie_ptr,
                                                                bool   *presence_ant_port_1)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6887,7 +6887,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6904,7 +6904,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6923,7 +6923,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR                           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6955,7 +6955,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6999,7 +6999,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7023,7 +7023,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7049,7 +7049,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR                           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7070,7 +7070,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7101,7 +7101,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_PTR                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7140,7 +7140,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                           LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7196,7 +7196,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7211,7 +7211,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7239,7 +7239,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7273,7 +7273,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7311,7 +7311,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7394,7 +7394,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7491,7 +7491,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_PTR                        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -7667,7 +7667,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(LIBLTE_BIT_PTR                        *ie_ptr,
                                                            LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7857,7 +7857,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_PTR               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7926,7 +7926,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *r
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(LIBLTE_BIT_PTR               *ie_ptr,
                                                   LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8008,7 +8008,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants,
-                                                              uint8                                      **ie_ptr)
+                                                              LIBLTE_BIT_PTR                             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8032,7 +8032,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8                                      **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(LIBLTE_BIT_PTR                             *ie_ptr,
                                                                 LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8075,7 +8075,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_PTR                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8101,7 +8101,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(LIBLTE_BIT_PTR                              *ie_ptr,
                                                                  LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8138,7 +8138,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_PTR                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8166,7 +8166,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONF
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(LIBLTE_BIT_PTR                         *ie_ptr,
                                                             LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8196,7 +8196,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8234,7 +8234,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8283,7 +8283,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_PTR               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -8368,7 +8368,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *s
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(LIBLTE_BIT_PTR               *ie_ptr,
                                                   LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8468,7 +8468,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_PTR               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8483,7 +8483,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *t
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(LIBLTE_BIT_PTR               *ie_ptr,
                                                   LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8509,7 +8509,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM   time_alignment_timer,
-                                                          uint8                                **ie_ptr)
+                                                          LIBLTE_BIT_PTR                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8522,7 +8522,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(LIBLTE_BIT_PTR                       *ie_ptr,
                                                             LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM  *time_alignment_timer)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8547,7 +8547,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_PTR                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8576,7 +8576,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(LIBLTE_BIT_PTR                     *ie_ptr,
                                                         LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8615,7 +8615,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_PTR                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8633,7 +8633,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(LIBLTE_BIT_PTR                    *ie_ptr,
                                                        LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8665,7 +8665,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_PTR                            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8690,7 +8690,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(LIBLTE_BIT_PTR                            *ie_ptr,
                                                                LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8717,7 +8717,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl,
-                                                                uint8                                        **ie_ptr)
+                                                                LIBLTE_BIT_PTR                               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8753,7 +8753,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_PO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8                                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(LIBLTE_BIT_PTR                               *ie_ptr,
                                                                   LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8800,7 +8800,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -8898,7 +8898,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9012,7 +9012,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9096,7 +9096,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9195,7 +9195,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9253,7 +9253,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9324,7 +9324,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9404,7 +9404,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9504,7 +9504,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9586,7 +9586,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9681,7 +9681,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9743,7 +9743,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9820,7 +9820,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_RRC_NEIGH_CELL_CDMA2000_STRUCT *neigh_cell_list;
     LIBLTE_ERROR_ENUM                      err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9976,7 +9976,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8)
 {
     LIBLTE_RRC_NEIGH_CELL_CDMA2000_STRUCT *neigh_cell_list;
@@ -10156,7 +10156,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_PTR                          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -10185,7 +10185,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(LIBLTE_BIT_PTR                          *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10257,7 +10257,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_PTR                           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -10283,7 +10283,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(LIBLTE_BIT_PTR                           *ie_ptr,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10331,7 +10331,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_information_transfer_msg(LIBLTE_RRC_UL_INFO
                                                               LIBLTE_BIT_MSG_STRUCT                     *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(ul_info_transfer != NULL &&
        msg              != NULL)
@@ -10369,7 +10369,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_MSG_S
                                                                 LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg              != NULL &&
        ul_info_transfer != NULL)
@@ -10435,7 +10435,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_information_request_msg(LIBLTE_RRC_UE_INFOR
                                                              LIBLTE_BIT_MSG_STRUCT                    *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(ue_info_req != NULL &&
        msg         != NULL)
@@ -10471,7 +10471,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_MSG_ST
                                                                LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg         != NULL &&
        ue_info_req != NULL)
@@ -10515,7 +10515,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CA
                                                                 LIBLTE_BIT_MSG_STRUCT                       *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
 
     if(ue_capability_info != NULL &&
@@ -10559,13 +10559,10 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CA
                 // FIXME: Unlikely to have more than 16K of octets
             }
 
-            for(i=0; i<tmp.N_bits; i++)
-            {
-                *msg_ptr = tmp.msg[i];
-                msg_ptr++;
-            }
+            liblte_bits_copy(msg_ptr, tmp.msg, tmp.N_bits);
+            msg_ptr += tmp.N_bits;
 
-            msg_ptr += pad;
+            liblte_value_2_bits(0, &msg_ptr, pad);
         }
 
         // Fill in the number of bits used
@@ -10580,7 +10577,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_MSG
                                                                   LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
 
     if(msg                != NULL &&
@@ -10644,7 +10641,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_enquiry_msg(LIBLTE_RRC_UE_CAPABI
                                                             LIBLTE_BIT_MSG_STRUCT                   *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
 
     if(ue_cap_enquiry != NULL &&
@@ -10682,7 +10679,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_MSG_STR
                                                               LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry)
 {
   LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-  uint8             *msg_ptr = msg->msg;
+  LIBLTE_BIT_PTR     msg_ptr = msg->msg;
   uint32             i;
 
   if(msg         != NULL &&
@@ -10729,7 +10726,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_1_msg(LIBLTE_RRC_SYS_INFO_
                                                             LIBLTE_BIT_MSG_STRUCT                   *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
     uint8              non_crit_ext_opt        = false;
@@ -10821,7 +10818,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
                                                               uint32                                  *N_bits_used)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
     bool               tdd_config_opt;
@@ -10935,8 +10932,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                                                LIBLTE_BIT_MSG_STRUCT          *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
-    uint8             *length_ptr;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     length_ptr;
     uint32             length;
     uint32             pad_bits;
     uint32             i;
@@ -11058,8 +11055,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
                                                  LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
-    uint8             *head_ptr;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     head_ptr;
     uint32             i;
     uint32             length_determinant_octets;
     uint8              non_crit_ext_opt;
@@ -11181,7 +11178,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_failure_msg(LIBLTE_RRC_SECURITY_
                                                             LIBLTE_BIT_MSG_STRUCT                   *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(security_mode_failure != NULL &&
        msg                   != NULL)
@@ -11208,7 +11205,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_MSG_STR
                                                               LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                   != NULL &&
        security_mode_failure != NULL)
@@ -11243,7 +11240,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_complete_msg(LIBLTE_RRC_SECURITY
                                                              LIBLTE_BIT_MSG_STRUCT                    *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(security_mode_complete != NULL &&
        msg                    != NULL)
@@ -11270,7 +11267,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_MSG_ST
                                                                LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                    != NULL &&
        security_mode_complete != NULL)
@@ -11304,7 +11301,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_command_msg(LIBLTE_RRC_SECURITY_
                                                             LIBLTE_BIT_MSG_STRUCT                   *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(security_mode_cmd != NULL &&
        msg               != NULL)
@@ -11341,7 +11338,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_MSG_STR
                                                               LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg_ptr           != NULL &&
        security_mode_cmd != NULL)
@@ -11388,7 +11385,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_complete_msg(LIBLTE_RRC_C
                                                                     LIBLTE_BIT_MSG_STRUCT                       *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_setup_complete != NULL &&
        msg                != NULL)
@@ -11445,7 +11442,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT
                                                                       LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                != NULL &&
        con_setup_complete != NULL)
@@ -11509,7 +11506,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_msg(LIBLTE_RRC_CONNECTION
                                                            LIBLTE_BIT_MSG_STRUCT              *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_setup != NULL &&
        msg       != NULL)
@@ -11542,7 +11539,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_MSG_STRU
                                                              LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg       != NULL &&
        con_setup != NULL)
@@ -11583,7 +11580,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTI
                                                              LIBLTE_BIT_MSG_STRUCT                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(con_req != NULL &&
@@ -11626,7 +11623,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_MSG_ST
                                                                LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg     != NULL &&
        con_req != NULL)
@@ -11669,7 +11666,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_release_msg(LIBLTE_RRC_CONNECTI
                                                              LIBLTE_BIT_MSG_STRUCT                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_release != NULL &&
        msg         != NULL)
@@ -11704,7 +11701,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_MSG_ST
                                                                LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg         != NULL &&
        con_release != NULL)
@@ -11746,7 +11743,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reject_msg(LIBLTE_RRC_CONNECTIO
                                                             LIBLTE_BIT_MSG_STRUCT               *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_rej != NULL &&
        msg     != NULL)
@@ -11775,7 +11772,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_MSG_STR
                                                               LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg     != NULL &&
        con_rej != NULL)
@@ -11812,7 +11809,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIB
                                                                              LIBLTE_BIT_MSG_STRUCT                                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(con_reest_req != NULL &&
@@ -11847,7 +11844,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(L
                                                                                LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg           != NULL &&
        con_reest_req != NULL)
@@ -11883,7 +11880,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_reject_msg(LIBL
                                                                             LIBLTE_BIT_MSG_STRUCT                               *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_reest_rej != NULL &&
        msg           != NULL)
@@ -11906,7 +11903,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LI
                                                                               LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg           != NULL &&
        con_reest_rej != NULL)
@@ -11937,7 +11934,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_complete_msg(LI
                                                                               LIBLTE_BIT_MSG_STRUCT                                 *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_reest_complete != NULL &&
        msg                != NULL)
@@ -11964,7 +11961,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(
                                                                                 LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                != NULL &&
        con_reest_complete != NULL)
@@ -11998,7 +11995,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_msg(LIBLTE_RRC_
                                                                      LIBLTE_BIT_MSG_STRUCT                        *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_reest != NULL &&
        msg       != NULL)
@@ -12034,7 +12031,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BI
                                                                        LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg       != NULL &&
        con_reest != NULL)
@@ -12078,7 +12075,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg(LI
                                                                               LIBLTE_BIT_MSG_STRUCT                                 *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(con_reconfig_complete != NULL &&
        msg                   != NULL)
@@ -12105,7 +12102,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(
                                                                                 LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                   != NULL &&
        con_reconfig_complete != NULL)
@@ -12139,7 +12136,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_msg(LIBLTE_RRC_
                                                                      LIBLTE_BIT_MSG_STRUCT                        *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
 
     if(con_reconfig != NULL &&
@@ -12244,7 +12241,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BI
                                                                        LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
     bool               ded_info_nas_list_present;
 
@@ -12357,7 +12354,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rn_reconfiguration_complete_msg(LIBLTE_RRC_RN_
                                                                   LIBLTE_BIT_MSG_STRUCT                         *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(rn_reconfig_complete != NULL &&
        msg                  != NULL)
@@ -12388,7 +12385,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_M
                                                                     LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                  != NULL &&
        rn_reconfig_complete != NULL)
@@ -12438,7 +12435,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_proximity_indication_msg(LIBLTE_RRC_PROXIMITY_
                                                            LIBLTE_BIT_MSG_STRUCT                  *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(proximity_ind != NULL &&
        msg           != NULL)
@@ -12483,7 +12480,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_MSG_STRU
                                                              LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg           != NULL &&
        proximity_ind != NULL)
@@ -12535,7 +12532,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
                                              LIBLTE_BIT_MSG_STRUCT    *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
 
@@ -12633,7 +12630,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
                                                LIBLTE_RRC_PAGING_STRUCT *page)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
     uint8              paging_record_list_present;
@@ -12800,7 +12797,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_information_transfer_msg(LIBLTE_RRC_DL_INFO
                                                               LIBLTE_BIT_MSG_STRUCT                     *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(dl_info_transfer != NULL &&
        msg              != NULL)
@@ -12842,7 +12839,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_MSG_S
                                                                 LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg              != NULL &&
        dl_info_transfer != NULL)
@@ -12903,7 +12900,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_parameters_request_cdma2000_msg(LIBLTE_RR
                                                                        LIBLTE_BIT_MSG_STRUCT                              *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(csfb_params_req_cdma2000 != NULL &&
        msg                      != NULL)
@@ -12926,7 +12923,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_
                                                                          LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg                      != NULL &&
        csfb_params_req_cdma2000 != NULL)
@@ -12979,7 +12976,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
                                                LIBLTE_BIT_MSG_STRUCT *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(mib != NULL &&
        msg != NULL)
@@ -13008,7 +13005,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
                                                  LIBLTE_RRC_MIB_STRUCT *mib)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
 
     if(msg != NULL &&
        mib != NULL)
@@ -13041,7 +13038,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUC
                                                  LIBLTE_BIT_MSG_STRUCT            *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(bcch_dlsch_msg != NULL &&
@@ -13059,7 +13056,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUC
                                                             &global_msg);
             if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
             {
-                memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+                liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
                 msg->N_bits = global_msg.N_bits + 2;
             }else{
                 msg->N_bits = 0;
@@ -13073,7 +13070,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUC
                                                &global_msg);
             if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
             {
-                memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+                liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
                 msg->N_bits = global_msg.N_bits + 2;
             }else{
                 msg->N_bits = 0;
@@ -13088,7 +13085,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
                                                    LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             N_bits_used;
     uint8              ext;
 
@@ -13105,7 +13102,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
             bcch_dlsch_msg->sibs[0].sib_type = LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1;
             if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
             {
-                memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+                liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
                 global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
                 err               = liblte_rrc_unpack_sys_info_block_type_1_msg(&global_msg,
                                                                                 (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
@@ -13115,7 +13112,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
         }else{
             if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
             {
-                memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+                liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
                 err = liblte_rrc_unpack_sys_info_msg(&global_msg,
                                                      bcch_dlsch_msg);
             }
@@ -13140,7 +13137,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
                                            LIBLTE_BIT_MSG_STRUCT      *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(pcch_msg != NULL &&
@@ -13153,7 +13150,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
                                          &global_msg);
         if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+            liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
             msg->N_bits = global_msg.N_bits + 1;
         }else{
             msg->N_bits = 0;
@@ -13167,7 +13164,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
                                              LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint32             N_bits_used;
 
     if(msg      != NULL &&
@@ -13178,7 +13175,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
 
         if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
         {
-            memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+            liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
             err = liblte_rrc_unpack_paging_msg(&global_msg,
                                                pcch_msg);
         }
@@ -13200,7 +13197,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_
                                               LIBLTE_BIT_MSG_STRUCT         *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(dl_ccch_msg != NULL &&
@@ -13229,7 +13226,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_
 
         if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 3))
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+            liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
             msg->N_bits = global_msg.N_bits + 3;
         }else{
             msg->N_bits = 0;
@@ -13243,7 +13240,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
                                                 LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
@@ -13256,7 +13253,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         dl_ccch_msg->msg_type = (LIBLTE_RRC_DL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+        liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
         global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST == dl_ccch_msg->msg_type)
         {
@@ -13292,7 +13289,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_
                                               LIBLTE_BIT_MSG_STRUCT         *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(dl_dcch_msg != NULL &&
@@ -13352,7 +13349,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_
 
         if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 5))
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+            liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
             msg->N_bits = global_msg.N_bits + 5;
         }else{
             msg->N_bits = 0;
@@ -13366,7 +13363,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
                                                 LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
@@ -13379,7 +13376,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         dl_dcch_msg->msg_type = (LIBLTE_RRC_DL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+        liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
         global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_CSFB_PARAMS_RESP_CDMA2000 == dl_dcch_msg->msg_type)
         {
@@ -13445,7 +13442,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_
                                               LIBLTE_BIT_MSG_STRUCT         *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(ul_ccch_msg != NULL &&
@@ -13468,7 +13465,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_
 
         if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+            liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
             msg->N_bits = global_msg.N_bits + 2;
         }else{
             msg->N_bits = 0;
@@ -13482,7 +13479,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
                                                 LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
@@ -13495,7 +13492,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         ul_ccch_msg->msg_type = (LIBLTE_RRC_UL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+        liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
         global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REEST_REQ == ul_ccch_msg->msg_type)
         {
@@ -13525,7 +13522,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_
                                               LIBLTE_BIT_MSG_STRUCT         *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(ul_dcch_msg != NULL &&
@@ -13589,7 +13586,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_
 
         if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 5))
         {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
+            liblte_bits_copy(msg_ptr, global_msg.msg, global_msg.N_bits);
             msg->N_bits = global_msg.N_bits + 5;
         }else{
             msg->N_bits = 0;
@@ -13603,7 +13600,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
                                                 LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    LIBLTE_BIT_PTR     msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
@@ -13616,7 +13613,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
         ul_dcch_msg->msg_type = (LIBLTE_RRC_UL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
+        liblte_bits_copy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
         global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_CSFB_PARAMS_REQ_CDMA2000 == ul_dcch_msg->msg_type)
         {
@@ -43,7 +43,7 @@ static void liblte_log_print(const char *format, ...) {
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
   LIBLTE_S1AP_CRITICALITY_ENUM                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -58,7 +58,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CRITICALITY_ENUM                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -79,7 +79,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
   LIBLTE_S1AP_LOCAL_STRUCT                                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -98,7 +98,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LOCAL_STRUCT                                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -122,7 +122,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -145,7 +145,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -173,7 +173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -192,7 +192,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -215,7 +215,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -230,7 +230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -250,7 +250,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
   LIBLTE_S1AP_PRESENCE_ENUM                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -265,7 +265,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRESENCE_ENUM                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -285,7 +285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -304,7 +304,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -327,7 +327,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -346,7 +346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -369,7 +369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -390,7 +390,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -416,7 +416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -437,7 +437,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -463,7 +463,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -488,7 +488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -519,7 +519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -545,7 +545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -577,7 +577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
 // lb:0, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -603,7 +603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -635,7 +635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
 // lb:None, ub:None
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -669,7 +669,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -707,7 +707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -728,7 +728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -754,7 +754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -775,7 +775,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -802,7 +802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -828,7 +828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -859,7 +859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
   LIBLTE_S1AP_BITRATE_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -883,7 +883,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_BITRATE_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -909,7 +909,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -932,7 +932,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -960,7 +960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -983,7 +983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1011,7 +1011,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1034,7 +1034,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1062,7 +1062,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1082,7 +1082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1107,7 +1107,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1138,7 +1138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1173,7 +1173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1204,7 +1204,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1239,7 +1239,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1262,7 +1262,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1290,7 +1290,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1321,7 +1321,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1356,7 +1356,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1387,7 +1387,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1422,7 +1422,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
   LIBLTE_S1AP_CNDOMAIN_ENUM                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1437,7 +1437,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CNDOMAIN_ENUM                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1457,7 +1457,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1479,7 +1479,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1506,7 +1506,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1529,7 +1529,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1557,7 +1557,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1580,7 +1580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1608,7 +1608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1631,7 +1631,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1659,7 +1659,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1681,7 +1681,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1709,7 +1709,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
   LIBLTE_S1AP_MACROENB_ID_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1729,7 +1729,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MACROENB_ID_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1756,7 +1756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1776,7 +1776,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1802,7 +1802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
   LIBLTE_S1AP_ENB_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1835,7 +1835,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENB_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1873,7 +1873,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
   LIBLTE_S1AP_ENBNAME_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1902,7 +1902,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENBNAME_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1936,7 +1936,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1961,7 +1961,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1991,7 +1991,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2014,7 +2014,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2042,7 +2042,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2061,7 +2061,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2084,7 +2084,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2107,7 +2107,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2135,7 +2135,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2158,7 +2158,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2186,7 +2186,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
   LIBLTE_S1AP_HFN_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2210,7 +2210,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_HFN_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2236,7 +2236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
   LIBLTE_S1AP_IMSI_STRUCT                                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2267,7 +2267,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_IMSI_STRUCT                                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2302,7 +2302,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2320,7 +2320,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2343,7 +2343,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
   LIBLTE_S1AP_LAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2365,7 +2365,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2392,7 +2392,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2423,7 +2423,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2458,7 +2458,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2489,7 +2489,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2524,7 +2524,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
   LIBLTE_S1AP_LHN_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2555,7 +2555,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LHN_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2590,7 +2590,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2605,7 +2605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2625,7 +2625,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2648,7 +2648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2676,7 +2676,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2699,7 +2699,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2727,7 +2727,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2750,7 +2750,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2778,7 +2778,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2796,7 +2796,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2819,7 +2819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2837,7 +2837,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2860,7 +2860,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
   LIBLTE_S1AP_MMENAME_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2889,7 +2889,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MMENAME_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2923,7 +2923,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2945,7 +2945,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2972,7 +2972,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2996,7 +2996,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3022,7 +3022,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3053,7 +3053,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3088,7 +3088,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
   LIBLTE_S1AP_NAS_PDU_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3119,7 +3119,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_NAS_PDU_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3154,7 +3154,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3185,7 +3185,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3220,7 +3220,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3239,7 +3239,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3262,7 +3262,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3285,7 +3285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3313,7 +3313,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3336,7 +3336,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3364,7 +3364,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
   LIBLTE_S1AP_PDCP_SN_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3383,7 +3383,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PDCP_SN_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3406,7 +3406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3428,7 +3428,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3455,7 +3455,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3470,7 +3470,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3490,7 +3490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3513,7 +3513,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3541,7 +3541,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3561,7 +3561,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3586,7 +3586,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3605,7 +3605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3628,7 +3628,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
   LIBLTE_S1AP_RAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3650,7 +3650,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3677,7 +3677,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3692,7 +3692,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3712,7 +3712,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3735,7 +3735,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3763,7 +3763,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
   LIBLTE_S1AP_RNC_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3782,7 +3782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RNC_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3805,7 +3805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3828,7 +3828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3856,7 +3856,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3875,7 +3875,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3898,7 +3898,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3921,7 +3921,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3949,7 +3949,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3980,7 +3980,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4015,7 +4015,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4038,7 +4038,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4066,7 +4066,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4097,7 +4097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4132,7 +4132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4151,7 +4151,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4174,7 +4174,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4197,7 +4197,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4225,7 +4225,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4256,7 +4256,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4291,7 +4291,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4307,7 +4307,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4328,7 +4328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4347,7 +4347,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4370,7 +4370,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4402,7 +4402,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4439,7 +4439,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4462,7 +4462,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4490,7 +4490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4506,7 +4506,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4527,7 +4527,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4558,7 +4558,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4593,7 +4593,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4615,7 +4615,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4642,7 +4642,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4673,7 +4673,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4708,7 +4708,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4731,7 +4731,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4759,7 +4759,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4782,7 +4782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4810,7 +4810,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4833,7 +4833,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4861,7 +4861,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4892,7 +4892,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4927,7 +4927,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4950,7 +4950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4978,7 +4978,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
   LIBLTE_S1AP_CI_STRUCT                                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5000,7 +5000,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CI_STRUCT                                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5027,7 +5027,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5050,7 +5050,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5078,7 +5078,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5093,7 +5093,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5113,7 +5113,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5131,7 +5131,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5155,7 +5155,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5181,7 +5181,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5213,7 +5213,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5239,7 +5239,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5270,7 +5270,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5294,7 +5294,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5320,7 +5320,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5342,7 +5342,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5369,7 +5369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5407,7 +5407,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5450,7 +5450,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5469,7 +5469,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5493,7 +5493,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
 // lb:1, ub:4096
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5519,7 +5519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5550,7 +5550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
   LIBLTE_S1AP_GTP_TEID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5572,7 +5572,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GTP_TEID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5599,7 +5599,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5622,7 +5622,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5650,7 +5650,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5673,7 +5673,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5701,7 +5701,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5726,7 +5726,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5756,7 +5756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5782,7 +5782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5813,7 +5813,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5836,7 +5836,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5864,7 +5864,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5879,7 +5879,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5899,7 +5899,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5922,7 +5922,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5950,7 +5950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5973,7 +5973,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6001,7 +6001,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6024,7 +6024,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6052,7 +6052,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6072,7 +6072,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6097,7 +6097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
   LIBLTE_S1AP_MME_CODE_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6119,7 +6119,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MME_CODE_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6146,7 +6146,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6177,7 +6177,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6212,7 +6212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6231,7 +6231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6254,7 +6254,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6283,7 +6283,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6317,7 +6317,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6336,7 +6336,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6359,7 +6359,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6374,7 +6374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6394,7 +6394,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
   LIBLTE_S1AP_QCI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6413,7 +6413,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_QCI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6436,7 +6436,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6459,7 +6459,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6487,7 +6487,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6510,7 +6510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6538,7 +6538,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6569,7 +6569,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6604,7 +6604,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6623,7 +6623,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6646,7 +6646,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
   LIBLTE_S1AP_SECURITYKEY_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6666,7 +6666,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SECURITYKEY_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6691,7 +6691,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6709,7 +6709,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6732,7 +6732,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6763,7 +6763,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6798,7 +6798,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6821,7 +6821,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6850,7 +6850,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6876,7 +6876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6907,7 +6907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6929,7 +6929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6956,7 +6956,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
   LIBLTE_S1AP_TAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6978,7 +6978,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7006,7 +7006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7032,7 +7032,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7063,7 +7063,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
   LIBLTE_S1AP_TBCD_STRING_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7085,7 +7085,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TBCD_STRING_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7112,7 +7112,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7143,7 +7143,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7178,7 +7178,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7194,7 +7194,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7215,7 +7215,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7234,7 +7234,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7257,7 +7257,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7279,7 +7279,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7306,7 +7306,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7329,7 +7329,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7357,7 +7357,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7392,7 +7392,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7432,7 +7432,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7467,7 +7467,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7507,7 +7507,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7525,7 +7525,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7548,7 +7548,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7583,7 +7583,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7623,7 +7623,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7646,7 +7646,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7674,7 +7674,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7696,7 +7696,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7724,7 +7724,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7750,7 +7750,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7781,7 +7781,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7804,7 +7804,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7832,7 +7832,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7855,7 +7855,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7883,7 +7883,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7914,7 +7914,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7949,7 +7949,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7964,7 +7964,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7984,7 +7984,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8019,7 +8019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8059,7 +8059,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8097,7 +8097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8141,7 +8141,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
 // lb:1, ub:2
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8167,7 +8167,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8198,7 +8198,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8222,7 +8222,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8249,7 +8249,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
 // lb:1, ub:4096
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8275,7 +8275,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8306,7 +8306,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8349,7 +8349,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8397,7 +8397,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8421,7 +8421,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8447,7 +8447,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8462,7 +8462,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8482,7 +8482,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8513,7 +8513,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8548,7 +8548,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8579,7 +8579,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8615,7 +8615,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8650,7 +8650,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8690,7 +8690,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8723,7 +8723,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8761,7 +8761,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
   LIBLTE_S1AP_M_TMSI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8783,7 +8783,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M_TMSI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8810,7 +8810,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8841,7 +8841,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8876,7 +8876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8898,7 +8898,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8925,7 +8925,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8950,7 +8950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8980,7 +8980,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9015,7 +9015,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9055,7 +9055,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9086,7 +9086,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9122,7 +9122,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9138,7 +9138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9160,7 +9160,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9195,7 +9195,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9236,7 +9236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9262,7 +9262,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9293,7 +9293,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9328,7 +9328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9368,7 +9368,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
   LIBLTE_S1AP_TAI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9403,7 +9403,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9443,7 +9443,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9474,7 +9474,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9510,7 +9510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9541,7 +9541,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9577,7 +9577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9608,7 +9608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9644,7 +9644,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9672,7 +9672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9705,7 +9705,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9743,7 +9743,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9786,7 +9786,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9819,7 +9819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9857,7 +9857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9898,7 +9898,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9945,7 +9945,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
 // lb:1, ub:6
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
   LIBLTE_S1AP_BPLMNS_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9971,7 +9971,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_BPLMNS_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10002,7 +10002,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
   LIBLTE_S1AP_CAUSE_STRUCT                                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10047,7 +10047,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CAUSE_STRUCT                                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10097,7 +10097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10136,7 +10136,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10180,7 +10180,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
   LIBLTE_S1AP_CGI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10226,7 +10226,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CGI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10277,7 +10277,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10312,7 +10312,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10353,7 +10353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10379,7 +10379,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10410,7 +10410,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10445,7 +10445,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10486,7 +10486,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
 // lb:1, ub:15
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
   LIBLTE_S1AP_EPLMNS_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10512,7 +10512,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EPLMNS_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10543,7 +10543,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_E_RABITEM_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10578,7 +10578,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABITEM_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10618,7 +10618,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10653,7 +10653,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10693,7 +10693,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10728,7 +10728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10768,7 +10768,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10803,7 +10803,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10843,7 +10843,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
   LIBLTE_S1AP_LAI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10878,7 +10878,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LAI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10918,7 +10918,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10953,7 +10953,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10994,7 +10994,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11020,7 +11020,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11051,7 +11051,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11074,7 +11074,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11102,7 +11102,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11125,7 +11125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11153,7 +11153,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11169,7 +11169,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11191,7 +11191,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11217,7 +11217,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11248,7 +11248,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11276,7 +11276,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11310,7 +11310,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
 // lb:1, ub:32
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11336,7 +11336,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11367,7 +11367,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11402,7 +11402,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11443,7 +11443,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11469,7 +11469,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11500,7 +11500,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11531,7 +11531,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11567,7 +11567,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11602,7 +11602,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11642,7 +11642,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11673,7 +11673,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11709,7 +11709,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
 // lb:1, ub:2048
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11735,7 +11735,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11766,7 +11766,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11801,7 +11801,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11842,7 +11842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11868,7 +11868,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11899,7 +11899,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11936,7 +11936,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11978,7 +11978,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12013,7 +12013,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12053,7 +12053,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12088,7 +12088,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12128,7 +12128,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12159,7 +12159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12195,7 +12195,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12230,7 +12230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12271,7 +12271,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
 // lb:1, ub:32
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12297,7 +12297,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12328,7 +12328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
   LIBLTE_S1AP_CSG_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12348,7 +12348,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CSG_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12373,7 +12373,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12404,7 +12404,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12440,7 +12440,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12463,7 +12463,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12491,7 +12491,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12522,7 +12522,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12559,7 +12559,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12576,7 +12576,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -12593,7 +12593,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -12602,7 +12602,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12645,7 +12645,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12671,7 +12671,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12702,7 +12702,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
   LIBLTE_S1AP_GUMMEI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12741,7 +12741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GUMMEI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12785,7 +12785,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12818,7 +12818,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12856,7 +12856,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12887,7 +12887,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12922,7 +12922,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12937,7 +12937,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12957,7 +12957,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12996,7 +12996,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13040,7 +13040,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
   LIBLTE_S1AP_S_TMSI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13075,7 +13075,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_S_TMSI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13116,7 +13116,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13142,7 +13142,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13174,7 +13174,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13200,7 +13200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13231,7 +13231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13280,7 +13280,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13334,7 +13334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13375,7 +13375,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13421,7 +13421,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13454,7 +13454,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13492,7 +13492,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13538,7 +13538,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13590,7 +13590,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13616,7 +13616,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13648,7 +13648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13674,7 +13674,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13705,7 +13705,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13736,7 +13736,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13773,7 +13773,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13799,7 +13799,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13831,7 +13831,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
   LIBLTE_S1AP_ECGILIST_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13857,7 +13857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ECGILIST_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13888,7 +13888,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13923,7 +13923,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13963,7 +13963,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14002,7 +14002,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14047,7 +14047,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
   LIBLTE_S1AP_E_RABLIST_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14064,7 +14064,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -14081,7 +14081,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -14090,7 +14090,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABLIST_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14133,7 +14133,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14159,7 +14159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14190,7 +14190,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14208,7 +14208,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14231,7 +14231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14264,7 +14264,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14303,7 +14303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14334,7 +14334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14370,7 +14370,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14407,7 +14407,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14450,7 +14450,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14476,7 +14476,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14507,7 +14507,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14538,7 +14538,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14574,7 +14574,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14609,7 +14609,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14649,7 +14649,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
   LIBLTE_S1AP_TARGETID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14686,7 +14686,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TARGETID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14728,7 +14728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14765,7 +14765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14807,7 +14807,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14845,7 +14845,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14889,7 +14889,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14915,7 +14915,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14946,7 +14946,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
   LIBLTE_S1AP_CELLTYPE_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14977,7 +14977,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLTYPE_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15014,7 +15014,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15040,7 +15040,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15072,7 +15072,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15098,7 +15098,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15129,7 +15129,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15171,7 +15171,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15218,7 +15218,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15257,7 +15257,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15301,7 +15301,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15339,7 +15339,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15383,7 +15383,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15409,7 +15409,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15440,7 +15440,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15475,7 +15475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15515,7 +15515,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15546,7 +15546,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15583,7 +15583,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15600,7 +15600,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -15617,7 +15617,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -15626,7 +15626,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15669,7 +15669,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15695,7 +15695,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15727,7 +15727,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15753,7 +15753,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15784,7 +15784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15843,7 +15843,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15907,7 +15907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15944,7 +15944,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15986,7 +15986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16020,7 +16020,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16060,7 +16060,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16086,7 +16086,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16117,7 +16117,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16140,7 +16140,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16169,7 +16169,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16195,7 +16195,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16226,7 +16226,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16279,7 +16279,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16337,7 +16337,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16372,7 +16372,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16412,7 +16412,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16461,7 +16461,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16515,7 +16515,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
   LIBLTE_S1AP_MDTMODE_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16548,7 +16548,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MDTMODE_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16586,7 +16586,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16639,7 +16639,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16698,7 +16698,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16724,7 +16724,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16755,7 +16755,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16794,7 +16794,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16839,7 +16839,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16865,7 +16865,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16896,7 +16896,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16933,7 +16933,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16975,7 +16975,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17006,7 +17006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17042,7 +17042,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17085,7 +17085,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17133,7 +17133,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17170,7 +17170,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17212,7 +17212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
   LIBLTE_S1AP_SONINFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17245,7 +17245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SONINFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17283,7 +17283,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17322,7 +17322,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17366,7 +17366,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17389,7 +17389,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17417,7 +17417,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17446,7 +17446,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17481,7 +17481,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17507,7 +17507,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17538,7 +17538,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17597,7 +17597,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17661,7 +17661,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17704,7 +17704,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17752,7 +17752,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17819,7 +17819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17891,7 +17891,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17926,7 +17926,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17966,7 +17966,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18005,7 +18005,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18049,7 +18049,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18088,7 +18088,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18132,7 +18132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18179,7 +18179,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18231,7 +18231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18270,7 +18270,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18314,7 +18314,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18353,7 +18353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18397,7 +18397,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18428,7 +18428,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18464,7 +18464,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18495,7 +18495,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18531,7 +18531,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18581,7 +18581,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18636,7 +18636,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18675,7 +18675,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18719,7 +18719,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_TAIITEM_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18750,7 +18750,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAIITEM_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18787,7 +18787,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18804,7 +18804,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -18821,7 +18821,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -18830,7 +18830,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18873,7 +18873,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18890,7 +18890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -18907,7 +18907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -18916,7 +18916,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18958,7 +18958,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18982,7 +18982,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19011,7 +19011,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
   LIBLTE_S1AP_RESETTYPE_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19044,7 +19044,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_RESETTYPE_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19083,7 +19083,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19100,7 +19100,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19117,7 +19117,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19126,7 +19126,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19169,7 +19169,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19186,7 +19186,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19203,7 +19203,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19212,7 +19212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19255,7 +19255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19272,7 +19272,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19289,7 +19289,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19298,7 +19298,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19341,7 +19341,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19358,7 +19358,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19375,7 +19375,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19384,7 +19384,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19427,7 +19427,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19444,7 +19444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19461,7 +19461,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19470,7 +19470,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19513,7 +19513,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19530,7 +19530,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19547,7 +19547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19556,7 +19556,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19599,7 +19599,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19616,7 +19616,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19633,7 +19633,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19642,7 +19642,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19685,7 +19685,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19702,7 +19702,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19719,7 +19719,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19728,7 +19728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19771,7 +19771,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19788,7 +19788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19805,7 +19805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19814,7 +19814,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19857,7 +19857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19874,7 +19874,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19891,7 +19891,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19900,7 +19900,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19943,7 +19943,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19960,7 +19960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -19977,7 +19977,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -19986,7 +19986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20029,7 +20029,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20046,7 +20046,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -20063,7 +20063,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -20072,7 +20072,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20115,7 +20115,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
   LIBLTE_S1AP_TAILIST_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20132,7 +20132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -20149,7 +20149,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -20158,7 +20158,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_TAILIST_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20201,7 +20201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20218,7 +20218,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
@@ -20235,7 +20235,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
     err = LIBLTE_SUCCESS;
@@ -20244,7 +20244,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20286,7 +20286,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20308,7 +20308,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20316,7 +20316,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20354,7 +20354,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20376,7 +20376,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20384,7 +20384,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20422,7 +20422,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20444,7 +20444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20452,7 +20452,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20490,7 +20490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20512,7 +20512,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20520,7 +20520,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20558,7 +20558,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20580,7 +20580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20588,7 +20588,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20626,7 +20626,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20648,7 +20648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20656,7 +20656,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20694,7 +20694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20716,7 +20716,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20724,7 +20724,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20762,7 +20762,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20784,7 +20784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20792,7 +20792,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20830,7 +20830,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20852,7 +20852,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20860,7 +20860,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20898,7 +20898,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20920,7 +20920,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20928,7 +20928,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20966,7 +20966,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20988,7 +20988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20996,7 +20996,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21034,7 +21034,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21056,7 +21056,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21064,7 +21064,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21102,7 +21102,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21124,7 +21124,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21132,7 +21132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21170,7 +21170,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21192,7 +21192,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21200,7 +21200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21238,7 +21238,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21260,7 +21260,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21268,7 +21268,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21306,7 +21306,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21328,7 +21328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21336,7 +21336,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21374,7 +21374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21396,7 +21396,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21404,7 +21404,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21442,7 +21442,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21464,7 +21464,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21472,7 +21472,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21510,7 +21510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21532,7 +21532,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21540,7 +21540,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21578,7 +21578,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21600,7 +21600,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21608,7 +21608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21646,7 +21646,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21668,7 +21668,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21676,7 +21676,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21714,7 +21714,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21736,7 +21736,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21744,7 +21744,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21782,7 +21782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21804,7 +21804,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21812,7 +21812,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21850,7 +21850,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21872,7 +21872,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21880,7 +21880,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21918,7 +21918,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21940,7 +21940,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21948,7 +21948,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21986,7 +21986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22008,7 +22008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22016,7 +22016,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22054,7 +22054,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22076,7 +22076,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22084,7 +22084,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22122,7 +22122,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22144,7 +22144,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22152,7 +22152,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22190,7 +22190,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22212,7 +22212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22220,7 +22220,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22258,7 +22258,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22280,7 +22280,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22288,7 +22288,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22326,7 +22326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22348,7 +22348,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22356,7 +22356,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22394,7 +22394,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22416,7 +22416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22424,7 +22424,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22462,7 +22462,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22484,7 +22484,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22492,7 +22492,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22530,7 +22530,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22552,7 +22552,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22560,7 +22560,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22598,7 +22598,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22620,7 +22620,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22628,7 +22628,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22666,7 +22666,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22688,7 +22688,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22696,7 +22696,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22734,7 +22734,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22756,7 +22756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22764,7 +22764,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22802,7 +22802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22824,7 +22824,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22832,7 +22832,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22870,7 +22870,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22892,7 +22892,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22900,7 +22900,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22938,7 +22938,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22960,7 +22960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22968,7 +22968,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23006,7 +23006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23028,7 +23028,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23036,7 +23036,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23074,7 +23074,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23096,7 +23096,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23104,7 +23104,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23142,7 +23142,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23164,7 +23164,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23172,7 +23172,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23210,7 +23210,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23232,7 +23232,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23240,7 +23240,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23278,7 +23278,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23300,7 +23300,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23308,7 +23308,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23346,7 +23346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23368,7 +23368,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23376,7 +23376,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23414,7 +23414,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23436,7 +23436,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23444,7 +23444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23482,7 +23482,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23504,7 +23504,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23512,7 +23512,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23550,7 +23550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23572,7 +23572,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23580,7 +23580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23618,7 +23618,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23640,7 +23640,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23648,7 +23648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23686,7 +23686,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23708,7 +23708,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23716,7 +23716,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23754,7 +23754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23776,7 +23776,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ex
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23784,7 +23784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ex
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23822,7 +23822,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23844,7 +23844,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23852,7 +23852,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23890,7 +23890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23912,7 +23912,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23920,7 +23920,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23958,7 +23958,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23980,7 +23980,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23988,7 +23988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24026,7 +24026,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24048,7 +24048,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24056,7 +24056,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24094,7 +24094,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24116,7 +24116,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24124,7 +24124,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24162,7 +24162,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24184,7 +24184,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24192,7 +24192,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24230,7 +24230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24252,7 +24252,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24260,7 +24260,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24298,7 +24298,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24320,7 +24320,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24328,7 +24328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24366,7 +24366,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24390,7 +24390,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MobilityInformation
     if(msg->MobilityInformation_present) {
@@ -24407,7 +24407,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24417,7 +24417,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24469,7 +24469,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24491,7 +24491,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABInformationListItem
     tmp_msg.reset();
@@ -24507,7 +24507,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -24516,7 +24516,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24566,7 +24566,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24592,7 +24592,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Time_UE_StayedInCell_EnhancedGranularity
     if(msg->Time_UE_StayedInCell_EnhancedGranularity_present) {
@@ -24609,7 +24609,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24628,7 +24628,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24638,7 +24638,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24697,7 +24697,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24721,7 +24721,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Time_Synchronization_Info
     if(msg->Time_Synchronization_Info_present) {
@@ -24738,7 +24738,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24748,7 +24748,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24800,7 +24800,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24828,7 +24828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - ULCOUNTValueExtended
     if(msg->ULCOUNTValueExtended_present) {
@@ -24845,7 +24845,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24864,7 +24864,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24883,7 +24883,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -24893,7 +24893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24959,7 +24959,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24981,7 +24981,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABItem
     tmp_msg.reset();
@@ -24997,7 +24997,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -25006,7 +25006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25056,7 +25056,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25080,7 +25080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - SignallingBasedMDTPLMNList
     if(msg->SignallingBasedMDTPLMNList_present) {
@@ -25097,7 +25097,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25107,7 +25107,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25159,7 +25159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25183,7 +25183,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - eNBX2ExtendedTransportLayerAddresses
     if(msg->eNBX2ExtendedTransportLayerAddresses_present) {
@@ -25200,7 +25200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25210,7 +25210,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25262,7 +25262,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25284,7 +25284,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Bearers_SubjectToStatusTransfer_Item
     tmp_msg.reset();
@@ -25300,7 +25300,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -25309,7 +25309,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25359,7 +25359,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25389,7 +25389,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - M3Configuration
     if(msg->M3Configuration_present) {
@@ -25406,7 +25406,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25425,7 +25425,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25444,7 +25444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25463,7 +25463,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25473,7 +25473,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25543,7 +25543,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25567,7 +25567,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - x2TNLConfigurationInfo
     if(msg->x2TNLConfigurationInfo_present) {
@@ -25584,7 +25584,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25594,7 +25594,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25645,7 +25645,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25669,7 +25669,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MDTConfiguration
     if(msg->MDTConfiguration_present) {
@@ -25686,7 +25686,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25696,7 +25696,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25748,7 +25748,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25786,7 +25786,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -25802,7 +25802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -25819,7 +25819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - HandoverType
@@ -25836,7 +25836,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -25853,7 +25853,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TargetID
@@ -25870,7 +25870,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Direct_Forwarding_Path_Availability
@@ -25888,7 +25888,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25907,7 +25907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25925,7 +25925,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Source_ToTarget_TransparentContainer_Secondary
@@ -25943,7 +25943,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25962,7 +25962,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -25981,7 +25981,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26000,7 +26000,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26019,7 +26019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26038,7 +26038,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26048,7 +26048,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26177,7 +26177,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26199,7 +26199,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26207,7 +26207,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26245,7 +26245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26269,7 +26269,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -26285,7 +26285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -26302,7 +26302,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -26319,7 +26319,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -26337,7 +26337,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26347,7 +26347,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26414,7 +26414,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26438,7 +26438,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Data_Forwarding_Not_Possible
     if(msg->Data_Forwarding_Not_Possible_present) {
@@ -26455,7 +26455,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26465,7 +26465,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26517,7 +26517,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26539,7 +26539,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26547,7 +26547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26585,7 +26585,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26607,7 +26607,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26615,7 +26615,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26653,7 +26653,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26677,7 +26677,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -26693,7 +26693,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -26710,7 +26710,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -26728,7 +26728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26738,7 +26738,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26800,7 +26800,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26826,7 +26826,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -26842,7 +26842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -26859,7 +26859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRAN_CGI
@@ -26876,7 +26876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAI
@@ -26893,7 +26893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Tunnel_Information_for_BBF
@@ -26911,7 +26911,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26930,7 +26930,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -26940,7 +26940,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27019,7 +27019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27041,7 +27041,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27049,7 +27049,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27087,7 +27087,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27109,7 +27109,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27117,7 +27117,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27155,7 +27155,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27179,7 +27179,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -27195,7 +27195,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -27212,7 +27212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -27229,7 +27229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -27247,7 +27247,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -27257,7 +27257,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27324,7 +27324,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27346,7 +27346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -27362,7 +27362,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -27379,7 +27379,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -27396,7 +27396,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -27405,7 +27405,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27465,7 +27465,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27489,7 +27489,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -27505,7 +27505,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -27522,7 +27522,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -27540,7 +27540,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -27550,7 +27550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27612,7 +27612,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27638,7 +27638,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Correlation_ID
     if(msg->Correlation_ID_present) {
@@ -27655,7 +27655,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -27674,7 +27674,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -27684,7 +27684,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27743,7 +27743,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27765,7 +27765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27773,7 +27773,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27811,7 +27811,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27835,7 +27835,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - TransportInformation
     if(msg->TransportInformation_present) {
@@ -27852,7 +27852,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -27862,7 +27862,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27914,7 +27914,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27936,7 +27936,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27944,7 +27944,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27982,7 +27982,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28008,7 +28008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -28024,7 +28024,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -28041,7 +28041,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - uEaggregateMaximumBitrate
@@ -28059,7 +28059,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28077,7 +28077,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NAS_PDU
@@ -28095,7 +28095,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28105,7 +28105,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28179,7 +28179,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28201,7 +28201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28209,7 +28209,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28247,7 +28247,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28271,7 +28271,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -28287,7 +28287,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -28304,7 +28304,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABReleasedList
@@ -28321,7 +28321,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UserLocationInformation
@@ -28339,7 +28339,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28349,7 +28349,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28416,7 +28416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28442,7 +28442,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Correlation_ID
     if(msg->Correlation_ID_present) {
@@ -28459,7 +28459,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28478,7 +28478,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28488,7 +28488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28547,7 +28547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28569,7 +28569,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28577,7 +28577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28615,7 +28615,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28639,7 +28639,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -28655,7 +28655,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -28672,7 +28672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -28689,7 +28689,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -28707,7 +28707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28717,7 +28717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28784,7 +28784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28806,7 +28806,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28814,7 +28814,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28852,7 +28852,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28876,7 +28876,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -28892,7 +28892,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -28909,7 +28909,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -28926,7 +28926,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - GWContextReleaseIndication
@@ -28944,7 +28944,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -28954,7 +28954,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29021,7 +29021,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29043,7 +29043,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - UE_S1AP_IDs
     tmp_msg.reset();
@@ -29059,7 +29059,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -29076,7 +29076,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -29085,7 +29085,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29140,7 +29140,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29166,7 +29166,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -29182,7 +29182,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -29199,7 +29199,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -29217,7 +29217,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29236,7 +29236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29246,7 +29246,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29315,7 +29315,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29353,7 +29353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -29369,7 +29369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -29386,7 +29386,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SecurityKey
@@ -29404,7 +29404,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29423,7 +29423,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29442,7 +29442,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29461,7 +29461,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29480,7 +29480,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29499,7 +29499,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29518,7 +29518,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29537,7 +29537,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29547,7 +29547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29657,7 +29657,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29681,7 +29681,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -29697,7 +29697,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -29714,7 +29714,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -29732,7 +29732,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29742,7 +29742,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29804,7 +29804,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29828,7 +29828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -29844,7 +29844,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -29861,7 +29861,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -29878,7 +29878,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -29896,7 +29896,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -29906,7 +29906,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29973,7 +29973,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29997,7 +29997,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -30013,7 +30013,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -30030,7 +30030,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UERadioCapability
@@ -30048,7 +30048,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30058,7 +30058,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30120,7 +30120,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30144,7 +30144,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -30160,7 +30160,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -30177,7 +30177,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - VoiceSupportMatchIndicator
@@ -30194,7 +30194,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -30212,7 +30212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30222,7 +30222,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30289,7 +30289,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30315,7 +30315,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -30331,7 +30331,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -30348,7 +30348,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NAS_PDU
@@ -30365,7 +30365,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - HandoverRestrictionList
@@ -30383,7 +30383,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30402,7 +30402,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30412,7 +30412,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30486,7 +30486,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30528,7 +30528,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
@@ -30544,7 +30544,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NAS_PDU
@@ -30561,7 +30561,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAI
@@ -30578,7 +30578,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRAN_CGI
@@ -30595,7 +30595,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - RRC_Establishment_Cause
@@ -30612,7 +30612,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - S_TMSI
@@ -30630,7 +30630,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30649,7 +30649,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30668,7 +30668,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30687,7 +30687,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30706,7 +30706,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30725,7 +30725,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30744,7 +30744,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30763,7 +30763,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30782,7 +30782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30801,7 +30801,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -30811,7 +30811,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30951,7 +30951,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30979,7 +30979,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -30995,7 +30995,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -31012,7 +31012,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NAS_PDU
@@ -31029,7 +31029,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRAN_CGI
@@ -31046,7 +31046,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAI
@@ -31063,7 +31063,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - GW_TransportLayerAddress
@@ -31081,7 +31081,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31100,7 +31100,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31119,7 +31119,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31129,7 +31129,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31220,7 +31220,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31242,7 +31242,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -31258,7 +31258,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -31275,7 +31275,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NAS_PDU
@@ -31292,7 +31292,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -31309,7 +31309,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -31318,7 +31318,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31383,7 +31383,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31405,7 +31405,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionItem
     tmp_msg.reset();
@@ -31421,7 +31421,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -31430,7 +31430,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31480,7 +31480,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31502,7 +31502,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionItem
     tmp_msg.reset();
@@ -31518,7 +31518,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -31527,7 +31527,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31577,7 +31577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31607,7 +31607,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     if(msg->MME_UE_S1AP_ID_present) {
@@ -31624,7 +31624,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31643,7 +31643,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31662,7 +31662,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31681,7 +31681,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31691,7 +31691,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31764,7 +31764,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31790,7 +31790,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Global_ENB_ID
     tmp_msg.reset();
@@ -31806,7 +31806,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNBname
@@ -31824,7 +31824,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31842,7 +31842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - DefaultPagingDRX
@@ -31859,7 +31859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CSG_IdList
@@ -31877,7 +31877,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -31887,7 +31887,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31961,7 +31961,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31989,7 +31989,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MMEname
     if(msg->MMEname_present) {
@@ -32006,7 +32006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32024,7 +32024,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - RelativeMMECapacity
@@ -32041,7 +32041,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - MMERelaySupportIndicator
@@ -32059,7 +32059,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32078,7 +32078,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32088,7 +32088,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32164,7 +32164,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32190,7 +32190,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
@@ -32206,7 +32206,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TimeToWait
@@ -32224,7 +32224,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32243,7 +32243,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32253,7 +32253,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32317,7 +32317,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32347,7 +32347,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - eNBname
     if(msg->eNBname_present) {
@@ -32364,7 +32364,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32383,7 +32383,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32402,7 +32402,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32421,7 +32421,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32431,7 +32431,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32504,7 +32504,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32528,7 +32528,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
@@ -32545,7 +32545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32555,7 +32555,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32607,7 +32607,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32633,7 +32633,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
@@ -32649,7 +32649,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TimeToWait
@@ -32667,7 +32667,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32686,7 +32686,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32696,7 +32696,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32760,7 +32760,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32788,7 +32788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MMEname
     if(msg->MMEname_present) {
@@ -32805,7 +32805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32824,7 +32824,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32843,7 +32843,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32853,7 +32853,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32919,7 +32919,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32943,7 +32943,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
@@ -32960,7 +32960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -32970,7 +32970,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33022,7 +33022,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33048,7 +33048,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
@@ -33064,7 +33064,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TimeToWait
@@ -33082,7 +33082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -33101,7 +33101,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -33111,7 +33111,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33175,7 +33175,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33205,7 +33205,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -33221,7 +33221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -33238,7 +33238,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - cdma2000RATType
@@ -33255,7 +33255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - cdma2000SectorID
@@ -33272,7 +33272,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - cdma2000HORequiredIndication
@@ -33290,7 +33290,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -33309,7 +33309,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -33328,7 +33328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -33346,7 +33346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRANRoundTripDelayEstimationInfo
@@ -33364,7 +33364,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -33374,7 +33374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33472,7 +33472,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33494,7 +33494,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -33510,7 +33510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -33527,7 +33527,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UERadioCapability
@@ -33544,7 +33544,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -33553,7 +33553,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33613,7 +33613,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33635,7 +33635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -33651,7 +33651,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -33668,7 +33668,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_StatusTransfer_TransparentContainer
@@ -33685,7 +33685,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -33694,7 +33694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33754,7 +33754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33776,7 +33776,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -33792,7 +33792,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -33809,7 +33809,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_StatusTransfer_TransparentContainer
@@ -33826,7 +33826,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -33835,7 +33835,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33895,7 +33895,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33917,7 +33917,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -33933,7 +33933,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -33950,7 +33950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TraceActivation
@@ -33967,7 +33967,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -33976,7 +33976,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34036,7 +34036,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34058,7 +34058,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -34074,7 +34074,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -34091,7 +34091,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_UTRAN_Trace_ID
@@ -34108,7 +34108,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -34125,7 +34125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -34134,7 +34134,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34199,7 +34199,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34221,7 +34221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -34237,7 +34237,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -34254,7 +34254,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_UTRAN_Trace_ID
@@ -34271,7 +34271,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -34280,7 +34280,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34340,7 +34340,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34364,7 +34364,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -34380,7 +34380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -34397,7 +34397,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_UTRAN_Trace_ID
@@ -34414,7 +34414,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRAN_CGI
@@ -34431,7 +34431,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TraceCollectionEntityIPAddress
@@ -34448,7 +34448,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - PrivacyIndicator
@@ -34466,7 +34466,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -34476,7 +34476,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34553,7 +34553,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34575,7 +34575,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -34591,7 +34591,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -34608,7 +34608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - RequestType
@@ -34625,7 +34625,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -34634,7 +34634,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34694,7 +34694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34716,7 +34716,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -34732,7 +34732,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -34749,7 +34749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -34766,7 +34766,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -34775,7 +34775,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34835,7 +34835,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34857,7 +34857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -34873,7 +34873,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -34890,7 +34890,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRAN_CGI
@@ -34907,7 +34907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAI
@@ -34924,7 +34924,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - RequestType
@@ -34941,7 +34941,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -34950,7 +34950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35020,7 +35020,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35046,7 +35046,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - OverloadResponse
     tmp_msg.reset();
@@ -35062,7 +35062,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - GUMMEIList
@@ -35080,7 +35080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35099,7 +35099,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35109,7 +35109,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35173,7 +35173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35197,7 +35197,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - GUMMEIList
     if(msg->GUMMEIList_present) {
@@ -35214,7 +35214,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35224,7 +35224,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35276,7 +35276,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35312,7 +35312,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
@@ -35328,7 +35328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SerialNumber
@@ -35345,7 +35345,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - WarningAreaList
@@ -35363,7 +35363,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35381,7 +35381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - ExtendedRepetitionPeriod
@@ -35399,7 +35399,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35417,7 +35417,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - WarningType
@@ -35435,7 +35435,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35454,7 +35454,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35473,7 +35473,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35492,7 +35492,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35511,7 +35511,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35521,7 +35521,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35635,7 +35635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35661,7 +35661,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
@@ -35677,7 +35677,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SerialNumber
@@ -35694,7 +35694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - BroadcastCompletedAreaList
@@ -35712,7 +35712,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35731,7 +35731,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35741,7 +35741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35810,7 +35810,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35832,7 +35832,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Inter_SystemInformationTransferTypeMDT
     tmp_msg.reset();
@@ -35848,7 +35848,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -35857,7 +35857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35907,7 +35907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35931,7 +35931,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - SONConfigurationTransferECT
     if(msg->SONConfigurationTransferECT_present) {
@@ -35948,7 +35948,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -35958,7 +35958,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36010,7 +36010,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36034,7 +36034,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - SONConfigurationTransferMCT
     if(msg->SONConfigurationTransferMCT_present) {
@@ -36051,7 +36051,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -36061,7 +36061,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36113,7 +36113,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36135,7 +36135,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -36143,7 +36143,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36181,7 +36181,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36207,7 +36207,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
@@ -36223,7 +36223,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SerialNumber
@@ -36240,7 +36240,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - WarningAreaList
@@ -36258,7 +36258,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -36277,7 +36277,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -36287,7 +36287,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36356,7 +36356,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36382,7 +36382,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
@@ -36398,7 +36398,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SerialNumber
@@ -36415,7 +36415,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - BroadcastCancelledAreaList
@@ -36433,7 +36433,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -36452,7 +36452,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -36462,7 +36462,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36531,7 +36531,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36555,7 +36555,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - ECGIListForRestart
     tmp_msg.reset();
@@ -36571,7 +36571,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Global_ENB_ID
@@ -36588,7 +36588,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAIListForRestart
@@ -36605,7 +36605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EmergencyAreaIDListForRestart
@@ -36623,7 +36623,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -36633,7 +36633,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36700,7 +36700,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36722,7 +36722,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -36738,7 +36738,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -36755,7 +36755,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Routing_ID
@@ -36772,7 +36772,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - LPPa_PDU
@@ -36789,7 +36789,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -36798,7 +36798,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36863,7 +36863,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36885,7 +36885,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -36901,7 +36901,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -36918,7 +36918,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Routing_ID
@@ -36935,7 +36935,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - LPPa_PDU
@@ -36952,7 +36952,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -36961,7 +36961,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37026,7 +37026,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37048,7 +37048,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Routing_ID
     tmp_msg.reset();
@@ -37064,7 +37064,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - LPPa_PDU
@@ -37081,7 +37081,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37090,7 +37090,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37145,7 +37145,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37167,7 +37167,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Routing_ID
     tmp_msg.reset();
@@ -37183,7 +37183,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - LPPa_PDU
@@ -37200,7 +37200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37209,7 +37209,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37264,7 +37264,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37286,7 +37286,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Inter_SystemInformationTransferTypeEDT
     tmp_msg.reset();
@@ -37302,7 +37302,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37311,7 +37311,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37361,7 +37361,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37383,7 +37383,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABDataForwardingItem
     tmp_msg.reset();
@@ -37399,7 +37399,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37408,7 +37408,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37458,7 +37458,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37480,7 +37480,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemHOReq
     tmp_msg.reset();
@@ -37496,7 +37496,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37505,7 +37505,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37555,7 +37555,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37577,7 +37577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABAdmittedItem
     tmp_msg.reset();
@@ -37593,7 +37593,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37602,7 +37602,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37652,7 +37652,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37674,7 +37674,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABFailedtoSetupItemHOReqAck
     tmp_msg.reset();
@@ -37690,7 +37690,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37699,7 +37699,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37749,7 +37749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37771,7 +37771,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABToBeSwitchedDLItem
     tmp_msg.reset();
@@ -37787,7 +37787,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37796,7 +37796,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37846,7 +37846,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37868,7 +37868,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABToBeSwitchedULItem
     tmp_msg.reset();
@@ -37884,7 +37884,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37893,7 +37893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37943,7 +37943,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37965,7 +37965,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemBearerSUReq
     tmp_msg.reset();
@@ -37981,7 +37981,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -37990,7 +37990,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38040,7 +38040,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38062,7 +38062,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABSetupItemBearerSURes
     tmp_msg.reset();
@@ -38078,7 +38078,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38087,7 +38087,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38137,7 +38137,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38159,7 +38159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABToBeModifiedItemBearerModReq
     tmp_msg.reset();
@@ -38175,7 +38175,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38184,7 +38184,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38234,7 +38234,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38256,7 +38256,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABModifyItemBearerModRes
     tmp_msg.reset();
@@ -38272,7 +38272,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38281,7 +38281,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38331,7 +38331,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38353,7 +38353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABReleaseItemBearerRelComp
     tmp_msg.reset();
@@ -38369,7 +38369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38378,7 +38378,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38428,7 +38428,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38450,7 +38450,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemCtxtSUReq
     tmp_msg.reset();
@@ -38466,7 +38466,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38475,7 +38475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38525,7 +38525,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38547,7 +38547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - E_RABSetupItemCtxtSURes
     tmp_msg.reset();
@@ -38563,7 +38563,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38572,7 +38572,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38622,7 +38622,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38644,7 +38644,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - TAIItem
     tmp_msg.reset();
@@ -38660,7 +38660,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38669,7 +38669,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38719,7 +38719,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38745,7 +38745,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionListResAck
     if(msg->UE_associatedLogicalS1_ConnectionListResAck_present) {
@@ -38762,7 +38762,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -38781,7 +38781,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -38791,7 +38791,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38850,7 +38850,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38872,7 +38872,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
@@ -38888,7 +38888,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - ResetType
@@ -38905,7 +38905,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -38914,7 +38914,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38969,7 +38969,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38995,7 +38995,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -39011,7 +39011,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -39028,7 +39028,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABSubjecttoDataForwardingList
@@ -39046,7 +39046,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39065,7 +39065,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39083,7 +39083,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - cdma2000PDU
@@ -39100,7 +39100,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -39109,7 +39109,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -39188,7 +39188,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39220,7 +39220,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -39236,7 +39236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -39253,7 +39253,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - HandoverType
@@ -39270,7 +39270,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NASSecurityParametersfromE_UTRAN
@@ -39288,7 +39288,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39307,7 +39307,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39326,7 +39326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39344,7 +39344,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Target_ToSource_TransparentContainer_Secondary
@@ -39362,7 +39362,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39381,7 +39381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39391,7 +39391,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -39490,7 +39490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39534,7 +39534,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -39550,7 +39550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - HandoverType
@@ -39567,7 +39567,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Cause
@@ -39584,7 +39584,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - uEaggregateMaximumBitrate
@@ -39601,7 +39601,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABToBeSetupListHOReq
@@ -39618,7 +39618,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - Source_ToTarget_TransparentContainer
@@ -39635,7 +39635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UESecurityCapabilities
@@ -39652,7 +39652,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - HandoverRestrictionList
@@ -39670,7 +39670,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39689,7 +39689,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39708,7 +39708,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39727,7 +39727,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39745,7 +39745,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - NASSecurityParameterstoE_UTRAN
@@ -39763,7 +39763,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39782,7 +39782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39801,7 +39801,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39820,7 +39820,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39839,7 +39839,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39858,7 +39858,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39877,7 +39877,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -39887,7 +39887,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40048,7 +40048,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40082,7 +40082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
@@ -40098,7 +40098,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABToBeSwitchedDLList
@@ -40115,7 +40115,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SourceMME_UE_S1AP_ID
@@ -40132,7 +40132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - EUTRAN_CGI
@@ -40149,7 +40149,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAI
@@ -40166,7 +40166,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UESecurityCapabilities
@@ -40183,7 +40183,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CSG_Id
@@ -40201,7 +40201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40220,7 +40220,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40239,7 +40239,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40258,7 +40258,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40277,7 +40277,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40296,7 +40296,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40306,7 +40306,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40423,7 +40423,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40457,7 +40457,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -40473,7 +40473,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -40490,7 +40490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - uEaggregateMaximumBitrate
@@ -40508,7 +40508,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40527,7 +40527,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40546,7 +40546,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40564,7 +40564,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CriticalityDiagnostics
@@ -40582,7 +40582,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40601,7 +40601,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40620,7 +40620,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40630,7 +40630,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40732,7 +40732,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40756,7 +40756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -40772,7 +40772,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -40789,7 +40789,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - uEaggregateMaximumBitrate
@@ -40807,7 +40807,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40825,7 +40825,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -40834,7 +40834,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40901,7 +40901,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40929,7 +40929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -40945,7 +40945,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -40962,7 +40962,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABSetupListBearerSURes
@@ -40980,7 +40980,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -40999,7 +40999,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41018,7 +41018,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41028,7 +41028,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41104,7 +41104,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41128,7 +41128,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -41144,7 +41144,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -41161,7 +41161,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - uEaggregateMaximumBitrate
@@ -41179,7 +41179,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41197,7 +41197,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -41206,7 +41206,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41273,7 +41273,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41301,7 +41301,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -41317,7 +41317,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -41334,7 +41334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABModifyListBearerModRes
@@ -41352,7 +41352,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41371,7 +41371,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41390,7 +41390,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41400,7 +41400,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41476,7 +41476,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41506,7 +41506,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -41522,7 +41522,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -41539,7 +41539,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABReleaseListBearerRelComp
@@ -41557,7 +41557,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41576,7 +41576,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41595,7 +41595,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41614,7 +41614,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41624,7 +41624,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41707,7 +41707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41755,7 +41755,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -41771,7 +41771,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -41788,7 +41788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - uEaggregateMaximumBitrate
@@ -41805,7 +41805,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABToBeSetupListCtxtSUReq
@@ -41822,7 +41822,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UESecurityCapabilities
@@ -41839,7 +41839,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - SecurityKey
@@ -41856,7 +41856,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TraceActivation
@@ -41874,7 +41874,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41893,7 +41893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41912,7 +41912,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41931,7 +41931,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41950,7 +41950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41969,7 +41969,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -41988,7 +41988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42007,7 +42007,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42026,7 +42026,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42045,7 +42045,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42064,7 +42064,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42083,7 +42083,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42102,7 +42102,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42112,7 +42112,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42277,7 +42277,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42303,7 +42303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -42319,7 +42319,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -42336,7 +42336,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABSetupListCtxtSURes
@@ -42353,7 +42353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABFailedToSetupListCtxtSURes
@@ -42371,7 +42371,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42390,7 +42390,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42400,7 +42400,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42474,7 +42474,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42502,7 +42502,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - UEIdentityIndexValue
     tmp_msg.reset();
@@ -42518,7 +42518,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - UEPagingID
@@ -42535,7 +42535,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - pagingDRX
@@ -42553,7 +42553,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42571,7 +42571,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - TAIList
@@ -42588,7 +42588,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CSG_IdList
@@ -42606,7 +42606,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42625,7 +42625,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42635,7 +42635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42721,7 +42721,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_PTR                                                    *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42751,7 +42751,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
 
     // Temp container for IEs
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BIT_PTR        tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
@@ -42767,7 +42767,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - eNB_UE_S1AP_ID
@@ -42784,7 +42784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABAdmittedList
@@ -42801,7 +42801,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - E_RABFailedToSetupListHOReqAck
@@ -42819,7 +42819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42837,7 +42837,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     // ProtocolIE - CSG_Id
@@ -42855,7 +42855,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42874,7 +42874,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42893,7 +42893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+      liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
       *ptr += tmp_msg.N_bits;
     }
 
@@ -42903,7 +42903,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequestacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_PTR                                                    *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42998,7 +42998,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
   uint32_t                      len,
   uint32_t                      ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM  crit,
-  uint8_t                     **ptr)
+  LIBLTE_BIT_PTR              *ptr)
 {
   liblte_value_2_bits(ie_id, ptr, 16); // ProtocolIE-ID
   liblte_value_2_bits(crit,  ptr, 2);  // Criticality
@@ -43018,7 +43018,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
-  uint8_t                     **ptr,
+  LIBLTE_BIT_PTR              *ptr,
   uint32_t                     *ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM *crit,
   uint32_t                     *len)
@@ -43044,7 +43044,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg,
-  uint8_t                             **ptr)
+  LIBLTE_BIT_PTR                      *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43052,7 +43052,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
      ptr                                      != NULL)
   { 
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_BIT_PTR tmp_ptr = tmp_msg.msg;
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_LOCATIONREPORTINGCONTROL) {
@@ -43279,7 +43279,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -43288,7 +43288,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_PTR                      *ptr,
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43576,7 +43576,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                               **ptr)
+  LIBLTE_BIT_PTR                        *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43584,7 +43584,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
      ptr                                      != NULL)
   { 
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_BIT_PTR tmp_ptr = tmp_msg.msg;
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_UNSUCCESSFULOUTCOME_CHOICE_S1SETUPFAILURE) {
@@ -43643,7 +43643,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -43652,7 +43652,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
-  uint8_t                               **ptr,
+  LIBLTE_BIT_PTR                        *ptr,
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43730,7 +43730,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                             **ptr)
+  LIBLTE_BIT_PTR                      *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43738,7 +43738,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
      ptr                                      != NULL)
   { 
     LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_BIT_PTR tmp_ptr = tmp_msg.msg;
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_HANDOVERREQUESTACKNOWLEDGE) {
@@ -43833,7 +43833,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
+    liblte_bits_copy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
     *ptr += tmp_msg.N_bits;
 
     err = LIBLTE_SUCCESS;
@@ -43842,7 +43842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_successfuloutcome(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_PTR                      *ptr,
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43969,13 +43969,12 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1ap_pdu(
   LIBLTE_BYTE_MSG_STRUCT      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  LIBLTE_BIT_MSG_STRUCT bit_msg;
 
   if(s1ap_pdu                                 != NULL &&
      msg                                      != NULL)
   {
-    uint8_t *p    = bit_msg.msg;
-    uint8_t **ptr = &p;
+    LIBLTE_BIT_PTR  p   = msg->msg;
+    LIBLTE_BIT_PTR *ptr = &p;
 
     // Extension
     liblte_value_2_bits(s1ap_pdu->ext?1:0, ptr, 1);
@@ -44000,9 +43999,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1ap_pdu(
     }
 
     liblte_align_up_zero(ptr, 8);
-    bit_msg.N_bits += (*ptr - bit_msg.msg);
+    msg->N_bytes = (*ptr - msg->msg)/8;
 
-    liblte_pack(&bit_msg, msg);
     err = LIBLTE_SUCCESS;
 
   }
@@ -44014,15 +44012,12 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1ap_pdu(
   LIBLTE_S1AP_S1AP_PDU_STRUCT *s1ap_pdu)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  LIBLTE_BIT_MSG_STRUCT bit_msg;
 
   if(s1ap_pdu                                 != NULL &&
      msg                                      != NULL)
   {
-    liblte_unpack(msg, &bit_msg);
-
-    uint8_t *p    = bit_msg.msg;
-    uint8_t **ptr = &p;
+    LIBLTE_BIT_PTR  p   = msg->msg;
+    LIBLTE_BIT_PTR *ptr = &p;
 
     // Extension
     s1ap_pdu->ext = liblte_bits_2_value(ptr, 1);
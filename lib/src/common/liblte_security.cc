@@ -572,7 +572,7 @@ LIBLTE_ERROR_ENUM liblte_security_128_eia2(uint8                 *key,
                                            uint8                 *mac)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             M[msg->N_bits*8+8+16];
+    uint8             M[(msg->N_bits+7)/8+8+16];
     aes_context       ctx;
     uint32            i;
     uint32            j;
@@ -616,27 +616,16 @@ LIBLTE_ERROR_ENUM liblte_security_128_eia2(uint8                 *key,
         }
 
         // Construct M
-        memset(M, 0, msg->N_bits*8+8+16);
+        memset(M, 0, (msg->N_bits+7)/8+8+16);
         M[0] = (count >> 24) & 0xFF;
         M[1] = (count >> 16) & 0xFF;
         M[2] = (count >> 8) & 0xFF;
         M[3] = count & 0xFF;
         M[4] = (bearer << 3) | (direction << 2);
-        for(i=0; i<msg->N_bits/8; i++)
-        {
-            M[8+i] = 0;
-            for(j=0; j<8; j++)
-            {
-                M[8+i] |= msg->msg[i*8+j] << (7-j);
-            }
-        }
+        memcpy(&M[8], msg->msg, (msg->N_bits+7)/8);
         if((msg->N_bits % 8) != 0)
         {
-            M[8+i] = 0;
-            for(j=0; j<msg->N_bits % 8; j++)
-            {
-                M[8+i] |= msg->msg[i*8+j] << (7-j);
-            }
+            M[8+msg->N_bits/8] &= 0xFF << (8 - msg->N_bits%8);
         }
 
         // MAC generation
@@ -37,7 +37,9 @@ namespace srslte{
 
 log_filter::log_filter()
 {
-  do_tti = false; 
+  logger_h   = NULL;
+  do_tti     = false; 
+  service_id = -1;
 }
 
 log_filter::log_filter(std::string layer, logger *logger_, bool tti)
@@ -50,6 +52,32 @@ void log_filter::init(std::string layer, logger *logger_, bool tti)
   service_name  = layer;
   logger_h      = logger_;
   do_tti        = tti;
+  service_id    = (logger_h && logger_h->is_deferred()) ? logger_h->register_service(layer) : -1;
+}
+
+// In deferred mode the logger formats the message in its own thread
+void log_filter::all_log(srslte::LOG_LEVEL_ENUM level,
+                         uint32_t               tti,
+                         const char            *message,
+                         va_list                args,
+                         bool                   has_hex,
+                         uint8_t               *hex,
+                         int                    size)
+{
+  if (service_id >= 0) {
+    int hex_len = (has_hex && hex_limit > 0) ? (size > hex_limit ? hex_limit : size) : 0;
+    logger_h->log_deferred(service_id, level, tti, do_tti, message, args, has_hex, hex, hex_len);
+    return;
+  }
+  char *args_msg;
+  if(vasprintf(&args_msg, message, args) > 0) {
+    if (has_hex) {
+      all_log(level, tti, args_msg, hex, size);
+    } else {
+      all_log(level, tti, args_msg);
+    }
+    free(args_msg);
+  }
 }
 
 void log_filter::all_log(srslte::LOG_LEVEL_ENUM level,
@@ -100,27 +128,6 @@ void log_filter::all_log(srslte::LOG_LEVEL_ENUM level,
   }
 }
 
-void log_filter::all_log_line(srslte::LOG_LEVEL_ENUM level,
-                              uint32_t               tti,
-                              std::string            file,
-                              int                    line,
-                              char                  *msg)
-{
-  if(logger_h) {
-    std::stringstream ss;
-
-    ss << now_time() << " ";
-    ss << "[" <<get_service_name() << "] ";
-    ss << log_level_text[level] << " ";
-    if(do_tti)
-      ss << "[" << std::setfill('0') << std::setw(5) << tti << "] ";
-    ss << msg;
-
-    str_ptr s_ptr(new std::string(ss.str()));
-    logger_h->log(s_ptr);
-  }
-}
-
 void log_filter::console(std::string message, ...) {
   char     *args_msg;
   va_list   args;
@@ -133,143 +140,107 @@ void log_filter::console(std::string message, ...) {
 
 void log_filter::error(std::string message, ...) {
   if (level >= LOG_LEVEL_ERROR) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_ERROR, tti, args_msg);
+    all_log(LOG_LEVEL_ERROR, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 void log_filter::warning(std::string message, ...) {
   if (level >= LOG_LEVEL_WARNING) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_WARNING, tti, args_msg);
+    all_log(LOG_LEVEL_WARNING, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 void log_filter::info(std::string message, ...) {
   if (level >= LOG_LEVEL_INFO) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_INFO, tti, args_msg);
+    all_log(LOG_LEVEL_INFO, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 void log_filter::debug(std::string message, ...) {
   if (level >= LOG_LEVEL_DEBUG) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_DEBUG, tti, args_msg);
+    all_log(LOG_LEVEL_DEBUG, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 
 void log_filter::error_hex(uint8_t *hex, int size, std::string message, ...) {
   if (level >= LOG_LEVEL_ERROR) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_ERROR, tti, args_msg, hex, size);
+    all_log(LOG_LEVEL_ERROR, tti, message.c_str(), args, true, hex, size);
     va_end(args);
-    free(args_msg);
   }
 }
 void log_filter::warning_hex(uint8_t *hex, int size, std::string message, ...) {
   if (level >= LOG_LEVEL_WARNING) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_WARNING, tti, args_msg, hex, size);
+    all_log(LOG_LEVEL_WARNING, tti, message.c_str(), args, true, hex, size);
     va_end(args);
-    free(args_msg);
   }
 }
 void log_filter::info_hex(uint8_t *hex, int size, std::string message, ...) {
   if (level >= LOG_LEVEL_INFO) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_INFO, tti, args_msg, hex, size);
+    all_log(LOG_LEVEL_INFO, tti, message.c_str(), args, true, hex, size);
     va_end(args);
-    free(args_msg);
   }
 }
 void log_filter::debug_hex(uint8_t *hex, int size, std::string message, ...) {
   if (level >= LOG_LEVEL_DEBUG) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log(LOG_LEVEL_DEBUG, tti, args_msg, hex, size);
+    all_log(LOG_LEVEL_DEBUG, tti, message.c_str(), args, true, hex, size);
     va_end(args);
-    free(args_msg);
   }
 }
 
 void log_filter::error_line(std::string file, int line, std::string message, ...)
 {
   if (level >= LOG_LEVEL_ERROR) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log_line(LOG_LEVEL_ERROR, tti, file, line, args_msg);
+    all_log(LOG_LEVEL_ERROR, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 
 void log_filter::warning_line(std::string file, int line, std::string message, ...)
 {
   if (level >= LOG_LEVEL_WARNING) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log_line(LOG_LEVEL_WARNING, tti, file, line, args_msg);
+    all_log(LOG_LEVEL_WARNING, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 
 void log_filter::info_line(std::string file, int line, std::string message, ...)
 {
   if (level >= LOG_LEVEL_INFO) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log_line(LOG_LEVEL_INFO, tti, file, line, args_msg);
+    all_log(LOG_LEVEL_INFO, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 
 void log_filter::debug_line(std::string file, int line, std::string message, ...)
 {
   if (level >= LOG_LEVEL_DEBUG) {
-    char     *args_msg;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message.c_str(), args) > 0)
-      all_log_line(LOG_LEVEL_DEBUG, tti, file, line, args_msg);
+    all_log(LOG_LEVEL_DEBUG, tti, message.c_str(), args, false, NULL, 0);
     va_end(args);
-    free(args_msg);
   }
 }
 
@@ -278,14 +249,14 @@ void log_filter::debug_line(std::string file, int line, std::string message, ...
 std::string log_filter::now_time()
 {
   struct timeval rawtime;
-  struct tm * timeinfo;
+  struct tm timeinfo;
   char buffer[64];
   char us[16];
   
   gettimeofday(&rawtime, NULL);
-  timeinfo = localtime(&rawtime.tv_sec);
+  localtime_r(&rawtime.tv_sec, &timeinfo);
   
-  strftime(buffer,64,"%H:%M:%S",timeinfo);
+  strftime(buffer,64,"%H:%M:%S",&timeinfo);
   strcat(buffer,".");
   snprintf(us,16,"%06ld",rawtime.tv_usec);
   strcat(buffer,us);
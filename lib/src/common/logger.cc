@@ -27,15 +27,371 @@
 
 #define LOG_BUFFER_SIZE 1024*32
 
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/types.h>
+
 #include "srslte/common/logger.h"
+#include "srslte/phy/utils/vector.h"
+
+// Deferred mode. Each ring is a power of 2 number of fixed-size slots and each record
+// takes one or more consecutive slots. A record that does not fit before the end of the
+// ring is preceded by a padding record covering the remaining slots.
+#define LOG_SLOT_SIZE       64
+#define LOG_RING_NOF_SLOTS  8192
+#define LOG_RECORD_MAX_LEN  4096
+#define LOG_FORMAT_MAX_LEN  1024
+#define LOG_LINE_MAX_LEN    (4*LOG_RECORD_MAX_LEN)
+#define LOG_DRAIN_PERIOD_US 1000
+
+#define LOG_RECORD_PADDING  0x1
+#define LOG_RECORD_TTI      0x2
+#define LOG_RECORD_HEX      0x4
 
 using namespace std;
 
 namespace srslte{
 
+typedef struct {
+  uint16_t nof_slots;   // Record length in slots, including this header
+  uint8_t  level;
+  uint8_t  flags;
+  uint16_t service;
+  uint16_t format_len;  // Including the terminating null
+  uint16_t args_len;
+  uint16_t hex_len;
+  uint32_t tti;
+  int64_t  tv_sec;
+  int64_t  tv_usec;
+} log_record_t;
+
+class logger::log_ring
+{
+public:
+  log_ring() : wr_idx(0), rd_idx(0), nof_dropped(0), closed(false) {
+    slots = new uint8_t[LOG_RING_NOF_SLOTS*LOG_SLOT_SIZE];
+  }
+  ~log_ring() {
+    delete [] slots;
+  }
+
+  // Called by the owner thread only
+  void push(log_record_t *record, uint32_t len) {
+    uint32_t n   = (len + LOG_SLOT_SIZE - 1)/LOG_SLOT_SIZE;
+    uint32_t w   = wr_idx;
+    uint32_t r   = __atomic_load_n(&rd_idx, __ATOMIC_ACQUIRE);
+    uint32_t pos = w%LOG_RING_NOF_SLOTS;
+    uint32_t pad = pos + n > LOG_RING_NOF_SLOTS ? LOG_RING_NOF_SLOTS - pos : 0;
+    if (LOG_RING_NOF_SLOTS - (w - r) < pad + n) {
+      __atomic_fetch_add(&nof_dropped, 1, __ATOMIC_RELAXED);
+      return;
+    }
+    if (pad) {
+      log_record_t *p = (log_record_t*) &slots[pos*LOG_SLOT_SIZE];
+      p->nof_slots = pad;
+      p->flags     = LOG_RECORD_PADDING;
+      w  += pad;
+      pos = 0;
+    }
+    record->nof_slots = n;
+    memcpy(&slots[pos*LOG_SLOT_SIZE], record, len);
+    __atomic_store_n(&wr_idx, w + n, __ATOMIC_RELEASE);
+  }
+
+  // Called by the logger thread only. Returns NULL if the ring is empty.
+  log_record_t* front() {
+    uint32_t w = __atomic_load_n(&wr_idx, __ATOMIC_ACQUIRE);
+    while (rd_idx != w) {
+      log_record_t *p = (log_record_t*) &slots[(rd_idx%LOG_RING_NOF_SLOTS)*LOG_SLOT_SIZE];
+      if (!(p->flags & LOG_RECORD_PADDING)) {
+        return p;
+      }
+      __atomic_store_n(&rd_idx, rd_idx + p->nof_slots, __ATOMIC_RELEASE);
+    }
+    return NULL;
+  }
+  void pop(log_record_t *record) {
+    __atomic_store_n(&rd_idx, rd_idx + record->nof_slots, __ATOMIC_RELEASE);
+  }
+
+  uint64_t get_nof_dropped() {
+    return __atomic_load_n(&nof_dropped, __ATOMIC_RELAXED);
+  }
+  bool is_closed() {
+    return __atomic_load_n(&closed, __ATOMIC_ACQUIRE);
+  }
+  void close() {
+    __atomic_store_n(&closed, true, __ATOMIC_RELEASE);
+  }
+
+private:
+  uint8_t  *slots;
+  uint32_t  wr_idx;
+  uint8_t   pad0[60];   // Keep the producer and consumer indices in separate cache lines
+  uint32_t  rd_idx;
+  uint8_t   pad1[60];
+  uint64_t  nof_dropped;
+  bool      closed;
+};
+
+/* printf format handling for deferred records. The caller walks the format string once
+ * to copy each argument into the record, converted to a 64-bit integer or a double, and
+ * %s strings by value. The logger thread walks it again and prints each argument with
+ * a conversion rewritten for the stored type.
+ */
+typedef struct {
+  uint32_t len;         // Including the '%' and the conversion character
+  int      nof_stars;   // '*' width and precision arguments
+  char     length;      // 'H' for hh, 'q' for ll, 0 if none
+  char     conv;
+} log_spec_t;
+
+static bool parse_spec(const char *s, log_spec_t *spec)
+{
+  uint32_t i = 1;
+  spec->nof_stars = 0;
+  spec->length    = 0;
+  while (s[i] && strchr("-+ #0'", s[i])) {
+    i++;
+  }
+  for (int field=0;field<2;field++) {
+    if (field == 1) {
+      if (s[i] != '.') {
+        break;
+      }
+      i++;
+    }
+    if (s[i] == '*') {
+      spec->nof_stars++;
+      i++;
+    } else {
+      while (s[i] >= '0' && s[i] <= '9') {
+        i++;
+      }
+    }
+  }
+  if (s[i] && strchr("hljztLq", s[i])) {
+    spec->length = s[i++];
+    if (spec->length == 'h' && s[i] == 'h') {
+      spec->length = 'H';
+      i++;
+    } else if (spec->length == 'l' && s[i] == 'l') {
+      spec->length = 'q';
+      i++;
+    }
+  }
+  spec->conv = s[i];
+  spec->len  = i + 1;
+  return s[i] && strchr("diouxXcfFeEgGaAspn%", s[i]);
+}
+
+static bool put_arg(uint8_t *buf, uint32_t *len, uint32_t max_len, const void *v, uint32_t n)
+{
+  if (*len + n > max_len) {
+    return false;
+  }
+  memcpy(&buf[*len], v, n);
+  *len += n;
+  return true;
+}
+
+// Copies the arguments of format into buf and returns the number of bytes written
+static uint32_t encode_args(const char *format, va_list args, uint8_t *buf, uint32_t max_len)
+{
+  uint32_t   len = 0;
+  log_spec_t spec;
+  for (const char *s=format;(s=strchr(s, '%'));s+=spec.len) {
+    if (!parse_spec(s, &spec)) {
+      break;
+    }
+    for (int i=0;i<spec.nof_stars;i++) {
+      int64_t v = va_arg(args, int);
+      if (!put_arg(buf, &len, max_len, &v, sizeof(v))) {
+        return len;
+      }
+    }
+    bool ok = true;
+    switch (spec.conv) {
+      case 'd': case 'i': case 'c': {
+        int64_t v;
+        switch (spec.length) {
+          case 'H': v = (signed char) va_arg(args, int); break;
+          case 'h': v = (short) va_arg(args, int);       break;
+          case 'l': v = va_arg(args, long);              break;
+          case 'q': v = va_arg(args, long long);         break;
+          case 'j': v = va_arg(args, intmax_t);          break;
+          case 'z': v = va_arg(args, ssize_t);           break;
+          case 't': v = va_arg(args, ptrdiff_t);         break;
+          default:  v = va_arg(args, int);               break;
+        }
+        ok = put_arg(buf, &len, max_len, &v, sizeof(v));
+        break;
+      }
+      case 'o': case 'u': case 'x': case 'X': {
+        uint64_t v;
+        switch (spec.length) {
+          case 'H': v = (unsigned char) va_arg(args, unsigned int);  break;
+          case 'h': v = (unsigned short) va_arg(args, unsigned int); break;
+          case 'l': v = va_arg(args, unsigned long);                 break;
+          case 'q': v = va_arg(args, unsigned long long);            break;
+          case 'j': v = va_arg(args, uintmax_t);                     break;
+          case 'z': v = va_arg(args, size_t);                        break;
+          case 't': v = va_arg(args, ptrdiff_t);                     break;
+          default:  v = va_arg(args, unsigned int);                  break;
+        }
+        ok = put_arg(buf, &len, max_len, &v, sizeof(v));
+        break;
+      }
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+        double v = spec.length == 'L' ? (double) va_arg(args, long double) : va_arg(args, double);
+        ok = put_arg(buf, &len, max_len, &v, sizeof(v));
+        break;
+      }
+      case 'p': {
+        uint64_t v = (uintptr_t) va_arg(args, void*);
+        ok = put_arg(buf, &len, max_len, &v, sizeof(v));
+        break;
+      }
+      case 's': {
+        const char *str = va_arg(args, const char*);
+        if (!str) {
+          str = "(null)";
+        }
+        uint32_t n = strlen(str);
+        if (len + n + 1 > max_len) {
+          n = max_len > len ? max_len - len - 1 : 0;
+        }
+        put_arg(buf, &len, max_len, str, n);
+        ok = put_arg(buf, &len, max_len, "", 1);
+        break;
+      }
+      case 'n':
+        va_arg(args, void*);
+        break;
+      default:
+        break;
+    }
+    if (!ok) {
+      break;
+    }
+  }
+  return len;
+}
+
+template<typename T>
+static int print_arg(char *out, int max_len, const char *spec, int nof_stars, int *stars, T v)
+{
+  switch (nof_stars) {
+    case 0:  return snprintf(out, max_len, spec, v);
+    case 1:  return snprintf(out, max_len, spec, stars[0], v);
+    default: return snprintf(out, max_len, spec, stars[0], stars[1], v);
+  }
+}
+
+// Formats a record message into out, which is always null-terminated. Returns its length.
+static int format_args(const char *format, const uint8_t *args, uint32_t args_len, char *out, int max_len)
+{
+  int        len = 0;
+  uint32_t   pos = 0;
+  log_spec_t spec;
+  char       spec_str[64];
+  const char *s = format;
+  while (len < max_len - 1) {
+    const char *p = strchr(s, '%');
+    int n = p ? p - s : strlen(s);
+    n = SRSLTE_MIN(n, max_len - 1 - len);
+    memcpy(&out[len], s, n);
+    len += n;
+    if (!p || !parse_spec(p, &spec) || spec.len + 3 > sizeof(spec_str)) {
+      break;
+    }
+    s = p + spec.len;
+    if (spec.conv == '%') {
+      out[len++] = '%';
+      continue;
+    }
+    if (spec.conv == 'n') {
+      continue;
+    }
+
+    int stars[2];
+    for (int i=0;i<spec.nof_stars;i++) {
+      int64_t v;
+      if (pos + sizeof(v) > args_len) {
+        break;
+      }
+      memcpy(&v, &args[pos], sizeof(v));
+      pos += sizeof(v);
+      stars[i] = (int) v;
+    }
+
+    // Copy flags, width and precision, and replace the length modifier
+    uint32_t flags_len = spec.len - 1 - (spec.length == 'H' || spec.length == 'q' ? 2 : spec.length ? 1 : 0);
+    memcpy(spec_str, p, flags_len);
+    int w = flags_len;
+    if (strchr("diouxX", spec.conv)) {
+      spec_str[w++] = 'l';
+      spec_str[w++] = 'l';
+    }
+    spec_str[w++] = spec.conv;
+    spec_str[w]   = '\0';
+
+    int      r = 0;
+    uint64_t v = 0;
+    if (spec.conv == 's') {
+      const char *str = (const char*) &args[pos];
+      uint32_t    n   = pos < args_len ? strnlen(str, args_len - pos) : 0;
+      if (pos + n >= args_len) {
+        break;
+      }
+      pos += n + 1;
+      r = print_arg(&out[len], max_len - len, spec_str, spec.nof_stars, stars, str);
+    } else {
+      if (pos + sizeof(v) > args_len) {
+        break;
+      }
+      memcpy(&v, &args[pos], sizeof(v));
+      pos += sizeof(v);
+      switch (spec.conv) {
+        case 'd': case 'i':
+          r = print_arg(&out[len], max_len - len, spec_str, spec.nof_stars, stars, (long long) v);
+          break;
+        case 'c':
+          r = print_arg(&out[len], max_len - len, spec_str, spec.nof_stars, stars, (int) v);
+          break;
+        case 'p':
+          r = print_arg(&out[len], max_len - len, spec_str, spec.nof_stars, stars, (void*) (uintptr_t) v);
+          break;
+        case 'o': case 'u': case 'x': case 'X':
+          r = print_arg(&out[len], max_len - len, spec_str, spec.nof_stars, stars, (unsigned long long) v);
+          break;
+        default: {
+          double d;
+          memcpy(&d, &v, sizeof(d));
+          r = print_arg(&out[len], max_len - len, spec_str, spec.nof_stars, stars, d);
+          break;
+        }
+      }
+    }
+    if (r > 0) {
+      len = SRSLTE_MIN(len + r, max_len - 1);
+    }
+  }
+  out[len] = '\0';
+  return len;
+}
+
 logger::logger()
   :inited(false)
   ,not_done(true)
+  ,deferred(false)
+  ,nof_dropped_closed(0)
+  ,nof_dropped_reported(0)
+  ,nof_services(0)
+  ,line(NULL)
+  ,line_sec(-1)
 {}
 
 logger::~logger() {
@@ -44,11 +400,20 @@ logger::~logger() {
   if(inited) {
     wait_thread_finish();
     flush();
-    fclose(logfile);
+    if (logfile) {
+      fclose(logfile);
+    }
+    if (deferred) {
+      pthread_key_delete(ring_key);
+      for (uint32_t i=0;i<rings.size();i++) {
+        delete rings[i];
+      }
+      delete [] line;
+    }
   }
 }
 
-void logger::init(std::string file) {
+void logger::init(std::string file, bool deferred_) {
   pthread_mutex_init(&mutex, NULL); 
   pthread_cond_init(&not_empty, NULL);
   pthread_cond_init(&not_full, NULL);
@@ -57,6 +422,12 @@ void logger::init(std::string file) {
   if(logfile==NULL) {
     printf("Error: could not create log file, no messages will be logged");
   }
+  deferred = deferred_;
+  if (deferred) {
+    pthread_mutex_init(&rings_mutex, NULL);
+    pthread_key_create(&ring_key, close_ring);
+    line = new char[LOG_LINE_MAX_LEN];
+  }
   start();
   inited = true;
 }
@@ -73,31 +444,233 @@ void logger::log(str_ptr msg) {
   pthread_mutex_unlock(&mutex);
 }
 
+bool logger::is_deferred() {
+  return deferred;
+}
+
+int logger::register_service(std::string name) {
+  int id = -1;
+  pthread_mutex_lock(&rings_mutex);
+  for (int i=0;i<nof_services && id < 0;i++) {
+    if (services[i] == name) {
+      id = i;
+    }
+  }
+  if (id < 0 && nof_services < LOGGER_MAX_SERVICES) {
+    services[nof_services] = name;
+    id = nof_services;
+    __atomic_store_n(&nof_services, id + 1, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(&rings_mutex);
+  return id;
+}
+
+void logger::log_deferred(int service, LOG_LEVEL_ENUM level, uint32_t tti, bool do_tti,
+                          const char *format, va_list args,
+                          bool has_hex, uint8_t *hex, int hex_len)
+{
+  log_ring *ring = get_ring();
+  uint64_t  buf[LOG_RECORD_MAX_LEN/sizeof(uint64_t)];
+  uint8_t  *rec    = (uint8_t*) buf;
+  log_record_t *r  = (log_record_t*) buf;
+  struct timeval now;
+
+  gettimeofday(&now, NULL);
+  r->level   = level;
+  r->flags   = (do_tti ? LOG_RECORD_TTI : 0) | (has_hex ? LOG_RECORD_HEX : 0);
+  r->service = service;
+  r->tti     = tti;
+  r->tv_sec  = now.tv_sec;
+  r->tv_usec = now.tv_usec;
+
+  uint32_t len = sizeof(log_record_t);
+  uint32_t n   = strnlen(format, LOG_FORMAT_MAX_LEN - 1);
+  memcpy(&rec[len], format, n);
+  rec[len + n]  = '\0';
+  r->format_len = n + 1;
+  len += r->format_len;
+
+  r->args_len = encode_args((const char*) &rec[sizeof(log_record_t)], args, &rec[len], LOG_RECORD_MAX_LEN - len);
+  len += r->args_len;
+
+  r->hex_len = 0;
+  if (has_hex && hex && hex_len > 0) {
+    r->hex_len = SRSLTE_MIN((uint32_t) hex_len, LOG_RECORD_MAX_LEN - len);
+    memcpy(&rec[len], hex, r->hex_len);
+    len += r->hex_len;
+  }
+  ring->push(r, len);
+}
+
+uint64_t logger::get_nof_dropped() {
+  if (!deferred) {
+    return 0;
+  }
+  pthread_mutex_lock(&rings_mutex);
+  uint64_t n = nof_dropped_closed;
+  for (uint32_t i=0;i<rings.size();i++) {
+    n += rings[i]->get_nof_dropped();
+  }
+  pthread_mutex_unlock(&rings_mutex);
+  return n;
+}
+
+logger::log_ring* logger::get_ring() {
+  log_ring *ring = (log_ring*) pthread_getspecific(ring_key);
+  if (!ring) {
+    ring = new log_ring;
+    pthread_setspecific(ring_key, ring);
+    pthread_mutex_lock(&rings_mutex);
+    rings.push_back(ring);
+    pthread_mutex_unlock(&rings_mutex);
+  }
+  return ring;
+}
+
+// Called at exit of a thread that logged. The logger thread deletes the ring once drained.
+void logger::close_ring(void *ring) {
+  ((log_ring*) ring)->close();
+}
+
 void logger::run_thread() {
   while(not_done) {
-  pthread_mutex_lock(&mutex);
-    while(buffer.empty()) {
-      pthread_cond_wait(&not_empty, &mutex);
+    std::deque<str_ptr> strings;
+    pthread_mutex_lock(&mutex);
+    if (deferred) {
+      if (buffer.empty()) {
+        struct timeval  now;
+        struct timespec deadline;
+        gettimeofday(&now, NULL);
+        uint64_t usec = now.tv_usec + LOG_DRAIN_PERIOD_US;
+        deadline.tv_sec  = now.tv_sec + usec/1000000;
+        deadline.tv_nsec = 1000*(usec%1000000);
+        pthread_cond_timedwait(&not_empty, &mutex, &deadline);
+      }
+    } else {
+      while(buffer.empty()) {
+        pthread_cond_wait(&not_empty, &mutex);
+      }
     }
-    str_ptr s = buffer.front();
+    strings.swap(buffer);
     pthread_cond_signal(&not_full);
-    if(logfile)
-      fprintf(logfile, "%s", s->c_str());
-    delete s; 
-    buffer.pop_front();
     pthread_mutex_unlock(&mutex);
+
+    // Write without holding the lock so that producers do not wait for the file
+    if (deferred) {
+      drain_rings();
+    }
+    write_strings(&strings);
   }
 }
 
 void logger::flush() {
+  if (deferred) {
+    drain_rings();
+  }
+  write_strings(&buffer);
+}
+
+void logger::write_strings(std::deque<str_ptr> *strings) {
   std::deque<str_ptr>::iterator it;
-  for(it=buffer.begin();it!=buffer.end();it++)
+  for(it=strings->begin();it!=strings->end();it++)
   {
     str_ptr s = *it; 
     if(logfile)
       fprintf(logfile, "%s", s->c_str());
     delete s; 
   }
+  strings->clear();
+}
+
+// Writes the records of all rings, merged in timestamp order
+void logger::drain_rings() {
+  pthread_mutex_lock(&rings_mutex);
+  std::vector<log_ring*> snapshot(rings);
+  pthread_mutex_unlock(&rings_mutex);
+
+  while (true) {
+    log_ring     *oldest_ring = NULL;
+    log_record_t *oldest      = NULL;
+    for (uint32_t i=0;i<snapshot.size();i++) {
+      log_record_t *r = snapshot[i]->front();
+      if (r && (!oldest || r->tv_sec < oldest->tv_sec ||
+                (r->tv_sec == oldest->tv_sec && r->tv_usec < oldest->tv_usec))) {
+        oldest      = r;
+        oldest_ring = snapshot[i];
+      }
+    }
+    if (!oldest) {
+      break;
+    }
+    write_record(oldest);
+    oldest_ring->pop(oldest);
+  }
+
+  // Free the rings of threads that have exited and report drops
+  pthread_mutex_lock(&rings_mutex);
+  uint64_t nof_dropped = nof_dropped_closed;
+  for (std::vector<log_ring*>::iterator it=rings.begin();it!=rings.end();) {
+    if ((*it)->is_closed() && !(*it)->front()) {
+      nof_dropped_closed += (*it)->get_nof_dropped();
+      nof_dropped        += (*it)->get_nof_dropped();
+      delete *it;
+      it = rings.erase(it);
+    } else {
+      nof_dropped += (*it)->get_nof_dropped();
+      it++;
+    }
+  }
+  pthread_mutex_unlock(&rings_mutex);
+  if (nof_dropped > nof_dropped_reported && logfile) {
+    fprintf(logfile, "Logger: %llu messages dropped\n", (unsigned long long) (nof_dropped - nof_dropped_reported));
+    nof_dropped_reported = nof_dropped;
+  }
+  if (logfile) {
+    fflush(logfile);
+  }
+}
+
+// Formats a record with the same layout as log_filter
+void logger::write_record(void *record) {
+  log_record_t *r    = (log_record_t*) record;
+  uint8_t      *rec  = (uint8_t*) record;
+  const char   *fmt  = (const char*) &rec[sizeof(log_record_t)];
+  uint8_t      *args = &rec[sizeof(log_record_t) + r->format_len];
+  uint8_t      *hex  = &args[r->args_len];
+  int           len  = 0;
+
+  if (r->tv_sec != line_sec) {
+    struct tm timeinfo;
+    time_t    secs = r->tv_sec;
+    localtime_r(&secs, &timeinfo);
+    strftime(line_time, sizeof(line_time), "%H:%M:%S", &timeinfo);
+    line_sec = r->tv_sec;
+  }
+  len += snprintf(&line[len], LOG_LINE_MAX_LEN - len, "%s.%06d [%s] %s ", line_time, (int) r->tv_usec,
+                  r->service < __atomic_load_n(&nof_services, __ATOMIC_ACQUIRE) ? services[r->service].c_str() : "",
+                  r->level < LOG_LEVEL_N_ITEMS ? log_level_text[r->level] : "");
+  if (r->flags & LOG_RECORD_TTI) {
+    len += snprintf(&line[len], LOG_LINE_MAX_LEN - len, "[%05d] ", r->tti);
+  }
+  int msg_len = format_args(fmt, args, r->args_len, &line[len], LOG_LINE_MAX_LEN - len);
+  len += msg_len;
+
+  if (r->flags & LOG_RECORD_HEX) {
+    if (msg_len > 0 && line[len-1] != '\n' && len < LOG_LINE_MAX_LEN - 1) {
+      line[len++] = '\n';
+    }
+    for (int c=0;c<r->hex_len && len < LOG_LINE_MAX_LEN - 128;) {
+      len += sprintf(&line[len], "             %04x: ", c);
+      int tmp = SRSLTE_MIN(r->hex_len - c, 16);
+      for (int i=0;i<tmp;i++) {
+        len += sprintf(&line[len], "%02x ", hex[c++]);
+      }
+      line[len++] = '\n';
+    }
+  }
+  if (logfile) {
+    fwrite(line, 1, len, logfile);
+  }
 }
 
 } // namespace srsue
@@ -86,15 +86,19 @@ bool pdu_queue::process_pdus()
 {
   bool have_data = false; 
   uint32_t cnt  = 0; 
-  pdu_t *pdu; 
-  while(pdu_q.try_pop(&pdu)) {
-    if (callback) {
-      callback->process_pdu(pdu->ptr, pdu->len, pdu->tstamp);
+  pdu_t *pdus[16];
+  uint32_t n;
+  while((n = pdu_q.try_pop(pdus, 16)) > 0) {
+    for (uint32_t i=0;i<n;i++) {
+      pdu_t *pdu = pdus[i];
+      if (callback) {
+        callback->process_pdu(pdu->ptr, pdu->len, pdu->tstamp);
+      }
+      if (!pool.deallocate(pdu)) {
+        log_h->warning("Error deallocating from buffer pool: buffer not created in this pool.\n");
+      }
     }
-    if (!pool.deallocate(pdu)) {
-      log_h->warning("Error deallocating from buffer pool: buffer not created in this pool.\n");
-    }
-    cnt++;
+    cnt += n;
     have_data = true;
   }
   if (cnt > 20) {
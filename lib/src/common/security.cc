@@ -25,10 +25,17 @@
  */
 
 
+#include <string.h>
+
 #include "srslte/common/security.h"
 #include "srslte/common/liblte_security.h"
 #include "srslte/common/snow_3g.h"
 
+#ifdef LV_HAVE_AESNI
+#include <wmmintrin.h>
+#define SECURITY_TARGET_AESNI __attribute__((target("aes")))
+#endif
+
 namespace srslte {
 
 /******************************************************************************
@@ -112,20 +119,14 @@ uint8_t security_128_eia1( uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *mac)
 {
-  uint32_t msg_len_bits;
-  uint32_t i;
-  uint8_t *m_ptr;
-
-  msg_len_bits = msg_len*8;
-  m_ptr = snow3g_f9(key,
-                    count,
-                    bearer,
-                    direction,
-                    msg,
-                    msg_len_bits);
-  for(i=0; i<4; i++) {
-    mac[i] = m_ptr[i];
-  }
+  // FRESH is BEARER followed by 27 zero bits (TS 33.401 B.2.2)
+  snow3g_f9_r(key,
+              count,
+              (uint32_t)bearer << 27,
+              direction,
+              msg,
+              (uint64_t)msg_len*8,
+              mac);
   return ERROR_NONE;
 }
 
@@ -146,6 +147,440 @@ uint8_t security_128_eia2( uint8_t  *key,
                                   mac);
 }
 
+/******************************************************************************
+ * AES-128 for EEA2/EIA2
+ *****************************************************************************/
+
+static const uint8_t aes_sbox[256] = {
+  0x63,0x7C,0x77,0x7B,0xF2,0x6B,0x6F,0xC5,0x30,0x01,0x67,0x2B,0xFE,0xD7,0xAB,0x76,
+  0xCA,0x82,0xC9,0x7D,0xFA,0x59,0x47,0xF0,0xAD,0xD4,0xA2,0xAF,0x9C,0xA4,0x72,0xC0,
+  0xB7,0xFD,0x93,0x26,0x36,0x3F,0xF7,0xCC,0x34,0xA5,0xE5,0xF1,0x71,0xD8,0x31,0x15,
+  0x04,0xC7,0x23,0xC3,0x18,0x96,0x05,0x9A,0x07,0x12,0x80,0xE2,0xEB,0x27,0xB2,0x75,
+  0x09,0x83,0x2C,0x1A,0x1B,0x6E,0x5A,0xA0,0x52,0x3B,0xD6,0xB3,0x29,0xE3,0x2F,0x84,
+  0x53,0xD1,0x00,0xED,0x20,0xFC,0xB1,0x5B,0x6A,0xCB,0xBE,0x39,0x4A,0x4C,0x58,0xCF,
+  0xD0,0xEF,0xAA,0xFB,0x43,0x4D,0x33,0x85,0x45,0xF9,0x02,0x7F,0x50,0x3C,0x9F,0xA8,
+  0x51,0xA3,0x40,0x8F,0x92,0x9D,0x38,0xF5,0xBC,0xB6,0xDA,0x21,0x10,0xFF,0xF3,0xD2,
+  0xCD,0x0C,0x13,0xEC,0x5F,0x97,0x44,0x17,0xC4,0xA7,0x7E,0x3D,0x64,0x5D,0x19,0x73,
+  0x60,0x81,0x4F,0xDC,0x22,0x2A,0x90,0x88,0x46,0xEE,0xB8,0x14,0xDE,0x5E,0x0B,0xDB,
+  0xE0,0x32,0x3A,0x0A,0x49,0x06,0x24,0x5C,0xC2,0xD3,0xAC,0x62,0x91,0x95,0xE4,0x79,
+  0xE7,0xC8,0x37,0x6D,0x8D,0xD5,0x4E,0xA9,0x6C,0x56,0xF4,0xEA,0x65,0x7A,0xAE,0x08,
+  0xBA,0x78,0x25,0x2E,0x1C,0xA6,0xB4,0xC6,0xE8,0xDD,0x74,0x1F,0x4B,0xBD,0x8B,0x8A,
+  0x70,0x3E,0xB5,0x66,0x48,0x03,0xF6,0x0E,0x61,0x35,0x57,0xB9,0x86,0xC1,0x1D,0x9E,
+  0xE1,0xF8,0x98,0x11,0x69,0xD9,0x8E,0x94,0x9B,0x1E,0x87,0xE9,0xCE,0x55,0x28,0xDF,
+  0x8C,0xA1,0x89,0x0D,0xBF,0xE6,0x42,0x68,0x41,0x99,0x2D,0x0F,0xB0,0x54,0xBB,0x16
+};
+
+static inline uint8_t aes_xtime(uint8_t x)
+{
+  return (x << 1) ^ ((x & 0x80) ? 0x1B : 0x00);
+}
+
+static inline uint32_t aes_rotl(uint32_t x, int n)
+{
+  return (x << n) | (x >> (32 - n));
+}
+
+static inline uint32_t aes_load(const uint8_t *b)
+{
+  return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t) b[3] << 24);
+}
+
+// SubBytes and MixColumns of a byte in the first row; the other rows are rotations
+static uint32_t aes_te[256];
+
+static class aes_te_init
+{
+public:
+  aes_te_init() {
+    for(int x=0; x<256; x++) {
+      uint8_t s = aes_sbox[x];
+      aes_te[x] = aes_xtime(s) | (s << 8) | (s << 16) | ((uint32_t) (aes_xtime(s) ^ s) << 24);
+    }
+  }
+} aes_te_init_instance;
+
+// Table based AES-128 encryption, used when the CPU has no AES-NI
+static void aes_encrypt_block(security_aes_key_t *k, const uint8_t *in, uint8_t *out)
+{
+  uint32_t s[4];
+  uint32_t t[4];
+
+  for(int c=0; c<4; c++) {
+    s[c] = aes_load(&in[4*c]) ^ aes_load(&k->rk[0][4*c]);
+  }
+  for(int r=1; r<10; r++) {
+    for(int c=0; c<4; c++) {
+      t[c] = aes_te[s[c] & 0xFF] ^
+             aes_rotl(aes_te[(s[(c+1)&3] >>  8) & 0xFF],  8) ^
+             aes_rotl(aes_te[(s[(c+2)&3] >> 16) & 0xFF], 16) ^
+             aes_rotl(aes_te[ s[(c+3)&3] >> 24        ], 24) ^
+             aes_load(&k->rk[r][4*c]);
+    }
+    memcpy(s, t, sizeof(s));
+  }
+  // The last round has no MixColumns
+  for(int c=0; c<4; c++) {
+    t[c] = aes_sbox[s[c] & 0xFF] |
+           (aes_sbox[(s[(c+1)&3] >>  8) & 0xFF] <<  8) |
+           (aes_sbox[(s[(c+2)&3] >> 16) & 0xFF] << 16) |
+           ((uint32_t) aes_sbox[s[(c+3)&3] >> 24] << 24);
+    t[c] ^= aes_load(&k->rk[10][4*c]);
+    for(int i=0; i<4; i++) {
+      out[4*c+i] = (t[c] >> (8*i)) & 0xFF;
+    }
+  }
+}
+
+// CMAC subkey derivation (RFC4493 Section 2.3)
+static void aes_cmac_subkey(const uint8_t *in, uint8_t *out)
+{
+  for(int i=0; i<15; i++) {
+    out[i] = (in[i] << 1) | (in[i+1] >> 7);
+  }
+  out[15] = (in[15] << 1) ^ ((in[0] & 0x80) ? 0x87 : 0x00);
+}
+
+void security_aes_key_init(security_aes_key_t *k,
+                           uint8_t            *key)
+{
+  // Key expansion (FIPS-197 Section 5.2)
+  uint8_t rcon = 0x01;
+  memcpy(k->rk[0], key, 16);
+  for(int r=1; r<=10; r++) {
+    uint8_t *p = k->rk[r-1];
+    uint8_t *q = k->rk[r];
+    q[0] = p[0] ^ aes_sbox[p[13]] ^ rcon;
+    q[1] = p[1] ^ aes_sbox[p[14]];
+    q[2] = p[2] ^ aes_sbox[p[15]];
+    q[3] = p[3] ^ aes_sbox[p[12]];
+    for(int i=4; i<16; i++) {
+      q[i] = p[i] ^ q[i-4];
+    }
+    rcon = aes_xtime(rcon);
+  }
+
+  uint8_t zero[16] = {0};
+  uint8_t L[16];
+  aes_encrypt_block(k, zero, L);
+  aes_cmac_subkey(L, k->k1);
+  aes_cmac_subkey(k->k1, k->k2);
+
+#ifdef LV_HAVE_AESNI
+  k->aesni = __builtin_cpu_supports("aes");
+#else
+  k->aesni = false;
+#endif
+}
+
+// Counter block of a PDU: COUNT | BEARER | DIRECTION | 0 (33.401 Annex B.1.3)
+static void eea2_counter(uint32_t count, uint8_t bearer, uint8_t direction, uint8_t *ctr)
+{
+  memset(ctr, 0, 16);
+  ctr[0] = (count >> 24) & 0xFF;
+  ctr[1] = (count >> 16) & 0xFF;
+  ctr[2] = (count >>  8) & 0xFF;
+  ctr[3] =  count        & 0xFF;
+  ctr[4] = (bearer << 3) | (direction << 2);
+}
+
+// Builds the first and last blocks of M = COUNT | BEARER | DIRECTION | 0 | msg, the
+// last one padded and masked with its subkey (33.401 Annex B.2.3, RFC4493).
+// Returns the number of blocks of M; the ones in between are read from msg.
+static uint32_t eia2_edge_blocks(security_aes_key_t *k,
+                                 uint32_t            count,
+                                 uint8_t             bearer,
+                                 uint8_t             direction,
+                                 uint8_t            *msg,
+                                 uint32_t            msg_len,
+                                 uint8_t            *first,
+                                 uint8_t            *last)
+{
+  uint32_t n = (msg_len + 8 + 15)/16;
+
+  eea2_counter(count, bearer, direction, first);
+  memcpy(&first[8], msg, msg_len < 8 ? msg_len : 8);
+  if(n == 1) {
+    memcpy(last, first, 16);
+  } else {
+    uint32_t offset = 16*(n-1) - 8;
+    memset(last, 0, 16);
+    memcpy(last, &msg[offset], msg_len - offset);
+  }
+
+  uint32_t used = msg_len + 8 - 16*(n-1);
+  uint8_t *subkey = k->k1;
+  if(used < 16) {
+    last[used] = 0x80;
+    subkey     = k->k2;
+  }
+  for(int i=0; i<16; i++) {
+    last[i] ^= subkey[i];
+  }
+  return n;
+}
+
+static void eea2_generic(security_aes_key_t *k,
+                         uint8_t             bearer,
+                         uint8_t             direction,
+                         security_pdu_t     *pdu)
+{
+  uint8_t ctr[16];
+  uint8_t ks[16];
+
+  eea2_counter(pdu->count, bearer, direction, ctr);
+  for(uint64_t offset=0, j=0; offset<pdu->msg_len; offset+=16, j++) {
+    for(int i=0; i<8; i++) {
+      ctr[15-i] = (j >> (8*i)) & 0xFF;
+    }
+    aes_encrypt_block(k, ctr, ks);
+    uint32_t len = pdu->msg_len - offset < 16 ? pdu->msg_len - offset : 16;
+    for(uint32_t i=0; i<len; i++) {
+      pdu->msg[offset+i] ^= ks[i];
+    }
+  }
+}
+
+static void eia2_generic(security_aes_key_t *k,
+                         uint8_t             bearer,
+                         uint8_t             direction,
+                         security_pdu_t     *pdu)
+{
+  uint8_t first[16];
+  uint8_t last[16];
+  uint8_t T[16] = {0};
+
+  uint32_t n = eia2_edge_blocks(k, pdu->count, bearer, direction, pdu->msg, pdu->msg_len, first, last);
+  for(uint32_t j=0; j<n; j++) {
+    const uint8_t *m = (j == n-1) ? last : (j == 0) ? first : &pdu->msg[16*j - 8];
+    for(int i=0; i<16; i++) {
+      T[i] ^= m[i];
+    }
+    aes_encrypt_block(k, T, T);
+  }
+  memcpy(pdu->mac, T, 4);
+}
+
+#ifdef LV_HAVE_AESNI
+
+#define EEA2_NOF_LANES 8
+#define EIA2_NOF_LANES 4
+
+// Encrypts n independent blocks, so that their rounds overlap in the AES unit
+SECURITY_TARGET_AESNI
+static inline void aesni_encrypt_blocks(const __m128i *rk, __m128i *b, int n)
+{
+  for(int l=0; l<n; l++) {
+    b[l] = _mm_xor_si128(b[l], rk[0]);
+  }
+  for(int r=1; r<10; r++) {
+    for(int l=0; l<n; l++) {
+      b[l] = _mm_aesenc_si128(b[l], rk[r]);
+    }
+  }
+  for(int l=0; l<n; l++) {
+    b[l] = _mm_aesenclast_si128(b[l], rk[10]);
+  }
+}
+
+SECURITY_TARGET_AESNI
+static void eea2_aesni(security_aes_key_t *k,
+                       uint8_t             bearer,
+                       uint8_t             direction,
+                       security_pdu_t     *pdus,
+                       uint32_t            nof_pdus)
+{
+  __m128i rk[11];
+  for(int r=0; r<11; r++) {
+    rk[r] = _mm_loadu_si128((__m128i*) k->rk[r]);
+  }
+
+  // Walks the blocks of all the PDUs EEA2_NOF_LANES at a time
+  uint32_t p   = 0;
+  uint32_t blk = 0;
+  uint8_t  ctr[16];
+  __m128i  base = _mm_setzero_si128();
+  if(nof_pdus > 0) {
+    eea2_counter(pdus[0].count, bearer, direction, ctr);
+    base = _mm_loadu_si128((__m128i*) ctr);
+  }
+  while(p < nof_pdus) {
+    __m128i  b[EEA2_NOF_LANES];
+    uint8_t *dst[EEA2_NOF_LANES];
+    uint32_t len[EEA2_NOF_LANES];
+    int      n = 0;
+    while(n < EEA2_NOF_LANES && p < nof_pdus) {
+      if(16*blk >= pdus[p].msg_len) {
+        blk = 0;
+        if(++p < nof_pdus) {
+          eea2_counter(pdus[p].count, bearer, direction, ctr);
+          base = _mm_loadu_si128((__m128i*) ctr);
+        }
+        continue;
+      }
+      b[n]   = _mm_xor_si128(base, _mm_set_epi64x(__builtin_bswap64(blk), 0));
+      dst[n] = &pdus[p].msg[16*blk];
+      len[n] = pdus[p].msg_len - 16*blk;
+      n++;
+      blk++;
+    }
+
+    aesni_encrypt_blocks(rk, b, n);
+
+    for(int l=0; l<n; l++) {
+      if(len[l] >= 16) {
+        _mm_storeu_si128((__m128i*) dst[l], _mm_xor_si128(b[l], _mm_loadu_si128((__m128i*) dst[l])));
+      } else {
+        uint8_t ks[16];
+        _mm_storeu_si128((__m128i*) ks, b[l]);
+        for(uint32_t i=0; i<len[l]; i++) {
+          dst[l][i] ^= ks[i];
+        }
+      }
+    }
+  }
+}
+
+// Runs the CMAC chains of EIA2_NOF_LANES PDUs side by side
+SECURITY_TARGET_AESNI
+static void eia2_aesni(security_aes_key_t *k,
+                       uint8_t             bearer,
+                       uint8_t             direction,
+                       security_pdu_t     *pdus,
+                       uint32_t            nof_pdus)
+{
+  __m128i rk[11];
+  for(int r=0; r<11; r++) {
+    rk[r] = _mm_loadu_si128((__m128i*) k->rk[r]);
+  }
+
+  for(uint32_t p=0; p<nof_pdus; p+=EIA2_NOF_LANES) {
+    int      n = nof_pdus - p < EIA2_NOF_LANES ? nof_pdus - p : EIA2_NOF_LANES;
+    uint8_t  first[EIA2_NOF_LANES][16];
+    uint8_t  last[EIA2_NOF_LANES][16];
+    uint32_t nof_blocks[EIA2_NOF_LANES];
+    uint32_t max_blocks = 0;
+    __m128i  T[EIA2_NOF_LANES];
+    __m128i  b[EIA2_NOF_LANES];
+
+    for(int l=0; l<n; l++) {
+      security_pdu_t *pdu = &pdus[p+l];
+      nof_blocks[l] = eia2_edge_blocks(k, pdu->count, bearer, direction, pdu->msg, pdu->msg_len, first[l], last[l]);
+      if(nof_blocks[l] > max_blocks) {
+        max_blocks = nof_blocks[l];
+      }
+      T[l] = _mm_setzero_si128();
+    }
+
+    for(uint32_t j=0; j<max_blocks; j++) {
+      for(int l=0; l<n; l++) {
+        if(j < nof_blocks[l]) {
+          const uint8_t *m = (j == nof_blocks[l]-1) ? last[l] : (j == 0) ? first[l] : &pdus[p+l].msg[16*j - 8];
+          b[l] = _mm_xor_si128(T[l], _mm_loadu_si128((__m128i*) m));
+        } else {
+          b[l] = T[l];
+        }
+      }
+      aesni_encrypt_blocks(rk, b, n);
+      for(int l=0; l<n; l++) {
+        if(j < nof_blocks[l]) {
+          T[l] = b[l];
+        }
+      }
+    }
+
+    for(int l=0; l<n; l++) {
+      uint8_t t[16];
+      _mm_storeu_si128((__m128i*) t, T[l]);
+      memcpy(pdus[p+l].mac, t, 4);
+    }
+  }
+}
+
+#endif // LV_HAVE_AESNI
+
+uint8_t security_128_eea1( uint8_t  *key,
+                           uint32_t  count,
+                           uint8_t   bearer,
+                           uint8_t   direction,
+                           uint8_t  *msg,
+                           uint32_t  msg_len)
+{
+  snow3g_f8_r(key,
+              count,
+              bearer,
+              direction,
+              msg,
+              msg_len*8);
+  return ERROR_NONE;
+}
+
+uint8_t security_128_eea2( security_aes_key_t *k,
+                           uint32_t            count,
+                           uint8_t             bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len)
+{
+  security_pdu_t pdu;
+  pdu.count   = count;
+  pdu.msg     = msg;
+  pdu.msg_len = msg_len;
+  pdu.mac     = NULL;
+  security_128_eea2_batch(k, bearer, direction, &pdu, 1);
+  return ERROR_NONE;
+}
+
+void security_128_eea2_batch( security_aes_key_t *k,
+                              uint8_t             bearer,
+                              uint8_t             direction,
+                              security_pdu_t     *pdus,
+                              uint32_t            nof_pdus)
+{
+#ifdef LV_HAVE_AESNI
+  if(k->aesni) {
+    eea2_aesni(k, bearer, direction, pdus, nof_pdus);
+    return;
+  }
+#endif
+  for(uint32_t i=0; i<nof_pdus; i++) {
+    eea2_generic(k, bearer, direction, &pdus[i]);
+  }
+}
+
+uint8_t security_128_eia2( security_aes_key_t *k,
+                           uint32_t            count,
+                           uint8_t             bearer,
+                           uint8_t             direction,
+                           uint8_t            *msg,
+                           uint32_t            msg_len,
+                           uint8_t            *mac)
+{
+  security_pdu_t pdu;
+  pdu.count   = count;
+  pdu.msg     = msg;
+  pdu.msg_len = msg_len;
+  pdu.mac     = mac;
+  security_128_eia2_batch(k, bearer, direction, &pdu, 1);
+  return ERROR_NONE;
+}
+
+void security_128_eia2_batch( security_aes_key_t *k,
+                              uint8_t             bearer,
+                              uint8_t             direction,
+                              security_pdu_t     *pdus,
+                              uint32_t            nof_pdus)
+{
+#ifdef LV_HAVE_AESNI
+  if(k->aesni) {
+    eia2_aesni(k, bearer, direction, pdus, nof_pdus);
+    return;
+  }
+#endif
+  for(uint32_t i=0; i<nof_pdus; i++) {
+    eia2_generic(k, bearer, direction, &pdus[i]);
+  }
+}
+
 /******************************************************************************
  * Authentication
  *****************************************************************************/
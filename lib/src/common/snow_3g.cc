@@ -575,3 +575,338 @@ u8* snow3g_f9( u8* key, u32 count, u32 fresh, u32 dir, u8 *data, u64 length)
 	
 	return MAC_I;
 }
+
+/*------------------------------------------------------------------------
+* Reentrant SNOW 3G
+*------------------------------------------------------------------------*/
+
+#ifdef LV_HAVE_PCLMUL
+#include <wmmintrin.h>
+#define SNOW3G_TARGET_PCLMUL __attribute__((target("pclmul")))
+#endif
+
+/* S1 and S2 as four lookups each, one per input byte, and MULalpha and
+DIValpha as single lookups. Filled once, before main(), from the functions
+above. */
+
+static u32 S1_T[4][256];
+static u32 S2_T[4][256];
+static u32 MULalpha_T[256];
+static u32 DIValpha_T[256];
+
+/* Reduction of the 4 bits shifted out of a GF(2^64) element, modulo
+x^64 + x^4 + x^3 + x + 1 */
+static u64 MUL64_RED4[16];
+
+#ifdef LV_HAVE_PCLMUL
+static bool snow3g_pclmul = false;
+#endif
+
+static void snow3g_fill_sbox_table(u32 T[4][256], u8 *SBOX, u8 c)
+{
+	int i;
+	for (i=0; i<256; i++) {
+		u32 s = SBOX[i];
+		u32 m = MULx(SBOX[i], c);
+		T[0][i] = (m << 24) | ((m ^ s) << 16) | (s << 8) | s;
+		T[1][i] = (s << 24) | (m << 16) | ((m ^ s) << 8) | s;
+		T[2][i] = (s << 24) | (s << 16) | (m << 8) | (m ^ s);
+		T[3][i] = ((m ^ s) << 24) | (s << 16) | (s << 8) | m;
+	}
+}
+
+static class snow3g_tables_init
+{
+public:
+	snow3g_tables_init()
+	{
+		int i, j;
+		snow3g_fill_sbox_table(S1_T, SR, 0x1b);
+		snow3g_fill_sbox_table(S2_T, SQ, 0x69);
+		for (i=0; i<256; i++) {
+			MULalpha_T[i] = MULalpha((u8) i);
+			DIValpha_T[i] = DIValpha((u8) i);
+		}
+		for (i=0; i<16; i++) {
+			MUL64_RED4[i] = 0;
+			for (j=0; j<4; j++) {
+				if ((i >> j) & 1)
+					MUL64_RED4[i] ^= (u64) 0x1b << j;
+			}
+		}
+#ifdef LV_HAVE_PCLMUL
+		snow3g_pclmul = __builtin_cpu_supports("pclmul");
+#endif
+	}
+} snow3g_tables_init_;
+
+static inline u32 snow3g_s1(u32 w)
+{
+	return S1_T[0][w >> 24] ^ S1_T[1][(w >> 16) & 0xff] ^
+	       S1_T[2][(w >> 8) & 0xff] ^ S1_T[3][w & 0xff];
+}
+
+static inline u32 snow3g_s2(u32 w)
+{
+	return S2_T[0][w >> 24] ^ S2_T[1][(w >> 16) & 0xff] ^
+	       S2_T[2][(w >> 8) & 0xff] ^ S2_T[3][w & 0xff];
+}
+
+/* ClockFSM() on the context */
+static inline u32 snow3g_clock_fsm(snow3g_ctx_t *ctx)
+{
+	u32 F = (ctx->s[(ctx->t + 15) & 15] + ctx->r1) ^ ctx->r2;
+	u32 r = ctx->r2 + (ctx->r3 ^ ctx->s[(ctx->t + 5) & 15]);
+	ctx->r3 = snow3g_s2(ctx->r2);
+	ctx->r2 = snow3g_s1(ctx->r1);
+	ctx->r1 = r;
+	return F;
+}
+
+/* Clocks the LFSR in initialization mode with F, or in keystream mode with
+F = 0. The new s_15 replaces s_0 in the ring. */
+static inline void snow3g_clock_lfsr(snow3g_ctx_t *ctx, u32 F)
+{
+	u32 t   = ctx->t;
+	u32 s0  = ctx->s[t];
+	u32 s11 = ctx->s[(t + 11) & 15];
+	ctx->s[t] = (s0 << 8) ^ MULalpha_T[s0 >> 24] ^ ctx->s[(t + 2) & 15] ^
+	            (s11 >> 8) ^ DIValpha_T[s11 & 0xff] ^ F;
+	ctx->t = (t + 1) & 15;
+}
+
+/* STEPs 1 to 3 of snow3g_generate_keystream() */
+static inline u32 snow3g_next_word(snow3g_ctx_t *ctx)
+{
+	u32 z = snow3g_clock_fsm(ctx) ^ ctx->s[ctx->t];
+	snow3g_clock_lfsr(ctx, 0);
+	return z;
+}
+
+void snow3g_initialize_r(snow3g_ctx_t *ctx, u32 k[4], u32 IV[4])
+{
+	int i;
+	ctx->s[15] = k[3] ^ IV[0];
+	ctx->s[14] = k[2];
+	ctx->s[13] = k[1];
+	ctx->s[12] = k[0] ^ IV[1];
+	ctx->s[11] = k[3] ^ 0xffffffff;
+	ctx->s[10] = k[2] ^ 0xffffffff ^ IV[2];
+	ctx->s[9]  = k[1] ^ 0xffffffff ^ IV[3];
+	ctx->s[8]  = k[0] ^ 0xffffffff;
+	ctx->s[7]  = k[3];
+	ctx->s[6]  = k[2];
+	ctx->s[5]  = k[1];
+	ctx->s[4]  = k[0];
+	ctx->s[3]  = k[3] ^ 0xffffffff;
+	ctx->s[2]  = k[2] ^ 0xffffffff;
+	ctx->s[1]  = k[1] ^ 0xffffffff;
+	ctx->s[0]  = k[0] ^ 0xffffffff;
+	ctx->t  = 0;
+	ctx->r1 = 0;
+	ctx->r2 = 0;
+	ctx->r3 = 0;
+	for (i=0; i<32; i++)
+		snow3g_clock_lfsr(ctx, snow3g_clock_fsm(ctx));
+	/* Clock FSM once, discarding the output, and the LFSR in keystream mode */
+	snow3g_clock_fsm(ctx);
+	snow3g_clock_lfsr(ctx, 0);
+}
+
+void snow3g_generate_keystream_r(snow3g_ctx_t *ctx, u32 n, u32 *ks)
+{
+	u32 t;
+	for (t=0; t<n; t++)
+		ks[t] = snow3g_next_word(ctx);
+}
+
+static void snow3g_load_key(u8 *key, u32 K[4])
+{
+	int i;
+	for (i=0; i<4; i++)
+		K[3-i] = ((u32) key[4*i] << 24) ^ ((u32) key[4*i+1] << 16) ^
+		         ((u32) key[4*i+2] << 8) ^ ((u32) key[4*i+3]);
+}
+
+void snow3g_f8_r(u8 *key, u32 count, u32 bearer, u32 dir, u8 *data, u32 length)
+{
+	snow3g_ctx_t ctx;
+	u32 K[4], IV[4];
+	u32 nof_bytes = (length + 7) / 8;
+	u32 lastbits  = (8 - (length % 8)) % 8;
+	u32 i, z;
+
+	snow3g_load_key(key, K);
+	IV[3] = count;
+	IV[2] = (bearer << 27) | ((dir & 0x1) << 26);
+	IV[1] = IV[3];
+	IV[0] = IV[2];
+	snow3g_initialize_r(&ctx, K, IV);
+
+	for (i=0; i+4<=nof_bytes; i+=4) {
+		z = snow3g_next_word(&ctx);
+		data[i+0] ^= (u8) (z >> 24);
+		data[i+1] ^= (u8) (z >> 16);
+		data[i+2] ^= (u8) (z >> 8);
+		data[i+3] ^= (u8) z;
+	}
+	if (i < nof_bytes) {
+		z = snow3g_next_word(&ctx);
+		for (; i<nof_bytes; i++, z<<=8)
+			data[i] ^= (u8) (z >> 24);
+	}
+
+	if (lastbits)
+		data[length/8] &= 256 - (1<<lastbits);
+}
+
+/* MUL64(V,P,0x1b) processing V 4 bits at a time. Pt[i] holds the product of
+P with the 4 bit polynomial i. */
+
+static void snow3g_mul64_table(u64 P, u64 Pt[16])
+{
+	int i;
+	Pt[0] = 0;
+	Pt[1] = P;
+	for (i=2; i<16; i+=2) {
+		Pt[i]   = MUL64x(Pt[i/2], 0x1b);
+		Pt[i+1] = Pt[i] ^ P;
+	}
+}
+
+static inline u64 snow3g_mul64(u64 V, u64 Pt[16])
+{
+	u64 r = 0;
+	int i;
+	for (i=60; i>=0; i-=4)
+		r = (r << 4) ^ MUL64_RED4[r >> 60] ^ Pt[(V >> i) & 0xf];
+	return r;
+}
+
+static inline u64 snow3g_load64(u8 *p)
+{
+	return (u64)p[0]<<56 | (u64)p[1]<<48 | (u64)p[2]<<40 | (u64)p[3]<<32 |
+	       (u64)p[4]<<24 | (u64)p[5]<<16 | (u64)p[6]<< 8 | (u64)p[7];
+}
+
+/* Horner evaluation of the nof_blocks full 64-bit blocks of data followed by
+last, EVAL = (EVAL ^ M_i)*P. */
+
+static u64 snow3g_eval_generic(u8 *data, u32 nof_blocks, u64 last, u64 P)
+{
+	u64 Pt[16];
+	u64 EVAL = 0;
+	u32 i;
+	snow3g_mul64_table(P, Pt);
+	for (i=0; i<nof_blocks; i++)
+		EVAL = snow3g_mul64(EVAL ^ snow3g_load64(&data[8*i]), Pt);
+	return snow3g_mul64(EVAL ^ last, Pt);
+}
+
+#ifdef LV_HAVE_PCLMUL
+
+SNOW3G_TARGET_PCLMUL
+static inline __m128i snow3g_clmul(u64 a, u64 b)
+{
+	return _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) a),
+	                            _mm_cvtsi64_si128((long long) b), 0x00);
+}
+
+/* Reduces a 128 bit product modulo x^64 + x^4 + x^3 + x + 1. The high half
+times 0x1b overflows by at most 4 bits, which are folded once more. */
+SNOW3G_TARGET_PCLMUL
+static inline u64 snow3g_reduce(__m128i x)
+{
+	u64 lo = (u64) _mm_cvtsi128_si64(x);
+	u64 hi = (u64) _mm_cvtsi128_si64(_mm_unpackhi_epi64(x, x));
+	__m128i t = snow3g_clmul(hi, 0x1b);
+	u64 t_lo  = (u64) _mm_cvtsi128_si64(t);
+	u64 t_hi  = (u64) _mm_cvtsi128_si64(_mm_unpackhi_epi64(t, t));
+	return lo ^ t_lo ^ MUL64_RED4[t_hi];
+}
+
+/* As snow3g_eval_generic(), four blocks at a time:
+EVAL' = (EVAL ^ M_i)*P^4 ^ M_i+1*P^3 ^ M_i+2*P^2 ^ M_i+3*P, with a single
+reduction of the sum of the four products. */
+SNOW3G_TARGET_PCLMUL
+static u64 snow3g_eval_pclmul(u8 *data, u32 nof_blocks, u64 last, u64 P)
+{
+	u64 P2 = snow3g_reduce(snow3g_clmul(P, P));
+	u64 P3 = snow3g_reduce(snow3g_clmul(P2, P));
+	u64 P4 = snow3g_reduce(snow3g_clmul(P2, P2));
+	u64 EVAL = 0;
+	u32 i = 0;
+	for (; i+4<=nof_blocks; i+=4) {
+		__m128i x = snow3g_clmul(EVAL ^ snow3g_load64(&data[8*i]), P4);
+		x = _mm_xor_si128(x, snow3g_clmul(snow3g_load64(&data[8*i+8]),  P3));
+		x = _mm_xor_si128(x, snow3g_clmul(snow3g_load64(&data[8*i+16]), P2));
+		x = _mm_xor_si128(x, snow3g_clmul(snow3g_load64(&data[8*i+24]), P));
+		EVAL = snow3g_reduce(x);
+	}
+	for (; i<nof_blocks; i++)
+		EVAL = snow3g_reduce(snow3g_clmul(EVAL ^ snow3g_load64(&data[8*i]), P));
+	return snow3g_reduce(snow3g_clmul(EVAL ^ last, P));
+}
+
+SNOW3G_TARGET_PCLMUL
+static u64 snow3g_mul64_pclmul(u64 V, u64 Q)
+{
+	return snow3g_reduce(snow3g_clmul(V, Q));
+}
+
+#endif
+
+void snow3g_f9_r(u8* key, u32 count, u32 fresh, u32 dir, u8 *data, u64 length, u8 *mac)
+{
+	snow3g_ctx_t ctx;
+	u32 K[4], IV[4], z[5];
+	u64 P, Q, EVAL, last = 0;
+	u32 nof_blocks, rem_bits, i;
+
+	snow3g_load_key(key, K);
+	IV[3] = count;
+	IV[2] = fresh;
+	IV[1] = count ^ (dir << 31);
+	IV[0] = fresh ^ (dir << 15);
+	snow3g_initialize_r(&ctx, K, IV);
+	snow3g_generate_keystream_r(&ctx, 5, z);
+
+	P = (u64)z[0] << 32 | (u64)z[1];
+	Q = (u64)z[2] << 32 | (u64)z[3];
+
+	/* Blocks M_0 to M_D-3 are full, M_D-2 holds the last 1 to 64 bits */
+	if (length > 0) {
+		nof_blocks = (u32) ((length - 1) >> 6);
+		rem_bits   = (u32) (length - 64*(u64)nof_blocks);
+		for (i=0; rem_bits>7; i++, rem_bits-=8)
+			last |= (u64)data[8*nof_blocks+i] << (8*(7-i));
+		if (rem_bits > 0)
+			last |= (u64)(data[8*nof_blocks+i] & mask8bit(rem_bits)) << (8*(7-i));
+#ifdef LV_HAVE_PCLMUL
+		if (snow3g_pclmul)
+			EVAL = snow3g_eval_pclmul(data, nof_blocks, last, P);
+		else
+#endif
+		EVAL = snow3g_eval_generic(data, nof_blocks, last, P);
+	} else {
+		EVAL = 0;
+	}
+
+	/* for D-1 */
+	EVAL ^= length;
+
+	/* Multiply by Q */
+#ifdef LV_HAVE_PCLMUL
+	if (snow3g_pclmul) {
+		EVAL = snow3g_mul64_pclmul(EVAL, Q);
+	} else
+#endif
+	{
+		u64 Qt[16];
+		snow3g_mul64_table(Q, Qt);
+		EVAL = snow3g_mul64(EVAL, Qt);
+	}
+
+	for (i=0; i<4; i++)
+		mac[i] = ((EVAL >> (56-(i*8))) ^ (z[4] >> (24-(i*8)))) & 0xff;
+}
@@ -0,0 +1,211 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include "srslte/common/task_pool.h"
+
+namespace srslte {
+
+task_pool::task_pool()
+{
+  next_queue   = 0; 
+  nof_queued   = 0; 
+  nof_sleeping = 0; 
+  running      = false; 
+  pthread_mutex_init(&mutex, NULL);
+  pthread_cond_init(&cvar, NULL);
+  // Without threads, tasks are run by the threads waiting for them 
+  queues.push_back(new task_queue);
+}
+
+task_pool::~task_pool()
+{
+  stop();
+  for (uint32_t i=0;i<queues.size();i++) {
+    delete queues[i];
+  }
+  pthread_mutex_destroy(&mutex);
+  pthread_cond_destroy(&cvar);
+}
+
+bool task_pool::init(std::vector<void*> &thread_args, int prio)
+{
+  if (running || thread_args.empty()) {
+    return false; 
+  }
+  running = true; 
+  for (uint32_t i=1;i<thread_args.size();i++) {
+    queues.push_back(new task_queue);
+  }
+  for (uint32_t i=0;i<thread_args.size();i++) {
+    runner *r = new runner;
+    r->parent = this; 
+    r->id     = i; 
+    r->arg    = thread_args[i];
+    runners.push_back(r);
+    r->start(prio);
+  }
+  return true; 
+}
+
+void task_pool::stop()
+{
+  pthread_mutex_lock(&mutex);
+  running = false; 
+  pthread_cond_broadcast(&cvar);
+  pthread_mutex_unlock(&mutex);
+  for (uint32_t i=0;i<runners.size();i++) {
+    runners[i]->wait_thread_finish();
+    delete runners[i];
+  }
+  runners.clear();
+}
+
+uint32_t task_pool::get_nof_threads()
+{
+  return runners.size(); 
+}
+
+void task_pool::push(batch *b, task *t)
+{
+  entry_t e = {t, b};
+  __sync_fetch_and_add(&b->nof_pending, 1);
+  __sync_fetch_and_add(&b->nof_queued, 1);
+  
+  task_queue *tq = queues[__sync_fetch_and_add(&next_queue, 1)%queues.size()];
+  pthread_mutex_lock(&tq->mutex);
+  tq->q.push_back(e);
+  pthread_mutex_unlock(&tq->mutex);
+  
+  // Pairs with the barrier in sleep(): either the sleeper sees the task or we see the sleeper 
+  __sync_fetch_and_add(&nof_queued, 1);
+  if (nof_sleeping > 0) {
+    pthread_mutex_lock(&mutex);
+    pthread_cond_broadcast(&cvar);
+    pthread_mutex_unlock(&mutex);
+  }
+}
+
+// Pops from queue first or, if empty, steals from the back of the others 
+bool task_pool::pop(uint32_t first, entry_t *e)
+{
+  if (nof_queued <= 0) {
+    return false; 
+  }
+  for (uint32_t i=0;i<queues.size();i++) {
+    task_queue *tq = queues[(first+i)%queues.size()];
+    pthread_mutex_lock(&tq->mutex);
+    if (!tq->q.empty()) {
+      if (i == 0) {
+        *e = tq->q.front();
+        tq->q.pop_front();
+      } else {
+        *e = tq->q.back();
+        tq->q.pop_back();
+      }
+      pthread_mutex_unlock(&tq->mutex);
+      __sync_fetch_and_sub(&e->b->nof_queued, 1);
+      __sync_fetch_and_sub(&nof_queued, 1);
+      return true; 
+    }
+    pthread_mutex_unlock(&tq->mutex);
+  }
+  return false; 
+}
+
+// Pops the first queued task of batch b from any queue 
+bool task_pool::pop_batch(batch *b, entry_t *e)
+{
+  if (b->nof_queued <= 0) {
+    return false; 
+  }
+  for (uint32_t i=0;i<queues.size();i++) {
+    task_queue *tq = queues[i];
+    pthread_mutex_lock(&tq->mutex);
+    for (std::deque<entry_t>::iterator it=tq->q.begin();it!=tq->q.end();++it) {
+      if (it->b == b) {
+        *e = *it;
+        tq->q.erase(it);
+        pthread_mutex_unlock(&tq->mutex);
+        __sync_fetch_and_sub(&b->nof_queued, 1);
+        __sync_fetch_and_sub(&nof_queued, 1);
+        return true; 
+      }
+    }
+    pthread_mutex_unlock(&tq->mutex);
+  }
+  return false; 
+}
+
+void task_pool::run(entry_t *e, void *arg)
+{
+  e->t->run_task(arg);
+  if (__sync_sub_and_fetch(&e->b->nof_pending, 1) == 0) {
+    pthread_mutex_lock(&mutex);
+    pthread_cond_broadcast(&cvar);
+    pthread_mutex_unlock(&mutex);
+  }
+}
+
+// Without b, sleeps until a task is queued or the pool stops. With b, sleeps until a 
+// task of b is queued or b has finished 
+void task_pool::sleep(batch *b)
+{
+  pthread_mutex_lock(&mutex);
+  __sync_fetch_and_add(&nof_sleeping, 1);
+  while (b ? (b->nof_queued <= 0 && b->nof_pending > 0) : (nof_queued <= 0 && running)) {
+    pthread_cond_wait(&cvar, &mutex);
+  }
+  __sync_fetch_and_sub(&nof_sleeping, 1);
+  pthread_mutex_unlock(&mutex);
+}
+
+void task_pool::wait(batch *b, void *arg)
+{
+  entry_t e; 
+  // Atomic read, so that the results of the tasks are visible when it returns 
+  while (__sync_fetch_and_add(&b->nof_pending, 0) > 0) {
+    if (pop_batch(b, &e)) {
+      run(&e, arg);
+    } else {
+      sleep(b);
+    }
+  }
+}
+
+void task_pool::runner::run_thread()
+{
+  entry_t e; 
+  while (parent->running) {
+    if (parent->pop(id, &e)) {
+      parent->run(&e, arg);
+    } else {
+      parent->sleep(NULL);
+    }
+  }
+}
+
+} // namespace srslte
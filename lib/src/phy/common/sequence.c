@@ -35,44 +35,66 @@
 
 #define Nc 1600
 
+/* The x1 and x2 m-sequences are kept in 32-bit registers holding the next 31 values
+ * of the sequence, x(n) in the MSB and x(n+30) in bit 1. Both recursions produce 28
+ * new values per register update, which are also the next 28 bits of the Gold sequence.
+ */
+#define SEQUENCE_STEP 28
+
+static inline uint32_t sequence_x1_next(uint32_t x1) {
+  return (x1 << 3) ^ x1;
+}
+
+static inline uint32_t sequence_x2_next(uint32_t x2) {
+  return (x2 << 3) ^ (x2 << 2) ^ (x2 << 1) ^ x2;
+}
+
+// Advances both registers by nof_bits, up to SEQUENCE_STEP
+static inline void sequence_advance(uint32_t *x1, uint32_t *x2, uint32_t nof_bits) {
+  uint32_t mask = ((1u << nof_bits) - 1) << 1;
+  *x1 = (*x1 << nof_bits) | ((sequence_x1_next(*x1) >> (31 - nof_bits)) & mask);
+  *x2 = (*x2 << nof_bits) | ((sequence_x2_next(*x2) >> (31 - nof_bits)) & mask);
+}
 
 /*
  * Pseudo Random Sequence generation.
  * It follows the 3GPP Release 8 (LTE) 36.211
  * Section 7.2
+ *
+ * Writes len bits of the sequence packed MSB first into c_packed, SEQUENCE_STEP bits at a
+ * time. Bits in the last byte past len are set to zero.
  */
-void srslte_sequence_set_LTE_pr(srslte_sequence_t *q, uint32_t seed) {
-  int n;
-  uint32_t *x1, *x2;
-
-  x1 = calloc(Nc + q->len + 31, sizeof(uint32_t));
-  if (!x1) {
-    perror("calloc");
-    return;
-  }
-  x2 = calloc(Nc + q->len + 31, sizeof(uint32_t));
-  if (!x2) {
-    free(x1);
-    perror("calloc");
-    return;
+void srslte_sequence_gen_LTE_pr_packed(uint8_t *c_packed, uint32_t len, uint32_t seed) {
+  uint32_t x1 = 1u << 31;
+  uint32_t x2 = 0;
+  for (uint32_t n = 0; n < 31; n++) {
+    x2 |= ((seed >> n) & 0x1) << (31 - n);
   }
 
-  for (n = 0; n < 31; n++) {
-    x2[n] = (seed >> n) & 0x1;
+  for (uint32_t n = 0; n < Nc / SEQUENCE_STEP; n++) {
+    sequence_advance(&x1, &x2, SEQUENCE_STEP);
   }
-  x1[0] = 1;
+  sequence_advance(&x1, &x2, Nc % SEQUENCE_STEP);
 
-  for (n = 0; n < Nc + q->len; n++) {
-    x1[n + 31] = (x1[n + 3] + x1[n]) & 0x1;
-    x2[n + 31] = (x2[n + 3] + x2[n + 2] + +x2[n+1] + x2[n]) & 0x1;
+  // Two register updates give 56 bits, or 7 bytes
+  uint32_t nof_bytes = (len + 7) / 8;
+  for (uint32_t i = 0; i < nof_bytes; i += 7) {
+    uint64_t w = (uint64_t) ((x1 ^ x2) & 0xFFFFFFF0) << 32;
+    sequence_advance(&x1, &x2, SEQUENCE_STEP);
+    w |= (uint64_t) ((x1 ^ x2) & 0xFFFFFFF0) << 4;
+    sequence_advance(&x1, &x2, SEQUENCE_STEP);
+    for (uint32_t j = 0; j < 7 && i + j < nof_bytes; j++) {
+      c_packed[i + j] = (uint8_t) (w >> (56 - 8 * j));
+    }
   }
-
-  for (n = 0; n < q->len; n++) {
-    q->c[n] = (x1[n + Nc] + x2[n + Nc]) & 0x1;
+  if (len % 8) {
+    c_packed[len / 8] &= 0xFF << (8 - len % 8);
   }
+}
 
-  free(x1);
-  free(x2);
+void srslte_sequence_set_LTE_pr(srslte_sequence_t *q, uint32_t seed) {
+  srslte_sequence_gen_LTE_pr_packed(q->c_bytes, q->len, seed);
+  srslte_bit_unpack_vector(q->c_bytes, q->c, q->len);
 }
 
 int srslte_sequence_LTE_pr(srslte_sequence_t *q, uint32_t len, uint32_t seed) {
@@ -81,7 +103,6 @@ int srslte_sequence_LTE_pr(srslte_sequence_t *q, uint32_t len, uint32_t seed) {
   }
   q->len = len;
   srslte_sequence_set_LTE_pr(q, seed);
-  srslte_bit_pack_vector(q->c, q->c_bytes, len);
   for (int i=0;i<len;i++) {
     q->c_float[i] = (1-2*q->c[i]);
     q->c_short[i] = (int16_t) q->c_float[i];
@@ -89,18 +110,31 @@ int srslte_sequence_LTE_pr(srslte_sequence_t *q, uint32_t len, uint32_t seed) {
   return SRSLTE_SUCCESS;
 }
 
-int srslte_sequence_init(srslte_sequence_t *q, uint32_t len) {
-  if (q->c && (q->len != len)) {
-    free(q->c);
-    if (q->c_bytes) {
-      free(q->c_bytes);
-    }
-    if (q->c_float) {
-      free(q->c_float);
-    }
-    if (q->c_short) {
-      free(q->c_short);
+/* Generates a sequence holding only the packed bits, which is all the scrambling functions
+ * need. The buffer is reused if it is large enough, so a sequence can be regenerated every
+ * subframe without allocating. The sequence must be zeroed before the first call.
+ */
+int srslte_sequence_LTE_pr_packed(srslte_sequence_t *q, uint32_t len, uint32_t seed) {
+  if (q->c_bytes && len > q->max_len) {
+    free(q->c_bytes);
+    q->c_bytes = NULL;
+  }
+  if (!q->c_bytes) {
+    q->c_bytes = srslte_vec_malloc(len * sizeof(uint8_t)/8+8);
+    if (!q->c_bytes) {
+      return SRSLTE_ERROR;
     }
+    q->max_len = len;
+  }
+  q->len = len;
+  srslte_sequence_gen_LTE_pr_packed(q->c_bytes, len, seed);
+  return SRSLTE_SUCCESS;
+}
+
+int srslte_sequence_init(srslte_sequence_t *q, uint32_t len) {
+  // A packed-only sequence has c_bytes but none of the other buffers
+  if ((q->c && q->len != len) || (!q->c && q->c_bytes)) {
+    srslte_sequence_free(q);
   }
   if (!q->c) {
     q->c = srslte_vec_malloc(len * sizeof(uint8_t));
@@ -119,11 +153,30 @@ int srslte_sequence_init(srslte_sequence_t *q, uint32_t len) {
     if (!q->c_short) {
       return SRSLTE_ERROR;
     }
-    q->len = len;
+    q->len     = len;
+    q->max_len = len;
   }
   return SRSLTE_SUCCESS;
 }
 
+// Memory held by the buffers of the sequence
+uint32_t srslte_sequence_nof_bytes(srslte_sequence_t *q) {
+  uint32_t n = 0;
+  if (q->c) {
+    n += q->max_len * sizeof(uint8_t);
+  }
+  if (q->c_bytes) {
+    n += q->max_len * sizeof(uint8_t)/8+8;
+  }
+  if (q->c_float) {
+    n += q->max_len * sizeof(float);
+  }
+  if (q->c_short) {
+    n += q->max_len * sizeof(short);
+  }
+  return n;
+}
+
 void srslte_sequence_free(srslte_sequence_t *q) {
   if (q->c) {
     free(q->c);
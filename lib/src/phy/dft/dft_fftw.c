@@ -70,6 +70,29 @@ int srslte_dft_plan_c(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_
   return 0;
 }
 
+int srslte_dft_plan_c_batch(srslte_dft_plan_t *plan, const int dft_points, const int nof_dfts,
+                            srslte_dft_dir_t dir) {
+  allocate(plan,sizeof(fftwf_complex),sizeof(fftwf_complex), dft_points*nof_dfts);
+  int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
+  plan->p = fftwf_plan_many_dft(1, &dft_points, nof_dfts,
+                                plan->in, NULL, 1, dft_points,
+                                plan->out, NULL, 1, dft_points,
+                                sign, 0U);
+  if (!plan->p) {
+    return -1;
+  }
+  plan->size = dft_points;
+  plan->mode = SRSLTE_DFT_COMPLEX;
+  plan->dir = dir;
+  plan->forward = (dir==SRSLTE_DFT_FORWARD)?true:false;
+  plan->mirror = false;
+  plan->db = false;
+  plan->norm = false;
+  plan->dc = false;
+
+  return 0;
+}
+
 int srslte_dft_plan_r(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_dir_t dir) {
   allocate(plan,sizeof(float),sizeof(float), dft_points);
   int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
@@ -123,6 +123,10 @@ clean_exit:
 void srslte_enb_dl_free(srslte_enb_dl_t *q)
 {
   if (q) {
+    if (q->users_shared) {
+      // The users belong to the object they are shared from 
+      q->pdsch.users = NULL; 
+    }
     srslte_ofdm_tx_free(&q->ifft);
     srslte_regs_free(&q->regs);
     srslte_pcfich_free(&q->pcfich);
@@ -227,6 +231,31 @@ void srslte_enb_dl_rem_rnti(srslte_enb_dl_t *q, uint16_t rnti)
   srslte_pdsch_free_rnti(&q->pdsch, rnti);
 }
 
+/* Makes q use the users of src, which must have been initiated for the same cell and outlive q. 
+ * Users are then added and removed through src only. q must have no users. 
+ */
+void srslte_enb_dl_share_users(srslte_enb_dl_t *q, srslte_enb_dl_t *src)
+{
+  if (!q->users_shared) {
+    free(q->pdsch.users); 
+  }
+  q->pdsch.users  = src->pdsch.users; 
+  q->users_shared = true; 
+}
+
+// Memory held for the PDSCH sequences of a user 
+uint32_t srslte_enb_dl_user_nof_bytes(srslte_enb_dl_t *q, uint16_t rnti)
+{
+  uint32_t n = 0; 
+  if (q->pdsch.users[rnti]) {
+    n += sizeof(srslte_pdsch_user_t); 
+    for (int i=0;i<SRSLTE_NSUBFRAMES_X_FRAME;i++) {
+      n += srslte_sequence_nof_bytes(&q->pdsch.users[rnti]->seq[i]); 
+    }
+  }
+  return n; 
+}
+
 int srslte_enb_dl_put_pdcch_dl(srslte_enb_dl_t *q, srslte_ra_dl_dci_t *grant, 
                                srslte_dci_format_t format, srslte_dci_location_t location,
                                uint16_t rnti, uint32_t sf_idx) 
@@ -279,3 +308,48 @@ int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q, srslte_ra_dl_grant_t *grant, srs
   }        
   return SRSLTE_SUCCESS; 
 }
+
+int srslte_enb_dl_pdsch_enc_init(srslte_enb_dl_pdsch_enc_t *e, srslte_cell_t cell)
+{
+  bzero(e, sizeof(srslte_enb_dl_pdsch_enc_t));
+  if (srslte_pdsch_init(&e->pdsch, cell)) {
+    fprintf(stderr, "Error creating PDSCH object\n");
+    return SRSLTE_ERROR; 
+  }
+  // The scrambling sequences are those of the srslte_enb_dl_t encoding the subframe 
+  free(e->pdsch.users);
+  e->pdsch.users = NULL; 
+  return SRSLTE_SUCCESS; 
+}
+
+void srslte_enb_dl_pdsch_enc_free(srslte_enb_dl_pdsch_enc_t *e)
+{
+  if (e) {
+    e->pdsch.users = NULL; 
+    srslte_pdsch_free(&e->pdsch);
+    bzero(e, sizeof(srslte_enb_dl_pdsch_enc_t));
+  }
+}
+
+/* Encodes a PDSCH grant into the subframe of q with the encoder e. Several threads can encode 
+ * grants with non-overlapping resources at once, each with its own encoder. 
+ */
+int srslte_enb_dl_put_pdsch_enc(srslte_enb_dl_t *q, srslte_enb_dl_pdsch_enc_t *e, 
+                                srslte_ra_dl_grant_t *grant, srslte_softbuffer_tx_t *softbuffer,
+                                uint16_t rnti, uint32_t rv_idx, uint32_t sf_idx, 
+                                uint8_t *data) 
+{  
+  if (srslte_pdsch_cfg(&e->pdsch_cfg, q->cell, grant, q->cfi, sf_idx, rv_idx)) {
+    fprintf(stderr, "Error configuring PDSCH\n");
+    return SRSLTE_ERROR;
+  }
+  
+  e->pdsch.users = q->pdsch.users; 
+  int ret = srslte_pdsch_encode(&e->pdsch, &e->pdsch_cfg, softbuffer, data, rnti, q->sf_symbols); 
+  e->pdsch.users = NULL; 
+  if (ret) {
+    fprintf(stderr, "Error encoding PDSCH\n");
+    return SRSLTE_ERROR;
+  }        
+  return SRSLTE_SUCCESS; 
+}
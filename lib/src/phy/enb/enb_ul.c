@@ -60,7 +60,7 @@ int srslte_enb_ul_init(srslte_enb_ul_t *q, srslte_cell_t cell,
       memcpy(&q->hopping_cfg, hopping_cfg, sizeof(srslte_pusch_hopping_cfg_t));
     } 
     
-    q->users = calloc(sizeof(srslte_enb_ul_user_t*), SRSLTE_SIRNTI);
+    q->users = calloc(sizeof(srslte_enb_ul_user_t*), 1+SRSLTE_SIRNTI);
     if (!q->users) {
       perror("malloc");
       goto clean_exit;
@@ -134,8 +134,15 @@ void srslte_enb_ul_free(srslte_enb_ul_t *q)
 {
   if (q) {
     
+    if (q->users_shared) {
+      // The users belong to the object they are shared from 
+      q->users       = NULL; 
+      q->pusch.users = NULL; 
+      q->pucch.users = NULL; 
+    }
+    
     if (q->users) {
-      for (int i=0;i<SRSLTE_SIRNTI;i++) {
+      for (int i=0;i<=SRSLTE_SIRNTI;i++) {
         if (q->users[i]) {
           free(q->users[i]);
         }
@@ -161,7 +168,7 @@ void srslte_enb_ul_free(srslte_enb_ul_t *q)
 int srslte_enb_ul_add_rnti(srslte_enb_ul_t *q, uint16_t rnti)
 {
   if (!q->users[rnti]) {
-    q->users[rnti] = malloc(sizeof(srslte_enb_ul_user_t));
+    q->users[rnti] = calloc(1, sizeof(srslte_enb_ul_user_t));
     
     if (srslte_pucch_set_crnti(&q->pucch, rnti)) {
       fprintf(stderr, "Error setting PUCCH rnti\n");
@@ -184,7 +191,47 @@ void srslte_enb_ul_rem_rnti(srslte_enb_ul_t *q, uint16_t rnti)
     free(q->users[rnti]); 
     q->users[rnti] = NULL; 
     srslte_pusch_clear_rnti(&q->pusch, rnti);
+    srslte_pucch_clear_rnti(&q->pucch, rnti);
+  }
+}
+
+/* Makes q use the users of src, which must have been initiated for the same cell and outlive q. 
+ * Users are added, configured and removed through src only, and the per-user sequences and 
+ * configuration are held once no matter how many objects decode the subframes. q must have no users. 
+ */
+void srslte_enb_ul_share_users(srslte_enb_ul_t *q, srslte_enb_ul_t *src)
+{
+  if (!q->users_shared) {
+    free(q->users); 
+    free(q->pusch.users); 
+    free(q->pucch.users); 
   }
+  q->users       = src->users; 
+  q->pusch.users = src->pusch.users; 
+  q->pucch.users = src->pucch.users; 
+  q->users_shared = true; 
+}
+
+// Memory held for the configuration and the PUSCH and PUCCH sequences of a user 
+uint32_t srslte_enb_ul_user_nof_bytes(srslte_enb_ul_t *q, uint16_t rnti)
+{
+  uint32_t n = 0; 
+  if (q->users[rnti]) {
+    n += sizeof(srslte_enb_ul_user_t); 
+  }
+  if (q->pusch.users[rnti]) {
+    n += sizeof(srslte_pusch_user_t); 
+    for (int i=0;i<SRSLTE_NSUBFRAMES_X_FRAME;i++) {
+      n += srslte_sequence_nof_bytes(&q->pusch.users[rnti]->seq[i]); 
+    }
+  }
+  if (q->pucch.users[rnti]) {
+    n += sizeof(srslte_pucch_user_t); 
+    for (int i=0;i<SRSLTE_NSUBFRAMES_X_FRAME;i++) {
+      n += srslte_sequence_nof_bytes(&q->pucch.users[rnti]->seq_f2[i]); 
+    }
+  }
+  return n; 
 }
 
 int srslte_enb_ul_cfg_ue(srslte_enb_ul_t *q, uint16_t rnti, 
@@ -288,13 +335,15 @@ int srslte_enb_ul_get_pucch(srslte_enb_ul_t *q, uint16_t rnti,
   }
 }
 
-int srslte_enb_ul_get_pusch(srslte_enb_ul_t *q, srslte_ra_ul_grant_t *grant, srslte_softbuffer_rx_t *softbuffer, 
-                            uint16_t rnti, uint32_t rv_idx, uint32_t current_tx_nb, 
-                            uint8_t *data, srslte_uci_data_t *uci_data, uint32_t tti)
+static int get_pusch(srslte_enb_ul_t *q, srslte_pusch_t *pusch, srslte_pusch_cfg_t *pusch_cfg, 
+                     srslte_chest_ul_t *chest, cf_t *ce, 
+                     srslte_ra_ul_grant_t *grant, srslte_softbuffer_rx_t *softbuffer, 
+                     uint16_t rnti, uint32_t rv_idx, uint32_t current_tx_nb, 
+                     uint8_t *data, srslte_uci_data_t *uci_data, uint32_t tti)
 {
   if (q->users[rnti]) {
-    if (srslte_pusch_cfg(&q->pusch, 
-                        &q->pusch_cfg, 
+    if (srslte_pusch_cfg(pusch, 
+                        pusch_cfg, 
                         grant, 
                         q->users[rnti]->uci_cfg_en?&q->users[rnti]->uci_cfg:NULL, 
                         &q->hopping_cfg, 
@@ -304,8 +353,8 @@ int srslte_enb_ul_get_pusch(srslte_enb_ul_t *q, srslte_ra_ul_grant_t *grant, srs
       return SRSLTE_ERROR;
     }
   } else {
-      if (srslte_pusch_cfg(&q->pusch, 
-                        &q->pusch_cfg, 
+      if (srslte_pusch_cfg(pusch, 
+                        pusch_cfg, 
                         grant, 
                         NULL, 
                         &q->hopping_cfg, 
@@ -318,17 +367,85 @@ int srslte_enb_ul_get_pusch(srslte_enb_ul_t *q, srslte_ra_ul_grant_t *grant, srs
   
   uint32_t cyclic_shift_for_dmrs = 0; 
   
-  srslte_chest_ul_estimate(&q->chest, q->sf_symbols, q->ce, grant->L_prb, tti%10, cyclic_shift_for_dmrs, grant->n_prb);
+  srslte_chest_ul_estimate(chest, q->sf_symbols, ce, grant->L_prb, tti%10, cyclic_shift_for_dmrs, grant->n_prb);
   
-  float noise_power = srslte_chest_ul_get_noise_estimate(&q->chest); 
+  float noise_power = srslte_chest_ul_get_noise_estimate(chest); 
   
-  return srslte_pusch_decode(&q->pusch, &q->pusch_cfg, 
+  return srslte_pusch_decode(pusch, pusch_cfg, 
                               softbuffer, q->sf_symbols, 
-                              q->ce, noise_power, 
+                              ce, noise_power, 
                               rnti, data, 
                               uci_data);
 }
 
+int srslte_enb_ul_get_pusch(srslte_enb_ul_t *q, srslte_ra_ul_grant_t *grant, srslte_softbuffer_rx_t *softbuffer, 
+                            uint16_t rnti, uint32_t rv_idx, uint32_t current_tx_nb, 
+                            uint8_t *data, srslte_uci_data_t *uci_data, uint32_t tti)
+{
+  return get_pusch(q, &q->pusch, &q->pusch_cfg, &q->chest, q->ce, 
+                   grant, softbuffer, rnti, rv_idx, current_tx_nb, data, uci_data, tti);
+}
+
+int srslte_enb_ul_pusch_dec_init(srslte_enb_ul_pusch_dec_t *d, srslte_cell_t cell, 
+                                 srslte_refsignal_dmrs_pusch_cfg_t *pusch_cfg, 
+                                 srslte_pucch_cfg_t *pucch_cfg)
+{
+  bzero(d, sizeof(srslte_enb_ul_pusch_dec_t));
+  
+  if (srslte_pusch_init(&d->pusch, cell)) {
+    fprintf(stderr, "Error creating PUSCH object\n");
+    goto clean_exit;
+  }
+  // The scrambling sequences are those of the srslte_enb_ul_t decoding the subframe 
+  free(d->pusch.users);
+  d->pusch.users = NULL; 
+  
+  if (srslte_chest_ul_init(&d->chest, cell)) {
+    fprintf(stderr, "Error initiating channel estimator\n");
+    goto clean_exit; 
+  }
+  srslte_chest_ul_set_cfg(&d->chest, pusch_cfg, pucch_cfg, NULL);
+  
+  d->ce = srslte_vec_malloc(SRSLTE_SF_LEN_RE(cell.nof_prb, cell.cp) * sizeof(cf_t));
+  if (!d->ce) {
+    perror("malloc");
+    goto clean_exit; 
+  }
+  return SRSLTE_SUCCESS; 
+  
+clean_exit: 
+  srslte_enb_ul_pusch_dec_free(d);
+  return SRSLTE_ERROR; 
+}
+
+void srslte_enb_ul_pusch_dec_free(srslte_enb_ul_pusch_dec_t *d)
+{
+  if (d) {
+    d->pusch.users = NULL; 
+    srslte_pusch_free(&d->pusch);
+    srslte_chest_ul_free(&d->chest);
+    if (d->ce) {
+      free(d->ce);
+    }
+    bzero(d, sizeof(srslte_enb_ul_pusch_dec_t));
+  }
+}
+
+/* Decodes a PUSCH grant of the subframe in q with the decoder d. Several threads can decode 
+ * different grants at once, each with its own decoder, as long as q is not modified meanwhile. 
+ */
+int srslte_enb_ul_get_pusch_dec(srslte_enb_ul_t *q, srslte_enb_ul_pusch_dec_t *d, 
+                                srslte_ra_ul_grant_t *grant, srslte_softbuffer_rx_t *softbuffer, 
+                                uint16_t rnti, uint32_t rv_idx, uint32_t current_tx_nb, 
+                                uint8_t *data, srslte_uci_data_t *uci_data, uint32_t tti)
+{
+  d->pusch.users = q->pusch.users; 
+  int ret = get_pusch(q, &d->pusch, &d->pusch_cfg, &d->chest, d->ce, 
+                      grant, softbuffer, rnti, rv_idx, current_tx_nb, data, uci_data, tti);
+  d->pusch.users = NULL; 
+  return ret; 
+}
+
 
 int srslte_enb_ul_detect_prach(srslte_enb_ul_t *q, uint32_t tti, 
                                uint32_t freq_offset, cf_t *signal, 
@@ -0,0 +1,178 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+
+#include <sys/time.h>
+#include "srslte/srslte.h"
+
+/* Measures the single-core throughput of every available turbo decoder implementation for
+ * every LTE code block size */
+
+uint32_t nof_frames = 100;
+uint32_t nof_iterations = 4;
+float ebno_db = 4.0;
+int cb_size = -1;
+
+void usage(char *prog) {
+  printf("Usage: %s [nilev]\n", prog);
+  printf("\t-n nof_frames per code block size [Default %d]\n", nof_frames);
+  printf("\t-i nof_iterations [Default %d]\n", nof_iterations);
+  printf("\t-l code block size [Default all]\n");
+  printf("\t-e ebno in dB [Default %.1f]\n", ebno_db);
+  printf("\t-v srslte_verbose\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nilev")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_frames = atoi(argv[optind]);
+      break;
+    case 'i':
+      nof_iterations = atoi(argv[optind]);
+      break;
+    case 'l':
+      cb_size = atoi(argv[optind]);
+      break;
+    case 'e':
+      ebno_db = atof(argv[optind]);
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  srslte_tdec_impl_t impls[] = {SRSLTE_TDEC_GEN, SRSLTE_TDEC_SSE, SRSLTE_TDEC_AVX2};
+  uint32_t nof_impls = sizeof(impls)/sizeof(srslte_tdec_impl_t);
+  srslte_tdec_t tdec[3];
+  bool available[3];
+  srslte_tcod_t tcod;
+  struct timeval tdata[3];
+
+  parse_args(argc, argv);
+
+  uint32_t coded_length = 3*SRSLTE_TCOD_MAX_LEN_CB + SRSLTE_TCOD_TOTALTAIL;
+  uint8_t *data_tx       = srslte_vec_malloc(SRSLTE_TCOD_MAX_LEN_CB);
+  uint8_t *data_rx_bytes = srslte_vec_malloc(SRSLTE_TCOD_MAX_LEN_CB);
+  uint8_t *data_rx       = srslte_vec_malloc(SRSLTE_TCOD_MAX_LEN_CB);
+  uint8_t *symbols       = srslte_vec_malloc(coded_length);
+  float *llr             = srslte_vec_malloc(coded_length * sizeof(float));
+  int16_t *llr_s         = srslte_vec_malloc(coded_length * sizeof(int16_t));
+  if (!data_tx || !data_rx_bytes || !data_rx || !symbols || !llr || !llr_s) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  if (srslte_tcod_init(&tcod, SRSLTE_TCOD_MAX_LEN_CB)) {
+    fprintf(stderr, "Error initiating Turbo coder\n");
+    exit(-1);
+  }
+
+  printf("%6s", "CB");
+  for (uint32_t j=0;j<nof_impls;j++) {
+    available[j] = srslte_tdec_init_impl(&tdec[j], SRSLTE_TCOD_MAX_LEN_CB, impls[j]) == SRSLTE_SUCCESS;
+    if (available[j]) {
+      printf("  %10s Mbps  BER     ", srslte_tdec_impl_string(impls[j]));
+    }
+  }
+  printf("\n");
+
+  float esno_db = ebno_db + 10 * log10((double) 1 / 3);
+  float var = sqrt(1 / (pow(10, esno_db / 10)));
+
+  srand(0);
+  for (uint32_t cb_idx=0;cb_idx<SRSLTE_NOF_TC_CB_SIZES;cb_idx++) {
+    uint32_t long_cb = srslte_cbsegm_cbsize(cb_idx);
+    if (cb_size > 0 && long_cb != cb_size) {
+      continue;
+    }
+    uint32_t len = 3*long_cb + SRSLTE_TCOD_TOTALTAIL;
+
+    printf("%6d", long_cb);
+    for (uint32_t j=0;j<nof_impls;j++) {
+      if (!available[j]) {
+        continue;
+      }
+      uint64_t usec   = 0;
+      uint32_t errors = 0;
+      for (uint32_t n=0;n<nof_frames;n++) {
+        for (uint32_t i=0;i<long_cb;i++) {
+          data_tx[i] = rand()%2;
+        }
+        srslte_tcod_encode(&tcod, data_tx, symbols, long_cb);
+        for (uint32_t i=0;i<len;i++) {
+          llr[i] = symbols[i] ? 1 : -1;
+        }
+        srslte_ch_awgn_f(llr, llr, var, len);
+        for (uint32_t i=0;i<len;i++) {
+          llr_s[i] = (int16_t) (100*llr[i]);
+        }
+
+        gettimeofday(&tdata[1], NULL);
+        srslte_tdec_run_all(&tdec[j], llr_s, data_rx_bytes, nof_iterations, long_cb);
+        gettimeofday(&tdata[2], NULL);
+        get_time_interval(tdata);
+        usec += tdata[0].tv_sec*1000000 + tdata[0].tv_usec;
+
+        srslte_bit_unpack_vector(data_rx_bytes, data_rx, long_cb);
+        errors += srslte_bit_diff(data_tx, data_rx, long_cb);
+      }
+      printf("  %15.1f  %.2e", usec?(float) long_cb*nof_frames/usec:0, (float) errors/(long_cb*nof_frames));
+    }
+    printf("\n");
+  }
+
+  for (uint32_t j=0;j<nof_impls;j++) {
+    if (available[j]) {
+      srslte_tdec_free(&tdec[j]);
+    }
+  }
+  srslte_tcod_free(&tcod);
+
+  free(data_tx);
+  free(data_rx_bytes);
+  free(data_rx);
+  free(symbols);
+  free(llr);
+  free(llr_s);
+
+  printf("Done\n");
+  exit(0);
+}
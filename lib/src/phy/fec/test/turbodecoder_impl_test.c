@@ -0,0 +1,208 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "srslte/srslte.h"
+
+/* Decodes the same noisy code blocks with every turbo decoder implementation available in the
+ * build and on this CPU, for every LTE code block size, and checks that:
+ *  - all of them output the transmitted bits after nof_iterations when the first one does
+ *  - they output the same bits after every half iteration, except for the code blocks that the
+ *    AVX2 decoder splits in two windows, whose intermediate decisions differ by design
+ */
+
+uint32_t nof_frames = 10;
+uint32_t nof_iterations = 4;
+float ebno_db = 5.0;
+int cb_size = -1;
+
+void usage(char *prog) {
+  printf("Usage: %s [nilev]\n", prog);
+  printf("\t-n nof_frames per code block size [Default %d]\n", nof_frames);
+  printf("\t-i nof_iterations [Default %d]\n", nof_iterations);
+  printf("\t-l code block size [Default all]\n");
+  printf("\t-e ebno in dB [Default %.1f]\n", ebno_db);
+  printf("\t-v srslte_verbose\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nilev")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_frames = atoi(argv[optind]);
+      break;
+    case 'i':
+      nof_iterations = atoi(argv[optind]);
+      break;
+    case 'l':
+      cb_size = atoi(argv[optind]);
+      break;
+    case 'e':
+      ebno_db = atof(argv[optind]);
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  srslte_tdec_impl_t impls[] = {SRSLTE_TDEC_GEN, SRSLTE_TDEC_SSE, SRSLTE_TDEC_AVX2};
+  uint32_t nof_impls = sizeof(impls)/sizeof(srslte_tdec_impl_t);
+  srslte_tdec_t tdec[3];
+  bool available[3];
+  uint8_t *output[3];
+  srslte_tcod_t tcod;
+  uint32_t nof_available = 0;
+  uint32_t nof_errors = 0;
+
+  parse_args(argc, argv);
+
+  uint32_t coded_length = 3*SRSLTE_TCOD_MAX_LEN_CB + SRSLTE_TCOD_TOTALTAIL;
+  uint8_t *data_tx = srslte_vec_malloc(SRSLTE_TCOD_MAX_LEN_CB);
+  uint8_t *data_packed = srslte_vec_malloc(SRSLTE_TCOD_MAX_LEN_CB/8);
+  uint8_t *symbols = srslte_vec_malloc(coded_length);
+  float *llr       = srslte_vec_malloc(coded_length * sizeof(float));
+  int16_t *llr_s   = srslte_vec_malloc(coded_length * sizeof(int16_t));
+  if (!data_tx || !data_packed || !symbols || !llr || !llr_s) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  if (srslte_tcod_init(&tcod, SRSLTE_TCOD_MAX_LEN_CB)) {
+    fprintf(stderr, "Error initiating Turbo coder\n");
+    exit(-1);
+  }
+
+  for (uint32_t j=0;j<nof_impls;j++) {
+    available[j] = srslte_tdec_init_impl(&tdec[j], SRSLTE_TCOD_MAX_LEN_CB, impls[j]) == SRSLTE_SUCCESS;
+    output[j]    = srslte_vec_malloc(SRSLTE_TCOD_MAX_LEN_CB/8);
+    if (!output[j]) {
+      perror("malloc");
+      exit(-1);
+    }
+    if (available[j]) {
+      printf("Testing %s turbo decoder\n", srslte_tdec_impl_string(impls[j]));
+      nof_available++;
+    }
+  }
+  if (nof_available < 2) {
+    printf("Only %d implementation available, nothing to compare\n", nof_available);
+  }
+
+  float esno_db = ebno_db + 10 * log10((double) 1 / 3);
+  float var = sqrt(1 / (pow(10, esno_db / 10)));
+
+  srand(0);
+  for (uint32_t cb_idx=0;cb_idx<SRSLTE_NOF_TC_CB_SIZES;cb_idx++) {
+    uint32_t long_cb = srslte_cbsegm_cbsize(cb_idx);
+    if (cb_size > 0 && long_cb != cb_size) {
+      continue;
+    }
+    uint32_t len = 3*long_cb + SRSLTE_TCOD_TOTALTAIL;
+
+    for (uint32_t n=0;n<nof_frames;n++) {
+      for (uint32_t i=0;i<long_cb;i++) {
+        data_tx[i] = rand()%2;
+      }
+      srslte_tcod_encode(&tcod, data_tx, symbols, long_cb);
+      for (uint32_t i=0;i<len;i++) {
+        llr[i] = symbols[i] ? 1 : -1;
+      }
+      srslte_ch_awgn_f(llr, llr, var, len);
+      for (uint32_t i=0;i<len;i++) {
+        llr_s[i] = (int16_t) (100*llr[i]);
+      }
+
+      for (uint32_t j=0;j<nof_impls;j++) {
+        if (available[j]) {
+          srslte_tdec_reset(&tdec[j], long_cb);
+        }
+      }
+      srslte_bit_pack_vector(data_tx, data_packed, long_cb);
+      for (uint32_t h=1;h<=2*nof_iterations;h++) {
+        int ref = -1;
+        for (uint32_t j=0;j<nof_impls;j++) {
+          if (!available[j]) {
+            continue;
+          }
+          srslte_tdec_half_iteration(&tdec[j], llr_s, long_cb);
+          srslte_tdec_decision_byte(&tdec[j], output[j], long_cb);
+          if (ref < 0) {
+            ref = j;
+          } else if (long_cb < SRSLTE_TDEC_AVX_MIN_LONG_CB_WINDOWED && memcmp(output[ref], output[j], long_cb/8)) {
+            if (nof_errors < 10) {
+              printf("CB %d, frame %d, half iteration %d: %s and %s decoders differ\n", long_cb, n, h,
+                     srslte_tdec_impl_string(impls[ref]), srslte_tdec_impl_string(impls[j]));
+            }
+            nof_errors++;
+          }
+          if (h == 2*nof_iterations && !memcmp(data_packed, output[ref], long_cb/8) &&
+              memcmp(data_packed, output[j], long_cb/8))
+          {
+            if (nof_errors < 10) {
+              printf("CB %d, frame %d: %s decoder outputs the transmitted bits and %s does not\n", long_cb, n,
+                     srslte_tdec_impl_string(impls[ref]), srslte_tdec_impl_string(impls[j]));
+            }
+            nof_errors++;
+          }
+        }
+      }
+    }
+  }
+
+  for (uint32_t j=0;j<nof_impls;j++) {
+    if (available[j]) {
+      srslte_tdec_free(&tdec[j]);
+    }
+    free(output[j]);
+  }
+  srslte_tcod_free(&tcod);
+
+  free(data_tx);
+  free(data_packed);
+  free(symbols);
+  free(llr);
+  free(llr_s);
+
+  if (nof_errors) {
+    printf("%d mismatches\n", nof_errors);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
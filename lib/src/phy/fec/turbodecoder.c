@@ -38,75 +38,229 @@
 #include "srslte/phy/fec/turbodecoder_sse.h"
 #endif
 
+#ifdef LV_HAVE_AVX2
+#include "srslte/phy/fec/turbodecoder_avx.h"
+#endif
+
 #include "srslte/phy/utils/vector.h"
 
+/* Selects the widest implementation supported by the build and by the selected SIMD level */
+static srslte_tdec_impl_t tdec_default_impl() {
+#ifdef LV_HAVE_AVX2
+  if (srslte_simd_get_level() >= SRSLTE_SIMD_AVX2) {
+    return SRSLTE_TDEC_AVX2;
+  }
+#endif
+#ifdef LV_HAVE_SSE
+  // The generic decoder is not built when SSE is the baseline
+  return SRSLTE_TDEC_SSE;
+#else
+  return SRSLTE_TDEC_GEN;
+#endif
+}
+
+const char* srslte_tdec_impl_string(srslte_tdec_impl_t impl) {
+  switch(impl) {
+    case SRSLTE_TDEC_GEN:
+      return "gen";
+    case SRSLTE_TDEC_SSE:
+      return "sse";
+    case SRSLTE_TDEC_AVX2:
+      return "avx2";
+    default:
+      return "auto";
+  }
+}
+
+srslte_tdec_impl_t srslte_tdec_get_impl(srslte_tdec_t * h) {
+  return h->impl; 
+}
 
 int srslte_tdec_init(srslte_tdec_t * h, uint32_t max_long_cb) {
+  return srslte_tdec_init_impl(h, max_long_cb, SRSLTE_TDEC_AUTO);
+}
+
+int srslte_tdec_init_impl(srslte_tdec_t * h, uint32_t max_long_cb, srslte_tdec_impl_t impl) {
+  if (impl == SRSLTE_TDEC_AUTO) {
+    impl = tdec_default_impl();
+  }
+  h->impl = impl; 
+  switch(impl) {
 #ifdef LV_HAVE_SSE
-  return srslte_tdec_sse_init(&h->tdec_sse, max_long_cb);
+    case SRSLTE_TDEC_SSE:
+      return srslte_tdec_sse_init(&h->tdec_sse, max_long_cb);
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      if (!__builtin_cpu_supports("avx2")) {
+        fprintf(stderr, "Error AVX2 turbo decoder not supported by this CPU\n");
+        return -1;
+      }
+      return srslte_tdec_avx_init(&h->tdec_avx, max_long_cb);
+#endif
 #else
-  h->input_conv = srslte_vec_malloc(sizeof(float) * (3*max_long_cb+12));
-  if (!h->input_conv) {
-    perror("malloc");
-    return -1;
-  }
-  return srslte_tdec_gen_init(&h->tdec_gen, max_long_cb);
+    case SRSLTE_TDEC_GEN:
+      h->input_conv = srslte_vec_malloc(sizeof(float) * (3*max_long_cb+12));
+      if (!h->input_conv) {
+        perror("malloc");
+        return -1;
+      }
+      return srslte_tdec_gen_init(&h->tdec_gen, max_long_cb);
 #endif
+    default:
+      fprintf(stderr, "Error turbo decoder implementation %s not available\n", srslte_tdec_impl_string(impl));
+      return -1;
+  }
 }
 
 void srslte_tdec_free(srslte_tdec_t * h) {
+  switch(h->impl) {
 #ifdef LV_HAVE_SSE
-  srslte_tdec_sse_free(&h->tdec_sse);
+    case SRSLTE_TDEC_SSE:
+      srslte_tdec_sse_free(&h->tdec_sse);
+      break;
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      srslte_tdec_avx_free(&h->tdec_avx);
+      break;
+#endif
 #else
-  if (h->input_conv) {
-    free(h->input_conv);
-  }
-  srslte_tdec_gen_free(&h->tdec_gen);
+    case SRSLTE_TDEC_GEN:
+      if (h->input_conv) {
+        free(h->input_conv);
+      }
+      srslte_tdec_gen_free(&h->tdec_gen);
+      break;
 #endif
-
+    default:
+      break;
+  }
 }
 
 int srslte_tdec_reset(srslte_tdec_t * h, uint32_t long_cb) {
+  switch(h->impl) {
 #ifdef LV_HAVE_SSE
-  return srslte_tdec_sse_reset(&h->tdec_sse, long_cb);
+    case SRSLTE_TDEC_SSE:
+      return srslte_tdec_sse_reset(&h->tdec_sse, long_cb);
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      return srslte_tdec_avx_reset(&h->tdec_avx, long_cb);
+#endif
 #else
-  return srslte_tdec_gen_reset(&h->tdec_gen, long_cb);
+    case SRSLTE_TDEC_GEN:
+      return srslte_tdec_gen_reset(&h->tdec_gen, long_cb);
 #endif
+    default:
+      return -1;
+  }
 }
 
 void srslte_tdec_iteration(srslte_tdec_t * h, int16_t* input, uint32_t long_cb) {
+  switch(h->impl) {
 #ifdef LV_HAVE_SSE
-  srslte_tdec_sse_iteration(&h->tdec_sse, input, long_cb);
+    case SRSLTE_TDEC_SSE:
+      srslte_tdec_sse_iteration(&h->tdec_sse, input, long_cb);
+      break;
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      srslte_tdec_avx_iteration(&h->tdec_avx, input, long_cb);
+      break;
+#endif
 #else
-  srslte_vec_convert_if(input, h->input_conv, 0.01, 3*long_cb+12);
-  srslte_tdec_gen_iteration(&h->tdec_gen, h->input_conv, long_cb);
+    case SRSLTE_TDEC_GEN:
+      srslte_vec_convert_if(input, h->input_conv, 0.01, 3*long_cb+12);
+      srslte_tdec_gen_iteration(&h->tdec_gen, h->input_conv, long_cb);
+      break;
 #endif
+    default:
+      break;
+  }
 }
 
-void srslte_tdec_decision(srslte_tdec_t * h, uint8_t *output, uint32_t long_cb) {
+/* Runs half a turbo decoder iteration. srslte_tdec_decision() and srslte_tdec_decision_byte() 
+ * can be called after every half iteration. 
+ */
+void srslte_tdec_half_iteration(srslte_tdec_t * h, int16_t* input, uint32_t long_cb) {
+  switch(h->impl) {
 #ifdef LV_HAVE_SSE
-  return srslte_tdec_sse_decision(&h->tdec_sse, output, long_cb);
+    case SRSLTE_TDEC_SSE:
+      srslte_tdec_sse_half_iteration(&h->tdec_sse, input, long_cb);
+      break;
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      srslte_tdec_avx_half_iteration(&h->tdec_avx, input, long_cb);
+      break;
+#endif
 #else
-  return srslte_tdec_gen_decision(&h->tdec_gen, output, long_cb);
+    case SRSLTE_TDEC_GEN:
+      if (!h->tdec_gen.half_it) {
+        srslte_vec_convert_if(input, h->input_conv, 0.01, 3*long_cb+12);
+      }
+      srslte_tdec_gen_half_iteration(&h->tdec_gen, h->input_conv, long_cb);
+      break;
 #endif
+    default:
+      break;
+  }
+}
 
+void srslte_tdec_decision(srslte_tdec_t * h, uint8_t *output, uint32_t long_cb) {
+  switch(h->impl) {
+#ifdef LV_HAVE_SSE
+    case SRSLTE_TDEC_SSE:
+      srslte_tdec_sse_decision(&h->tdec_sse, output, long_cb);
+      break;
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      srslte_tdec_avx_decision(&h->tdec_avx, output, long_cb);
+      break;
+#endif
+#else
+    case SRSLTE_TDEC_GEN:
+      srslte_tdec_gen_decision(&h->tdec_gen, output, long_cb);
+      break;
+#endif
+    default:
+      break;
+  }
 }
 
 void srslte_tdec_decision_byte(srslte_tdec_t * h, uint8_t *output, uint32_t long_cb) {
+  switch(h->impl) {
 #ifdef LV_HAVE_SSE
-  return srslte_tdec_sse_decision_byte(&h->tdec_sse, output, long_cb);
+    case SRSLTE_TDEC_SSE:
+      srslte_tdec_sse_decision_byte(&h->tdec_sse, output, long_cb);
+      break;
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      srslte_tdec_avx_decision_byte(&h->tdec_avx, output, long_cb);
+      break;
+#endif
 #else
-  return srslte_tdec_gen_decision_byte(&h->tdec_gen, output, long_cb);
+    case SRSLTE_TDEC_GEN:
+      srslte_tdec_gen_decision_byte(&h->tdec_gen, output, long_cb);
+      break;
 #endif
-  
+    default:
+      break;
+  }
 }
 
 int srslte_tdec_run_all(srslte_tdec_t * h, int16_t * input, uint8_t *output, uint32_t nof_iterations, uint32_t long_cb)
 {
+  switch(h->impl) {
 #ifdef LV_HAVE_SSE
-  return srslte_tdec_sse_run_all(&h->tdec_sse, input, output, nof_iterations, long_cb);
+    case SRSLTE_TDEC_SSE:
+      return srslte_tdec_sse_run_all(&h->tdec_sse, input, output, nof_iterations, long_cb);
+#ifdef LV_HAVE_AVX2
+    case SRSLTE_TDEC_AVX2:
+      return srslte_tdec_avx_run_all(&h->tdec_avx, input, output, nof_iterations, long_cb);
+#endif
 #else
-  srslte_vec_convert_if(input, h->input_conv, 0.01, 3*long_cb+12);
-  return srslte_tdec_gen_run_all(&h->tdec_gen, h->input_conv, output, nof_iterations, long_cb);
+    case SRSLTE_TDEC_GEN:
+      srslte_vec_convert_if(input, h->input_conv, 0.01, 3*long_cb+12);
+      return srslte_tdec_gen_run_all(&h->tdec_gen, h->input_conv, output, nof_iterations, long_cb);
 #endif
+    default:
+      return -1;
+  }
 }
@@ -0,0 +1,627 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+
+#include "srslte/phy/fec/turbodecoder_avx.h"
+#include "srslte/phy/fec/turbodecoder_sse.h"
+#include "srslte/phy/utils/vector.h"
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+
+#define NUMSTATES       8
+#define NINPUTS         2
+#define TAIL            3
+#define TOTALTAIL       12
+
+#define INF 10000
+#define ZERO 0
+
+
+#ifdef LV_HAVE_AVX2
+
+/* The code block is split in two windows of long_cb/2 bits. The lower 128-bit lane of every
+ * register processes the first window and the upper lane the second one. All the trellis
+ * shuffles operate within 128-bit lanes, so the masks are the same used by the SSE decoder.
+ * Short code blocks lose too much performance with the window approximation. In that case
+ * both lanes decode the whole code block and the upper one is just discarded. 
+ */
+#define LANES(lo, hi) _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1)
+
+/* Computes the horizontal MAX of the 8 states of each 128-bit lane. The result is left in
+ * the first 16-bit element of each lane */
+static inline __m256i hMax2(__m256i x)
+{
+  x = _mm256_max_epi16(x, _mm256_shuffle_epi32(x, 0x4E));
+  x = _mm256_max_epi16(x, _mm256_shuffle_epi32(x, 0xB1));
+  x = _mm256_max_epi16(x, _mm256_srli_epi32(x, 16));
+  return x;
+}
+
+/* Computes the horizontal MAX of the 8 states of the lower lane using the minpos_epu16 
+ * SSE4.1 instruction. Returns 0x7FFF-max */
+static inline int16_t hMax(__m256i x)
+{
+  __m128i tmp = _mm_sub_epi16(_mm_set1_epi16(0x7FFF), _mm256_castsi256_si128(x));
+  return (int16_t) _mm_cvtsi128_si32(_mm_minpos_epu16(tmp));
+}
+
+/* Computes beta values */
+static void map_avx_beta(map_avx_t * s, int16_t * output, int16_t *win_beta, uint32_t long_cb)
+{
+  int k;
+  uint32_t end = long_cb + 3;
+  uint32_t win_len = long_cb>=SRSLTE_TDEC_AVX_MIN_LONG_CB_WINDOWED?long_cb/2:long_cb;
+  uint32_t win_off = long_cb-win_len;
+  const __m256i *alphaPtr = (const __m256i*) s->alpha;
+
+  __m256i g, bp, bn, alpha_k, beta_k, dif;
+
+  /* Define the shuffle constant for the positive beta */
+  __m128i shuf_bp_128 = _mm_set_epi8(
+    15, 14, // 7
+    7,  6,  // 3
+    5,  4,  // 2
+    13, 12, // 6
+    11, 10, // 5
+    3,  2,  // 1
+    1,  0,  // 0
+    9,  8   // 4
+  );
+
+  /* Define the shuffle constant for the negative beta */
+  __m128i shuf_bn_128 = _mm_set_epi8(
+    7,   6, // 3
+    15, 14, // 7
+    13, 12, // 6
+    5,  4,  // 2
+    3,  2,  // 1
+    11, 10, // 5
+    9,  8,  // 4
+    1,  0   // 0
+  );
+
+  /* The tail only affects the last window. Compute it with 128-bit registers */
+  __m128i beta_tail = _mm_set_epi16(-INF, -INF, -INF, -INF, -INF, -INF, -INF, 0);
+  for (k=end-1; k>=long_cb; k--) {
+    int16_t g0 = s->branch[2*k];
+    int16_t g1 = s->branch[2*k+1];
+    __m128i gt  = _mm_set_epi16(g1, g0, g0, g1, g1, g0, g0, g1);
+    __m128i bpt = _mm_shuffle_epi8(_mm_add_epi16(beta_tail, gt), shuf_bp_128);
+    __m128i bnt = _mm_shuffle_epi8(_mm_sub_epi16(beta_tail, gt), shuf_bn_128);
+    beta_tail = _mm_max_epi16(bpt, bnt);
+  }
+
+  __m256i shuf_bp = _mm256_broadcastsi128_si256(shuf_bp_128);
+  __m256i shuf_bn = _mm256_broadcastsi128_si256(shuf_bn_128);
+
+  /* The first window starts from the boundary metrics of the previous iteration */
+  if (win_off) {
+    beta_k = LANES(_mm_loadu_si128((__m128i*) win_beta), beta_tail);
+  } else {
+    beta_k = LANES(beta_tail, beta_tail);
+  }
+
+  alphaPtr += win_len-1;
+
+  /* Define shuffle for branch costs */
+  __m256i shuf_g[4];
+  shuf_g[3] = _mm256_broadcastsi128_si256(_mm_set_epi8(3,2,1,0,1,0,3,2,3,2,1,0,1,0,3,2));
+  shuf_g[2] = _mm256_broadcastsi128_si256(_mm_set_epi8(7,6,5,4,5,4,7,6,7,6,5,4,5,4,7,6));
+  shuf_g[1] = _mm256_broadcastsi128_si256(_mm_set_epi8(11,10,9,8,9,8,11,10,11,10,9,8,9,8,11,10));
+  shuf_g[0] = _mm256_broadcastsi128_si256(_mm_set_epi8(15,14,13,12,13,12,15,14,15,14,13,12,13,12,15,14));
+  __m256i gv;
+  __m128i *gPtr0 = (__m128i*) &s->branch[2*win_len-8];
+  __m128i *gPtr1 = (__m128i*) &s->branch[2*(win_off+win_len)-8];
+  /* Define shuffle for beta normalization */
+  __m256i shuf_norm = _mm256_broadcastsi128_si256(_mm_set_epi8(1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0));
+
+#define BETA_STEP(g)     bp = _mm256_add_epi16(beta_k, g);\
+    bn = _mm256_sub_epi16(beta_k, g);\
+    bp = _mm256_shuffle_epi8(bp, shuf_bp);\
+    bn = _mm256_shuffle_epi8(bn, shuf_bn);\
+    beta_k = _mm256_max_epi16(bp, bn);
+
+    /* Loads the alpha metrics of both windows, computes the horizontal maximum of each lane
+     * and writes the LLR of the two windows */
+#define BETA_STEP_CNT(c,d) g = _mm256_shuffle_epi8(gv, shuf_g[c]);\
+    BETA_STEP(g)\
+    alpha_k = _mm256_load_si256(alphaPtr);\
+    alphaPtr--;\
+    bp = _mm256_add_epi16(bp, alpha_k);\
+    bn = _mm256_add_epi16(bn, alpha_k);\
+    dif = _mm256_sub_epi16(hMax2(bp), hMax2(bn));\
+    output[k-d]         = (int16_t) _mm256_extract_epi16(dif, 0);\
+    output[win_off+k-d] = (int16_t) _mm256_extract_epi16(dif, 8);
+
+    /* Same as above when both lanes decode the same window */
+#define BETA_STEP_CNT_SINGLE(c,d) g = _mm256_shuffle_epi8(gv, shuf_g[c]);\
+    BETA_STEP(g)\
+    alpha_k = _mm256_load_si256(alphaPtr);\
+    alphaPtr--;\
+    bp = _mm256_add_epi16(bp, alpha_k);\
+    bn = _mm256_add_epi16(bn, alpha_k);\
+    output[k-d] = hMax(bn) - hMax(bp);
+
+  /* We inline 4 trellis steps for each normalization */
+  __m256i norm;
+  for (k = win_len-1; k >= 0; k-=4) {
+    gv = LANES(_mm_load_si128(gPtr0), _mm_load_si128(gPtr1));
+    gPtr0--;
+    gPtr1--;
+    if (win_off) {
+      BETA_STEP_CNT(0,0);
+      BETA_STEP_CNT(1,1);
+      BETA_STEP_CNT(2,2);
+      BETA_STEP_CNT(3,3);
+    } else {
+      BETA_STEP_CNT_SINGLE(0,0);
+      BETA_STEP_CNT_SINGLE(1,1);
+      BETA_STEP_CNT_SINGLE(2,2);
+      BETA_STEP_CNT_SINGLE(3,3);
+    }
+    norm = _mm256_shuffle_epi8(beta_k, shuf_norm);
+    beta_k = _mm256_sub_epi16(beta_k, norm);
+  }
+
+  /* The second window ends at the boundary where the first one will start next iteration */
+  _mm_storeu_si128((__m128i*) win_beta, _mm256_extracti128_si256(beta_k, 1));
+}
+
+/* Computes alpha metrics */
+static void map_avx_alpha(map_avx_t * s, int16_t *win_alpha, uint32_t long_cb)
+{
+  uint32_t k;
+  uint32_t win_len = long_cb>=SRSLTE_TDEC_AVX_MIN_LONG_CB_WINDOWED?long_cb/2:long_cb;
+  uint32_t win_off = long_cb-win_len;
+
+  /* Define the shuffle constant for the positive alpha */
+  __m256i shuf_ap = _mm256_broadcastsi128_si256(_mm_set_epi8(
+    15, 14, // 7
+    9,  8,  // 4
+    7,  6,  // 3
+    1,  0,  // 0
+    13, 12, // 6
+    11, 10, // 5
+    5,  4,  // 2
+    3,  2   // 1
+  ));
+
+  /* Define the shuffle constant for the negative alpha */
+  __m256i shuf_an = _mm256_broadcastsi128_si256(_mm_set_epi8(
+    13, 12, // 6
+    11, 10, // 5
+    5,  4,  // 2
+    3,  2,  // 1
+    15, 14, // 7
+    9,  8,  // 4
+    7,  6,  // 3
+    1,  0   // 0
+  ));
+
+  /* Define shuffle for branch costs */
+  __m256i shuf_g[4];
+  shuf_g[0] = _mm256_broadcastsi128_si256(_mm_set_epi8(3,2,3,2,1,0,1,0,1,0,1,0,3,2,3,2));
+  shuf_g[1] = _mm256_broadcastsi128_si256(_mm_set_epi8(7,6,7,6,5,4,5,4,5,4,5,4,7,6,7,6));
+  shuf_g[2] = _mm256_broadcastsi128_si256(_mm_set_epi8(11,10,11,10,9,8,9,8,9,8,9,8,11,10,11,10));
+  shuf_g[3] = _mm256_broadcastsi128_si256(_mm_set_epi8(15,14,15,14,13,12,13,12,13,12,13,12,15,14,15,14));
+
+  __m256i shuf_norm = _mm256_broadcastsi128_si256(_mm_set_epi8(1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0));
+
+  __m256i* alphaPtr = (__m256i*) s->alpha;
+
+  __m256i gv;
+  __m128i *gPtr0 = (__m128i*) s->branch;
+  __m128i *gPtr1 = (__m128i*) &s->branch[2*win_off];
+  __m256i g, ap, an;
+
+  /* The first window starts at the zero state, the second one from the boundary metrics of
+   * the previous iteration */
+  __m128i alpha_0 = _mm_set_epi16(-INF, -INF, -INF, -INF, -INF, -INF, -INF, 0);
+  __m256i alpha_k = LANES(alpha_0, win_off?_mm_loadu_si128((__m128i*) win_alpha):alpha_0);
+  _mm256_store_si256(alphaPtr, alpha_k);
+  alphaPtr++;
+
+#define ALPHA_STEP(c)  g = _mm256_shuffle_epi8(gv, shuf_g[c]); \
+  ap = _mm256_add_epi16(alpha_k, g);\
+  an = _mm256_sub_epi16(alpha_k, g);\
+  ap = _mm256_shuffle_epi8(ap, shuf_ap);\
+  an = _mm256_shuffle_epi8(an, shuf_an);\
+  alpha_k = _mm256_max_epi16(ap, an);\
+  _mm256_store_si256(alphaPtr, alpha_k);\
+  alphaPtr++;    \
+
+  /* In this loop, we compute 4 steps and normalize once for each branch metrics memory load */
+  __m256i norm;
+  for (k = 0; k < win_len/4; k++) {
+    gv = LANES(_mm_load_si128(gPtr0), _mm_load_si128(gPtr1));
+    gPtr0++;
+    gPtr1++;
+    ALPHA_STEP(0);
+    ALPHA_STEP(1);
+    ALPHA_STEP(2);
+    ALPHA_STEP(3);
+    norm = _mm256_shuffle_epi8(alpha_k, shuf_norm);
+    alpha_k = _mm256_sub_epi16(alpha_k, norm);
+  }
+
+  /* The first window ends at the boundary where the second one will start next iteration */
+  _mm_storeu_si128((__m128i*) win_alpha, _mm256_castsi256_si128(alpha_k));
+}
+
+/* Compute branch metrics (gamma) */
+static void map_avx_gamma(map_avx_t * h, int16_t *input, int16_t *app, int16_t *parity, uint32_t long_cb)
+{
+  __m256i in, ap, pa, g1, g0, lo, hi;
+
+  __m256i *inPtr  = (__m256i*) input;
+  __m256i *appPtr = (__m256i*) app;
+  __m256i *paPtr  = (__m256i*) parity;
+  __m256i *resPtr = (__m256i*) h->branch;
+
+  for (int i=0;i<long_cb/16;i++) {
+    in = _mm256_load_si256(inPtr);
+    inPtr++;
+    pa = _mm256_load_si256(paPtr);
+    paPtr++;
+
+    if (appPtr) {
+      ap = _mm256_load_si256(appPtr);
+      appPtr++;
+      in = _mm256_add_epi16(ap, in);
+    }
+
+    g1 = _mm256_srai_epi16(_mm256_add_epi16(in, pa), 1);
+    g0 = _mm256_srai_epi16(_mm256_sub_epi16(in, pa), 1);
+
+    /* Interleave (g0,g1) pairs. Unpacking works within lanes, so reorder them afterwards */
+    lo = _mm256_unpacklo_epi16(g0, g1);
+    hi = _mm256_unpackhi_epi16(g0, g1);
+
+    _mm256_store_si256(resPtr, _mm256_permute2x128_si256(lo, hi, 0x20));
+    resPtr++;
+    _mm256_store_si256(resPtr, _mm256_permute2x128_si256(lo, hi, 0x31));
+    resPtr++;
+  }
+
+  /* Code block sizes are multiple of 8 but not always of 16 */
+  if (long_cb%16) {
+    int i = long_cb-8;
+    __m128i in_128 = _mm_load_si128((__m128i*) &input[i]);
+    __m128i pa_128 = _mm_load_si128((__m128i*) &parity[i]);
+    if (app) {
+      in_128 = _mm_add_epi16(_mm_load_si128((__m128i*) &app[i]), in_128);
+    }
+    __m128i g1_128 = _mm_srai_epi16(_mm_add_epi16(in_128, pa_128), 1);
+    __m128i g0_128 = _mm_srai_epi16(_mm_sub_epi16(in_128, pa_128), 1);
+    _mm_store_si128((__m128i*) &h->branch[2*i],   _mm_unpacklo_epi16(g0_128, g1_128));
+    _mm_store_si128((__m128i*) &h->branch[2*i+8], _mm_unpackhi_epi16(g0_128, g1_128));
+  }
+
+  for (int i=long_cb;i<long_cb+3;i++) {
+    h->branch[2*i]   = (input[i] - parity[i])/2;
+    h->branch[2*i+1] = (input[i] + parity[i])/2;
+  }
+}
+
+/* Inititalizes constituent decoder object */
+static int map_avx_init(map_avx_t * h, int max_long_cb)
+{
+  bzero(h, sizeof(map_avx_t));
+  /* Alpha metrics of both lanes are stored for every trellis step of the window */
+  h->alpha = srslte_vec_malloc(sizeof(int16_t) * (max_long_cb + SRSLTE_TCOD_TOTALTAIL + 1) * NUMSTATES * 2);
+  if (!h->alpha) {
+    perror("srslte_vec_malloc");
+    return -1;
+  }
+  h->branch = srslte_vec_malloc(sizeof(int16_t) * (max_long_cb + SRSLTE_TCOD_TOTALTAIL + 1) * NUMSTATES);
+  if (!h->branch) {
+    perror("srslte_vec_malloc");
+    return -1;
+  }
+  h->max_long_cb = max_long_cb;
+  return 0;
+}
+
+static void map_avx_free(map_avx_t * h)
+{
+  if (h->alpha) {
+    free(h->alpha);
+  }
+  if (h->branch) {
+    free(h->branch);
+  }
+  bzero(h, sizeof(map_avx_t));
+}
+
+/* Runs one instance of a decoder */
+static void map_avx_dec(map_avx_t * h, int16_t * input, int16_t *app, int16_t * parity, int16_t * output,
+                        int16_t *win_alpha, int16_t *win_beta, uint32_t long_cb)
+{
+
+  // Compute branch metrics
+  map_avx_gamma(h, input, app, parity, long_cb);
+
+  // Forward recursion
+  map_avx_alpha(h, win_alpha, long_cb);
+
+  // Backwards recursion + LLR computation
+  map_avx_beta(h, output, win_beta, long_cb);
+
+}
+
+/* Initializes the turbo decoder object */
+int srslte_tdec_avx_init(srslte_tdec_avx_t * h, uint32_t max_long_cb)
+{
+  int ret = -1;
+  bzero(h, sizeof(srslte_tdec_avx_t));
+  uint32_t len = max_long_cb + SRSLTE_TCOD_TOTALTAIL;
+
+  h->max_long_cb = max_long_cb;
+
+  h->app1 = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->app1) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+  h->app2 = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->app2) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+  h->ext1 = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->ext1) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+  h->ext2 = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->ext2) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+  h->syst = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->syst) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+  h->parity0 = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->parity0) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+  h->parity1 = srslte_vec_malloc(sizeof(int16_t) * len);
+  if (!h->parity1) {
+    perror("srslte_vec_malloc");
+    goto clean_and_exit;
+  }
+
+  if (map_avx_init(&h->dec, h->max_long_cb)) {
+    goto clean_and_exit;
+  }
+
+  for (int i=0;i<SRSLTE_NOF_TC_CB_SIZES;i++) {
+    if (srslte_tc_interl_init(&h->interleaver[i], srslte_cbsegm_cbsize(i)) < 0) {
+      goto clean_and_exit;
+    }
+    srslte_tc_interl_LTE_gen(&h->interleaver[i], srslte_cbsegm_cbsize(i));
+  }
+  h->current_cbidx = -1;
+  ret = 0;
+clean_and_exit:if (ret == -1) {
+    srslte_tdec_avx_free(h);
+  }
+  return ret;
+}
+
+void srslte_tdec_avx_free(srslte_tdec_avx_t * h)
+{
+  if (h->app1) {
+    free(h->app1);
+  }
+  if (h->app2) {
+    free(h->app2);
+  }
+  if (h->ext1) {
+    free(h->ext1);
+  }
+  if (h->ext2) {
+    free(h->ext2);
+  }
+  if (h->syst) {
+    free(h->syst);
+  }
+  if (h->parity0) {
+    free(h->parity0);
+  }
+  if (h->parity1) {
+    free(h->parity1);
+  }
+
+  map_avx_free(&h->dec);
+
+  for (int i=0;i<SRSLTE_NOF_TC_CB_SIZES;i++) {
+    srslte_tc_interl_free(&h->interleaver[i]);
+  }
+
+  bzero(h, sizeof(srslte_tdec_avx_t));
+}
+
+/* Runs the next half iteration: MAP decoder #1 if a new iteration starts or MAP decoder #2
+ * otherwise. The hard decision after the first half is taken from the a posteriori output
+ * of decoder #1, allowing the caller to stop without running decoder #2.
+ */
+void srslte_tdec_avx_half_iteration(srslte_tdec_avx_t * h, int16_t * input, uint32_t long_cb)
+{
+
+  if (h->current_cbidx >= 0) {
+    uint16_t *inter   = h->interleaver[h->current_cbidx].forward;
+    uint16_t *deinter = h->interleaver[h->current_cbidx].reverse;
+
+    if (h->n_iter == 0 && !h->half_it) {
+      srslte_tdec_sse_deinterleave_input(input, h->syst, h->parity0, h->parity1, h->app2, long_cb);
+    }
+
+    if (!h->half_it) {
+      // Add apriori information to decoder 1
+      if (h->n_iter > 0) {
+        srslte_vec_sub_sss(h->app1, h->ext1, h->app1, long_cb);
+      }
+
+      // Run MAP DEC #1
+      if (h->n_iter == 0) {
+        map_avx_dec(&h->dec, h->syst, NULL, h->parity0, h->ext1, h->win_alpha[0], h->win_beta[0], long_cb);
+      } else {
+        map_avx_dec(&h->dec, h->syst, h->app1, h->parity0, h->ext1, h->win_alpha[0], h->win_beta[0], long_cb);
+      }
+
+      h->half_it = true;
+    } else {
+      // Convert aposteriori information into extrinsic information
+      if (h->n_iter > 0) {
+        srslte_vec_sub_sss(h->ext1, h->app1, h->ext1, long_cb);
+      }
+
+      // Interleave extrinsic output of DEC1 to form apriori info for decoder 2
+      srslte_vec_lut_sss(h->ext1, deinter, h->app2, long_cb);
+
+      // Run MAP DEC #2. 2nd decoder uses apriori information as systematic bits
+      map_avx_dec(&h->dec, h->app2, NULL, h->parity1, h->ext2, h->win_alpha[1], h->win_beta[1], long_cb);
+
+      // Deinterleaved extrinsic bits become apriori info for decoder 1
+      srslte_vec_lut_sss(h->ext2, inter, h->app1, long_cb);
+
+      h->half_it = false;
+      h->n_iter++;
+    }
+  } else {
+    fprintf(stderr, "Error CB index not set (call srslte_tdec_avx_reset() first\n");
+  }
+}
+
+/* Runs 1 turbo decoder iteration */
+void srslte_tdec_avx_iteration(srslte_tdec_avx_t * h, int16_t * input, uint32_t long_cb)
+{
+  srslte_tdec_avx_half_iteration(h, input, long_cb);
+  if (h->half_it) {
+    srslte_tdec_avx_half_iteration(h, input, long_cb);
+  }
+}
+
+/* Resets the decoder and sets the codeblock length */
+int srslte_tdec_avx_reset(srslte_tdec_avx_t * h, uint32_t long_cb)
+{
+  if (long_cb > h->max_long_cb) {
+    fprintf(stderr, "TDEC was initialized for max_long_cb=%d\n",
+            h->max_long_cb);
+    return -1;
+  }
+  h->n_iter = 0;
+  h->half_it = false;
+  h->current_cbidx = srslte_cbsegm_cbindex(long_cb);
+  if (h->current_cbidx < 0) {
+    fprintf(stderr, "Invalid CB length %d\n", long_cb);
+    return -1;
+  }
+  /* Window boundaries start equiprobable */
+  bzero(h->win_alpha, sizeof(h->win_alpha));
+  bzero(h->win_beta, sizeof(h->win_beta));
+  return 0;
+}
+
+void srslte_tdec_avx_decision(srslte_tdec_avx_t * h, uint8_t *output, uint32_t long_cb)
+{
+  int16_t *app = h->half_it?h->ext1:h->app1;
+  __m256i zero     = _mm256_set1_epi16(0);
+  __m256i lsb_mask = _mm256_set1_epi16(1);
+
+  __m256i *appPtr = (__m256i*) app;
+  __m256i *outPtr = (__m256i*) output;
+  __m256i ap, out, out0, out1;
+
+  for (uint32_t i = 0; i < long_cb/32; i++) {
+    ap   = _mm256_load_si256(appPtr); appPtr++;
+    out0 = _mm256_and_si256(_mm256_cmpgt_epi16(ap, zero), lsb_mask);
+    ap   = _mm256_load_si256(appPtr); appPtr++;
+    out1 = _mm256_and_si256(_mm256_cmpgt_epi16(ap, zero), lsb_mask);
+
+    /* Packing works within lanes, restore the order of the 64-bit blocks */
+    out  = _mm256_permute4x64_epi64(_mm256_packs_epi16(out0, out1), 0xD8);
+    _mm256_storeu_si256(outPtr, out);
+    outPtr++;
+  }
+  for (uint32_t i = 32*(long_cb/32); i < long_cb; i++) {
+    output[i] = app[i]>0?1:0;
+  }
+}
+
+void srslte_tdec_avx_decision_byte(srslte_tdec_avx_t * h, uint8_t *output, uint32_t long_cb)
+{
+  int16_t *app = h->half_it?h->ext1:h->app1;
+  uint8_t mask[8] = {0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1};
+
+  // long_cb is always byte aligned
+  for (uint32_t i = 0; i < long_cb/8; i++) {
+    uint8_t out0 = app[8*i+0]>0?mask[0]:0;
+    uint8_t out1 = app[8*i+1]>0?mask[1]:0;
+    uint8_t out2 = app[8*i+2]>0?mask[2]:0;
+    uint8_t out3 = app[8*i+3]>0?mask[3]:0;
+    uint8_t out4 = app[8*i+4]>0?mask[4]:0;
+    uint8_t out5 = app[8*i+5]>0?mask[5]:0;
+    uint8_t out6 = app[8*i+6]>0?mask[6]:0;
+    uint8_t out7 = app[8*i+7]>0?mask[7]:0;
+
+    output[i] = out0 | out1 | out2 | out3 | out4 | out5 | out6 | out7;
+  }
+}
+
+/* Runs nof_iterations iterations and decides the output bits */
+int srslte_tdec_avx_run_all(srslte_tdec_avx_t * h, int16_t * input, uint8_t *output,
+                  uint32_t nof_iterations, uint32_t long_cb)
+{
+  if (srslte_tdec_avx_reset(h, long_cb)) {
+    return SRSLTE_ERROR;
+  }
+
+  do {
+    srslte_tdec_avx_iteration(h, input, long_cb);
+  } while (h->n_iter < nof_iterations);
+
+  srslte_tdec_avx_decision_byte(h, output, long_cb);
+
+  return SRSLTE_SUCCESS;
+}
+
+#endif
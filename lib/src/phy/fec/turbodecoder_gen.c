@@ -279,7 +279,9 @@ void srslte_tdec_gen_free(srslte_tdec_gen_t * h)
   bzero(h, sizeof(srslte_tdec_gen_t));
 }
 
-void srslte_tdec_gen_iteration(srslte_tdec_gen_t * h, float * input, uint32_t long_cb)
+/* Runs the next half iteration: MAP decoder #1 if a new iteration starts or MAP decoder #2 
+ * otherwise */
+void srslte_tdec_gen_half_iteration(srslte_tdec_gen_t * h, float * input, uint32_t long_cb)
 {
   uint32_t i;
 
@@ -288,48 +290,58 @@ void srslte_tdec_gen_iteration(srslte_tdec_gen_t * h, float * input, uint32_t lo
     uint16_t *inter = h->interleaver[h->current_cbidx].forward;
     uint16_t *deinter = h->interleaver[h->current_cbidx].reverse;
     
-    // Prepare systematic and parity bits for MAP DEC #1
-    for (i = 0; i < long_cb; i++) {
-      h->syst[i] = input[SRSLTE_TCOD_RATE * i] + h->w[i];
-      h->parity[i] = input[SRSLTE_TCOD_RATE * i + 1];
-    }
-    for (i = long_cb; i < long_cb + SRSLTE_TCOD_RATE; i++) {
-      h->syst[i] = input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * (i - long_cb)];
-      h->parity[i] = input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * (i - long_cb) + 1];
-    }
-
-    // Run MAP DEC #1
-    map_gen_dec(&h->dec, h->syst, h->parity, h->llr1, long_cb);
-
-    // Prepare systematic and parity bits for MAP DEC #1
-    for (i = 0; i < long_cb; i++) {
-      h->syst[i] = h->llr1[inter[i]]
-        - h->w[inter[i]];
-      h->parity[i] = input[SRSLTE_TCOD_RATE * i + 2];
-    }
-    for (i = long_cb; i < long_cb + SRSLTE_TCOD_RATE; i++) {
-      h->syst[i] =
-        input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * SRSLTE_TCOD_RATE + NINPUTS * (i - long_cb)];
-      h->parity[i] = input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * SRSLTE_TCOD_RATE
-                          + NINPUTS * (i - long_cb) + 1];
-    }
-
-    // Run MAP DEC #2
-    map_gen_dec(&h->dec, h->syst, h->parity, h->llr2, long_cb);
-
-    //printf("llr2=");
-    //srslte_vec_fprint_f(stdout, h->llr2, long_cb);
-
-    
-    // Update a-priori LLR from the last iteration
-    for (i = 0; i < long_cb; i++) {
-      h->w[i] += h->llr2[deinter[i]] - h->llr1[i];
+    if (!h->half_it) {
+      // Prepare systematic and parity bits for MAP DEC #1
+      for (i = 0; i < long_cb; i++) {
+        h->syst[i] = input[SRSLTE_TCOD_RATE * i] + h->w[i];
+        h->parity[i] = input[SRSLTE_TCOD_RATE * i + 1];
+      }
+      for (i = long_cb; i < long_cb + SRSLTE_TCOD_RATE; i++) {
+        h->syst[i] = input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * (i - long_cb)];
+        h->parity[i] = input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * (i - long_cb) + 1];
+      }
+
+      // Run MAP DEC #1
+      map_gen_dec(&h->dec, h->syst, h->parity, h->llr1, long_cb);
+      
+      h->half_it = true; 
+    } else {
+      // Prepare systematic and parity bits for MAP DEC #1
+      for (i = 0; i < long_cb; i++) {
+        h->syst[i] = h->llr1[inter[i]]
+          - h->w[inter[i]];
+        h->parity[i] = input[SRSLTE_TCOD_RATE * i + 2];
+      }
+      for (i = long_cb; i < long_cb + SRSLTE_TCOD_RATE; i++) {
+        h->syst[i] =
+          input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * SRSLTE_TCOD_RATE + NINPUTS * (i - long_cb)];
+        h->parity[i] = input[SRSLTE_TCOD_RATE * long_cb + NINPUTS * SRSLTE_TCOD_RATE
+                            + NINPUTS * (i - long_cb) + 1];
+      }
+
+      // Run MAP DEC #2
+      map_gen_dec(&h->dec, h->syst, h->parity, h->llr2, long_cb);
+
+      // Update a-priori LLR from the last iteration
+      for (i = 0; i < long_cb; i++) {
+        h->w[i] += h->llr2[deinter[i]] - h->llr1[i];
+      }
+      
+      h->half_it = false; 
     }
   } else {
     fprintf(stderr, "Error CB index not set (call srslte_tdec_gen_reset() first\n");    
   }
 }
 
+void srslte_tdec_gen_iteration(srslte_tdec_gen_t * h, float * input, uint32_t long_cb)
+{
+  srslte_tdec_gen_half_iteration(h, input, long_cb);
+  if (h->half_it) {
+    srslte_tdec_gen_half_iteration(h, input, long_cb);
+  }
+}
+
 int srslte_tdec_gen_reset(srslte_tdec_gen_t * h, uint32_t long_cb)
 {
   if (long_cb > h->max_long_cb) {
@@ -338,6 +350,7 @@ int srslte_tdec_gen_reset(srslte_tdec_gen_t * h, uint32_t long_cb)
     return -1;
   }
   memset(h->w, 0, sizeof(float) * long_cb);
+  h->half_it = false; 
   h->current_cbidx = srslte_cbsegm_cbindex(long_cb);
   if (h->current_cbidx < 0) {
     fprintf(stderr, "Invalid CB length %d\n", long_cb);
@@ -346,12 +359,18 @@ int srslte_tdec_gen_reset(srslte_tdec_gen_t * h, uint32_t long_cb)
   return 0;
 }
 
+/* Returns the a posteriori LLR of bit i: from DEC #1 if only the first half iteration has run */
+static inline float gen_app(srslte_tdec_gen_t * h, uint16_t *deinter, uint32_t i)
+{
+  return h->half_it?h->llr1[i]:h->llr2[deinter[i]];
+}
+
 void srslte_tdec_gen_decision(srslte_tdec_gen_t * h, uint8_t *output, uint32_t long_cb)
 {
   uint16_t *deinter = h->interleaver[h->current_cbidx].reverse;
   uint32_t i;
   for (i = 0; i < long_cb; i++) {
-    output[i] = (h->llr2[deinter[i]] > 0) ? 1 : 0;    
+    output[i] = (gen_app(h, deinter, i) > 0) ? 1 : 0;    
   }
 }
 
@@ -363,14 +382,14 @@ void srslte_tdec_gen_decision_byte(srslte_tdec_gen_t * h, uint8_t *output, uint3
   
   // long_cb is always byte aligned
   for (i = 0; i < long_cb/8; i++) {
-    uint8_t out0 = h->llr2[deinter[8*i+0]]>0?mask[0]:0;
-    uint8_t out1 = h->llr2[deinter[8*i+1]]>0?mask[1]:0;
-    uint8_t out2 = h->llr2[deinter[8*i+2]]>0?mask[2]:0;
-    uint8_t out3 = h->llr2[deinter[8*i+3]]>0?mask[3]:0;
-    uint8_t out4 = h->llr2[deinter[8*i+4]]>0?mask[4]:0;
-    uint8_t out5 = h->llr2[deinter[8*i+5]]>0?mask[5]:0;
-    uint8_t out6 = h->llr2[deinter[8*i+6]]>0?mask[6]:0;
-    uint8_t out7 = h->llr2[deinter[8*i+7]]>0?mask[7]:0;
+    uint8_t out0 = gen_app(h, deinter, 8*i+0)>0?mask[0]:0;
+    uint8_t out1 = gen_app(h, deinter, 8*i+1)>0?mask[1]:0;
+    uint8_t out2 = gen_app(h, deinter, 8*i+2)>0?mask[2]:0;
+    uint8_t out3 = gen_app(h, deinter, 8*i+3)>0?mask[3]:0;
+    uint8_t out4 = gen_app(h, deinter, 8*i+4)>0?mask[4]:0;
+    uint8_t out5 = gen_app(h, deinter, 8*i+5)>0?mask[5]:0;
+    uint8_t out6 = gen_app(h, deinter, 8*i+6)>0?mask[6]:0;
+    uint8_t out7 = gen_app(h, deinter, 8*i+7)>0?mask[7]:0;
     
     output[i] = out0 | out1 | out2 | out3 | out4 | out5 | out6 | out7; 
   }
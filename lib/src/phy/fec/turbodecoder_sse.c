@@ -445,9 +445,11 @@ void srslte_tdec_sse_free(srslte_tdec_sse_t * h)
 }
 
 /* Deinterleaves the 3 streams from the input (systematic and 2 parity bits) into 
- * 3 buffers ready to be used by compute_gamma() 
+ * 3 buffers ready to be used by compute_gamma(). The tail of the 2nd encoder
+ * systematic bits is written to app2. 
  */
-void deinterleave_input(srslte_tdec_sse_t *h, int16_t *input, uint32_t long_cb) {
+void srslte_tdec_sse_deinterleave_input(int16_t *input, int16_t *syst, int16_t *parity0, 
+                                        int16_t *parity1, int16_t *app2, uint32_t long_cb) {
   uint32_t i;
  
   __m128i *inputPtr = (__m128i*) input; 
@@ -456,9 +458,9 @@ void deinterleave_input(srslte_tdec_sse_t *h, int16_t *input, uint32_t long_cb)
   __m128i p00, p01, p02, p0;
   __m128i p10, p11, p12, p1;
   
-  __m128i *sysPtr = (__m128i*) h->syst; 
-  __m128i *pa0Ptr = (__m128i*) h->parity0; 
-  __m128i *pa1Ptr = (__m128i*) h->parity1; 
+  __m128i *sysPtr = (__m128i*) syst; 
+  __m128i *pa0Ptr = (__m128i*) parity0; 
+  __m128i *pa1Ptr = (__m128i*) parity1; 
   
   // pick bits 0, 3, 6 from 1st word
   __m128i s0_mask = _mm_set_epi8(0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,13,12,7,6,1,0);
@@ -521,60 +523,77 @@ void deinterleave_input(srslte_tdec_sse_t *h, int16_t *input, uint32_t long_cb)
   }
   
   for (i = 0; i < 3; i++) {
-    h->syst[i+long_cb]    = input[3*long_cb + 2*i];
-    h->parity0[i+long_cb] = input[3*long_cb + 2*i + 1];
+    syst[i+long_cb]    = input[3*long_cb + 2*i];
+    parity0[i+long_cb] = input[3*long_cb + 2*i + 1];
   }
   for (i = 0; i < 3; i++) {
-    h->app2[i+long_cb]    = input[3*long_cb + 6 + 2*i];
-    h->parity1[i+long_cb] = input[3*long_cb + 6 + 2*i + 1];
+    app2[i+long_cb]    = input[3*long_cb + 6 + 2*i];
+    parity1[i+long_cb] = input[3*long_cb + 6 + 2*i + 1];
   }
 
 }
 
-/* Runs 1 turbo decoder iteration */
-void srslte_tdec_sse_iteration(srslte_tdec_sse_t * h, int16_t * input, uint32_t long_cb)
+/* Runs the next half iteration: MAP decoder #1 if a new iteration starts or MAP decoder #2
+ * otherwise. The hard decision after the first half is taken from the a posteriori output
+ * of decoder #1, allowing the caller to stop without running decoder #2.
+ */
+void srslte_tdec_sse_half_iteration(srslte_tdec_sse_t * h, int16_t * input, uint32_t long_cb)
 {
 
   if (h->current_cbidx >= 0) {
     uint16_t *inter   = h->interleaver[h->current_cbidx].forward;
     uint16_t *deinter = h->interleaver[h->current_cbidx].reverse;
     
-    if (h->n_iter == 0) {
-      deinterleave_input(h, input, long_cb);
+    if (h->n_iter == 0 && !h->half_it) {
+      srslte_tdec_sse_deinterleave_input(input, h->syst, h->parity0, h->parity1, h->app2, long_cb);
     }
     
-    // Add apriori information to decoder 1 
-    if (h->n_iter > 0) {
-      srslte_vec_sub_sss(h->app1, h->ext1, h->app1, long_cb);
-    }
+    if (!h->half_it) {
+      // Add apriori information to decoder 1 
+      if (h->n_iter > 0) {
+        srslte_vec_sub_sss(h->app1, h->ext1, h->app1, long_cb);
+      }
         
-    // Run MAP DEC #1
-    if (h->n_iter == 0) {
-      map_gen_dec(&h->dec, h->syst, NULL, h->parity0, h->ext1, long_cb);            
+      // Run MAP DEC #1
+      if (h->n_iter == 0) {
+        map_gen_dec(&h->dec, h->syst, NULL, h->parity0, h->ext1, long_cb);            
+      } else {
+        map_gen_dec(&h->dec, h->syst, h->app1, h->parity0, h->ext1, long_cb);      
+      }
+
+      h->half_it = true;
     } else {
-      map_gen_dec(&h->dec, h->syst, h->app1, h->parity0, h->ext1, long_cb);      
-    }
-
-    // Convert aposteriori information into extrinsic information    
-    if (h->n_iter > 0) {
-      srslte_vec_sub_sss(h->ext1, h->app1, h->ext1, long_cb);
-    }
+      // Convert aposteriori information into extrinsic information    
+      if (h->n_iter > 0) {
+        srslte_vec_sub_sss(h->ext1, h->app1, h->ext1, long_cb);
+      }
     
-    // Interleave extrinsic output of DEC1 to form apriori info for decoder 2
-    srslte_vec_lut_sss(h->ext1, deinter, h->app2, long_cb);
+      // Interleave extrinsic output of DEC1 to form apriori info for decoder 2
+      srslte_vec_lut_sss(h->ext1, deinter, h->app2, long_cb);
 
-    // Run MAP DEC #2. 2nd decoder uses apriori information as systematic bits
-    map_gen_dec(&h->dec, h->app2, NULL, h->parity1, h->ext2, long_cb);
+      // Run MAP DEC #2. 2nd decoder uses apriori information as systematic bits
+      map_gen_dec(&h->dec, h->app2, NULL, h->parity1, h->ext2, long_cb);
 
-    // Deinterleaved extrinsic bits become apriori info for decoder 1 
-    srslte_vec_lut_sss(h->ext2, inter, h->app1, long_cb);
-    
-    h->n_iter++;
+      // Deinterleaved extrinsic bits become apriori info for decoder 1 
+      srslte_vec_lut_sss(h->ext2, inter, h->app1, long_cb);
+
+      h->half_it = false;
+      h->n_iter++;
+    }
   } else {
     fprintf(stderr, "Error CB index not set (call srslte_tdec_sse_reset() first\n");    
   }
 }
 
+/* Runs 1 turbo decoder iteration */
+void srslte_tdec_sse_iteration(srslte_tdec_sse_t * h, int16_t * input, uint32_t long_cb)
+{
+  srslte_tdec_sse_half_iteration(h, input, long_cb);
+  if (h->half_it) {
+    srslte_tdec_sse_half_iteration(h, input, long_cb);
+  }
+}
+
 /* Resets the decoder and sets the codeblock length */
 int srslte_tdec_sse_reset(srslte_tdec_sse_t * h, uint32_t long_cb)
 {
@@ -584,6 +603,7 @@ int srslte_tdec_sse_reset(srslte_tdec_sse_t * h, uint32_t long_cb)
     return -1;
   }
   h->n_iter = 0; 
+  h->half_it = false; 
   h->current_cbidx = srslte_cbsegm_cbindex(long_cb);
   if (h->current_cbidx < 0) {
     fprintf(stderr, "Invalid CB length %d\n", long_cb);
@@ -594,10 +614,11 @@ int srslte_tdec_sse_reset(srslte_tdec_sse_t * h, uint32_t long_cb)
 
 void srslte_tdec_sse_decision(srslte_tdec_sse_t * h, uint8_t *output, uint32_t long_cb)
 {
+  int16_t *app = h->half_it?h->ext1:h->app1;
   __m128i zero     = _mm_set1_epi16(0);
   __m128i lsb_mask = _mm_set1_epi16(1);
   
-  __m128i *appPtr = (__m128i*) h->app1;
+  __m128i *appPtr = (__m128i*) app;
   __m128i *outPtr = (__m128i*) output;
   __m128i ap, out, out0, out1; 
     
@@ -613,25 +634,26 @@ void srslte_tdec_sse_decision(srslte_tdec_sse_t * h, uint8_t *output, uint32_t l
   }
   if (long_cb%16) {
     for (int i=0;i<8;i++) {
-      output[long_cb-8+i] = h->app1[long_cb-8+i]>0?1:0;
+      output[long_cb-8+i] = app[long_cb-8+i]>0?1:0;
     }
   }
 }
 
 void srslte_tdec_sse_decision_byte(srslte_tdec_sse_t * h, uint8_t *output, uint32_t long_cb)
 {
+  int16_t *app = h->half_it?h->ext1:h->app1;
   uint8_t mask[8] = {0x80, 0x40, 0x20, 0x10, 0x8, 0x4, 0x2, 0x1};
   
   // long_cb is always byte aligned
   for (uint32_t i = 0; i < long_cb/8; i++) {
-    uint8_t out0 = h->app1[8*i+0]>0?mask[0]:0;
-    uint8_t out1 = h->app1[8*i+1]>0?mask[1]:0;
-    uint8_t out2 = h->app1[8*i+2]>0?mask[2]:0;
-    uint8_t out3 = h->app1[8*i+3]>0?mask[3]:0;
-    uint8_t out4 = h->app1[8*i+4]>0?mask[4]:0;
-    uint8_t out5 = h->app1[8*i+5]>0?mask[5]:0;
-    uint8_t out6 = h->app1[8*i+6]>0?mask[6]:0;
-    uint8_t out7 = h->app1[8*i+7]>0?mask[7]:0;
+    uint8_t out0 = app[8*i+0]>0?mask[0]:0;
+    uint8_t out1 = app[8*i+1]>0?mask[1]:0;
+    uint8_t out2 = app[8*i+2]>0?mask[2]:0;
+    uint8_t out3 = app[8*i+3]>0?mask[3]:0;
+    uint8_t out4 = app[8*i+4]>0?mask[4]:0;
+    uint8_t out5 = app[8*i+5]>0?mask[5]:0;
+    uint8_t out6 = app[8*i+6]>0?mask[6]:0;
+    uint8_t out7 = app[8*i+7]>0?mask[7]:0;
     
     output[i] = out0 | out1 | out2 | out3 | out4 | out5 | out6 | out7; 
   }
@@ -382,18 +382,20 @@ int srslte_viterbi_init(srslte_viterbi_t *q, srslte_viterbi_type_t type, int pol
 {
   switch (type) {
   case SRSLTE_VITERBI_37:
+#ifdef LV_HAVE_AVX
+    if (srslte_simd_get_level() >= SRSLTE_SIMD_AVX2) {
+      return init37_avx2(q, poly, max_frame_length, tail_bitting);
+    }
+#endif
 #ifdef LV_HAVE_SSE
-    #ifdef LV_HAVE_AVX 
-        return init37_avx2(q, poly, max_frame_length, tail_bitting);
-    #else
-        return init37_sse(q, poly, max_frame_length, tail_bitting);
-    #endif
+    if (srslte_simd_get_level() >= SRSLTE_SIMD_SSE41) {
+      return init37_sse(q, poly, max_frame_length, tail_bitting);
+    }
+#endif
+#ifdef HAVE_NEON
+    return init37_neon(q, poly, max_frame_length, tail_bitting);
 #else
-	#ifdef HAVE_NEON
-	return init37_neon(q, poly, max_frame_length, tail_bitting);
-	#else
     return init37(q, poly, max_frame_length, tail_bitting);
-	#endif
 #endif
   default:
     fprintf(stderr, "Decoder not implemented\n");
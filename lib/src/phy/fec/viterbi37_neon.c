@@ -32,7 +32,7 @@ typedef union {
 } decision_t;
 
 
-union branchtab27{
+static union branchtab27{
    unsigned char c[32];
   uint8x16_t v[2];
 } Branchtab37_neon[3];
@@ -42,7 +42,7 @@ union branchtab27{
 	  int8x8_t mask_shift;
 
 
-int firstGo;
+static int firstGo;
 /* State info for instance of Viterbi decoder */
 struct v37 {
   metric_t metrics1; /* path metric buffer 1 */
@@ -35,7 +35,7 @@
 // AVX implementation not useful for integers. Wait for AVX2
 
 #ifdef LV_HAVE_SSE
-#include <smmintrin.h>
+#include <immintrin.h>
 void demod_16qam_lte_s_sse(const cf_t *symbols, short *llr, int nsymbols);
 #endif
 
@@ -78,6 +78,7 @@ void demod_16qam_lte(const cf_t *symbols, float *llr, int nsymbols) {
 
 #ifdef LV_HAVE_SSE
 
+SRSLTE_TARGET_SSE41
 void demod_16qam_lte_s_sse(const cf_t *symbols, short *llr, int nsymbols) {
     float *symbolsPtr = (float*) symbols;
   __m128i *resultPtr = (__m128i*) llr;
@@ -124,8 +125,11 @@ void demod_16qam_lte_s_sse(const cf_t *symbols, short *llr, int nsymbols) {
 
 void demod_16qam_lte_s(const cf_t *symbols, short *llr, int nsymbols) {
 #ifdef LV_HAVE_SSE
-  demod_16qam_lte_s_sse(symbols, llr, nsymbols);
-#else
+  if (srslte_simd_get_level() >= SRSLTE_SIMD_SSE41) {
+    demod_16qam_lte_s_sse(symbols, llr, nsymbols);
+    return;
+  }
+#endif
   for (int i=0;i<nsymbols;i++) {
     short yre = (short) (SCALE_SHORT_CONV_QAM16*crealf(symbols[i]));
     short yim = (short) (SCALE_SHORT_CONV_QAM16*cimagf(symbols[i]));
@@ -135,7 +139,6 @@ void demod_16qam_lte_s(const cf_t *symbols, short *llr, int nsymbols) {
     llr[4*i+2] = abs(yre)-2*SCALE_SHORT_CONV_QAM16/sqrt(10);
     llr[4*i+3] = abs(yim)-2*SCALE_SHORT_CONV_QAM16/sqrt(10);    
   }
-#endif
 }
 
 void demod_64qam_lte(const cf_t *symbols, float *llr, int nsymbols) 
@@ -156,6 +159,7 @@ void demod_64qam_lte(const cf_t *symbols, float *llr, int nsymbols)
 
 #ifdef LV_HAVE_SSE
 
+SRSLTE_TARGET_SSE41
 void demod_64qam_lte_s_sse(const cf_t *symbols, short *llr, int nsymbols) 
 {
   float *symbolsPtr = (float*) symbols;
@@ -224,8 +228,11 @@ void demod_64qam_lte_s_sse(const cf_t *symbols, short *llr, int nsymbols)
 void demod_64qam_lte_s(const cf_t *symbols, short *llr, int nsymbols) 
 {
 #ifdef LV_HAVE_SSE
-  demod_64qam_lte_s_sse(symbols, llr, nsymbols);
-#else
+  if (srslte_simd_get_level() >= SRSLTE_SIMD_SSE41) {
+    demod_64qam_lte_s_sse(symbols, llr, nsymbols);
+    return;
+  }
+#endif
   for (int i=0;i<nsymbols;i++) {
     float yre = (short) (SCALE_SHORT_CONV_QAM64*crealf(symbols[i]));
     float yim = (short) (SCALE_SHORT_CONV_QAM64*cimagf(symbols[i]));
@@ -237,7 +244,6 @@ void demod_64qam_lte_s(const cf_t *symbols, short *llr, int nsymbols)
     llr[6*i+4] = abs(llr[6*i+2])-2*SCALE_SHORT_CONV_QAM64/sqrt(42);
     llr[6*i+5] = abs(llr[6*i+3])-2*SCALE_SHORT_CONV_QAM64/sqrt(42);        
   }
-#endif
 }
 
 int srslte_demod_soft_demodulate(srslte_mod_t modulation, const cf_t* symbols, float* llr, int nsymbols) {
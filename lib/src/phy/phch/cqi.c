@@ -269,3 +269,18 @@ int srslte_cqi_hl_get_no_subbands(int nof_prb)
     return 0;
   }
 }
+
+/* Returns the CQI of subband subband_idx of a higher layer-configured subband report, i.e., the wideband CQI 
+ * plus the offset of the subband differential CQI (Table 7.2.1-2 in TS 36.213). The first subband is in the 
+ * most significant bits of subband_diff_cqi
+ */
+uint32_t srslte_cqi_hl_get_subband_cqi(srslte_cqi_hl_subband_t *msg, uint32_t subband_idx)
+{
+  const static int offset[4] = {0, 1, 2, -1}; 
+  if (subband_idx >= msg->N) {
+    return msg->wideband_cqi; 
+  }
+  uint32_t diff = (msg->subband_diff_cqi >> (2*(msg->N-1-subband_idx)))&0x3; 
+  int cqi = (int) msg->wideband_cqi + offset[diff]; 
+  return (uint32_t) SRSLTE_MIN(SRSLTE_MAX(cqi, 0), 15); 
+}
@@ -314,6 +314,7 @@ void srslte_pdsch_free(srslte_pdsch_t *q) {
     }      
     free(q->users);
   }
+  srslte_sequence_free(&q->tmp_seq);
   for (i = 0; i < 4; i++) {
     srslte_modem_table_free(&q->mod[i]);
   }
@@ -348,8 +349,9 @@ int srslte_pdsch_cfg(srslte_pdsch_cfg_t *cfg, srslte_cell_t cell, srslte_ra_dl_g
 }
 
 
-/* Precalculate the PDSCH scramble sequences for a given RNTI. This function takes a while 
- * to execute, so shall be called once the final C-RNTI has been allocated for the session.
+/* Precalculate the PDSCH scramble sequences for a given RNTI. Only the packed sequence bits
+ * are stored. This is optional: for RNTIs without precalculated sequences, the sequence is
+ * generated for every subframe in srslte_pdsch_encode() and srslte_pdsch_decode().
  */
 int srslte_pdsch_set_rnti(srslte_pdsch_t *q, uint16_t rnti) {
   uint32_t i;  
@@ -357,7 +359,7 @@ int srslte_pdsch_set_rnti(srslte_pdsch_t *q, uint16_t rnti) {
     q->users[rnti] = calloc(1, sizeof(srslte_pdsch_user_t));
     if (q->users[rnti]) {
       for (i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
-        if (srslte_sequence_pdsch(&q->users[rnti]->seq[i], rnti, 0, 2 * i, q->cell.id,
+        if (srslte_sequence_pdsch_packed(&q->users[rnti]->seq[i], rnti, 0, 2 * i, q->cell.id,
             q->max_re * srslte_mod_bits_x_symbol(SRSLTE_MOD_64QAM))) {
           return SRSLTE_ERROR; 
         }
@@ -468,12 +470,10 @@ int srslte_pdsch_decode_multi(srslte_pdsch_t *q,
     
     /* descramble */
     if (!q->users[rnti]) {
-      srslte_sequence_t seq; 
-      if (srslte_sequence_pdsch(&seq, rnti, 0, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
+      if (srslte_sequence_pdsch_packed(&q->tmp_seq, rnti, 0, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
         return SRSLTE_ERROR; 
       }
-      srslte_scrambling_s_offset(&seq, q->e, 0, cfg->nbits.nof_bits);      
-      srslte_sequence_free(&seq);
+      srslte_scrambling_s_offset(&q->tmp_seq, q->e, 0, cfg->nbits.nof_bits);      
     } else {    
       srslte_scrambling_s_offset(&q->users[rnti]->seq[cfg->sf_idx], q->e, 0, cfg->nbits.nof_bits);      
     }
@@ -538,12 +538,10 @@ int srslte_pdsch_encode(srslte_pdsch_t *q,
 
     /* scramble */
     if (!q->users[rnti]) {
-      srslte_sequence_t seq; 
-      if (srslte_sequence_pdsch(&seq, rnti, 0, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
+      if (srslte_sequence_pdsch_packed(&q->tmp_seq, rnti, 0, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
         return SRSLTE_ERROR; 
       }
-      srslte_scrambling_bytes(&seq, (uint8_t*) q->e, cfg->nbits.nof_bits);
-      srslte_sequence_free(&seq);
+      srslte_scrambling_bytes(&q->tmp_seq, (uint8_t*) q->e, cfg->nbits.nof_bits);
     } else {    
       srslte_scrambling_bytes(&q->users[rnti]->seq[cfg->sf_idx], (uint8_t*) q->e, cfg->nbits.nof_bits);
     }
@@ -48,6 +48,14 @@ float save_corr[4096];
 
 #define PRACH_AMP       1.0
 
+// Decimation filter: Kaiser-windowed sinc of PRACH_DECIM_TAPS taps per decimated
+// sample, about 60 dB down where it aliases onto the N_zc bins
+#define PRACH_DECIM_TAPS  8
+#define PRACH_DECIM_BETA  5.65
+
+// Below this factor the filter costs more than the FFT of the whole preamble
+#define PRACH_DECIM_MIN_FACTOR 8
+
 /******************************************************
  * Reference tables from 3GPP TS 36.211 v10.7.0
  *****************************************************/
@@ -326,6 +334,146 @@ int srslte_prach_gen_seqs(srslte_prach_t *p)
   return 0;
 }
 
+// Smallest size above n made of the factors 2, 3, 5 and 7, which FFTW transforms fast
+static uint32_t prach_smooth_size(uint32_t n)
+{
+  for (;;n++) {
+    uint32_t m = n;
+    uint32_t factors[4] = {2, 3, 5, 7};
+    for (uint32_t i=0;i<4;i++) {
+      while (m%factors[i] == 0) {
+        m /= factors[i];
+      }
+    }
+    if (m == 1) {
+      return n;
+    }
+  }
+}
+
+/* Sets up the correlation with all the roots. The N_zc-point IFFT of the bins times
+ * each root spectrum is, with w[n] = exp(j*pi*n^2/N_zc),
+ *   y[t] = w[t] * sum_k (X[k]*w[k]) * conj(w[t-k])
+ * a linear convolution with conj(w) that is done with corr_size-point FFTs. The
+ * detector only needs |y[t]|^2, so the final product by w[t] is skipped.
+ */
+static int prach_corr_init(srslte_prach_t *p)
+{
+  uint32_t N = p->N_zc;
+  uint32_t P = prach_smooth_size(2*N-1);
+  srslte_dft_plan_t kernel_fft;
+
+  p->corr_size   = P;
+  p->corr_chirp  = srslte_vec_malloc(sizeof(cf_t)*N);
+  p->corr_kernel = srslte_vec_malloc(sizeof(cf_t)*P);
+  p->corr_spec   = srslte_vec_malloc(sizeof(cf_t)*p->N_roots*P);
+  p->corr_out    = srslte_vec_malloc(sizeof(cf_t)*p->N_roots*P);
+  p->corr        = srslte_vec_malloc(sizeof(float)*p->N_roots*N);
+  p->corr_fft    = (srslte_dft_plan_t*)srslte_vec_malloc(sizeof(srslte_dft_plan_t));
+  p->zc_ifft     = (srslte_dft_plan_t*)srslte_vec_malloc(sizeof(srslte_dft_plan_t));
+  if (!p->corr_chirp || !p->corr_kernel || !p->corr_spec || !p->corr_out || !p->corr ||
+      !p->corr_fft || !p->zc_ifft) {
+    fprintf(stderr, "Error allocating memory\n");
+    return SRSLTE_ERROR;
+  }
+  if (srslte_dft_plan_c_batch(p->corr_fft, P, p->N_roots, SRSLTE_DFT_FORWARD) ||
+      srslte_dft_plan_c_batch(p->zc_ifft, P, p->N_roots, SRSLTE_DFT_BACKWARD) ||
+      srslte_dft_plan_c(&kernel_fft, P, SRSLTE_DFT_FORWARD)) {
+    fprintf(stderr, "Error creating DFT plan\n");
+    return SRSLTE_ERROR;
+  }
+
+  for (uint32_t n=0;n<N;n++) {
+    p->corr_chirp[n] = cexpf(I*M_PI*(float) (((uint64_t) n*n) % (2*N))/N);
+  }
+
+  // conj(w) at lags -(N-1) to N-1, wrapped around
+  bzero(p->corr_spec, sizeof(cf_t)*P);
+  for (uint32_t n=0;n<N;n++) {
+    p->corr_spec[n] = conjf(p->corr_chirp[n]);
+    if (n) {
+      p->corr_spec[P-n] = conjf(p->corr_chirp[n]);
+    }
+  }
+  srslte_dft_run_c_zerocopy(&kernel_fft, p->corr_spec, p->corr_kernel);
+  srslte_vec_sc_prod_cfc(p->corr_kernel, 1.0/P, p->corr_kernel, P);
+  srslte_dft_plan_free(&kernel_fft);
+
+  // Only the first N_zc samples of each root are written, the rest stays zero
+  bzero(p->corr_spec, sizeof(cf_t)*p->N_roots*P);
+  return SRSLTE_SUCCESS;
+}
+
+// Zeroth order modified Bessel function of the first kind, for the Kaiser window
+static double prach_bessel_i0(double x)
+{
+  double sum  = 1.0;
+  double term = 1.0;
+  for (int k=1;k<50 && term > 1e-12*sum;k++) {
+    term *= (x/(2*k))*(x/(2*k));
+    sum  += term;
+  }
+  return sum;
+}
+
+/* Sets up the decimating front end for N_ifft_prach-sample preambles. The filter is
+ * applied circularly over the preamble, as the FFT would see it, so the decimated
+ * spectrum is the N_ifft_prach-point one times the filter response, which decim_eq
+ * undoes on the N_zc bins.
+ */
+static int prach_decim_init(srslte_prach_t *p)
+{
+  uint32_t M = SRSLTE_PRACH_DECIM_FFT_SIZE;
+
+  p->decim_nco_offset = -1;
+  p->decim_factor     = 0;
+  p->decimate         = false;
+  if (p->f == 4 || p->N_ifft_prach % M || p->N_ifft_prach == M) {
+    return SRSLTE_SUCCESS;
+  }
+  uint32_t D   = p->N_ifft_prach/M;
+  uint32_t L   = PRACH_DECIM_TAPS*D + 1;
+  uint32_t off = (L-1)/2;
+
+  p->decim_taps = srslte_vec_malloc(sizeof(float)*L);
+  p->decim_eq   = srslte_vec_malloc(sizeof(float)*p->N_zc);
+  p->decim_nco  = srslte_vec_malloc(sizeof(cf_t)*p->N_ifft_prach);
+  p->decim_in   = srslte_vec_malloc(sizeof(cf_t)*(p->N_ifft_prach+L));
+  p->decim_out  = srslte_vec_malloc(sizeof(cf_t)*M);
+  p->decim_fft  = (srslte_dft_plan_t*)srslte_vec_malloc(sizeof(srslte_dft_plan_t));
+  if (!p->decim_taps || !p->decim_eq || !p->decim_nco || !p->decim_in || !p->decim_out || !p->decim_fft) {
+    fprintf(stderr, "Error allocating memory\n");
+    return SRSLTE_ERROR;
+  }
+  if (srslte_dft_plan(p->decim_fft, M, SRSLTE_DFT_FORWARD, SRSLTE_DFT_COMPLEX)) {
+    fprintf(stderr, "Error creating DFT plan\n");
+    return SRSLTE_ERROR;
+  }
+
+  // Cut-off at half the decimated rate
+  for (uint32_t i=0;i<L;i++) {
+    double t = (double) i - off;
+    double w = off ? prach_bessel_i0(PRACH_DECIM_BETA*sqrt(1-(t/off)*(t/off)))/prach_bessel_i0(PRACH_DECIM_BETA) : 1;
+    p->decim_taps[i] = (float) (w*(t == 0 ? 1.0/D : sin(M_PI*t/D)/(M_PI*t)));
+  }
+
+  // The zero-phase response at bin k from the centre of the band, scaled by D as the
+  // decimated FFT sums D times fewer samples
+  for (uint32_t j=0;j<p->N_zc;j++) {
+    double k = (double) j - p->N_zc/2;
+    double h = 0;
+    for (uint32_t i=0;i<L;i++) {
+      h += p->decim_taps[i]*cos(2*M_PI*k*((double) i - off)/p->N_ifft_prach);
+    }
+    p->decim_eq[j] = (float) (D/h);
+  }
+
+  p->decim_factor = D;
+  p->decim_ntaps  = L;
+  p->decimate     = D >= PRACH_DECIM_MIN_FACTOR;
+  return SRSLTE_SUCCESS;
+}
+
 int srslte_prach_init_cfg(srslte_prach_t *p, srslte_prach_cfg_t *cfg, uint32_t nof_prb)
 {
   return srslte_prach_init(p, 
@@ -388,8 +536,6 @@ int srslte_prach_init(srslte_prach_t *p,
     
     // Set up containers
     p->prach_bins = srslte_vec_malloc(sizeof(cf_t)*p->N_zc);
-    p->corr_spec = srslte_vec_malloc(sizeof(cf_t)*p->N_zc);
-    p->corr = srslte_vec_malloc(sizeof(float)*p->N_zc);
 
     // Set up ZC FFTS
     p->zc_fft = (srslte_dft_plan_t*)srslte_vec_malloc(sizeof(srslte_dft_plan_t));
@@ -399,17 +545,15 @@ int srslte_prach_init(srslte_prach_t *p,
     srslte_dft_plan_set_mirror(p->zc_fft, false);
     srslte_dft_plan_set_norm(p->zc_fft, true);
 
-    p->zc_ifft = (srslte_dft_plan_t*)srslte_vec_malloc(sizeof(srslte_dft_plan_t));
-    if(srslte_dft_plan(p->zc_ifft, p->N_zc, SRSLTE_DFT_BACKWARD, SRSLTE_DFT_COMPLEX)){
-      return SRSLTE_ERROR;
-    }
-    srslte_dft_plan_set_mirror(p->zc_ifft, false);
-    srslte_dft_plan_set_norm(p->zc_ifft, false);
-
     // Generate our 64 sequences
     p->N_roots = 0;
     srslte_prach_gen_seqs(p);
 
+    // The correlations with all the roots are transformed together
+    if (prach_corr_init(p)) {
+      return SRSLTE_ERROR;
+    }
+
     // Generate sequence FFTs
     for(int i=0;i<N_SEQS;i++){
       srslte_dft_run(p->zc_fft, p->seqs[i], p->dft_seqs[i]);
@@ -462,6 +606,10 @@ int srslte_prach_init(srslte_prach_t *p,
     p->N_cp  = prach_Tcp[p->f]*p->N_ifft_ul/2048;
     p->T_seq = prach_Tseq[p->f]*SRSLTE_LTE_TS;
     p->T_tot = (prach_Tseq[p->f]+prach_Tcp[p->f])*SRSLTE_LTE_TS;
+
+    if (prach_decim_init(p)) {
+      return SRSLTE_ERROR;
+    }
     
     ret = SRSLTE_SUCCESS;
   } else {
@@ -520,6 +668,57 @@ void srslte_prach_set_detect_factor(srslte_prach_t *p, float ratio) {
   p->detect_factor = ratio; 
 }
 
+/* Selects the decimating front end or the FFT of the whole preamble. The former is
+ * the default when it decimates by 8 or more, where it is the faster one. Format 4,
+ * 1.4 MHz and FFT sizes that are not a multiple of SRSLTE_PRACH_DECIM_FFT_SIZE always
+ * use the latter, which is no larger at 1.4 MHz.
+ */
+void srslte_prach_set_decimation(srslte_prach_t *p, bool enable) {
+  p->decimate = enable && p->decim_factor > 0;
+}
+
+/* Extracts the N_zc PRACH bins starting at begin of the N_ifft_prach-point spectrum
+ * through the decimating front end. Formats 2 and 3 repeat the sequence, so both
+ * copies are added when the signal holds them.
+ */
+static void prach_decim_bins(srslte_prach_t *p, uint32_t freq_offset, uint32_t begin,
+                             cf_t *signal, uint32_t sig_len)
+{
+  uint32_t N   = p->N_ifft_prach;
+  uint32_t M   = SRSLTE_PRACH_DECIM_FFT_SIZE;
+  uint32_t D   = p->decim_factor;
+  uint32_t off = (p->decim_ntaps-1)/2;
+  uint32_t half_zc = p->N_zc/2;
+  cf_t    *y   = &p->decim_in[off];
+
+  // Shift the centre of the band, bin begin+N_zc/2 of the mirrored spectrum, to DC
+  if ((int) freq_offset != p->decim_nco_offset) {
+    int c = (int) (begin + half_zc) - (int) N/2;
+    for (uint32_t n=0;n<N;n++) {
+      p->decim_nco[n] = cexpf(-I*2*M_PI*(float) ((c*(int64_t) n) % (int64_t) N)/N);
+    }
+    p->decim_nco_offset = freq_offset;
+  }
+  if (p->N_seq >= 2*N && sig_len >= 2*N) {
+    srslte_vec_sum_ccc(signal, &signal[N], y, N);
+    srslte_vec_prod_ccc(y, p->decim_nco, y, N);
+  } else {
+    srslte_vec_prod_ccc(signal, p->decim_nco, y, N);
+  }
+  memcpy(p->decim_in, &y[N-off], off*sizeof(cf_t));
+  memcpy(&y[N], y, off*sizeof(cf_t));
+
+  for (uint32_t m=0;m<M;m++) {
+    p->decim_out[m] = srslte_vec_dot_prod_cfc(&p->decim_in[m*D], p->decim_taps, p->decim_ntaps);
+  }
+  srslte_dft_run(p->decim_fft, p->decim_out, p->decim_out);
+
+  // Negative frequencies are at the end of the spectrum
+  memcpy(p->prach_bins, &p->decim_out[M-half_zc], half_zc*sizeof(cf_t));
+  memcpy(&p->prach_bins[half_zc], p->decim_out, (p->N_zc-half_zc)*sizeof(cf_t));
+  srslte_vec_prod_cfc(p->prach_bins, p->decim_eq, p->prach_bins, p->N_zc);
+}
+
 int srslte_prach_detect(srslte_prach_t *p,
                         uint32_t freq_offset,
                         cf_t *signal,
@@ -551,9 +750,6 @@ int srslte_prach_detect_offset(srslte_prach_t *p,
       return SRSLTE_ERROR_INVALID_INPUTS;
     }
     
-    // FFT incoming signal
-    srslte_dft_run(p->fft, signal, p->signal_fft);
-
     *n_indices = 0;
 
     // Extract bins of interest
@@ -562,18 +758,35 @@ int srslte_prach_detect_offset(srslte_prach_t *p,
     uint32_t K = DELTA_F/DELTA_F_RA;
     uint32_t begin = PHI + (K*k_0) + (K/2);
 
-    memcpy(p->prach_bins, &p->signal_fft[begin], p->N_zc*sizeof(cf_t));
-    
+    if (p->decimate) {
+      prach_decim_bins(p, freq_offset, begin, signal, sig_len);
+    } else {
+      // FFT incoming signal
+      srslte_dft_run(p->fft, signal, p->signal_fft);
+      memcpy(p->prach_bins, &p->signal_fft[begin], p->N_zc*sizeof(cf_t));
+    }
+
+    // Correlate with every root, see prach_corr_init()
+    uint32_t P = p->corr_size;
+    srslte_vec_prod_ccc(p->prach_bins, p->corr_chirp, p->prach_bins, p->N_zc);
     for(int i=0;i<p->N_roots;i++){
       cf_t *root_spec = p->dft_seqs[p->root_seqs_idx[i]];
-     
-      srslte_vec_prod_conj_ccc(p->prach_bins, root_spec, p->corr_spec, p->N_zc);
-
-      srslte_dft_run(p->zc_ifft, p->corr_spec, p->corr_spec);
-      
-      srslte_vec_abs_square_cf(p->corr_spec, p->corr, p->N_zc);
+      srslte_vec_prod_conj_ccc(p->prach_bins, root_spec, &p->corr_spec[i*P], p->N_zc);
+    }
+    srslte_dft_run_c_zerocopy(p->corr_fft, p->corr_spec, p->corr_out);
+    for(int i=0;i<p->N_roots;i++){
+      srslte_vec_prod_ccc(&p->corr_out[i*P], p->corr_kernel, &p->corr_out[i*P], P);
+    }
+    srslte_dft_run_c_zerocopy(p->zc_ifft, p->corr_out, p->corr_spec);
+    for(int i=0;i<p->N_roots;i++){
+      srslte_vec_abs_square_cf(&p->corr_spec[i*P], &p->corr[i*p->N_zc], p->N_zc);
+      bzero(&p->corr_spec[i*P+p->N_zc], sizeof(cf_t)*(P-p->N_zc));
+    }
+    
+    for(int i=0;i<p->N_roots;i++){
+      float *corr = &p->corr[i*p->N_zc];
 
-      float corr_ave = srslte_vec_acc_ff(p->corr, p->N_zc)/p->N_zc;
+      float corr_ave = srslte_vec_acc_ff(corr, p->N_zc)/p->N_zc;
       
       uint32_t winsize = 0;
       if(p->N_cs != 0){
@@ -593,8 +806,8 @@ int srslte_prach_detect_offset(srslte_prach_t *p,
         start += p->deadzone;
         p->peak_values[j] = 0;
         for(int k=start;k<end;k++) {
-          if(p->corr[k] > p->peak_values[j]) {
-            p->peak_values[j]  = p->corr[k];
+          if(corr[k] > p->peak_values[j]) {
+            p->peak_values[j]  = corr[k];
             p->peak_offsets[j] = k-start; 
             if (p->peak_values[j] > max_peak) {
               max_peak = p->peak_values[j];
@@ -615,7 +828,8 @@ int srslte_prach_detect_offset(srslte_prach_t *p,
               peak_to_avg[*n_indices] = p->peak_values[j]/corr_ave; 
             }
             if (t_offsets) {
-              t_offsets[*n_indices] = (float) p->peak_offsets[j]*p->T_seq/p->N_zc; 
+              // The correlation spans one repetition of the sequence, half of T_seq in formats 2 and 3
+              t_offsets[*n_indices] = (float) p->peak_offsets[j]*p->T_seq*p->N_ifft_prach/(p->N_seq*p->N_zc);
             }            
             (*n_indices)++;          
           }
@@ -631,6 +845,7 @@ int srslte_prach_detect_offset(srslte_prach_t *p,
 int srslte_prach_free(srslte_prach_t *p) {
   free(p->prach_bins);
   free(p->corr_spec);
+  free(p->corr_out);
   free(p->corr);
   srslte_dft_plan_free(p->ifft);
   free(p->ifft);
@@ -642,10 +857,24 @@ int srslte_prach_free(srslte_prach_t *p) {
   free(p->zc_fft);
   srslte_dft_plan_free(p->zc_ifft);
   free(p->zc_ifft);
+  srslte_dft_plan_free(p->corr_fft);
+  free(p->corr_fft);
+  free(p->corr_chirp);
+  free(p->corr_kernel);
 
   if (p->signal_fft) {
     free(p->signal_fft); 
   }
+
+  if (p->decim_factor) {
+    srslte_dft_plan_free(p->decim_fft);
+    free(p->decim_fft);
+    free(p->decim_taps);
+    free(p->decim_eq);
+    free(p->decim_nco);
+    free(p->decim_in);
+    free(p->decim_out);
+  }
   
   bzero(p, sizeof(srslte_prach_t));
 
@@ -489,11 +489,11 @@ void srslte_pucch_clear_rnti(srslte_pucch_t *q, uint16_t rnti) {
 
 int srslte_pucch_set_crnti(srslte_pucch_t *q, uint16_t rnti) {
   if (!q->users[rnti]) {
-    q->users[rnti] = malloc(sizeof(srslte_pucch_user_t));
+    q->users[rnti] = calloc(1, sizeof(srslte_pucch_user_t));
     if (q->users[rnti]) {
       for (uint32_t sf_idx=0;sf_idx<SRSLTE_NSUBFRAMES_X_FRAME;sf_idx++) {
         // Precompute scrambling sequence for pucch format 2    
-        if (srslte_sequence_pucch(&q->users[rnti]->seq_f2[sf_idx], rnti, 2*sf_idx, q->cell.id)) {
+        if (srslte_sequence_pucch_packed(&q->users[rnti]->seq_f2[sf_idx], rnti, 2*sf_idx, q->cell.id)) {
           fprintf(stderr, "Error computing PUCCH Format 2 scrambling sequence\n");
           return SRSLTE_ERROR; 
         }        
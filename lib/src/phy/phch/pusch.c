@@ -289,6 +289,7 @@ void srslte_pusch_free(srslte_pusch_t *q) {
     }
     free(q->users);
   }
+  srslte_sequence_free(&q->tmp_seq);
   srslte_sequence_free(&q->seq_type2_fo);
   
   for (i = 0; i < 4; i++) {
@@ -386,17 +387,17 @@ int srslte_pusch_cfg(srslte_pusch_t             *q,
   }
 }
 
-/* Precalculate the PUSCH scramble sequences for a given RNTI. This function takes a while 
- * to execute, so shall be called once the final C-RNTI has been allocated for the session.
- * For the connection procedure, use srslte_pusch_encode() functions */
+/* Precalculate the PUSCH scramble sequences for a given RNTI. Only the packed sequence bits
+ * are stored. This is optional: for RNTIs without precalculated sequences, the sequence is
+ * generated for every subframe in srslte_pusch_encode() and srslte_pusch_decode() */
 int srslte_pusch_set_rnti(srslte_pusch_t *q, uint16_t rnti) {
   uint32_t i;
   
   if (!q->users[rnti]) {
-    q->users[rnti] = malloc(sizeof(srslte_pusch_user_t));
+    q->users[rnti] = calloc(1, sizeof(srslte_pusch_user_t));
     if (q->users[rnti]) {
       for (i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
-        if (srslte_sequence_pusch(&q->users[rnti]->seq[i], rnti, 2 * i, q->cell.id,
+        if (srslte_sequence_pusch_packed(&q->users[rnti]->seq[i], rnti, 2 * i, q->cell.id,
             q->max_re * srslte_mod_bits_x_symbol(SRSLTE_MOD_64QAM))) {
           return SRSLTE_ERROR; 
         }
@@ -445,12 +446,10 @@ int srslte_pusch_encode(srslte_pusch_t *q, srslte_pusch_cfg_t *cfg, srslte_softb
     }
 
     if (!q->users[rnti]) {
-      srslte_sequence_t seq; 
-      if (srslte_sequence_pusch(&seq, rnti, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
+      if (srslte_sequence_pusch_packed(&q->tmp_seq, rnti, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
         return SRSLTE_ERROR; 
       }
-      srslte_scrambling_bytes(&seq, (uint8_t*) q->q, cfg->nbits.nof_bits);      
-      srslte_sequence_free(&seq);
+      srslte_scrambling_bytes(&q->tmp_seq, (uint8_t*) q->q, cfg->nbits.nof_bits);      
     } else {
       srslte_scrambling_bytes(&q->users[rnti]->seq[cfg->sf_idx], (uint8_t*) q->q, cfg->nbits.nof_bits);            
     }
@@ -537,7 +536,7 @@ int srslte_pusch_decode(srslte_pusch_t *q,
     // Create sequence if does not exist
     if (!q->users[rnti]) {
       seq = &q->tmp_seq; 
-      if (srslte_sequence_pusch(seq, rnti, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
+      if (srslte_sequence_pusch_packed(seq, rnti, 2 * cfg->sf_idx, q->cell.id, cfg->nbits.nof_bits)) {
         return SRSLTE_ERROR; 
       }
     } else {
@@ -545,17 +544,13 @@ int srslte_pusch_decode(srslte_pusch_t *q,
     }
     
     // Decode RI/HARQ bits before descrambling 
-    if (srslte_ulsch_uci_decode_ri_ack(&q->ul_sch, cfg, softbuffer, q->q, seq->c, uci_data)) {
+    if (srslte_ulsch_uci_decode_ri_ack(&q->ul_sch, cfg, softbuffer, q->q, seq->c_bytes, uci_data)) {
       fprintf(stderr, "Error decoding RI/HARQ bits\n");
       return SRSLTE_ERROR; 
     }
     
     // Descrambling
     srslte_scrambling_s_offset(seq, q->q, 0, cfg->nbits.nof_bits);
-        
-    if (!q->users[rnti]) {
-      srslte_sequence_free(seq);
-    }
     
     return srslte_ulsch_uci_decode(&q->ul_sch, cfg, softbuffer, q->q, q->g, data, uci_data);      
   } else {
@@ -56,6 +56,7 @@ float beta_ri_offset[16] = {1.25, 1.625, 2.0, 2.5, 3.125, 4.0, 5.0, 6.25, 8.0, 1
 float beta_cqi_offset[16] = {-1.0, -1.0, 1.125, 1.25, 1.375, 1.625, 1.750, 2.0, 2.25, 2.5, 2.875, 
                              3.125, 3.5, 4.0, 5.0, 6.25};
 
+static void cb_workers_stop(srslte_sch_t *q);
 
 float srslte_sch_beta_cqi(uint32_t I_cqi) {
   if (I_cqi < 16) {
@@ -141,6 +142,12 @@ int srslte_sch_init(srslte_sch_t *q) {
     if (srslte_uci_cqi_init(&q->uci_cqi)) {
       goto clean;
     }
+    // As many code blocks as the largest soft buffer 
+    q->cb_job.cb_half_its = srslte_vec_malloc(sizeof(uint32_t)*
+                                              (srslte_ra_tbs_from_idx(26, SRSLTE_MAX_PRB)/(SRSLTE_TCOD_MAX_LEN_CB-24)+1));
+    if (!q->cb_job.cb_half_its) {
+      goto clean; 
+    }
     
     ret = SRSLTE_SUCCESS;
   }
@@ -152,6 +159,7 @@ clean:
 }
 
 void srslte_sch_free(srslte_sch_t *q) {
+  cb_workers_stop(q);
   if (q->cb_in) {
     free(q->cb_in);
   }
@@ -164,6 +172,9 @@ void srslte_sch_free(srslte_sch_t *q) {
   if (q->ul_interleaver) {
     free(q->ul_interleaver);
   }
+  if (q->cb_job.cb_half_its) {
+    free(q->cb_job.cb_half_its);
+  }
   srslte_tdec_free(&q->decoder);
   srslte_tcod_free(&q->encoder);
   srslte_uci_cqi_free(&q->uci_cqi);
@@ -182,6 +193,24 @@ uint32_t srslte_sch_last_noi(srslte_sch_t *q) {
   return q->nof_iterations;
 }
 
+/* Limits the total number of turbo decoder iterations, summed over all code blocks, spent in 
+ * the next transport block. Code blocks not decoded when the budget is exhausted are erroneous. 
+ * Set to 0 to disable. 
+ */
+void srslte_sch_set_iteration_budget(srslte_sch_t *q, uint32_t nof_iterations) {
+  q->iteration_budget = nof_iterations; 
+}
+
+/* Number of iterations, summed over all code blocks, spent decoding the last transport block */
+float srslte_sch_last_noi_spent(srslte_sch_t *q) {
+  return (float) q->nof_half_its_spent/2;
+}
+
+/* Number of iterations saved by early termination in the last transport block */
+float srslte_sch_last_noi_saved(srslte_sch_t *q) {
+  return (float) q->nof_half_its_saved/2;
+}
+
 
 /* Encode a transport block according to 36.212 5.3.2
  *
@@ -314,9 +343,276 @@ static int encode_tb(srslte_sch_t *q,
   
 
 
+/* Computes the code block length, the number of rate matched bits and the read (e_bits) and
+ * write (data) offsets of the code block cb_idx. 
+ */
+static void cb_params(srslte_cbsegm_t *cb_segm, uint32_t Qm, uint32_t nof_e_bits, uint32_t cb_idx, 
+                      uint32_t *cb_len, uint32_t *cblen_idx, uint32_t *rlen, uint32_t *n_e, 
+                      uint32_t *rp, uint32_t *wp)
+{
+  uint32_t Gp    = nof_e_bits / Qm;
+  uint32_t gamma = Gp%cb_segm->C;
+  uint32_t crc   = cb_segm->C == 1?0:24; 
+  
+  uint32_t n_e_1 = Qm * (Gp/cb_segm->C);
+  uint32_t n_e_2 = Qm * ((uint32_t) ceilf((float) Gp/cb_segm->C));
+  uint32_t C_1   = cb_segm->C - gamma; 
+  
+  if (cb_idx < cb_segm->C2) {
+    *cb_len    = cb_segm->K2;
+    *cblen_idx = cb_segm->K2_idx;
+  } else {
+    *cb_len    = cb_segm->K1;
+    *cblen_idx = cb_segm->K1_idx;
+  }
+  *rlen = *cb_len - crc; 
+  
+  if (cb_idx < C_1) {
+    *n_e = n_e_1; 
+    *rp  = cb_idx * n_e_1; 
+  } else {
+    *n_e = n_e_2; 
+    *rp  = C_1 * n_e_1 + (cb_idx - C_1) * n_e_2; 
+  }
+  
+  if (cb_idx < cb_segm->C2) {
+    *wp = cb_idx * (cb_segm->K2 - crc);
+  } else {
+    *wp = cb_segm->C2 * (cb_segm->K2 - crc) + (cb_idx - cb_segm->C2) * (cb_segm->K1 - crc);
+  }
+}
+
+/* Rate unmatching and turbo decoding with CRC-based early stopping of one code block. 
+ * The CRC is checked after every half iteration, so decoding may stop after MAP decoder #1. 
+ * Returns true if the code block CRC (or the transport block CRC if there is a single 
+ * code block) is correct. 
+ */
+static bool decode_cb(srslte_sch_cb_job_t *job, uint32_t cb_idx, uint32_t max_iterations, 
+                      srslte_tdec_t *decoder, srslte_crc_t *crc_tb, srslte_crc_t *crc_cb, 
+                      uint8_t *cb_in, uint32_t *nof_half_its) 
+{
+  srslte_cbsegm_t *cb_segm = job->cb_segm; 
+  uint32_t cb_len, cblen_idx, rlen, n_e, rp, wp; 
+  
+  cb_params(cb_segm, job->Qm, job->nof_e_bits, cb_idx, &cb_len, &cblen_idx, &rlen, &n_e, &rp, &wp);
+  
+  *nof_half_its = 0; 
+  
+  /* Rate Unmatching */
+  if (srslte_rm_turbo_rx_lut(&job->e_bits[rp], job->softbuffer->buffer_f[cb_idx], n_e, cblen_idx, job->rv)) {
+    fprintf(stderr, "Error in rate matching\n");
+    return false;
+  }
+
+  if (SRSLTE_VERBOSE_ISDEBUG()) {
+    char tmpstr[64]; 
+    snprintf(tmpstr,64,"rmout_%d.dat",cb_idx);
+    DEBUG("SAVED FILE %s: Encoded turbo code block %d\n", tmpstr, cb_idx);
+    srslte_vec_save_file(tmpstr, job->softbuffer->buffer_f[cb_idx], (3*cb_len+12)*sizeof(int16_t));
+  }
+
+  /* Turbo Decoding with CRC-based early stopping */
+  uint32_t len_crc; 
+  srslte_crc_t *crc_ptr; 
+  bool crc_ok = false; 
+
+  if (cb_segm->C > 1) {
+    len_crc = cb_len; 
+    crc_ptr = crc_cb; 
+  } else {
+    len_crc = cb_segm->tbs+24; 
+    crc_ptr = crc_tb; 
+  }
+
+  srslte_tdec_reset(decoder, cb_len);
+        
+  do {
+    /* Stop if the iteration budget of the transport block is exhausted */
+    if (job->has_budget && __sync_fetch_and_sub(&job->budget, 1) <= 0) {
+      INFO("CB#%d: iteration budget exhausted after %d half iterations\n", cb_idx, *nof_half_its);
+      break; 
+    }
+    
+    srslte_tdec_half_iteration(decoder, job->softbuffer->buffer_f[cb_idx], cb_len); 
+    (*nof_half_its)++;
+    
+    srslte_tdec_decision_byte(decoder, cb_in, cb_len);
+             
+    /* Check Codeblock CRC and stop early if correct */
+    if (!srslte_crc_checksum_byte(crc_ptr, cb_in, len_crc)) {
+      crc_ok = true;           
+    }
+   
+  } while (*nof_half_its < 2*max_iterations && !crc_ok);
+
+  INFO("CB#%d: cb_len: %d, rlen: %d, wp: %d, rp: %d, E: %d, n_half_iters=%d\n", cb_idx,
+      cb_len, rlen, wp, rp, n_e, *nof_half_its);
+  
+  /* Copy data to another buffer, removing the Codeblock CRC */
+  if (cb_idx < cb_segm->C - 1) {
+    memcpy(&job->data[wp/8], cb_in, rlen/8 * sizeof(uint8_t));
+  } else {        
+    /* Append Transport Block parity bits to the last CB */
+    memcpy(&job->data[wp/8], cb_in, (rlen - 24)/8 * sizeof(uint8_t));
+    memcpy(job->parity, &cb_in[(rlen - 24)/8], 3 * sizeof(uint8_t));
+  }
+  
+  return crc_ok; 
+}
+
+/* Decodes code blocks of the current job until all of them have been decoded or one of them 
+ * fails. Called by the caller of decode_tb() and by every code block worker. 
+ */
+static void decode_cb_job(srslte_sch_t *q, srslte_tdec_t *decoder, srslte_crc_t *crc_tb, 
+                          srslte_crc_t *crc_cb, uint8_t *cb_in, uint32_t *half_its_sum, 
+                          uint32_t *half_its_saved, uint32_t *half_its_max, uint32_t *nof_cb) 
+{
+  srslte_sch_cb_job_t *job = &q->cb_job; 
+  uint32_t cb_idx, nof_half_its;
+  bool crc_ok; 
+  
+  *half_its_sum   = 0; 
+  *half_its_saved = 0; 
+  *half_its_max   = 0; 
+  *nof_cb = 0; 
+  
+  // If a CB CRC is not correct, the rest of CBs are not decoded
+  while (!job->failed) {
+    cb_idx = __sync_fetch_and_add(&job->next_cb, 1);
+    if (cb_idx >= job->cb_segm->C) {
+      break; 
+    }
+    crc_ok = decode_cb(job, cb_idx, q->max_iterations, decoder, crc_tb, crc_cb, cb_in, &nof_half_its);
+    if (crc_ok) {
+      *half_its_saved += 2*q->max_iterations - nof_half_its; 
+    } else if (!SRSLTE_VERBOSE_ISDEBUG()) {
+      INFO("CB %d failed. TB is erroneous.\n", cb_idx);
+      job->failed = true; 
+    }
+    job->cb_half_its[cb_idx] = nof_half_its; 
+    *half_its_sum += nof_half_its; 
+    if (nof_half_its > *half_its_max) {
+      *half_its_max = nof_half_its; 
+    }
+    (*nof_cb)++;
+  }
+}
+
+static void *cb_worker_thread(void *arg) 
+{
+  srslte_sch_cb_worker_t *w = (srslte_sch_cb_worker_t*) arg; 
+  srslte_sch_t *q = (srslte_sch_t*) w->sch; 
+  
+  pthread_mutex_lock(&q->cb_mutex);
+  while (q->cb_running) {
+    if (w->job_id == q->cb_job_id) {
+      pthread_cond_wait(&q->cb_cvar_start, &q->cb_mutex);
+    } else {
+      w->job_id = q->cb_job_id; 
+      pthread_mutex_unlock(&q->cb_mutex);
+      
+      decode_cb_job(q, &w->decoder, &w->crc_tb, &w->crc_cb, w->cb_in, 
+                    &w->half_its_sum, &w->half_its_saved, &w->half_its_max, &w->nof_cb);
+      
+      pthread_mutex_lock(&q->cb_mutex);
+      q->cb_nof_active--; 
+      if (q->cb_nof_active == 0) {
+        pthread_cond_signal(&q->cb_cvar_done);
+      }
+    }
+  }
+  pthread_mutex_unlock(&q->cb_mutex);
+  return NULL; 
+}
+
+static void cb_workers_stop(srslte_sch_t *q) 
+{
+  if (q->nof_cb_workers > 0) {
+    pthread_mutex_lock(&q->cb_mutex);
+    q->cb_running = false; 
+    pthread_cond_broadcast(&q->cb_cvar_start);
+    pthread_mutex_unlock(&q->cb_mutex);
+    
+    for (uint32_t i=0;i<q->nof_cb_workers;i++) {
+      pthread_join(q->cb_workers[i].thread, NULL);
+    }
+    for (uint32_t i=0;i<q->nof_cb_workers;i++) {
+      srslte_tdec_free(&q->cb_workers[i].decoder);
+      if (q->cb_workers[i].cb_in) {
+        free(q->cb_workers[i].cb_in);
+      }
+    }
+    bzero(q->cb_workers, sizeof(srslte_sch_cb_worker_t)*SRSLTE_SCH_MAX_CB_THREADS);
+    
+    pthread_mutex_destroy(&q->cb_mutex);
+    pthread_cond_destroy(&q->cb_cvar_start);
+    pthread_cond_destroy(&q->cb_cvar_done);
+    q->nof_cb_workers = 0; 
+  }
+}
+
+/* Sets the number of threads (including the caller) that decode the code blocks of a 
+ * transport block in parallel. Each additional thread has its own turbo decoder. 
+ */
+int srslte_sch_set_nof_cb_threads(srslte_sch_t *q, uint32_t nof_threads) 
+{
+  if (nof_threads == 0 || nof_threads > SRSLTE_SCH_MAX_CB_THREADS) {
+    fprintf(stderr, "Error invalid number of code block threads %d (max %d)\n", 
+            nof_threads, SRSLTE_SCH_MAX_CB_THREADS);
+    return SRSLTE_ERROR_INVALID_INPUTS; 
+  }
+  
+  cb_workers_stop(q);
+  
+  if (nof_threads > 1) {
+    pthread_mutex_init(&q->cb_mutex, NULL);
+    pthread_cond_init(&q->cb_cvar_start, NULL);
+    pthread_cond_init(&q->cb_cvar_done, NULL);
+    q->cb_running = true; 
+    q->cb_job_id  = 0; 
+    
+    for (uint32_t i=0;i<nof_threads-1;i++) {
+      srslte_sch_cb_worker_t *w = &q->cb_workers[i];
+      w->sch = q; 
+      w->job_id = 0; 
+      if (srslte_crc_init(&w->crc_tb, SRSLTE_LTE_CRC24A, 24) || 
+          srslte_crc_init(&w->crc_cb, SRSLTE_LTE_CRC24B, 24)) 
+      {
+        fprintf(stderr, "Error initiating CRC\n");
+        goto clean;
+      }
+      if (srslte_tdec_init(&w->decoder, SRSLTE_TCOD_MAX_LEN_CB)) {
+        fprintf(stderr, "Error initiating Turbo Decoder\n");
+        goto clean;
+      }
+      w->cb_in = srslte_vec_malloc(sizeof(uint8_t) * (SRSLTE_TCOD_MAX_LEN_CB+8)/8);
+      if (!w->cb_in) {
+        perror("malloc");
+        srslte_tdec_free(&w->decoder);
+        goto clean;
+      }
+      if (pthread_create(&w->thread, NULL, cb_worker_thread, w)) {
+        perror("pthread_create");
+        srslte_tdec_free(&w->decoder);
+        free(w->cb_in);
+        goto clean;
+      }
+      q->nof_cb_workers++;
+    }
+  }
+  return SRSLTE_SUCCESS; 
+  
+clean: 
+  cb_workers_stop(q);
+  return SRSLTE_ERROR; 
+}
+
 /**
  * Decode a transport block according to 36.212 5.3.2
  *
+ * If code block threads have been configured, the code blocks of the transport block are 
+ * decoded in parallel by the calling thread and the workers. 
+ * 
  * @param[in] q
  * @param[inout] softbuffer Initialized softbuffer
  * @param[in] cb_segm Code block segmentation parameters
@@ -334,8 +630,6 @@ static int decode_tb(srslte_sch_t *q,
 {
   uint8_t parity[3] = {0, 0, 0};
   uint32_t par_rx, par_tx;
-  uint32_t i;
-  uint32_t cb_len, rp, wp, rlen, n_e;
   
   if (q            != NULL && 
       data         != NULL &&       
@@ -344,16 +638,13 @@ static int decode_tb(srslte_sch_t *q,
       cb_segm      != NULL)
   {
 
+    q->nof_half_its_spent = 0; 
+    q->nof_half_its_saved = 0; 
+
     if (cb_segm->tbs == 0 || cb_segm->C == 0) {
       return SRSLTE_SUCCESS;
     }
     
-    rp = 0;
-    rp = 0;
-    wp = 0;
-    uint32_t Gp = nof_e_bits / Qm;
-    uint32_t gamma=Gp;
-
     if (cb_segm->F) {
       fprintf(stderr, "Error filler bits are not supported. Use standard TBS\n");
       return SRSLTE_ERROR;       
@@ -364,107 +655,69 @@ static int decode_tb(srslte_sch_t *q,
       return SRSLTE_ERROR;
     }
     
-    if (cb_segm->C>0) {
-      gamma = Gp%cb_segm->C;
+    srslte_sch_cb_job_t *job = &q->cb_job; 
+    job->softbuffer = softbuffer; 
+    job->cb_segm    = cb_segm; 
+    job->Qm         = Qm; 
+    job->rv         = rv; 
+    job->nof_e_bits = nof_e_bits; 
+    job->e_bits     = e_bits; 
+    job->data       = data; 
+    job->parity     = parity; 
+    job->next_cb    = 0; 
+    memset(job->cb_half_its, 0xff, sizeof(uint32_t)*cb_segm->C); 
+    job->has_budget = q->iteration_budget > 0; 
+    job->budget     = 2*q->iteration_budget; 
+    job->failed     = false; 
+    
+    uint32_t nof_workers = 0; 
+    if (cb_segm->C > 1) {
+      nof_workers = SRSLTE_MIN(q->nof_cb_workers, cb_segm->C - 1); 
     }
     
-    bool early_stop = true;
-    for (i = 0; i < cb_segm->C && early_stop; i++) {
-
-      /* Get read/write lengths */
-      uint32_t cblen_idx; 
-      if (i < cb_segm->C2) {
-        cb_len = cb_segm->K2;
-        cblen_idx = cb_segm->K2_idx;
-      } else {
-        cb_len = cb_segm->K1;
-        cblen_idx = cb_segm->K1_idx;
+    if (nof_workers > 0) {
+      pthread_mutex_lock(&q->cb_mutex);
+      q->cb_nof_active = q->nof_cb_workers; 
+      q->cb_job_id++; 
+      pthread_cond_broadcast(&q->cb_cvar_start);
+      pthread_mutex_unlock(&q->cb_mutex);
+    }
+    
+    uint32_t half_its_sum, half_its_saved, half_its_max, nof_cb; 
+    decode_cb_job(q, &q->decoder, &q->crc_tb, &q->crc_cb, q->cb_in, 
+                  &half_its_sum, &half_its_saved, &half_its_max, &nof_cb);
+    
+    if (nof_workers > 0) {
+      pthread_mutex_lock(&q->cb_mutex);
+      while (q->cb_nof_active > 0) {
+        pthread_cond_wait(&q->cb_cvar_done, &q->cb_mutex);
       }
+      pthread_mutex_unlock(&q->cb_mutex);
       
-      if (cb_segm->C == 1) {
-        rlen = cb_len;
-      } else {
-        rlen = cb_len - 24;
-      }
-
-      if (i <= cb_segm->C - gamma - 1) {
-        n_e = Qm * (Gp/cb_segm->C);
-      } else {
-        n_e = Qm * ((uint32_t) ceilf((float) Gp/cb_segm->C));
-      }
-
-      /* Rate Unmatching */
-      if (srslte_rm_turbo_rx_lut(&e_bits[rp], softbuffer->buffer_f[i], n_e, cblen_idx, rv)) {
-        fprintf(stderr, "Error in rate matching\n");
-        return SRSLTE_ERROR;
-      }
-
-      if (SRSLTE_VERBOSE_ISDEBUG()) {
-        char tmpstr[64]; 
-        snprintf(tmpstr,64,"rmout_%d.dat",i);
-        DEBUG("SAVED FILE %s: Encoded turbo code block %d\n", tmpstr, i);
-        srslte_vec_save_file(tmpstr, softbuffer->buffer_f[i], (3*cb_len+12)*sizeof(int16_t));
-      }
-
-      /* Turbo Decoding with CRC-based early stopping */
-      q->nof_iterations = 0; 
-      uint32_t len_crc; 
-      srslte_crc_t *crc_ptr; 
-      early_stop = false; 
-
-      srslte_tdec_reset(&q->decoder, cb_len);
-            
-      do {
-        srslte_tdec_iteration(&q->decoder, softbuffer->buffer_f[i], cb_len); 
-        q->nof_iterations++;
-        
-        if (cb_segm->C > 1) {
-          len_crc = cb_len; 
-          crc_ptr = &q->crc_cb; 
-        } else {
-          len_crc = cb_segm->tbs+24; 
-          crc_ptr = &q->crc_tb; 
+      for (uint32_t i=0;i<q->nof_cb_workers;i++) {
+        half_its_sum   += q->cb_workers[i].half_its_sum; 
+        half_its_saved += q->cb_workers[i].half_its_saved; 
+        nof_cb         += q->cb_workers[i].nof_cb; 
+        if (q->cb_workers[i].half_its_max > half_its_max) {
+          half_its_max = q->cb_workers[i].half_its_max; 
         }
-
-        srslte_tdec_decision_byte(&q->decoder, q->cb_in, cb_len);
-                 
-        /* Check Codeblock CRC and stop early if correct */
-        if (!srslte_crc_checksum_byte(crc_ptr, q->cb_in, len_crc)) {
-          early_stop = true;           
-        }
-       
-      } while (q->nof_iterations < q->max_iterations && !early_stop);
-      q->average_nof_iterations = SRSLTE_VEC_EMA((float) q->nof_iterations, q->average_nof_iterations, 0.2);
-
-      INFO("CB#%d: cb_len: %d, rlen: %d, wp: %d, rp: %d, E: %d, n_iters=%d\n", i,
-          cb_len, rlen, wp, rp, n_e, q->nof_iterations);
-      
-            
-      // If CB CRC is not correct, early_stop will be false and wont continue with rest of CBs
-
-      /* Copy data to another buffer, removing the Codeblock CRC */
-      if (i < cb_segm->C - 1) {
-        memcpy(&data[wp/8], q->cb_in, rlen/8 * sizeof(uint8_t));
-      } else {        
-        /* Append Transport Block parity bits to the last CB */
-        memcpy(&data[wp/8], q->cb_in, (rlen - 24)/8 * sizeof(uint8_t));
-        memcpy(parity, &q->cb_in[(rlen - 24)/8], 3 * sizeof(uint8_t));
       }
-      
-      if (SRSLTE_VERBOSE_ISDEBUG()) {
-        early_stop = true; 
+    }
+    
+    q->nof_iterations     = (half_its_max+1)/2; 
+    q->nof_half_its_spent = half_its_sum; 
+    q->nof_half_its_saved = half_its_saved; 
+    // Averaged per code block, in code block order, skipping the ones not decoded after a failure 
+    for (uint32_t i=0;i<cb_segm->C;i++) {
+      if (job->cb_half_its[i] != UINT32_MAX) {
+        q->average_nof_iterations = SRSLTE_VEC_EMA((float) job->cb_half_its[i]/2, q->average_nof_iterations, 0.2);
       }
-      
-      /* Set read/write pointers */
-      wp += rlen;
-      rp += n_e;
     }
     
-    if (!early_stop) {
-      INFO("CB %d failed. TB is erroneous.\n",i-1);
+    if (job->failed) {
       return SRSLTE_ERROR; 
     } else {
-      INFO("END CB#%d: wp: %d, rp: %d\n", i, wp, rp);
+      INFO("END CB#%d\n", nof_cb);
 
       // Compute transport block CRC
       par_rx = srslte_crc_checksum_byte(&q->crc_tb, data, cb_segm->tbs);
@@ -477,7 +730,7 @@ static int decode_tb(srslte_sch_t *q,
       }
 
       if (par_rx == par_tx) {
-        INFO("TB decoded OK\n",i);
+        INFO("TB decoded OK, tbs=%d\n", cb_segm->tbs);
         return SRSLTE_SUCCESS;
       } else {
         INFO("Error in TB parity: par_tx=0x%x, par_rx=0x%x\n", par_tx, par_rx);
@@ -85,3 +85,18 @@ int srslte_sequence_pucch(srslte_sequence_t *seq, uint16_t rnti, uint32_t nslot,
   bzero(seq, sizeof(srslte_sequence_t));
   return srslte_sequence_LTE_pr(seq, 20, ((((nslot/2)+1)*(2*cell_id+1))<<16)+rnti);
 }
+
+/* Packed-only versions of the per-RNTI sequences. Unlike the functions above, these do not
+ * clear seq, so that the same sequence can be regenerated without allocating.
+ */
+int srslte_sequence_pdsch_packed(srslte_sequence_t *seq, uint16_t rnti, int q, uint32_t nslot, uint32_t cell_id, uint32_t len) {
+  return srslte_sequence_LTE_pr_packed(seq, len, (rnti<<14) + (q<<13) + ((nslot/2)<<9) + cell_id);
+}
+
+int srslte_sequence_pusch_packed(srslte_sequence_t *seq, uint16_t rnti, uint32_t nslot, uint32_t cell_id, uint32_t len) {
+  return srslte_sequence_LTE_pr_packed(seq, len, (rnti<<14) + ((nslot/2)<<9) + cell_id);
+}
+
+int srslte_sequence_pucch_packed(srslte_sequence_t *seq, uint16_t rnti, uint32_t nslot, uint32_t cell_id) {
+  return srslte_sequence_LTE_pr_packed(seq, 20, ((((nslot/2)+1)*(2*cell_id+1))<<16)+rnti);
+}
@@ -0,0 +1,241 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "srslte/srslte.h"
+
+/* Checks the early stopping of the turbo decoder per half iteration and the iteration budget
+ * of a transport block:
+ *  - without noise, every code block stops after its first half iteration
+ *  - with noise and no budget, the TB is decoded and the iterations spent and saved add up
+ *  - with a budget of at least what it needs, the TB is decoded with the same iterations
+ *  - with a smaller budget, exactly the budget is spent and the TB CRC fails
+ * decoding the code blocks in the calling thread only and in nof_threads threads.
+ */
+
+uint32_t nof_prb = 50;
+uint32_t mcs = 9;
+uint32_t nof_threads = 2;
+float snr_db = 4.0;
+
+void usage(char *prog) {
+  printf("Usage: %s [pmtsv]\n", prog);
+  printf("\t-p nof_prb [Default %d]\n", nof_prb);
+  printf("\t-m mcs [Default %d]\n", mcs);
+  printf("\t-t number of code block threads [Default %d]\n", nof_threads);
+  printf("\t-s snr in dB of the noisy TB [Default %.1f]\n", snr_db);
+  printf("\t-v srslte_verbose\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "pmtsv")) != -1) {
+    switch (opt) {
+    case 'p':
+      nof_prb = atoi(argv[optind]);
+      break;
+    case 'm':
+      mcs = atoi(argv[optind]);
+      break;
+    case 't':
+      nof_threads = atoi(argv[optind]);
+      break;
+    case 's':
+      snr_db = atof(argv[optind]);
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+srslte_sch_t sch;
+srslte_pdsch_cfg_t cfg;
+srslte_softbuffer_rx_t softbuffer_rx;
+uint8_t *data_tx, *data_rx;
+int16_t *llr_clean, *llr_noisy;
+
+/* Decodes llr with the given budget (0 for none). Returns true if the TB CRC is correct */
+bool decode(int16_t *llr, uint32_t budget, float *spent, float *saved) {
+  srslte_softbuffer_rx_reset_tbs(&softbuffer_rx, cfg.grant.mcs.tbs);
+  srslte_sch_set_iteration_budget(&sch, budget);
+  bzero(data_rx, cfg.grant.mcs.tbs/8);
+  int r = srslte_dlsch_decode(&sch, &cfg, &softbuffer_rx, llr, data_rx);
+  *spent = srslte_sch_last_noi_spent(&sch);
+  *saved = srslte_sch_last_noi_saved(&sch);
+  return r == SRSLTE_SUCCESS && !memcmp(data_tx, data_rx, cfg.grant.mcs.tbs/8);
+}
+
+int run_tests(uint32_t threads) {
+  float spent, saved, need;
+  uint32_t C = cfg.cb_segm.C;
+  uint32_t max_its = sch.max_iterations;
+
+  if (srslte_sch_set_nof_cb_threads(&sch, threads)) {
+    fprintf(stderr, "Error setting %d code block threads\n", threads);
+    return -1;
+  }
+
+  // Without noise, the a posteriori output of the first MAP decoder is already correct
+  if (!decode(llr_clean, 0, &spent, &saved)) {
+    printf("threads=%d: TB without noise not decoded\n", threads);
+    return -1;
+  }
+  if (spent != 0.5*C) {
+    printf("threads=%d: %.1f iterations spent without noise, expected %.1f\n", threads, spent, 0.5*C);
+    return -1;
+  }
+
+  // Noisy TB without budget
+  if (!decode(llr_noisy, 0, &spent, &saved)) {
+    printf("threads=%d: noisy TB not decoded\n", threads);
+    return -1;
+  }
+  if (spent <= 0.5*C || spent + saved != (float) C*max_its) {
+    printf("threads=%d: %.1f iterations spent and %.1f saved, max %d\n", threads, spent, saved, C*max_its);
+    return -1;
+  }
+  need = spent;
+  printf("threads=%d: %.1f iterations needed\n", threads, need);
+
+  // A budget that covers what the TB needs does not change the decoding
+  if (!decode(llr_noisy, (uint32_t) ceilf(need), &spent, &saved) || spent != need) {
+    printf("threads=%d: budget of %d iterations: %.1f spent, %.1f needed\n", threads, (uint32_t) ceilf(need), spent, need);
+    return -1;
+  }
+
+  // A smaller budget is spent in full and the TB fails
+  uint32_t budget = (uint32_t) floorf(need) - 1;
+  if (budget == 0) {
+    budget = 1;
+  }
+  if (decode(llr_noisy, budget, &spent, &saved)) {
+    printf("threads=%d: TB decoded with a budget of %d iterations, %.1f needed\n", threads, budget, need);
+    return -1;
+  }
+  if (spent != (float) budget) {
+    printf("threads=%d: %.1f iterations spent with a budget of %d\n", threads, spent, budget);
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  srslte_softbuffer_tx_t softbuffer_tx;
+  int ret = -1;
+
+  parse_args(argc, argv);
+
+  /* 12 OFDM symbols per subframe available for the PDSCH */
+  uint32_t nof_re   = nof_prb * SRSLTE_NRE * 12;
+  uint32_t max_bits = nof_re * 6;
+
+  data_tx          = srslte_vec_malloc(sizeof(uint8_t) * max_bits / 8);
+  data_rx          = srslte_vec_malloc(sizeof(uint8_t) * max_bits / 8);
+  uint8_t *e_bits  = srslte_vec_malloc(sizeof(uint8_t) * max_bits / 8);
+  uint8_t *e_unpk  = srslte_vec_malloc(sizeof(uint8_t) * max_bits);
+  float *llr_f     = srslte_vec_malloc(sizeof(float) * max_bits);
+  llr_clean        = srslte_vec_malloc(sizeof(int16_t) * max_bits);
+  llr_noisy        = srslte_vec_malloc(sizeof(int16_t) * max_bits);
+  if (!data_tx || !data_rx || !e_bits || !e_unpk || !llr_f || !llr_clean || !llr_noisy) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  if (srslte_sch_init(&sch)) {
+    fprintf(stderr, "Error initiating SCH\n");
+    exit(-1);
+  }
+  if (srslte_softbuffer_tx_init(&softbuffer_tx, nof_prb) ||
+      srslte_softbuffer_rx_init(&softbuffer_rx, nof_prb))
+  {
+    fprintf(stderr, "Error initiating soft buffers\n");
+    exit(-1);
+  }
+
+  bzero(&cfg, sizeof(srslte_pdsch_cfg_t));
+  int tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(mcs), nof_prb);
+  cfg.grant.mcs.mod      = srslte_ra_mod_from_mcs(mcs);
+  cfg.grant.mcs.tbs      = tbs;
+  cfg.grant.Qm           = srslte_mod_bits_x_symbol(cfg.grant.mcs.mod);
+  cfg.nbits.nof_re       = nof_re;
+  cfg.nbits.nof_bits     = nof_re * cfg.grant.Qm;
+  if (tbs <= 0 || srslte_cbsegm(&cfg.cb_segm, tbs)) {
+    fprintf(stderr, "Error computing code block segmentation\n");
+    goto quit;
+  }
+
+  srand(0);
+  for (uint32_t i=0;i<tbs/8;i++) {
+    data_tx[i] = rand()%256;
+  }
+  srslte_softbuffer_tx_reset(&softbuffer_tx);
+  if (srslte_dlsch_encode(&sch, &cfg, &softbuffer_tx, data_tx, e_bits)) {
+    fprintf(stderr, "Error encoding TB\n");
+    goto quit;
+  }
+  srslte_bit_unpack_vector(e_bits, e_unpk, cfg.nbits.nof_bits);
+  for (uint32_t i=0;i<cfg.nbits.nof_bits;i++) {
+    llr_f[i]     = e_unpk[i] ? 1 : -1;
+    llr_clean[i] = (int16_t) (100*llr_f[i]);
+  }
+  srslte_ch_awgn_f(llr_f, llr_f, sqrt(pow(10, -snr_db / 10)), cfg.nbits.nof_bits);
+  for (uint32_t i=0;i<cfg.nbits.nof_bits;i++) {
+    llr_noisy[i] = (int16_t) (100*llr_f[i]);
+  }
+
+  printf("MCS=%d, TBS=%d, C=%d\n", mcs, tbs, cfg.cb_segm.C);
+  if (run_tests(1) || (nof_threads > 1 && run_tests(nof_threads))) {
+    goto quit;
+  }
+
+  printf("Ok\n");
+  ret = 0;
+
+quit:
+  srslte_sch_free(&sch);
+  srslte_softbuffer_tx_free(&softbuffer_tx);
+  srslte_softbuffer_rx_free(&softbuffer_rx);
+  free(data_tx);
+  free(data_rx);
+  free(e_bits);
+  free(e_unpk);
+  free(llr_f);
+  free(llr_clean);
+  free(llr_noisy);
+
+  exit(ret);
+}
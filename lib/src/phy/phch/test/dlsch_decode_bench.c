@@ -0,0 +1,213 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+
+#include <sys/time.h>
+#include "srslte/srslte.h"
+
+/* Measures the DL-SCH transport block decoding latency for every MCS using 1 up to 
+ * nof_threads code block decoding threads */
+
+uint32_t nof_prb = 100;
+uint32_t nof_frames = 100;
+uint32_t max_threads = 4;
+int mcs_sel = -1;
+float snr_db = 20.0;
+
+void usage(char *prog) {
+  printf("Usage: %s [nptms]\n", prog);
+  printf("\t-n nof_frames per MCS [Default %d]\n", nof_frames);
+  printf("\t-p nof_prb [Default %d]\n", nof_prb);
+  printf("\t-t max number of code block threads [Default %d]\n", max_threads);
+  printf("\t-m mcs [Default all]\n");
+  printf("\t-s snr in dB [Default %.1f]\n", snr_db);
+  printf("\t-v srslte_verbose\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nptmsv")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_frames = atoi(argv[optind]);
+      break;
+    case 'p':
+      nof_prb = atoi(argv[optind]);
+      break;
+    case 't':
+      max_threads = atoi(argv[optind]);
+      break;
+    case 'm':
+      mcs_sel = atoi(argv[optind]);
+      break;
+    case 's':
+      snr_db = atof(argv[optind]);
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  srslte_sch_t sch;
+  srslte_pdsch_cfg_t cfg;
+  srslte_softbuffer_tx_t softbuffer_tx;
+  srslte_softbuffer_rx_t softbuffer_rx;
+  struct timeval tdata[3];
+  int ret = -1;
+
+  parse_args(argc, argv);
+
+  if (max_threads == 0 || max_threads > SRSLTE_SCH_MAX_CB_THREADS) {
+    fprintf(stderr, "Invalid number of threads (max %d)\n", SRSLTE_SCH_MAX_CB_THREADS);
+    exit(-1);
+  }
+
+  /* 12 OFDM symbols per subframe available for the PDSCH */
+  uint32_t nof_re   = nof_prb * SRSLTE_NRE * 12;
+  uint32_t max_bits = nof_re * 6;
+
+  uint8_t *data_tx = srslte_vec_malloc(sizeof(uint8_t) * max_bits / 8);
+  uint8_t *data_rx = srslte_vec_malloc(sizeof(uint8_t) * max_bits / 8);
+  uint8_t *e_bits  = srslte_vec_malloc(sizeof(uint8_t) * max_bits / 8);
+  uint8_t *e_unpk  = srslte_vec_malloc(sizeof(uint8_t) * max_bits);
+  float *llr_f     = srslte_vec_malloc(sizeof(float) * max_bits);
+  int16_t *llr     = srslte_vec_malloc(sizeof(int16_t) * max_bits);
+  if (!data_tx || !data_rx || !e_bits || !e_unpk || !llr_f || !llr) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  if (srslte_sch_init(&sch)) {
+    fprintf(stderr, "Error initiating SCH\n");
+    exit(-1);
+  }
+  if (srslte_softbuffer_tx_init(&softbuffer_tx, nof_prb) ||
+      srslte_softbuffer_rx_init(&softbuffer_rx, nof_prb)) 
+  {
+    fprintf(stderr, "Error initiating soft buffers\n");
+    exit(-1);
+  }
+
+  printf("%4s %6s %3s", "MCS", "TBS", "C");
+  for (uint32_t t=1;t<=max_threads;t++) {
+    printf("  %2d thr usec", t);
+  }
+  printf("\n");
+
+  float var = sqrt(pow(10, -snr_db / 10));
+  uint32_t nof_errors = 0;
+
+  srand(0);
+  for (uint32_t mcs=0;mcs<29;mcs++) {
+    if (mcs_sel >= 0 && mcs != mcs_sel) {
+      continue;
+    }
+    bzero(&cfg, sizeof(srslte_pdsch_cfg_t));
+    int tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(mcs), nof_prb);
+    if (tbs <= 0) {
+      continue;
+    }
+    cfg.grant.mcs.mod      = srslte_ra_mod_from_mcs(mcs);
+    cfg.grant.mcs.tbs      = tbs;
+    cfg.grant.Qm           = srslte_mod_bits_x_symbol(cfg.grant.mcs.mod);
+    cfg.nbits.nof_re       = nof_re;
+    cfg.nbits.nof_bits     = nof_re * cfg.grant.Qm;
+    if (srslte_cbsegm(&cfg.cb_segm, tbs)) {
+      fprintf(stderr, "Error computing code block segmentation\n");
+      goto quit;
+    }
+
+    printf("%4d %6d %3d", mcs, tbs, cfg.cb_segm.C);
+    for (uint32_t t=1;t<=max_threads;t++) {
+      if (srslte_sch_set_nof_cb_threads(&sch, t)) {
+        fprintf(stderr, "Error setting %d code block threads\n", t);
+        goto quit;
+      }
+      uint64_t usec = 0;
+      for (uint32_t n=0;n<nof_frames;n++) {
+        for (uint32_t i=0;i<tbs/8;i++) {
+          data_tx[i] = rand()%256;
+        }
+        srslte_softbuffer_tx_reset(&softbuffer_tx);
+        if (srslte_dlsch_encode(&sch, &cfg, &softbuffer_tx, data_tx, e_bits)) {
+          fprintf(stderr, "Error encoding TB\n");
+          goto quit;
+        }
+        srslte_bit_unpack_vector(e_bits, e_unpk, cfg.nbits.nof_bits);
+        for (uint32_t i=0;i<cfg.nbits.nof_bits;i++) {
+          llr_f[i] = e_unpk[i] ? 1 : -1;
+        }
+        srslte_ch_awgn_f(llr_f, llr_f, var, cfg.nbits.nof_bits);
+        for (uint32_t i=0;i<cfg.nbits.nof_bits;i++) {
+          llr[i] = (int16_t) (100*llr_f[i]);
+        }
+
+        srslte_softbuffer_rx_reset_tbs(&softbuffer_rx, tbs);
+        gettimeofday(&tdata[1], NULL);
+        int r = srslte_dlsch_decode(&sch, &cfg, &softbuffer_rx, llr, data_rx);
+        gettimeofday(&tdata[2], NULL);
+        get_time_interval(tdata);
+        usec += tdata[0].tv_sec*1000000 + tdata[0].tv_usec;
+
+        if (r || memcmp(data_tx, data_rx, tbs/8)) {
+          nof_errors++;
+        }
+      }
+      printf("  %11.1f", (float) usec/nof_frames);
+      fflush(stdout);
+    }
+    printf("\n");
+  }
+
+  printf("Errors: %d\n", nof_errors);
+  ret = nof_errors ? -1 : 0;
+
+quit:
+  srslte_sch_free(&sch);
+  srslte_softbuffer_tx_free(&softbuffer_tx);
+  srslte_softbuffer_rx_free(&softbuffer_rx);
+  free(data_tx);
+  free(data_rx);
+  free(e_bits);
+  free(e_unpk);
+  free(llr_f);
+  free(llr);
+
+  exit(ret);
+}
@@ -0,0 +1,179 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+#include <complex.h>
+
+#include "srslte/srslte.h"
+
+/* Measures the CPU time of one PRACH detection opportunity, for every bandwidth and
+ * preamble formats 0 to 3, with the decimating front end and with the FFT of the
+ * whole preamble. Each opportunity holds a delayed preamble in noise, which both
+ * detectors must find with the right timing offset.
+ */
+
+uint32_t nof_opportunities = 100;
+uint32_t zero_corr_zone    = 11;
+uint32_t root_seq_idx      = 128;
+float    snr_db            = -10;
+
+#define PREAMBLE_IDX  17
+#define DELAY_US      10.0
+#define NOF_ROUNDS    5
+
+void usage(char *prog) {
+  printf("Usage: %s [nzrs]\n", prog);
+  printf("\t-n opportunities per round, for each bandwidth, format and detector [Default %d]\n", nof_opportunities);
+  printf("\t-z zero correlation zone config [Default %d]\n", zero_corr_zone);
+  printf("\t-r root sequence index [Default %d]\n", root_seq_idx);
+  printf("\t-s SNR in dB [Default %.1f]\n", snr_db);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nzrs")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_opportunities = atoi(argv[optind]);
+      break;
+    case 'z':
+      zero_corr_zone = atoi(argv[optind]);
+      break;
+    case 'r':
+      root_seq_idx = atoi(argv[optind]);
+      break;
+    case 's':
+      snr_db = atof(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+// Microseconds of CPU per opportunity, the best of NOF_ROUNDS, or a negative value if
+// the preamble was missed
+double run(srslte_prach_t *p, bool decimate, uint32_t freq_offset, cf_t *signal, uint32_t sig_len) {
+  uint32_t indices[64];
+  float    offsets[64];
+  uint32_t n = 0;
+  double   best = -1;
+  struct timespec t[2];
+
+  srslte_prach_set_decimation(p, decimate);
+  srslte_prach_detect_offset(p, freq_offset, signal, sig_len, indices, offsets, NULL, &n);
+  bool found = false;
+  for (uint32_t i=0;i<n;i++) {
+    found |= indices[i] == PREAMBLE_IDX && fabsf(offsets[i]*1e6 - DELAY_US) < 1.5;
+  }
+  if (!found) {
+    return -1;
+  }
+
+  for (uint32_t r=0;r<NOF_ROUNDS;r++) {
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t[0]);
+    for (uint32_t i=0;i<nof_opportunities;i++) {
+      srslte_prach_detect_offset(p, freq_offset, signal, sig_len, indices, offsets, NULL, &n);
+    }
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t[1]);
+    double secs = (t[1].tv_sec - t[0].tv_sec) + 1e-9*(t[1].tv_nsec - t[0].tv_nsec);
+    if (best < 0 || secs < best) {
+      best = secs;
+    }
+  }
+  return 1e6*best/nof_opportunities;
+}
+
+int main(int argc, char **argv) {
+  uint32_t nof_prbs[] = {6, 15, 25, 50, 75, 100};
+  bool     ok = true;
+
+  parse_args(argc, argv);
+
+  for (uint32_t b=0;b<sizeof(nof_prbs)/sizeof(uint32_t);b++) {
+    for (uint32_t f=0;f<4;f++) {
+      srslte_prach_t     p;
+      srslte_prach_cfg_t cfg;
+      cfg.config_idx     = 16*f;
+      cfg.root_seq_idx   = root_seq_idx;
+      cfg.zero_corr_zone = zero_corr_zone;
+      cfg.freq_offset    = (nof_prbs[b]-6)/2;
+      cfg.hs_flag        = false;
+      if (srslte_prach_init_cfg(&p, &cfg, nof_prbs[b])) {
+        fprintf(stderr, "Error initiating PRACH\n");
+        exit(-1);
+      }
+
+      // Subframes holding the opportunity, as the eNB buffers them
+      uint32_t sf_len  = SRSLTE_SF_LEN_PRB(nof_prbs[b]);
+      uint32_t nof_sf  = (uint32_t) ceilf(p.T_tot*1000);
+      uint32_t len     = nof_sf*sf_len;
+      uint32_t delay   = (uint32_t) (DELAY_US*1e-6*sf_len*1000);
+      cf_t    *signal  = srslte_vec_malloc(sizeof(cf_t)*len);
+      cf_t    *preamble = srslte_vec_malloc(sizeof(cf_t)*(p.N_cp+p.N_seq));
+      if (!signal || !preamble) {
+        perror("malloc");
+        exit(-1);
+      }
+      bzero(signal, sizeof(cf_t)*len);
+      srslte_prach_gen(&p, PREAMBLE_IDX, cfg.freq_offset, preamble);
+      memcpy(&signal[delay], preamble, sizeof(cf_t)*(p.N_cp+p.N_seq));
+      float power = srslte_vec_avg_power_cf(preamble, p.N_cp+p.N_seq);
+      srslte_ch_awgn_c(signal, signal, sqrtf(power*powf(10, -snr_db/10)), len);
+
+      // Bandwidths the front end does not decimate for have a single detector
+      double t_fft   = run(&p, false, cfg.freq_offset, &signal[p.N_cp], len-p.N_cp);
+      double t_decim = p.decim_factor ? run(&p, true, cfg.freq_offset, &signal[p.N_cp], len-p.N_cp) : t_fft;
+      if (t_fft < 0 || t_decim < 0) {
+        printf("%3d PRBs, format %d: preamble missed by the %s detector\n",
+               nof_prbs[b], f, t_fft < 0 ? "full FFT" : "decimating");
+        ok = false;
+      } else if (p.decim_factor) {
+        printf("%3d PRBs, format %d, %2d roots: full FFT %7.1f us, decimating by %2d %7.1f us (%4.2fx)\n",
+               nof_prbs[b], f, p.N_roots, t_fft, p.decim_factor, t_decim, t_fft/t_decim);
+      } else {
+        printf("%3d PRBs, format %d, %2d roots: full FFT %7.1f us\n",
+               nof_prbs[b], f, p.N_roots, t_fft);
+      }
+
+      free(signal);
+      free(preamble);
+      srslte_prach_free(&p);
+    }
+  }
+
+  if (!ok) {
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -43,6 +43,7 @@ uint32_t N_ifft_ul        = 1536;
 uint32_t config_idx       = 3;
 uint32_t root_seq_idx     = 0;
 uint32_t zero_corr_zone   = 15;
+bool     decimate         = true;
 
 void usage(char *prog) {
   printf("Usage: %s\n", prog);
@@ -50,11 +51,12 @@ void usage(char *prog) {
   printf("\t-f Preamble format [Default 0]\n");
   printf("\t-r Root sequence index [Default 0]\n");
   printf("\t-z Zero correlation zone config [Default 1]\n");
+  printf("\t-d Detect with the FFT of the whole preamble, not the decimating front end\n");
 }
 
 void parse_args(int argc, char **argv) {
   int opt;
-  while ((opt = getopt(argc, argv, "Nfrz")) != -1) {
+  while ((opt = getopt(argc, argv, "Nfrzd")) != -1) {
     switch (opt) {
     case 'N':
       N_ifft_ul = atoi(argv[optind]);
@@ -68,6 +70,9 @@ void parse_args(int argc, char **argv) {
     case 'z':
       zero_corr_zone = atoi(argv[optind]);
       break;
+    case 'd':
+      decimate = false;
+      break;
     default:
       usage(argv[0]);
       exit(-1);
@@ -91,6 +96,7 @@ int main(int argc, char **argv) {
              root_seq_idx,
              high_speed_flag,
              zero_corr_zone);
+  srslte_prach_set_decimation(p, decimate);
 
   uint32_t seq_index = 0;
   uint32_t frequency_offset = 0;
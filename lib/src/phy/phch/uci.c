@@ -545,13 +545,15 @@ static void encode_ri_ack(uint8_t data, srslte_uci_bit_type_t q_encoded_bits[6],
   }
 }
                        
+// c_seq is the scrambling sequence packed MSB first
 static int32_t decode_ri_ack(int16_t *q_bits, uint8_t *c_seq, srslte_uci_bit_t *pos) 
 {
   uint32_t p0 = pos[0].position;
   uint32_t p1 = pos[1].position;
   
-  uint32_t q0 = c_seq[p0]?q_bits[p0]:-q_bits[p0];  
-  uint32_t q1 = c_seq[p0]?q_bits[p1]:-q_bits[p1];
+  uint8_t  c0 = (c_seq[p0/8] >> (7-p0%8)) & 1;
+  uint32_t q0 = c0?q_bits[p0]:-q_bits[p0];  
+  uint32_t q1 = c0?q_bits[p1]:-q_bits[p1];
 
   return -(q0+q1);
 }
@@ -178,6 +178,45 @@ static rf_dev_t dev_soapy = {
 
 #endif
 
+/* Define implementation for the virtual RF front-end */
+#ifdef ENABLE_VIRTUAL_RF
+
+#include "rf_virt_imp.h"
+
+static rf_dev_t dev_virt = {
+  "virtual",
+  rf_virt_devname,
+  rf_virt_rx_wait_lo_locked,
+  rf_virt_start_rx_stream,
+  rf_virt_stop_rx_stream,
+  rf_virt_flush_buffer,
+  rf_virt_has_rssi,
+  rf_virt_get_rssi,
+  rf_virt_suppress_stdout,
+  rf_virt_register_error_handler,
+  rf_virt_open,
+  rf_virt_open_multi,
+  rf_virt_close,
+  rf_virt_set_master_clock_rate,
+  rf_virt_is_master_clock_dynamic,
+  rf_virt_set_rx_srate,
+  rf_virt_set_rx_gain,
+  rf_virt_set_tx_gain,
+  rf_virt_get_rx_gain,
+  rf_virt_get_tx_gain,
+  rf_virt_set_rx_freq,
+  rf_virt_set_tx_srate,
+  rf_virt_set_tx_freq,
+  rf_virt_get_time,
+  rf_virt_recv_with_time,
+  rf_virt_recv_with_time_multi,
+  rf_virt_send_timed,
+  rf_virt_set_tx_cal,
+  rf_virt_set_rx_cal
+};
+
+#endif
+
 //#define ENABLE_DUMMY_DEV
 
 #ifdef ENABLE_DUMMY_DEV
@@ -233,6 +272,9 @@ static rf_dev_t *available_devices[] = {
 #endif
 #ifdef ENABLE_DUMMY_DEV
   &dev_dummy,
+#endif
+#ifdef ENABLE_VIRTUAL_RF
+  &dev_virt,
 #endif
   NULL
 };
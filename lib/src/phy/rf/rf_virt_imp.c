@@ -0,0 +1,618 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <math.h>
+
+#include "srslte/srslte.h"
+#include "rf_virt_imp.h"
+#include "srslte/phy/rf/rf.h"
+
+#define VIRT_MAGIC        0x56495254
+// Simulated clock rate: a multiple of every LTE sampling rate, so that each of them is a
+// whole number of ticks per sample
+#define VIRT_TICK_RATE    92160000
+#define VIRT_RING_SIZE    (1<<21)
+#define VIRT_WAIT_MS      100
+#define VIRT_MAX_FREQ_ERR 1000.0
+
+typedef enum {
+  VIRT_ROLE_ENB = 0,
+  VIRT_ROLE_UE,
+  VIRT_NOF_ROLES
+} virt_role_t;
+
+/* Shared state of a link. Arrays are indexed by the role of the side that transmits
+ * into or receives from them. All times are in ticks of the simulated clock.
+ */
+typedef struct {
+  uint32_t        magic;
+  uint32_t        ring_size;
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar;
+  bool            attached[VIRT_NOF_ROLES];
+  bool            rx_waiting[VIRT_NOF_ROLES];
+  uint64_t        rx_time[VIRT_NOF_ROLES];      // Time of the next sample to be received
+  uint64_t        tx_horizon[VIRT_NOF_ROLES];   // The ring holds samples up to this time
+  uint64_t        tx_tps[VIRT_NOF_ROLES];       // Ticks per sample of the ring
+  double          tx_freq[VIRT_NOF_ROLES];
+} rf_virt_shm_t;
+
+typedef struct {
+  char           name[64];
+  virt_role_t    role;
+  rf_virt_shm_t *shm;
+  size_t         shm_size;
+  cf_t          *ring[VIRT_NOF_ROLES];
+  uint32_t       nof_rx_antennas;
+  uint64_t       rx_tps;
+  uint64_t       tx_tps;
+  double         rx_srate;
+  double         tx_srate;
+  double         rx_gain;
+  double         tx_gain;
+  double         rx_freq;
+  double         tx_freq;
+  float          noise_var;
+  srslte_rf_error_handler_t error_handler;
+} rf_virt_handler_t;
+
+static void virt_lock(rf_virt_shm_t *shm)
+{
+  // A peer that died holding the lock leaves it in an inconsistent but usable state
+  if (pthread_mutex_lock(&shm->mutex) == EOWNERDEAD) {
+    pthread_mutex_consistent(&shm->mutex);
+  }
+}
+
+static void virt_unlock(rf_virt_shm_t *shm)
+{
+  pthread_mutex_unlock(&shm->mutex);
+}
+
+static void virt_wait(rf_virt_shm_t *shm)
+{
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_nsec += VIRT_WAIT_MS*1000000;
+  deadline.tv_sec  += deadline.tv_nsec/1000000000;
+  deadline.tv_nsec %= 1000000000;
+  if (pthread_cond_timedwait(&shm->cvar, &shm->mutex, &deadline) == EOWNERDEAD) {
+    pthread_mutex_consistent(&shm->mutex);
+  }
+}
+
+static uint64_t virt_tps(double srate)
+{
+  uint64_t tps = srate > 0 ? (uint64_t) round(VIRT_TICK_RATE / srate) : 1;
+  return tps > 0 ? tps : 1;
+}
+
+static uint64_t virt_time_to_ticks(time_t secs, double frac_secs)
+{
+  return (uint64_t) secs * VIRT_TICK_RATE + (uint64_t) round(frac_secs * VIRT_TICK_RATE);
+}
+
+static void virt_ticks_to_time(uint64_t ticks, time_t *secs, double *frac_secs)
+{
+  if (secs && frac_secs) {
+    *secs      = ticks / VIRT_TICK_RATE;
+    *frac_secs = (double) (ticks % VIRT_TICK_RATE) / VIRT_TICK_RATE;
+  }
+}
+
+static void virt_error(rf_virt_handler_t *handler, int type, int opt)
+{
+  if (handler->error_handler) {
+    srslte_rf_error_t error;
+    bzero(&error, sizeof(srslte_rf_error_t));
+    error.type = type;
+    error.opt  = opt;
+    handler->error_handler(error);
+  } else if (type == SRSLTE_RF_ERROR_LATE) {
+    fprintf(stderr, "L");
+    fflush(stderr);
+  }
+}
+
+/* Samples [t0, t_end) can be received when the peer has transmitted them, or when the
+ * peer has moved past them (it never transmits in its past), or when both sides wait
+ * for each other and the peer is not behind.
+ */
+static bool virt_rx_ready(rf_virt_shm_t *shm, virt_role_t role, uint64_t t0, uint64_t t_end)
+{
+  virt_role_t peer = 1 - role;
+  return !shm->attached[peer]                                  ||
+         shm->tx_horizon[peer] >= t_end                        ||
+         shm->rx_time[peer] >= t_end                           ||
+         (shm->rx_waiting[peer] && shm->rx_time[peer] >= t0);
+}
+
+static bool virt_parse_arg(char *args, const char *key, char *value, uint32_t max_len)
+{
+  char *p = args?strstr(args, key):NULL;
+  if (!p) {
+    return false;
+  }
+  p += strlen(key);
+  uint32_t i = 0;
+  while (p[i] != '\0' && p[i] != ',' && i < max_len - 1) {
+    value[i] = p[i];
+    i++;
+  }
+  value[i] = '\0';
+  return true;
+}
+
+char* rf_virt_devname(void *h)
+{
+  return "virtual";
+}
+
+bool rf_virt_rx_wait_lo_locked(void *h)
+{
+  return true;
+}
+
+void rf_virt_set_tx_cal(void *h, srslte_rf_cal_t *cal)
+{
+  // not supported
+}
+
+void rf_virt_set_rx_cal(void *h, srslte_rf_cal_t *cal)
+{
+  // not supported
+}
+
+int rf_virt_start_rx_stream(void *h)
+{
+  return SRSLTE_SUCCESS;
+}
+
+int rf_virt_stop_rx_stream(void *h)
+{
+  return SRSLTE_SUCCESS;
+}
+
+void rf_virt_flush_buffer(void *h)
+{
+  // Samples are produced on demand, there is nothing buffered
+}
+
+bool rf_virt_has_rssi(void *h)
+{
+  return false;
+}
+
+float rf_virt_get_rssi(void *h)
+{
+  return 0.0;
+}
+
+void rf_virt_suppress_stdout(void *h)
+{
+  // not supported
+}
+
+void rf_virt_register_error_handler(void *h, srslte_rf_error_handler_t new_handler)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->error_handler = new_handler;
+}
+
+int rf_virt_open(char *args, void **h)
+{
+  return rf_virt_open_multi(args, h, 1);
+}
+
+int rf_virt_open_multi(char *args, void **h, uint32_t nof_rx_antennas)
+{
+  char role_str[16];
+  char id_str[32];
+  char n0_str[16];
+
+  // Never selected in auto mode unless explicitly configured
+  if (!virt_parse_arg(args, "virt_role=", role_str, sizeof(role_str))) {
+    return SRSLTE_ERROR;
+  }
+  if (!virt_parse_arg(args, "virt_id=", id_str, sizeof(id_str))) {
+    strcpy(id_str, "srslte");
+  }
+
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) malloc(sizeof(rf_virt_handler_t));
+  if (!handler) {
+    perror("malloc");
+    return SRSLTE_ERROR;
+  }
+  bzero(handler, sizeof(rf_virt_handler_t));
+
+  if (!strcmp(role_str, "enb")) {
+    handler->role = VIRT_ROLE_ENB;
+  } else if (!strcmp(role_str, "ue")) {
+    handler->role = VIRT_ROLE_UE;
+  } else {
+    fprintf(stderr, "Invalid virtual RF role %s. Must be enb or ue\n", role_str);
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+  if (virt_parse_arg(args, "virt_n0=", n0_str, sizeof(n0_str))) {
+    handler->noise_var = pow(10, atof(n0_str)/10);
+  }
+  handler->nof_rx_antennas = nof_rx_antennas;
+  handler->rx_tps          = 1;
+  handler->tx_tps          = 1;
+  snprintf(handler->name, sizeof(handler->name), "/srslte_virt_%s", id_str);
+  handler->shm_size = sizeof(rf_virt_shm_t) + VIRT_NOF_ROLES*VIRT_RING_SIZE*sizeof(cf_t);
+
+  // The first side to open the link creates and initializes the shared memory
+  bool creator = true;
+  int fd = shm_open(handler->name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    creator = false;
+    fd = shm_open(handler->name, O_RDWR, 0600);
+  }
+  if (fd < 0) {
+    perror("shm_open");
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+  if (creator && ftruncate(fd, handler->shm_size)) {
+    perror("ftruncate");
+    close(fd);
+    shm_unlink(handler->name);
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+  handler->shm = mmap(NULL, handler->shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (handler->shm == MAP_FAILED) {
+    perror("mmap");
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+  rf_virt_shm_t *shm = handler->shm;
+
+  if (creator) {
+    pthread_mutexattr_t mattr;
+    pthread_condattr_t  cattr;
+    pthread_mutexattr_init(&mattr);
+    pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&mattr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&shm->mutex, &mattr);
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+    pthread_cond_init(&shm->cvar, &cattr);
+    shm->ring_size = VIRT_RING_SIZE;
+    __sync_synchronize();
+    shm->magic     = VIRT_MAGIC;
+  } else {
+    int cnt = 0;
+    while (shm->magic != VIRT_MAGIC && cnt < 100) {
+      usleep(10000);
+      cnt++;
+    }
+    if (shm->magic != VIRT_MAGIC || shm->ring_size != VIRT_RING_SIZE) {
+      fprintf(stderr, "Invalid virtual RF shared memory %s\n", handler->name);
+      munmap(shm, handler->shm_size);
+      free(handler);
+      return SRSLTE_ERROR;
+    }
+  }
+  for (uint32_t i=0;i<VIRT_NOF_ROLES;i++) {
+    handler->ring[i] = (cf_t*) &shm[1] + i*VIRT_RING_SIZE;
+  }
+
+  virt_role_t peer = 1 - handler->role;
+  virt_lock(shm);
+  if (!shm->attached[peer]) {
+    // Alone on the link, start a new simulation
+    for (uint32_t i=0;i<VIRT_NOF_ROLES;i++) {
+      shm->rx_waiting[i] = false;
+      shm->rx_time[i]    = 0;
+      shm->tx_horizon[i] = 0;
+      shm->tx_tps[i]     = 0;
+      shm->tx_freq[i]    = 0;
+    }
+  } else {
+    // Join the simulation at the current time of the peer
+    shm->rx_time[handler->role]    = shm->rx_time[peer];
+    shm->tx_horizon[handler->role] = shm->rx_time[peer];
+    shm->tx_tps[handler->role]     = 0;
+  }
+  shm->attached[handler->role] = true;
+  pthread_cond_broadcast(&shm->cvar);
+  virt_unlock(shm);
+
+  *h = handler;
+  printf("Opened virtual RF link %s as %s\n", handler->name, handler->role==VIRT_ROLE_ENB?"eNB":"UE");
+  return SRSLTE_SUCCESS;
+}
+
+int rf_virt_close(void *h)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  rf_virt_shm_t     *shm     = handler->shm;
+
+  virt_lock(shm);
+  shm->attached[handler->role]   = false;
+  shm->rx_waiting[handler->role] = false;
+  bool last = !shm->attached[1 - handler->role];
+  pthread_cond_broadcast(&shm->cvar);
+  virt_unlock(shm);
+
+  munmap(shm, handler->shm_size);
+  if (last) {
+    shm_unlink(handler->name);
+  }
+  free(handler);
+  return SRSLTE_SUCCESS;
+}
+
+void rf_virt_set_master_clock_rate(void *h, double rate)
+{
+  // The simulated clock runs at a fixed rate
+}
+
+bool rf_virt_is_master_clock_dynamic(void *h)
+{
+  return true;
+}
+
+double rf_virt_set_rx_srate(void *h, double rate)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->rx_tps   = virt_tps(rate);
+  handler->rx_srate = (double) VIRT_TICK_RATE / handler->rx_tps;
+  return handler->rx_srate;
+}
+
+double rf_virt_set_tx_srate(void *h, double rate)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->tx_tps   = virt_tps(rate);
+  handler->tx_srate = (double) VIRT_TICK_RATE / handler->tx_tps;
+  return handler->tx_srate;
+}
+
+double rf_virt_set_rx_gain(void *h, double gain)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->rx_gain = gain;
+  return gain;
+}
+
+double rf_virt_set_tx_gain(void *h, double gain)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->tx_gain = gain;
+  return gain;
+}
+
+double rf_virt_get_rx_gain(void *h)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  return handler->rx_gain;
+}
+
+double rf_virt_get_tx_gain(void *h)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  return handler->tx_gain;
+}
+
+double rf_virt_set_rx_freq(void *h, double freq)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->rx_freq = freq;
+  return freq;
+}
+
+double rf_virt_set_tx_freq(void *h, double freq)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  handler->tx_freq = freq;
+  virt_lock(handler->shm);
+  handler->shm->tx_freq[handler->role] = freq;
+  virt_unlock(handler->shm);
+  return freq;
+}
+
+void rf_virt_get_time(void *h, time_t *secs, double *frac_secs)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  virt_lock(handler->shm);
+  uint64_t t = handler->shm->rx_time[handler->role];
+  virt_unlock(handler->shm);
+  virt_ticks_to_time(t, secs, frac_secs);
+}
+
+int rf_virt_recv_with_time_multi(void *h,
+                                 void **data,
+                                 uint32_t nsamples,
+                                 bool blocking,
+                                 time_t *secs,
+                                 double *frac_secs)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  rf_virt_shm_t     *shm     = handler->shm;
+  virt_role_t        role    = handler->role;
+  virt_role_t        peer    = 1 - role;
+  cf_t              *out     = (cf_t*) data[0];
+
+  virt_lock(shm);
+  uint64_t t0    = shm->rx_time[role];
+  uint64_t t_end = t0 + nsamples*handler->rx_tps;
+  while (!virt_rx_ready(shm, role, t0, t_end)) {
+    // Waiting may allow a peer waiting for us to move on
+    if (!shm->rx_waiting[role]) {
+      shm->rx_waiting[role] = true;
+      pthread_cond_broadcast(&shm->cvar);
+    }
+    virt_wait(shm);
+  }
+  shm->rx_waiting[role] = false;
+  uint64_t horizon = shm->tx_horizon[peer];
+  uint64_t tx_tps  = shm->tx_tps[peer];
+  bool     tuned   = fabs(shm->tx_freq[peer] - handler->rx_freq) < VIRT_MAX_FREQ_ERR ||
+                     shm->tx_freq[peer] == 0 || handler->rx_freq == 0;
+  virt_unlock(shm);
+
+  /* The peer does not overwrite samples we have not received yet, so the ring is read
+   * without holding the lock. Each output sample averages the ring samples it spans
+   * when the peer transmits at a higher rate.
+   */
+  uint32_t mask = VIRT_RING_SIZE - 1;
+  cf_t    *ring = handler->ring[peer];
+  if (tx_tps && tuned) {
+    uint64_t D    = handler->rx_tps >= tx_tps ? handler->rx_tps / tx_tps : 1;
+    float    norm = 1.0/D;
+    for (uint32_t i=0;i<nsamples;i++) {
+      uint64_t t = t0 + i*handler->rx_tps;
+      if (t + D*tx_tps <= horizon) {
+        uint64_t s   = t / tx_tps;
+        cf_t     acc = 0;
+        for (uint64_t k=0;k<D;k++) {
+          acc += ring[(s+k) & mask];
+        }
+        out[i] = acc*norm;
+      } else {
+        out[i] = 0;
+      }
+    }
+  } else {
+    bzero(out, sizeof(cf_t)*nsamples);
+  }
+  if (handler->noise_var > 0) {
+    srslte_ch_awgn_c(out, out, handler->noise_var, nsamples);
+  }
+  for (uint32_t i=1;i<handler->nof_rx_antennas;i++) {
+    if (data[i]) {
+      memcpy(data[i], out, sizeof(cf_t)*nsamples);
+    }
+  }
+
+  virt_lock(shm);
+  shm->rx_time[role] = t_end;
+  pthread_cond_broadcast(&shm->cvar);
+  virt_unlock(shm);
+
+  virt_ticks_to_time(t0, secs, frac_secs);
+  return nsamples;
+}
+
+int rf_virt_recv_with_time(void *h,
+                           void *data,
+                           uint32_t nsamples,
+                           bool blocking,
+                           time_t *secs,
+                           double *frac_secs)
+{
+  return rf_virt_recv_with_time_multi(h, &data, nsamples, blocking, secs, frac_secs);
+}
+
+int rf_virt_send_timed(void *h,
+                       void *data,
+                       int nsamples,
+                       time_t secs,
+                       double frac_secs,
+                       bool has_time_spec,
+                       bool blocking,
+                       bool is_start_of_burst,
+                       bool is_end_of_burst)
+{
+  rf_virt_handler_t *handler = (rf_virt_handler_t*) h;
+  rf_virt_shm_t     *shm     = handler->shm;
+  virt_role_t        role    = handler->role;
+  virt_role_t        peer    = 1 - role;
+  uint64_t           tps     = handler->tx_tps;
+  uint32_t           mask    = VIRT_RING_SIZE - 1;
+  cf_t              *ring    = handler->ring[role];
+  cf_t              *in      = (cf_t*) data;
+  int                n       = nsamples;
+
+  virt_lock(shm);
+  if (shm->tx_tps[role] != tps) {
+    // A new rate invalidates whatever is in the ring: samples the peer has not received 
+    // yet are dropped and the ring is written again from its current receive time
+    shm->tx_tps[role]     = tps;
+    shm->tx_horizon[role] = SRSLTE_MIN(shm->tx_horizon[role], shm->rx_time[peer]);
+    bzero(ring, sizeof(cf_t)*VIRT_RING_SIZE);
+  }
+  uint64_t t0 = has_time_spec ? virt_time_to_ticks(secs, frac_secs) : shm->tx_horizon[role];
+  t0 = (t0 + tps/2) / tps * tps;
+
+  // Samples the peer has already received are lost
+  if (shm->attached[peer] && t0 < shm->rx_time[peer]) {
+    uint64_t late = (shm->rx_time[peer] - t0 + tps - 1) / tps;
+    virt_error(handler, SRSLTE_RF_ERROR_LATE, 0);
+    if (late >= (uint64_t) n) {
+      virt_unlock(shm);
+      return nsamples;
+    }
+    t0 += late*tps;
+    in += late;
+    n  -= late;
+  }
+  uint64_t t_end = t0 + n*tps;
+
+  // Do not overwrite samples the peer has not received yet
+  while (shm->attached[peer] && t_end > shm->rx_time[peer] + (uint64_t) VIRT_RING_SIZE*tps) {
+    virt_wait(shm);
+  }
+
+  // Fill the gap since the end of the previous burst with zeros
+  if (t0 > shm->tx_horizon[role]) {
+    uint64_t s0 = shm->tx_horizon[role] / tps;
+    uint64_t s1 = t0 / tps;
+    if (s1 - s0 > VIRT_RING_SIZE) {
+      s0 = s1 - VIRT_RING_SIZE;
+    }
+    for (uint64_t s=s0;s<s1;s++) {
+      ring[s & mask] = 0;
+    }
+  }
+  uint64_t s     = t0 / tps;
+  uint32_t first = SRSLTE_MIN((uint64_t) n, VIRT_RING_SIZE - (s & mask));
+  memcpy(&ring[s & mask], in, sizeof(cf_t)*first);
+  if (first < (uint32_t) n) {
+    memcpy(ring, &in[first], sizeof(cf_t)*(n - first));
+  }
+  if (t_end > shm->tx_horizon[role]) {
+    shm->tx_horizon[role] = t_end;
+  }
+  pthread_cond_broadcast(&shm->cvar);
+  virt_unlock(shm);
+
+  return nsamples;
+}
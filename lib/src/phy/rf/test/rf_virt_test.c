@@ -0,0 +1,162 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/rf/rf.h"
+
+/* Runs an eNB and a UE thread over a virtual RF link. Every subframe, each side
+ * receives one subframe and transmits a subframe tagged with its index TX_ADVANCE
+ * subframes later. Each side checks that it receives the peer's subframes with the
+ * expected delay and reports how much faster than real time the link runs.
+ */
+
+#define TX_ADVANCE 4
+
+uint32_t nof_subframes = 1000;
+double   srate         = 1.92e6;
+
+void usage(char *prog) {
+  printf("Usage: %s [ns]\n", prog);
+  printf("\t-n number of subframes [Default %d]\n", nof_subframes);
+  printf("\t-s sampling rate in Hz [Default %.2f MHz]\n", srate/1e6);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ns")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_subframes = atoi(argv[optind]);
+      break;
+    case 's':
+      srate = atof(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  srslte_rf_t rf;
+  const char *name;
+  float       tag_offset;
+  float       peer_tag_offset;
+  uint32_t    nof_errors;
+} side_t;
+
+void *run_side(void *arg) {
+  side_t  *side    = (side_t*) arg;
+  uint32_t sf_len  = (uint32_t) (srate/1000);
+  cf_t    *rx      = srslte_vec_malloc(sizeof(cf_t)*sf_len);
+  cf_t    *tx      = srslte_vec_malloc(sizeof(cf_t)*sf_len);
+  time_t   secs;
+  double   frac_secs;
+  int64_t  first_sf = -1;
+
+  for (uint32_t sf=0;sf<nof_subframes;sf++) {
+    srslte_rf_recv_with_time(&side->rf, rx, sf_len, true, &secs, &frac_secs);
+    int64_t rx_sf = (int64_t) round((secs + frac_secs)*1000);
+    if (first_sf < 0) {
+      first_sf = rx_sf;
+    }
+
+    // The peer transmitted subframe rx_sf - TX_ADVANCE, tagged with its index
+    float expected = rx_sf - first_sf >= TX_ADVANCE ? side->peer_tag_offset + rx_sf - TX_ADVANCE : 0;
+    if (crealf(rx[0]) != expected || crealf(rx[sf_len-1]) != expected) {
+      if (side->nof_errors++ < 5) {
+        printf("%s sf=%d: received %.0f expected %.0f\n", side->name, (int) rx_sf, crealf(rx[0]), expected);
+      }
+    }
+
+    for (uint32_t i=0;i<sf_len;i++) {
+      tx[i] = side->tag_offset + rx_sf;
+    }
+    uint64_t tx_ms = rx_sf + TX_ADVANCE;
+    srslte_rf_send_timed2(&side->rf, tx, sf_len, tx_ms/1000, (double) (tx_ms%1000)/1000, true, true);
+  }
+  free(rx);
+  free(tx);
+  return NULL;
+}
+
+int open_side(side_t *side, const char *role, float tag_offset, float peer_tag_offset) {
+  char args[128];
+  snprintf(args, sizeof(args), "virt_role=%s,virt_id=rf_virt_test_%d", role, getpid());
+  if (srslte_rf_open_devname(&side->rf, "virtual", args)) {
+    fprintf(stderr, "Error opening virtual RF %s\n", role);
+    return -1;
+  }
+  srslte_rf_set_rx_srate(&side->rf, srate);
+  srslte_rf_set_tx_srate(&side->rf, srate);
+  side->name            = role;
+  side->tag_offset      = tag_offset;
+  side->peer_tag_offset = peer_tag_offset;
+  side->nof_errors      = 0;
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  side_t    enb, ue;
+  pthread_t threads[2];
+  struct timeval t[3];
+
+  parse_args(argc, argv);
+
+  if (open_side(&enb, "enb", 1, 100000) || open_side(&ue, "ue", 100000, 1)) {
+    exit(-1);
+  }
+
+  gettimeofday(&t[1], NULL);
+  pthread_create(&threads[0], NULL, run_side, &enb);
+  pthread_create(&threads[1], NULL, run_side, &ue);
+  pthread_join(threads[0], NULL);
+  pthread_join(threads[1], NULL);
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double secs = t[0].tv_sec + 1e-6*t[0].tv_usec;
+  printf("%d subframes at %.2f MHz in %.3f s: %.1fx real time\n",
+         nof_subframes, srate/1e6, secs, secs>0?1e-3*nof_subframes/secs:0);
+
+  srslte_rf_close(&ue.rf);
+  srslte_rf_close(&enb.rf);
+
+  if (enb.nof_errors || ue.nof_errors) {
+    printf("Error: %d eNB and %d UE subframes were wrong\n", enb.nof_errors, ue.nof_errors);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -27,18 +27,137 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include <assert.h>
 #include "srslte/phy/utils/bit.h"
 #include "srslte/phy/utils/vector.h"
 #include "srslte/phy/scrambling/scrambling.h"
 
+#ifdef LV_HAVE_SSE
+#include <smmintrin.h>
+#endif
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+/* The scrambling functions read the packed sequence bits in c_bytes. For every bit, one
+ * byte of the sequence is broadcast to the SIMD lanes and compared against a per-lane bit
+ * mask, giving an all-ones lane where the data must be negated (or xored, for bits).
+ */
+
+static inline uint8_t seq_bit(uint8_t *c, uint32_t i) {
+  return (c[i / 8] >> (7 - i % 8)) & 1;
+}
+
+static void scrambling_f_packed(uint8_t *c, float *data, uint32_t offset, uint32_t len) {
+  uint32_t i = 0;
+  for (; i < len && (offset + i) % 8; i++) {
+    data[i] = seq_bit(c, offset + i) ? -data[i] : data[i];
+  }
+#ifdef LV_HAVE_AVX2
+  const __m256i lanes = _mm256_setr_epi32(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+  for (; i + 8 <= len; i += 8) {
+    __m256i m = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(c[(offset + i) / 8]), lanes), lanes);
+    m = _mm256_slli_epi32(m, 31);
+    _mm256_storeu_ps(&data[i], _mm256_xor_ps(_mm256_loadu_ps(&data[i]), _mm256_castsi256_ps(m)));
+  }
+#endif
+#ifdef LV_HAVE_SSE
+  const __m128i lanes_h = _mm_setr_epi32(0x80, 0x40, 0x20, 0x10);
+  const __m128i lanes_l = _mm_setr_epi32(0x08, 0x04, 0x02, 0x01);
+  for (; i + 8 <= len; i += 8) {
+    __m128i b  = _mm_set1_epi32(c[(offset + i) / 8]);
+    __m128i mh = _mm_slli_epi32(_mm_cmpeq_epi32(_mm_and_si128(b, lanes_h), lanes_h), 31);
+    __m128i ml = _mm_slli_epi32(_mm_cmpeq_epi32(_mm_and_si128(b, lanes_l), lanes_l), 31);
+    _mm_storeu_ps(&data[i],   _mm_xor_ps(_mm_loadu_ps(&data[i]),   _mm_castsi128_ps(mh)));
+    _mm_storeu_ps(&data[i+4], _mm_xor_ps(_mm_loadu_ps(&data[i+4]), _mm_castsi128_ps(ml)));
+  }
+#endif
+  for (; i < len; i++) {
+    data[i] = seq_bit(c, offset + i) ? -data[i] : data[i];
+  }
+}
+
+static void scrambling_s_packed(uint8_t *c, short *data, uint32_t offset, uint32_t len) {
+  uint32_t i = 0;
+  for (; i < len && (offset + i) % 8; i++) {
+    data[i] = seq_bit(c, offset + i) ? -data[i] : data[i];
+  }
+#ifdef LV_HAVE_AVX2
+  const __m256i lanes = _mm256_setr_epi16((short) 0x8000, 0x4000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0100,
+                                          0x0080, 0x0040, 0x0020, 0x0010, 0x0008, 0x0004, 0x0002, 0x0001);
+  for (; i + 16 <= len; i += 16) {
+    uint8_t *b = &c[(offset + i) / 8];
+    __m256i  m = _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_set1_epi16((b[0] << 8) | b[1]), lanes), lanes);
+    __m256i  d = _mm256_loadu_si256((__m256i*) &data[i]);
+    _mm256_storeu_si256((__m256i*) &data[i], _mm256_sub_epi16(_mm256_xor_si256(d, m), m));
+  }
+#endif
+#ifdef LV_HAVE_SSE
+  const __m128i lanes8 = _mm_setr_epi16(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+  for (; i + 8 <= len; i += 8) {
+    __m128i m = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(c[(offset + i) / 8]), lanes8), lanes8);
+    __m128i d = _mm_loadu_si128((__m128i*) &data[i]);
+    _mm_storeu_si128((__m128i*) &data[i], _mm_sub_epi16(_mm_xor_si128(d, m), m));
+  }
+#endif
+  for (; i < len; i++) {
+    data[i] = seq_bit(c, offset + i) ? -data[i] : data[i];
+  }
+}
+
+/* Byte-wide data, either LLRs (negated) or unpacked bits (xored) */
+static void scrambling_sb_packed(uint8_t *c, uint8_t *data, uint32_t offset, uint32_t len, bool bits) {
+  uint32_t i = 0;
+  for (; i < len && (offset + i) % 8; i++) {
+    if (seq_bit(c, offset + i)) {
+      data[i] = bits ? data[i] ^ 1 : -data[i];
+    }
+  }
+#ifdef LV_HAVE_AVX2
+  const __m256i lanes = _mm256_set1_epi64x(0x0102040810204080);
+  const __m256i idx   = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                         2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+  const __m256i one   = _mm256_set1_epi8(1);
+  for (; i + 32 <= len; i += 32) {
+    uint32_t w;
+    memcpy(&w, &c[(offset + i) / 8], sizeof(uint32_t));
+    __m256i m = _mm256_shuffle_epi8(_mm256_set1_epi32(w), idx);
+    m = _mm256_cmpeq_epi8(_mm256_and_si256(m, lanes), lanes);
+    __m256i d = _mm256_loadu_si256((__m256i*) &data[i]);
+    d = bits ? _mm256_xor_si256(d, _mm256_and_si256(m, one)) : _mm256_sub_epi8(_mm256_xor_si256(d, m), m);
+    _mm256_storeu_si256((__m256i*) &data[i], d);
+  }
+#endif
+#ifdef LV_HAVE_SSE
+  const __m128i lanes8 = _mm_set1_epi64x(0x0102040810204080);
+  const __m128i idx8   = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+  const __m128i one8   = _mm_set1_epi8(1);
+  for (; i + 16 <= len; i += 16) {
+    uint8_t *b = &c[(offset + i) / 8];
+    __m128i  m = _mm_shuffle_epi8(_mm_set1_epi16((b[1] << 8) | b[0]), idx8);
+    m = _mm_cmpeq_epi8(_mm_and_si128(m, lanes8), lanes8);
+    __m128i d = _mm_loadu_si128((__m128i*) &data[i]);
+    d = bits ? _mm_xor_si128(d, _mm_and_si128(m, one8)) : _mm_sub_epi8(_mm_xor_si128(d, m), m);
+    _mm_storeu_si128((__m128i*) &data[i], d);
+  }
+#endif
+  for (; i < len; i++) {
+    if (seq_bit(c, offset + i)) {
+      data[i] = bits ? data[i] ^ 1 : -data[i];
+    }
+  }
+}
+
+
 void srslte_scrambling_f(srslte_sequence_t *s, float *data) {
   srslte_scrambling_f_offset(s, data, 0, s->len);
 }
 
 void srslte_scrambling_f_offset(srslte_sequence_t *s, float *data, int offset, int len) {
   assert (len + offset <= s->len);
-  srslte_vec_prod_fff(data, &s->c_float[offset], data, len);
+  scrambling_f_packed(s->c_bytes, data, offset, len);
 }
 
 void srslte_scrambling_s(srslte_sequence_t *s, short *data) {
@@ -47,7 +166,16 @@ void srslte_scrambling_s(srslte_sequence_t *s, short *data) {
 
 void srslte_scrambling_s_offset(srslte_sequence_t *s, short *data, int offset, int len) {
   assert (len + offset <= s->len);
-  srslte_vec_prod_sss(data, &s->c_short[offset], data, len);
+  scrambling_s_packed(s->c_bytes, data, offset, len);
+}
+
+void srslte_scrambling_sb(srslte_sequence_t *s, int8_t *data) {
+  srslte_scrambling_sb_offset(s, data, 0, s->len);
+}
+
+void srslte_scrambling_sb_offset(srslte_sequence_t *s, int8_t *data, int offset, int len) {
+  assert (len + offset <= s->len);
+  scrambling_sb_packed(s->c_bytes, (uint8_t*) data, offset, len, false);
 }
 
 void srslte_scrambling_c(srslte_sequence_t *s, cf_t *data) {
@@ -81,11 +209,15 @@ void scrambling_b_word(uint8_t *c, uint8_t *data, int len) {
 
 
 void srslte_scrambling_b(srslte_sequence_t *s, uint8_t *data) {
-  scrambling_b_word(s->c, data, s->len);  
+  srslte_scrambling_b_offset(s, data, 0, s->len);
 }
 
 void srslte_scrambling_b_offset(srslte_sequence_t *s, uint8_t *data, int offset, int len) {
-  if (offset%8) {
+  assert (len + offset <= s->len);
+  if (!s->c) {
+    // Packed-only sequence
+    scrambling_sb_packed(s->c_bytes, data, offset, len, true);
+  } else if (offset%8) {
     // Do not load words if offset is not word-aligned
     scrambling_b(&s->c[offset], data, len);
   } else {
@@ -97,9 +229,6 @@ void srslte_scrambling_bytes(srslte_sequence_t *s, uint8_t *data, int len) {
   scrambling_b_word(s->c_bytes, data, len/8);  
   // Scramble last bits
   if (len%8) {
-    uint8_t tmp_bits[8];
-    srslte_bit_unpack_vector(&data[len/8], tmp_bits, len%8);
-    scrambling_b(&s->c[8*(len/8)], tmp_bits, len%8);
-    srslte_bit_pack_vector(tmp_bits, &data[len/8], len%8);
+    data[len/8] ^= s->c_bytes[len/8] & (0xFF << (8-len%8));
   }    
 }
@@ -37,6 +37,7 @@
 
 char *srslte_sequence_name = NULL;
 bool do_floats = false;
+bool do_packed = false;
 srslte_cp_t cp = SRSLTE_CP_NORM;
 int cell_id = -1;
 int nof_bits = 100; 
@@ -46,11 +47,12 @@ void usage(char *prog) {
   printf("\t -l nof_bits [Default %d]\n", nof_bits);
   printf("\t -e CP extended [Default CP Normal]\n");
   printf("\t -f scramble floats [Default bits]\n");
+  printf("\t -p use a sequence with packed bits only (PDSCH) [Default all representations]\n");
 }
 
 void parse_args(int argc, char **argv) {
   int opt;
-  while ((opt = getopt(argc, argv, "csefl")) != -1) {
+  while ((opt = getopt(argc, argv, "csefpl")) != -1) {
     switch (opt) {
     case 'c':
       cell_id = atoi(argv[optind]);
@@ -64,6 +66,9 @@ void parse_args(int argc, char **argv) {
     case 'f':
       do_floats = true;
       break;
+    case 'p':
+      do_packed = true;
+      break;
     case 's':
       srslte_sequence_name = argv[optind];
       break;
@@ -86,6 +91,10 @@ int init_sequence(srslte_sequence_t *seq, char *name) {
   if (!strcmp(name, "PBCH")) {
     return srslte_sequence_pbch(seq, cp, cell_id);
   } else if (!strcmp(name, "PDSCH")) {
+    if (do_packed) {
+      bzero(seq, sizeof(srslte_sequence_t));
+      return srslte_sequence_pdsch_packed(seq, 1234, 0, 0, cell_id, nof_bits);
+    }
     return srslte_sequence_pdsch(seq, 1234, 0, 0, cell_id, nof_bits);
   } else {
     fprintf(stderr, "Unsupported sequence name %s\n", name);
@@ -94,6 +103,117 @@ int init_sequence(srslte_sequence_t *seq, char *name) {
 }
 
 
+/* Bitwise Gold sequence of 36.211 Section 7.2, used as reference for the packed generator */
+void reference_sequence(uint8_t *c, uint32_t len, uint32_t c_init) {
+  uint32_t n_total = len + 1600 + 31;
+  uint8_t *x1 = calloc(n_total, 1);
+  uint8_t *x2 = calloc(n_total, 1);
+  if (!x1 || !x2) {
+    perror("calloc");
+    exit(-1);
+  }
+  x1[0] = 1;
+  for (uint32_t n=0;n<31;n++) {
+    x2[n] = (c_init >> n) & 1;
+  }
+  for (uint32_t n=0;n+31<n_total;n++) {
+    x1[n+31] = (x1[n+3] + x1[n]) % 2;
+    x2[n+31] = (x2[n+3] + x2[n+2] + x2[n+1] + x2[n]) % 2;
+  }
+  for (uint32_t n=0;n<len;n++) {
+    c[n] = (x1[n+1600] + x2[n+1600]) % 2;
+  }
+  free(x1);
+  free(x2);
+}
+
+/* Compares c and c_bytes of a full sequence and of a packed-only one against the reference,
+ * then scrambles bits, float, short and byte LLRs at random offsets with both sequences and
+ * checks that exactly the bits and LLRs where the reference bit is one have been flipped */
+int test_sequence(uint32_t c_init, uint32_t len) {
+  srslte_sequence_t full, packed;
+  bzero(&full, sizeof(srslte_sequence_t));
+  bzero(&packed, sizeof(srslte_sequence_t));
+
+  // Turning a packed-only sequence into a full one must not leak its c_bytes
+  if (srslte_sequence_LTE_pr_packed(&full, len, c_init) ||
+      srslte_sequence_LTE_pr(&full, len, c_init)       ||
+      srslte_sequence_LTE_pr_packed(&packed, len, c_init)) {
+    return -1;
+  }
+
+  uint8_t *ref   = malloc(len);
+  uint8_t *bits  = malloc(len);
+  float   *llr_f = malloc(sizeof(float)  * len);
+  short   *llr_s = malloc(sizeof(short)  * len);
+  int8_t  *llr_b = malloc(sizeof(int8_t) * len);
+  if (!ref || !bits || !llr_f || !llr_s || !llr_b) {
+    perror("malloc");
+    exit(-1);
+  }
+  reference_sequence(ref, len, c_init);
+
+  int ret = 0;
+  for (uint32_t i=0;i<len && !ret;i++) {
+    uint8_t b = (packed.c_bytes[i/8] >> (7-i%8)) & 1;
+    if (full.c[i] != ref[i] || ((full.c_bytes[i/8] >> (7-i%8)) & 1) != ref[i] || b != ref[i]) {
+      printf("Error in sequence bit %d c_init 0x%x len %d\n", i, c_init, len);
+      ret = -1;
+    }
+  }
+  if (len%8 && (packed.c_bytes[len/8] & (0xFF >> (len%8)))) {
+    printf("Error padding bits not zero c_init 0x%x len %d\n", c_init, len);
+    ret = -1;
+  }
+
+  srslte_sequence_t *seqs[2] = {&full, &packed};
+  for (int n=0;n<40 && !ret;n++) {
+    srslte_sequence_t *seq = seqs[n%2];
+    int offset = n<2?0:rand()%len;
+    int nof    = n<2?len:rand()%(len-offset+1);
+    for (int i=0;i<nof;i++) {
+      bits[i]  = i%2;
+      llr_f[i] = 1+i%100;
+      llr_s[i] = 1+i%100;
+      llr_b[i] = 1+i%100;
+    }
+    srslte_scrambling_b_offset(seq, bits, offset, nof);
+    srslte_scrambling_f_offset(seq, llr_f, offset, nof);
+    srslte_scrambling_s_offset(seq, llr_s, offset, nof);
+    srslte_scrambling_sb_offset(seq, llr_b, offset, nof);
+    for (int i=0;i<nof;i++) {
+      int v = ref[offset+i]?-(1+i%100):(1+i%100);
+      if (bits[i] != (i%2 ^ ref[offset+i]) || llr_f[i] != v || llr_s[i] != v || llr_b[i] != v) {
+        printf("Error in %s sequence at %d offset %d len %d c_init 0x%x\n",
+               seq==&full?"full":"packed", i, offset, nof, c_init);
+        ret = -1;
+        break;
+      }
+    }
+  }
+  free(ref);
+  free(bits);
+  free(llr_f);
+  free(llr_s);
+  free(llr_b);
+  srslte_sequence_free(&full);
+  srslte_sequence_free(&packed);
+  return ret;
+}
+
+int test_sequences() {
+  uint32_t c_init[] = {0, 1, 50, 0x7FFFFFFF, (1234<<14) | 50, 0x2AAAAAAA};
+  uint32_t len[]    = {1, 7, 8, 9, 27, 28, 29, 55, 56, 57, 120, 1001, 5003};
+  for (uint32_t i=0;i<sizeof(c_init)/sizeof(uint32_t);i++) {
+    for (uint32_t j=0;j<sizeof(len)/sizeof(uint32_t);j++) {
+      if (test_sequence(c_init[i], len[j])) {
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
 int main(int argc, char **argv) {
   int i;
   srslte_sequence_t seq;
@@ -108,6 +228,10 @@ int main(int argc, char **argv) {
     exit(-1);
   }
 
+  if (test_sequences()) {
+    exit(-1);
+  }
+
   if (!do_floats) {
     input_b = malloc(sizeof(uint8_t) * seq.len);
     if (!input_b) {
@@ -143,6 +143,45 @@ int test_dft(cf_t* in){
   return res;
 }
 
+// A batch of transforms must match the same transforms run one at a time
+int test_dft_batch(cf_t* in){
+  int res = 0;
+  int nof_dfts = 4;
+  srslte_dft_dir_t dir = forward?SRSLTE_DFT_FORWARD:SRSLTE_DFT_BACKWARD;
+
+  srslte_dft_plan_t plan;
+  srslte_dft_plan_t plan_batch;
+  srslte_dft_plan_c(&plan, N, dir);
+  srslte_dft_plan_c_batch(&plan_batch, N, nof_dfts, dir);
+
+  cf_t* batch_in = malloc(sizeof(cf_t)*N*nof_dfts);
+  cf_t* batch_out = malloc(sizeof(cf_t)*N*nof_dfts);
+  cf_t* out = malloc(sizeof(cf_t)*N);
+  for(int j=0;j<nof_dfts;j++){
+    for(int i=0;i<N;i++)
+      batch_in[j*N+i] = in[(i+j)%N];
+  }
+
+  srslte_dft_run_c_zerocopy(&plan_batch, batch_in, batch_out);
+
+  for(int j=0;j<nof_dfts;j++){
+    srslte_dft_run_c_zerocopy(&plan, &batch_in[j*N], out);
+    for(int i=0;i<N;i++){
+      float diff = cabsf(out[i] - batch_out[j*N+i]);
+      if(diff > 0.01*cabsf(out[i]) + 0.01)
+        res = -1;
+    }
+  }
+
+  srslte_dft_plan_free(&plan);
+  srslte_dft_plan_free(&plan_batch);
+  free(batch_in);
+  free(batch_out);
+  free(out);
+
+  return res;
+}
+
 int main(int argc, char **argv) {
   parse_args(argc, argv);
   cf_t* in = malloc(sizeof(cf_t)*N);
@@ -157,6 +196,9 @@ int main(int argc, char **argv) {
   if(test_dft(in) != 0)
     return -1;
 
+  if(test_dft_batch(in) != 0)
+    return -1;
+
   free(in);
 	printf("Done\n");
 	exit(0);
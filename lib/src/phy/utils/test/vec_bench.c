@@ -0,0 +1,156 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Prints the SIMD kernel selected for each vector primitive and its throughput at every
+ * SIMD level supported by the running CPU.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <complex.h>
+
+#include "srslte/srslte.h"
+
+uint32_t len       = 1200;
+uint32_t nof_iter  = 100000;
+
+void usage(char *prog) {
+  printf("Usage: %s [ln]\n", prog);
+  printf("\t-l vector length [Default %d]\n", len);
+  printf("\t-n number of calls per primitive and level [Default %d]\n", nof_iter);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ln")) != -1) {
+    switch (opt) {
+    case 'l':
+      len = atoi(argv[optind]);
+      break;
+    case 'n':
+      nof_iter = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+short          *x, *y, *z;
+unsigned short *lut;
+float          *f;
+cf_t           *c, *cz;
+int             sink;
+
+void run_dot_prod_sss() { sink += srslte_vec_dot_prod_sss(x, y, len); }
+void run_sum_sss()      { srslte_vec_sum_sss(x, y, z, len); }
+void run_sub_sss()      { srslte_vec_sub_sss(x, y, z, len); }
+void run_prod_sss()     { srslte_vec_prod_sss(x, y, z, len); }
+void run_sc_div2_sss()  { srslte_vec_sc_div2_sss(x, 3, z, len); }
+void run_lut_sss()      { srslte_vec_lut_sss(x, lut, z, len); }
+void run_convert_fi()   { srslte_vec_convert_fi(f, z, 1000, len); }
+void run_sc_prod_cfc()  { srslte_vec_sc_prod_cfc(c, 0.7, cz, len); }
+
+struct {
+  const char *name;
+  void      (*run)();
+} primitives[] = {
+  {"dot_prod_sss", run_dot_prod_sss},
+  {"sum_sss",      run_sum_sss},
+  {"sub_sss",      run_sub_sss},
+  {"prod_sss",     run_prod_sss},
+  {"sc_div2_sss",  run_sc_div2_sss},
+  {"lut_sss",      run_lut_sss},
+  {"convert_fi",   run_convert_fi},
+  {"sc_prod_cfc",  run_sc_prod_cfc},
+};
+#define NOF_PRIMITIVES (sizeof(primitives)/sizeof(primitives[0]))
+
+// Million samples per second of a primitive at the current level
+double measure(uint32_t p) {
+  struct timespec t[2];
+  clock_gettime(CLOCK_MONOTONIC, &t[0]);
+  for (uint32_t i=0;i<nof_iter;i++) {
+    primitives[p].run();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t[1]);
+  double secs = (t[1].tv_sec - t[0].tv_sec) + 1e-9*(t[1].tv_nsec - t[0].tv_nsec);
+  return secs > 0 ? 1e-6*len*nof_iter/secs : 0;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  x   = srslte_vec_malloc(sizeof(short)*len);
+  y   = srslte_vec_malloc(sizeof(short)*len);
+  z   = srslte_vec_malloc(sizeof(short)*len);
+  lut = srslte_vec_malloc(sizeof(unsigned short)*len);
+  f   = srslte_vec_malloc(sizeof(float)*len);
+  c   = srslte_vec_malloc(sizeof(cf_t)*len);
+  cz  = srslte_vec_malloc(sizeof(cf_t)*len);
+  if (!x || !y || !z || !lut || !f || !c || !cz) {
+    perror("malloc");
+    exit(-1);
+  }
+  for (uint32_t i=0;i<len;i++) {
+    x[i]   = rand()%17 - 8;
+    y[i]   = rand()%17 - 8;
+    lut[i] = len-1-i;
+    f[i]   = (float) rand()/RAND_MAX;
+    c[i]   = (float) rand()/RAND_MAX + _Complex_I*(float) rand()/RAND_MAX;
+  }
+
+  srslte_simd_level_t cpu_level = srslte_simd_cpu_level();
+  srslte_simd_level_t selected  = srslte_simd_get_level();
+  printf("CPU SIMD level: %s, selected: %s\n", srslte_simd_level_string(cpu_level), srslte_simd_level_string(selected));
+  printf("Throughput in Msamples/s for vectors of %d samples\n", len);
+
+  printf("%-14s %-8s", "primitive", "kernel");
+  for (int l=SRSLTE_SIMD_GENERIC;l<=cpu_level;l++) {
+    printf(" %9s", srslte_simd_level_string((srslte_simd_level_t) l));
+  }
+  printf("\n");
+
+  for (uint32_t k=0;k<srslte_vec_nof_kernels();k++) {
+    const char *name = srslte_vec_kernel_name(k);
+    printf("%-14s %-8s", name, srslte_simd_level_string(srslte_vec_kernel_level(k)));
+    for (uint32_t p=0;p<NOF_PRIMITIVES;p++) {
+      if (!strcmp(primitives[p].name, name)) {
+        for (int l=SRSLTE_SIMD_GENERIC;l<=cpu_level;l++) {
+          srslte_simd_set_level((srslte_simd_level_t) l);
+          printf(" %9.1f", measure(p));
+        }
+        srslte_simd_set_level(selected);
+      }
+    }
+    printf("\n");
+  }
+  exit(0);
+}
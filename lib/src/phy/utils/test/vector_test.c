@@ -0,0 +1,235 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Self-test of the SIMD kernels: runs every vector primitive and the soft demodulator
+ * at each SIMD level supported by the CPU and compares the output with the generic
+ * implementation, for lengths that exercise both the vector loops and the tails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <complex.h>
+
+#include "srslte/srslte.h"
+
+#define MAX_LEN 1000
+
+uint32_t nof_lengths = 100;
+
+void usage(char *prog) {
+  printf("Usage: %s [n]\n", prog);
+  printf("\t-n number of random lengths per primitive [Default %d]\n", nof_lengths);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "n")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_lengths = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  short          *x, *y, *z;
+  unsigned short *lut;
+  float          *f;
+  cf_t           *c, *cz;
+  short          *llr;
+} buffers_t;
+
+buffers_t in, out[2];
+
+/* Runs a primitive and returns the number of int16 (or float) outputs and their tolerance.
+ * Float to int16 conversions and shifts of negative numbers round differently in the
+ * generic code and in the kernels. The soft demodulator kernels also round the offsets.
+ */
+typedef struct {
+  const char *name;
+  uint32_t  (*run)(buffers_t *o, uint32_t len, float *tolerance);
+} primitive_t;
+
+uint32_t run_dot_prod_sss(buffers_t *o, uint32_t len, float *tolerance) {
+  o->z[0] = srslte_vec_dot_prod_sss(in.x, in.y, len);
+  *tolerance = 0;
+  return 1;
+}
+uint32_t run_sum_sss(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_vec_sum_sss(in.x, in.y, o->z, len);
+  *tolerance = 0;
+  return len;
+}
+uint32_t run_sub_sss(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_vec_sub_sss(in.x, in.y, o->z, len);
+  *tolerance = 0;
+  return len;
+}
+uint32_t run_prod_sss(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_vec_prod_sss(in.x, in.y, o->z, len);
+  *tolerance = 0;
+  return len;
+}
+uint32_t run_sc_div2_sss(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_vec_sc_div2_sss(in.x, 3, o->z, len);
+  *tolerance = 1;
+  return len;
+}
+uint32_t run_lut_sss(buffers_t *o, uint32_t len, float *tolerance) {
+  for (uint32_t i=0;i<len;i++) {
+    in.lut[i] = len-1-i;
+  }
+  srslte_vec_lut_sss(in.x, in.lut, o->z, len);
+  *tolerance = 0;
+  return len;
+}
+uint32_t run_convert_fi(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_vec_convert_fi(in.f, o->z, 1000, len);
+  *tolerance = 1;
+  return len;
+}
+uint32_t run_sc_prod_cfc(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_vec_sc_prod_cfc(in.c, 0.7, o->cz, len);
+  *tolerance = 0;
+  for (uint32_t i=0;i<len;i++) {
+    o->f[2*i]   = crealf(o->cz[i]);
+    o->f[2*i+1] = cimagf(o->cz[i]);
+  }
+  return 2*len;
+}
+uint32_t run_demod_16qam(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_demod_soft_demodulate_s(SRSLTE_MOD_16QAM, in.c, o->llr, len/4);
+  *tolerance = 2;
+  return 4*(len/4);
+}
+uint32_t run_demod_64qam(buffers_t *o, uint32_t len, float *tolerance) {
+  srslte_demod_soft_demodulate_s(SRSLTE_MOD_64QAM, in.c, o->llr, len/6);
+  // The rounding errors of the first level add up in the second
+  *tolerance = 4;
+  return 6*(len/6);
+}
+
+primitive_t primitives[] = {
+  {"dot_prod_sss", run_dot_prod_sss},
+  {"sum_sss",      run_sum_sss},
+  {"sub_sss",      run_sub_sss},
+  {"prod_sss",     run_prod_sss},
+  {"sc_div2_sss",  run_sc_div2_sss},
+  {"lut_sss",      run_lut_sss},
+  {"convert_fi",   run_convert_fi},
+  {"sc_prod_cfc",  run_sc_prod_cfc},
+  {"demod_16qam",  run_demod_16qam},
+  {"demod_64qam",  run_demod_64qam},
+};
+#define NOF_PRIMITIVES (sizeof(primitives)/sizeof(primitive_t))
+
+// Output of a primitive as floats, from whichever buffer it writes
+float get_output(primitive_t *p, buffers_t *o, uint32_t i) {
+  if (p->run == run_sc_prod_cfc) {
+    return o->f[i];
+  } else if (p->run == run_demod_16qam || p->run == run_demod_64qam) {
+    return o->llr[i];
+  } else {
+    return o->z[i];
+  }
+}
+
+void alloc_buffers(buffers_t *b) {
+  b->x   = srslte_vec_malloc(sizeof(short)*MAX_LEN);
+  b->y   = srslte_vec_malloc(sizeof(short)*MAX_LEN);
+  b->z   = srslte_vec_malloc(sizeof(short)*MAX_LEN);
+  b->lut = srslte_vec_malloc(sizeof(unsigned short)*MAX_LEN);
+  b->f   = srslte_vec_malloc(sizeof(float)*2*MAX_LEN);
+  b->c   = srslte_vec_malloc(sizeof(cf_t)*MAX_LEN);
+  b->cz  = srslte_vec_malloc(sizeof(cf_t)*MAX_LEN);
+  b->llr = srslte_vec_malloc(sizeof(short)*6*MAX_LEN);
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  alloc_buffers(&in);
+  alloc_buffers(&out[0]);
+  alloc_buffers(&out[1]);
+
+  // Small values so that the 16-bit accumulators of the dot product kernels do not overflow
+  for (int i=0;i<MAX_LEN;i++) {
+    in.x[i] = rand()%17 - 8;
+    in.y[i] = rand()%17 - 8;
+    in.f[i] = (float) rand()/RAND_MAX*20 - 10;
+    in.c[i] = ((float) rand()/RAND_MAX*2 - 1) + _Complex_I*((float) rand()/RAND_MAX*2 - 1);
+  }
+
+  srslte_simd_level_t cpu_level = srslte_simd_cpu_level();
+  srslte_simd_level_t selected  = srslte_simd_get_level();
+  printf("CPU SIMD level: %s, selected: %s\n", srslte_simd_level_string(cpu_level), srslte_simd_level_string(selected));
+
+  int nof_errors = 0;
+  for (int level=SRSLTE_SIMD_SSE41;level<=cpu_level;level++) {
+    for (uint32_t p=0;p<NOF_PRIMITIVES;p++) {
+      for (uint32_t n=0;n<nof_lengths;n++) {
+        uint32_t len = n < 70 ? n : 1 + rand()%(MAX_LEN-1);
+        float    tolerance;
+
+        srslte_simd_set_level(SRSLTE_SIMD_GENERIC);
+        uint32_t nout = primitives[p].run(&out[0], len, &tolerance);
+        srslte_simd_set_level((srslte_simd_level_t) level);
+        primitives[p].run(&out[1], len, &tolerance);
+
+        for (uint32_t i=0;i<nout;i++) {
+          float a = get_output(&primitives[p], &out[0], i);
+          float b = get_output(&primitives[p], &out[1], i);
+          if (fabsf(a - b) > tolerance) {
+            if (nof_errors++ < 10) {
+              printf("%s %s len=%d: output %d is %.1f, generic %.1f\n", primitives[p].name,
+                     srslte_simd_level_string((srslte_simd_level_t) level), len, i, b, a);
+            }
+            break;
+          }
+        }
+      }
+    }
+    printf("Checked %s kernels\n", srslte_simd_level_string((srslte_simd_level_t) level));
+  }
+  srslte_simd_set_level(selected);
+
+  for (uint32_t k=0;k<srslte_vec_nof_kernels();k++) {
+    printf("  %-14s %s\n", srslte_vec_kernel_name(k), srslte_simd_level_string(srslte_vec_kernel_level(k)));
+  }
+
+  if (nof_errors) {
+    printf("Error: %d mismatches\n", nof_errors);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
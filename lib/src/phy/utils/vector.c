@@ -43,8 +43,186 @@
 #warning FIXME: Disabling SSE/AVX vector code
 #undef LV_HAVE_SSE
 #undef LV_HAVE_AVX
+#undef LV_HAVE_AVX2
+#undef LV_HAVE_AVX512
 #endif
 
+/* Generic implementations of the primitives with SIMD kernels */
+
+static int dot_prod_sss_gen(short *x, short *y, uint32_t len) {
+  int res = 0;
+  for (uint32_t i=0;i<len;i++) {
+    res += x[i]*y[i];
+  }
+  return res;
+}
+
+static void sum_sss_gen(short *x, short *y, short *z, uint32_t len) {
+  for (uint32_t i=0;i<len;i++) {
+    z[i] = x[i]+y[i];
+  }
+}
+
+static void sub_sss_gen(short *x, short *y, short *z, uint32_t len) {
+  for (uint32_t i=0;i<len;i++) {
+    z[i] = x[i]-y[i];
+  }
+}
+
+static void prod_sss_gen(short *x, short *y, short *z, uint32_t len) {
+  for (uint32_t i=0;i<len;i++) {
+    z[i] = x[i]*y[i];
+  }
+}
+
+static void sc_div2_sss_gen(short *x, int n_rightshift, short *z, uint32_t len) {
+  int pow2_div = 1<<n_rightshift;
+  for (uint32_t i=0;i<len;i++) {
+    z[i] = x[i]/pow2_div;
+  }
+}
+
+static void lut_sss_gen(short *x, unsigned short *lut, short *y, uint32_t len) {
+  for (uint32_t i=0;i<len;i++) {
+    y[lut[i]] = x[i];
+  }
+}
+
+static void convert_fi_gen(float *x, int16_t *z, float scale, uint32_t len) {
+  for (uint32_t i=0;i<len;i++) {
+    z[i] = (int16_t) (x[i]*scale);
+  }
+}
+
+static void mult_scalar_cf_f_gen(cf_t *z, const cf_t *x, const float h, const uint32_t len) {
+  for (uint32_t i=0;i<len;i++) {
+    z[i] = x[i]*h;
+  }
+}
+
+/* Run-time kernel selection. Each primitive has a kernel per instruction set level, or NULL
+ * if there is none, and calls the one for the highest level not above the selected one.
+ * The level is initialised from CPUID at startup and can be capped with the
+ * SRSLTE_SIMD_LEVEL environment variable (generic, sse4.1, avx2 or avx512). The rest of the
+ * library is built for the SIMD level of the build host, which the CPU must still support.
+ */
+typedef void (*vec_kernel_fn)(void);
+
+typedef int  (*dot_prod_sss_fn)(short *x, short *y, uint32_t len);
+typedef void (*op_sss_fn)(short *x, short *y, short *z, uint32_t len);
+typedef void (*sc_div2_sss_fn)(short *x, int n_rightshift, short *z, uint32_t len);
+typedef void (*lut_sss_fn)(short *x, unsigned short *lut, short *y, uint32_t len);
+typedef void (*convert_fi_fn)(float *x, int16_t *z, float scale, uint32_t len);
+typedef void (*mult_scalar_cf_f_fn)(cf_t *z, const cf_t *x, const float h, const uint32_t len);
+
+#define KERNEL(f)  ((vec_kernel_fn) f)
+#ifdef LV_HAVE_SSE
+#define KERNEL_SSE41(f)  KERNEL(f)
+#else
+#define KERNEL_SSE41(f)  NULL
+#endif
+#ifdef LV_HAVE_AVX2
+#define KERNEL_AVX2(f)   KERNEL(f)
+#else
+#define KERNEL_AVX2(f)   NULL
+#endif
+#ifdef LV_HAVE_AVX512
+#define KERNEL_AVX512(f) KERNEL(f)
+#else
+#define KERNEL_AVX512(f) NULL
+#endif
+
+enum {
+  VEC_DOT_PROD_SSS = 0,
+  VEC_SUM_SSS,
+  VEC_SUB_SSS,
+  VEC_PROD_SSS,
+  VEC_SC_DIV2_SSS,
+  VEC_LUT_SSS,
+  VEC_CONVERT_FI,
+  VEC_SC_PROD_CFC,
+  VEC_NOF_KERNELS
+};
+
+static struct {
+  const char          *name;
+  vec_kernel_fn        impl[SRSLTE_SIMD_NOF_LEVELS];
+  vec_kernel_fn        selected;
+  srslte_simd_level_t  level;
+} vec_kernels[VEC_NOF_KERNELS] = {
+  {"dot_prod_sss", {KERNEL(dot_prod_sss_gen), KERNEL_SSE41(srslte_vec_dot_prod_sss_sse),
+                    KERNEL_AVX2(srslte_vec_dot_prod_sss_avx), KERNEL_AVX512(srslte_vec_dot_prod_sss_avx512)}},
+  {"sum_sss",      {KERNEL(sum_sss_gen), KERNEL_SSE41(srslte_vec_sum_sss_sse),
+                    KERNEL_AVX2(srslte_vec_sum_sss_avx), KERNEL_AVX512(srslte_vec_sum_sss_avx512)}},
+  {"sub_sss",      {KERNEL(sub_sss_gen), KERNEL_SSE41(srslte_vec_sub_sss_sse),
+                    KERNEL_AVX2(srslte_vec_sub_sss_avx), KERNEL_AVX512(srslte_vec_sub_sss_avx512)}},
+  {"prod_sss",     {KERNEL(prod_sss_gen), KERNEL_SSE41(srslte_vec_prod_sss_sse),
+                    KERNEL_AVX2(srslte_vec_prod_sss_avx), KERNEL_AVX512(srslte_vec_prod_sss_avx512)}},
+  {"sc_div2_sss",  {KERNEL(sc_div2_sss_gen), KERNEL_SSE41(srslte_vec_sc_div2_sss_sse),
+                    KERNEL_AVX2(srslte_vec_sc_div2_sss_avx), KERNEL_AVX512(srslte_vec_sc_div2_sss_avx512)}},
+  // No improvement with wider vectors
+  {"lut_sss",      {KERNEL(lut_sss_gen), KERNEL_SSE41(srslte_vec_lut_sss_sse), NULL, NULL}},
+  {"convert_fi",   {KERNEL(convert_fi_gen), KERNEL_SSE41(srslte_vec_convert_fi_sse),
+                    KERNEL_AVX2(srslte_vec_convert_fi_avx), KERNEL_AVX512(srslte_vec_convert_fi_avx512)}},
+  {"sc_prod_cfc",  {KERNEL(mult_scalar_cf_f_gen), KERNEL_SSE41(srslte_vec_mult_scalar_cf_f_sse),
+                    KERNEL_AVX2(srslte_vec_mult_scalar_cf_f_avx), KERNEL_AVX512(srslte_vec_mult_scalar_cf_f_avx512)}},
+};
+
+static srslte_simd_level_t simd_level = SRSLTE_SIMD_GENERIC;
+
+#define VEC_KERNEL(k, type) ((type) vec_kernels[k].selected)
+
+static void vec_kernels_select(srslte_simd_level_t level) {
+  for (int k=0;k<VEC_NOF_KERNELS;k++) {
+    int l = level;
+    while (!vec_kernels[k].impl[l]) {
+      l--;
+    }
+    vec_kernels[k].selected = vec_kernels[k].impl[l];
+    vec_kernels[k].level    = (srslte_simd_level_t) l;
+  }
+  simd_level = level;
+}
+
+__attribute__((constructor))
+static void vec_kernels_init() {
+  srslte_simd_level_t level = srslte_simd_cpu_level();
+  srslte_simd_level_t cap;
+  const char *env = getenv("SRSLTE_SIMD_LEVEL");
+  if (env) {
+    if (srslte_simd_level_parse(env, &cap)) {
+      fprintf(stderr, "Invalid SRSLTE_SIMD_LEVEL=%s. Using %s\n", env, srslte_simd_level_string(level));
+    } else if (cap < level) {
+      level = cap;
+    }
+  }
+  vec_kernels_select(level);
+}
+
+int srslte_simd_set_level(srslte_simd_level_t level) {
+  if (level >= SRSLTE_SIMD_NOF_LEVELS || level > srslte_simd_cpu_level()) {
+    return SRSLTE_ERROR;
+  }
+  vec_kernels_select(level);
+  return SRSLTE_SUCCESS;
+}
+
+srslte_simd_level_t srslte_simd_get_level() {
+  return simd_level;
+}
+
+uint32_t srslte_vec_nof_kernels() {
+  return VEC_NOF_KERNELS;
+}
+
+const char* srslte_vec_kernel_name(uint32_t idx) {
+  return idx < VEC_NOF_KERNELS ? vec_kernels[idx].name : NULL;
+}
+
+srslte_simd_level_t srslte_vec_kernel_level(uint32_t idx) {
+  return idx < VEC_NOF_KERNELS ? vec_kernels[idx].level : SRSLTE_SIMD_GENERIC;
+}
+
 
 int srslte_vec_acc_ii(int *x, uint32_t len) {
   int i;
@@ -110,18 +288,7 @@ void srslte_vec_sub_fff(float *x, float *y, float *z, uint32_t len) {
 }
 
 void srslte_vec_sub_sss(short *x, short *y, short *z, uint32_t len) {
-#ifdef LV_HAVE_AVX
-  srslte_vec_sub_sss_avx(x, y, z, len);
-#else
-#ifdef LV_HAVE_SSE
-  srslte_vec_sub_sss_sse(x, y, z, len);
-#else
-    int i;
-  for (i=0;i<len;i++) {
-    z[i] = x[i]-y[i];
-  }
-#endif
-#endif
+  VEC_KERNEL(VEC_SUB_SSS, op_sss_fn)(x, y, z, len);
 }
 
 void srslte_vec_sub_ccc(cf_t *x, cf_t *y, cf_t *z, uint32_t len) {
@@ -140,18 +307,7 @@ void srslte_vec_sum_fff(float *x, float *y, float *z, uint32_t len) {
 }
 
 void srslte_vec_sum_sss(short *x, short *y, short *z, uint32_t len) {
-#ifdef LV_HAVE_AVX
-  srslte_vec_sum_sss_avx(x, y, z, len);
-#else
-#ifdef LV_HAVE_SSE
-  srslte_vec_sum_sss_sse(x, y, z, len);
-#else
-  int i;
-  for (i=0;i<len;i++) {
-    z[i] = x[i]+y[i];
-  }
-#endif
-#endif
+  VEC_KERNEL(VEC_SUM_SSS, op_sss_fn)(x, y, z, len);
 }
 
 void srslte_vec_sum_ccc(cf_t *x, cf_t *y, cf_t *z, uint32_t len) {
@@ -212,19 +368,7 @@ void srslte_vec_sc_prod_sfs(short *x, float h, short *z, uint32_t len) {
 }
 
 void srslte_vec_sc_div2_sss(short *x, int n_rightshift, short *z, uint32_t len) {
-#ifdef LV_HAVE_AVX
-  srslte_vec_sc_div2_sss_avx(x, n_rightshift, z, len);
-#else
-#ifdef LV_HAVE_SSE
-  srslte_vec_sc_div2_sss_sse(x, n_rightshift, z, len);
-#else
-  int i;
-  int pow2_div = 1<<n_rightshift;
-  for (i=0;i<len;i++) {
-    z[i] = x[i]/pow2_div;
-  }
-#endif
-#endif
+  VEC_KERNEL(VEC_SC_DIV2_SSS, sc_div2_sss_fn)(x, n_rightshift, z, len);
 }
 
 // TODO: Improve this implementation
@@ -239,15 +383,7 @@ void srslte_vec_norm_cfc(cf_t *x, float amplitude, cf_t *y, uint32_t len) {
 }
 
 void srslte_vec_sc_prod_cfc(cf_t *x, float h, cf_t *z, uint32_t len) {
-#ifdef LV_HAVE_AVX
-  srslte_vec_mult_scalar_cf_f_avx(z,x, h, len);  
-#else
-  int i;
-  for (i=0;i<len;i++) {
-    z[i] = x[i]*h;
-  }
-
-#endif
+  VEC_KERNEL(VEC_SC_PROD_CFC, mult_scalar_cf_f_fn)(z, x, h, len);
 }
 
 void srslte_vec_sc_prod_ccc(cf_t *x, cf_t h, cf_t *z, uint32_t len) {
@@ -285,14 +421,7 @@ void srslte_vec_convert_ci(int8_t *x, int16_t *z, uint32_t len) {
 }
 
 void srslte_vec_convert_fi(float *x, int16_t *z, float scale, uint32_t len) {
-#ifndef LV_HAVE_SSE
-  int i;
-  for (i=0;i<len;i++) {
-    z[i] = (int16_t) (x[i]*scale);
-  }
-#else 
-  srslte_vec_convert_fi_sse(x, z, scale, len);
-#endif
+  VEC_KERNEL(VEC_CONVERT_FI, convert_fi_fn)(x, z, scale, len);
 }
 
 void srslte_vec_lut_fuf(float *x, uint32_t *lut, float *y, uint32_t len) {
@@ -302,13 +431,7 @@ void srslte_vec_lut_fuf(float *x, uint32_t *lut, float *y, uint32_t len) {
 }
 
 void srslte_vec_lut_sss(short *x, unsigned short *lut, short *y, uint32_t len) {
-#ifndef LV_HAVE_SSE
-  for (int i=0;i<len;i++) {
-    y[lut[i]] = x[i];
-  }
-#else
-  srslte_vec_lut_sss_sse(x, lut, y, len);
-#endif
+  VEC_KERNEL(VEC_LUT_SSS, lut_sss_fn)(x, lut, y, len);
 }
 
 void srslte_vec_interleave_cf(float *real, float *imag, cf_t *x, uint32_t len) {
@@ -520,18 +643,7 @@ void srslte_vec_prod_fff(float *x, float *y, float *z, uint32_t len) {
 }
 
 void srslte_vec_prod_sss(short *x, short *y, short *z, uint32_t len) {
-#ifdef LV_HAVE_AVX
-  srslte_vec_prod_sss_avx(x,y,z,len);
-#else
-#ifdef LV_HAVE_SSE
-  srslte_vec_prod_sss_sse(x,y,z,len);
-#else
-  int i;
-  for (i=0;i<len;i++) {
-    z[i] = x[i]*y[i];
-  }
-#endif
-#endif
+  VEC_KERNEL(VEC_PROD_SSS, op_sss_fn)(x, y, z, len);
 }
 
 void srslte_vec_prod_ccc(cf_t *x,cf_t *y, cf_t *z, uint32_t len) {
@@ -620,12 +732,14 @@ cf_t srslte_vec_dot_prod_cfc(cf_t *x, float *y, uint32_t len) {
   volk_32fc_32f_dot_prod_32fc(&res, x, y, len);
   return res; 
 #else  
+  // Separate accumulators let the compiler vectorize the loop
   uint32_t i;
-  cf_t res = 0;
+  float re = 0, im = 0;
   for (i=0;i<len;i++) {
-    res += x[i]*y[i];
+    re += __real__ x[i]*y[i];
+    im += __imag__ x[i]*y[i];
   }
-  return res;
+  return re + _Complex_I*im;
 #endif
 }
 
@@ -661,20 +775,7 @@ float srslte_vec_dot_prod_fff(float *x, float *y, uint32_t len) {
 }
 
 int32_t srslte_vec_dot_prod_sss(int16_t *x, int16_t *y, uint32_t len) {
-#ifdef LV_HAVE_AVX
-  return srslte_vec_dot_prod_sss_avx(x, y, len);
-#else
-#ifdef LV_HAVE_SSE
-  return srslte_vec_dot_prod_sss_sse(x, y, len);
-#else
-  uint32_t i;
-  int32_t res = 0;
-  for (i=0;i<len;i++) {
-    res += x[i]*y[i];
-  }
-  return res;
-#endif
-#endif
+  return VEC_KERNEL(VEC_DOT_PROD_SSS, dot_prod_sss_fn)(x, y, len);
 }
 
 float srslte_vec_avg_power_cf(cf_t *x, uint32_t len) {
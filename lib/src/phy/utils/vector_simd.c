@@ -36,15 +36,53 @@
 #include <inttypes.h>
 #include <stdio.h>
 
-#ifdef LV_HAVE_SSE
-#include <smmintrin.h>
+#if defined(LV_HAVE_SSE) || defined(LV_HAVE_AVX2) || defined(LV_HAVE_AVX512)
+#include <immintrin.h>
 #endif
 
-#ifdef LV_HAVE_AVX
-#include <immintrin.h>
+srslte_simd_level_t srslte_simd_cpu_level()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+#ifdef LV_HAVE_AVX512
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return SRSLTE_SIMD_AVX512;
+  }
 #endif
+#ifdef LV_HAVE_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    return SRSLTE_SIMD_AVX2;
+  }
+#endif
+#ifdef LV_HAVE_SSE
+  if (__builtin_cpu_supports("sse4.1")) {
+    return SRSLTE_SIMD_SSE41;
+  }
+#endif
+#endif
+  return SRSLTE_SIMD_GENERIC;
+}
+
+static const char *simd_level_names[SRSLTE_SIMD_NOF_LEVELS] = {"generic", "sse4.1", "avx2", "avx512"};
 
+const char* srslte_simd_level_string(srslte_simd_level_t level)
+{
+  return level < SRSLTE_SIMD_NOF_LEVELS ? simd_level_names[level] : "unknown";
+}
 
+int srslte_simd_level_parse(const char *str, srslte_simd_level_t *level)
+{
+  for (int i=0;i<SRSLTE_SIMD_NOF_LEVELS;i++) {
+    if (!strcmp(str, simd_level_names[i])) {
+      *level = (srslte_simd_level_t) i;
+      return SRSLTE_SUCCESS;
+    }
+  }
+  return SRSLTE_ERROR;
+}
+
+
+SRSLTE_TARGET_SSE41
 int srslte_vec_dot_prod_sss_sse(short *x, short *y, uint32_t len)
 {
   int result = 0; 
@@ -87,10 +125,11 @@ int srslte_vec_dot_prod_sss_sse(short *x, short *y, uint32_t len)
 }
 
 
+SRSLTE_TARGET_AVX2
 int srslte_vec_dot_prod_sss_avx(short *x, short *y, uint32_t len)
 {
   int result = 0; 
-#ifdef LV_HAVE_AVX
+#ifdef LV_HAVE_AVX2
   unsigned int number = 0;
   const unsigned int points = len / 16;
 
@@ -127,6 +166,7 @@ int srslte_vec_dot_prod_sss_avx(short *x, short *y, uint32_t len)
 
 
 
+SRSLTE_TARGET_SSE41
 void srslte_vec_sum_sss_sse(short *x, short *y, short *z, uint32_t len)
 {
 #ifdef LV_HAVE_SSE
@@ -160,9 +200,10 @@ void srslte_vec_sum_sss_sse(short *x, short *y, short *z, uint32_t len)
 
 }
 
+SRSLTE_TARGET_AVX2
 void srslte_vec_sum_sss_avx(short *x, short *y, short *z, uint32_t len)
 {
-#ifdef LV_HAVE_SSE
+#ifdef LV_HAVE_AVX2
   unsigned int number = 0;
   const unsigned int points = len / 16;
 
@@ -193,6 +234,7 @@ void srslte_vec_sum_sss_avx(short *x, short *y, short *z, uint32_t len)
 }
 
 
+SRSLTE_TARGET_SSE41
 void srslte_vec_sub_sss_sse(short *x, short *y, short *z, uint32_t len)
 {
 #ifdef LV_HAVE_SSE
@@ -225,9 +267,10 @@ void srslte_vec_sub_sss_sse(short *x, short *y, short *z, uint32_t len)
 #endif
 }
 
+SRSLTE_TARGET_AVX2
 void srslte_vec_sub_sss_avx(short *x, short *y, short *z, uint32_t len)
 {
-#ifdef LV_HAVE_AVX
+#ifdef LV_HAVE_AVX2
   unsigned int number = 0;
   const unsigned int points = len / 16;
 
@@ -260,6 +303,7 @@ void srslte_vec_sub_sss_avx(short *x, short *y, short *z, uint32_t len)
 
 
 
+SRSLTE_TARGET_SSE41
 void srslte_vec_prod_sss_sse(short *x, short *y, short *z, uint32_t len)
 {
 #ifdef LV_HAVE_SSE
@@ -292,9 +336,10 @@ void srslte_vec_prod_sss_sse(short *x, short *y, short *z, uint32_t len)
 #endif
 }
 
+SRSLTE_TARGET_AVX2
 void srslte_vec_prod_sss_avx(short *x, short *y, short *z, uint32_t len)
 {
-#ifdef LV_HAVE_SSE
+#ifdef LV_HAVE_AVX2
   unsigned int number = 0;
   const unsigned int points = len / 16;
 
@@ -329,6 +374,7 @@ void srslte_vec_prod_sss_avx(short *x, short *y, short *z, uint32_t len)
 
 
 
+SRSLTE_TARGET_SSE41
 void srslte_vec_sc_div2_sss_sse(short *x, int k, short *z, uint32_t len)
 {
 #ifdef LV_HAVE_SSE
@@ -359,9 +405,10 @@ void srslte_vec_sc_div2_sss_sse(short *x, int k, short *z, uint32_t len)
 #endif
 }
 
+SRSLTE_TARGET_AVX2
 void srslte_vec_sc_div2_sss_avx(short *x, int k, short *z, uint32_t len)
 {
-#ifdef LV_HAVE_AVX
+#ifdef LV_HAVE_AVX2
   unsigned int number = 0;
   const unsigned int points = len / 16;
 
@@ -392,6 +439,7 @@ void srslte_vec_sc_div2_sss_avx(short *x, int k, short *z, uint32_t len)
 
 
 /* No improvement with AVX */
+SRSLTE_TARGET_SSE41
 void srslte_vec_lut_sss_sse(short *x, unsigned short *lut, short *y, uint32_t len)
 {
 #ifndef DEBUG_MODE
@@ -426,6 +474,7 @@ void srslte_vec_lut_sss_sse(short *x, unsigned short *lut, short *y, uint32_t le
 }
 
 /* Modified from volk_32f_s32f_convert_16i_a_simd2. Removed clipping */
+SRSLTE_TARGET_SSE41
 void srslte_vec_convert_fi_sse(float *x, int16_t *z, float scale, uint32_t len)
 {
 #ifdef LV_HAVE_SSE
@@ -465,9 +514,10 @@ void srslte_vec_convert_fi_sse(float *x, int16_t *z, float scale, uint32_t len)
 }
 
 //srslte_32fc_s32f_multiply_32fc_avx
- void srslte_vec_mult_scalar_cf_f_avx( cf_t *z,const cf_t *x,const float h,const uint32_t len)
+SRSLTE_TARGET_AVX2
+void srslte_vec_mult_scalar_cf_f_avx( cf_t *z,const cf_t *x,const float h,const uint32_t len)
 {
-#ifdef LV_HAVE_AVX
+#ifdef LV_HAVE_AVX2
    
   unsigned int i = 0;
   const unsigned int loops = len/4;
@@ -493,3 +543,197 @@ void srslte_vec_convert_fi_sse(float *x, int16_t *z, float scale, uint32_t len)
   }
 #endif
 }
+
+SRSLTE_TARGET_SSE41
+void srslte_vec_mult_scalar_cf_f_sse(cf_t *z, const cf_t *x, const float h, const uint32_t len)
+{
+#ifdef LV_HAVE_SSE
+  unsigned int i = 0;
+  const unsigned int loops = len/2;
+  const float *xPtr = (const float*) x;
+  float *zPtr = (float*) z;
+  const __m128 tapsVec = _mm_set1_ps(h);
+
+  for(;i < loops;i++) {
+    _mm_storeu_ps(zPtr, _mm_mul_ps(_mm_loadu_ps(xPtr), tapsVec));
+    xPtr += 4;
+    zPtr += 4;
+  }
+  for(i = loops * 2;i < len;i++) {
+    z[i] = x[i] * h;
+  }
+#endif
+}
+
+SRSLTE_TARGET_AVX2
+void srslte_vec_convert_fi_avx(float *x, int16_t *z, float scale, uint32_t len)
+{
+#ifdef LV_HAVE_AVX2
+  unsigned int number = 0;
+  const unsigned int points = len / 16;
+  const __m256 vScalar = _mm256_set1_ps(scale);
+
+  for(;number < points; number++){
+    __m256i a = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&x[16*number]), vScalar));
+    __m256i b = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&x[16*number+8]), vScalar));
+    // packs works within 128-bit lanes, restore the order of the 64-bit blocks
+    __m256i r = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+    _mm256_storeu_si256((__m256i*) &z[16*number], r);
+  }
+
+  number = points * 16;
+  for(; number < len; number++){
+    z[number] = (int16_t) (x[number] * scale);
+  }
+#endif
+}
+
+/* The AVX-512 kernels use unaligned accesses, as srslte_vec_malloc() aligns to 32 bytes only */
+
+SRSLTE_TARGET_AVX512
+int srslte_vec_dot_prod_sss_avx512(short *x, short *y, uint32_t len)
+{
+  int result = 0;
+#ifdef LV_HAVE_AVX512
+  unsigned int number = 0;
+  const unsigned int points = len / 32;
+
+  __m512i dotProdVal = _mm512_setzero_si512();
+  for(;number < points; number++){
+    __m512i xVal = _mm512_loadu_si512(&x[32*number]);
+    __m512i yVal = _mm512_loadu_si512(&y[32*number]);
+    dotProdVal = _mm512_add_epi16(dotProdVal, _mm512_mullo_epi16(xVal, yVal));
+  }
+
+  short dotProdVector[32];
+  _mm512_storeu_si512(dotProdVector, dotProdVal);
+  for (int i=0;i<32;i++) {
+    result += dotProdVector[i];
+  }
+
+  number = points * 32;
+  for(;number < len; number++){
+    result += (x[number] * y[number]);
+  }
+#endif
+  return result;
+}
+
+SRSLTE_TARGET_AVX512
+void srslte_vec_sum_sss_avx512(short *x, short *y, short *z, uint32_t len)
+{
+#ifdef LV_HAVE_AVX512
+  unsigned int number = 0;
+  const unsigned int points = len / 32;
+
+  for(;number < points; number++){
+    __m512i xVal = _mm512_loadu_si512(&x[32*number]);
+    __m512i yVal = _mm512_loadu_si512(&y[32*number]);
+    _mm512_storeu_si512(&z[32*number], _mm512_add_epi16(xVal, yVal));
+  }
+
+  number = points * 32;
+  for(;number < len; number++){
+    z[number] = x[number] + y[number];
+  }
+#endif
+}
+
+SRSLTE_TARGET_AVX512
+void srslte_vec_sub_sss_avx512(short *x, short *y, short *z, uint32_t len)
+{
+#ifdef LV_HAVE_AVX512
+  unsigned int number = 0;
+  const unsigned int points = len / 32;
+
+  for(;number < points; number++){
+    __m512i xVal = _mm512_loadu_si512(&x[32*number]);
+    __m512i yVal = _mm512_loadu_si512(&y[32*number]);
+    _mm512_storeu_si512(&z[32*number], _mm512_sub_epi16(xVal, yVal));
+  }
+
+  number = points * 32;
+  for(;number < len; number++){
+    z[number] = x[number] - y[number];
+  }
+#endif
+}
+
+SRSLTE_TARGET_AVX512
+void srslte_vec_prod_sss_avx512(short *x, short *y, short *z, uint32_t len)
+{
+#ifdef LV_HAVE_AVX512
+  unsigned int number = 0;
+  const unsigned int points = len / 32;
+
+  for(;number < points; number++){
+    __m512i xVal = _mm512_loadu_si512(&x[32*number]);
+    __m512i yVal = _mm512_loadu_si512(&y[32*number]);
+    _mm512_storeu_si512(&z[32*number], _mm512_mullo_epi16(xVal, yVal));
+  }
+
+  number = points * 32;
+  for(;number < len; number++){
+    z[number] = x[number] * y[number];
+  }
+#endif
+}
+
+SRSLTE_TARGET_AVX512
+void srslte_vec_sc_div2_sss_avx512(short *x, int k, short *z, uint32_t len)
+{
+#ifdef LV_HAVE_AVX512
+  unsigned int number = 0;
+  const unsigned int points = len / 32;
+  const __m128i shift = _mm_cvtsi32_si128(k);
+
+  for(;number < points; number++){
+    __m512i xVal = _mm512_loadu_si512(&x[32*number]);
+    _mm512_storeu_si512(&z[32*number], _mm512_sra_epi16(xVal, shift));
+  }
+
+  number = points * 32;
+  short divn = (1<<k);
+  for(;number < len; number++){
+    z[number] = x[number] / divn;
+  }
+#endif
+}
+
+SRSLTE_TARGET_AVX512
+void srslte_vec_convert_fi_avx512(float *x, int16_t *z, float scale, uint32_t len)
+{
+#ifdef LV_HAVE_AVX512
+  unsigned int number = 0;
+  const unsigned int points = len / 16;
+  const __m512 vScalar = _mm512_set1_ps(scale);
+
+  for(;number < points; number++){
+    __m512i a = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_loadu_ps(&x[16*number]), vScalar));
+    _mm256_storeu_si256((__m256i*) &z[16*number], _mm512_cvtsepi32_epi16(a));
+  }
+
+  number = points * 16;
+  for(; number < len; number++){
+    z[number] = (int16_t) (x[number] * scale);
+  }
+#endif
+}
+
+SRSLTE_TARGET_AVX512
+void srslte_vec_mult_scalar_cf_f_avx512(cf_t *z, const cf_t *x, const float h, const uint32_t len)
+{
+#ifdef LV_HAVE_AVX512
+  unsigned int i = 0;
+  const unsigned int loops = len/8;
+  const __m512 tapsVec = _mm512_set1_ps(h);
+
+  for(;i < loops;i++) {
+    __m512 inputVec = _mm512_loadu_ps((const float*) &x[8*i]);
+    _mm512_storeu_ps((float*) &z[8*i], _mm512_mul_ps(inputVec, tapsVec));
+  }
+  for(i = loops * 8;i < len;i++) {
+    z[i] = x[i] * h;
+  }
+#endif
+}
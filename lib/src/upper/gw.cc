@@ -36,15 +36,18 @@
 #include <linux/if_tun.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <poll.h>
 
 
 namespace srslte {
 
 gw::gw()
   :if_up(false)
+  ,mtu(GW_DEFAULT_MTU)
 {}
 
-void gw::init(srsue::pdcp_interface_gw *pdcp_, srsue::rrc_interface_gw *rrc_, srsue::ue_interface *ue_, log *gw_log_)
+void gw::init(srsue::pdcp_interface_gw *pdcp_, srsue::rrc_interface_gw *rrc_, srsue::ue_interface *ue_, log *gw_log_, 
+               uint32_t nof_tun_queues_)
 {
   pool    = byte_buffer_pool::get_instance();
   pdcp    = pdcp_;
@@ -53,6 +56,19 @@ void gw::init(srsue::pdcp_interface_gw *pdcp_, srsue::rrc_interface_gw *rrc_, sr
   gw_log  = gw_log_;
   run_enable = true;
 
+  nof_tun_queues = nof_tun_queues_;
+  if (nof_tun_queues < 1 || nof_tun_queues > GW_MAX_TUN_QUEUES) {
+    gw_log->error("Invalid number of TUN queues %d, must be between 1 and %d. Using a single queue\n", 
+                  nof_tun_queues_, GW_MAX_TUN_QUEUES);
+    nof_tun_queues = 1;
+  }
+#ifndef IFF_MULTI_QUEUE
+  if (nof_tun_queues > 1) {
+    gw_log->warning("Multi-queue TUN devices not supported by this kernel. Using a single queue\n");
+    nof_tun_queues = 1;
+  }
+#endif
+
   gettimeofday(&metrics_time[1], NULL);
   dl_tput_bytes = 0;
   ul_tput_bytes = 0;
@@ -65,18 +81,12 @@ void gw::stop()
     run_enable = false;
     if(if_up)
     {
-      close(tun_fd);
-      
-      // Wait thread to exit gracefully otherwise might leave a mutex locked
-      int cnt=0;
-      while(running && cnt<100) {
-        usleep(10000);
-        cnt++;
+      for(uint32_t i=0;i<nof_tun_queues;i++) {
+        readers[i].stop();
       }
-      if (running) {
-        thread_cancel();
+      for(uint32_t i=0;i<nof_tun_queues;i++) {
+        close(tun_fds[i]);
       }
-      wait_thread_finish();
     }
 
     // TODO: tear down TUN device?
@@ -112,7 +122,9 @@ void gw::write_pdu(uint32_t lcid, byte_buffer_t *pdu)
   {
     gw_log->warning("TUN/TAP not up - dropping gw RX message\n");
   }else{
-    int n = write(tun_fd, pdu->msg, pdu->N_bytes); 
+    // Packets written to any queue of a multi-queue TUN device enter the same kernel 
+    // receive path, so queue 0 is used for all of them. The queues only parallelize reads. 
+    int n = write(tun_fds[0], pdu->msg, pdu->N_bytes); 
     if(n > 0 && (pdu->N_bytes != (uint32_t)n))
     {
       gw_log->warning("DL TUN/TAP write failure\n");
@@ -143,7 +155,7 @@ error_t gw::setup_if_addr(uint32_t ip_addr, char *err_str)
   {
       err_str = strerror(errno);
       gw_log->debug("Failed to set socket address: %s\n", err_str);
-      close(tun_fd);
+      close(tun_fds[0]);
       return(ERROR_CANT_START);
   }
   ifr.ifr_netmask.sa_family                                 = AF_INET;
@@ -152,16 +164,52 @@ error_t gw::setup_if_addr(uint32_t ip_addr, char *err_str)
   {
       err_str = strerror(errno);
       gw_log->debug("Failed to set socket netmask: %s\n", err_str);
-      close(tun_fd);
+      close(tun_fds[0]);
       return(ERROR_CANT_START);
   }
 
-  // Setup a thread to receive packets from the TUN device
-  start(GW_THREAD_PRIO);
+  start_readers();
+
+  return(ERROR_NONE);
+}
+
+error_t gw::setup_if_fds(const int32 *fds, uint32_t nof_fds, uint32_t mtu_)
+{
+  if(if_up)
+  {
+    return(ERROR_ALREADY_STARTED);
+  }
+  if(nof_fds < 1 || nof_fds > GW_MAX_TUN_QUEUES)
+  {
+    gw_log->error("Invalid number of TUN queues %d, must be between 1 and %d\n", nof_fds, GW_MAX_TUN_QUEUES);
+    return(ERROR_CANT_START);
+  }
+  for(uint32_t i=0;i<nof_fds;i++)
+  {
+    if(0 > fcntl(fds[i], F_SETFL, O_NONBLOCK))
+    {
+      gw_log->error("Failed to set TUN queue %d non-blocking: %s\n", i, strerror(errno));
+      return(ERROR_CANT_START);
+    }
+    tun_fds[i] = fds[i];
+  }
+  nof_tun_queues = nof_fds;
+  mtu            = mtu_;
+  if_up          = true;
+
+  start_readers();
 
   return(ERROR_NONE);
 }
 
+void gw::start_readers()
+{
+  // Setup one thread per TUN queue to receive packets from the TUN device
+  for(uint32_t i=0;i<nof_tun_queues;i++) {
+    readers[i].start_reader(this, i);
+  }
+}
+
 error_t gw::init_if(char *err_str)
 {
     if(if_up)
@@ -171,24 +219,43 @@ error_t gw::init_if(char *err_str)
 
     char dev[IFNAMSIZ] = "tun_srsue";
 
-    // Construct the TUN device
-    tun_fd = open("/dev/net/tun", O_RDWR);
-    gw_log->info("TUN file descriptor = %d\n", tun_fd);
-    if(0 > tun_fd)
-    {
-        err_str = strerror(errno);
-        gw_log->debug("Failed to open TUN device: %s\n", err_str);
-        return(ERROR_CANT_START);
-    }
-    memset(&ifr, 0, sizeof(ifr));
-    ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
-    strncpy(ifr.ifr_ifrn.ifrn_name, dev, IFNAMSIZ);
-    if(0 > ioctl(tun_fd, TUNSETIFF, &ifr))
+    // Construct the TUN device. With multiple queues, every queue is a separate 
+    // file descriptor attached to the same device and the kernel spreads the 
+    // outgoing flows among them. 
+    for(uint32_t i=0;i<nof_tun_queues;i++)
     {
-        err_str = strerror(errno);
-        gw_log->debug("Failed to set TUN device name: %s\n", err_str);
-        close(tun_fd);
-        return(ERROR_CANT_START);
+      tun_fds[i] = open("/dev/net/tun", O_RDWR);
+      gw_log->info("TUN file descriptor = %d\n", tun_fds[i]);
+      if(0 > tun_fds[i])
+      {
+          err_str = strerror(errno);
+          gw_log->debug("Failed to open TUN device: %s\n", err_str);
+          close_tun_fds(i);
+          return(ERROR_CANT_START);
+      }
+      memset(&ifr, 0, sizeof(ifr));
+      ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+#ifdef IFF_MULTI_QUEUE
+      if(nof_tun_queues > 1) {
+        ifr.ifr_flags |= IFF_MULTI_QUEUE;
+      }
+#endif
+      strncpy(ifr.ifr_ifrn.ifrn_name, dev, IFNAMSIZ);
+      if(0 > ioctl(tun_fds[i], TUNSETIFF, &ifr))
+      {
+          err_str = strerror(errno);
+          gw_log->debug("Failed to set TUN device name: %s\n", err_str);
+          close_tun_fds(i+1);
+          return(ERROR_CANT_START);
+      }
+      // Readers wait with poll() and drain the queue without blocking
+      if(0 > fcntl(tun_fds[i], F_SETFL, O_NONBLOCK))
+      {
+          err_str = strerror(errno);
+          gw_log->debug("Failed to set TUN device non-blocking: %s\n", err_str);
+          close_tun_fds(i+1);
+          return(ERROR_CANT_START);
+      }
     }
 
     // Bring up the interface
@@ -197,7 +264,7 @@ error_t gw::init_if(char *err_str)
     {
         err_str = strerror(errno);
         gw_log->debug("Failed to bring up socket: %s\n", err_str);
-        close(tun_fd);
+        close_tun_fds(nof_tun_queues);
         return(ERROR_CANT_START);
     }
     ifr.ifr_flags |= IFF_UP | IFF_RUNNING;
@@ -205,84 +272,161 @@ error_t gw::init_if(char *err_str)
     {
         err_str = strerror(errno);
         gw_log->debug("Failed to set socket flags: %s\n", err_str);
-        close(tun_fd);
+        close_tun_fds(nof_tun_queues);
         return(ERROR_CANT_START);
     }
+    // Size the read buffers from the MTU configured on the device
+    if(0 > ioctl(sock, SIOCGIFMTU, &ifr))
+    {
+        gw_log->warning("Failed to get TUN device MTU: %s. Assuming %d bytes\n", strerror(errno), GW_DEFAULT_MTU);
+        mtu = GW_DEFAULT_MTU;
+    } else {
+        mtu = ifr.ifr_mtu;
+    }
+    if(mtu > SRSLTE_MAX_BUFFER_SIZE_BYTES-SRSLTE_BUFFER_HEADER_OFFSET)
+    {
+        gw_log->warning("TUN device MTU of %d bytes exceeds the buffer size, longer packets are dropped\n", mtu);
+    }
+    gw_log->info("TUN device MTU = %d\n", mtu);
 
     if_up = true;
 
     return(ERROR_NONE);
 }
 
+void gw::close_tun_fds(uint32_t nof_fds)
+{
+  for(uint32_t i=0;i<nof_fds;i++) {
+    close(tun_fds[i]);
+  }
+}
+
 /********************/
 /*    GW Receive    */
 /********************/
-void gw::run_thread()
+void gw::tun_reader::start_reader(gw *parent_, uint32_t queue_idx_)
+{
+  if (started) {
+    return;
+  }
+  parent    = parent_;
+  queue_idx = queue_idx_;
+  started   = true;
+  start(GW_THREAD_PRIO);
+}
+
+void gw::tun_reader::stop()
 {
-    struct iphdr   *ip_pkt;
-    uint32          idx = 0;
-    int32           N_bytes;
-    byte_buffer_t  *pdu = pool_allocate;
+  if (!started) {
+    return;
+  }
+  // The thread checks run_enable at least every GW_POLL_TIMEOUT_MS
+  int cnt=0;
+  while(running && cnt<100) {
+    usleep(10000);
+    cnt++;
+  }
+  if (running) {
+    thread_cancel();
+  }
+  wait_thread_finish();
+  started = false;
+}
 
-    gw_log->info("GW IP packet receiver thread run_enable\n");
+void gw::tun_reader::run_thread()
+{
+    byte_buffer_pool *pool = parent->pool;
+    byte_buffer_t    *pdus[GW_READ_BATCH];
+    byte_buffer_t    *pdu      = NULL;
+    uint32_t          nof_pdus = 0;
+    struct pollfd     pfd;
+
+    pfd.fd     = parent->tun_fds[queue_idx];
+    pfd.events = POLLIN;
+
+    parent->gw_log->info("GW IP packet receiver thread %d run_enable\n", queue_idx);
 
     running = true; 
-    while(run_enable)
+    while(parent->run_enable)
     {
-      if (SRSLTE_MAX_BUFFER_SIZE_BYTES-SRSLTE_BUFFER_HEADER_OFFSET > idx) {
-        N_bytes = read(tun_fd, &pdu->msg[idx], SRSLTE_MAX_BUFFER_SIZE_BYTES-SRSLTE_BUFFER_HEADER_OFFSET - idx);
-      } else {
-        gw_log->error("GW pdu buffer full - gw receive thread exiting.\n");
-        gw_log->console("GW pdu buffer full - gw receive thread exiting.\n");
-        break; 
+      int ret = poll(&pfd, 1, GW_POLL_TIMEOUT_MS);
+      if (ret == 0 || (ret < 0 && errno == EINTR)) {
+        continue;
       }
-      gw_log->debug("Read %d bytes from TUN fd=%d, idx=%d\n", N_bytes, tun_fd, idx);
-      if(N_bytes > 0)
+      if (ret < 0 || (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))) {
+        parent->gw_log->error("Failed to read from TUN interface - gw receive thread exiting.\n");
+        parent->gw_log->console("Failed to read from TUN interface - gw receive thread exiting.\n");
+        break;
+      }
+
+      // Read all the packets waiting in this queue, up to a batch
+      bool read_error = false; 
+      while(nof_pdus < GW_READ_BATCH)
       {
-        pdu->N_bytes = idx + N_bytes;
-        ip_pkt       = (struct iphdr*)pdu->msg;
-
-        // Warning: Accept only IPv4 packets
-        if (ip_pkt->version == 4) {
-          // Check if entire packet was received
-          if(ntohs(ip_pkt->tot_len) == pdu->N_bytes)
-          {
-            gw_log->info_hex(pdu->msg, pdu->N_bytes, "TX PDU");
-
-            while(run_enable && (!rrc->rrc_connected() || !rrc->have_drb())) {
-              rrc->rrc_connect();
-              usleep(1000);
-            }
-            
-            if (!run_enable) {
-              break;
-            }
-            
-            // Send PDU directly to PDCP
-            pdu->set_timestamp();
-            ul_tput_bytes += pdu->N_bytes;
-            pdcp->write_sdu(RB_ID_DRB1, pdu);
-            
-            do {
-              pdu = pool_allocate;
-              if (!pdu) {
-                printf("Not enough buffers in pool\n");
-                usleep(100000);
-              }
-            } while(!pdu); 
-            idx = 0;
-          }else{
-            idx += N_bytes;
-          }            
-        } 
-      }else{
-        gw_log->error("Failed to read from TUN interface - gw receive thread exiting.\n");
-        gw_log->console("Failed to read from TUN interface - gw receive thread exiting.\n");
+        if (!pdu) {
+          pdu = pool_allocate_bytes(parent->mtu);
+          if (!pdu) {
+            parent->gw_log->warning("Not enough buffers in pool\n");
+            break;
+          }
+        }
+        int32 N_bytes = read(pfd.fd, pdu->msg, pdu->get_tailroom());
+        if (N_bytes <= 0) {
+          read_error = N_bytes == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+          break;
+        }
+        parent->gw_log->debug("Read %d bytes from TUN fd=%d\n", N_bytes, pfd.fd);
+        pdu->N_bytes = N_bytes;
+
+        // Warning: Accept only IPv4 packets. TUN reads always return a whole packet
+        struct iphdr *ip_pkt = (struct iphdr*)pdu->msg;
+        if (ip_pkt->version == 4 && ntohs(ip_pkt->tot_len) == pdu->N_bytes) {
+          parent->gw_log->info_hex(pdu->msg, pdu->N_bytes, "TX PDU");
+          pdu->set_timestamp();
+          pdus[nof_pdus++] = pdu;
+          pdu = NULL;
+        } else {
+          pdu->reset();
+        }
+      }
+      if (read_error) {
+        parent->gw_log->error("Failed to read from TUN interface - gw receive thread exiting.\n");
+        parent->gw_log->console("Failed to read from TUN interface - gw receive thread exiting.\n");
         break;
       }
+      if (nof_pdus == 0) {
+        if (!pdu) {
+          usleep(100000);
+        }
+        continue;
+      }
+
+      while(parent->run_enable && (!parent->rrc->rrc_connected() || !parent->rrc->have_drb())) {
+        parent->rrc->rrc_connect();
+        usleep(1000);
+      }
+
+      if (!parent->run_enable) {
+        break;
+      }
+
+      // Send the whole batch to PDCP at once
+      long nof_bytes = 0;
+      for (uint32_t i=0;i<nof_pdus;i++) {
+        nof_bytes += pdus[i]->N_bytes;
+      }
+      __sync_fetch_and_add(&parent->ul_tput_bytes, nof_bytes);
+      parent->pdcp->write_sdu_batch(RB_ID_DRB1, pdus, nof_pdus);
+      nof_pdus = 0;
+    }
+    for (uint32_t i=0;i<nof_pdus;i++) {
+      pool->deallocate(pdus[i]);
+    }
+    if (pdu) {
+      pool->deallocate(pdu);
     }
     running = false; 
-    gw_log->info("GW IP receiver thread exiting.\n");
+    parent->gw_log->info("GW IP receiver thread %d exiting.\n", queue_idx);
 }
 
 } // namespace srsue
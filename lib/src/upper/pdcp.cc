@@ -64,6 +64,17 @@ void pdcp::write_sdu(uint32_t lcid, byte_buffer_t *sdu)
     pdcp_array[lcid].write_sdu(sdu);
 }
 
+void pdcp::write_sdu_batch(uint32_t lcid, byte_buffer_t **sdus, uint32_t nof_sdus)
+{
+  if(valid_lcid(lcid)) {
+    pdcp_array[lcid].write_sdu_batch(sdus, nof_sdus);
+  } else {
+    for(uint32_t i=0;i<nof_sdus;i++) {
+      byte_buffer_pool::get_instance()->deallocate(sdus[i]);
+    }
+  }
+}
+
 void pdcp::add_bearer(uint32_t lcid, LIBLTE_RRC_PDCP_CONFIG_STRUCT *cnfg)
 {
   if(lcid < 0 || lcid >= SRSLTE_N_RADIO_BEARERS) {
@@ -88,6 +99,12 @@ void pdcp::config_security(uint32_t lcid,
     pdcp_array[lcid].config_security(k_rrc_enc, k_rrc_int, cipher_algo, integ_algo);
 }
 
+void pdcp::enable_encryption(uint32_t lcid)
+{
+  if(valid_lcid(lcid))
+    pdcp_array[lcid].enable_encryption();
+}
+
 /*******************************************************************************
   RLC interface
 *******************************************************************************/
@@ -35,9 +35,11 @@ pdcp_entity::pdcp_entity()
   ,tx_count(0)
   ,rx_count(0)
   ,do_security(false)
+  ,do_encryption(false)
   ,sn_len(12)
 {
   pool = byte_buffer_pool::get_instance();
+  pthread_mutex_init(&tx_mutex, NULL);
 }
 
 void pdcp_entity::init(srsue::rlc_interface_pdcp      *rlc_,
@@ -56,9 +58,10 @@ void pdcp_entity::init(srsue::rlc_interface_pdcp      *rlc_,
   direction = direction_;
   active    = true;
 
-  tx_count    = 0;
-  rx_count    = 0;
-  do_security = false;
+  tx_count      = 0;
+  rx_count      = 0;
+  do_security   = false;
+  do_encryption = false;
 
   if(cnfg)
   {
@@ -86,6 +89,39 @@ bool pdcp_entity::is_active()
 
 // RRC interface
 void pdcp_entity::write_sdu(byte_buffer_t *sdu)
+{
+  pthread_mutex_lock(&tx_mutex);
+  write_sdu_nolock(sdu);
+  pthread_mutex_unlock(&tx_mutex);
+}
+
+// GW interface. All SDUs of the batch are processed with a single lock and
+// DRB PDUs are ciphered PDCP_MAX_BATCH at a time
+void pdcp_entity::write_sdu_batch(byte_buffer_t **sdus, uint32_t nof_sdus)
+{
+  pthread_mutex_lock(&tx_mutex);
+  if(lcid < RB_ID_DRB1) {
+    for(uint32_t i=0;i<nof_sdus;i++) {
+      write_sdu_nolock(sdus[i]);
+    }
+  } else {
+    security_pdu_t pdus[PDCP_MAX_BATCH];
+    for(uint32_t i=0;i<nof_sdus;i+=PDCP_MAX_BATCH) {
+      uint32_t n = (nof_sdus-i < PDCP_MAX_BATCH) ? nof_sdus-i : PDCP_MAX_BATCH;
+      for(uint32_t j=0;j<n;j++) {
+        log->info_hex(sdus[i+j]->msg, sdus[i+j]->N_bytes, "TX %s SDU, do_security = %s", rb_id_text[lcid], (do_security)?"true":"false");
+        pack_data_pdu(sdus[i+j], &pdus[j]);
+      }
+      cipher(pdus, n, direction);
+      for(uint32_t j=0;j<n;j++) {
+        rlc->write_sdu(lcid, sdus[i+j]);
+      }
+    }
+  }
+  pthread_mutex_unlock(&tx_mutex);
+}
+
+void pdcp_entity::write_sdu_nolock(byte_buffer_t *sdu)
 {
   log->info_hex(sdu->msg, sdu->N_bytes, "TX %s SDU, do_security = %s", rb_id_text[lcid], (do_security)?"true":"false");
 
@@ -108,6 +144,12 @@ void pdcp_entity::write_sdu(byte_buffer_t *sdu)
                          sdu->N_bytes-4,
                          &sdu->msg[sdu->N_bytes-4]);
     }
+    if(do_encryption)
+    {
+      // The header is sent in the clear, the data and the MAC-I are ciphered
+      security_pdu_t pdu = {tx_count, &sdu->msg[1], sdu->N_bytes-1, NULL};
+      cipher(&pdu, 1, direction);
+    }
     tx_count++;
     rlc->write_sdu(lcid, sdu);
 
@@ -117,16 +159,29 @@ void pdcp_entity::write_sdu(byte_buffer_t *sdu)
   // Handle DRB messages
   if(lcid >= RB_ID_DRB1)
   {
-    if(12 == sn_len)
-    {
-      pdcp_pack_data_pdu_long_sn(tx_count++, sdu);
-    } else {
-      pdcp_pack_data_pdu_short_sn(tx_count++, sdu);
-    }
+    security_pdu_t pdu;
+    pack_data_pdu(sdu, &pdu);
+    cipher(&pdu, 1, direction);
     rlc->write_sdu(lcid, sdu);
   }
 }
 
+// Adds the DRB header and returns the part of the PDU to be ciphered
+void pdcp_entity::pack_data_pdu(byte_buffer_t *sdu, security_pdu_t *pdu)
+{
+  pdu->count = tx_count;
+  if(12 == sn_len)
+  {
+    pdcp_pack_data_pdu_long_sn(tx_count++, sdu);
+  } else {
+    pdcp_pack_data_pdu_short_sn(tx_count++, sdu);
+  }
+  uint32_t header_len = (12 == sn_len) ? 2 : 1;
+  pdu->msg     = &sdu->msg[header_len];
+  pdu->msg_len = sdu->N_bytes - header_len;
+  pdu->mac     = NULL;
+}
+
 void pdcp_entity::config_security(uint8_t *k_rrc_enc_,
                                   uint8_t *k_rrc_int_,
                                   CIPHERING_ALGORITHM_ID_ENUM cipher_algo_,
@@ -140,6 +195,15 @@ void pdcp_entity::config_security(uint8_t *k_rrc_enc_,
   }
   cipher_algo = cipher_algo_;
   integ_algo  = integ_algo_;
+
+  security_aes_key_init(&k_enc_aes, &k_rrc_enc[16]);
+  security_aes_key_init(&k_int_aes, &k_rrc_int[16]);
+}
+
+// Ciphering starts once the security mode procedure has completed (36.331 5.3.4.3)
+void pdcp_entity::enable_encryption()
+{
+  do_encryption = do_security;
 }
 
 // RLC interface
@@ -157,6 +221,11 @@ void pdcp_entity::write_pdu(byte_buffer_t *pdu)
   case RB_ID_SRB2:
     uint32_t sn;
     log->info_hex(pdu->msg, pdu->N_bytes, "RX %s PDU", rb_id_text[lcid]);
+    if(pdu->N_bytes > 1)
+    {
+      security_pdu_t p = {get_rx_count(*pdu->msg & 0x1F, 5), &pdu->msg[1], pdu->N_bytes-1, NULL};
+      cipher(&p, 1, rx_direction());
+    }
     pdcp_unpack_control_pdu(pdu, &sn);
     log->info_hex(pdu->msg, pdu->N_bytes, "RX %s SDU SN: %d",
                   rb_id_text[lcid], sn);
@@ -174,6 +243,8 @@ void pdcp_entity::write_pdu(byte_buffer_t *pdu)
     } else {
       pdcp_unpack_data_pdu_short_sn(pdu, &sn);
     }
+    security_pdu_t p = {get_rx_count(sn, sn_len), pdu->msg, pdu->N_bytes, NULL};
+    cipher(&p, 1, rx_direction());
     log->info_hex(pdu->msg, pdu->N_bytes, "RX %s PDU: %d", rb_id_text[lcid], sn);
     gw->write_pdu(lcid, pdu);
   }
@@ -201,7 +272,8 @@ void pdcp_entity::integrity_generate( uint8_t  *key_128,
                       mac);
     break;
   case INTEGRITY_ALGORITHM_ID_128_EIA2:
-    security_128_eia2(key_128,
+    // Uses the key schedule expanded from key_128 in config_security()
+    security_128_eia2(&k_int_aes,
                       count,
                       rb_id,
                       direction,
@@ -214,6 +286,44 @@ void pdcp_entity::integrity_generate( uint8_t  *key_128,
   }
 }
 
+void pdcp_entity::cipher(security_pdu_t *pdus, uint32_t nof_pdus, uint8_t dir)
+{
+  if(!do_encryption) {
+    return;
+  }
+  switch(cipher_algo)
+  {
+  case CIPHERING_ALGORITHM_ID_128_EEA1:
+    for(uint32_t i=0; i<nof_pdus; i++) {
+      security_128_eea1(&k_rrc_enc[16], pdus[i].count, lcid-1, dir, pdus[i].msg, pdus[i].msg_len);
+    }
+    break;
+  case CIPHERING_ALGORITHM_ID_128_EEA2:
+    security_128_eea2_batch(&k_enc_aes, lcid-1, dir, pdus, nof_pdus);
+    break;
+  default:
+    break;
+  }
+}
+
+uint8_t pdcp_entity::rx_direction()
+{
+  return (SECURITY_DIRECTION_UPLINK == direction) ? SECURITY_DIRECTION_DOWNLINK : SECURITY_DIRECTION_UPLINK;
+}
+
+// COUNT of a received PDU, from its SN and the COUNT following the last one.
+// RLC delivers PDUs in order, so a lower SN means the HFN has been incremented.
+uint32_t pdcp_entity::get_rx_count(uint32_t sn, uint32_t sn_bits)
+{
+  uint32_t hfn = rx_count >> sn_bits;
+  if(sn < (rx_count & ((1 << sn_bits) - 1))) {
+    hfn++;
+  }
+  uint32_t count = (hfn << sn_bits) | sn;
+  rx_count = count + 1;
+  return count;
+}
+
 /****************************************************************************
  * Pack/Unpack helper functions
  * Ref: 3GPP TS 36.323 v10.1.0
@@ -42,6 +42,9 @@ rlc_am::rlc_am() : tx_sdu_queue(16)
   rx_sdu = NULL;
   pool = byte_buffer_pool::get_instance();
 
+  tx_sdu_offset = 0;
+  copied_bytes  = 0;
+
   pthread_mutex_init(&mutex, NULL);
   
   vt_a    = 0;
@@ -107,10 +110,15 @@ void rlc_am::reset()
 
   pthread_mutex_lock(&mutex);
   reordering_timeout.reset();
-  if(tx_sdu)
-    tx_sdu->reset();
-  if(rx_sdu)
-    rx_sdu->reset();
+  if(tx_sdu) {
+    pool->deallocate(tx_sdu);
+    tx_sdu = NULL;
+  }
+  if(rx_sdu) {
+    pool->deallocate(rx_sdu);
+    rx_sdu = NULL;
+  }
+  tx_sdu_offset = 0;
 
   vt_a    = 0;
   vt_ms   = RLC_AM_WINDOW_SIZE;
@@ -129,30 +137,25 @@ void rlc_am::reset()
   poll_received = false;
   do_status     = false;
 
-  // Drop all messages in RX segments
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator rxsegsit;
-  std::list<rlc_amd_rx_pdu_t>::iterator                   segit;
-  for(rxsegsit = rx_segments.begin(); rxsegsit != rx_segments.end(); rxsegsit++) {
-    std::list<rlc_amd_rx_pdu_t> l = rxsegsit->second.segments;
-    for(segit = l.begin(); segit != l.end(); segit++) {
-      pool->deallocate(segit->buf);
+  // Drop all messages in RX segments, RX window and TX window
+  std::list<rlc_amd_rx_pdu_t>::iterator segit;
+  for(uint32_t sn = 0; sn < MOD; sn++) {
+    if(rx_segments.has(sn)) {
+      std::list<rlc_amd_rx_pdu_t> &l = rx_segments[sn].segments;
+      for(segit = l.begin(); segit != l.end(); segit++) {
+        pool->deallocate(segit->buf);
+      }
+      l.clear();
+    }
+    if(rx_window.has(sn)) {
+      free_fragments(rx_window[sn].buf);
+    }
+    if(tx_window.has(sn)) {
+      rlc_sdu_chain_release(pool, tx_window[sn].sdu, tx_window[sn].sdu_offset, tx_window[sn].N_bytes);
     }
-    l.clear();
   }
   rx_segments.clear();
-  
-  // Drop all messages in RX window
-  std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator rxit;
-  for(rxit = rx_window.begin(); rxit != rx_window.end(); rxit++) {
-    pool->deallocate(rxit->second.buf);
-  }
   rx_window.clear();
-
-  // Drop all messages in TX window
-  std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator txit;
-  for(txit = tx_window.begin(); txit != tx_window.end(); txit++) {
-    pool->deallocate(txit->second.buf);
-  }
   tx_window.clear();
 
   // Drop all messages in RETX queue
@@ -201,7 +204,7 @@ uint32_t rlc_am::get_total_buffer_state()
   if(retx_queue.size() > 0) {
     rlc_amd_retx_t retx = retx_queue.front();
     log->debug("Buffer state - retx - SN: %d, Segment: %s, %d:%d\n", retx.sn, retx.is_segment ? "true" : "false", retx.so_start, retx.so_end);
-    if(tx_window.end() != tx_window.find(retx.sn)) {
+    if(tx_window.has(retx.sn)) {
         n_bytes += required_buffer_size(retx);
         log->debug("Buffer state - retx: %d bytes\n", n_bytes);
     }
@@ -213,7 +216,7 @@ uint32_t rlc_am::get_total_buffer_state()
   if(tx_sdu)
   {
     n_sdus++;
-    n_bytes += tx_sdu->N_bytes;
+    n_bytes += tx_sdu->N_bytes - tx_sdu_offset;
   }
 
   // Room needed for header extensions? (integer rounding)
@@ -248,7 +251,7 @@ uint32_t rlc_am::get_buffer_state()
   if(retx_queue.size() > 0) {
     rlc_amd_retx_t retx = retx_queue.front();
     log->debug("Buffer state - retx - SN: %d, Segment: %s, %d:%d\n", retx.sn, retx.is_segment ? "true" : "false", retx.so_start, retx.so_end);
-    if(tx_window.end() != tx_window.find(retx.sn)) {
+    if(tx_window.has(retx.sn)) {
       n_bytes = required_buffer_size(retx);
       log->debug("Buffer state - retx: %d bytes\n", n_bytes);
       goto unlock_and_return;
@@ -262,7 +265,7 @@ uint32_t rlc_am::get_buffer_state()
     if(tx_sdu)
     {
       n_sdus++;
-      n_bytes += tx_sdu->N_bytes;
+      n_bytes += tx_sdu->N_bytes - tx_sdu_offset;
     }
   }
 
@@ -324,6 +327,11 @@ void rlc_am::write_pdu(uint8_t *payload, uint32_t nof_bytes)
   pthread_mutex_unlock(&mutex);
 }
 
+uint64_t rlc_am::get_copied_bytes()
+{
+  return copied_bytes;
+}
+
 /****************************************************************************
  * Timer checks
  ***************************************************************************/
@@ -346,13 +354,7 @@ void rlc_am::check_reordering_timeout()
     log->debug("%s reordering timeout expiry - updating vr_ms\n", rb_id_text[lcid]);
 
     // 36.322 v10 Section 5.1.3.2.4
-    vr_ms = vr_x;
-    std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator it = rx_window.find(vr_ms);
-    while(rx_window.end() != it)
-    {
-      vr_ms = (vr_ms + 1)%MOD;
-      it = rx_window.find(vr_ms);
-    }
+    vr_ms = rx_window.next_missing(vr_x, vr_mr);
     if(poll_received)
       do_status = true;
 
@@ -388,12 +390,11 @@ int rlc_am::prepare_status()
 
   // We don't use segment NACKs - just NACK the full PDU
 
-  uint32_t i = vr_r;
-  while(RX_MOD_BASE(i) < RX_MOD_BASE(vr_ms))
+  uint32_t i = rx_window.next_missing(vr_r, vr_ms);
+  while(i != vr_ms)
   {
-    if(rx_window.find(i) == rx_window.end())
-      status.nacks[status.N_nack++].nack_sn = i;
-    i = (i + 1)%MOD;
+    status.nacks[status.N_nack++].nack_sn = i;
+    i = rx_window.next_missing((i + 1)%MOD, vr_ms);
   }
 
   return rlc_am_packed_length(&status);
@@ -426,7 +427,7 @@ int  rlc_am::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
   rlc_amd_retx_t retx = retx_queue.front();
 
   // Sanity check - drop any retx SNs not present in tx_window
-  while(tx_window.end() == tx_window.find(retx.sn)) {
+  while(!tx_window.has(retx.sn)) {
     retx_queue.pop_front();
     retx = retx_queue.front();
   }
@@ -451,7 +452,8 @@ int  rlc_am::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&new_header, &ptr);
-  memcpy(ptr, tx_window[retx.sn].buf->msg, tx_window[retx.sn].buf->N_bytes);
+  rlc_sdu_chain_copy(tx_window[retx.sn].sdu, tx_window[retx.sn].sdu_offset, tx_window[retx.sn].N_bytes, ptr);
+  copied_bytes += tx_window[retx.sn].N_bytes;
 
   retx_queue.pop_front();
   tx_window[retx.sn].retx_count++;
@@ -461,14 +463,14 @@ int  rlc_am::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
             rb_id_text[lcid], retx.sn, tx_window[retx.sn].retx_count);
 
   debug_state();
-  return (ptr-payload) + tx_window[retx.sn].buf->N_bytes;
+  return (ptr-payload) + tx_window[retx.sn].N_bytes;
 }
 
 int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t retx)
 {
   if(!retx.is_segment){
     retx.so_start = 0;
-    retx.so_end   = tx_window[retx.sn].buf->N_bytes;
+    retx.so_end   = tx_window[retx.sn].N_bytes;
   }
 
   // Construct new header
@@ -535,7 +537,7 @@ int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t r
   }
 
   // Update retx_queue
-  if(tx_window[retx.sn].buf->N_bytes == retx.so_end) {
+  if(tx_window[retx.sn].N_bytes == retx.so_end) {
     retx_queue.pop_front();
     new_header.lsf = 1;
     if(rlc_am_end_aligned(old_header.fi))
@@ -552,9 +554,9 @@ int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t r
   // Write header and pdu
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&new_header, &ptr);
-  uint8_t* data = &tx_window[retx.sn].buf->msg[retx.so_start];
   uint32_t len  = retx.so_end - retx.so_start;
-  memcpy(ptr, data, len);
+  rlc_sdu_chain_copy(tx_window[retx.sn].sdu, tx_window[retx.sn].sdu_offset + retx.so_start, len, ptr);
+  copied_bytes += len;
 
   log->info("%s Retx PDU segment scheduled for tx. SN: %d, SO: %d\n",
             rb_id_text[lcid], retx.sn, retx.so_start);
@@ -579,11 +581,6 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return 0;
   }
 
-  byte_buffer_t *pdu = pool_allocate;
-  if (!pdu) {
-    log->console("Fatal Error: Could not allocate PDU in build_data_pdu()\n");
-    exit(-1);
-  }
   rlc_amd_pdu_header_t header;
   header.dc   = RLC_DC_FIELD_DATA_PDU;
   header.rf   = 0;
@@ -598,13 +595,17 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   uint32_t to_move   = 0;
   uint32_t last_li   = 0;
   uint32_t pdu_space = nof_bytes;
-  uint8_t *pdu_ptr   = pdu->msg;
+
+  // The PDU data stays in the SDUs until it is copied to the payload
+  byte_buffer_t *first_sdu  = NULL;
+  byte_buffer_t *last_sdu   = NULL;
+  uint32_t       sdu_offset = 0;
+  uint32_t       data_len   = 0;
 
   if(pdu_space <= head_len)
   {
     log->warning("%s Cannot build a PDU - %d bytes available, %d bytes required for header\n",
                  rb_id_text[lcid], nof_bytes, head_len);
-    pool->deallocate(pdu);
     return 0;
   }
 
@@ -614,14 +615,16 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   // Check for SDU segment
   if(tx_sdu)
   {
-    to_move = ((pdu_space-head_len) >= tx_sdu->N_bytes) ? tx_sdu->N_bytes : pdu_space-head_len;
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
+    uint32_t left = tx_sdu->N_bytes - tx_sdu_offset;
+    to_move = ((pdu_space-head_len) >= left) ? left : pdu_space-head_len;
+    pool->add_ref(tx_sdu);
+    first_sdu        = tx_sdu;
+    last_sdu         = tx_sdu;
+    sdu_offset       = tx_sdu_offset;
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
-    tx_sdu->N_bytes -= to_move;
-    tx_sdu->msg     += to_move;
-    if(tx_sdu->N_bytes == 0)
+    data_len        += to_move;
+    tx_sdu_offset   += to_move;
+    if(tx_sdu_offset == tx_sdu->N_bytes)
     {
       log->info("%s Complete SDU scheduled for tx. Stack latency: %ld us\n",
                 rb_id_text[lcid], tx_sdu->get_latency_us());
@@ -649,14 +652,19 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
       break;
     }
     tx_sdu_queue.read(&tx_sdu);
+    tx_sdu_offset = 0;
+    tx_sdu->next  = NULL;
+    pool->add_ref(tx_sdu);
+    if(last_sdu)
+      last_sdu->next = tx_sdu;
+    else
+      first_sdu = tx_sdu;
+    last_sdu = tx_sdu;
     to_move = ((pdu_space-head_len) >= tx_sdu->N_bytes) ? tx_sdu->N_bytes : pdu_space-head_len;
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
-    tx_sdu->N_bytes -= to_move;
-    tx_sdu->msg     += to_move;
-    if(tx_sdu->N_bytes == 0)
+    data_len        += to_move;
+    tx_sdu_offset   += to_move;
+    if(tx_sdu_offset == tx_sdu->N_bytes)
     {
       log->info("%s Complete SDU scheduled for tx. Stack latency: %ld us\n",
                 rb_id_text[lcid], tx_sdu->get_latency_us());
@@ -677,7 +685,7 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   // Set Poll bit
   pdu_without_poll++;
-  byte_without_poll += (pdu->N_bytes + head_len);
+  byte_without_poll += (data_len + head_len);
   log->debug("%s pdu_without_poll: %d\n", rb_id_text[lcid], pdu_without_poll);
   log->debug("%s byte_without_poll: %d\n", rb_id_text[lcid], byte_without_poll);
   if(poll_required())
@@ -696,23 +704,24 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   log->info("%s PDU scheduled for tx. SN: %d\n", rb_id_text[lcid], header.sn);
 
   // Place PDU in tx_window, write header and TX
-  tx_window[header.sn].buf        = pdu;
+  tx_window[header.sn].sdu        = first_sdu;
+  tx_window[header.sn].sdu_offset = sdu_offset;
+  tx_window[header.sn].N_bytes    = data_len;
   tx_window[header.sn].header     = header;
   tx_window[header.sn].is_acked   = false;
   tx_window[header.sn].retx_count = 0;
 
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&header, &ptr);
-  memcpy(ptr, pdu->msg, pdu->N_bytes);
+  rlc_sdu_chain_copy(first_sdu, sdu_offset, data_len, ptr);
+  copied_bytes += data_len;
 
   debug_state();
-  return (ptr-payload) + pdu->N_bytes;
+  return (ptr-payload) + data_len;
 }
 
 void rlc_am::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t header)
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator it;
-
   log->info_hex(payload, nof_bytes, "%s Rx data PDU SN: %d",
                 rb_id_text[lcid], header.sn);
 
@@ -726,8 +735,7 @@ void rlc_am::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_h
     return;
   }
 
-  it = rx_window.find(header.sn);
-  if(rx_window.end() != it) {
+  if(rx_window.has(header.sn)) {
     if(header.p) {
       log->info("%s Status packet requested through polling bit\n", rb_id_text[lcid]);
       do_status = true;
@@ -737,17 +745,36 @@ void rlc_am::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_h
     return;
   }
 
-  // Write to rx window
+  // Write to rx window, one buffer per SDU fragment
   rlc_amd_rx_pdu_t pdu;
-  pdu.buf = pool_allocate;
-  if (!pdu.buf) {
-    log->console("Fatal Error: Could not allocate PDU in handle_data_pdu()\n");
-    exit(-1);
-  }
+  pdu.buf    = NULL;
+  pdu.header = header;
 
-  memcpy(pdu.buf->msg, payload, nof_bytes);
-  pdu.buf->N_bytes  = nof_bytes;
-  pdu.header        = header;
+  byte_buffer_t **tail   = &pdu.buf;
+  uint32_t        offset = 0;
+  for(uint32_t i=0; i<=header.N_li; i++)
+  {
+    uint32_t len = (i < header.N_li) ? header.li[i] : nof_bytes - offset;
+    if(len > nof_bytes - offset) {
+      log->warning("%s Discarding SN: %d with length indicators beyond the PDU\n",
+                   rb_id_text[lcid], header.sn);
+      free_fragments(pdu.buf);
+      return;
+    }
+    // The last fragment may start an SDU completed by later PDUs, which get appended to it
+    byte_buffer_t *frag = (i == header.N_li && !rlc_am_end_aligned(header.fi)) ? pool_allocate : pool_allocate_bytes(len);
+    if (!frag) {
+      log->console("Fatal Error: Could not allocate PDU in handle_data_pdu()\n");
+      exit(-1);
+    }
+    memcpy(frag->msg, &payload[offset], len);
+    frag->N_bytes = len;
+    frag->next    = NULL;
+    *tail   = frag;
+    tail    = &frag->next;
+    offset += len;
+  }
+  copied_bytes += nof_bytes;
 
   rx_window[header.sn] = pdu;
 
@@ -756,12 +783,7 @@ void rlc_am::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_h
     vr_h  = (header.sn + 1)%MOD;
 
   // Update vr_ms
-  it = rx_window.find(vr_ms);
-  while(rx_window.end() != it)
-  {
-    vr_ms = (vr_ms + 1)%MOD;
-    it = rx_window.find(vr_ms);
-  }
+  vr_ms = rx_window.next_missing(vr_ms, vr_mr);
 
   // Check poll bit
   if(header.p)
@@ -808,8 +830,6 @@ void rlc_am::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_h
 
 void rlc_am::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t header)
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
-
   log->info_hex(payload, nof_bytes, "%s Rx data PDU segment. SN: %d, SO: %d",
                 rb_id_text[lcid], header.sn, header.so);
 
@@ -825,7 +845,7 @@ void rlc_am::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_bytes, rlc_a
   }
 
   rlc_amd_rx_pdu_t segment;
-  segment.buf = pool_allocate;
+  segment.buf = pool_allocate_bytes(nof_bytes);
   if (!segment.buf) {
     log->console("Fatal Error: Could not allocate PDU in handle_data_pdu_segment()\n");
     exit(-1);
@@ -835,8 +855,7 @@ void rlc_am::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_bytes, rlc_a
   segment.header       = header;
 
   // Check if we already have a segment from the same PDU
-  it = rx_segments.find(header.sn);
-  if(rx_segments.end() != it) {
+  if(rx_segments.has(header.sn)) {
 
     if(header.p) {
       log->info("%s Status packet requested through polling bit\n", rb_id_text[lcid]);
@@ -844,14 +863,14 @@ void rlc_am::handle_data_pdu_segment(uint8_t *payload, uint32_t nof_bytes, rlc_a
     }
 
     // Add segment to PDU list and check for complete
-    if(add_segment_and_check(&it->second, &segment)) {
+    if(add_segment_and_check(&rx_segments[header.sn], &segment)) {
       std::list<rlc_amd_rx_pdu_t>::iterator segit;
-      std::list<rlc_amd_rx_pdu_t>           seglist = it->second.segments;
+      std::list<rlc_amd_rx_pdu_t>          &seglist = rx_segments[header.sn].segments;
       for(segit = seglist.begin(); segit != seglist.end(); segit++) {
         pool->deallocate(segit->buf);
       }
       seglist.clear();
-      rx_segments.erase(it);
+      rx_segments.erase(header.sn);
     }
 
   } else {
@@ -896,67 +915,66 @@ void rlc_am::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   poll_retx_timeout.reset();
 
-  // Handle ACKs and NACKs
-  bool update_vt_a = true;
-  uint32_t i = vt_a;
-  while(TX_MOD_BASE(i) < TX_MOD_BASE(status.ack_sn) &&
-        TX_MOD_BASE(i) < TX_MOD_BASE(vt_s))
+  // Handle ACKs and NACKs. Only the first NACK of each SN is used.
+  rlc_am_bitmap nacked;
+  uint16_t      nack_idx[MOD];
+  for(uint32_t j=0;j<status.N_nack;j++) {
+    uint32_t sn = status.nacks[j].nack_sn%MOD;
+    if(!nacked.has(sn)) {
+      nacked.set(sn);
+      nack_idx[sn] = j;
+    }
+  }
+
+  uint32_t stop = vt_s;
+  if(TX_MOD_BASE(status.ack_sn) < TX_MOD_BASE(vt_s))
+    stop = status.ack_sn;
+
+  // Everything below the first NACK is ACKed, the window moves past it at once
+  uint32_t first_nack = nacked.next_set(vt_a, stop);
+  uint32_t i = tx_window.next_present(vt_a, first_nack);
+  while(i != first_nack)
   {
-    std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator it;
-
-    bool nack = false;
-    for(uint32_t j=0;j<status.N_nack;j++) {
-      if(status.nacks[j].nack_sn == i) {
-        nack = true;
-        update_vt_a = false;
-        it = tx_window.find(i);
-        if(tx_window.end() != it)
-        {
-          if(!retx_queue_has_sn(i)) {
-            rlc_amd_retx_t retx;
-            retx.is_segment = false;
-            retx.so_start   = 0;
-            retx.so_end     = it->second.buf->N_bytes;
-
-            if(status.nacks[j].has_so) {
-              if(status.nacks[j].so_start <  it->second.buf->N_bytes &&
-                 status.nacks[j].so_end   <= it->second.buf->N_bytes) {
-                  retx.is_segment = true;
-                  retx.so_start = status.nacks[j].so_start;
-                  if(status.nacks[j].so_end == 0x7FFF) {
-                    retx.so_end = it->second.buf->N_bytes;
-                  }else{
-                    retx.so_end   = status.nacks[j].so_end + 1;
-                  }
-              } else {
-                log->warning("%s invalid segment NACK received for SN %d. so_start: %d, so_end: %d, N_bytes: %d\n",
-                             rb_id_text[lcid], i, status.nacks[j].so_start, status.nacks[j].so_end, it->second.buf->N_bytes);
-              }
-            }
+    rlc_sdu_chain_release(pool, tx_window[i].sdu, tx_window[i].sdu_offset, tx_window[i].N_bytes);
+    i = tx_window.next_present((i+1)%MOD, first_nack);
+  }
+  tx_window.erase(vt_a, first_nack);
+  vt_a  = first_nack;
+  vt_ms = (vt_a + RLC_AM_WINDOW_SIZE)%MOD;
 
-            retx.sn         = i;
-            retx_queue.push_back(retx);
-          }
+  // Above it, NACKed SNs get queued for retx and ACKed SNs are marked
+  i = tx_window.next_present(first_nack, stop);
+  while(i != stop)
+  {
+    if(!nacked.has(i)) {
+      tx_window[i].is_acked = true;
+    } else if(!retx_queue_has_sn(i)) {
+      rlc_status_nack_t *nack = &status.nacks[nack_idx[i]];
+      rlc_amd_retx_t     retx;
+      retx.is_segment = false;
+      retx.so_start   = 0;
+      retx.so_end     = tx_window[i].N_bytes;
+
+      if(nack->has_so) {
+        if(nack->so_start <  tx_window[i].N_bytes &&
+           nack->so_end   <= tx_window[i].N_bytes) {
+            retx.is_segment = true;
+            retx.so_start = nack->so_start;
+            if(nack->so_end == 0x7FFF) {
+              retx.so_end = tx_window[i].N_bytes;
+            }else{
+              retx.so_end   = nack->so_end + 1;
+            }
+        } else {
+          log->warning("%s invalid segment NACK received for SN %d. so_start: %d, so_end: %d, N_bytes: %d\n",
+                       rb_id_text[lcid], i, nack->so_start, nack->so_end, tx_window[i].N_bytes);
         }
       }
-    }
 
-    if(!nack) {
-      //ACKed SNs get marked and removed from tx_window if possible
-      it = tx_window.find(i);
-      if(tx_window.end() != it)
-      {
-        tx_window[i].is_acked = true;
-        if(update_vt_a)
-        {
-          pool->deallocate(tx_window[i].buf);
-          tx_window.erase(i);
-          vt_a = (vt_a + 1)%MOD;
-          vt_ms = (vt_ms + 1)%MOD;
-        }
-      }
+      retx.sn         = i;
+      retx_queue.push_back(retx);
     }
-    i = (i+1)%MOD;
+    i = tx_window.next_present((i+1)%MOD, stop);
   }
 
   debug_state();
@@ -964,58 +982,66 @@ void rlc_am::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
 
 void rlc_am::reassemble_rx_sdus()
 {
-  if(!rx_sdu) {
-    rx_sdu = pool_allocate;
-    if (!rx_sdu) {
-      log->console("Fatal Error: Could not allocate PDU in reassemble_rx_sdus() (1)\n");
-      exit(-1);
-    }
-  }
   // Iterate through rx_window, assembling and delivering SDUs
-  while(rx_window.end() != rx_window.find(vr_r))
+  while(rx_window.has(vr_r))
   {
-    // Handle any SDU segments
-    for(uint32_t i=0; i<rx_window[vr_r].header.N_li; i++)
-    {
-      int len = rx_window[vr_r].header.li[i];
-      memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_r].buf->msg, len);
-      rx_sdu->N_bytes += len;
-      rx_window[vr_r].buf->msg += len;
-      rx_window[vr_r].buf->N_bytes -= len;
-      log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU", rb_id_text[lcid]);
-      rx_sdu->set_timestamp();
-      pdcp->write_pdu(lcid, rx_sdu);
-      rx_sdu = pool_allocate;
-      if (!rx_sdu) {
-        log->console("Fatal Error: Could not allocate PDU in reassemble_rx_sdus() (2)\n");
-      exit(-1);
-      }
+    rlc_amd_rx_pdu_t &pdu = rx_window[vr_r];
 
-    }
-
-    // Handle last segment
-    memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_r].buf->msg, rx_window[vr_r].buf->N_bytes);
-    rx_sdu->N_bytes += rx_window[vr_r].buf->N_bytes;
-    if(rlc_am_end_aligned(rx_window[vr_r].header.fi))
+    // Every fragment but the last one ends an SDU
+    byte_buffer_t *frag = pdu.buf;
+    for(uint32_t i=0; frag; i++)
     {
-      log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU", rb_id_text[lcid]);
-      rx_sdu->set_timestamp();
-      pdcp->write_pdu(lcid, rx_sdu);
-      rx_sdu = pool_allocate;
-      if (!rx_sdu) {
-        log->console("Fatal Error: Could not allocate PDU in reassemble_rx_sdus() (3)\n");
-      exit(-1);
-      }
+      byte_buffer_t *next = frag->next;
+      frag->next = NULL;
+      reassemble_fragment(frag, i < pdu.header.N_li || rlc_am_end_aligned(pdu.header.fi));
+      frag = next;
     }
 
     // Move the rx_window
-    pool->deallocate(rx_window[vr_r].buf);
     rx_window.erase(vr_r);
     vr_r = (vr_r + 1)%MOD;
     vr_mr = (vr_mr + 1)%MOD;
   }
 }
 
+// Fragments starting an SDU become the SDU buffer and the rest are appended to it, so
+// SDUs carried whole in one PDU are delivered without further copies
+void rlc_am::reassemble_fragment(byte_buffer_t *frag, bool sdu_end)
+{
+  if(!rx_sdu) {
+    rx_sdu = frag;
+  } else if(frag->N_bytes <= rx_sdu->get_tailroom()) {
+    memcpy(&rx_sdu->msg[rx_sdu->N_bytes], frag->msg, frag->N_bytes);
+    rx_sdu->N_bytes += frag->N_bytes;
+    copied_bytes    += frag->N_bytes;
+    pool->deallocate(frag);
+  } else {
+    log->error("%s Discarding SDU of more than %d bytes\n",
+               rb_id_text[lcid], rx_sdu->N_bytes + frag->N_bytes);
+    pool->deallocate(frag);
+    pool->deallocate(rx_sdu);
+    rx_sdu = NULL;
+    return;
+  }
+
+  if(sdu_end)
+  {
+    log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU", rb_id_text[lcid]);
+    rx_sdu->set_timestamp();
+    pdcp->write_pdu(lcid, rx_sdu);
+    rx_sdu = NULL;
+  }
+}
+
+void rlc_am::free_fragments(byte_buffer_t *frag)
+{
+  while(frag) {
+    byte_buffer_t *next = frag->next;
+    pool->deallocate(frag);
+    frag = next;
+  }
+}
+
 bool rlc_am::inside_tx_window(uint16_t sn)
 {
   if(RX_MOD_BASE(sn) >= RX_MOD_BASE(vt_a) &&
@@ -1114,13 +1140,14 @@ bool rlc_am::add_segment_and_check(rlc_amd_rx_pdu_segments_t *pdu, rlc_amd_rx_pd
   }
 
   handle_data_pdu(full_pdu->msg, full_pdu->N_bytes, header);
+  pool->deallocate(full_pdu);
   return true;
 }
 
 int rlc_am::required_buffer_size(rlc_amd_retx_t retx)
 {
   if(!retx.is_segment){
-    return rlc_am_packed_length(&tx_window[retx.sn].header) + tx_window[retx.sn].buf->N_bytes;
+    return rlc_am_packed_length(&tx_window[retx.sn].header) + tx_window[retx.sn].N_bytes;
   }
 
   // Construct new header
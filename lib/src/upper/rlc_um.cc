@@ -37,6 +37,8 @@ rlc_um::rlc_um() : tx_sdu_queue(16)
   rx_sdu = NULL;
   pool = byte_buffer_pool::get_instance();
 
+  tx_sdu_offset = 0;
+
   pthread_mutex_init(&mutex, NULL);
   
   vt_us    = 0;
@@ -127,17 +129,22 @@ void rlc_um::reset()
   vr_ux    = 0;
   vr_uh    = 0;
   pdu_lost = false;
-  if(rx_sdu)
-    rx_sdu->reset();
-  if(tx_sdu)
-    tx_sdu->reset();
+  if(rx_sdu) {
+    pool->deallocate(rx_sdu);
+    rx_sdu = NULL;
+  }
+  if(tx_sdu) {
+    pool->deallocate(tx_sdu);
+    tx_sdu = NULL;
+  }
+  tx_sdu_offset = 0;
   if(mac_timers)
     mac_timers->get(reordering_timeout_id)->stop();
   
   // Drop all messages in RX window
   std::map<uint32_t, rlc_umd_pdu_t>::iterator it;
   for(it = rx_window.begin(); it != rx_window.end(); it++) {
-    pool->deallocate(it->second.buf);
+    free_fragments(it->second.buf);
   }
   rx_window.clear();
   pthread_mutex_unlock(&mutex);
@@ -175,7 +182,7 @@ uint32_t rlc_um::get_buffer_state()
   if(tx_sdu)
   {
     n_sdus++;
-    n_bytes += tx_sdu->N_bytes;
+    n_bytes += tx_sdu->N_bytes - tx_sdu_offset;
   }
 
   // Room needed for header extensions? (integer rounding)
@@ -226,7 +233,7 @@ void rlc_um::timer_expired(uint32_t timeout_id)
 
     log->warning("Lost PDU SN: %d\n", vr_ur);
     pdu_lost = true;
-    rx_sdu->reset();
+    drop_rx_sdu();
     while(RX_MOD_BASE(vr_ur) < RX_MOD_BASE(vr_ux))
     {
       vr_ur = (vr_ur + 1)%rx_mod;
@@ -264,12 +271,6 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return 0;
   }
 
-  byte_buffer_t *pdu = pool_allocate;
-  if(!pdu || pdu->N_bytes != 0)
-  {
-    log->error("Failed to allocate PDU buffer\n");
-    return 0;
-  }
   rlc_umd_pdu_header_t header;
   header.fi   = RLC_FI_FIELD_START_AND_END_ALIGNED;
   header.sn   = vt_us;
@@ -278,7 +279,12 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   uint32_t to_move   = 0;
   uint32_t last_li   = 0;
-  uint8_t *pdu_ptr   = pdu->msg;
+
+  // The PDU data stays in the SDUs until it is copied to the payload
+  byte_buffer_t *first_sdu  = NULL;
+  byte_buffer_t *last_sdu   = NULL;
+  uint32_t       sdu_offset = 0;
+  uint32_t       data_len   = 0;
 
   int head_len  = rlc_um_packed_length(&header);
   int pdu_space = nof_bytes;
@@ -294,16 +300,18 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   if(tx_sdu)
   {
     uint32_t space = pdu_space-head_len;
-    to_move = space >= tx_sdu->N_bytes ? tx_sdu->N_bytes : space;
+    uint32_t left  = tx_sdu->N_bytes - tx_sdu_offset;
+    to_move = space >= left ? left : space;
     log->debug("%s adding remainder of SDU segment - %d bytes of %d remaining\n",
-               rb_id_text[lcid], to_move, tx_sdu->N_bytes);
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
+               rb_id_text[lcid], to_move, left);
+    pool->add_ref(tx_sdu);
+    first_sdu        = tx_sdu;
+    last_sdu         = tx_sdu;
+    sdu_offset       = tx_sdu_offset;
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
-    tx_sdu->N_bytes -= to_move;
-    tx_sdu->msg     += to_move;
-    if(tx_sdu->N_bytes == 0)
+    data_len        += to_move;
+    tx_sdu_offset   += to_move;
+    if(tx_sdu_offset == tx_sdu->N_bytes)
     {
       log->info("%s Complete SDU scheduled for tx. Stack latency: %ld us\n",
                 rb_id_text[lcid], tx_sdu->get_latency_us());
@@ -322,17 +330,22 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
       header.li[header.N_li++] = last_li;
     head_len = rlc_um_packed_length(&header);
     tx_sdu_queue.read(&tx_sdu);
+    tx_sdu_offset = 0;
+    tx_sdu->next  = NULL;
+    pool->add_ref(tx_sdu);
+    if(last_sdu)
+      last_sdu->next = tx_sdu;
+    else
+      first_sdu = tx_sdu;
+    last_sdu = tx_sdu;
     uint32_t space = pdu_space-head_len;
     to_move = space >= tx_sdu->N_bytes ? tx_sdu->N_bytes : space;
     log->debug("%s adding new SDU segment - %d bytes of %d remaining\n",
                rb_id_text[lcid], to_move, tx_sdu->N_bytes);
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
-    tx_sdu->N_bytes -= to_move;
-    tx_sdu->msg     += to_move;
-    if(tx_sdu->N_bytes == 0)
+    data_len        += to_move;
+    tx_sdu_offset   += to_move;
+    if(tx_sdu_offset == tx_sdu->N_bytes)
     {
       log->info("%s Complete SDU scheduled for tx. Stack latency: %ld us\n",
                 rb_id_text[lcid], tx_sdu->get_latency_us());
@@ -349,13 +362,13 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   header.sn = vt_us;
   vt_us = (vt_us + 1)%tx_mod;
 
-  // Add header and TX
-  log->debug("%s packing PDU with length %d\n", rb_id_text[lcid], pdu->N_bytes);
-  rlc_um_write_data_pdu_header(&header, pdu);
-  memcpy(payload, pdu->msg, pdu->N_bytes);
-  uint32_t ret = pdu->N_bytes;
-  log->debug("%sreturning length %d\n", rb_id_text[lcid], pdu->N_bytes);
-  pool->deallocate(pdu);
+  // Write header and gather the SDU data into the payload
+  uint8_t *ptr = payload;
+  rlc_um_write_data_pdu_header(&header, &ptr);
+  rlc_sdu_chain_copy(first_sdu, sdu_offset, data_len, ptr);
+  rlc_sdu_chain_release(pool, first_sdu, sdu_offset, data_len);
+  uint32_t ret = (ptr-payload) + data_len;
+  log->debug("%s returning length %d\n", rb_id_text[lcid], ret);
 
   debug_state();
   return ret;
@@ -385,20 +398,44 @@ void rlc_um::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return;
   }
 
-  // Write to rx window
-  rlc_umd_pdu_t pdu;
-  pdu.buf = pool_allocate;
-  if (!pdu.buf) {
-    log->error("Discarting packet: no space in buffer pool\n");
+  // Strip header from PDU and write to rx window, one buffer per SDU fragment
+  uint32_t header_len = rlc_um_packed_length(&header);
+  if(header_len > nof_bytes) {
+    log->warning("%s Discarding SN: %d shorter than its header\n", rb_id_text[lcid], header.sn);
     return;
   }
-  memcpy(pdu.buf->msg, payload, nof_bytes);
-  pdu.buf->N_bytes = nof_bytes;
-  //Strip header from PDU
-  int header_len = rlc_um_packed_length(&header);
-  pdu.buf->msg += header_len;
-  pdu.buf->N_bytes -= header_len;
+  payload   += header_len;
+  nof_bytes -= header_len;
+
+  rlc_umd_pdu_t pdu;
+  pdu.buf    = NULL;
   pdu.header = header;
+
+  byte_buffer_t **tail   = &pdu.buf;
+  uint32_t        offset = 0;
+  for(uint32_t i=0; i<=header.N_li; i++)
+  {
+    uint32_t len = (i < header.N_li) ? header.li[i] : nof_bytes - offset;
+    if(len > nof_bytes - offset) {
+      log->warning("%s Discarding SN: %d with length indicators beyond the PDU\n",
+                   rb_id_text[lcid], header.sn);
+      free_fragments(pdu.buf);
+      return;
+    }
+    // The last fragment may start an SDU completed by later PDUs, which get appended to it
+    byte_buffer_t *frag = (i == header.N_li && !rlc_um_end_aligned(header.fi)) ? pool_allocate : pool_allocate_bytes(len);
+    if (!frag) {
+      log->error("Discarting packet: no space in buffer pool\n");
+      free_fragments(pdu.buf);
+      return;
+    }
+    memcpy(frag->msg, &payload[offset], len);
+    frag->N_bytes = len;
+    frag->next    = NULL;
+    *tail   = frag;
+    tail    = &frag->next;
+    offset += len;
+  }
   rx_window[header.sn] = pdu;
   
   // Update vr_uh
@@ -434,59 +471,14 @@ void rlc_um::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes)
 
 void rlc_um::reassemble_rx_sdus()
 {
-  if(!rx_sdu)
-    rx_sdu = pool_allocate;
-
   // First catch up with lower edge of reordering window
   while(!inside_reordering_window(vr_ur))
   {
     if(rx_window.end() == rx_window.find(vr_ur))
     {
-      rx_sdu->reset();
+      drop_rx_sdu();
     }else{
-      // Handle any SDU segments
-      for(uint32_t i=0; i<rx_window[vr_ur].header.N_li; i++)
-      {
-        int len = rx_window[vr_ur].header.li[i];
-        memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_ur].buf->msg, len);
-        rx_sdu->N_bytes += len;
-        rx_window[vr_ur].buf->msg += len;
-        rx_window[vr_ur].buf->N_bytes -= len;
-        if((pdu_lost && !rlc_um_start_aligned(rx_window[vr_ur].header.fi)) || (vr_ur != ((vr_ur_in_rx_sdu+1)%rx_mod))) {
-          log->warning("Dropping remainder of lost PDU (lower edge middle segments, vr_ur=%d, vr_ur_in_rx_sdu=%d)\n", vr_ur, vr_ur_in_rx_sdu);
-          rx_sdu->reset();
-        } else {
-          log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU vr_ur=%d, i=%d (lower edge middle segments)", rb_id_text[lcid], vr_ur, i);
-          rx_sdu->set_timestamp();
-          pdcp->write_pdu(lcid, rx_sdu);
-          rx_sdu = pool_allocate;
-        }
-        pdu_lost = false;
-      }
-
-      // Handle last segment
-      memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_ur].buf->msg, rx_window[vr_ur].buf->N_bytes);
-      rx_sdu->N_bytes += rx_window[vr_ur].buf->N_bytes;
-      log->debug("Writting last segment in SDU buffer. Lower edge vr_ur=%d, Buffer size=%d, segment size=%d\n", 
-               vr_ur, rx_sdu->N_bytes, rx_window[vr_ur].buf->N_bytes);
-      vr_ur_in_rx_sdu = vr_ur; 
-      if(rlc_um_end_aligned(rx_window[vr_ur].header.fi))
-      {
-        if(pdu_lost && !rlc_um_start_aligned(rx_window[vr_ur].header.fi)) {
-          log->warning("Dropping remainder of lost PDU (lower edge last segments)\n");
-          rx_sdu->reset();          
-        } else {
-          log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU vr_ur=%d (lower edge last segments)", rb_id_text[lcid], vr_ur);
-          rx_sdu->set_timestamp();
-          pdcp->write_pdu(lcid, rx_sdu);
-          rx_sdu = pool_allocate;
-        }
-        pdu_lost = false;
-      }
-
-      // Clean up rx_window
-      pool->deallocate(rx_window[vr_ur].buf);
-      rx_window.erase(vr_ur);
+      reassemble_pdu("lower edge");
     }
 
     vr_ur = (vr_ur + 1)%rx_mod;
@@ -496,53 +488,94 @@ void rlc_um::reassemble_rx_sdus()
   // Now update vr_ur until we reach an SN we haven't yet received
   while(rx_window.end() != rx_window.find(vr_ur))
   {
-    // Handle any SDU segments
-    for(uint32_t i=0; i<rx_window[vr_ur].header.N_li; i++)
-    {
-      int len = rx_window[vr_ur].header.li[i];
-      memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_ur].buf->msg, len);
-      log->debug("Concatenating %d bytes in to current length %d. rx_window remaining bytes=%d, vr_ur_in_rx_sdu=%d, vr_ur=%d, rx_mod=%d, last_mod=%d\n",
-        len, rx_sdu->N_bytes, rx_window[vr_ur].buf->N_bytes, vr_ur_in_rx_sdu, vr_ur, rx_mod, (vr_ur_in_rx_sdu+1)%rx_mod);
-      rx_sdu->N_bytes += len;      
-      rx_window[vr_ur].buf->msg += len;
-      rx_window[vr_ur].buf->N_bytes -= len;
-      if((pdu_lost && !rlc_um_start_aligned(rx_window[vr_ur].header.fi)) || (vr_ur != ((vr_ur_in_rx_sdu+1)%rx_mod))) {
-        log->warning("Dropping remainder of lost PDU (update vr_ur middle segments, vr_ur=%d, vr_ur_in_rx_sdu=%d)\n", vr_ur, vr_ur_in_rx_sdu);
-        rx_sdu->reset();
-      } else {
-        log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU vr_ur=%d, i=%d, (update vr_ur middle segments)", rb_id_text[lcid], vr_ur, i);
-        rx_sdu->set_timestamp();
-        pdcp->write_pdu(lcid, rx_sdu);
-        rx_sdu = pool_allocate;
-      }
-      pdu_lost = false;
+    reassemble_pdu("update vr_ur");
+
+    vr_ur = (vr_ur + 1)%rx_mod;
+  }
+}
+
+// Reassembles the PDU at vr_ur and removes it from the rx window
+void rlc_um::reassemble_pdu(const char *stage)
+{
+  rlc_umd_pdu_t &pdu  = rx_window[vr_ur];
+  byte_buffer_t *frag = pdu.buf;
+
+  // Handle any SDU segments
+  for(uint32_t i=0; i<pdu.header.N_li; i++)
+  {
+    byte_buffer_t *next = frag->next;
+    frag->next = NULL;
+    log->debug("Concatenating %d bytes in to current length %d. vr_ur_in_rx_sdu=%d, vr_ur=%d, rx_mod=%d, last_mod=%d\n",
+      frag->N_bytes, rx_sdu?rx_sdu->N_bytes:0, vr_ur_in_rx_sdu, vr_ur, rx_mod, (vr_ur_in_rx_sdu+1)%rx_mod);
+    append_rx_sdu(frag);
+    frag = next;
+    if((pdu_lost && !rlc_um_start_aligned(pdu.header.fi)) || (vr_ur != ((vr_ur_in_rx_sdu+1)%rx_mod))) {
+      log->warning("Dropping remainder of lost PDU (%s middle segments, vr_ur=%d, vr_ur_in_rx_sdu=%d)\n", stage, vr_ur, vr_ur_in_rx_sdu);
+      drop_rx_sdu();
+    } else if(rx_sdu) {
+      log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU vr_ur=%d, i=%d (%s middle segments)", rb_id_text[lcid], vr_ur, i, stage);
+      rx_sdu->set_timestamp();
+      pdcp->write_pdu(lcid, rx_sdu);
+      rx_sdu = NULL;
     }
-    
-    // Handle last segment
-    memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_ur].buf->msg, rx_window[vr_ur].buf->N_bytes);
-    rx_sdu->N_bytes += rx_window[vr_ur].buf->N_bytes;
-    log->debug("Writting last segment in SDU buffer. Updating vr_ur=%d, Buffer size=%d, segment size=%d\n", 
-               vr_ur, rx_sdu->N_bytes, rx_window[vr_ur].buf->N_bytes);
-    vr_ur_in_rx_sdu = vr_ur; 
-    if(rlc_um_end_aligned(rx_window[vr_ur].header.fi))
-    {
-      if(pdu_lost && !rlc_um_start_aligned(rx_window[vr_ur].header.fi)) {
-        log->warning("Dropping remainder of lost PDU (update vr_ur last segments)\n");
-        rx_sdu->reset();
-      } else {
-        log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU vr_ur=%d (update vr_ur last segments)", rb_id_text[lcid], vr_ur);
-        rx_sdu->set_timestamp();
-        pdcp->write_pdu(lcid, rx_sdu);
-        rx_sdu = pool_allocate;
-      }
-      pdu_lost = false;
+    pdu_lost = false;
+  }
+
+  // Handle last segment
+  log->debug("Writting last segment in SDU buffer. %s vr_ur=%d, Buffer size=%d, segment size=%d\n",
+             stage, vr_ur, rx_sdu?rx_sdu->N_bytes:0, frag->N_bytes);
+  append_rx_sdu(frag);
+  vr_ur_in_rx_sdu = vr_ur; 
+  if(rlc_um_end_aligned(pdu.header.fi))
+  {
+    if(pdu_lost && !rlc_um_start_aligned(pdu.header.fi)) {
+      log->warning("Dropping remainder of lost PDU (%s last segments)\n", stage);
+      drop_rx_sdu();
+    } else if(rx_sdu) {
+      log->info_hex(rx_sdu->msg, rx_sdu->N_bytes, "%s Rx SDU vr_ur=%d (%s last segments)", rb_id_text[lcid], vr_ur, stage);
+      rx_sdu->set_timestamp();
+      pdcp->write_pdu(lcid, rx_sdu);
+      rx_sdu = NULL;
     }
+    pdu_lost = false;
+  }
+
+  // Clean up rx_window
+  rx_window.erase(vr_ur);
+}
 
-    // Clean up rx_window
-    pool->deallocate(rx_window[vr_ur].buf);
-    rx_window.erase(vr_ur);
+// A fragment starting an SDU becomes the SDU buffer and the rest are appended to it, so
+// SDUs carried whole in one PDU are delivered without further copies
+void rlc_um::append_rx_sdu(byte_buffer_t *frag)
+{
+  if(!rx_sdu) {
+    rx_sdu = frag;
+  } else if(frag->N_bytes <= rx_sdu->get_tailroom()) {
+    memcpy(&rx_sdu->msg[rx_sdu->N_bytes], frag->msg, frag->N_bytes);
+    rx_sdu->N_bytes += frag->N_bytes;
+    pool->deallocate(frag);
+  } else {
+    log->error("%s Discarding SDU of more than %d bytes\n",
+               rb_id_text[lcid], rx_sdu->N_bytes + frag->N_bytes);
+    pool->deallocate(frag);
+    drop_rx_sdu();
+  }
+}
 
-    vr_ur = (vr_ur + 1)%rx_mod;
+void rlc_um::drop_rx_sdu()
+{
+  if(rx_sdu) {
+    pool->deallocate(rx_sdu);
+    rx_sdu = NULL;
+  }
+}
+
+void rlc_um::free_fragments(byte_buffer_t *frag)
+{
+  while(frag) {
+    byte_buffer_t *next = frag->next;
+    pool->deallocate(frag);
+    frag = next;
   }
 }
 
@@ -623,13 +656,21 @@ void rlc_um_read_data_pdu_header(uint8_t *payload, uint32_t nof_bytes, rlc_umd_s
 
 void rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, byte_buffer_t *pdu)
 {
-  uint32_t i;
-  uint8_t ext = (header->N_li > 0) ? 1 : 0;
-
   // Make room for the header
   uint32_t len = rlc_um_packed_length(header);
   pdu->msg -= len;
   uint8_t *ptr = pdu->msg;
+  rlc_um_write_data_pdu_header(header, &ptr);
+  pdu->N_bytes += ptr-pdu->msg;
+}
+
+// Write header to pointer & move pointer
+void rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, uint8_t **payload)
+{
+  uint32_t i;
+  uint8_t ext = (header->N_li > 0) ? 1 : 0;
+
+  uint8_t *ptr = *payload;
 
   // Fixed part
   if(RLC_UMD_SN_SIZE_5_BITS == header->sn_size)
@@ -672,7 +713,7 @@ void rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, byte_buffer_t *p
   if(header->N_li%2 == 1)
     ptr++;
 
-  pdu->N_bytes += ptr-pdu->msg;
+  *payload = ptr;
 }
 
 uint32_t rlc_um_packed_length(rlc_umd_pdu_header_t *header)
@@ -0,0 +1,397 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* ASN.1 codec benchmark. Encodes and decodes the RRC and S1AP messages exchanged
+ * during an attach, including the conversion to and from the byte buffers handed
+ * to PDCP and SCTP, and reports the number of messages per second for each.
+ * Every message must decode and re-encode to the same bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/asn1/liblte_rrc.h"
+#include "srslte/asn1/liblte_s1ap.h"
+
+uint32_t nof_iterations = 10000;
+bool     verbose        = false;
+
+void usage(char *prog) {
+  printf("Usage: %s [nv]\n", prog);
+  printf("\t-n number of iterations per message [Default %d]\n", nof_iterations);
+  printf("\t-v print the encoded messages\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nv")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_iterations = atoi(argv[optind]);
+      break;
+    case 'v':
+      verbose = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+// NAS Attach Accept carried in the RRC Connection Reconfiguration
+uint32_t attach_accept_len = 73;
+uint8_t  attach_accept[]   = {0x27, 0x4f, 0xab, 0xef, 0x59, 0x01, 0x07, 0x42,
+                              0x01, 0x49, 0x06, 0x40, 0x00, 0xf1, 0x10, 0x31,
+                              0x32, 0x00, 0x22, 0x52, 0x01, 0xc1, 0x05, 0x07,
+                              0xff, 0xff, 0xff, 0xff, 0x0c, 0x0b, 0x76, 0x7a,
+                              0x77, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x65,
+                              0x74, 0x05, 0x01, 0x0e, 0x0e, 0x0e, 0x01, 0x5e,
+                              0x04, 0xfe, 0xfe, 0x81, 0x4e, 0x50, 0x0b, 0xf6,
+                              0x00, 0xf1, 0x10, 0x00, 0x02, 0x01, 0x01, 0x00,
+                              0x00, 0x62, 0x17, 0x2c, 0x59, 0x49, 0x64, 0x01,
+                              0x03};
+
+// NAS Attach Request carried in the UL Information Transfer and the InitialUEMessage
+uint32_t nas_len = 54;
+uint8_t  nas[]   = {0x07, 0x41, 0x71, 0x08, 0x39, 0x01, 0x10, 0x00,
+                    0x00, 0x00, 0x00, 0x10, 0x02, 0xe0, 0xe0, 0x00,
+                    0x1f, 0x02, 0x01, 0xd0, 0x11, 0x27, 0x1a, 0x80,
+                    0x80, 0x21, 0x10, 0x01, 0x00, 0x00, 0x10, 0x81,
+                    0x06, 0x00, 0x00, 0x00, 0x00, 0x83, 0x06, 0x00,
+                    0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0a,
+                    0x00, 0x52, 0x00, 0xf1, 0x10, 0x00};
+
+/* Each message type is benchmarked through a pair of functions converting between
+ * the encoded bytes and the message struct, exactly as done by the RRC and S1AP layers.
+ */
+typedef struct {
+  const char *name;
+  void       *msg;
+  bool      (*encode)(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes);
+  bool      (*decode)(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg);
+} bench_msg_t;
+
+LIBLTE_BIT_MSG_STRUCT bit_buf;
+
+bool encode_bcch_bch(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes) {
+  bool ret = liblte_rrc_pack_bcch_bch_msg((LIBLTE_RRC_MIB_STRUCT*) msg, &bit_buf) == LIBLTE_SUCCESS;
+  bytes->N_bytes = liblte_pack(&bit_buf, bytes->msg);
+  return ret;
+}
+bool decode_bcch_bch(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg) {
+  liblte_unpack(bytes->msg, bytes->N_bytes, &bit_buf);
+  return liblte_rrc_unpack_bcch_bch_msg(&bit_buf, (LIBLTE_RRC_MIB_STRUCT*) msg) == LIBLTE_SUCCESS;
+}
+bool encode_ul_ccch(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes) {
+  bool ret = liblte_rrc_pack_ul_ccch_msg((LIBLTE_RRC_UL_CCCH_MSG_STRUCT*) msg, &bit_buf) == LIBLTE_SUCCESS;
+  bytes->N_bytes = liblte_pack(&bit_buf, bytes->msg);
+  return ret;
+}
+bool decode_ul_ccch(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg) {
+  liblte_unpack(bytes->msg, bytes->N_bytes, &bit_buf);
+  return liblte_rrc_unpack_ul_ccch_msg(&bit_buf, (LIBLTE_RRC_UL_CCCH_MSG_STRUCT*) msg) == LIBLTE_SUCCESS;
+}
+bool encode_dl_ccch(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes) {
+  bool ret = liblte_rrc_pack_dl_ccch_msg((LIBLTE_RRC_DL_CCCH_MSG_STRUCT*) msg, &bit_buf) == LIBLTE_SUCCESS;
+  bytes->N_bytes = liblte_pack(&bit_buf, bytes->msg);
+  return ret;
+}
+bool decode_dl_ccch(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg) {
+  liblte_unpack(bytes->msg, bytes->N_bytes, &bit_buf);
+  return liblte_rrc_unpack_dl_ccch_msg(&bit_buf, (LIBLTE_RRC_DL_CCCH_MSG_STRUCT*) msg) == LIBLTE_SUCCESS;
+}
+bool encode_ul_dcch(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes) {
+  bool ret = liblte_rrc_pack_ul_dcch_msg((LIBLTE_RRC_UL_DCCH_MSG_STRUCT*) msg, &bit_buf) == LIBLTE_SUCCESS;
+  bytes->N_bytes = liblte_pack(&bit_buf, bytes->msg);
+  return ret;
+}
+bool decode_ul_dcch(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg) {
+  liblte_unpack(bytes->msg, bytes->N_bytes, &bit_buf);
+  return liblte_rrc_unpack_ul_dcch_msg(&bit_buf, (LIBLTE_RRC_UL_DCCH_MSG_STRUCT*) msg) == LIBLTE_SUCCESS;
+}
+bool encode_dl_dcch(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes) {
+  bool ret = liblte_rrc_pack_dl_dcch_msg((LIBLTE_RRC_DL_DCCH_MSG_STRUCT*) msg, &bit_buf) == LIBLTE_SUCCESS;
+  bytes->N_bytes = liblte_pack(&bit_buf, bytes->msg);
+  return ret;
+}
+bool decode_dl_dcch(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg) {
+  liblte_unpack(bytes->msg, bytes->N_bytes, &bit_buf);
+  return liblte_rrc_unpack_dl_dcch_msg(&bit_buf, (LIBLTE_RRC_DL_DCCH_MSG_STRUCT*) msg) == LIBLTE_SUCCESS;
+}
+bool encode_s1ap(void *msg, LIBLTE_BYTE_MSG_STRUCT *bytes) {
+  return liblte_s1ap_pack_s1ap_pdu((LIBLTE_S1AP_S1AP_PDU_STRUCT*) msg, bytes) == LIBLTE_SUCCESS;
+}
+bool decode_s1ap(LIBLTE_BYTE_MSG_STRUCT *bytes, void *msg) {
+  return liblte_s1ap_unpack_s1ap_pdu(bytes, (LIBLTE_S1AP_S1AP_PDU_STRUCT*) msg) == LIBLTE_SUCCESS;
+}
+
+void fill_mib(LIBLTE_RRC_MIB_STRUCT *mib) {
+  mib->dl_bw            = LIBLTE_RRC_DL_BANDWIDTH_50;
+  mib->phich_config.dur = LIBLTE_RRC_PHICH_DURATION_NORMAL;
+  mib->phich_config.res = LIBLTE_RRC_PHICH_RESOURCE_1;
+  mib->sfn_div_4        = 123;
+}
+
+void fill_con_request(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg) {
+  ul_ccch_msg->msg_type                    = LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REQ;
+  ul_ccch_msg->msg.rrc_con_req.ue_id_type  = LIBLTE_RRC_CON_REQ_UE_ID_TYPE_RANDOM_VALUE;
+  ul_ccch_msg->msg.rrc_con_req.ue_id.random = 1000;
+  ul_ccch_msg->msg.rrc_con_req.cause       = LIBLTE_RRC_CON_REQ_EST_CAUSE_MO_SIGNALLING;
+}
+
+// Same contents as the RRC Connection Setup sent by srsENB with the default configuration
+void fill_con_setup(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg) {
+  bzero(dl_ccch_msg, sizeof(LIBLTE_RRC_DL_CCCH_MSG_STRUCT));
+  dl_ccch_msg->msg_type = LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP;
+  dl_ccch_msg->msg.rrc_con_setup.rrc_transaction_id = 1;
+
+  LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT *rr_cfg = &dl_ccch_msg->msg.rrc_con_setup.rr_cnfg;
+  rr_cfg->srb_to_add_mod_list_size = 1;
+  rr_cfg->srb_to_add_mod_list[0].srb_id = 1;
+  rr_cfg->srb_to_add_mod_list[0].lc_cnfg_present = true;
+  rr_cfg->srb_to_add_mod_list[0].lc_default_cnfg_present  = true;
+  rr_cfg->srb_to_add_mod_list[0].rlc_cnfg_present = true;
+  rr_cfg->srb_to_add_mod_list[0].rlc_default_cnfg_present = true;
+
+  rr_cfg->mac_main_cnfg_present = true;
+  LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT *mac_cfg = &rr_cfg->mac_main_cnfg.explicit_value;
+  mac_cfg->ulsch_cnfg_present = true;
+  mac_cfg->ulsch_cnfg.max_harq_tx_present        = true;
+  mac_cfg->ulsch_cnfg.max_harq_tx                = LIBLTE_RRC_MAX_HARQ_TX_N4;
+  mac_cfg->ulsch_cnfg.periodic_bsr_timer_present = true;
+  mac_cfg->ulsch_cnfg.periodic_bsr_timer         = LIBLTE_RRC_PERIODIC_BSR_TIMER_SF20;
+  mac_cfg->ulsch_cnfg.retx_bsr_timer             = LIBLTE_RRC_RETRANSMISSION_BSR_TIMER_SF320;
+  mac_cfg->phr_cnfg_present = true;
+  mac_cfg->phr_cnfg.setup_present      = true;
+  mac_cfg->phr_cnfg.periodic_phr_timer = LIBLTE_RRC_PERIODIC_PHR_TIMER_SF20;
+  mac_cfg->phr_cnfg.prohibit_phr_timer = LIBLTE_RRC_PROHIBIT_PHR_TIMER_SF20;
+  mac_cfg->phr_cnfg.dl_pathloss_change = LIBLTE_RRC_DL_PATHLOSS_CHANGE_DB1;
+  mac_cfg->time_alignment_timer = LIBLTE_RRC_TIME_ALIGNMENT_TIMER_INFINITY;
+
+  rr_cfg->phy_cnfg_ded_present = true;
+  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT *phy_cfg = &rr_cfg->phy_cnfg_ded;
+  phy_cfg->pusch_cnfg_ded_present = true;
+  phy_cfg->pusch_cnfg_ded.beta_offset_ack_idx = 10;
+  phy_cfg->pusch_cnfg_ded.beta_offset_ri_idx  = 5;
+  phy_cfg->pusch_cnfg_ded.beta_offset_cqi_idx = 6;
+  phy_cfg->sched_request_cnfg_present = true;
+  phy_cfg->sched_request_cnfg.setup_present = true;
+  phy_cfg->sched_request_cnfg.dsr_trans_max = LIBLTE_RRC_DSR_TRANS_MAX_N64;
+  phy_cfg->sched_request_cnfg.sr_cnfg_idx           = 35;
+  phy_cfg->sched_request_cnfg.sr_pucch_resource_idx = 2;
+  phy_cfg->ul_pwr_ctrl_ded_present = true;
+  phy_cfg->ul_pwr_ctrl_ded.p0_ue_pusch     = 0;
+  phy_cfg->ul_pwr_ctrl_ded.delta_mcs_en    = LIBLTE_RRC_DELTA_MCS_ENABLED_EN0;
+  phy_cfg->ul_pwr_ctrl_ded.accumulation_en = true;
+  phy_cfg->ul_pwr_ctrl_ded.p0_ue_pucch     = 0;
+  phy_cfg->ul_pwr_ctrl_ded.p_srs_offset    = 3;
+  phy_cfg->pdsch_cnfg_ded_present = true;
+  phy_cfg->pdsch_cnfg_ded = LIBLTE_RRC_PDSCH_CONFIG_P_A_DB_0;
+  phy_cfg->cqi_report_cnfg_present = true;
+  phy_cfg->cqi_report_cnfg.report_periodic_present       = true;
+  phy_cfg->cqi_report_cnfg.report_periodic_setup_present = true;
+  phy_cfg->cqi_report_cnfg.report_periodic.format_ind_periodic     = LIBLTE_RRC_CQI_FORMAT_INDICATOR_PERIODIC_WIDEBAND_CQI;
+  phy_cfg->cqi_report_cnfg.report_periodic.simult_ack_nack_and_cqi = false;
+  phy_cfg->cqi_report_cnfg.report_periodic.pmi_cnfg_idx       = 41;
+  phy_cfg->cqi_report_cnfg.report_periodic.pucch_resource_idx = 1;
+  phy_cfg->cqi_report_cnfg.nom_pdsch_rs_epre_offset = 0;
+}
+
+void fill_ul_info_transfer(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg) {
+  ul_dcch_msg->msg_type                                 = LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_INFO_TRANSFER;
+  ul_dcch_msg->msg.ul_info_transfer.dedicated_info_type = LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_NAS;
+  memcpy(ul_dcch_msg->msg.ul_info_transfer.dedicated_info.msg, nas, nas_len);
+  ul_dcch_msg->msg.ul_info_transfer.dedicated_info.N_bytes = nas_len;
+}
+
+// Same contents as the RRC Connection Reconfiguration sent by srsENB for a QCI 9 bearer
+void fill_con_reconfig(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg) {
+  bzero(dl_dcch_msg, sizeof(LIBLTE_RRC_DL_DCCH_MSG_STRUCT));
+  dl_dcch_msg->msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG;
+  dl_dcch_msg->msg.rrc_con_reconfig.rrc_transaction_id = 2;
+
+  LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *conn_reconf = &dl_dcch_msg->msg.rrc_con_reconfig;
+  conn_reconf->rr_cnfg_ded_present = true;
+
+  conn_reconf->rr_cnfg_ded.srb_to_add_mod_list_size = 1;
+  conn_reconf->rr_cnfg_ded.srb_to_add_mod_list[0].srb_id = 2;
+  conn_reconf->rr_cnfg_ded.srb_to_add_mod_list[0].lc_cnfg_present = true;
+  conn_reconf->rr_cnfg_ded.srb_to_add_mod_list[0].lc_default_cnfg_present  = true;
+  conn_reconf->rr_cnfg_ded.srb_to_add_mod_list[0].rlc_cnfg_present = true;
+  conn_reconf->rr_cnfg_ded.srb_to_add_mod_list[0].rlc_default_cnfg_present = true;
+
+  conn_reconf->rr_cnfg_ded.drb_to_add_mod_list_size = 1;
+  LIBLTE_RRC_DRB_TO_ADD_MOD_STRUCT *drb = &conn_reconf->rr_cnfg_ded.drb_to_add_mod_list[0];
+  drb->drb_id                = 1;
+  drb->lc_id                 = 3;
+  drb->lc_id_present         = true;
+  drb->eps_bearer_id         = 5;
+  drb->eps_bearer_id_present = true;
+  drb->lc_cnfg_present = true;
+  drb->lc_cnfg.ul_specific_params_present = true;
+  drb->lc_cnfg.ul_specific_params.priority               = 11;
+  drb->lc_cnfg.ul_specific_params.prioritized_bit_rate   = LIBLTE_RRC_PRIORITIZED_BIT_RATE_INFINITY;
+  drb->lc_cnfg.ul_specific_params.bucket_size_duration   = LIBLTE_RRC_BUCKET_SIZE_DURATION_MS100;
+  drb->lc_cnfg.ul_specific_params.log_chan_group         = 3;
+  drb->lc_cnfg.ul_specific_params.log_chan_group_present = true;
+  drb->pdcp_cnfg_present = true;
+  drb->pdcp_cnfg.discard_timer_present = true;
+  drb->pdcp_cnfg.discard_timer         = LIBLTE_RRC_DISCARD_TIMER_INFINITY;
+  drb->pdcp_cnfg.rlc_am_status_report_required_present = true;
+  drb->pdcp_cnfg.rlc_am_status_report_required         = false;
+  drb->rlc_cnfg_present = true;
+  drb->rlc_cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
+  drb->rlc_cnfg.ul_am_rlc.t_poll_retx       = LIBLTE_RRC_T_POLL_RETRANSMIT_MS45;
+  drb->rlc_cnfg.ul_am_rlc.poll_pdu          = LIBLTE_RRC_POLL_PDU_P4;
+  drb->rlc_cnfg.ul_am_rlc.poll_byte         = LIBLTE_RRC_POLL_BYTE_KB25;
+  drb->rlc_cnfg.ul_am_rlc.max_retx_thresh   = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
+  drb->rlc_cnfg.dl_am_rlc.t_reordering      = LIBLTE_RRC_T_REORDERING_MS35;
+  drb->rlc_cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS0;
+
+  conn_reconf->N_ded_info_nas = 1;
+  memcpy(conn_reconf->ded_info_nas_list[0].msg, attach_accept, attach_accept_len);
+  conn_reconf->ded_info_nas_list[0].N_bytes = attach_accept_len;
+}
+
+// Same contents as the InitialUEMessage sent by srsENB for MCC 001, MNC 01
+void fill_initial_ue_message(LIBLTE_S1AP_S1AP_PDU_STRUCT *tx_pdu) {
+  bzero(tx_pdu, sizeof(LIBLTE_S1AP_S1AP_PDU_STRUCT));
+  tx_pdu->ext          = false;
+  tx_pdu->choice_type  = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &tx_pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALUEMESSAGE;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALUEMESSAGE;
+
+  LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT *initue = &init->choice.InitialUEMessage;
+  initue->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  memcpy(initue->NAS_PDU.buffer, nas, nas_len);
+  initue->NAS_PDU.n_octets = nas_len;
+
+  uint8_t plmn[3] = {0x00, 0xf1, 0x10};
+  memcpy(initue->TAI.pLMNidentity.buffer, plmn, 3);
+  initue->TAI.tAC.buffer[0] = 0x00;
+  initue->TAI.tAC.buffer[1] = 0x07;
+
+  // eNB ID 0x19B followed by cell ID 0x01, one bit per byte
+  memcpy(initue->EUTRAN_CGI.pLMNidentity.buffer, plmn, 3);
+  uint32_t cell_identity = (0x19B << 8) | 0x01;
+  for (uint32_t i=0;i<LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN;i++) {
+    initue->EUTRAN_CGI.cell_ID.buffer[i] = (cell_identity >> (LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN-1-i)) & 1;
+  }
+
+  initue->RRC_Establishment_Cause.ext = false;
+  initue->RRC_Establishment_Cause.e   = LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_MO_SIGNALLING;
+}
+
+double elapsed_usec(struct timeval *t) {
+  return (t[1].tv_sec - t[0].tv_sec)*1e6 + (t[1].tv_usec - t[0].tv_usec);
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  LIBLTE_RRC_MIB_STRUCT         mib;
+  LIBLTE_RRC_UL_CCCH_MSG_STRUCT ul_ccch_msg;
+  LIBLTE_RRC_DL_CCCH_MSG_STRUCT dl_ccch_msg;
+  LIBLTE_RRC_UL_DCCH_MSG_STRUCT ul_dcch_msg;
+  LIBLTE_RRC_DL_DCCH_MSG_STRUCT dl_dcch_msg;
+  LIBLTE_S1AP_S1AP_PDU_STRUCT   s1ap_pdu;
+  LIBLTE_BYTE_MSG_STRUCT        bytes, ref;
+
+  fill_mib(&mib);
+  fill_con_request(&ul_ccch_msg);
+  fill_con_setup(&dl_ccch_msg);
+  fill_ul_info_transfer(&ul_dcch_msg);
+  fill_con_reconfig(&dl_dcch_msg);
+  fill_initial_ue_message(&s1ap_pdu);
+
+  bench_msg_t msgs[] = {
+    {"MIB",              &mib,         encode_bcch_bch, decode_bcch_bch},
+    {"RRCConReq",        &ul_ccch_msg, encode_ul_ccch,  decode_ul_ccch},
+    {"RRCConSetup",      &dl_ccch_msg, encode_dl_ccch,  decode_dl_ccch},
+    {"ULInfoTransfer",   &ul_dcch_msg, encode_ul_dcch,  decode_ul_dcch},
+    {"RRCConReconfig",   &dl_dcch_msg, encode_dl_dcch,  decode_dl_dcch},
+    {"InitialUEMessage", &s1ap_pdu,    encode_s1ap,     decode_s1ap},
+  };
+  uint32_t nof_msgs = sizeof(msgs)/sizeof(bench_msg_t);
+  int      nof_errors = 0;
+
+  printf("%-18s %6s %12s %12s\n", "Message", "Bytes", "Encode/s", "Decode/s");
+  for (uint32_t i=0;i<nof_msgs;i++) {
+    struct timeval t[2];
+
+    if (!msgs[i].encode(msgs[i].msg, &ref)) {
+      printf("Error encoding %s\n", msgs[i].name);
+      nof_errors++;
+      continue;
+    }
+    if (verbose) {
+      printf("%s:", msgs[i].name);
+      for (uint32_t j=0;j<ref.N_bytes;j++) {
+        printf(" %02x", ref.msg[j]);
+      }
+      printf("\n");
+    }
+
+    gettimeofday(&t[0], NULL);
+    for (uint32_t n=0;n<nof_iterations;n++) {
+      msgs[i].encode(msgs[i].msg, &bytes);
+    }
+    gettimeofday(&t[1], NULL);
+    double enc_usec = elapsed_usec(t);
+
+    gettimeofday(&t[0], NULL);
+    for (uint32_t n=0;n<nof_iterations;n++) {
+      memcpy(bytes.msg, ref.msg, ref.N_bytes);
+      bytes.N_bytes = ref.N_bytes;
+      msgs[i].decode(&bytes, msgs[i].msg);
+    }
+    gettimeofday(&t[1], NULL);
+    double dec_usec = elapsed_usec(t);
+
+    // The decoded message must encode back to the same bytes
+    if (!msgs[i].encode(msgs[i].msg, &bytes) ||
+        bytes.N_bytes != ref.N_bytes || memcmp(bytes.msg, ref.msg, ref.N_bytes))
+    {
+      printf("Error %s does not re-encode to the same %d bytes\n", msgs[i].name, ref.N_bytes);
+      nof_errors++;
+    }
+
+    printf("%-18s %6d %12.0f %12.0f\n", msgs[i].name, ref.N_bytes,
+           enc_usec>0?1e6*nof_iterations/enc_usec:0, dec_usec>0?1e6*nof_iterations/dec_usec:0);
+  }
+
+  if (nof_errors) {
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,203 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Allocates and deallocates buffers concurrently from NTHREADS threads and reports
+ * the number of allocate/deallocate pairs per second. Each thread writes its id in
+ * the buffers it holds and checks it before deallocating them, which fails if a
+ * buffer is given to two threads at the same time. Buffers cached by the threads
+ * must be back in the shared pools once they have exited.
+ */
+
+#define NTHREADS 8
+#define NROUNDS  200000
+#define NBURST   8
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "srslte/common/buffer_pool.h"
+
+using namespace srslte;
+
+typedef struct {
+  uint32_t                    id;
+  uint32_t                    nof_rounds;
+  byte_buffer_pool           *byte_pool;
+  buffer_pool<byte_buffer_t> *pool;
+  bool                        error;
+} args_t;
+
+void* alloc_thread(void *a) {
+  args_t *args = (args_t*) a;
+  byte_buffer_t *b[NBURST];
+  for (uint32_t r=0;r<args->nof_rounds;r++) {
+    for (uint32_t i=0;i<NBURST;i++) {
+      b[i] = args->byte_pool?args->byte_pool->allocate():args->pool->allocate();
+      if (!b[i]) {
+        args->error = true;
+        return NULL;
+      }
+      memcpy(b[i]->msg, &args->id, sizeof(uint32_t));
+      b[i]->N_bytes = sizeof(uint32_t);
+    }
+    for (uint32_t i=0;i<NBURST;i++) {
+      uint32_t id;
+      memcpy(&id, b[i]->msg, sizeof(uint32_t));
+      if (id != args->id) {
+        args->error = true;
+      }
+      if (args->byte_pool) {
+        args->byte_pool->deallocate(b[i]);
+      } else if (!args->pool->deallocate(b[i])) {
+        args->error = true;
+      }
+    }
+  }
+  return NULL;
+}
+
+// Buffers of any size class must fit the requested number of bytes after the headroom,
+// plus a 4 byte MAC-I trailer. IP packets of the default MTU must not take a full-size buffer.
+bool test_size_classes(byte_buffer_pool *byte_pool) {
+  uint32_t sizes[] = {1, 100, 176, 177, 1000, 1500, 1520, 1521, 5000,
+                      SRSLTE_MAX_BUFFER_SIZE_BYTES-SRSLTE_BUFFER_HEADER_OFFSET-16};
+  for (uint32_t i=0;i<sizeof(sizes)/sizeof(uint32_t);i++) {
+    byte_buffer_t *b = byte_pool->allocate_bytes(sizes[i]);
+    if (!b || b->get_tailroom() < sizes[i]+4) {
+      printf("Error allocating buffer of %d bytes\n", sizes[i]);
+      return false;
+    }
+    if (sizes[i] <= 1500 && b->get_buffer_size() >= SRSLTE_MAX_BUFFER_SIZE_BYTES) {
+      printf("Error buffer of %d bytes taken from the full-size class\n", sizes[i]);
+      return false;
+    }
+    memset(b->msg, 0xff, sizes[i]);
+    b->N_bytes = sizes[i];
+    byte_pool->deallocate(b);
+  }
+  return true;
+}
+
+// A buffer is only reused for a larger message if it has room for it and is not shared
+bool test_reallocate(byte_buffer_pool *byte_pool) {
+  byte_buffer_t *b = byte_pool->allocate_bytes(100);
+  b->N_bytes = 100;
+  byte_buffer_t *r = byte_pool->reallocate(b, 50);
+  bool ok = r == b && r->N_bytes == 0;
+  r = byte_pool->reallocate(r, 1000);
+  if (!r || r->get_tailroom() < 1000) {
+    printf("Error reallocating buffers\n");
+    return false;
+  }
+  byte_pool->add_ref(r);
+  byte_buffer_t *s = byte_pool->reallocate(r, 10);
+  ok &= s && s != r && s->get_tailroom() >= 10;
+  byte_pool->deallocate(r);
+  byte_pool->deallocate(s);
+  if (!ok) {
+    printf("Error reallocating buffers\n");
+  }
+  return ok;
+}
+
+// A buffer that does not belong to the pool must not be taken into it
+bool test_foreign_buffer(byte_buffer_pool *byte_pool) {
+  inline_byte_buffer_t foreign;
+  uint32_t      available = byte_pool->nof_available_buffers();
+  byte_pool->deallocate(&foreign);
+  byte_buffer_t *b = byte_pool->allocate();
+  bool ok = b != &foreign && byte_pool->nof_available_buffers() <= available;
+  byte_pool->deallocate(b);
+  if (!ok) {
+    printf("Error a foreign buffer was taken into the pool\n");
+  }
+  return ok;
+}
+
+bool run(const char *name, byte_buffer_pool *byte_pool, buffer_pool<byte_buffer_t> *pool, uint32_t nof_rounds) {
+  pthread_t threads[NTHREADS];
+  args_t    args[NTHREADS];
+  struct timeval t[2];
+  bool error = false;
+
+  gettimeofday(&t[0], NULL);
+  for (uint32_t i=0;i<NTHREADS;i++) {
+    args[i].id         = i;
+    args[i].nof_rounds = nof_rounds;
+    args[i].byte_pool  = byte_pool;
+    args[i].pool       = pool;
+    args[i].error      = false;
+    pthread_create(&threads[i], NULL, &alloc_thread, &args[i]);
+  }
+  for (uint32_t i=0;i<NTHREADS;i++) {
+    pthread_join(threads[i], NULL);
+    error |= args[i].error;
+  }
+  gettimeofday(&t[1], NULL);
+
+  double secs = (t[1].tv_sec - t[0].tv_sec) + 1e-6*(t[1].tv_usec - t[0].tv_usec);
+  printf("%-20s %d threads: %.2f Mops/s%s\n", name, NTHREADS,
+         secs>0?1e-6*NTHREADS*nof_rounds*NBURST/secs:0, error?" ERROR":"");
+  return !error;
+}
+
+int main(int argc, char **argv) {
+  uint32_t nof_rounds = NROUNDS;
+  bool     result     = true;
+
+  if (argc > 1) {
+    nof_rounds = atoi(argv[1]);
+  }
+
+  buffer_pool<byte_buffer_t> *pool = new buffer_pool<byte_buffer_t>(4*NTHREADS*NBURST, SRSLTE_MAX_BUFFER_SIZE_BYTES);
+  result &= run("buffer_pool", NULL, pool, nof_rounds);
+  if (pool->nof_available_buffers() != 4*NTHREADS*NBURST) {
+    printf("Error %d buffers were not returned to the pool\n", 4*NTHREADS*NBURST - pool->nof_available_buffers());
+    result = false;
+  }
+  delete pool;
+
+  byte_buffer_pool *byte_pool = byte_buffer_pool::get_instance();
+  result &= test_size_classes(byte_pool);
+  result &= test_reallocate(byte_pool);
+  result &= test_foreign_buffer(byte_pool);
+  uint32_t available = byte_pool->nof_available_buffers();
+  result &= run("byte_buffer_pool", byte_pool, NULL, nof_rounds);
+  if (byte_pool->nof_available_buffers() != available) {
+    printf("Error %d buffers were left in the caches of exited threads\n",
+           available - byte_pool->nof_available_buffers());
+    result = false;
+  }
+  byte_buffer_pool::cleanup();
+
+  if(result) {
+    printf("Passed\n");
+    exit(0);
+  }else{
+    printf("Failed\n");
+    exit(1);
+  }
+}
@@ -28,6 +28,8 @@
 #define NMSGS    100
 
 #include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
 #include "srslte/common/log_filter.h"
 
 using namespace srslte;
@@ -77,9 +79,9 @@ void* thread_loop_hex(void *a) {
   return NULL;
 }
 
-void write(std::string filename) {
+void write(std::string filename, bool deferred = false) {
   logger l;
-  l.init(filename);
+  l.init(filename, deferred);
   pthread_t threads[NTHREADS];
   args_t    args[NTHREADS];
   for(int i=0;i<NTHREADS;i++) {
@@ -92,11 +94,12 @@ void write(std::string filename) {
   }
 }
 
+// Every message of every thread must be in the file, after the log header
 bool read(std::string filename) {
   bool pass = true;
-  bool written[NTHREADS][NMSGS];
+  static bool written[NTHREADS][NMSGS];
   int thread, msg;
-  int r;
+  char line[256];
 
   for(int i=0;i<NTHREADS;i++) {
     for(int j=0;j<NMSGS;j++) {
@@ -105,8 +108,12 @@ bool read(std::string filename) {
   }
   FILE *f = fopen(filename.c_str(), "r");
   if(f!=NULL) {
-    while(fscanf(f, "Thread %d: %d\n", &thread, &msg)) {
-      written[thread][msg] = true;
+    while(fgets(line, sizeof(line), f)) {
+      char *p = strstr(line, "Thread ");
+      if(p && sscanf(p, "Thread %d: %d", &thread, &msg) == 2 &&
+         thread >= 0 && thread < NTHREADS && msg >= 0 && msg < NMSGS) {
+        written[thread][msg] = true;
+      }
     }
     fclose(f);
   }
@@ -118,17 +125,80 @@ bool read(std::string filename) {
   return pass;
 }
 
+void write_formats(logger *l) {
+  uint8_t hex[100];
+  for(int i=0;i<100;i++)
+    hex[i] = i & 0xFF;
+
+  log_filter filter("FMT ", l, true);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(40);
+  filter.step(1234);
+  filter.info("Integers %d %i %u %x %X %o %c %%\n", -5, 7, 3000000000u, 0xbeef, 0xcafe, 8, 'z');
+  filter.info("Lengths %hhd %hd %ld %lld %lu %llx %zu %hhu\n", 300, 70000, -123456789L, -1234567890123LL,
+              4000000000UL, 0x123456789abULL, (size_t) 42, 511);
+  filter.debug("Widths |%5d|%-5d|%05d|%+d|%*d|%-*d|%.3d|\n", 42, 42, 42, 42, 6, 42, 6, 42, 7);
+  filter.warning("Floats %f %.2f %8.3e %g %G %a %Lf\n", 3.14159, 2.5f, 12345.678, 1e-10, 1e20, 1.0, (long double) 0.5);
+  filter.error("Strings '%s' '%10s' '%-10s' '%.3s' '%.*s' '%s'\n", "abc", "right", "left", "truncate", 2, "star", "");
+  filter.info("Pointer %p\n", (void*) 0x1234);
+  filter.info("No arguments\n");
+  filter.info_hex(hex, 100, "Hex dump without newline");
+  filter.debug_hex(hex, 5, "Hex dump with newline %d\n", 5);
+  filter.set_hex_limit(0);
+  filter.info_hex(hex, 100, "Hex dump disabled %s", "here");
+  filter.info_line("file.cc", 10, "Line %d\n", 10);
+  filter.set_level(LOG_LEVEL_INFO);
+  filter.debug("Not logged\n");
+}
+
+// Removes the timestamp of every line
+std::string strip_times(std::string filename) {
+  std::string s;
+  char line[1024];
+  FILE *f = fopen(filename.c_str(), "r");
+  if(f!=NULL) {
+    while(fgets(line, sizeof(line), f)) {
+      s += (strlen(line) > 15 && line[2] == ':' && line[8] == '.') ? &line[15] : line;
+    }
+    fclose(f);
+  }
+  return s;
+}
+
+// Deferred formatting must produce the same text as formatting in place
+bool compare_formats(std::string f1, std::string f2) {
+  {
+    logger l1, l2;
+    l1.init(f1);
+    l2.init(f2, true);
+    write_formats(&l1);
+    write_formats(&l2);
+  }
+  std::string s1 = strip_times(f1);
+  std::string s2 = strip_times(f2);
+  if (s1 != s2 || s1.empty()) {
+    printf("Formats differ:\n%s\n%s\n", s1.c_str(), s2.c_str());
+    return false;
+  }
+  return true;
+}
+
 int main(int argc, char **argv) {
-  bool result;
+  bool result = true;
   std::string f("log.txt");
+  std::string f2("log_deferred.txt");
   write(f);
-//  result = read(f);
-//  remove(f.c_str());
-//  if(result) {
-//    printf("Passed\n");
-//    exit(0);
-//  }else{
-//    printf("Failed\n;");
-//    exit(1);
-//  }
+  result &= read(f);
+  write(f2, true);
+  result &= read(f2);
+  result &= compare_formats(f, f2);
+  remove(f.c_str());
+  remove(f2.c_str());
+  if(result) {
+    printf("Passed\n");
+    exit(0);
+  }else{
+    printf("Failed\n");
+    exit(1);
+  }
 }
@@ -0,0 +1,144 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/* Measures the CPU time spent in the calling thread per log_filter call, formatting each
+ * message in place (default logger) or in the logger thread (deferred logger).
+ * Reports the number of messages dropped by the deferred logger.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include "srslte/common/log_filter.h"
+
+using namespace srslte;
+
+uint32_t nof_msgs    = 100000;
+uint32_t nof_threads = 4;
+int      hex_limit   = 32;
+
+void usage(char *prog) {
+  printf("Usage: %s [ntx]\n", prog);
+  printf("\t-n number of messages per thread [Default %d]\n", nof_msgs);
+  printf("\t-t number of threads [Default %d]\n", nof_threads);
+  printf("\t-x hex dump limit [Default %d]\n", hex_limit);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ntx")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_msgs = atoi(argv[optind]);
+      break;
+    case 't':
+      nof_threads = atoi(argv[optind]);
+      break;
+    case 'x':
+      hex_limit = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  logger  *l;
+  int      thread_id;
+  bool     hex;
+  double   secs;
+} args_t;
+
+void* thread_loop(void *a) {
+  args_t *args = (args_t*) a;
+  char    name[16];
+  uint8_t payload[128];
+  struct timespec t[2];
+
+  for (int i=0;i<128;i++) {
+    payload[i] = i;
+  }
+  snprintf(name, sizeof(name), "MAC%d", args->thread_id);
+  log_filter filter(name, args->l, true);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(hex_limit);
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t[0]);
+  for (uint32_t i=0;i<nof_msgs;i++) {
+    filter.step(i%10240);
+    if (args->hex) {
+      filter.info_hex(payload, 128, "DL PDU rnti=0x%x, lcid=%d, nof_bytes=%d\n", 0x46 + args->thread_id, 3, 128);
+    } else {
+      filter.debug("SCHED: DL tx rnti=0x%x, pid=%d, mcs=%d, tbs=%.1f kbps, %s\n",
+                   0x46 + args->thread_id, i%8, i%29, 1.5*i, "new");
+    }
+  }
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t[1]);
+  args->secs = (t[1].tv_sec - t[0].tv_sec) + 1e-9*(t[1].tv_nsec - t[0].tv_nsec);
+  return NULL;
+}
+
+void run(bool deferred, bool hex) {
+  pthread_t *threads = new pthread_t[nof_threads];
+  args_t    *args    = new args_t[nof_threads];
+  uint64_t   nof_dropped;
+  double     secs = 0;
+  {
+    logger l;
+    l.init("logger_bench.log", deferred);
+    for (uint32_t i=0;i<nof_threads;i++) {
+      args[i].l         = &l;
+      args[i].thread_id = i;
+      args[i].hex       = hex;
+      pthread_create(&threads[i], NULL, thread_loop, &args[i]);
+    }
+    for (uint32_t i=0;i<nof_threads;i++) {
+      pthread_join(threads[i], NULL);
+      secs += args[i].secs;
+    }
+    nof_dropped = l.get_nof_dropped();
+  }
+  printf("%-8s %-4s: %8.1f ns/call, %llu of %llu messages dropped\n",
+         deferred ? "deferred" : "default", hex ? "hex" : "text",
+         1e9*secs/nof_msgs/nof_threads, (unsigned long long) nof_dropped,
+         (unsigned long long) nof_msgs*nof_threads);
+  delete [] threads;
+  delete [] args;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  run(false, false);
+  run(true,  false);
+  run(false, true);
+  run(true,  true);
+  remove("logger_bench.log");
+  exit(0);
+}
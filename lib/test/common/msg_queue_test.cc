@@ -39,7 +39,7 @@ void* write_thread(void *a) {
   args_t *args = (args_t*)a;
   for(uint32_t i=0;i<NMSGS;i++)
   {
-    byte_buffer_t *b = new byte_buffer_t;
+    byte_buffer_t *b = new inline_byte_buffer_t;
     memcpy(b->msg, &i, 4);
     b->N_bytes = 4;
     args->q->write(b);
@@ -64,7 +64,7 @@ int main(int argc, char **argv) {
   {
     q.read(&b);
     memcpy(&r, b->msg, 4);
-    delete b;
+    delete static_cast<inline_byte_buffer_t*>(b);
     if(r != i)
       result = false;
   }
@@ -0,0 +1,283 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Measures the latency of the hand-offs between the layers with the mutex-based
+ * block_queue and with the lock-free ring queues:
+ *   phy-mac:   several PHY workers push MAC PDUs to the blocking MAC thread (pdu_queue)
+ *   pdcp-rlc:  PDCP writes SDUs that the MAC thread polls from RLC (msg_queue)
+ *   pdcp-gtpu: PDCP writes PDUs that the GTP-U thread sends in batches (gtpu tx_queue)
+ * Producers push bursts of objects tagged with the time they were pushed. The consumer
+ * histograms the time from push to pop in power-of-2 buckets and reports percentiles
+ * and the CPU time per object.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include "srslte/common/block_queue.h"
+#include "srslte/common/ring_queue.h"
+#include "srslte/common/msg_queue.h"
+
+using namespace srslte;
+
+#define MAX_PRODUCERS 8
+#define NOF_BUCKETS   32
+#define BATCH_SIZE    32
+
+uint32_t nof_msgs      = 100000;
+uint32_t nof_producers = 3;
+uint32_t burst         = 4;
+uint32_t period_us     = 50;
+bool     verbose       = false;
+
+void usage(char *prog) {
+  printf("Usage: %s [npbtv]\n", prog);
+  printf("\t-n number of objects per producer [Default %d]\n", nof_msgs);
+  printf("\t-p number of PHY workers [Default %d]\n", nof_producers);
+  printf("\t-b objects per burst [Default %d]\n", burst);
+  printf("\t-t time between bursts in us, 0 to push as fast as possible [Default %d]\n", period_us);
+  printf("\t-v print the latency histograms\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "npbtv")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_msgs = atoi(argv[optind]);
+      break;
+    case 'p':
+      nof_producers = atoi(argv[optind]);
+      break;
+    case 'b':
+      burst = atoi(argv[optind]);
+      break;
+    case 't':
+      period_us = atoi(argv[optind]);
+      break;
+    case 'v':
+      verbose = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (nof_producers < 1 || nof_producers > MAX_PRODUCERS || burst < 1) {
+    usage(argv[0]);
+    exit(-1);
+  }
+}
+
+uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec*1000000000 + t.tv_nsec;
+}
+
+uint64_t cpu_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+  return (uint64_t) t.tv_sec*1000000000 + t.tv_nsec;
+}
+
+class histogram
+{
+public:
+  histogram() : count(0), max(0) {
+    bzero(buckets, sizeof(buckets));
+  }
+  void add(uint64_t ns) {
+    uint32_t b = 0;
+    while (b < NOF_BUCKETS-1 && (ns>>b) > 1) {
+      b++;
+    }
+    buckets[b]++;
+    count++;
+    max = ns > max ? ns : max;
+  }
+  // Upper bound of the bucket holding the given fraction of the samples
+  uint64_t percentile(double p) {
+    uint64_t target = (uint64_t) (p*count);
+    uint64_t acc    = 0;
+    for (uint32_t b=0;b<NOF_BUCKETS;b++) {
+      acc += buckets[b];
+      if (acc > target) {
+        return 2ull<<b;
+      }
+    }
+    return max;
+  }
+  void print(const char *name, uint64_t cpu) {
+    printf("%-10s %-12s %8.0f %8lu %8lu %8lu %10lu\n", name, queue_name, count?(double) cpu/count:0,
+           percentile(0.5), percentile(0.99), percentile(0.999), max);
+  }
+  void print_buckets() {
+    for (uint32_t b=0;b<NOF_BUCKETS;b++) {
+      if (buckets[b]) {
+        printf("    < %8llu ns: %lu\n", 2ull<<b, buckets[b]);
+      }
+    }
+  }
+  const char *queue_name;
+private:
+  uint64_t buckets[NOF_BUCKETS];
+  uint64_t count;
+  uint64_t max;
+};
+
+/* Adapters with a common interface: push(), blocking pop() of up to BATCH_SIZE objects
+ * and non-blocking poll() of one object.
+ */
+struct block_queue_adapter {
+  block_queue<uint64_t> q;
+  block_queue_adapter(uint32_t capacity) {}
+  void push(uint64_t t) { q.push(t); }
+  uint32_t pop(uint64_t *t) {
+    t[0] = q.wait_pop();
+    uint32_t n = 1;
+    while (n < BATCH_SIZE && q.try_pop(&t[n])) {
+      n++;
+    }
+    return n;
+  }
+  bool poll(uint64_t *t) { return q.try_pop(t); }
+};
+
+template<class ring_t>
+struct ring_queue_adapter {
+  ring_t q;
+  ring_queue_adapter(uint32_t capacity) : q(capacity) {}
+  void push(uint64_t t) { q.push(t); }
+  uint32_t pop(uint64_t *t) { return q.wait_pop(t, BATCH_SIZE); }
+  bool poll(uint64_t *t) { return q.try_pop(t); }
+};
+
+struct msg_queue_adapter {
+  msg_queue       q;
+  inline_byte_buffer_t *bufs;
+  uint32_t        capacity;
+  uint32_t        next;
+  msg_queue_adapter(uint32_t capacity_) : q(capacity_), capacity(2*capacity_), next(0) {
+    bufs = new inline_byte_buffer_t[capacity];
+  }
+  ~msg_queue_adapter() {
+    delete [] bufs;
+  }
+  // Single producer, so buffers are recycled in order and never in use when reused
+  void push(uint64_t t) {
+    byte_buffer_t *b = &bufs[next++%capacity];
+    memcpy(b->msg, &t, sizeof(uint64_t));
+    b->N_bytes = sizeof(uint64_t);
+    q.write(b);
+  }
+  uint32_t pop(uint64_t *t) {
+    byte_buffer_t *b;
+    q.read(&b);
+    memcpy(t, b->msg, sizeof(uint64_t));
+    return 1;
+  }
+  bool poll(uint64_t *t) {
+    byte_buffer_t *b;
+    if (!q.try_read(&b)) {
+      return false;
+    }
+    memcpy(t, b->msg, sizeof(uint64_t));
+    return true;
+  }
+};
+
+template<class adapter_t>
+void* producer(void *arg) {
+  adapter_t *a = (adapter_t*) arg;
+  for (uint32_t i=0;i<nof_msgs;i+=burst) {
+    for (uint32_t j=0;j<burst && i+j<nof_msgs;j++) {
+      a->push(now_ns());
+    }
+    if (period_us) {
+      usleep(period_us);
+    }
+  }
+  return NULL;
+}
+
+// The consumer blocks (phy-mac, pdcp-gtpu) or polls once per TTI (pdcp-rlc)
+template<class adapter_t>
+void run(const char *scenario, const char *queue_name, uint32_t producers, bool polling) {
+  adapter_t  a(1024);
+  pthread_t  threads[MAX_PRODUCERS];
+  histogram  h;
+  uint64_t   t[BATCH_SIZE];
+
+  h.queue_name = queue_name;
+  uint64_t cpu = cpu_ns();
+  for (uint32_t p=0;p<producers;p++) {
+    pthread_create(&threads[p], NULL, producer<adapter_t>, &a);
+  }
+  uint32_t total = 0;
+  while (total < producers*nof_msgs) {
+    if (polling) {
+      while (a.poll(&t[0])) {
+        h.add(now_ns() - t[0]);
+        total++;
+      }
+      usleep(1000);
+    } else {
+      uint32_t n   = a.pop(t);
+      uint64_t now = now_ns();
+      for (uint32_t i=0;i<n;i++) {
+        h.add(now - t[i]);
+      }
+      total += n;
+    }
+  }
+  for (uint32_t p=0;p<producers;p++) {
+    pthread_join(threads[p], NULL);
+  }
+  h.print(scenario, cpu_ns() - cpu);
+  if (verbose) {
+    h.print_buckets();
+  }
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  printf("%d objects per producer in bursts of %d every %d us\n", nof_msgs, burst, period_us);
+  printf("%-10s %-12s %8s %8s %8s %8s %10s\n", "hand-off", "queue", "cpu/obj", "p50", "p99", "p99.9", "max (ns)");
+  run<block_queue_adapter>                          ("phy-mac",   "block_queue", nof_producers, false);
+  run<ring_queue_adapter<mpsc_queue<uint64_t> > >   ("phy-mac",   "mpsc_queue",  nof_producers, false);
+  run<block_queue_adapter>                          ("pdcp-rlc",  "block_queue", 1, true);
+  run<msg_queue_adapter>                            ("pdcp-rlc",  "msg_queue",   1, true);
+  run<ring_queue_adapter<spsc_queue<uint64_t> > >   ("pdcp-rlc",  "spsc_queue",  1, true);
+  run<block_queue_adapter>                          ("pdcp-gtpu", "block_queue", 1, false);
+  run<ring_queue_adapter<mpsc_queue<uint64_t> > >   ("pdcp-gtpu", "mpsc_queue",  1, false);
+  exit(0);
+}
@@ -0,0 +1,153 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Several producers push numbered objects, one at a time or in batches of random size,
+ * into a small queue so that both sides block often. The consumer pops in batches of
+ * random size and checks that no object is lost and that the objects of every producer
+ * arrive in order.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "srslte/common/ring_queue.h"
+
+using namespace srslte;
+
+#define MAX_PRODUCERS 8
+#define MAX_BATCH     7
+
+uint32_t nof_msgs = 200000;
+
+template<class queue_t>
+struct producer_args {
+  queue_t  *q;
+  uint32_t  id;
+};
+
+template<class queue_t>
+void* producer(void *a) {
+  producer_args<queue_t> *args = (producer_args<queue_t>*) a;
+  unsigned int seed = args->id;
+  uint32_t i = 0;
+  while (i < nof_msgs) {
+    uint32_t n = 1 + rand_r(&seed)%MAX_BATCH;
+    if (n > nof_msgs - i) {
+      n = nof_msgs - i;
+    }
+    if (n == 1) {
+      args->q->push((args->id<<24) | i);
+      i++;
+    } else {
+      uint32_t batch[MAX_BATCH];
+      for (uint32_t j=0;j<n;j++) {
+        batch[j] = (args->id<<24) | (i + j);
+      }
+      uint32_t sent = 0;
+      while (sent < n) {
+        uint32_t k = args->q->try_push(&batch[sent], n - sent);
+        if (k == 0) {
+          usleep(0);
+        }
+        sent += k;
+      }
+      i += n;
+    }
+  }
+  return NULL;
+}
+
+template<class queue_t>
+bool run(const char *name, uint32_t nof_producers, uint32_t capacity) {
+  queue_t                q(capacity);
+  pthread_t              threads[MAX_PRODUCERS];
+  producer_args<queue_t> args[MAX_PRODUCERS];
+  uint32_t               next[MAX_PRODUCERS];
+  bool                   ok = true;
+
+  for (uint32_t p=0;p<nof_producers;p++) {
+    args[p].q  = &q;
+    args[p].id = p;
+    next[p]    = 0;
+    pthread_create(&threads[p], NULL, producer<queue_t>, &args[p]);
+  }
+
+  unsigned int seed  = 1234;
+  uint32_t     total = 0;
+  while (total < nof_producers*nof_msgs) {
+    uint32_t batch[MAX_BATCH];
+    uint32_t n;
+    if (rand_r(&seed)%2) {
+      n = q.wait_pop(batch, 1 + rand_r(&seed)%MAX_BATCH);
+    } else {
+      n = q.try_pop(batch, 1 + rand_r(&seed)%MAX_BATCH);
+    }
+    for (uint32_t j=0;j<n;j++) {
+      uint32_t p = batch[j]>>24;
+      uint32_t i = batch[j]&0xffffff;
+      if (p >= nof_producers || i != next[p]) {
+        if (ok) {
+          printf("%s: received %d from producer %d, expected %d\n", name, i, p, p<nof_producers?next[p]:0);
+        }
+        ok = false;
+      } else {
+        next[p]++;
+      }
+    }
+    total += n;
+  }
+
+  for (uint32_t p=0;p<nof_producers;p++) {
+    pthread_join(threads[p], NULL);
+  }
+  if (!q.empty() || q.size() != 0) {
+    printf("%s: queue not empty at the end\n", name);
+    ok = false;
+  }
+  printf("%s with %d producers and capacity %d: %s\n", name, nof_producers, q.max_size(), ok?"Ok":"Error");
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1) {
+    nof_msgs = atoi(argv[1]);
+  }
+  bool ok = true;
+  ok &= run<spsc_queue<uint32_t> >("spsc_queue", 1, 8);
+  ok &= run<spsc_queue<uint32_t> >("spsc_queue", 1, 1000);
+  ok &= run<mpsc_queue<uint32_t> >("mpsc_queue", 1, 8);
+  ok &= run<mpsc_queue<uint32_t> >("mpsc_queue", 4, 8);
+  ok &= run<mpsc_queue<uint32_t> >("mpsc_queue", 4, 1000);
+
+  if (!ok) {
+    printf("Failed\n");
+    exit(1);
+  }
+  printf("Passed\n");
+  exit(0);
+}
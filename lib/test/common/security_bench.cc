@@ -0,0 +1,371 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/* Checks EEA1, EIA1, EEA2 and EIA2 against the 33.401 Annex C test sets, the
+ * AES-NI path against the generic one, the reentrant SNOW 3G against the
+ * reference f8/f9 and the reentrant SNOW 3G on several threads at once. Then
+ * measures the throughput of each over batches of PDUs, of the per-call EIA2
+ * that expands the key every time and of the reference f8/f9.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include "srslte/common/security.h"
+#include "srslte/common/snow_3g.h"
+
+using namespace srslte;
+
+uint32_t nof_batches = 2000;
+uint32_t batch_size  = 32;
+
+void usage(char *prog) {
+  printf("Usage: %s [nb]\n", prog);
+  printf("\t-n number of batches per PDU size [Default %d]\n", nof_batches);
+  printf("\t-b PDUs per batch [Default %d]\n", batch_size);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nb")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_batches = atoi(argv[optind]);
+      break;
+    case 'b':
+      batch_size = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+void hex_to_bytes(const char *hex, uint8_t *bytes) {
+  for (uint32_t i=0;i<strlen(hex)/2;i++) {
+    unsigned int b;
+    sscanf(&hex[2*i], "%2x", &b);
+    bytes[i] = b;
+  }
+}
+
+bool check(const char *name, uint8_t *out, const char *expected_hex) {
+  uint8_t expected[64];
+  uint32_t len = strlen(expected_hex)/2;
+  hex_to_bytes(expected_hex, expected);
+  if (memcmp(out, expected, len)) {
+    printf("%s does not match the test set\n", name);
+    return false;
+  }
+  return true;
+}
+
+// 33.401 Annex C.1 and C.3 test set 1
+bool test_vectors_snow3g() {
+  uint8_t key[16];
+  uint8_t msg[32];
+  uint8_t mac[4];
+  bool    ok = true;
+
+  hex_to_bytes("d3c5d592327fb11c4035c6680af8c6d1", key);
+  hex_to_bytes("981ba6824c1bfb1ab485472029b71d808ce33e2cc3c0b5fc1f3de8a6dc66b1f0", msg);
+  security_128_eea1(key, 0x398a59b4, 0x15, 1, msg, 32);
+  ok &= check("EEA1", msg, "5d5bfe75eb04f68ce0a12377ea00b37d47c6a0ba06309155086a859c4341b3");
+
+  hex_to_bytes("2bd6459f82c5b300952c49104881ff48", key);
+  hex_to_bytes("3332346263393861373479", msg);
+  security_128_eia1(key, 0x38a6f056, 0x1f, 0, msg, 11, mac);
+  ok &= check("EIA1", mac, "731f1165");
+  return ok;
+}
+
+// 33.401 Annex C.1 test set 1 and C.2 test set 2
+bool test_vectors(bool aesni) {
+  security_aes_key_t k;
+  uint8_t key[16];
+  uint8_t msg[32];
+  uint8_t mac[4];
+  bool    ok = true;
+
+  hex_to_bytes("d3c5d592327fb11c4035c6680af8c6d1", key);
+  security_aes_key_init(&k, key);
+  k.aesni &= aesni;
+
+  hex_to_bytes("981ba6824c1bfb1ab485472029b71d808ce33e2cc3c0b5fc1f3de8a6dc66b1f0", msg);
+  security_128_eea2(&k, 0x398a59b4, 0x15, 1, msg, 32);
+  ok &= check("EEA2", msg, "e9fed8a63d155304d71df20bf3e82214b20ed7dad2f233dc3c22d7bdeeed8e78");
+
+  hex_to_bytes("484583d5afe082ae", msg);
+  security_128_eia2(&k, 0x398a59b4, 0x1a, 1, msg, 8, mac);
+  ok &= check("EIA2", mac, "b93787e6");
+  return ok;
+}
+
+// Every length up to a few blocks, in one batch, must give the same result in both paths
+bool test_aesni() {
+  security_aes_key_t k, k_generic;
+  uint8_t        key[16];
+  const uint32_t nof_pdus = 100;
+  uint8_t        msg[2][nof_pdus][nof_pdus];
+  uint8_t        mac[2][nof_pdus][4];
+  security_pdu_t pdus[2][nof_pdus];
+
+  for (int i=0;i<16;i++) {
+    key[i] = rand();
+  }
+  security_aes_key_init(&k, key);
+  if (!k.aesni) {
+    printf("CPU without AES-NI\n");
+    return true;
+  }
+  k_generic       = k;
+  k_generic.aesni = false;
+  memset(msg, 0, sizeof(msg));
+
+  for (uint32_t i=0;i<nof_pdus;i++) {
+    for (uint32_t j=0;j<i;j++) {
+      msg[0][i][j] = msg[1][i][j] = rand();
+    }
+    for (int n=0;n<2;n++) {
+      pdus[n][i].count   = rand();
+      pdus[n][i].msg     = msg[n][i];
+      pdus[n][i].msg_len = i;
+      pdus[n][i].mac     = mac[n][i];
+    }
+    pdus[1][i].count = pdus[0][i].count;
+  }
+  security_128_eia2_batch(&k,         3, 0, pdus[0], nof_pdus);
+  security_128_eia2_batch(&k_generic, 3, 0, pdus[1], nof_pdus);
+  security_128_eea2_batch(&k,         3, 0, pdus[0], nof_pdus);
+  security_128_eea2_batch(&k_generic, 3, 0, pdus[1], nof_pdus);
+  if (memcmp(mac[0], mac[1], sizeof(mac[0])) || memcmp(msg[0], msg[1], sizeof(msg[0]))) {
+    printf("AES-NI and generic results differ\n");
+    return false;
+  }
+  return true;
+}
+
+// Any length in bits must give the same result as the reference f8 and f9
+bool test_snow3g() {
+  uint8_t key[16];
+  uint8_t msg[2][272];
+  uint8_t mac[4];
+
+  for (uint32_t len=1;len<=2048;len+=1+rand()%13) {
+    uint32_t count  = rand();
+    uint32_t bearer = rand()%32;
+    uint32_t fresh  = rand();
+    uint32_t dir    = rand()%2;
+    for (int i=0;i<16;i++) {
+      key[i] = rand();
+    }
+    for (uint32_t i=0;i<sizeof(msg[0]);i++) {
+      msg[0][i] = msg[1][i] = rand();
+    }
+    snow3g_f8(key, count, bearer, dir, msg[0], len);
+    snow3g_f8_r(key, count, bearer, dir, msg[1], len);
+    snow3g_f9_r(key, count, fresh, dir, msg[1], len, mac);
+    if (memcmp(msg[0], msg[1], (len+7)/8) || memcmp(mac, snow3g_f9(key, count, fresh, dir, msg[0], len), 4)) {
+      printf("SNOW 3G differs from the reference f8/f9 for %d bits\n", len);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Each thread ciphers and MACs its own bearer, which must not disturb the others
+#define NOF_THREADS 4
+#define THREAD_PDUS 200
+
+typedef struct {
+  uint8_t key[16];
+  uint8_t msg[THREAD_PDUS][100];
+  uint8_t mac[THREAD_PDUS][4];
+} thread_bearer_t;
+
+void *run_bearer(void *arg) {
+  thread_bearer_t *b = (thread_bearer_t*) arg;
+  for (uint32_t i=0;i<THREAD_PDUS;i++) {
+    security_128_eea1(b->key, i, 1, 0, b->msg[i], 1+i%100);
+    security_128_eia1(b->key, i, 1, 0, b->msg[i], 1+i%100, b->mac[i]);
+  }
+  return NULL;
+}
+
+bool test_snow3g_threads() {
+  thread_bearer_t *b = (thread_bearer_t*) calloc(2*NOF_THREADS, sizeof(thread_bearer_t));
+  pthread_t        threads[NOF_THREADS];
+  bool             ok = true;
+
+  for (int n=0;n<NOF_THREADS;n++) {
+    for (int i=0;i<16;i++) {
+      b[n].key[i] = rand();
+    }
+    for (uint32_t i=0;i<THREAD_PDUS;i++) {
+      for (int j=0;j<100;j++) {
+        b[n].msg[i][j] = rand();
+      }
+    }
+    b[NOF_THREADS+n] = b[n];
+    run_bearer(&b[NOF_THREADS+n]);
+  }
+  for (int n=0;n<NOF_THREADS;n++) {
+    pthread_create(&threads[n], NULL, run_bearer, &b[n]);
+  }
+  for (int n=0;n<NOF_THREADS;n++) {
+    pthread_join(threads[n], NULL);
+    if (memcmp(&b[n], &b[NOF_THREADS+n], sizeof(thread_bearer_t))) {
+      printf("SNOW 3G on thread %d differs from the single-threaded result\n", n);
+      ok = false;
+    }
+  }
+  free(b);
+  return ok;
+}
+
+double elapsed(struct timespec *t) {
+  return (t[1].tv_sec - t[0].tv_sec) + 1e-9*(t[1].tv_nsec - t[0].tv_nsec);
+}
+
+typedef enum {
+  EEA2_BATCH = 0,
+  EIA2_BATCH,
+  EIA2_KEY_PER_CALL,
+  EEA1,
+  EEA1_REFERENCE,
+  EIA1,
+  EIA1_REFERENCE,
+} bench_t;
+
+// The reference f9 multiplies bit by bit, so it runs on fewer batches
+#define REFERENCE_DIVIDER 50
+
+void run(bench_t bench, bool aesni, uint32_t pdu_len) {
+  security_aes_key_t k;
+  uint8_t            key[16];
+  uint8_t           *buf  = (uint8_t*) malloc(batch_size*pdu_len+4);
+  uint8_t           *mac  = (uint8_t*) malloc(batch_size*4);
+  security_pdu_t    *pdus = (security_pdu_t*) malloc(batch_size*sizeof(security_pdu_t));
+  struct timespec    t[2];
+
+  for (int i=0;i<16;i++) {
+    key[i] = rand();
+  }
+  security_aes_key_init(&k, key);
+  k.aesni &= aesni;
+  for (uint32_t i=0;i<batch_size*pdu_len;i++) {
+    buf[i] = rand();
+  }
+  for (uint32_t i=0;i<batch_size;i++) {
+    pdus[i].count   = i;
+    pdus[i].msg     = &buf[i*pdu_len];
+    pdus[i].msg_len = pdu_len;
+    pdus[i].mac     = &mac[i*4];
+  }
+
+  uint32_t nof = nof_batches;
+  if (bench == EEA1_REFERENCE || bench == EIA1_REFERENCE) {
+    nof = nof_batches/REFERENCE_DIVIDER > 0 ? nof_batches/REFERENCE_DIVIDER : 1;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t[0]);
+  for (uint32_t n=0;n<nof;n++) {
+    switch (bench) {
+    case EEA2_BATCH:
+      security_128_eea2_batch(&k, 3, 1, pdus, batch_size);
+      break;
+    case EIA2_BATCH:
+      security_128_eia2_batch(&k, 3, 1, pdus, batch_size);
+      break;
+    case EIA2_KEY_PER_CALL:
+      for (uint32_t i=0;i<batch_size;i++) {
+        security_128_eia2(key, i, 3, 1, pdus[i].msg, pdu_len, pdus[i].mac);
+      }
+      break;
+    case EEA1:
+      for (uint32_t i=0;i<batch_size;i++) {
+        security_128_eea1(key, i, 3, 1, pdus[i].msg, pdu_len);
+      }
+      break;
+    case EEA1_REFERENCE:
+      // The reference f8 writes whole keystream words, hence the 4 spare bytes of buf
+      for (uint32_t i=0;i<batch_size;i++) {
+        snow3g_f8(key, i, 3, 1, pdus[i].msg, pdu_len*8);
+      }
+      break;
+    case EIA1:
+      for (uint32_t i=0;i<batch_size;i++) {
+        security_128_eia1(key, i, 3, 1, pdus[i].msg, pdu_len, pdus[i].mac);
+      }
+      break;
+    case EIA1_REFERENCE:
+      for (uint32_t i=0;i<batch_size;i++) {
+        memcpy(pdus[i].mac, snow3g_f9(key, i, 3 << 27, 1, pdus[i].msg, pdu_len*8), 4);
+      }
+      break;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t[1]);
+
+  const char *names[] = {"EEA2 batch", "EIA2 batch", "EIA2 key per call",
+                         "EEA1", "EEA1 reference", "EIA1", "EIA1 reference"};
+  double secs = elapsed(t);
+  printf("%-17s %-7s %4d-byte PDUs: %7.2f Gbps, %8.1f ns/PDU\n",
+         names[bench], bench == EEA2_BATCH || bench == EIA2_BATCH ? (aesni ? "AES-NI" : "generic") : "", pdu_len,
+         8e-9*nof*batch_size*pdu_len/secs, 1e9*secs/nof/batch_size);
+  free(buf);
+  free(mac);
+  free(pdus);
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  if (!test_vectors(false) || !test_vectors(true) || !test_aesni() ||
+      !test_vectors_snow3g() || !test_snow3g() || !test_snow3g_threads()) {
+    exit(-1);
+  }
+
+  uint32_t pdu_lens[] = {40, 400, 1500};
+  for (int i=0;i<3;i++) {
+    run(EEA2_BATCH,        true,  pdu_lens[i]);
+    run(EEA2_BATCH,        false, pdu_lens[i]);
+    run(EIA2_BATCH,        true,  pdu_lens[i]);
+    run(EIA2_BATCH,        false, pdu_lens[i]);
+    run(EIA2_KEY_PER_CALL, false, pdu_lens[i]);
+    run(EEA1,              false, pdu_lens[i]);
+    run(EEA1_REFERENCE,    false, pdu_lens[i]);
+    run(EIA1,              false, pdu_lens[i]);
+    run(EIA1_REFERENCE,    false, pdu_lens[i]);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,158 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Several submitters push batches of tasks of random size and length to a shared pool and
+ * wait for them, running their own queued tasks meanwhile. Checks that every task runs exactly
+ * once, before its batch is reported as done, and with the argument of a pool thread or of its
+ * own submitter, never of another one. Also runs a pool without threads, where each waiting
+ * submitter runs all of its tasks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "srslte/common/task_pool.h"
+
+using namespace srslte;
+
+#define MAX_SUBMITTERS 4
+#define MAX_THREADS    4
+#define MAX_BATCH      16
+
+uint32_t nof_batches = 2000;
+
+// Argument given to each thread: its index, pool threads first and then submitters 
+uint32_t thread_idx[MAX_THREADS+MAX_SUBMITTERS];
+
+class test_task : public task_pool::task
+{
+public:
+  volatile int nof_runs; 
+  uint32_t     work; 
+  uint32_t     nof_threads; 
+  uint32_t     submitter; 
+  bool         bad_arg; 
+  
+  void run_task(void *arg) {
+    uint32_t idx = *((uint32_t*) arg);
+    if (idx < MAX_THREADS ? idx >= nof_threads : idx != MAX_THREADS+submitter) {
+      bad_arg = true; 
+    }
+    volatile uint32_t x = 0; 
+    for (uint32_t i=0;i<work;i++) {
+      x += i; 
+    }
+    __sync_fetch_and_add(&nof_runs, 1);
+  }
+};
+
+struct submitter_args {
+  task_pool *pool; 
+  uint32_t   id; 
+  uint32_t   nof_threads; 
+  bool       ok; 
+};
+
+void* submitter(void *a) {
+  submitter_args *args = (submitter_args*) a;
+  unsigned int seed = args->id;
+  test_task tasks[MAX_BATCH];
+  args->ok = true; 
+  for (uint32_t b=0;b<nof_batches && args->ok;b++) {
+    task_pool::batch batch; 
+    uint32_t n = 1 + rand_r(&seed)%MAX_BATCH;
+    for (uint32_t i=0;i<n;i++) {
+      tasks[i].nof_runs    = 0; 
+      tasks[i].work        = rand_r(&seed)%20000;
+      tasks[i].nof_threads = args->nof_threads; 
+      tasks[i].submitter   = args->id; 
+      tasks[i].bad_arg     = false; 
+      args->pool->push(&batch, &tasks[i]);
+    }
+    args->pool->wait(&batch, &thread_idx[MAX_THREADS + args->id]);
+    for (uint32_t i=0;i<n;i++) {
+      if (tasks[i].nof_runs != 1 || tasks[i].bad_arg) {
+        printf("submitter %d batch %d task %d: ran %d times%s\n", args->id, b, i, tasks[i].nof_runs, 
+               tasks[i].bad_arg?" with a wrong argument":"");
+        args->ok = false; 
+      }
+    }
+  }
+  return NULL;
+}
+
+bool run(uint32_t nof_threads, uint32_t nof_submitters) {
+  task_pool      pool; 
+  pthread_t      threads[MAX_SUBMITTERS];
+  submitter_args args[MAX_SUBMITTERS];
+  bool           ok = true;
+
+  if (nof_threads > 0) {
+    std::vector<void*> thread_args; 
+    for (uint32_t i=0;i<nof_threads;i++) {
+      thread_args.push_back(&thread_idx[i]);
+    }
+    pool.init(thread_args);
+  }
+  for (uint32_t s=0;s<nof_submitters;s++) {
+    args[s].pool        = &pool; 
+    args[s].id          = s; 
+    args[s].nof_threads = nof_threads; 
+    pthread_create(&threads[s], NULL, submitter, &args[s]);
+  }
+  for (uint32_t s=0;s<nof_submitters;s++) {
+    pthread_join(threads[s], NULL);
+    ok &= args[s].ok; 
+  }
+  pool.stop();
+  printf("task_pool with %d threads and %d submitters: %s\n", nof_threads, nof_submitters, ok?"Ok":"Error");
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1) {
+    nof_batches = atoi(argv[1]);
+  }
+  for (uint32_t i=0;i<MAX_THREADS+MAX_SUBMITTERS;i++) {
+    thread_idx[i] = i; 
+  }
+  bool ok = true;
+  ok &= run(0, 1);
+  ok &= run(0, 4);
+  ok &= run(1, 1);
+  ok &= run(4, 1);
+  ok &= run(2, 4);
+  ok &= run(4, 4);
+
+  if (!ok) {
+    printf("Failed\n");
+    exit(1);
+  }
+  printf("Passed\n");
+  exit(0);
+}
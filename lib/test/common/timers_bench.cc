@@ -0,0 +1,146 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/* Steps a set of always-running timers, restarted with a random timeout upon expiry, and
+ * compares the time per step of the timing wheel of srslte::timers with stepping every
+ * timer, as done before. Also measures the time to restart a running timer.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/timers.h"
+
+using namespace srslte;
+
+uint32_t nof_timers  = 10000;
+uint32_t nof_steps   = 10000;
+uint32_t max_timeout = 2000;
+
+void usage(char *prog) {
+  printf("Usage: %s [nsm]\n", prog);
+  printf("\t-n number of timers [Default %d]\n", nof_timers);
+  printf("\t-s number of steps [Default %d]\n", nof_steps);
+  printf("\t-m maximum timeout [Default %d]\n", max_timeout);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nsm")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_timers = atoi(argv[optind]);
+      break;
+    case 's':
+      nof_steps = atoi(argv[optind]);
+      break;
+    case 'm':
+      max_timeout = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+class restarter : public timer_callback
+{
+public:
+  restarter() : t(NULL), nof_expired(0) {}
+  void init(timers::timer *t_) {
+    t = t_;
+  }
+  void timer_expired(uint32_t timer_id) {
+    t[timer_id].set(this, 1 + rand()%max_timeout);
+    t[timer_id].run();
+    nof_expired++;
+  }
+  timers::timer *t;
+  uint32_t       nof_expired;
+};
+
+double elapsed_ns(struct timeval *t) {
+  return 1e9*(t[1].tv_sec - t[0].tv_sec) + 1e3*(t[1].tv_usec - t[0].tv_usec);
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  timers         wheel(nof_timers);
+  timers::timer *linear = new timers::timer[nof_timers];
+  restarter      wheel_cb, linear_cb;
+  struct timeval t[2];
+
+  wheel_cb.init(wheel.get(0));
+  linear_cb.init(linear);
+  srand(0);
+  for (uint32_t i=0;i<nof_timers;i++) {
+    linear[i].id = i;
+    linear[i].set(&linear_cb, 1 + rand()%max_timeout);
+    linear[i].run();
+    wheel.get(i)->set(&wheel_cb, 1 + rand()%max_timeout);
+    wheel.get(i)->run();
+  }
+
+  gettimeofday(&t[0], NULL);
+  for (uint32_t n=0;n<nof_steps;n++) {
+    for (uint32_t i=0;i<nof_timers;i++) {
+      linear[i].step();
+    }
+  }
+  gettimeofday(&t[1], NULL);
+  double linear_ns = elapsed_ns(t)/nof_steps;
+
+  gettimeofday(&t[0], NULL);
+  for (uint32_t n=0;n<nof_steps;n++) {
+    wheel.step_all();
+  }
+  gettimeofday(&t[1], NULL);
+  double wheel_ns = elapsed_ns(t)/nof_steps;
+
+  // Restart running timers, as RLC does on every reordering event
+  gettimeofday(&t[0], NULL);
+  for (uint32_t n=0;n<nof_steps;n++) {
+    timers::timer *timer = wheel.get(rand()%nof_timers);
+    timer->stop();
+    timer->set(&wheel_cb, 1 + rand()%max_timeout);
+    timer->run();
+  }
+  gettimeofday(&t[1], NULL);
+  double restart_ns = elapsed_ns(t)/nof_steps;
+
+  printf("%d timers, %d steps, %d/%d expiries\n", nof_timers, nof_steps, wheel_cb.nof_expired, linear_cb.nof_expired);
+  printf("Step all timers:    %10.1f ns (wheel), %10.1f ns (linear)\n", wheel_ns, linear_ns);
+  printf("Restart one timer:  %10.1f ns (wheel)\n", restart_ns);
+
+  delete [] linear;
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,149 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/* Checks the timing wheel of srslte::timers against standalone timers stepped one by one.
+ * Random set, run, stop and reset calls are applied to both, half of the callbacks restart
+ * their timer, and both must report the same state and expiries on every step.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "srslte/common/timers.h"
+
+#define NOF_TIMERS  64
+#define NOF_STEPS   20000
+#define MAX_TIMEOUT 3000
+
+using namespace srslte;
+
+class restarter : public timer_callback
+{
+public:
+  void init(timers::timer *t_) {
+    t = t_;
+  }
+  void timer_expired(uint32_t timer_id) {
+    expired.push_back(timer_id);
+    if (timer_id%2) {
+      t[timer_id].reset();
+      t[timer_id].run();
+    }
+  }
+  std::vector<uint32_t> expired;
+private:
+  timers::timer *t;
+};
+
+class wheel_restarter : public timer_callback
+{
+public:
+  void init(timers *t_) {
+    t = t_;
+  }
+  void timer_expired(uint32_t timer_id) {
+    expired.push_back(timer_id);
+    if (timer_id%2) {
+      t->get(timer_id)->reset();
+      t->get(timer_id)->run();
+    }
+  }
+  std::vector<uint32_t> expired;
+private:
+  timers *t;
+};
+
+int main(int argc, char **argv)
+{
+  timers          wheel(NOF_TIMERS);
+  timers::timer   ref[NOF_TIMERS];
+  restarter       ref_cb;
+  wheel_restarter wheel_cb;
+
+  ref_cb.init(ref);
+  wheel_cb.init(&wheel);
+  for (uint32_t i=0;i<NOF_TIMERS;i++) {
+    ref[i].id = i;
+  }
+  srand(0);
+
+  uint32_t nof_expired = 0;
+  for (uint32_t n=0;n<NOF_STEPS;n++) {
+    for (uint32_t k=0;k<4;k++) {
+      uint32_t i  = rand()%NOF_TIMERS;
+      uint32_t op = rand()%8;
+      switch (op) {
+        case 0: {
+          uint32_t timeout = rand()%4 ? rand()%50 : rand()%MAX_TIMEOUT;
+          ref[i].set(&ref_cb, timeout);
+          wheel.get(i)->set(&wheel_cb, timeout);
+          break;
+        }
+        case 1:
+        case 2:
+        case 3:
+          ref[i].run();
+          wheel.get(i)->run();
+          break;
+        case 4:
+          ref[i].stop();
+          wheel.get(i)->stop();
+          break;
+        case 5:
+          ref[i].reset();
+          wheel.get(i)->reset();
+          break;
+        default:
+          break;
+      }
+    }
+
+    ref_cb.expired.clear();
+    wheel_cb.expired.clear();
+    for (uint32_t i=0;i<NOF_TIMERS;i++) {
+      ref[i].step();
+    }
+    wheel.step_all();
+
+    if (ref_cb.expired != wheel_cb.expired) {
+      printf("Step %d: %d timers expired, expected %d\n", n, (int) wheel_cb.expired.size(), (int) ref_cb.expired.size());
+      exit(-1);
+    }
+    nof_expired += ref_cb.expired.size();
+    for (uint32_t i=0;i<NOF_TIMERS;i++) {
+      if (ref[i].is_running() != wheel.get(i)->is_running() ||
+          ref[i].is_expired() != wheel.get(i)->is_expired()) {
+        printf("Step %d: timer %d running=%d expired=%d, expected running=%d expired=%d\n", n, i,
+               wheel.get(i)->is_running(), wheel.get(i)->is_expired(), ref[i].is_running(), ref[i].is_expired());
+        exit(-1);
+      }
+    }
+  }
+  printf("%d steps, %d expiries\n", NOF_STEPS, nof_expired);
+  printf("Ok\n");
+  exit(0);
+}
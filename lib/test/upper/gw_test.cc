@@ -0,0 +1,237 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Checks the TUN readers of the gateway and their batched hand-off to PDCP. Each TUN
+ * queue is replaced by one end of a SOCK_SEQPACKET socket pair, which keeps the packet
+ * boundaries like a TUN device:
+ *  - packets waiting in a queue are handed to PDCP in order, in batches of at most
+ *    GW_READ_BATCH, and a backlog longer than one batch takes several of them
+ *  - every queue has its own reader
+ *  - packets that are not IPv4 or whose length does not match the IP header are dropped
+ *  - DL PDUs are written to the first queue
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <linux/ip.h>
+#include "srslte/upper/gw.h"
+#include "srslte/common/log_stdout.h"
+
+#define NOF_QUEUES   2
+#define READ_BATCH   32
+#define BACKLOG_LEN  (3*READ_BATCH+5)
+#define PACKET_LEN   100
+#define TIMEOUT_MS   1000
+
+using namespace srslte;
+
+uint32_t nof_errors = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); nof_errors++; }
+
+class pdcp_dummy : public srsue::pdcp_interface_gw
+{
+public:
+  pdcp_dummy() {
+    pool = byte_buffer_pool::get_instance();
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&cvar, NULL);
+  }
+  void write_sdu(uint32_t lcid, byte_buffer_t *sdu) {
+    write_sdu_batch(lcid, &sdu, 1);
+  }
+  void write_sdu_batch(uint32_t lcid, byte_buffer_t **sdus, uint32_t nof_sdus) {
+    pthread_mutex_lock(&mutex);
+    batches.push_back(nof_sdus);
+    for (uint32_t i=0;i<nof_sdus;i++) {
+      CHECK(lcid == RB_ID_DRB1, "SDU for LCID %d\n", lcid);
+      CHECK(sdus[i]->N_bytes == PACKET_LEN, "SDU of %d bytes\n", sdus[i]->N_bytes);
+      seqs.push_back(sdus[i]->msg[sizeof(struct iphdr)]);
+      pool->deallocate(sdus[i]);
+    }
+    pthread_cond_signal(&cvar);
+    pthread_mutex_unlock(&mutex);
+  }
+  // Waits until at least nof_sdus have been received or the timeout expires
+  bool wait_rx(uint32_t nof_sdus) {
+    struct timeval  now;
+    struct timespec deadline;
+    gettimeofday(&now, NULL);
+    uint64_t usec = now.tv_usec + 1000*TIMEOUT_MS;
+    deadline.tv_sec  = now.tv_sec + usec/1000000;
+    deadline.tv_nsec = 1000*(usec%1000000);
+    pthread_mutex_lock(&mutex);
+    int ret = 0;
+    while (seqs.size() < nof_sdus && ret == 0) {
+      ret = pthread_cond_timedwait(&cvar, &mutex, &deadline);
+    }
+    bool ok = seqs.size() >= nof_sdus;
+    pthread_mutex_unlock(&mutex);
+    return ok;
+  }
+  // Returns the sequence numbers and batch sizes received so far and clears them
+  void take(std::vector<uint32_t> &seqs_, std::vector<uint32_t> &batches_) {
+    pthread_mutex_lock(&mutex);
+    seqs_.clear();
+    batches_.clear();
+    seqs_.swap(seqs);
+    batches_.swap(batches);
+    pthread_mutex_unlock(&mutex);
+  }
+private:
+  byte_buffer_pool     *pool;
+  std::vector<uint32_t> seqs;
+  std::vector<uint32_t> batches;
+  pthread_mutex_t       mutex;
+  pthread_cond_t        cvar;
+};
+
+class rrc_dummy : public srsue::rrc_interface_gw
+{
+public:
+  bool rrc_connected() { return true; }
+  void rrc_connect() {}
+  bool have_drb() { return true; }
+};
+
+class ue_dummy : public srsue::ue_interface
+{
+};
+
+// Writes an IPv4 packet of len bytes whose first payload byte is seq
+void write_packet(int fd, uint32_t seq, uint32_t len, uint8_t version = 4, uint32_t tot_len = PACKET_LEN)
+{
+  uint8_t buf[PACKET_LEN];
+  bzero(buf, sizeof(buf));
+  struct iphdr *ip = (struct iphdr*) buf;
+  ip->version = version;
+  ip->ihl     = 5;
+  ip->tot_len = htons(tot_len);
+  buf[sizeof(struct iphdr)] = seq;
+  if (write(fd, buf, len) != (int) len) {
+    perror("write");
+    nof_errors++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  log_stdout  log("GW ");
+  pdcp_dummy  pdcp;
+  rrc_dummy   rrc;
+  ue_dummy    ue;
+  gw          gw;
+  int         fds[NOF_QUEUES][2];
+  int32       tun_fds[NOF_QUEUES];
+  std::vector<uint32_t> seqs, batches;
+
+  log.set_level(LOG_LEVEL_NONE);
+  for (uint32_t q=0;q<NOF_QUEUES;q++) {
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds[q])) {
+      perror("socketpair");
+      exit(-1);
+    }
+    tun_fds[q] = fds[q][0];
+  }
+
+  // A backlog longer than one batch is waiting in the first queue when the readers start
+  for (uint32_t i=0;i<BACKLOG_LEN;i++) {
+    write_packet(fds[0][1], i, PACKET_LEN);
+  }
+
+  gw.init(&pdcp, &rrc, &ue, &log, NOF_QUEUES);
+  if (gw.setup_if_fds(tun_fds, NOF_QUEUES, 1500) != ERROR_NONE) {
+    fprintf(stderr, "Error setting up the gateway\n");
+    exit(-1);
+  }
+
+  CHECK(pdcp.wait_rx(BACKLOG_LEN), "Backlog: only some of the %d packets received\n", BACKLOG_LEN);
+  pdcp.take(seqs, batches);
+  for (uint32_t i=0;i<seqs.size();i++) {
+    CHECK(seqs[i] == i, "Backlog: packet %d has seq %d\n", i, seqs[i]);
+  }
+  CHECK(batches.size() >= (BACKLOG_LEN+READ_BATCH-1)/READ_BATCH && batches.size() < BACKLOG_LEN,
+        "Backlog: %d packets handed to PDCP in %d batches\n", (int) seqs.size(), (int) batches.size());
+  for (uint32_t i=0;i<batches.size();i++) {
+    CHECK(batches[i] <= READ_BATCH, "Backlog: batch %d of %d packets\n", i, batches[i]);
+  }
+
+  // Every queue has its own reader
+  for (uint32_t q=0;q<NOF_QUEUES;q++) {
+    write_packet(fds[q][1], q, PACKET_LEN);
+    CHECK(pdcp.wait_rx(1), "Queue %d: packet not received\n", q);
+    pdcp.take(seqs, batches);
+    CHECK(seqs.size() == 1 && seqs[0] == q, "Queue %d: %d packets received\n", q, (int) seqs.size());
+  }
+
+  // Invalid packets, each followed by a valid one that must be the only one received
+  const char *what[3] = {"IPv6", "longer IP length", "shorter IP length"};
+  for (uint32_t k=0;k<3;k++) {
+    switch (k) {
+    case 0:
+      write_packet(fds[1][1], 100+k, PACKET_LEN, 6);
+      break;
+    case 1:
+      write_packet(fds[1][1], 100+k, PACKET_LEN, 4, PACKET_LEN+1);
+      break;
+    case 2:
+      write_packet(fds[1][1], 100+k, PACKET_LEN, 4, PACKET_LEN-1);
+      break;
+    }
+    write_packet(fds[1][1], 200+k, PACKET_LEN);
+    pdcp.wait_rx(1);
+    usleep(10000);
+    pdcp.take(seqs, batches);
+    CHECK(seqs.size() == 1 && seqs[0] == 200+k, "Packet with %s not dropped: %d packets received\n", what[k], (int) seqs.size());
+  }
+
+  // DL PDUs go to the first queue
+  byte_buffer_pool *pool = byte_buffer_pool::get_instance();
+  byte_buffer_t    *pdu  = pool_allocate;
+  memset(pdu->msg, 0xab, PACKET_LEN);
+  pdu->N_bytes = PACKET_LEN;
+  gw.write_pdu(RB_ID_DRB1, pdu);
+  uint8_t buf[2*PACKET_LEN];
+  int n = read(fds[0][1], buf, sizeof(buf));
+  CHECK(n == PACKET_LEN && buf[0] == 0xab && buf[PACKET_LEN-1] == 0xab, "DL PDU: read %d bytes from the first queue\n", n);
+
+  gw.stop();
+  for (uint32_t q=0;q<NOF_QUEUES;q++) {
+    close(fds[q][1]);
+  }
+  byte_buffer_pool::cleanup();
+
+  if (nof_errors) {
+    printf("%d errors\n", nof_errors);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
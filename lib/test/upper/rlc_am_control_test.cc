@@ -38,7 +38,7 @@ uint32_t PDU2_LEN = 8;
 
 int main(int argc, char **argv) {
   srslte::rlc_status_pdu_t s;
-  srslte::byte_buffer_t b1,b2;
+  srslte::inline_byte_buffer_t b1,b2;
 
   memcpy(b1.msg, &pdu1[0], PDU1_LEN);
   b1.N_bytes = PDU1_LEN;
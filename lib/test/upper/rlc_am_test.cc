@@ -25,6 +25,8 @@
  */
 
 #include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
 #include "srslte/common/log_stdout.h"
 #include "srslte/upper/rlc_am.h"
 #include <assert.h>
@@ -97,6 +99,7 @@ void basic_test()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -105,7 +108,7 @@ void basic_test()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     *sdu_bufs[i].msg    = i; // Write the index into the buffer
@@ -116,7 +119,7 @@ void basic_test()
   assert(13 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (1 byte each)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     len = rlc1.read_pdu(pdu_bufs[i].msg, 3); // 3 bytes for header + payload
@@ -134,7 +137,7 @@ void basic_test()
   assert(2 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   len = rlc2.read_pdu(status_buf.msg, 2);
   status_buf.N_bytes = len;
 
@@ -176,6 +179,7 @@ void concat_test()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -184,7 +188,7 @@ void concat_test()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     *sdu_bufs[i].msg    = i; // Write the index into the buffer
@@ -195,7 +199,7 @@ void concat_test()
   assert(13 == rlc1.get_buffer_state());
 
   // Read 1 PDUs from RLC1 containing all 5 SDUs
-  byte_buffer_t pdu_buf;
+  inline_byte_buffer_t pdu_buf;
   len = rlc1.read_pdu(pdu_buf.msg, 13); // 8 bytes for header + payload
   pdu_buf.N_bytes = len;
 
@@ -240,6 +244,7 @@ void segment_test()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -248,7 +253,7 @@ void segment_test()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     for(int j=0;j<10;j++)
@@ -260,7 +265,7 @@ void segment_test()
   assert(58 == rlc1.get_buffer_state());
 
   // Read PDUs from RLC1 (force segmentation)
-  byte_buffer_t pdu_bufs[20];
+  inline_byte_buffer_t pdu_bufs[20];
   int n_pdus = 0;
   while(rlc1.get_buffer_state() > 0){
     len = rlc1.read_pdu(pdu_bufs[n_pdus].msg, 10); // 2 header + payload
@@ -278,7 +283,7 @@ void segment_test()
   assert(2 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   len = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
   status_buf.N_bytes = len;
 
@@ -322,6 +327,7 @@ void retx_test()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -330,7 +336,7 @@ void retx_test()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     *sdu_bufs[i].msg    = i; // Write the index into the buffer
@@ -341,7 +347,7 @@ void retx_test()
   assert(13 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (1 byte each)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     len = rlc1.read_pdu(pdu_bufs[i].msg, 3); // 2 byte header + 1 byte payload
@@ -363,7 +369,7 @@ void retx_test()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   len = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
   status_buf.N_bytes = len;
 
@@ -373,7 +379,7 @@ void retx_test()
   assert(3 == rlc1.get_buffer_state()); // 2 byte header + 1 byte payload
 
   // Read the retx PDU from RLC1
-  byte_buffer_t retx;
+  inline_byte_buffer_t retx;
   len = rlc1.read_pdu(retx.msg, 3); // 2 byte header + 1 byte payload
   retx.N_bytes = len;
 
@@ -418,6 +424,7 @@ void resegment_test_1()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -426,7 +433,7 @@ void resegment_test_1()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     for(int j=0;j<10;j++)
@@ -438,7 +445,7 @@ void resegment_test_1()
   assert(58 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (10 bytes each)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     len = rlc1.read_pdu(pdu_bufs[i].msg, 12); // 12 bytes for header + payload
@@ -460,7 +467,7 @@ void resegment_test_1()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   len = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
   status_buf.N_bytes = len;
 
@@ -470,7 +477,7 @@ void resegment_test_1()
   assert(12 == rlc1.get_buffer_state()); // 2 byte header + 10 data
 
   // Read the retx PDU from RLC1 and force resegmentation
-  byte_buffer_t retx1;
+  inline_byte_buffer_t retx1;
   len = rlc1.read_pdu(retx1.msg, 9); // 4 byte header + 5 data
   retx1.N_bytes = len;
 
@@ -480,7 +487,7 @@ void resegment_test_1()
   assert(9 == rlc1.get_buffer_state()); // 4 byte header + 5 data
 
   // Read the remaining segment
-  byte_buffer_t retx2;
+  inline_byte_buffer_t retx2;
   len = rlc1.read_pdu(retx2.msg, 9); // 4 byte header + 5 data
   retx2.N_bytes = len;
 
@@ -527,6 +534,7 @@ void resegment_test_2()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -535,7 +543,7 @@ void resegment_test_2()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     for(int j=0;j<10;j++)
@@ -547,7 +555,7 @@ void resegment_test_2()
   assert(58 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (5 bytes, 10 bytes, 20 bytes, 10 bytes, 5 bytes)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   pdu_bufs[0].N_bytes = rlc1.read_pdu(pdu_bufs[0].msg, 7);  // 2 byte header +  5 byte payload
   pdu_bufs[1].N_bytes = rlc1.read_pdu(pdu_bufs[1].msg, 14); // 4 byte header + 10 byte payload
   pdu_bufs[2].N_bytes = rlc1.read_pdu(pdu_bufs[2].msg, 25); // 5 byte header + 20 byte payload
@@ -569,7 +577,7 @@ void resegment_test_2()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   status_buf.N_bytes = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
 
   // Write status PDU to RLC1
@@ -578,7 +586,7 @@ void resegment_test_2()
   assert(25 == rlc1.get_buffer_state()); // 4 byte header + 20 data
 
   // Read the retx PDU from RLC1 and force resegmentation
-  byte_buffer_t retx1;
+  inline_byte_buffer_t retx1;
   retx1.N_bytes = rlc1.read_pdu(retx1.msg, 16); // 6 byte header + 10 data
 
   // Write the retx PDU to RLC2
@@ -587,7 +595,7 @@ void resegment_test_2()
   assert(16 == rlc1.get_buffer_state()); // 6 byte header + 10 data
 
   // Read the remaining segment
-  byte_buffer_t retx2;
+  inline_byte_buffer_t retx2;
   retx2.N_bytes = rlc1.read_pdu(retx2.msg, 16); // 6 byte header + 10 data
 
   // Write the retx PDU to RLC2
@@ -633,6 +641,7 @@ void resegment_test_3()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -641,7 +650,7 @@ void resegment_test_3()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     for(int j=0;j<10;j++)
@@ -653,7 +662,7 @@ void resegment_test_3()
   assert(58 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (5 bytes, 5 bytes, 20 bytes, 10 bytes, 10 bytes)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   pdu_bufs[0].N_bytes = rlc1.read_pdu(pdu_bufs[0].msg, 7);  // 2 byte header +  5 byte payload
   pdu_bufs[1].N_bytes = rlc1.read_pdu(pdu_bufs[1].msg, 7);  // 2 byte header +  5 byte payload
   pdu_bufs[2].N_bytes = rlc1.read_pdu(pdu_bufs[2].msg, 24); // 4 byte header + 20 byte payload
@@ -675,21 +684,21 @@ void resegment_test_3()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   status_buf.N_bytes = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
 
   // Write status PDU to RLC1
   rlc1.write_pdu(status_buf.msg, status_buf.N_bytes);
 
   // Read the retx PDU from RLC1 and force resegmentation
-  byte_buffer_t retx1;
+  inline_byte_buffer_t retx1;
   retx1.N_bytes = rlc1.read_pdu(retx1.msg, 14); // 4 byte header + 10 data
 
   // Write the retx PDU to RLC2
   rlc2.write_pdu(retx1.msg, retx1.N_bytes);
 
   // Read the remaining segment
-  byte_buffer_t retx2;
+  inline_byte_buffer_t retx2;
   retx2.N_bytes = rlc1.read_pdu(retx2.msg, 14); // 4 byte header + 10 data
 
   // Write the retx PDU to RLC2
@@ -735,6 +744,7 @@ void resegment_test_4()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -743,7 +753,7 @@ void resegment_test_4()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     for(int j=0;j<10;j++)
@@ -755,7 +765,7 @@ void resegment_test_4()
   assert(58 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (5 bytes, 5 bytes, 30 bytes, 5 bytes, 5 bytes)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   pdu_bufs[0].N_bytes = rlc1.read_pdu(pdu_bufs[0].msg, 7);  // 2 byte header +  5 byte payload
   pdu_bufs[1].N_bytes = rlc1.read_pdu(pdu_bufs[1].msg, 7);  // 2 byte header +  5 byte payload
   pdu_bufs[2].N_bytes = rlc1.read_pdu(pdu_bufs[2].msg, 35); // 5 byte header + 30 byte payload
@@ -777,21 +787,21 @@ void resegment_test_4()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   status_buf.N_bytes = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
 
   // Write status PDU to RLC1
   rlc1.write_pdu(status_buf.msg, status_buf.N_bytes);
 
   // Read the retx PDU from RLC1 and force resegmentation
-  byte_buffer_t retx1;
+  inline_byte_buffer_t retx1;
   retx1.N_bytes = rlc1.read_pdu(retx1.msg, 21); // 6 byte header + 15 data
 
   // Write the retx PDU to RLC2
   rlc2.write_pdu(retx1.msg, retx1.N_bytes);
 
   // Read the remaining segment
-  byte_buffer_t retx2;
+  inline_byte_buffer_t retx2;
   retx2.N_bytes = rlc1.read_pdu(retx2.msg, 21); // 6 byte header + 15 data
 
   // Write the retx PDU to RLC2
@@ -837,6 +847,7 @@ void resegment_test_5()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -845,7 +856,7 @@ void resegment_test_5()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     for(int j=0;j<10;j++)
@@ -857,7 +868,7 @@ void resegment_test_5()
   assert(58 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (2 bytes, 3 bytes, 40 bytes, 3 bytes, 2 bytes)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   pdu_bufs[0].N_bytes = rlc1.read_pdu(pdu_bufs[0].msg, 4);  // 2 byte header +  2 byte payload
   pdu_bufs[1].N_bytes = rlc1.read_pdu(pdu_bufs[1].msg, 5);  // 2 byte header +  3 byte payload
   pdu_bufs[2].N_bytes = rlc1.read_pdu(pdu_bufs[2].msg, 48); // 8 byte header + 40 byte payload
@@ -879,21 +890,21 @@ void resegment_test_5()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   status_buf.N_bytes = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
 
   // Write status PDU to RLC1
   rlc1.write_pdu(status_buf.msg, status_buf.N_bytes);
 
   // Read the retx PDU from RLC1 and force resegmentation
-  byte_buffer_t retx1;
+  inline_byte_buffer_t retx1;
   retx1.N_bytes = rlc1.read_pdu(retx1.msg, 27); // 7 byte header + 20 data
 
   // Write the retx PDU to RLC2
   rlc2.write_pdu(retx1.msg, retx1.N_bytes);
 
   // Read the remaining segment
-  byte_buffer_t retx2;
+  inline_byte_buffer_t retx2;
   retx2.N_bytes = rlc1.read_pdu(retx2.msg, 27); // 7 byte header + 20 data
 
   // Write the retx PDU to RLC2
@@ -938,6 +949,7 @@ void resegment_test_6()
   cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
   cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
   cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS5;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
   cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T4;
   cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
   cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
@@ -946,7 +958,7 @@ void resegment_test_6()
   rlc2.configure(&cnfg);
 
   // Push SDUs into RLC1
-  byte_buffer_t sdu_bufs[9];
+  inline_byte_buffer_t sdu_bufs[9];
   for(int i=0;i<3;i++)
   {
     for(int j=0;j<10;j++)
@@ -965,7 +977,7 @@ void resegment_test_6()
   assert(368 == rlc1.get_buffer_state());
 
   // Read PDUs from RLC1 (10, 10, 10, 270, 54)
-  byte_buffer_t pdu_bufs[5];
+  inline_byte_buffer_t pdu_bufs[5];
   for(int i=0;i<3;i++) {
     len = rlc1.read_pdu(pdu_bufs[i].msg, 12);
     pdu_bufs[i].N_bytes = len;
@@ -990,7 +1002,7 @@ void resegment_test_6()
   assert(4 == rlc2.get_buffer_state());
 
   // Read status PDU from RLC2
-  byte_buffer_t status_buf;
+  inline_byte_buffer_t status_buf;
   len = rlc2.read_pdu(status_buf.msg, 10); // 10 bytes is enough to hold the status
   status_buf.N_bytes = len;
 
@@ -1000,7 +1012,7 @@ void resegment_test_6()
   assert(278 == rlc1.get_buffer_state());
 
   // Read the retx PDU from RLC1 and force resegmentation
-  byte_buffer_t retx1;
+  inline_byte_buffer_t retx1;
   len = rlc1.read_pdu(retx1.msg, 127);
   retx1.N_bytes = len;
 
@@ -1010,7 +1022,7 @@ void resegment_test_6()
   assert(157 == rlc1.get_buffer_state());
 
   // Read the remaining segment
-  byte_buffer_t retx2;
+  inline_byte_buffer_t retx2;
   len = rlc1.read_pdu(retx2.msg, 157);
   retx2.N_bytes = len;
 
@@ -1032,6 +1044,139 @@ void resegment_test_6()
   }
 }
 
+// Counts and frees the delivered SDUs, checking that they arrive in order
+class rlc_am_sink
+    :public pdcp_interface_rlc
+    ,public rrc_interface_rlc
+{
+public:
+  rlc_am_sink(){n_sdus = 0; n_bytes = 0; n_errors = 0; pool = byte_buffer_pool::get_instance();}
+
+  // PDCP interface
+  void write_pdu(uint32_t lcid, byte_buffer_t *sdu)
+  {
+    uint32_t idx;
+    memcpy(&idx, sdu->msg, sizeof(idx)); // Every SDU starts with its index
+    if(idx != n_sdus)
+      n_errors++;
+    n_sdus++;
+    n_bytes += sdu->N_bytes;
+    pool->deallocate(sdu);
+  }
+  void write_pdu_bcch_bch(byte_buffer_t *sdu) {}
+  void write_pdu_bcch_dlsch(byte_buffer_t *sdu) {}
+  void write_pdu_pcch(byte_buffer_t *sdu) {}
+
+  // RRC interface
+  void max_retx_attempted(){}
+
+  uint32_t n_sdus;
+  uint64_t n_bytes;
+  uint32_t n_errors;
+
+private:
+  byte_buffer_pool *pool;
+};
+
+// Streams SDUs from RLC1 to RLC2, dropping data PDUs with probability loss, and
+// reports the throughput until nof_sdus are delivered. The stream does not stop
+// there, since lost PDUs are only recovered while new data keeps polling.
+void throughput_test(float loss)
+{
+  const uint32_t nof_sdus = 100000;
+  const uint32_t sdu_len  = 1000;
+  const uint32_t grant    = 1200;
+
+  srslte::log_stdout log1("RLC_AM_1");
+  srslte::log_stdout log2("RLC_AM_2");
+  log1.set_level(srslte::LOG_LEVEL_ERROR);
+  log2.set_level(srslte::LOG_LEVEL_ERROR);
+  rlc_am_sink       sink;
+  mac_dummy_timers  timers;
+  byte_buffer_pool *pool = byte_buffer_pool::get_instance();
+
+  rlc_am rlc1;
+  rlc_am rlc2;
+
+  rlc1.init(&log1, 1, &sink, &sink, &timers);
+  rlc2.init(&log2, 1, &sink, &sink, &timers);
+
+  LIBLTE_RRC_RLC_CONFIG_STRUCT cnfg;
+  cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
+  cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS0;
+  cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS0;
+  cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS5;
+  cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T32;
+  cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
+  cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
+
+  rlc1.configure(&cnfg);
+  rlc2.configure(&cnfg);
+
+  srand(1234);
+
+  inline_byte_buffer_t pdu;
+  uint32_t       n_written = 0;
+  uint32_t       n_pdus    = 0;
+  uint32_t       n_lost    = 0;
+  uint32_t       last_rx   = 0;
+  struct timeval t[3];
+  struct timeval last_progress;
+  gettimeofday(&t[1], NULL);
+  last_progress = t[1];
+
+  while(sink.n_sdus < nof_sdus)
+  {
+    // Keep a few SDUs queued, the SDU queue blocks when full
+    while(rlc1.get_total_buffer_state() < 4*sdu_len) {
+      byte_buffer_t *sdu = pool_allocate;
+      assert(sdu);
+      memset(sdu->msg, n_written&0xff, sdu_len);
+      memcpy(sdu->msg, &n_written, sizeof(n_written));
+      sdu->N_bytes = sdu_len;
+      rlc1.write_sdu(sdu);
+      n_written++;
+    }
+
+    if(rlc1.get_buffer_state() > 0) {
+      pdu.N_bytes = rlc1.read_pdu(pdu.msg, grant);
+      n_pdus++;
+      if((float) rand()/RAND_MAX < loss) {
+        n_lost++;
+      } else if(pdu.N_bytes > 0) {
+        rlc2.write_pdu(pdu.msg, pdu.N_bytes);
+      }
+    }
+
+    // Status PDUs are never lost
+    if(rlc2.get_buffer_state() > 0) {
+      pdu.N_bytes = rlc2.read_pdu(pdu.msg, SRSLTE_MAX_BUFFER_SIZE_BYTES);
+      rlc1.write_pdu(pdu.msg, pdu.N_bytes);
+    }
+
+    gettimeofday(&t[2], NULL);
+    if(sink.n_sdus != last_rx) {
+      last_rx       = sink.n_sdus;
+      last_progress = t[2];
+    } else if(t[2].tv_sec - last_progress.tv_sec > 2) {
+      printf("Stalled after %d SDUs\n", sink.n_sdus);
+      break;
+    }
+  }
+  get_time_interval(t);
+
+  double secs   = t[0].tv_sec + 1e-6*t[0].tv_usec;
+  double copied = rlc1.get_copied_bytes() + rlc2.get_copied_bytes();
+  printf("Loss %4.1f%%: %d SDUs in %d PDUs (%d lost) in %.3f s: %.1f Mbps, %.1f kSDU/s, %.2f bytes copied per byte\n",
+         100*loss, sink.n_sdus, n_pdus, n_lost, secs,
+         secs>0?8e-6*sink.n_bytes/secs:0, secs>0?1e-3*sink.n_sdus/secs:0,
+         sink.n_bytes>0?copied/sink.n_bytes:0);
+
+  assert(sink.n_sdus >= nof_sdus);
+  assert(sink.n_errors == 0);
+  pool->cleanup();
+}
+
 int main(int argc, char **argv) {
   basic_test();
   byte_buffer_pool::get_instance()->cleanup();
@@ -1052,4 +1197,10 @@ int main(int argc, char **argv) {
   resegment_test_5();
   byte_buffer_pool::get_instance()->cleanup();
   resegment_test_6();
+  byte_buffer_pool::get_instance()->cleanup();
+  throughput_test(0);
+  byte_buffer_pool::get_instance()->cleanup();
+  throughput_test(0.01);
+  byte_buffer_pool::get_instance()->cleanup();
+  throughput_test(0.1);
 }
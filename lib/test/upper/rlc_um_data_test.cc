@@ -40,7 +40,7 @@ using namespace srsue;
 
 int main(int argc, char **argv) {
   srslte::rlc_umd_pdu_header_t h;
-  srslte::byte_buffer_t  b1,b2;
+  srslte::inline_byte_buffer_t b1,b2;
 
   memcpy(b1.msg, &pdu1[0], PDU1_LEN);
   b1.N_bytes = PDU1_LEN;
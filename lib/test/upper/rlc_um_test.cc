@@ -108,7 +108,7 @@ void basic_test()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     *sdu_bufs[i].msg    = i; // Write the index into the buffer
@@ -119,7 +119,7 @@ void basic_test()
   assert(13 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (1 byte each)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     len = rlc1.read_pdu(pdu_bufs[i].msg, 3); // 3 bytes for header + payload
@@ -176,7 +176,7 @@ void loss_test()
   rlc2.configure(&cnfg);
 
   // Push 5 SDUs into RLC1
-  byte_buffer_t sdu_bufs[NBUFS];
+  inline_byte_buffer_t sdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     *sdu_bufs[i].msg    = i; // Write the index into the buffer
@@ -187,7 +187,7 @@ void loss_test()
   assert(13 == rlc1.get_buffer_state());
 
   // Read 5 PDUs from RLC1 (1 byte each)
-  byte_buffer_t pdu_bufs[NBUFS];
+  inline_byte_buffer_t pdu_bufs[NBUFS];
   for(int i=0;i<NBUFS;i++)
   {
     len = rlc1.read_pdu(pdu_bufs[i].msg, 3); // 3 bytes for header + payload
@@ -110,6 +110,7 @@ typedef struct {
   int           s1ap_hex_limit;
   int           all_hex_limit;
   std::string   filename;
+  bool          deferred;
 }log_args_t;
 
 typedef struct {
@@ -73,6 +73,7 @@ public:
   int rach_detected(uint32_t tti, uint32_t preamble_idx, uint32_t time_adv); 
   
   int cqi_info(uint32_t tti, uint16_t rnti, uint32_t cqi_value); 
+  int cqi_subband_info(uint32_t tti, uint16_t rnti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi_value); 
   int snr_info(uint32_t tti, uint16_t rnti, float snr); 
   int ack_info(uint32_t tti, uint16_t rnti, bool ack); 
   int crc_info(uint32_t tti, uint16_t rnti, uint32_t nof_bytes, bool crc_res); 
@@ -122,7 +123,8 @@ public:
     NOF_MAC_TIMERS
   } mac_timers_t; 
   
-  static const int MAC_NOF_UPPER_TIMERS = 20; 
+  // One per RLC UM bearer of every user. Only running timers are visited every TTI.
+  static const int MAC_NOF_UPPER_TIMERS = 2048; 
   
 private:  
 
@@ -153,9 +155,12 @@ private:
   sched            scheduler; 
   dl_metric_rr     sched_metric_dl_rr;
   ul_metric_rr     sched_metric_ul_rr;
+  dl_metric_pf     sched_metric_dl_pf;
+  ul_metric_pf     sched_metric_ul_pf;
 
   /* Map of active UEs */
   std::map<uint16_t, ue*> ue_db;   
+
   uint16_t        last_rnti;   
   
   uint8_t* assemble_rar(sched_interface::dl_sched_rar_grant_t *grants, uint32_t nof_grants, int rar_idx, uint32_t pdu_len);
@@ -222,7 +227,12 @@ private:
     pthread_cond_t  cvar;
     pdu_process_handler *handler; 
   };
-  pdu_process pdu_process_thread;
+  
+  /* UL PDUs of all UEs, pushed by the PHY workers in crc_info() and demultiplexed by the PDU thread */
+  const static int UL_PDU_QUEUE_LEN = 4096; 
+  ul_pdu_queue              ul_pdu_q; 
+  uint32_t                  ue_generation;   // Tags the UEs created by rach_detected(), see ul_pdu_queue 
+  pdu_process               pdu_process_thread;
   
 };
 
@@ -58,6 +58,11 @@ public:
     /* Virtual methods for user metric calculation */
     virtual void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti) = 0;
     virtual dl_harq_proc*   get_user_allocation(sched_ue *user) = 0;
+    
+    /* For metrics that keep their own set of candidate users instead of looking at all of them every TTI. 
+     * ue_ready() follows any event that may give the user something to schedule, ue_rem() precedes its removal */
+    virtual void            ue_ready(sched_ue *user) {}
+    virtual void            ue_rem(sched_ue *user) {}
   };
 
   
@@ -69,6 +74,10 @@ public:
     virtual void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti) = 0;
     virtual ul_harq_proc*  get_user_allocation(sched_ue *user) = 0; 
     virtual void           update_allocation(ul_harq_proc::ul_alloc_t alloc) = 0; 
+    
+    /* Same as in metric_dl */
+    virtual void           ue_ready(sched_ue *user) {}
+    virtual void           ue_rem(sched_ue *user) {}
   };
 
   
@@ -105,6 +114,7 @@ public:
   int dl_ack_info(uint32_t tti, uint16_t rnti, bool ack);
   int dl_rach_info(uint32_t tti, uint32_t ra_id, uint16_t rnti, uint32_t estimated_size); 
   int dl_cqi_info(uint32_t tti, uint16_t rnti, uint32_t cqi_value); 
+  int dl_cqi_subband_info(uint32_t tti, uint16_t rnti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi_value); 
   
   int ul_crc_info(uint32_t tti, uint16_t rnti, bool crc);
   int ul_sr_info(uint32_t tti, uint16_t rnti); 
@@ -150,6 +160,7 @@ private:
 
   // This is for computing DCI locations
   srslte_regs_t regs; 
+  sched_tbs_table tbs_table; 
   bool used_cce[MAX_CCE]; 
     
   typedef struct {
@@ -166,6 +177,9 @@ private:
   } sched_sib_t;
 
 
+  void notify_ue_ready(sched_ue *user); 
+  void notify_ue_rem(sched_ue *user); 
+  
   int  dl_sched_bc(dl_sched_bc_t bc[MAX_BC_LIST]); 
   int  dl_sched_rar(dl_sched_rar_t rar[MAX_RAR_LIST]); 
   int  dl_sched_data(dl_sched_data_t data[MAX_DATA_LIST]); 
@@ -27,6 +27,8 @@
 #ifndef SCHED_METRIC_H
 #define SCHED_METRIC_H
 
+#include <set>
+#include <vector>
 #include "mac/scheduler.h"
 
 namespace srsenb {
@@ -36,7 +38,7 @@ class dl_metric_rr : public sched::metric_dl
 public:
   void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti);
   dl_harq_proc*   get_user_allocation(sched_ue *user); 
-private:
+protected:
   
   const static int MAX_RBG = 25; 
   
@@ -66,7 +68,7 @@ public:
   void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti);
   ul_harq_proc*  get_user_allocation(sched_ue *user); 
   void           update_allocation(ul_harq_proc::ul_alloc_t alloc); 
-private:
+protected:
   
   const static int MAX_PRB = 100; 
   
@@ -81,7 +83,85 @@ private:
   uint32_t available_rb;
 };
 
+/* Proportional-fair metrics. Every TTI, the UEs with pending data are put in a max-heap 
+ * keyed by their achievable rate divided by their averaged throughput raised to the 
+ * fairness exponent (1 for proportional fair, 0 for max C/I), and the resources are 
+ * given away by popping the heap until they run out. HARQ retransmissions go first. 
+ * In the DL, each UE gets the free RBGs with the best sub-band CQI. 
+ * 
+ * Only the UEs in the ready set are looked at. The scheduler adds a UE on buffer, SR and 
+ * HARQ events, and the metric drops it when it has nothing pending and all its HARQ 
+ * processes are empty, so idle UEs cost nothing per TTI. 
+ */
+class sched_prio_t
+{
+public:
+  sched_prio_t(sched_ue *user_, bool is_retx_, float prio_) : user(user_), is_retx(is_retx_), prio(prio_) {}
+  bool operator<(const sched_prio_t &other) const {
+    return is_retx != other.is_retx ? !is_retx : prio < other.prio; 
+  }
+  sched_ue *user; 
+  bool      is_retx; 
+  float     prio; 
+};
+
+class dl_metric_pf : public dl_metric_rr
+{
+public:
+  dl_metric_pf(); 
+  void            set_params(uint32_t avg_window_ms, float fairness); 
+  void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti);
+  dl_harq_proc*   get_user_allocation(sched_ue *user); 
+  void            ue_ready(sched_ue *user); 
+  void            ue_rem(sched_ue *user); 
+private:
+  
+  typedef struct {
+    sched_ue     *user; 
+    dl_harq_proc *h; 
+    uint32_t      mask; 
+  } dl_alloc_t; 
+  
+  void     allocate_user(sched_ue *user); 
+  uint32_t select_rbg(sched_ue *user, uint32_t nof_rbg); 
+  
+  float    beta; 
+  float    fairness; 
+  
+  std::set<sched_ue*>       ready; 
+  std::vector<sched_prio_t> heap; 
+  std::vector<dl_alloc_t>   allocs; 
+};
+
+class ul_metric_pf : public ul_metric_rr
+{
+public:
+  ul_metric_pf(); 
+  void           set_params(uint32_t avg_window_ms, float fairness); 
+  void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti);
+  ul_harq_proc*  get_user_allocation(sched_ue *user); 
+  void           ue_ready(sched_ue *user); 
+  void           ue_rem(sched_ue *user); 
+private:
+  
+  typedef struct {
+    sched_ue                *user; 
+    ul_harq_proc            *h; 
+    ul_harq_proc::ul_alloc_t alloc; 
+    bool                     same_alloc; 
+  } ul_alloc_t; 
+  
+  bool     allocate_user(sched_ue *user); 
   
+  float    beta; 
+  float    fairness; 
+  bool     allocated; 
+  
+  std::set<sched_ue*>       ready; 
+  std::vector<sched_prio_t> heap; 
+  std::vector<ul_alloc_t>   allocs; 
+};
+
 }
 
 #endif
@@ -0,0 +1,77 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#ifndef SCHED_TBS_H
+#define SCHED_TBS_H
+
+#include <vector>
+#include "srslte/srslte.h"
+
+namespace srsenb {
+
+/* Per-cell tables of the TBS (in bytes) that the scheduler selects for each CQI, number of PRB 
+ * and, in the DL, number of control symbols, with the maximum MCS of the cell. They are built 
+ * at cell configuration, so sizing a grant is a lookup and finding the minimum number of PRB 
+ * for a number of bytes is a binary search, whatever the bandwidth. 
+ */
+class sched_tbs_table
+{
+public:
+  sched_tbs_table();
+  void     init(srslte_cell_t *cell, int max_mcs_dl, int max_mcs_ul); 
+  
+  bool     has_dl(uint32_t cqi, uint32_t nof_ctrl_symbols, uint32_t max_mcs); 
+  bool     has_ul(uint32_t cqi, uint32_t max_mcs); 
+  
+  int      get_tbs_dl(uint32_t cqi, uint32_t nof_ctrl_symbols, uint32_t nof_prb); 
+  int      get_tbs_ul(uint32_t cqi, uint32_t nof_prb); 
+  
+  // Minimum number of PRB, up to max_prb, with a TBS of at least req_bytes, or 0 if there is none 
+  uint32_t get_min_prb_dl(uint32_t cqi, uint32_t nof_ctrl_symbols, uint32_t req_bytes, uint32_t max_prb); 
+  uint32_t get_min_prb_ul(uint32_t cqi, uint32_t req_bytes, uint32_t max_prb); 
+  
+private: 
+  
+  const static uint32_t NOF_CQI              = 16; 
+  const static uint32_t MAX_NOF_CTRL_SYMBOLS = 4; 
+  
+  static uint32_t min_prb(int *max_tbs, uint32_t req_bytes, uint32_t max_prb); 
+  
+  uint32_t nof_prb; 
+  uint32_t max_mcs_dl; 
+  uint32_t max_mcs_ul; 
+  
+  // TBS and its running maximum over the number of PRB, which is what the search looks at 
+  std::vector<int> tbs_dl; 
+  std::vector<int> max_tbs_dl; 
+  std::vector<int> tbs_ul; 
+  std::vector<int> max_tbs_ul; 
+}; 
+
+}
+
+#endif 
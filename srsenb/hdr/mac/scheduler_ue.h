@@ -32,6 +32,7 @@
 #include "srslte/interfaces/sched_interface.h"
 
 #include "scheduler_harq.h"
+#include "scheduler_tbs.h"
 
 namespace srsenb {
 
@@ -42,6 +43,12 @@ public:
   // used by sched_metric
   uint32_t ue_idx;   
   
+  // Averaged DL/UL bytes per TTI and the TTI of their last update, used by the PF metrics
+  float    dl_avg_bytes; 
+  float    ul_avg_bytes; 
+  uint32_t dl_avg_tti; 
+  uint32_t ul_avg_tti; 
+  
   typedef struct {
     uint32_t cce_start[4][6];
     uint32_t nof_loc[4]; 
@@ -56,7 +63,7 @@ public:
   void reset();
   void phy_config_enabled(uint32_t tti, bool enabled);
   void set_cfg(uint16_t rnti, sched_interface::ue_cfg_t* cfg, sched_interface::cell_cfg_t *cell_cfg, 
-              srslte_regs_t *regs, srslte::log *log_h);
+              srslte_regs_t *regs, sched_tbs_table *tbs_table, srslte::log *log_h);
 
   void set_bearer_cfg(uint32_t lc_id, srsenb::sched_interface::ue_bearer_cfg_t* cfg);
   void rem_bearer(uint32_t lc_id);
@@ -68,6 +75,7 @@ public:
   void ul_recv_len(uint32_t lcid, uint32_t len);
   void set_ul_cqi(uint32_t tti, uint32_t cqi, uint32_t ul_ch_code);
   void set_dl_cqi(uint32_t tti, uint32_t cqi);
+  void set_dl_cqi_subband(uint32_t tti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi);
   int  set_ack_info(uint32_t tti, bool ack);
   void set_ul_crc(uint32_t tti, bool crc_res);
 
@@ -89,6 +97,11 @@ public:
 
   uint32_t   get_required_prb_dl(uint32_t req_bytes, uint32_t nof_ctrl_symbols); 
   uint32_t   get_required_prb_ul(uint32_t req_bytes); 
+  uint32_t   get_required_rbg_dl(uint32_t req_bytes, uint32_t nof_ctrl_symbols); 
+  
+  uint32_t   get_dl_capacity(uint32_t nof_rbg, uint32_t nof_ctrl_symbols); 
+  uint32_t   get_ul_capacity(uint32_t nof_prb); 
+  uint32_t   get_dl_cqi_rbg(uint32_t rbg_idx, uint32_t tti); 
 
   uint32_t   get_pending_dl_new_data(uint32_t tti);
   uint32_t   get_pending_ul_new_data(uint32_t tti);
@@ -96,6 +109,10 @@ public:
   dl_harq_proc *get_pending_dl_harq(uint32_t tti);
   dl_harq_proc *get_empty_dl_harq();   
   ul_harq_proc *get_ul_harq(uint32_t tti);   
+  
+  // True if no HARQ process waits for an ACK or a retransmission 
+  bool       is_dl_harq_empty(); 
+  bool       is_ul_harq_empty(); 
 
 /*******************************************************
  * Functions used by the scheduler object
@@ -116,6 +133,9 @@ public:
   bool       get_pucch_sched(uint32_t current_tti, uint32_t prb_idx[2], uint32_t *L);
   bool       pucch_sr_collision(uint32_t current_tti, uint32_t n_cce); 
   
+  static int cqi_to_tbs(uint32_t cqi, uint32_t nof_prb, uint32_t nof_re, uint32_t max_mcs, uint32_t *mcs);
+  static int alloc_tbs(uint32_t cqi, uint32_t nof_prb, uint32_t nof_re, uint32_t req_bytes, uint32_t max_mcs, int *mcs); 
+  
 private: 
   
   typedef struct {
@@ -129,9 +149,9 @@ private:
   uint32_t   get_pending_ul_old_data();  
   int        alloc_pdu(int tbs, sched_interface::dl_sched_pdu_t* pdu);  
 
+  uint32_t   get_dl_cqi_mask(uint32_t rbgmask, uint32_t tti); 
+  
   static uint32_t format1_count_prb(uint32_t bitmask, uint32_t cell_nof_prb); 
-  static int cqi_to_tbs(uint32_t cqi, uint32_t nof_prb, uint32_t nof_re, uint32_t max_mcs, uint32_t *mcs);
-  static int alloc_tbs(uint32_t cqi, uint32_t nof_prb, uint32_t nof_re, uint32_t req_bytes, uint32_t max_mcs, int *mcs); 
   
   static bool bearer_is_ul(ue_bearer_t *lch);
   static bool bearer_is_dl(ue_bearer_t *lch);
@@ -142,6 +162,7 @@ private:
   sched_interface::ue_cfg_t cfg; 
   srslte_cell_t cell; 
   srslte::log* log_h;
+  sched_tbs_table *tbs_table; 
   
   /* Buffer states */
   bool sr; 
@@ -152,6 +173,13 @@ private:
   int      power_headroom; 
   uint32_t dl_cqi;
   uint32_t dl_cqi_tti; 
+  
+  // Sub-band CQI per RBG, used instead of the wideband CQI for SCHED_SB_CQI_VALID_MS after the report 
+  const static int SCHED_MAX_RBG         = 25; 
+  const static int SCHED_SB_CQI_VALID_MS = 80; 
+  uint32_t dl_cqi_rbg[SCHED_MAX_RBG];
+  int      dl_cqi_rbg_tti[SCHED_MAX_RBG]; 
+  
   uint32_t cqi_request_tti; 
   uint32_t ul_cqi; 
   uint32_t ul_cqi_tti; 
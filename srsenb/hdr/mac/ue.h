@@ -30,24 +30,38 @@
 #include "srslte/common/log.h"
 #include "srslte/common/pdu.h"
 #include "srslte/common/mac_pcap.h"
-#include "srslte/common/pdu_queue.h"
+#include "srslte/common/buffer_pool.h"
+#include "srslte/common/ring_queue.h"
 #include "srslte/interfaces/enb_interfaces.h"
 #include "srslte/interfaces/sched_interface.h"
 #include <pthread.h>
+#include <map>
 #include "mac/mac_metrics.h"
 
 namespace srsenb {
+
+// UL MAC PDU received with a correct CRC, waiting for the PDU thread to demultiplex it 
+typedef struct {
+  uint16_t               rnti; 
+  uint32_t               generation; 
+  uint32_t               tti; 
+  srslte::byte_buffer_t *pdu; 
+} ul_pdu_t; 
+
+class ul_pdu_queue; 
   
-class ue : public srslte::read_pdu_interface, 
-           public srslte::pdu_queue::process_callback
+class ue : public srslte::read_pdu_interface
 {
 public:
   
-  ue() : mac_msg_dl(20), mac_msg_ul(20), pdus(128) {
+  ue() : mac_msg_dl(20), mac_msg_ul(20) {
     rlc   = NULL; 
     log_h = NULL; 
     rnti  = 0; 
     pcap  = NULL;
+    pool  = NULL; 
+    ul_pdu_q = NULL; 
+    generation = 0; 
     nof_failures = 0; 
     phr_counter = 0; 
     is_phy_added = false; 
@@ -58,6 +72,11 @@ public:
   }
   
   virtual ~ue() {
+    for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
+      if (pending_buffers[i]) {
+        pool->deallocate(pending_buffers[i]);
+      }
+    }
     pthread_mutex_destroy(&mutex);
   }
   
@@ -66,14 +85,15 @@ public:
   void     start_pcap(srslte::mac_pcap* pcap_);
   void     set_tti(uint32_t tti); 
   
-  void     config(uint16_t rnti, uint32_t nof_prb, sched_interface *sched, rrc_interface_mac *rrc_, rlc_interface_mac *rlc, srslte::log *log_h);
+  void     config(uint16_t rnti, uint32_t nof_prb, sched_interface *sched, rrc_interface_mac *rrc_, rlc_interface_mac *rlc, srslte::log *log_h, 
+                  ul_pdu_queue *ul_pdu_q, uint32_t generation);
+  uint32_t get_generation();
   uint8_t* generate_pdu(sched_interface::dl_sched_pdu_t pdu[sched_interface::MAX_RLC_PDU_LIST], 
                     uint32_t nof_pdu_elems, uint32_t grant_size);
   
   srslte_softbuffer_tx_t* get_tx_softbuffer(uint32_t harq_process);
   srslte_softbuffer_rx_t* get_rx_softbuffer(uint32_t tti);
   
-  bool     process_pdus(); 
   uint8_t *request_buffer(uint32_t tti, uint32_t len); 
   void     process_pdu(uint8_t *pdu, uint32_t nof_bytes, uint32_t tstamp);
   void     push_pdu(uint32_t tti, uint32_t len); 
@@ -106,6 +126,9 @@ private:
   
   uint16_t rnti; 
   
+  // Distinguishes this UE from earlier UEs with the same RNTI 
+  uint32_t generation; 
+  
   uint32_t last_tti; 
   
   uint32_t nof_failures; 
@@ -114,14 +137,15 @@ private:
   srslte_softbuffer_tx_t softbuffer_tx[NOF_HARQ_PROCESSES];
   srslte_softbuffer_rx_t softbuffer_rx[NOF_HARQ_PROCESSES];
 
-  uint8_t *pending_buffers[NOF_HARQ_PROCESSES]; 
+  srslte::byte_buffer_t *pending_buffers[NOF_HARQ_PROCESSES]; 
   
   // For DL there is a single buffer 
   const static int payload_buffer_len = 128*1024; 
   uint8_t          tx_payload_buffer[payload_buffer_len];
   
-  // For UL there are multiple buffers per PID and are managed by pdu_queue
-  srslte::pdu_queue pdus; 
+  // For UL there is a buffer per PID from the common pool. Received PDUs are queued for the PDU thread 
+  srslte::byte_buffer_pool *pool; 
+  ul_pdu_queue             *ul_pdu_q; 
   srslte::sch_pdu mac_msg_dl, mac_msg_ul;
   
   rlc_interface_mac *rlc; 
@@ -136,6 +160,31 @@ private:
   
 };
 
+// UL MAC PDUs of all UEs, pushed by the PHY workers in crc_info() and demultiplexed by the PDU thread. 
+// A PDU is only delivered to the UE of the same generation that received it, so that the PDUs still 
+// queued for a removed UE are not delivered to a new UE that reuses its RNTI 
+class ul_pdu_queue
+{
+public:
+  ul_pdu_queue(uint32_t capacity) : q(capacity) {
+    pool = srslte::byte_buffer_pool::get_instance(); 
+  }
+  ~ul_pdu_queue() {
+    clear(); 
+  }
+  
+  bool     push(const ul_pdu_t &pdu); 
+  // Pops and processes up to MAX_POP PDUs. Returns the number of PDUs popped 
+  uint32_t process(std::map<uint16_t, ue*> &ue_db, srslte::log *log_h); 
+  // Returns the PDUs still queued to the pool without processing them 
+  void     clear(); 
+  
+private:
+  const static uint32_t MAX_POP = 16; 
+  srslte::mpsc_queue<ul_pdu_t> q; 
+  srslte::byte_buffer_pool    *pool; 
+};
+
 }
 
 #endif
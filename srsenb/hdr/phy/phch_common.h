@@ -34,18 +34,27 @@
 #include "srslte/common/log.h"
 #include "srslte/common/threads.h"
 #include "srslte/common/thread_pool.h"
+#include "srslte/common/task_pool.h"
 #include "srslte/radio/radio.h"
+#include "phy/phy_ue_db.h"
 
 namespace srsenb {
 
 typedef struct {
   float max_prach_offset_us; 
   int pusch_max_its;
+  int pusch_sf_max_its; 
+  int pusch_cb_threads; 
   float tx_amplitude; 
   int nof_phy_threads;  
   std::string equalizer_mode; 
   float estimator_fil_w;   
   bool       pregenerate_signals;
+  bool       pipeline;
+  int        nof_ul_threads;
+  int        nof_dl_threads;
+  float      pipeline_ul_budget_us;
+  int        nof_grant_threads; 
 } phy_args_t; 
 
 class phch_common
@@ -56,6 +65,9 @@ public:
   phch_common(uint32_t max_mutex_) : tx_mutex(max_mutex_) {
     max_mutex = max_mutex_; 
     params.max_prach_offset_us = 20; 
+    params.pipeline            = false; 
+    params.nof_grant_threads   = 0; 
+    pthread_mutex_init(&pending_ack_mutex, NULL);
   }
   
   bool init(srslte_cell_t *cell, srslte::radio *radio_handler, mac_interface_phy *mac);  
@@ -66,6 +78,24 @@ public:
 
   void worker_end(uint32_t tx_mutex_cnt, cf_t *buffer, uint32_t nof_samples, srslte_timestamp_t tx_time);
 
+  /* Pipeline mode: the UL stage of tti_rx signals the DL stage transmitting in tti_rx+4, which needs 
+   * its CRC results for the PHICH and the UL grants. The wait returns false if the deadline expires first. 
+   */
+  void ul_stage_done(uint32_t tti_rx);
+  bool ul_stage_wait(uint32_t tti_rx, struct timespec *deadline);
+
+  // Scratch state of a thread decoding a PUSCH or encoding a PDSCH grant 
+  typedef struct {
+    srslte_enb_ul_pusch_dec_t ul; 
+    srslte_enb_dl_pdsch_enc_t dl; 
+  } grant_ctx_t; 
+  bool grant_ctx_init(grant_ctx_t *ctx);
+  void grant_ctx_free(grant_ctx_t *ctx);
+  
+  // Threads sharing the PUSCH and PDSCH grants of the subframes of all workers 
+  bool grant_pool_init(uint32_t nof_threads, int prio);
+  srslte::task_pool grant_pool; 
+  
   // Common objects
   srslte_cell_t                     cell; 
   srslte_refsignal_dmrs_pusch_cfg_t pusch_cfg; 
@@ -76,22 +106,24 @@ public:
   srslte::radio     *radio;
   mac_interface_phy *mac; 
   
+  // Per-UE state of all workers 
+  phy_ue_db ue_db; 
+  
   // Common objects for schedulign grants 
   mac_interface_phy::ul_sched_t ul_grants[10];
   mac_interface_phy::dl_sched_t dl_grants[10];
   
-  // Map of pending ACKs for each user 
-  typedef struct {
-    bool is_pending[10]; 
-    uint16_t n_pdcch[10];
-  } pending_ack_t;
-  std::map<uint16_t,pending_ack_t> pending_ack;
-  
+  // Pending ACKs and PHICH resources of each user. In pipeline mode the UL and DL stages of 
+  // different workers access them concurrently with the addition and removal of users 
   void ack_add_rnti(uint16_t rnti);
   void ack_rem_rnti(uint16_t rnti);
   void ack_clear(uint32_t sf_idx); 
   void ack_set_pending(uint32_t sf_idx, uint16_t rnti, uint32_t n_pdcch);
   bool ack_is_pending(uint32_t sf_idx, uint16_t rnti, uint32_t *last_n_pdcch = NULL);
+
+  // PHICH resources of the PUSCH received in sf_idx, saved by the UL processing for the DL processing
+  void phich_set_info(uint32_t sf_idx, uint16_t rnti, srslte_enb_ul_phich_info_t *info);
+  void phich_get_info(uint32_t sf_idx, uint16_t rnti, srslte_enb_ul_phich_info_t *info);
         
 private:
   std::vector<pthread_mutex_t>    tx_mutex; 
@@ -102,6 +134,20 @@ private:
   uint32_t        nof_mutex;
   uint32_t        max_mutex;
   
+  std::vector<grant_ctx_t*> grant_pool_ctx; 
+  
+  bool            running; 
+  int             ul_stage_tti[10];
+  pthread_mutex_t ul_stage_mutex; 
+  pthread_cond_t  ul_stage_cvar; 
+
+  typedef struct {
+    bool is_pending[10]; 
+    uint16_t n_pdcch[10];
+    srslte_enb_ul_phich_info_t phich_info[10];
+  } pending_ack_t;
+  std::map<uint16_t,pending_ack_t> pending_ack;
+  pthread_mutex_t pending_ack_mutex; 
 };
 
 } // namespace srsenb
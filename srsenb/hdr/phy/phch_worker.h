@@ -40,30 +40,27 @@ class phch_worker : public srslte::thread_pool::worker
 {
 public:
   
+  // Part of the subframe processing run by the worker. The pipeline mode runs each stage in its own pool
+  typedef enum {
+    STAGE_ALL = 0, 
+    STAGE_UL, 
+    STAGE_DL
+  } stage_t; 
+  
   phch_worker();
-  void  init(phch_common *phy, srslte::log *log_h);
+  void  init(phch_common *phy, srslte::log *log_h, stage_t stage = STAGE_ALL);
   void  reset(); 
   
   cf_t *get_buffer_rx();
   void set_time(uint32_t tti, uint32_t tx_mutex_cnt, srslte_timestamp_t tx_time);
   
-  int  add_rnti(uint16_t rnti);
-  void rem_rnti(uint16_t rnti);
-  uint32_t get_nof_rnti(); 
-  
   /* These are used by the GUI plotting tools */
   int read_ce_abs(float *ce_abs);
   int read_pusch_d(cf_t *pusch_d);
   void start_plot();
   
   
-  void set_config_dedicated(uint16_t rnti, 
-                            srslte_uci_cfg_t *uci_cfg, 
-                            srslte_pucch_sched_t *pucch_sched,
-                            srslte_refsignal_srs_cfg_t *srs_cfg, 
-                            uint32_t I_sr, bool pucch_cqi, uint32_t pmi_idx, bool pucch_cqi_ack);
-  
-  uint32_t get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]);
+  void get_stage_metrics(phy_stage_metrics_t *ul, phy_stage_metrics_t *dl);
   
 private: 
   
@@ -71,6 +68,9 @@ private:
   const static float PUCCH_RL_CORR_TH = 0.1; 
   
   void work_imp();
+  void work_ul();
+  void work_dl();
+  void stage_metrics_add(phy_stage_metrics_t *m, bool late);
   
   int encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants, uint32_t sf_idx);
   int decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch, uint32_t tti_rx);
@@ -91,30 +91,60 @@ private:
   srslte_enb_dl_t enb_dl;
   srslte_enb_ul_t enb_ul;
   
-  srslte_timestamp_t tx_time; 
-
-  // Class to store user information 
-  class ue {
+  /* PUSCH and PDSCH grants of the subframe. With grant threads configured, they are decoded and 
+   * encoded by the grant pool and the results of all PUSCH are reported to MAC once all are done. 
+   */
+  class pusch_task : public srslte::task_pool::task
+  {
+  public:
+    void run_task(void *arg);
+    void decode(srslte_enb_ul_pusch_dec_t *dec);
+    
+    phch_worker           *w; 
+    srslte_enb_ul_pusch_t *grant; 
+    srslte_ra_ul_grant_t   phy_grant; 
+    srslte_uci_data_t      uci_data; 
+    srslte_cqi_value_t     cqi_value;
+    bool                   cqi_enabled; 
+    uint32_t               its_budget; 
+    uint32_t               tti; 
+    
+    int                    res; 
+    float                  snr_db; 
+    uint32_t               noi; 
+    float                  noi_spent; 
+    float                  noi_saved; 
+    uint32_t               n_prb_lowest; 
+    int                    dec_time_us; 
+  }; 
+  
+  class pdsch_task : public srslte::task_pool::task
+  {
   public:
-    ue() : I_sr(0), I_sr_en(false), cqi_en(false), pucch_cqi_ack(false), pmi_idx(0), has_grant_tti(0) {bzero(&metrics, sizeof(phy_metrics_t));}
-    uint32_t I_sr; 
-    uint32_t pmi_idx;
-    bool I_sr_en; 
-    bool cqi_en;
-    bool pucch_cqi_ack; 
-    int has_grant_tti; 
-    uint32_t rnti; 
-    srslte_enb_ul_phich_info_t phich_info;
-    void metrics_read(phy_metrics_t *metrics);
-    void metrics_dl(uint32_t mcs);
-    void metrics_ul(uint32_t mcs, float rssi, float sinr, uint32_t turbo_iters);
-  private:
-    phy_metrics_t metrics; 
+    void run_task(void *arg);
+    void encode(srslte_enb_dl_pdsch_enc_t *enc);
+    
+    phch_worker           *w; 
+    srslte_enb_dl_pdsch_t *grant; 
+    srslte_ra_dl_grant_t   phy_grant; 
+    uint32_t               sf_idx; 
+    int                    res; 
   }; 
-  std::map<uint16_t,ue> ue_db;   
   
-  // mutex to protect worker_imp() from configuration interface 
-  pthread_mutex_t mutex; 
+  pusch_task pusch_tasks[mac_interface_phy::MAX_GRANTS];
+  pdsch_task pdsch_tasks[mac_interface_phy::MAX_GRANTS];
+  phch_common::grant_ctx_t grant_ctx; 
+  
+  srslte_timestamp_t tx_time; 
+  
+  stage_t             stage; 
+  struct timeval      t_start; 
+  phy_stage_metrics_t ul_stage_metrics; 
+  phy_stage_metrics_t dl_stage_metrics; 
+
+  // UEs borrowed from the common database for the subframe, and which of them have a PUSCH grant in it 
+  std::vector<phy_ue_db::ue*> ues; 
+  std::vector<bool>           ue_has_grant; 
 };
 
 } // namespace srsenb
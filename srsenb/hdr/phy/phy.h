@@ -69,10 +69,13 @@ public:
   void set_config_dedicated(uint16_t rnti, LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT* dedicated);
   
   void get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]);
+  void get_mem_metrics(phy_ue_mem_metrics_t *metrics);
+  void get_stage_metrics(phy_stage_metrics_t *ul, phy_stage_metrics_t *dl);
   
 private:
     
   uint32_t nof_workers; 
+  uint32_t nof_ul_workers; 
   
   const static int MAX_WORKERS         = 4;
   const static int DEFAULT_WORKERS     = 2;
@@ -80,10 +83,12 @@ private:
   const static int PRACH_WORKER_THREAD_PRIO = 80; 
   const static int SF_RECV_THREAD_PRIO = 1;
   const static int WORKERS_THREAD_PRIO = 0; 
+  const static int GRANT_THREAD_PRIO   = 0; 
   
   srslte::radio         *radio_handler;
 
   srslte::thread_pool      workers_pool;
+  srslte::thread_pool      dl_workers_pool;
   std::vector<phch_worker> workers;
   phch_common              workers_common; 
   prach_worker             prach; 
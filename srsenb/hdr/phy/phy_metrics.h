@@ -38,6 +38,8 @@ struct ul_metrics_t
   float sinr;
   float rssi;
   float turbo_iters;
+  float turbo_iters_spent;
+  float turbo_iters_saved;
   float mcs;
   int n_samples;
 };
@@ -54,6 +56,26 @@ struct phy_metrics_t
   ul_metrics_t   ul;
 };
 
+// PHY processing latency of the UL (decode) and DL (encode) stages, from the reception of the subframe 
+
+struct phy_stage_metrics_t
+{
+  float avg_us;
+  float max_us;
+  int   n_samples;
+  int   nof_late;   // DL stage only: subframes sent before the UL stage they depend on had finished
+};
+
+// Memory held for the PHY state of each UE, which all workers share instead of keeping a copy each
+
+struct phy_ue_mem_metrics_t
+{
+  int   nof_ues;
+  int   nof_workers;
+  float bytes_per_ue;
+  float saved_bytes_per_ue;
+};
+
 } // namespace srsenb
 
 #endif // ENB_PHY_METRICS_H
@@ -0,0 +1,117 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#ifndef ENBPHYUEDB_H
+#define ENBPHYUEDB_H
+
+#include <map>
+#include <vector>
+#include <pthread.h>
+
+#include "srslte/srslte.h"
+#include "upper/common_enb.h"
+#include "phy/phy_metrics.h"
+
+namespace srsenb {
+
+/* PHY state of the UEs, shared by all workers. The PUSCH, PUCCH and PDSCH sequences and the UCI 
+ * configuration of a UE are held once, in the enb_ul/enb_dl objects of the first worker, which the 
+ * other workers share their users with. The rest of its state is kept in an entry at a dense index. 
+ * 
+ * A worker borrows the entries of all UEs while it processes a subframe. A UE removed meanwhile is 
+ * freed, along with its sequences, when the last worker borrowing it releases it. 
+ */
+class phy_ue_db
+{
+public:
+  
+  class ue {
+  public:
+    uint16_t rnti; 
+    uint32_t idx;    // Dense index, below the capacity returned by acquire() 
+    uint32_t I_sr; 
+    uint32_t pmi_idx;
+    bool     I_sr_en; 
+    bool     cqi_en;
+    bool     pucch_cqi_ack; 
+    
+    void metrics_read(phy_metrics_t *metrics);
+    void metrics_dl(uint32_t mcs);
+    void metrics_ul(uint32_t mcs, float rssi, float sinr, uint32_t turbo_iters, 
+                    float turbo_iters_spent, float turbo_iters_saved);
+  private:
+    friend class phy_ue_db; 
+    ue(uint16_t rnti, uint32_t idx); 
+    ~ue(); 
+    
+    uint32_t        nof_refs; 
+    uint32_t        nof_bytes; 
+    
+    // Updated by the UL and DL processing of any worker 
+    phy_metrics_t   metrics; 
+    pthread_mutex_t metrics_mutex; 
+  }; 
+  
+  phy_ue_db(); 
+  ~phy_ue_db(); 
+  
+  // Called by each worker. The first one holds the users of all of them 
+  void add_worker(srslte_enb_ul_t *enb_ul, srslte_enb_dl_t *enb_dl); 
+  
+  int  add_rnti(uint16_t rnti);
+  void rem_rnti(uint16_t rnti);
+  int  set_config_dedicated(uint16_t rnti, 
+                            srslte_uci_cfg_t *uci_cfg, 
+                            srslte_pucch_sched_t *pucch_sched,
+                            srslte_refsignal_srs_cfg_t *srs_cfg, 
+                            uint32_t I_sr, bool pucch_cqi, uint32_t pmi_idx, bool pucch_cqi_ack);
+  
+  // Borrows all UEs, sorted by RNTI, until release(). Returns the number of dense indices 
+  uint32_t acquire(std::vector<ue*> *ues); 
+  void     release(std::vector<ue*> *ues); 
+  static ue* find(std::vector<ue*> *ues, uint16_t rnti); 
+  
+  uint32_t get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]);
+  void     get_mem_metrics(phy_ue_mem_metrics_t *metrics); 
+  
+private:
+  void put(ue *u); 
+  bool has_users(uint16_t rnti, ue *except); 
+  
+  srslte_enb_ul_t *enb_ul; 
+  srslte_enb_dl_t *enb_dl; 
+  uint32_t         nof_workers; 
+  
+  std::vector<ue*>             ues;       // Indexed by ue::idx, NULL if free 
+  std::vector<uint32_t>        free_idx; 
+  std::map<uint16_t, uint32_t> rnti_idx;  // UEs not removed 
+  pthread_mutex_t              mutex; 
+};
+
+} // namespace srsenb
+
+#endif // ENBPHYUEDB_H
@@ -47,7 +47,8 @@ public:
             phch_common *worker_com, 
             prach_worker *prach, 
             srslte::log *log_h, 
-            uint32_t prio);
+            uint32_t prio, 
+            srslte::thread_pool *_dl_workers_pool = NULL);
   void stop();
     
   const static int MUTEX_X_WORKER = 4; 
@@ -59,8 +60,10 @@ private:
   srslte::radio        *radio_h;
   srslte::log          *log_h;
   srslte::thread_pool  *workers_pool;
+  srslte::thread_pool  *dl_workers_pool;
   prach_worker         *prach; 
   phch_common          *worker_com;
+  cf_t                 *ul_drop_buffer; 
     
   uint32_t tx_mutex_cnt; 
   uint32_t nof_tx_mutex; 
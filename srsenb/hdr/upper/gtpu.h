@@ -25,9 +25,10 @@
  */
 
 #include <string.h>
-#include <map>
+#include <sys/socket.h>
 
 #include "srslte/common/buffer_pool.h"
+#include "srslte/common/ring_queue.h"
 #include "srslte/common/log.h"
 #include "upper/common_enb.h"
 #include "srslte/common/threads.h"
@@ -64,6 +65,44 @@ typedef struct{
   uint32_t  teid;
 }gtpu_header_t;
 
+/****************************************************************************
+ * TEID table
+ * Open addressing hash table mapping the local (incoming) TEID of a bearer 
+ * to its RNTI, LCID and remote (outgoing) TEID. Not thread-safe. 
+ ***************************************************************************/
+class gtpu_teid_table
+{
+public:
+  typedef struct {
+    uint32_t teid_in; 
+    uint32_t teid_out; 
+    uint16_t rnti; 
+    uint16_t lcid; 
+  } entry_t; 
+  
+  gtpu_teid_table(uint32_t log2_capacity = 12);
+  ~gtpu_teid_table();
+  bool     add(uint32_t teid_in, uint32_t teid_out, uint16_t rnti, uint16_t lcid);
+  bool     rem(uint32_t teid_in);
+  entry_t* find(uint32_t teid_in);
+  uint32_t size();
+  
+private:
+  typedef enum {
+    EMPTY = 0, USED, DELETED
+  } state_t; 
+  
+  uint32_t hash(uint32_t teid) { return (teid*2654435761u) >> (32-log2_capacity); }
+  void     resize(uint32_t new_log2_capacity);
+  
+  entry_t  *entries; 
+  uint8_t  *state; 
+  uint32_t  log2_capacity; 
+  uint32_t  capacity; 
+  uint32_t  nof_used;
+  uint32_t  nof_deleted; 
+};
+
 class gtpu
     :public gtpu_interface_rrc
     ,public gtpu_interface_pdcp
@@ -86,6 +125,10 @@ public:
 private:
   static const int THREAD_PRIO = 7;
   static const int GTPU_PORT   = 2152;
+  // Maximum number of datagrams received or sent in a single system call
+  static const uint32_t BATCH_SIZE = 32;
+  // Receive buffers hold an IP packet of the default 1500 byte MTU and its GTP-U header
+  static const uint32_t RX_BUFFER_BYTES = 1500 + GTPU_HEADER_LEN;
   srslte::byte_buffer_pool         *pool;
   bool                         running;
   bool                         run_enable;
@@ -95,16 +138,29 @@ private:
   srsenb::pdcp_interface_gtpu *pdcp;
   srslte::log                 *gtpu_log;
 
-  typedef struct{
-    uint32_t teids_in[SRSENB_N_RADIO_BEARERS];
-    uint32_t teids_out[SRSENB_N_RADIO_BEARERS];
-  }bearer_map;
-  std::map<uint16_t, bearer_map> rnti_bearers;
+  gtpu_teid_table              bearers;
 
   srslte_netsink_t      snk;
   srslte_netsource_t    src;
 
   void run_thread();
+  uint32_t allocate_rx_batch(srslte::byte_buffer_t **pdus, struct mmsghdr *msgs, struct iovec *iovs);
+  
+  /* Thread that sends uplink PDUs to the S-GW in batches */
+  class tx_process : public thread {
+  public: 
+    tx_process() : tx_queue(TX_QUEUE_SIZE) {}
+    void init(gtpu *parent_); 
+    void push(srslte::byte_buffer_t *pdu);
+    void stop();
+  private:
+    void run_thread();
+    gtpu *parent; 
+    bool  running; 
+    static const uint32_t TX_QUEUE_SIZE = 4096;
+    srslte::mpsc_queue<srslte::byte_buffer_t*> tx_queue;
+  };
+  tx_process tx_thread; 
   
   pthread_mutex_t mutex; 
 
@@ -118,7 +174,6 @@ private:
   /****************************************************************************
    * TEID to RNIT/LCID helper functions
    ***************************************************************************/
-  void teidin_to_rntilcid(uint32_t teidin, uint16_t *rnti, uint16_t *lcid);
   void rntilcid_to_teidin(uint16_t rnti, uint16_t lcid, uint32_t *teidin);
 };
 
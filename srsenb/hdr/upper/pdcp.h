@@ -58,6 +58,7 @@ public:
                        uint8_t *k_rrc_int_,
                        srslte::CIPHERING_ALGORITHM_ID_ENUM cipher_algo_,
                        srslte::INTEGRITY_ALGORITHM_ID_ENUM integ_algo_);
+  void enable_encryption(uint16_t rnti, uint32_t lcid);
   
 private: 
   
@@ -177,7 +177,7 @@ public:
     void send_connection_reest_rej(); 
     void send_connection_reconf(srslte::byte_buffer_t *sdu);
     void send_connection_reconf_new_bearer(LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT *e);
-    void send_connection_reconf_upd(srslte::byte_buffer_t *pdu); 
+    void send_connection_reconf_upd(srslte::byte_buffer_t *pdu = NULL); 
     void send_security_mode_command();
     void send_ue_cap_enquiry();
     void parse_ul_dcch(uint32_t lcid, srslte::byte_buffer_t* pdu);
@@ -294,9 +294,9 @@ private:
                           srslte::INTEGRITY_ALGORITHM_ID_ENUM integ_algo);
 
   srslte::byte_buffer_pool  *pool;
-  srslte::bit_buffer_t  bit_buf;
-  srslte::bit_buffer_t  bit_buf_paging;
-  srslte::byte_buffer_t erab_info;
+  LIBLTE_BIT_MSG_STRUCT bit_buf;
+  LIBLTE_BIT_MSG_STRUCT bit_buf_paging;
+  srslte::inline_byte_buffer_t erab_info;
     
   phy_interface_rrc    *phy;
   mac_interface_rrc    *mac;
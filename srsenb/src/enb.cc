@@ -66,11 +66,13 @@ bool enb::init(all_args_t *args_)
 {
   args     = args_;
 
-  logger.init(args->log.filename);
+  logger.init(args->log.filename, args->log.deferred);
   rf_log.init("RF  ", &logger);
   
-  // Create array of pointers to phy_logs 
-  for (int i=0;i<args->expert.phy.nof_phy_threads;i++) {
+  // Create array of pointers to phy_logs, one per PHY worker 
+  int nof_phy_logs = args->expert.phy.pipeline ? args->expert.phy.nof_ul_threads + args->expert.phy.nof_dl_threads 
+                                               : args->expert.phy.nof_phy_threads; 
+  for (int i=0;i<nof_phy_logs;i++) {
     srslte::log_filter *mylog = new srslte::log_filter;
     char tmp[16];
     sprintf(tmp, "PHY%d",i);
@@ -87,7 +89,7 @@ bool enb::init(all_args_t *args_)
   // Init logs
   logger.log("\n\n");
   rf_log.set_level(srslte::LOG_LEVEL_INFO);
-  for (int i=0;i<args->expert.phy.nof_phy_threads;i++) {
+  for (int i=0;i<nof_phy_logs;i++) {
     ((srslte::log_filter*) phy_log[i])->set_level(level(args->log.phy_level));
   }
   mac_log.set_level(level(args->log.mac_level));
@@ -97,7 +99,7 @@ bool enb::init(all_args_t *args_)
   gtpu_log.set_level(level(args->log.gtpu_level));
   s1ap_log.set_level(level(args->log.s1ap_level));
 
-  for (int i=0;i<args->expert.phy.nof_phy_threads;i++) {
+  for (int i=0;i<nof_phy_logs;i++) {
     ((srslte::log_filter*) phy_log[i])->set_hex_limit(args->log.phy_hex_limit);
   }
   mac_log.set_hex_limit(args->log.mac_hex_limit);
@@ -198,7 +200,9 @@ bool enb::init(all_args_t *args_)
   memcpy(&phy_cfg.cell, &cell_cfg, sizeof(srslte_cell_t));
 
   // Init all layers   
-  phy.init(&args->expert.phy, &phy_cfg, &radio, &mac, phy_log);
+  if (!phy.init(&args->expert.phy, &phy_cfg, &radio, &mac, phy_log)) {
+    return false;
+  }
   mac.init(&args->expert.mac, &cell_cfg, &phy, &rlc, &rrc, &mac_log);
   rlc.init(&pdcp, &rrc, &mac, &mac, &rlc_log);
   pdcp.init(&rlc, &rrc, &gtpu, &pdcp_log);
@@ -249,6 +253,8 @@ bool enb::get_metrics(enb_metrics_t &m)
   rf_metrics.rf_error = false; // Reset error flag
 
   phy.get_metrics(m.phy);
+  phy.get_stage_metrics(&m.phy_ul_stage, &m.phy_dl_stage);
+  phy.get_mem_metrics(&m.phy_ue_mem);
   mac.get_metrics(m.mac);
   rrc.get_metrics(m.rrc);
   s1ap.get_metrics(m.s1ap);
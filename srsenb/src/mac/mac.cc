@@ -43,10 +43,12 @@ namespace srsenb {
 
 mac::mac() : timers_db((uint32_t) NOF_MAC_TIMERS),
              rar_pdu_msg(sched_interface::MAX_RAR_LIST),
+             ul_pdu_q(UL_PDU_QUEUE_LEN), 
              pdu_process_thread(this)
 {
   started = false;  
   pcap = NULL; 
+  ue_generation = 0; 
 }
   
 bool mac::init(mac_args_t *args_, srslte_cell_t *cell_, phy_interface_mac *phy, rlc_interface_mac *rlc, rrc_interface_mac *rrc, srslte::log *log_h_)
@@ -63,8 +65,18 @@ bool mac::init(mac_args_t *args_, srslte_cell_t *cell_, phy_interface_mac *phy,
     memcpy(&cell, cell_, sizeof(srslte_cell_t));
     
     scheduler.init(rrc, log_h);
-    // Set default scheduler (RR)
-    scheduler.set_metric(&sched_metric_dl_rr, &sched_metric_ul_rr);
+    // Set scheduler metric (RR by default). Max C/I is PF without the fairness term 
+    switch(args.sched.policy) {
+      case sched_interface::SCHED_POLICY_PF:
+      case sched_interface::SCHED_POLICY_MAX_CI:
+        sched_metric_dl_pf.set_params(args.sched.pf_window_ms, args.sched.policy == sched_interface::SCHED_POLICY_PF?1.0:0.0);
+        sched_metric_ul_pf.set_params(args.sched.pf_window_ms, args.sched.policy == sched_interface::SCHED_POLICY_PF?1.0:0.0);
+        scheduler.set_metric(&sched_metric_dl_pf, &sched_metric_ul_pf);
+        break;
+      default:
+        scheduler.set_metric(&sched_metric_dl_rr, &sched_metric_ul_rr);
+        break;
+    }
     
     // Set default scheduler configuration 
     scheduler.set_sched_cfg(&args.sched);
@@ -96,6 +108,7 @@ void mac::stop()
   started = false;   
   upper_timers_thread.stop();
   pdu_process_thread.stop();
+  ul_pdu_q.clear();
 }
 
 // Implement Section 5.9
@@ -333,6 +346,19 @@ int mac::cqi_info(uint32_t tti, uint16_t rnti, uint32_t cqi_value)
   return 0; 
 }
 
+int mac::cqi_subband_info(uint32_t tti, uint16_t rnti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi_value)
+{
+  log_h->step(tti);
+
+  if (ue_db.count(rnti)) {         
+    scheduler.dl_cqi_subband_info(tti, rnti, sb_prb_start, sb_nof_prb, cqi_value);
+  } else {
+    Error("User rnti=0x%x not found\n", rnti);
+    return -1;
+  }
+  return 0; 
+}
+
 int mac::snr_info(uint32_t tti, uint16_t rnti, float snr)
 {
   log_h->step(tti);
@@ -376,7 +402,7 @@ int mac::rach_detected(uint32_t tti, uint32_t preamble_idx, uint32_t time_adv)
   
   // Create new UE 
   ue_db[last_rnti] = new ue; 
-  ue_db[last_rnti]->config(last_rnti, cell.nof_prb, &scheduler, rrc_h, rlc_h, log_h);
+  ue_db[last_rnti]->config(last_rnti, cell.nof_prb, &scheduler, rrc_h, rlc_h, log_h, &ul_pdu_q, ++ue_generation);
   
   // Set PCAP if available 
   if (pcap) {
@@ -736,15 +762,10 @@ void mac::pdu_process::run_thread()
   }
 }
 
+// Only the UEs with received PDUs are visited 
 bool mac::process_pdus()
 {
-  bool ret = false; 
-  for(std::map<uint16_t, ue*>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    ue *u         = iter->second; 
-    uint16_t rnti = iter->first; 
-    ret = ret | u->process_pdus();
-  }
-  return ret; 
+  return ul_pdu_q.process(ue_db, log_h) > 0; 
 }
 
 
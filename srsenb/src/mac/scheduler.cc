@@ -21,6 +21,8 @@ namespace srsenb {
 sched::sched()
 {
   log_h = NULL; 
+  dl_metric = NULL; 
+  ul_metric = NULL; 
   pthread_mutex_init(&mutex, NULL);
   reset();
 }
@@ -32,6 +34,8 @@ void sched::init(rrc_interface_mac *rrc_, srslte::log* log)
   sched_cfg.pusch_max_mcs = 28; 
   sched_cfg.pusch_mcs     = -1;
   sched_cfg.nof_ctrl_symbols = 3; 
+  sched_cfg.policy        = SCHED_POLICY_RR; 
+  sched_cfg.pf_window_ms  = 100; 
   log_h = log;   
   rrc   = rrc_; 
   reset();
@@ -41,6 +45,9 @@ int sched::reset()
 {
   bzero(pending_rar, sizeof(sched_rar_t)*SCHED_MAX_PENDING_RAR);
   bzero(pending_sibs, sizeof(sched_sib_t)*MAX_SIBS); 
+  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    notify_ue_rem(&iter->second);
+  }
   ue_db.clear();
   configured = false; 
   return 0; 
@@ -49,10 +56,16 @@ int sched::reset()
 void sched::set_sched_cfg(sched_interface::sched_args_t* sched_cfg_)
 {
   if (sched_cfg_) {
+    pthread_mutex_lock(&mutex);
     memcpy(&sched_cfg, sched_cfg_, sizeof(sched_args_t));
+    if (configured) {
+      tbs_table.init(&cfg.cell, sched_cfg.pdsch_max_mcs, sched_cfg.pusch_max_mcs); 
+    }
+    pthread_mutex_unlock(&mutex);
   }
 }
 
+// Must be set before any user is added 
 void sched::set_metric(sched::metric_dl* dl_metric_, sched::metric_ul* ul_metric_)
 {
   dl_metric = dl_metric_; 
@@ -78,6 +91,9 @@ int sched::cell_cfg(sched_interface::cell_cfg_t* cell_cfg)
   si_n_rbg = 4/P; 
   rar_n_rb = 3; 
   nof_rbg = (uint32_t) ceil((float) cfg.cell.nof_prb/P);
+  
+  // TBS lookup tables for the grant sizing of all UEs 
+  tbs_table.init(&cfg.cell, sched_cfg.pdsch_max_mcs, sched_cfg.pusch_max_mcs); 
       
   // Compute Common locations for DCI for each CFI
   for (uint32_t cfi=0;cfi<3;cfi++) {
@@ -110,9 +126,10 @@ int sched::ue_cfg(uint16_t rnti, sched_interface::ue_cfg_t *ue_cfg)
   pthread_mutex_lock(&mutex);
   
    // Add or config user 
-  ue_db[rnti].set_cfg(rnti, ue_cfg, &cfg, &regs, log_h);   
+  ue_db[rnti].set_cfg(rnti, ue_cfg, &cfg, &regs, &tbs_table, log_h);   
   ue_db[rnti].set_max_mcs(sched_cfg.pusch_max_mcs, sched_cfg.pdsch_max_mcs);
   ue_db[rnti].set_fixed_mcs(sched_cfg.pusch_mcs, sched_cfg.pdsch_mcs);
+  notify_ue_ready(&ue_db[rnti]);
 
   pthread_mutex_unlock(&mutex);
   return 0; 
@@ -123,6 +140,7 @@ int sched::ue_rem(uint16_t rnti)
   pthread_mutex_lock(&mutex);
   int ret = 0; 
   if (ue_db.count(rnti)) {         
+    notify_ue_rem(&ue_db[rnti]);
     ue_db.erase(rnti);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
@@ -142,6 +160,7 @@ void sched::phy_config_enabled(uint16_t rnti, bool enabled)
   pthread_mutex_lock(&mutex);
   if (ue_db.count(rnti)) {         
     ue_db[rnti].phy_config_enabled(current_tti, enabled);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
   }
@@ -154,6 +173,7 @@ int sched::bearer_ue_cfg(uint16_t rnti, uint32_t lc_id, sched_interface::ue_bear
   int ret = 0; 
   if (ue_db.count(rnti)) {         
     ue_db[rnti].set_bearer_cfg(lc_id, cfg);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -208,6 +228,7 @@ int sched::dl_rlc_buffer_state(uint16_t rnti, uint32_t lc_id, uint32_t tx_queue,
   int ret = 0; 
   if (ue_db.count(rnti)) {         
     ue_db[rnti].dl_buffer_state(lc_id, tx_queue, retx_queue);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -222,6 +243,7 @@ int sched::dl_mac_buffer_state(uint16_t rnti, uint32_t ce_code)
   int ret = 0; 
   if (ue_db.count(rnti)) {         
     ue_db[rnti].mac_buffer_state(ce_code);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -236,6 +258,7 @@ int sched::dl_ack_info(uint32_t tti, uint16_t rnti, bool ack)
   int ret = 0; 
   if (ue_db.count(rnti)) {         
     ret = ue_db[rnti].set_ack_info(tti, ack);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -250,6 +273,7 @@ int sched::ul_crc_info(uint32_t tti, uint16_t rnti, bool crc)
   int ret = 0; 
   if (ue_db.count(rnti)) {         
     ue_db[rnti].set_ul_crc(tti, crc);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -272,6 +296,20 @@ int sched::dl_cqi_info(uint32_t tti, uint16_t rnti, uint32_t cqi_value)
   return ret; 
 }
 
+int sched::dl_cqi_subband_info(uint32_t tti, uint16_t rnti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi_value)
+{
+  pthread_mutex_lock(&mutex);
+  int ret = 0; 
+  if (ue_db.count(rnti)) {         
+    ue_db[rnti].set_dl_cqi_subband(tti, sb_prb_start, sb_nof_prb, cqi_value);
+  } else {
+    Error("User rnti=0x%x not found\n", rnti);
+    ret = -1;
+  }
+  pthread_mutex_unlock(&mutex);
+  return ret; 
+}
+
 int sched::dl_rach_info(uint32_t tti, uint32_t ra_id, uint16_t rnti, uint32_t estimated_size)
 {
   for (int i=0;i<SCHED_MAX_PENDING_RAR;i++) {
@@ -308,6 +346,7 @@ int sched::ul_bsr(uint16_t rnti, uint32_t lcid, uint32_t bsr)
   int ret = 0; 
   if (ue_db.count(rnti)) {         
     ue_db[rnti].ul_buffer_state(lcid, bsr);
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -349,7 +388,8 @@ int sched::ul_sr_info(uint32_t tti, uint16_t rnti)
   pthread_mutex_lock(&mutex);
   int ret = 0; 
   if (ue_db.count(rnti)) {         
-    ue_db[rnti].set_sr();;
+    ue_db[rnti].set_sr();
+    notify_ue_ready(&ue_db[rnti]);
   } else {
     Error("User rnti=0x%x not found\n", rnti);
     ret = -1;
@@ -358,6 +398,27 @@ int sched::ul_sr_info(uint32_t tti, uint16_t rnti)
   return ret; 
 }
 
+// Tells the metrics that the user may have something to schedule 
+void sched::notify_ue_ready(sched_ue *user)
+{
+  if (dl_metric) {
+    dl_metric->ue_ready(user);
+  }
+  if (ul_metric) {
+    ul_metric->ue_ready(user);
+  }
+}
+
+void sched::notify_ue_rem(sched_ue *user)
+{
+  if (dl_metric) {
+    dl_metric->ue_rem(user);
+  }
+  if (ul_metric) {
+    ul_metric->ue_rem(user);
+  }
+}
+
 void sched::tpc_inc(uint16_t rnti)
 {
   if (ue_db.count(rnti)) {         
@@ -584,7 +645,7 @@ int sched::dl_sched_data(dl_sched_data_t data[MAX_DATA_LIST])
   dl_metric->new_tti(ue_db, start_rbg, avail_rbg, nof_ctrl_symbols, current_tti); 
   
   int nof_data_elems = 0; 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end() && nof_data_elems < MAX_DATA_LIST; ++iter) {
     sched_ue *user      = (sched_ue*) &iter->second;
     uint16_t rnti = (uint16_t) iter->first; 
 
@@ -695,7 +756,7 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
     ul_harq_proc *h = user->get_ul_harq(current_tti);
   
     /* Indicate PHICH acknowledgment if needed */
-    if (h->has_pending_ack()) {
+    if (h->has_pending_ack() && nof_phich_elems < MAX_PHICH_LIST) {
       sched_result->phich[nof_phich_elems].phich = h->get_ack()?ul_sched_phich_t::ACK:ul_sched_phich_t::NACK; 
       sched_result->phich[nof_phich_elems].rnti = rnti;
       nof_phich_elems++;
@@ -725,7 +786,7 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
   }
   
   // Now allocate PUSCH 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end() && nof_dci_elems < MAX_DATA_LIST; ++iter) {
     sched_ue *user = (sched_ue*) &iter->second;
     uint16_t rnti  = (uint16_t) iter->first; 
 
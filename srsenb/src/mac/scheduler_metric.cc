@@ -25,6 +25,8 @@
  */
 
 #include <string.h>
+#include <math.h>
+#include <algorithm>
 
 #include "srslte/srslte.h"
 #include "mac/scheduler_metric.h"
@@ -332,4 +334,270 @@ ul_harq_proc*  ul_metric_rr::get_user_allocation(sched_ue *user)
 
 
 
+
+/*****************************************************************
+ *
+ * Proportional-fair metrics 
+ *
+ *****************************************************************/  
+
+// Averaged bytes per TTI, decayed from the last update up to this TTI 
+static float pf_avg_bytes(float avg, uint32_t avg_tti, uint32_t tti, float beta)
+{
+  if (avg_tti != tti) {
+    avg *= powf(beta, srslte_tti_interval(tti, avg_tti)); 
+  }
+  return avg; 
+}
+
+static float pf_prio(uint32_t rate, float avg, float fairness)
+{
+  if (fairness == 0) {
+    return rate; 
+  }
+  return rate/powf(SRSLTE_MAX(avg, 1.0), fairness); 
+}
+
+dl_metric_pf::dl_metric_pf()
+{
+  set_params(100, 1.0); 
+}
+
+void dl_metric_pf::set_params(uint32_t avg_window_ms, float fairness_)
+{
+  beta     = 1.0-1.0/SRSLTE_MAX(avg_window_ms, 1); 
+  fairness = fairness_; 
+}
+
+void dl_metric_pf::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols_, uint32_t tti)
+{
+  total_rb = start_rb+nof_rb; 
+  for (uint32_t i=0;i<total_rb;i++) {
+    used_rb[i] = i<start_rb; 
+  }
+  available_rb     = nof_rb; 
+  used_rb_mask     = calc_rbg_mask(used_rb);
+  current_tti      = tti; 
+  nof_ctrl_symbols = nof_ctrl_symbols_; 
+  
+  heap.clear(); 
+  allocs.clear(); 
+  std::set<sched_ue*>::iterator iter=ready.begin(); 
+  while (iter!=ready.end()) {
+    sched_ue *user = *iter;
+    bool is_retx   = user->get_pending_dl_harq(current_tti) != NULL; 
+    if (is_retx || user->get_pending_dl_new_data(current_tti)) {
+      float avg = pf_avg_bytes(user->dl_avg_bytes, user->dl_avg_tti, current_tti, beta); 
+      heap.push_back(sched_prio_t(user, is_retx, pf_prio(user->get_dl_capacity(total_rb, nof_ctrl_symbols), avg, fairness)));
+    } else if (user->is_dl_harq_empty()) {
+      // Nothing can become pending before the next event of this user 
+      ready.erase(iter++); 
+      continue; 
+    }
+    ++iter; 
+  }
+  
+  // Only the UEs that get resources are popped from the heap 
+  std::make_heap(heap.begin(), heap.end()); 
+  while (!heap.empty() && available_rb > 0 && allocs.size() < sched_interface::MAX_DATA_LIST) {
+    std::pop_heap(heap.begin(), heap.end());
+    allocate_user(heap.back().user); 
+    heap.pop_back(); 
+  }
+}
+
+void dl_metric_pf::allocate_user(sched_ue *user)
+{
+  dl_alloc_t alloc = {user, user->get_pending_dl_harq(current_tti), 0}; 
+  
+  // Schedule retx in the same RBGs if they are free, or in the best free ones otherwise 
+  if (alloc.h) {
+    alloc.mask = alloc.h->get_rbgmask(); 
+    uint32_t nof_rbg = count_rbg(alloc.mask); 
+    if (alloc.mask & used_rb_mask) {
+      alloc.mask = nof_rbg <= available_rb ? select_rbg(user, nof_rbg) : 0; 
+    }
+    if (alloc.mask) {
+      update_allocation(alloc.mask);
+      available_rb -= nof_rbg; 
+      user->ue_idx  = allocs.size(); 
+      allocs.push_back(alloc); 
+      return; 
+    }
+  }
+  
+  // If could not schedule the reTx, or there wasn't any pending retx, find an empty PID 
+  uint32_t pending_data = user->get_pending_dl_new_data(current_tti); 
+  alloc.h = user->get_empty_dl_harq(); 
+  if (alloc.h && pending_data) {
+    uint32_t nof_rbg = SRSLTE_MIN(user->get_required_rbg_dl(pending_data, nof_ctrl_symbols), available_rb); 
+    alloc.mask = select_rbg(user, nof_rbg); 
+    if (alloc.mask) {
+      update_allocation(alloc.mask);
+      available_rb -= nof_rbg; 
+      user->ue_idx  = allocs.size(); 
+      allocs.push_back(alloc); 
+      
+      uint32_t nof_bytes = SRSLTE_MIN(pending_data, user->get_dl_capacity(nof_rbg, nof_ctrl_symbols)); 
+      user->dl_avg_bytes = pf_avg_bytes(user->dl_avg_bytes, user->dl_avg_tti, current_tti, beta) + (1-beta)*nof_bytes; 
+      user->dl_avg_tti   = current_tti; 
+    }
+  }
+}
+
+// Mask with the nof_rbg free RBGs with the highest sub-band CQI for this user 
+uint32_t dl_metric_pf::select_rbg(sched_ue *user, uint32_t nof_rbg)
+{
+  std::pair<int,uint32_t> rbg[MAX_RBG]; 
+  uint32_t nof_free = 0; 
+  for (uint32_t i=0;i<total_rb;i++) {
+    if (!used_rb[i]) {
+      rbg[nof_free++] = std::make_pair(-((int) user->get_dl_cqi_rbg(i, current_tti)), i); 
+    }
+  }
+  if (nof_rbg == 0 || nof_rbg > nof_free) {
+    return 0; 
+  }
+  std::partial_sort(rbg, rbg+nof_rbg, rbg+nof_free); 
+  bool mask_bit[MAX_RBG]; 
+  bzero(mask_bit, sizeof(bool)*MAX_RBG);
+  for (uint32_t i=0;i<nof_rbg;i++) {
+    mask_bit[rbg[i].second] = true; 
+  }
+  return calc_rbg_mask(mask_bit); 
+}
+
+void dl_metric_pf::ue_ready(sched_ue *user)
+{
+  ready.insert(user); 
+}
+
+void dl_metric_pf::ue_rem(sched_ue *user)
+{
+  ready.erase(user); 
+}
+
+// UEs not allocated this TTI may keep a stale ue_idx, which never points to an allocation of their own 
+dl_harq_proc* dl_metric_pf::get_user_allocation(sched_ue *user)
+{
+  if (user->ue_idx < allocs.size() && allocs[user->ue_idx].user == user) {
+    dl_alloc_t *alloc = &allocs[user->ue_idx]; 
+    alloc->h->set_rbgmask(alloc->mask);
+    return alloc->h; 
+  }
+  return NULL; 
+}
+
+ul_metric_pf::ul_metric_pf()
+{
+  set_params(100, 1.0); 
+}
+
+void ul_metric_pf::set_params(uint32_t avg_window_ms, float fairness_)
+{
+  beta     = 1.0-1.0/SRSLTE_MAX(avg_window_ms, 1); 
+  fairness = fairness_; 
+}
+
+void ul_metric_pf::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb_, uint32_t tti)
+{
+  current_tti  = tti; 
+  nof_rb       = nof_rb_; 
+  available_rb = nof_rb_; 
+  bzero(used_rb, nof_rb*sizeof(bool));
+  
+  heap.clear(); 
+  allocs.clear(); 
+  allocated = false; 
+  std::set<sched_ue*>::iterator iter=ready.begin(); 
+  while (iter!=ready.end()) {
+    sched_ue *user = *iter;
+    bool is_retx   = !user->get_ul_harq(current_tti)->is_empty(); 
+    if (is_retx || user->get_pending_ul_new_data(current_tti)) {
+      float avg = pf_avg_bytes(user->ul_avg_bytes, user->ul_avg_tti, current_tti, beta); 
+      heap.push_back(sched_prio_t(user, is_retx, pf_prio(user->get_ul_capacity(nof_rb), avg, fairness)));
+    } else if (user->is_ul_harq_empty() && !user->get_pending_dl_new_data(current_tti)) {
+      // Nothing can become pending before the next event of this user. Pending DL data may trigger 
+      // an UL grant for an aperiodic CQI report at any time 
+      ready.erase(iter++); 
+      continue; 
+    }
+    ++iter; 
+  }
+  std::make_heap(heap.begin(), heap.end()); 
+}
+
+// Returns false if a new transmission did not find any free PRB 
+bool ul_metric_pf::allocate_user(sched_ue *user)
+{
+  ul_alloc_t alloc; 
+  alloc.user       = user; 
+  alloc.h          = user->get_ul_harq(current_tti); 
+  alloc.same_alloc = false; 
+  
+  if (!alloc.h->is_empty()) {
+    // Schedule retx with the same allocation if it is free, or anywhere else otherwise 
+    alloc.alloc      = alloc.h->get_alloc(); 
+    alloc.same_alloc = allocation_is_valid(alloc.alloc); 
+    if (alloc.same_alloc || new_allocation(alloc.alloc.L, &alloc.alloc)) {
+      update_allocation(alloc.alloc);
+      user->ue_idx = allocs.size(); 
+      allocs.push_back(alloc); 
+    }
+    return true; 
+  }
+  
+  uint32_t pending_data = user->get_pending_ul_new_data(current_tti); 
+  if (pending_data) {
+    new_allocation(user->get_required_prb_ul(pending_data), &alloc.alloc);
+    if (alloc.alloc.L) {
+      update_allocation(alloc.alloc);
+      user->ue_idx = allocs.size(); 
+      allocs.push_back(alloc); 
+      
+      uint32_t nof_bytes = SRSLTE_MIN(pending_data, user->get_ul_capacity(alloc.alloc.L)); 
+      user->ul_avg_bytes = pf_avg_bytes(user->ul_avg_bytes, user->ul_avg_tti, current_tti, beta) + (1-beta)*nof_bytes; 
+      user->ul_avg_tti   = current_tti; 
+    } else {
+      return false; 
+    }
+  }
+  return true; 
+}
+
+void ul_metric_pf::ue_ready(sched_ue *user)
+{
+  ready.insert(user); 
+}
+
+void ul_metric_pf::ue_rem(sched_ue *user)
+{
+  ready.erase(user); 
+}
+
+ul_harq_proc* ul_metric_pf::get_user_allocation(sched_ue *user)
+{
+  // Allocate on the first call, once the PUCCH and Msg3 resources of this TTI have been reserved. 
+  // One PUSCH grant is left for Msg3 
+  if (!allocated) {
+    bool has_space = true; 
+    while (!heap.empty() && available_rb > 0 && has_space && allocs.size() < sched_interface::MAX_DATA_LIST-1) {
+      std::pop_heap(heap.begin(), heap.end());
+      has_space = allocate_user(heap.back().user); 
+      heap.pop_back(); 
+    }
+    allocated = true; 
+  }
+  if (user->ue_idx < allocs.size() && allocs[user->ue_idx].user == user) {
+    ul_alloc_t *alloc = &allocs[user->ue_idx]; 
+    if (alloc->same_alloc) {
+      alloc->h->same_alloc(); 
+    } else {
+      alloc->h->set_alloc(alloc->alloc);
+    }
+    return alloc->h; 
+  }
+  return NULL; 
+}
+
 }
@@ -0,0 +1,120 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include "mac/scheduler_tbs.h"
+#include "mac/scheduler_ue.h"
+
+namespace srsenb {
+
+sched_tbs_table::sched_tbs_table()
+{
+  nof_prb    = 0; 
+  max_mcs_dl = 0; 
+  max_mcs_ul = 0; 
+}
+
+void sched_tbs_table::init(srslte_cell_t *cell, int max_mcs_dl_, int max_mcs_ul_)
+{
+  nof_prb    = cell->nof_prb; 
+  max_mcs_dl = max_mcs_dl_<0?28:max_mcs_dl_; 
+  max_mcs_ul = max_mcs_ul_<0?28:max_mcs_ul_; 
+  
+  tbs_dl.resize(NOF_CQI*MAX_NOF_CTRL_SYMBOLS*nof_prb); 
+  max_tbs_dl.resize(tbs_dl.size()); 
+  tbs_ul.resize(NOF_CQI*nof_prb); 
+  max_tbs_ul.resize(tbs_ul.size()); 
+  
+  int mcs = 0; 
+  for (uint32_t cqi=0;cqi<NOF_CQI;cqi++) {
+    for (uint32_t c=0;c<MAX_NOF_CTRL_SYMBOLS;c++) {
+      int *tbs     = &tbs_dl[(cqi*MAX_NOF_CTRL_SYMBOLS+c)*nof_prb]; 
+      int *max_tbs = &max_tbs_dl[(cqi*MAX_NOF_CTRL_SYMBOLS+c)*nof_prb]; 
+      for (uint32_t n=1;n<=nof_prb;n++) {
+        uint32_t nof_re = srslte_ra_dl_approx_nof_re(*cell, n, c+1);
+        tbs[n-1]     = sched_ue::alloc_tbs(cqi, n, nof_re, 0, max_mcs_dl, &mcs); 
+        max_tbs[n-1] = n>1?SRSLTE_MAX(max_tbs[n-2], tbs[n-1]):tbs[n-1]; 
+      }
+    }
+    int *tbs     = &tbs_ul[cqi*nof_prb]; 
+    int *max_tbs = &max_tbs_ul[cqi*nof_prb]; 
+    for (uint32_t n=1;n<=nof_prb;n++) {
+      uint32_t nof_re = 2*(SRSLTE_CP_NSYMB(cell->cp)-1)*n*SRSLTE_NRE;
+      tbs[n-1]     = sched_ue::alloc_tbs(cqi, n, nof_re, 0, max_mcs_ul, &mcs); 
+      max_tbs[n-1] = n>1?SRSLTE_MAX(max_tbs[n-2], tbs[n-1]):tbs[n-1]; 
+    }
+  }
+}
+
+bool sched_tbs_table::has_dl(uint32_t cqi, uint32_t nof_ctrl_symbols, uint32_t max_mcs)
+{
+  return nof_prb > 0 && cqi < NOF_CQI && nof_ctrl_symbols >= 1 && nof_ctrl_symbols <= MAX_NOF_CTRL_SYMBOLS && max_mcs == max_mcs_dl; 
+}
+
+bool sched_tbs_table::has_ul(uint32_t cqi, uint32_t max_mcs)
+{
+  return nof_prb > 0 && cqi < NOF_CQI && max_mcs == max_mcs_ul; 
+}
+
+int sched_tbs_table::get_tbs_dl(uint32_t cqi, uint32_t nof_ctrl_symbols, uint32_t n)
+{
+  return tbs_dl[(cqi*MAX_NOF_CTRL_SYMBOLS+nof_ctrl_symbols-1)*nof_prb + SRSLTE_MIN(n, nof_prb)-1]; 
+}
+
+int sched_tbs_table::get_tbs_ul(uint32_t cqi, uint32_t n)
+{
+  return tbs_ul[cqi*nof_prb + SRSLTE_MIN(n, nof_prb)-1]; 
+}
+
+uint32_t sched_tbs_table::get_min_prb_dl(uint32_t cqi, uint32_t nof_ctrl_symbols, uint32_t req_bytes, uint32_t max_prb)
+{
+  return min_prb(&max_tbs_dl[(cqi*MAX_NOF_CTRL_SYMBOLS+nof_ctrl_symbols-1)*nof_prb], req_bytes, SRSLTE_MIN(max_prb, nof_prb)); 
+}
+
+uint32_t sched_tbs_table::get_min_prb_ul(uint32_t cqi, uint32_t req_bytes, uint32_t max_prb)
+{
+  return min_prb(&max_tbs_ul[cqi*nof_prb], req_bytes, SRSLTE_MIN(max_prb, nof_prb)); 
+}
+
+// The first PRB count whose running maximum reaches req_bytes is the first one whose TBS does 
+uint32_t sched_tbs_table::min_prb(int *max_tbs, uint32_t req_bytes, uint32_t max_prb)
+{
+  if (max_prb == 0 || max_tbs[max_prb-1] < (int) req_bytes) {
+    return 0; 
+  }
+  uint32_t lo = 0, hi = max_prb-1; 
+  while (lo < hi) {
+    uint32_t mid = (lo+hi)/2; 
+    if (max_tbs[mid] >= (int) req_bytes) {
+      hi = mid; 
+    } else {
+      lo = mid+1; 
+    }
+  }
+  return lo+1; 
+}
+
+}
@@ -56,12 +56,13 @@ sched_ue::sched_ue()
 }
 
 void sched_ue::set_cfg(uint16_t rnti_, sched_interface::ue_cfg_t *cfg_, sched_interface::cell_cfg_t *cell_cfg, 
-                            srslte_regs_t *regs, srslte::log *log_h_) 
+                            srslte_regs_t *regs, sched_tbs_table *tbs_table_, srslte::log *log_h_) 
 {
   reset();
   
   rnti  = rnti_; 
   log_h = log_h_; 
+  tbs_table = tbs_table_; 
   memcpy(&cell, &cell_cfg->cell, sizeof(srslte_cell_t));
 
   max_mcs_dl = 28; 
@@ -99,11 +100,19 @@ void sched_ue::reset()
   buf_mac = 0; 
   buf_ul  = 0;
   phy_config_dedicated_enabled = false; 
+  tbs_table = NULL; 
   dl_cqi = 1; 
   ul_cqi = 1; 
   dl_cqi_tti = 0; 
   ul_cqi_tti = 0; 
   cqi_request_tti = 0; 
+  for (int i=0;i<SCHED_MAX_RBG;i++) {
+    dl_cqi_rbg_tti[i] = -1; 
+  }
+  dl_avg_bytes = 0; 
+  ul_avg_bytes = 0; 
+  dl_avg_tti   = 0; 
+  ul_avg_tti   = 0; 
   for (int i=0;i<SCHED_MAX_HARQ_PROC;i++) {
     dl_harq[i].reset();
     ul_harq[i].reset();
@@ -310,6 +319,15 @@ void sched_ue::set_dl_cqi(uint32_t tti, uint32_t cqi)
   dl_cqi_tti = tti; 
 }
 
+void sched_ue::set_dl_cqi_subband(uint32_t tti, uint32_t sb_prb_start, uint32_t sb_nof_prb, uint32_t cqi)
+{
+  uint32_t P = srslte_ra_type0_P(cell.nof_prb);
+  for (uint32_t i=sb_prb_start/P;i*P<sb_prb_start+sb_nof_prb && i<SCHED_MAX_RBG;i++) {
+    dl_cqi_rbg[i]     = cqi; 
+    dl_cqi_rbg_tti[i] = tti; 
+  }
+}
+
 void sched_ue::set_ul_cqi(uint32_t tti, uint32_t cqi, uint32_t ul_ch_code)
 {
   ul_cqi     = cqi; 
@@ -370,7 +388,7 @@ int sched_ue::generate_format1(dl_harq_proc *h,
     uint32_t nof_ctrl_symbols = cfi+(cell.nof_prb<10?1:0);
     uint32_t nof_re = srslte_ra_dl_grant_nof_re(&grant, cell, sf_idx, nof_ctrl_symbols);
     if (fixed_mcs_dl < 0) {
-      tbs = alloc_tbs(dl_cqi, nof_prb, nof_re, req_bytes, max_mcs_dl, &mcs);      
+      tbs = alloc_tbs(get_dl_cqi_mask(h->get_rbgmask(), tti), nof_prb, nof_re, req_bytes, max_mcs_dl, &mcs);      
     } else {
       tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_dl), nof_prb);
       mcs = fixed_mcs_dl; 
@@ -576,6 +594,12 @@ uint32_t sched_ue::get_required_prb_dl(uint32_t req_bytes, uint32_t nof_ctrl_sym
     return 0; 
   }
   
+  // Same result as the search below, which stops one PRB after the first one that fits 
+  if (fixed_mcs_dl < 0 && tbs_table && tbs_table->has_dl(dl_cqi, nof_ctrl_symbols, max_mcs_dl)) {
+    n = tbs_table->get_min_prb_dl(dl_cqi, nof_ctrl_symbols, req_bytes, cell.nof_prb-1); 
+    return n?n+1:cell.nof_prb; 
+  }
+  
   uint32_t nof_re = 0; 
   int tbs = 0; 
   for (n=1;n<cell.nof_prb && nbytes < req_bytes;n++) {
@@ -606,16 +630,21 @@ uint32_t sched_ue::get_required_prb_ul(uint32_t req_bytes)
     return 0; 
   }
   
-  for (n=1;n<cell.nof_prb && nbytes < req_bytes + 4;n++) {
-    uint32_t nof_re = (2*(SRSLTE_CP_NSYMB(cell.cp)-1) - N_srs)*n*SRSLTE_NRE;
-    int tbs = 0; 
-    if (fixed_mcs_ul < 0) {
-      tbs = alloc_tbs(ul_cqi, n, nof_re, 0, max_mcs_ul, &mcs);      
-    } else {
-      tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_ul), n);
-    }
-    if (tbs > 0) {
-      nbytes = tbs; 
+  if (fixed_mcs_ul < 0 && tbs_table && tbs_table->has_ul(ul_cqi, max_mcs_ul)) {
+    n = tbs_table->get_min_prb_ul(ul_cqi, req_bytes + 4, cell.nof_prb-1); 
+    n = n?n+1:cell.nof_prb; 
+  } else {
+    for (n=1;n<cell.nof_prb && nbytes < req_bytes + 4;n++) {
+      uint32_t nof_re = (2*(SRSLTE_CP_NSYMB(cell.cp)-1) - N_srs)*n*SRSLTE_NRE;
+      int tbs = 0; 
+      if (fixed_mcs_ul < 0) {
+        tbs = alloc_tbs(ul_cqi, n, nof_re, 0, max_mcs_ul, &mcs);      
+      } else {
+        tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_ul), n);
+      }
+      if (tbs > 0) {
+        nbytes = tbs; 
+      }
     }
   }
   
@@ -626,6 +655,77 @@ uint32_t sched_ue::get_required_prb_ul(uint32_t req_bytes)
   return n; 
 }
 
+uint32_t sched_ue::get_required_rbg_dl(uint32_t req_bytes, uint32_t nof_ctrl_symbols)
+{
+  uint32_t P = srslte_ra_type0_P(cell.nof_prb);
+  return (get_required_prb_dl(req_bytes, nof_ctrl_symbols)+P-1)/P; 
+}
+
+/* Bytes that fit in nof_rbg RBGs at the wideband CQI */
+uint32_t sched_ue::get_dl_capacity(uint32_t nof_rbg, uint32_t nof_ctrl_symbols)
+{
+  uint32_t nof_prb = SRSLTE_MIN(nof_rbg*srslte_ra_type0_P(cell.nof_prb), cell.nof_prb); 
+  if (nof_prb == 0) {
+    return 0; 
+  }
+  int tbs = 0; 
+  if (fixed_mcs_dl < 0 && tbs_table && tbs_table->has_dl(dl_cqi, nof_ctrl_symbols, max_mcs_dl)) {
+    tbs = tbs_table->get_tbs_dl(dl_cqi, nof_ctrl_symbols, nof_prb); 
+  } else if (fixed_mcs_dl < 0) {
+    int mcs = 0; 
+    tbs = alloc_tbs(dl_cqi, nof_prb, srslte_ra_dl_approx_nof_re(cell, nof_prb, nof_ctrl_symbols), 0, max_mcs_dl, &mcs);
+  } else {
+    tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_dl), nof_prb)/8;
+  }
+  return tbs>0?tbs:0; 
+}
+
+/* Bytes that fit in nof_prb PRB at the UL CQI */
+uint32_t sched_ue::get_ul_capacity(uint32_t nof_prb)
+{
+  if (nof_prb == 0) {
+    return 0; 
+  }
+  int tbs = 0; 
+  if (fixed_mcs_ul < 0 && tbs_table && tbs_table->has_ul(ul_cqi, max_mcs_ul)) {
+    tbs = tbs_table->get_tbs_ul(ul_cqi, nof_prb); 
+  } else if (fixed_mcs_ul < 0) {
+    int mcs = 0; 
+    uint32_t nof_re = 2*(SRSLTE_CP_NSYMB(cell.cp)-1)*nof_prb*SRSLTE_NRE;
+    tbs = alloc_tbs(ul_cqi, nof_prb, nof_re, 0, max_mcs_ul, &mcs);
+  } else {
+    tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(fixed_mcs_ul), nof_prb)/8;
+  }
+  return tbs>0?tbs:0; 
+}
+
+/* Returns the sub-band CQI of an RBG if it was recently reported, or the wideband CQI otherwise */
+uint32_t sched_ue::get_dl_cqi_rbg(uint32_t rbg_idx, uint32_t tti)
+{
+  if (rbg_idx < SCHED_MAX_RBG && dl_cqi_rbg_tti[rbg_idx] >= 0) {
+    uint32_t sb_tti = (uint32_t) dl_cqi_rbg_tti[rbg_idx];
+    if (sb_tti == tti || srslte_tti_interval(tti, sb_tti) < SCHED_SB_CQI_VALID_MS) {
+      return dl_cqi_rbg[rbg_idx]; 
+    }
+  }
+  return dl_cqi; 
+}
+
+/* Average CQI of the RBGs in a Type0 allocation mask */
+uint32_t sched_ue::get_dl_cqi_mask(uint32_t rbgmask, uint32_t tti)
+{
+  uint32_t P  = srslte_ra_type0_P(cell.nof_prb);
+  uint32_t nb = (uint32_t) ceilf((float) cell.nof_prb / P);
+  uint32_t sum = 0, n = 0; 
+  for (uint32_t i=0;i<nb;i++) {
+    if (rbgmask & (1<<(nb-i-1))) {
+      sum += get_dl_cqi_rbg(i, tti); 
+      n++; 
+    }
+  }
+  return n?sum/n:dl_cqi; 
+}
+
 bool sched_ue::is_sr_triggered()
 {
   return sr; 
@@ -652,6 +752,26 @@ dl_harq_proc* sched_ue::get_pending_dl_harq(uint32_t tti)
   }  
 }
 
+bool sched_ue::is_dl_harq_empty()
+{
+  for (int i=0;i<SCHED_MAX_HARQ_PROC;i++) {
+    if (!dl_harq[i].is_empty()) {
+      return false; 
+    }
+  }
+  return true; 
+}
+
+bool sched_ue::is_ul_harq_empty()
+{
+  for (int i=0;i<SCHED_MAX_HARQ_PROC;i++) {
+    if (!ul_harq[i].is_empty()) {
+      return false; 
+    }
+  }
+  return true; 
+}
+
 dl_harq_proc* sched_ue::get_empty_dl_harq()
 {
   for (int i=0;i<SCHED_MAX_HARQ_PROC;i++) {
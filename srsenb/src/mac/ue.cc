@@ -38,14 +38,17 @@
 
 namespace srsenb {
   
-void ue::config(uint16_t rnti_, uint32_t nof_prb, sched_interface *sched_, rrc_interface_mac *rrc_, rlc_interface_mac *rlc_, srslte::log *log_h_)
+void ue::config(uint16_t rnti_, uint32_t nof_prb, sched_interface *sched_, rrc_interface_mac *rrc_, rlc_interface_mac *rlc_, srslte::log *log_h_, 
+                ul_pdu_queue *ul_pdu_q_, uint32_t generation_)
 {
   rnti  = rnti_; 
   rlc   = rlc_; 
   rrc   = rrc_; 
   log_h = log_h_; 
   sched = sched_; 
-  pdus.init(this, log_h);
+  pool  = srslte::byte_buffer_pool::get_instance(); 
+  ul_pdu_q = ul_pdu_q_; 
+  generation = generation_; 
   
   for (int i=0;i<NOF_HARQ_PROCESSES;i++) {
     srslte_softbuffer_rx_init(&softbuffer_rx[i], nof_prb);
@@ -103,8 +106,19 @@ uint8_t* ue::request_buffer(uint32_t tti, uint32_t len)
   pthread_mutex_lock(&mutex);
   if (len > 0) {   
     if (!pending_buffers[tti%NOF_HARQ_PROCESSES]) {
-      ret = pdus.request(len);   
-      pending_buffers[tti%NOF_HARQ_PROCESSES] = ret; 
+      // Buffers come from the smallest size class the PDU fits in 
+      srslte::byte_buffer_t *pdu = pool->allocate_bytes(len, "ue::request_buffer"); 
+      if (pdu) {
+        if (len > pdu->get_tailroom()) {
+          log_h->error("Requesting buffer for %d bytes, max %d\n", len, pdu->get_tailroom());
+          pool->deallocate(pdu);
+        } else {
+          pending_buffers[tti%NOF_HARQ_PROCESSES] = pdu; 
+          ret = pdu->msg; 
+        }
+      } else {
+        log_h->error("Not enough buffers for MAC PDU\n");
+      }
     } else {
       log_h->console("Error requesting buffer for pid %d, not pushed yet\n", tti%NOF_HARQ_PROCESSES);
       log_h->error("Requesting buffer for pid %d, not pushed yet\n", tti%NOF_HARQ_PROCESSES);
@@ -116,9 +130,9 @@ uint8_t* ue::request_buffer(uint32_t tti, uint32_t len)
   return ret; 
 }
 
-bool ue::process_pdus()
+uint32_t ue::get_generation()
 {
-  return pdus.process_pdus();  
+  return generation; 
 }
 
 void ue::set_tti(uint32_t tti) {
@@ -134,7 +148,7 @@ void ue::process_pdu(uint8_t* pdu, uint32_t nof_bytes, uint32_t tstamp)
   mac_msg_ul.parse_packet(pdu);
 
   if (pcap) {
-    pcap->write_ul_crnti(pdu, nof_bytes, rnti, true, last_tti);
+    pcap->write_ul_crnti(pdu, nof_bytes, rnti, true, tstamp);
   }
   
   while(mac_msg_ul.next()) {
@@ -201,7 +215,7 @@ void ue::process_pdu(uint8_t* pdu, uint32_t nof_bytes, uint32_t tstamp)
 void ue::deallocate_pdu(uint32_t tti)
 {
   if (pending_buffers[tti%NOF_HARQ_PROCESSES]) {
-    pdus.deallocate(pending_buffers[tti%NOF_HARQ_PROCESSES]);
+    pool->deallocate(pending_buffers[tti%NOF_HARQ_PROCESSES]);
     pending_buffers[tti%NOF_HARQ_PROCESSES] = NULL; 
   } else {
     log_h->console("Error deallocating buffer for pid=%d. Not requested\n", tti%NOF_HARQ_PROCESSES);
@@ -211,8 +225,18 @@ void ue::deallocate_pdu(uint32_t tti)
 void ue::push_pdu(uint32_t tti, uint32_t len)
 {
   if (pending_buffers[tti%NOF_HARQ_PROCESSES]) {
-    pdus.push(pending_buffers[tti%NOF_HARQ_PROCESSES], len);
+    ul_pdu_t ul_pdu; 
+    ul_pdu.rnti = rnti; 
+    ul_pdu.generation = generation; 
+    ul_pdu.tti  = tti; 
+    ul_pdu.pdu  = pending_buffers[tti%NOF_HARQ_PROCESSES]; 
+    ul_pdu.pdu->N_bytes = len; 
     pending_buffers[tti%NOF_HARQ_PROCESSES] = NULL; 
+    // The queue is sized for many more PDUs than are ever in flight 
+    if (!ul_pdu_q->push(ul_pdu)) {
+      log_h->error("Dropping UL PDU rnti=0x%x, queue is full\n", rnti);
+      pool->deallocate(ul_pdu.pdu);
+    }
   } else {
     log_h->console("Error pushing buffer for pid=%d. Not requested\n", tti%NOF_HARQ_PROCESSES);
   }
@@ -387,6 +411,35 @@ void ue::metrics_tx(bool crc, uint32_t tbs)
   metrics.tx_pkts++;
 }
 
+bool ul_pdu_queue::push(const ul_pdu_t &pdu)
+{
+  return q.try_push(pdu); 
+}
+
+uint32_t ul_pdu_queue::process(std::map<uint16_t, ue*> &ue_db, srslte::log *log_h)
+{
+  ul_pdu_t pdus[MAX_POP]; 
+  uint32_t n = q.try_pop(pdus, MAX_POP); 
+  for (uint32_t i=0;i<n;i++) {
+    uint16_t rnti = pdus[i].rnti; 
+    std::map<uint16_t, ue*>::iterator it = ue_db.find(rnti); 
+    if (it != ue_db.end() && it->second->get_generation() == pdus[i].generation) {
+      it->second->process_pdu(pdus[i].pdu->msg, pdus[i].pdu->N_bytes, pdus[i].tti);
+    } else {
+      Warning("Dropping UL PDU for rnti=0x%x, user removed\n", rnti);
+    }
+    pool->deallocate(pdus[i].pdu);
+  }
+  return n; 
+}
+
+void ul_pdu_queue::clear()
+{
+  ul_pdu_t pdu; 
+  while (q.try_pop(&pdu)) {
+    pool->deallocate(pdu.pdu);
+  }
+}
   
 }
 
@@ -55,6 +55,7 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
   string tac;
   string mcc;
   string mnc;
+  string sched_policy;
 
   // Command line only options
   bpo::options_description general("General options");
@@ -118,6 +119,7 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
     ("log.all_hex_limit", bpo::value<int>(&args->log.all_hex_limit)->default_value(32),  "ALL log hex dump limit")
 
     ("log.filename",      bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"),"Log filename")
+    ("log.deferred",      bpo::value<bool>(&args->log.deferred)->default_value(false),"Format log messages in the logging thread")
 
     /* MCS section */
     ("scheduler.pdsch_mcs",
@@ -135,6 +137,12 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
     ("scheduler.nof_ctrl_symbols",
         bpo::value<int>(&args->expert.mac.sched.nof_ctrl_symbols)->default_value(3),
         "Number of control symbols")
+    ("scheduler.policy",
+        bpo::value<string>(&sched_policy)->default_value("rr"),
+        "Scheduling policy: rr (round-robin), pf (proportional fair) or max_ci (maximum throughput)")
+    ("scheduler.pf_window_ms",
+        bpo::value<int>(&args->expert.mac.sched.pf_window_ms)->default_value(100),
+        "Averaging window of the UE throughput in the proportional fair scheduler (in ms)")
 
     
     /* Expert section */
@@ -151,6 +159,14 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         bpo::value<int>(&args->expert.phy.pusch_max_its)->default_value(4),
         "Maximum number of turbo decoder iterations")
 
+    ("expert.pusch_sf_max_its",
+        bpo::value<int>(&args->expert.phy.pusch_sf_max_its)->default_value(0),
+        "Maximum number of turbo decoder iterations shared by all PUSCH grants of a subframe (0 for no limit)")
+
+    ("expert.pusch_cb_threads",
+        bpo::value<int>(&args->expert.phy.pusch_cb_threads)->default_value(1),
+        "Number of threads decoding the code blocks of a PUSCH transport block in parallel")
+
     ("expert.tx_amplitude",
         bpo::value<float>(&args->expert.phy.tx_amplitude)->default_value(0.8),
         "Transmit amplitude factor")
@@ -159,6 +175,26 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         bpo::value<int>(&args->expert.phy.nof_phy_threads)->default_value(2),
         "Number of PHY threads")
 
+    ("expert.nof_phy_grant_threads",
+        bpo::value<int>(&args->expert.phy.nof_grant_threads)->default_value(0),
+        "Number of threads sharing the PUSCH decoding and PDSCH encoding of the grants of a subframe (0 to disable)")
+
+    ("expert.phy_pipeline",
+        bpo::value<bool>(&args->expert.phy.pipeline)->default_value(false),
+        "Decode the UL and generate the DL of each subframe in separate PHY thread pools")
+
+    ("expert.nof_phy_ul_threads",
+        bpo::value<int>(&args->expert.phy.nof_ul_threads)->default_value(2),
+        "Number of PHY threads decoding the UL in pipeline mode")
+
+    ("expert.nof_phy_dl_threads",
+        bpo::value<int>(&args->expert.phy.nof_dl_threads)->default_value(2),
+        "Number of PHY threads generating the DL in pipeline mode")
+
+    ("expert.phy_pipeline_ul_budget_us",
+        bpo::value<float>(&args->expert.phy.pipeline_ul_budget_us)->default_value(2000),
+        "Time from the reception of a subframe after which its DL stage stops waiting for the UL results (in us)")
+
     ("expert.link_failure_nof_err",
         bpo::value<int>(&args->expert.mac.link_failure_nof_err)->default_value(50),
         "Number of PUSCH failures after which a radio-link failure is triggered")
@@ -265,6 +301,18 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
   }
 
 
+  // Convert scheduling policy 
+  if (sched_policy == "pf") {
+    args->expert.mac.sched.policy = sched_interface::SCHED_POLICY_PF;
+  } else if (sched_policy == "max_ci") {
+    args->expert.mac.sched.policy = sched_interface::SCHED_POLICY_MAX_CI;
+  } else {
+    if (sched_policy != "rr") {
+      cout << "Error parsing scheduler.policy:" << sched_policy << " - must be rr, pf or max_ci. Using rr." << endl;
+    }
+    args->expert.mac.sched.policy = sched_interface::SCHED_POLICY_RR;
+  }
+
   // Apply all_level to any unset layers
   if (vm.count("log.all_level")) {
     if(!vm.count("log.phy_level")) {
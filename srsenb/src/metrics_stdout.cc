@@ -110,6 +110,11 @@ void metrics_stdout::print_metrics()
     cout << endl;
     cout << "------DL-------------------UL----------------" << endl;
     cout << "rnti   mcs   brate   bler  snr  phr  turbo  mcs  brate   bler" << endl;
+    if (metrics.phy_ue_mem.nof_ues > 0) {
+      printf("PHY state per UE: %.1f kB shared by %d workers, %.1f kB saved\n", 
+             metrics.phy_ue_mem.bytes_per_ue/1024, metrics.phy_ue_mem.nof_workers, 
+             metrics.phy_ue_mem.saved_bytes_per_ue/1024);
+    }
   }
   if (metrics.rrc.n_ues > 0) {
     
@@ -152,6 +157,11 @@ void metrics_stdout::print_metrics()
   } else {
     cout << "--- No users ---" << endl; 
   }
+  if (metrics.phy_dl_stage.nof_late > 0) {
+    printf("PHY latency: UL avg=%.0f max=%.0f us, DL avg=%.0f max=%.0f us, %d DL subframes sent without UL results\n", 
+           metrics.phy_ul_stage.avg_us, metrics.phy_ul_stage.max_us, 
+           metrics.phy_dl_stage.avg_us, metrics.phy_dl_stage.max_us, metrics.phy_dl_stage.nof_late);
+  }
   if(metrics.rf.rf_error) {
     printf("RF status: O=%d, U=%d, L=%d\n", metrics.rf.rf_o, metrics.rf.rf_u, metrics.rf.rf_l);
   }
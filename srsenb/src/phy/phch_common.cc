@@ -63,6 +63,12 @@ bool phch_common::init(srslte_cell_t *cell_, srslte::radio* radio_h_, mac_interf
   for (uint32_t i=0;i<nof_mutex;i++) {
     pthread_mutex_init(&tx_mutex[i], NULL);
   }
+  pthread_mutex_init(&ul_stage_mutex, NULL);
+  pthread_cond_init(&ul_stage_cvar, NULL);
+  for (uint32_t i=0;i<10;i++) {
+    ul_stage_tti[i] = -1; 
+  }
+  running = true; 
   reset(); 
   return true; 
 }
@@ -72,6 +78,53 @@ void phch_common::stop() {
     pthread_mutex_trylock(&tx_mutex[i]);
     pthread_mutex_unlock(&tx_mutex[i]);
   }
+  // Release any DL stage waiting for the UL 
+  pthread_mutex_lock(&ul_stage_mutex);
+  running = false; 
+  pthread_cond_broadcast(&ul_stage_cvar);
+  pthread_mutex_unlock(&ul_stage_mutex);
+  
+  // Workers still waiting for their grants run them by themselves 
+  grant_pool.stop();
+  for (uint32_t i=0;i<grant_pool_ctx.size();i++) {
+    grant_ctx_free(grant_pool_ctx[i]);
+    delete grant_pool_ctx[i];
+  }
+  grant_pool_ctx.clear();
+}
+
+bool phch_common::grant_ctx_init(grant_ctx_t *ctx)
+{
+  if (srslte_enb_ul_pusch_dec_init(&ctx->ul, cell, &pusch_cfg, &pucch_cfg)) {
+    return false; 
+  }
+  if (srslte_enb_dl_pdsch_enc_init(&ctx->dl, cell)) {
+    srslte_enb_ul_pusch_dec_free(&ctx->ul);
+    return false; 
+  }
+  srslte_sch_set_max_noi(&ctx->ul.pusch.ul_sch, params.pusch_max_its);
+  return true; 
+}
+
+void phch_common::grant_ctx_free(grant_ctx_t *ctx)
+{
+  srslte_enb_ul_pusch_dec_free(&ctx->ul);
+  srslte_enb_dl_pdsch_enc_free(&ctx->dl);
+}
+
+bool phch_common::grant_pool_init(uint32_t nof_threads, int prio)
+{
+  std::vector<void*> args; 
+  for (uint32_t i=0;i<nof_threads;i++) {
+    grant_ctx_t *ctx = new grant_ctx_t; 
+    if (!grant_ctx_init(ctx)) {
+      delete ctx; 
+      return false; 
+    }
+    grant_pool_ctx.push_back(ctx);
+    args.push_back(ctx);
+  }
+  return grant_pool.init(args, prio);
 }
 
 void phch_common::worker_end(uint32_t tx_mutex_cnt, cf_t* buffer, uint32_t nof_samples, srslte_timestamp_t tx_time)
@@ -94,47 +147,100 @@ void phch_common::worker_end(uint32_t tx_mutex_cnt, cf_t* buffer, uint32_t nof_s
   mac->tti_clock();
 }
 
+void phch_common::ul_stage_done(uint32_t tti_rx)
+{
+  pthread_mutex_lock(&ul_stage_mutex);
+  ul_stage_tti[tti_rx%10] = tti_rx; 
+  pthread_cond_broadcast(&ul_stage_cvar);
+  pthread_mutex_unlock(&ul_stage_mutex);
+}
+
+bool phch_common::ul_stage_wait(uint32_t tti_rx, struct timespec *deadline)
+{
+  int ret = 0; 
+  pthread_mutex_lock(&ul_stage_mutex);
+  while (ul_stage_tti[tti_rx%10] != (int) tti_rx && running && ret == 0) {
+    ret = pthread_cond_timedwait(&ul_stage_cvar, &ul_stage_mutex, deadline);
+  }
+  bool done = ul_stage_tti[tti_rx%10] == (int) tti_rx; 
+  pthread_mutex_unlock(&ul_stage_mutex);
+  return done; 
+}
+
 void phch_common::ack_clear(uint32_t sf_idx)
 {
+  pthread_mutex_lock(&pending_ack_mutex);
   for(std::map<uint16_t,pending_ack_t>::iterator iter=pending_ack.begin(); iter!=pending_ack.end(); ++iter) {
     pending_ack_t *p = (pending_ack_t*) &iter->second;
     p->is_pending[sf_idx] = false;     
   }
+  pthread_mutex_unlock(&pending_ack_mutex);
 }
 
 void phch_common::ack_add_rnti(uint16_t rnti)
 {
+  pthread_mutex_lock(&pending_ack_mutex);
   for (int sf_idx=0;sf_idx<10;sf_idx++) {
     pending_ack[rnti].is_pending[sf_idx] = false; 
   }
+  pthread_mutex_unlock(&pending_ack_mutex);
 }
 
 void phch_common::ack_rem_rnti(uint16_t rnti)
 {
+  pthread_mutex_lock(&pending_ack_mutex);
   pending_ack.erase(rnti);
+  pthread_mutex_unlock(&pending_ack_mutex);
 }
 
 void phch_common::ack_set_pending(uint32_t sf_idx, uint16_t rnti, uint32_t last_n_pdcch)
 {
-  if (pending_ack.count(rnti)) {
-    pending_ack[rnti].is_pending[sf_idx] = true; 
-    pending_ack[rnti].n_pdcch[sf_idx]    = last_n_pdcch;
+  pthread_mutex_lock(&pending_ack_mutex);
+  std::map<uint16_t,pending_ack_t>::iterator iter = pending_ack.find(rnti);
+  if (iter != pending_ack.end()) {
+    iter->second.is_pending[sf_idx] = true; 
+    iter->second.n_pdcch[sf_idx]    = last_n_pdcch;
   }
+  pthread_mutex_unlock(&pending_ack_mutex);
 }
 
 bool phch_common::ack_is_pending(uint32_t sf_idx, uint16_t rnti, uint32_t *last_n_pdcch)
 {
-  if (pending_ack.count(rnti)) {
-    bool ret = pending_ack[rnti].is_pending[sf_idx];  
-    pending_ack[rnti].is_pending[sf_idx] = false; 
+  bool ret = false; 
+  pthread_mutex_lock(&pending_ack_mutex);
+  std::map<uint16_t,pending_ack_t>::iterator iter = pending_ack.find(rnti);
+  if (iter != pending_ack.end()) {
+    ret = iter->second.is_pending[sf_idx];  
+    iter->second.is_pending[sf_idx] = false; 
     
     if (ret && last_n_pdcch) {
-      *last_n_pdcch = pending_ack[rnti].n_pdcch[sf_idx];
+      *last_n_pdcch = iter->second.n_pdcch[sf_idx];
     }
-    return ret; 
+  }
+  pthread_mutex_unlock(&pending_ack_mutex);
+  return ret; 
+}
+
+void phch_common::phich_set_info(uint32_t sf_idx, uint16_t rnti, srslte_enb_ul_phich_info_t *info)
+{
+  pthread_mutex_lock(&pending_ack_mutex);
+  std::map<uint16_t,pending_ack_t>::iterator iter = pending_ack.find(rnti);
+  if (iter != pending_ack.end()) {
+    iter->second.phich_info[sf_idx] = *info; 
+  }
+  pthread_mutex_unlock(&pending_ack_mutex);
+}
+
+void phch_common::phich_get_info(uint32_t sf_idx, uint16_t rnti, srslte_enb_ul_phich_info_t *info)
+{
+  pthread_mutex_lock(&pending_ack_mutex);
+  std::map<uint16_t,pending_ack_t>::iterator iter = pending_ack.find(rnti);
+  if (iter != pending_ack.end()) {
+    *info = iter->second.phich_info[sf_idx]; 
   } else {
-    return false; 
+    bzero(info, sizeof(srslte_enb_ul_phich_info_t));
   }
+  pthread_mutex_unlock(&pending_ack_mutex);
 }
 
 }
@@ -75,12 +75,14 @@ phch_worker::phch_worker()
 FILE *f; 
 #endif
 
-void phch_worker::init(phch_common* phy_, srslte::log *log_h_)
+void phch_worker::init(phch_common* phy_, srslte::log *log_h_, stage_t stage_)
 {
   phy   = phy_; 
   log_h = log_h_; 
+  stage = stage_; 
   
-  pthread_mutex_init(&mutex, NULL); 
+  bzero(&ul_stage_metrics, sizeof(phy_stage_metrics_t));
+  bzero(&dl_stage_metrics, sizeof(phy_stage_metrics_t));
   
   // Init cell here
   signal_buffer_rx    = (cf_t*) srslte_vec_malloc(2*SRSLTE_SF_LEN_PRB(phy->cell.nof_prb)*sizeof(cf_t));
@@ -111,8 +113,22 @@ void phch_worker::init(phch_common* phy_, srslte::log *log_h_)
   
   srslte_pucch_set_threshold(&enb_ul.pucch, 0.8, 0.5); 
   srslte_sch_set_max_noi(&enb_ul.pusch.ul_sch, phy->params.pusch_max_its);
+  if (phy->params.pusch_cb_threads > 1) {
+    srslte_sch_set_nof_cb_threads(&enb_ul.pusch.ul_sch, phy->params.pusch_cb_threads);
+  }
   srslte_enb_dl_set_amp(&enb_dl, phy->params.tx_amplitude);
   
+  // The users of all workers are held by the first one 
+  phy->ue_db.add_worker(&enb_ul, &enb_dl);
+  
+  // This worker runs grants of the pool while it waits for its own 
+  if (phy->params.nof_grant_threads > 0) {
+    if (!phy->grant_ctx_init(&grant_ctx)) {
+      fprintf(stderr, "Error initiating grant decoder\n");
+      return; 
+    }
+  }
+  
   Info("Worker %d configured cell %d PRB\n", get_id(), phy->cell.nof_prb);
   
   initiated = true; 
@@ -125,7 +141,6 @@ void phch_worker::init(phch_common* phy_, srslte::log *log_h_)
 void phch_worker::reset() 
 {
   initiated  = false; 
-  ue_db.clear();
 }
 
 cf_t* phch_worker::get_buffer_rx()
@@ -143,129 +158,91 @@ void phch_worker::set_time(uint32_t tti_, uint32_t tx_mutex_cnt_, srslte_timesta
   sf_sched_ul  = tti_sched_ul%10;
   tx_mutex_cnt = tx_mutex_cnt_;
   memcpy(&tx_time, &tx_time_, sizeof(srslte_timestamp_t));
+  gettimeofday(&t_start, NULL);
 }
 
-int phch_worker::add_rnti(uint16_t rnti)
+void phch_worker::work_imp()
 {
+  log_h->step(tti_rx);
+  
+  Debug("Worker %d running\n", get_id());
+  
+  // UEs removed while the subframe is processed remain valid until they are released 
+  uint32_t nof_idx = phy->ue_db.acquire(&ues);
+  if (ue_has_grant.size() < nof_idx) {
+    ue_has_grant.resize(nof_idx);
+  }
   
-  if (srslte_enb_dl_add_rnti(&enb_dl, rnti)) {
-    return -1; 
+  if (stage != STAGE_DL) {
+    work_ul();
   }
-  if (srslte_enb_ul_add_rnti(&enb_ul, rnti)) {
-    return -1; 
+  if (stage != STAGE_UL) {
+    work_dl();
   }
   
-  // Create user 
-  ue_db[rnti].rnti = rnti; 
-    
-  return SRSLTE_SUCCESS; 
-
-}
-
-uint32_t phch_worker::get_nof_rnti() {
-  return ue_db.size();
+  phy->ue_db.release(&ues);
 }
 
-void phch_worker::set_config_dedicated(uint16_t rnti, 
-                                       srslte_uci_cfg_t *uci_cfg, 
-                                       srslte_pucch_sched_t *pucch_sched,
-                                       srslte_refsignal_srs_cfg_t *srs_cfg, 
-                                       uint32_t I_sr, bool pucch_cqi, uint32_t pmi_idx, bool pucch_cqi_ack)
+void phch_worker::work_ul()
 {
-  pthread_mutex_lock(&mutex); 
-  if (ue_db.count(rnti)) {
-    pucch_sched->N_pucch_1 = phy->pucch_cfg.n1_pucch_an;
-    srslte_enb_ul_cfg_ue(&enb_ul, rnti, uci_cfg, pucch_sched, srs_cfg);
-        
-    ue_db[rnti].I_sr    = I_sr; 
-    ue_db[rnti].I_sr_en = true; 
-    
-    if (pucch_cqi) {
-      ue_db[rnti].pmi_idx = pmi_idx; 
-      ue_db[rnti].cqi_en  = true;       
-      ue_db[rnti].pucch_cqi_ack = pucch_cqi_ack; 
-    } else {
-      ue_db[rnti].pmi_idx = 0; 
-      ue_db[rnti].cqi_en  = false;             
-    }
-    
-  } else {
-    Error("Setting config dedicated: rnti=0x%x does not exist\n");
+  mac_interface_phy::ul_sched_t *ul_grants = phy->ul_grants;
+  
+  for (uint32_t i=0;i<ues.size();i++) {
+    ue_has_grant[ues[i]->idx] = false; 
   }
-  pthread_mutex_unlock(&mutex); 
-}
 
-void phch_worker::rem_rnti(uint16_t rnti)
-{
-  pthread_mutex_lock(&mutex); 
-  if (ue_db.count(rnti)) {
-    ue_db.erase(rnti);
-    
-    srslte_enb_dl_rem_rnti(&enb_dl, rnti); 
-    srslte_enb_ul_rem_rnti(&enb_ul, rnti);
-    
-    // remove any pending grant for each subframe 
-    for (uint32_t i=0;i<10;i++) {
-      for (uint32_t j=0;j<phy->ul_grants[i].nof_grants;j++) {
-        if (phy->ul_grants[i].sched_grants[j].rnti == rnti) {
-          phy->ul_grants[i].sched_grants[j].rnti = 0; 
-        }
-      }
-      for (uint32_t j=0;j<phy->dl_grants[i].nof_grants;j++) {
-        if (phy->dl_grants[i].sched_grants[j].rnti == rnti) {
-          phy->dl_grants[i].sched_grants[j].rnti = 0; 
-        }
-      }
-    }
-  } else {
-    Error("Removing user: rnti=0x%x does not exist\n", rnti);
+  // Process UL signal 
+  srslte_enb_ul_fft(&enb_ul, signal_buffer_rx);
+
+  // Decode pending UL grants for the tti they were scheduled 
+  decode_pusch(ul_grants[sf_rx].sched_grants, ul_grants[sf_rx].nof_grants, sf_rx);
+  
+  // Decode remaining PUCCH ACKs not associated with PUSCH transmission and SR signals
+  decode_pucch(tti_rx);
+  
+  stage_metrics_add(&ul_stage_metrics, false);
+  
+  if (stage == STAGE_UL) {
+    phy->ul_stage_done(tti_rx);
   }
-  pthread_mutex_unlock(&mutex); 
 }
 
-void phch_worker::work_imp()
+void phch_worker::work_dl()
 {
   uint32_t sf_ack; 
-  
-  pthread_mutex_lock(&mutex); 
+  bool late = false; 
   
   mac_interface_phy::ul_sched_t *ul_grants = phy->ul_grants;
   mac_interface_phy::dl_sched_t *dl_grants = phy->dl_grants; 
   mac_interface_phy *mac = phy->mac; 
   
-  log_h->step(tti_rx);
-  
-  Debug("Worker %d running\n", get_id());
-  
-  for(std::map<uint16_t, ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    uint16_t rnti = (uint16_t) iter->first;
-    ue_db[rnti].has_grant_tti = -1; 
+  if (stage == STAGE_DL) {
+    // Give the UL stage of tti_rx its budget to deliver the CRCs to MAC. Past it, the subframe goes out without them
+    struct timespec deadline; 
+    uint64_t usec = t_start.tv_usec + (uint64_t) phy->params.pipeline_ul_budget_us; 
+    deadline.tv_sec  = t_start.tv_sec + usec/1000000;
+    deadline.tv_nsec = 1000*(usec%1000000);
+    if (!phy->ul_stage_wait(tti_rx, &deadline)) {
+      Warning("UL TTI=%d not decoded in time for DL TTI=%d\n", tti_rx, tti_tx);
+      late = true; 
+    }
   }
-
-  // Process UL signal 
-  srslte_enb_ul_fft(&enb_ul, signal_buffer_rx);
-
-  // Decode pending UL grants for the tti they were scheduled 
-  decode_pusch(ul_grants[sf_rx].sched_grants, ul_grants[sf_rx].nof_grants, sf_rx);
   
-  // Decode remaining PUCCH ACKs not associated with PUSCH transmission and SR signals
-  decode_pucch(tti_rx);
-      
   // Get DL scheduling for the TX TTI from MAC
   if (mac->get_dl_sched(tti_tx, &dl_grants[sf_tx]) < 0) {
     Error("Getting DL scheduling from MAC\n");
-    goto unlock;
+    return;
   } 
   
   if (dl_grants[sf_tx].cfi < 1 || dl_grants[sf_tx].cfi > 3) {
     Error("Invalid CFI=%d\n", dl_grants[sf_tx].cfi);
-    goto unlock;
+    return;
   }
   
   // Get UL scheduling for the TX TTI from MAC
   if (mac->get_ul_sched(tti_sched_ul, &ul_grants[sf_sched_ul]) < 0) {
     Error("Getting UL scheduling from MAC\n");
-    goto unlock;
+    return;
   } 
   
   // Put base signals (references, PBCH, PCFICH and PSS/SSS) into the resource grid
@@ -293,6 +270,7 @@ void phch_worker::work_imp()
   
   // Generate signal and transmit
   srslte_enb_dl_gen_signal(&enb_dl, signal_buffer_tx);  
+  stage_metrics_add(&dl_stage_metrics, late);
   Debug("Sending to radio\n");
   phy->worker_end(tx_mutex_cnt, signal_buffer_tx, SRSLTE_SF_LEN_PRB(phy->cell.nof_prb), tx_time);
 
@@ -313,121 +291,154 @@ void phch_worker::work_imp()
     sem_post(&plot_sem);    
   }
 #endif
-
-unlock: 
-  pthread_mutex_unlock(&mutex); 
-
 }
 
 
 int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch, uint32_t tti)
 {
-  srslte_uci_data_t uci_data; 
-  bzero(&uci_data, sizeof(srslte_uci_data_t));
-  
   uint32_t wideband_cqi_value = 0; 
   
   uint32_t n_rb_ho = 0; 
+  
+  // Turbo decoder iterations left for this subframe and number of grants sharing them
+  float    sf_its_left    = phy->params.pusch_sf_max_its; 
+  uint32_t nof_grants_left = 0; 
+  for (uint32_t i=0;i<nof_pusch;i++) {
+    // Only the sequences of the UEs borrowed for the subframe are safe to use 
+    if (grants[i].rnti && !phy_ue_db::find(&ues, grants[i].rnti)) {
+      Error("PUSCH: rnti=0x%x does not exist\n", grants[i].rnti);
+      grants[i].rnti = 0; 
+    }
+    if (grants[i].rnti) {
+      nof_grants_left++; 
+    }
+  }
+  
+  // Grants decoded in parallel can not pass their unused iterations on, they get an equal share 
+  bool fan_out = phy->params.nof_grant_threads > 0 && nof_grants_left > 1; 
+  srslte::task_pool::batch batch; 
+  
   for (uint32_t i=0;i<nof_pusch;i++) {
     uint16_t rnti = grants[i].rnti; 
     if (rnti) {
-
-    #ifdef LOG_EXECTIME
-      char timestr[64];
-      struct timeval t[3];
-      gettimeofday(&t[1], NULL);
-    #endif
-
+      phy_ue_db::ue *u = phy_ue_db::find(&ues, rnti); 
+      pusch_task *t = &pusch_tasks[i]; 
+      t->w     = this; 
+      t->grant = &grants[i]; 
+      t->tti   = tti; 
+      t->its_budget = 0; 
+      bzero(&t->uci_data, sizeof(srslte_uci_data_t));
+      
       // Get pending ACKs with an associated PUSCH transmission
       if (phy->ack_is_pending(sf_rx, rnti)) {
-        uci_data.uci_ack_len = 1; 
+        t->uci_data.uci_ack_len = 1; 
       }
       // Configure PUSCH CQI channel 
-      srslte_cqi_value_t cqi_value;
-      bool cqi_enabled = false; 
-      if (ue_db[rnti].cqi_en && srslte_cqi_send(ue_db[rnti].pmi_idx, tti_rx)) {
-        cqi_value.type = SRSLTE_CQI_TYPE_WIDEBAND;
-        cqi_enabled = true; 
+      t->cqi_enabled = false; 
+      if (u->cqi_en && srslte_cqi_send(u->pmi_idx, tti_rx)) {
+        t->cqi_value.type = SRSLTE_CQI_TYPE_WIDEBAND;
+        t->cqi_enabled = true; 
       } else if (grants[i].grant.cqi_request) {
-        cqi_value.type = SRSLTE_CQI_TYPE_SUBBAND_HL;
-        cqi_value.subband_hl.N = (phy->cell.nof_prb > 7) ? srslte_cqi_hl_get_no_subbands(phy->cell.nof_prb) : 0;
-        cqi_enabled = true; 
+        t->cqi_value.type = SRSLTE_CQI_TYPE_SUBBAND_HL;
+        t->cqi_value.subband_hl.N = (phy->cell.nof_prb > 7) ? srslte_cqi_hl_get_no_subbands(phy->cell.nof_prb) : 0;
+        t->cqi_enabled = true; 
       }
-      if (cqi_enabled) {
-        uci_data.uci_cqi_len = srslte_cqi_size(&cqi_value);
-        Info("cqi enabled len=%d\n", uci_data.uci_cqi_len);
+      if (t->cqi_enabled) {
+        t->uci_data.uci_cqi_len = srslte_cqi_size(&t->cqi_value);
+        Info("cqi enabled len=%d\n", t->uci_data.uci_cqi_len);
       }
       
       // mark this tti as having an ul grant to avoid pucch 
-      ue_db[rnti].has_grant_tti = tti_rx; 
+      ue_has_grant[u->idx] = true; 
       
-      srslte_ra_ul_grant_t phy_grant; 
-      int res = -1;
-      if (!srslte_ra_ul_dci_to_grant(&grants[i].grant, enb_ul.cell.nof_prb, n_rb_ho, &phy_grant, tti%8)) {
-        res = srslte_enb_ul_get_pusch(&enb_ul, &phy_grant, grants[i].softbuffer, 
-                                                rnti, grants[i].rv_idx, 
-                                                grants[i].current_tx_nb, 
-                                                grants[i].data, 
-                                                &uci_data, 
-                                                tti);     
-      } else {
+      if (srslte_ra_ul_dci_to_grant(&grants[i].grant, enb_ul.cell.nof_prb, n_rb_ho, &t->phy_grant, tti%8)) {
         Error("Computing PUSCH grant\n");
+        if (fan_out) {
+          // The grants already pushed still point to this stack frame 
+          phy->grant_pool.wait(&batch, &grant_ctx);
+        }
         return SRSLTE_ERROR; 
       }
       
+      if (fan_out) {
+        if (phy->params.pusch_sf_max_its > 0) {
+          t->its_budget = SRSLTE_MAX((uint32_t) ceilf(sf_its_left/nof_grants_left), 1); 
+        }
+        phy->grant_pool.push(&batch, t);
+      }
+    }
+  }
+  
+  if (fan_out) {
+    // Decode our share of the grants meanwhile 
+    phy->grant_pool.wait(&batch, &grant_ctx);
+  }
+  
+  for (uint32_t i=0;i<nof_pusch;i++) {
+    uint16_t rnti = grants[i].rnti; 
+    if (rnti) {
+      phy_ue_db::ue *u = phy_ue_db::find(&ues, rnti); 
+      pusch_task *t = &pusch_tasks[i]; 
+      
+      if (!fan_out) {
+        // Each grant may use an equal share of the iterations left. Unused iterations remain available to the next grants 
+        if (phy->params.pusch_sf_max_its > 0) {
+          t->its_budget = SRSLTE_MAX((uint32_t) ceilf(sf_its_left/nof_grants_left), 1); 
+        }
+        t->decode(NULL);
+        
+        if (phy->params.pusch_sf_max_its > 0) {
+          sf_its_left -= t->noi_spent; 
+          if (sf_its_left < 0) {
+            sf_its_left = 0; 
+          }
+          nof_grants_left--; 
+        }
+      }
+      
+      char timestr[64];
+      timestr[0] = '\0';
     #ifdef LOG_EXECTIME
-      gettimeofday(&t[2], NULL);
-      get_time_interval(t);
-      snprintf(timestr, 64, ", dec_time=%4d us", (int) t[0].tv_usec);
+      snprintf(timestr, 64, ", dec_time=%4d us", t->dec_time_us);
     #endif
       
-      bool crc_res = (res == 0); 
+      bool crc_res = (t->res == 0); 
+      srslte_uci_data_t *uci_data = &t->uci_data; 
+      srslte_ra_ul_grant_t *phy_grant = &t->phy_grant; 
                    
       // Save PHICH scheduling for this user. Each user can have just 1 PUSCH grant per TTI
-      ue_db[rnti].phich_info.n_prb_lowest = enb_ul.pusch_cfg.grant.n_prb_tilde[0];                                           
-      ue_db[rnti].phich_info.n_dmrs       = phy_grant.ncs_dmrs;                                           
-
-      
+      srslte_enb_ul_phich_info_t phich_info; 
+      phich_info.n_prb_lowest = t->n_prb_lowest;                                           
+      phich_info.n_dmrs       = phy_grant->ncs_dmrs;                                           
+      phy->phich_set_info(sf_rx, rnti, &phich_info);
       
       char cqi_str[64];
-      if (cqi_enabled) {
-        srslte_cqi_value_unpack(uci_data.uci_cqi, &cqi_value);
-        if (ue_db[rnti].cqi_en) {
-          wideband_cqi_value = cqi_value.wideband.wideband_cqi;
+      if (t->cqi_enabled) {
+        srslte_cqi_value_unpack(uci_data->uci_cqi, &t->cqi_value);
+        if (u->cqi_en) {
+          wideband_cqi_value = t->cqi_value.wideband.wideband_cqi;
         } else if (grants[i].grant.cqi_request) {
-          wideband_cqi_value = cqi_value.subband_hl.wideband_cqi;
+          wideband_cqi_value = t->cqi_value.subband_hl.wideband_cqi;
         }
         snprintf(cqi_str, 64, ", cqi=%d", wideband_cqi_value);
       }
       
-      float snr_db  = 10*log10(srslte_chest_ul_get_snr(&enb_ul.chest)); 
-
-      /*
-      if (!crc_res && enb_ul.pusch_cfg.grant.L_prb == 1 && enb_ul.pusch_cfg.grant.n_prb[0] == 0 && snr_db > 5) {
-        srslte_vec_save_file("sf_symbols", enb_ul.sf_symbols, sizeof(cf_t)*SRSLTE_SF_LEN_RE(25, SRSLTE_CP_NORM));
-        srslte_vec_save_file("ce", enb_ul.ce, sizeof(cf_t)*SRSLTE_SF_LEN_RE(25, SRSLTE_CP_NORM));
-        srslte_vec_save_file("d", enb_ul.pusch.d, sizeof(cf_t)*enb_ul.pusch_cfg.nbits.nof_re);
-        srslte_vec_save_file("ce2", enb_ul.pusch.ce, sizeof(cf_t)*enb_ul.pusch_cfg.nbits.nof_re);
-        srslte_vec_save_file("z", enb_ul.pusch.z, sizeof(cf_t)*enb_ul.pusch_cfg.nbits.nof_re);
-        printf("saved sf_idx=%d, mcs=%d, tbs=%d, rnti=%d, rv=%d, snr=%.1f\n", tti%10, 
-               grants[i].grant.mcs_idx, enb_ul.pusch_cfg.cb_segm.tbs, rnti, grants[i].rv_idx, snr_db); 
-        exit(-1);
-      }
-      */
-      log_h->info_hex(grants[i].data, phy_grant.mcs.tbs/8,
+      float snr_db = t->snr_db; 
+
+      log_h->info_hex(grants[i].data, phy_grant->mcs.tbs/8,
           "PUSCH: rnti=0x%x, prb=(%d,%d), tbs=%d, mcs=%d, rv=%d, snr=%.1f dB, n_iter=%d, crc=%s%s%s%s\n", 
-          rnti, phy_grant.n_prb[0], phy_grant.n_prb[0]+phy_grant.L_prb,
-          phy_grant.mcs.tbs/8, phy_grant.mcs.idx, grants[i].grant.rv_idx,
+          rnti, phy_grant->n_prb[0], phy_grant->n_prb[0]+phy_grant->L_prb,
+          phy_grant->mcs.tbs/8, phy_grant->mcs.idx, grants[i].grant.rv_idx,
           snr_db, 
-          srslte_pusch_last_noi(&enb_ul.pusch),
+          t->noi,
           crc_res?"OK":"KO",
-          uci_data.uci_ack_len>0?(uci_data.uci_ack?", ack=1":", ack=0"):"",
-          uci_data.uci_cqi_len>0?cqi_str:"",         
+          uci_data->uci_ack_len>0?(uci_data->uci_ack?", ack=1":", ack=0"):"",
+          uci_data->uci_cqi_len>0?cqi_str:"",         
           timestr);    
       
       // Notify MAC of RL status 
       if (grants[i].grant.rv_idx == 0) {
-        if (res && snr_db < PUSCH_RL_SNR_DB_TH) {
+        if (t->res && snr_db < PUSCH_RL_SNR_DB_TH) {
           Debug("PUSCH: Radio-Link failure snr=%.1f dB\n", snr_db);
           phy->mac->rl_failure(rnti);
         } else {
@@ -436,43 +447,91 @@ int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch,
       }
       
       // Notify MAC new received data and HARQ Indication value
-      phy->mac->crc_info(tti_rx, rnti, phy_grant.mcs.tbs/8, crc_res);    
-      if (uci_data.uci_ack_len) {
-        phy->mac->ack_info(tti_rx, rnti, uci_data.uci_ack && (crc_res || snr_db > PUSCH_RL_SNR_DB_TH));
+      phy->mac->crc_info(tti_rx, rnti, phy_grant->mcs.tbs/8, crc_res);    
+      if (uci_data->uci_ack_len) {
+        phy->mac->ack_info(tti_rx, rnti, uci_data->uci_ack && (crc_res || snr_db > PUSCH_RL_SNR_DB_TH));
       }
       
       // Notify MAC of UL SNR and DL CQI 
       if (snr_db >= PUSCH_RL_SNR_DB_TH) {
         phy->mac->snr_info(tti_rx, rnti, snr_db);
       }
-      if (uci_data.uci_cqi_len>0 && crc_res) {
+      if (uci_data->uci_cqi_len>0 && crc_res) {
         phy->mac->cqi_info(tti_rx, rnti, wideband_cqi_value);
+        // Aperiodic reports also carry a CQI for each sub-band, used for frequency-selective scheduling 
+        if (t->cqi_value.type == SRSLTE_CQI_TYPE_SUBBAND_HL) {
+          uint32_t sb_size = srslte_cqi_hl_get_subband_size(phy->cell.nof_prb); 
+          for (uint32_t sb=0;sb<t->cqi_value.subband_hl.N;sb++) {
+            phy->mac->cqi_subband_info(tti_rx, rnti, sb*sb_size, SRSLTE_MIN(sb_size, phy->cell.nof_prb-sb*sb_size), 
+                                       srslte_cqi_hl_get_subband_cqi(&t->cqi_value.subband_hl, sb));
+          }
+        }
       }
       
       // Save metrics stats 
-      ue_db[rnti].metrics_ul(phy_grant.mcs.idx, 0, snr_db, srslte_pusch_last_noi(&enb_ul.pusch));
+      u->metrics_ul(phy_grant->mcs.idx, 0, snr_db, t->noi, t->noi_spent, t->noi_saved);
     }    
   }
   return SRSLTE_SUCCESS; 
 }
 
+void phch_worker::pusch_task::run_task(void *arg)
+{
+  decode(&((phch_common::grant_ctx_t*) arg)->ul);
+}
+
+// Decodes the grant with dec or, if NULL, with the decoder of the worker 
+void phch_worker::pusch_task::decode(srslte_enb_ul_pusch_dec_t *dec)
+{
+  srslte_pusch_t     *pusch     = dec?&dec->pusch:&w->enb_ul.pusch; 
+  srslte_pusch_cfg_t *pusch_cfg = dec?&dec->pusch_cfg:&w->enb_ul.pusch_cfg; 
+  srslte_chest_ul_t  *chest     = dec?&dec->chest:&w->enb_ul.chest; 
+  
+  struct timeval t[3];
+  gettimeofday(&t[1], NULL);
+  
+  if (its_budget > 0) {
+    srslte_sch_set_iteration_budget(&pusch->ul_sch, its_budget); 
+  }
+  if (dec) {
+    res = srslte_enb_ul_get_pusch_dec(&w->enb_ul, dec, &phy_grant, grant->softbuffer, 
+                                      grant->rnti, grant->rv_idx, grant->current_tx_nb, 
+                                      grant->data, &uci_data, tti);
+  } else {
+    res = srslte_enb_ul_get_pusch(&w->enb_ul, &phy_grant, grant->softbuffer, 
+                                  grant->rnti, grant->rv_idx, grant->current_tx_nb, 
+                                  grant->data, &uci_data, tti);
+  }
+  
+  snr_db       = 10*log10(srslte_chest_ul_get_snr(chest)); 
+  noi          = srslte_pusch_last_noi(pusch); 
+  noi_spent    = srslte_sch_last_noi_spent(&pusch->ul_sch); 
+  noi_saved    = srslte_sch_last_noi_saved(&pusch->ul_sch); 
+  n_prb_lowest = pusch_cfg->grant.n_prb_tilde[0]; 
+  
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  dec_time_us  = (int) t[0].tv_usec; 
+}
+
 
 int phch_worker::decode_pucch(uint32_t tti_rx)
 {
   uint32_t sf_rx = tti_rx%10;
   srslte_uci_data_t uci_data; 
   
-  for(std::map<uint16_t, ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    uint16_t rnti = (uint16_t) iter->first;
+  for (uint32_t i=0;i<ues.size();i++) {
+    phy_ue_db::ue *u = ues[i]; 
+    uint16_t rnti = u->rnti;
 
-    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END && ue_db[rnti].has_grant_tti != (int) tti_rx) {
+    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END && !ue_has_grant[u->idx]) {
       // Check if user needs to receive PUCCH 
       bool needs_pucch = false, needs_ack=false, needs_sr=false, needs_cqi=false; 
       uint32_t last_n_pdcch = 0;
       bzero(&uci_data, sizeof(srslte_uci_data_t));
       
-      if (ue_db[rnti].I_sr_en) {
-        if (srslte_ue_ul_sr_send_tti(ue_db[rnti].I_sr, tti_rx)) {
+      if (u->I_sr_en) {
+        if (srslte_ue_ul_sr_send_tti(u->I_sr, tti_rx)) {
           needs_pucch = true; 
           needs_sr = true; 
           uci_data.scheduling_request = true; 
@@ -484,8 +543,8 @@ int phch_worker::decode_pucch(uint32_t tti_rx)
         uci_data.uci_ack_len = 1; 
       }
       srslte_cqi_value_t cqi_value;
-      if (ue_db[rnti].cqi_en && (ue_db[rnti].pucch_cqi_ack || !needs_ack)) {
-        if (srslte_cqi_send(ue_db[rnti].pmi_idx, tti_rx)) {
+      if (u->cqi_en && (u->pucch_cqi_ack || !needs_ack)) {
+        if (srslte_cqi_send(u->pmi_idx, tti_rx)) {
           needs_pucch = true; 
           needs_cqi = true; 
           cqi_value.type = SRSLTE_CQI_TYPE_WIDEBAND; 
@@ -541,15 +600,18 @@ int phch_worker::encode_phich(srslte_enb_dl_phich_t *acks, uint32_t nof_acks, ui
   for (uint32_t i=0;i<nof_acks;i++) {
     uint16_t rnti = acks[i].rnti;
     if (rnti) {
+      // The PHICH in tti_tx acknowledges the PUSCH received in tti_rx 
+      srslte_enb_ul_phich_info_t phich_info; 
+      phy->phich_get_info(sf_rx, rnti, &phich_info);
       srslte_enb_dl_put_phich(&enb_dl, acks[i].ack, 
-                              ue_db[rnti].phich_info.n_prb_lowest, 
-                              ue_db[rnti].phich_info.n_dmrs, 
+                              phich_info.n_prb_lowest, 
+                              phich_info.n_dmrs, 
                               sf_idx);
       
       Info("PHICH: rnti=0x%x, hi=%d, I_lowest=%d, n_dmrs=%d, tti_tx=%d\n", 
           rnti, acks[i].ack, 
-          ue_db[rnti].phich_info.n_prb_lowest, 
-          ue_db[rnti].phich_info.n_dmrs, tti_tx);
+          phich_info.n_prb_lowest, 
+          phich_info.n_dmrs, tti_tx);
     }
   }
   return SRSLTE_SUCCESS;
@@ -604,17 +666,34 @@ int phch_worker::encode_pdcch_dl(srslte_enb_dl_pdsch_t *grants, uint32_t nof_gra
 
 int phch_worker::encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants, uint32_t sf_idx)
 {
+  uint32_t nof_pdsch = 0; 
+  for (uint32_t i=0;i<nof_grants;i++) {
+    if (grants[i].rnti && !phy_ue_db::find(&ues, grants[i].rnti)) {
+      Error("PDSCH: rnti=0x%x does not exist\n", grants[i].rnti);
+      grants[i].rnti = 0; 
+    }
+    if (grants[i].rnti) {
+      nof_pdsch++; 
+    }
+  }
+  bool fan_out = phy->params.nof_grant_threads > 0 && nof_pdsch > 1; 
+  srslte::task_pool::batch batch; 
+  
   for (uint32_t i=0;i<nof_grants;i++) {
     uint16_t rnti = grants[i].rnti;
     if (rnti) {
+      pdsch_task *t = &pdsch_tasks[i]; 
+      t->w      = this; 
+      t->grant  = &grants[i]; 
+      t->sf_idx = sf_idx; 
 
       bool rnti_is_user = true; 
       if (rnti == SRSLTE_SIRNTI || rnti == SRSLTE_PRNTI || rnti == SRSLTE_MRNTI) {
         rnti_is_user = false; 
       }
       
-      srslte_ra_dl_grant_t phy_grant; 
-      srslte_ra_dl_dci_to_grant(&grants[i].grant, enb_dl.cell.nof_prb, rnti, &phy_grant);
+      srslte_ra_dl_grant_t *phy_grant = &t->phy_grant; 
+      srslte_ra_dl_dci_to_grant(&grants[i].grant, enb_dl.cell.nof_prb, rnti, phy_grant);
       
       char grant_str[64];
       switch(grants[i].grant.alloc_type) {
@@ -632,80 +711,87 @@ int phch_worker::encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants
       if (LOG_THIS(rnti)) { 
         uint8_t x = 0;
         uint8_t *ptr = grants[i].data;
-        uint32_t len = phy_grant.mcs.tbs/8;
+        uint32_t len = phy_grant->mcs.tbs/8;
         if (!ptr) {          
           ptr = &x;
           len = 1; 
         }        
         log_h->info_hex(ptr, len,
                              "PDSCH: rnti=0x%x, l_crb=%2d, %s, harq=%d, tbs=%d, mcs=%d, rv=%d, tti_tx=%d\n", 
-                             rnti, phy_grant.nof_prb, grant_str, grants[i].grant.harq_process, 
-                             phy_grant.mcs.tbs/8, phy_grant.mcs.idx, grants[i].grant.rv_idx, tti_tx);
+                             rnti, phy_grant->nof_prb, grant_str, grants[i].grant.harq_process, 
+                             phy_grant->mcs.tbs/8, phy_grant->mcs.idx, grants[i].grant.rv_idx, tti_tx);
       }
-      if (srslte_enb_dl_put_pdsch(&enb_dl, &phy_grant, grants[i].softbuffer, rnti, grants[i].grant.rv_idx, sf_idx, 
-                                  grants[i].data)) 
-      {
-        fprintf(stderr, "Error putting PDSCH %d\n",i);
-        return SRSLTE_ERROR; 
+      
+      if (fan_out) {
+        phy->grant_pool.push(&batch, t);
+      } else {
+        t->encode(NULL);
+        if (t->res) {
+          fprintf(stderr, "Error putting PDSCH %d\n",i);
+          return SRSLTE_ERROR; 
+        }
       }
 
       // Save metrics stats 
-      ue_db[rnti].metrics_dl(phy_grant.mcs.idx);
+      phy_ue_db::find(&ues, rnti)->metrics_dl(phy_grant->mcs.idx);
+    }
+  }
+  
+  if (fan_out) {
+    phy->grant_pool.wait(&batch, &grant_ctx);
+    for (uint32_t i=0;i<nof_grants;i++) {
+      if (grants[i].rnti && pdsch_tasks[i].res) {
+        fprintf(stderr, "Error putting PDSCH %d\n",i);
+        return SRSLTE_ERROR; 
+      }
     }
   }
   return SRSLTE_SUCCESS; 
 }
 
-
-
-/************ METRICS interface ********************/
-uint32_t phch_worker::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
+void phch_worker::pdsch_task::run_task(void *arg)
 {
-  uint32_t cnt=0;
-  for(std::map<uint16_t, ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    ue *u = (ue*) &iter->second;
-    uint16_t rnti = iter->first; 
-    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END) {
-      u->metrics_read(&metrics[cnt]);
-      cnt++;
-    }
-  } 
-  return cnt;
+  encode(&((phch_common::grant_ctx_t*) arg)->dl);
 }
 
-void phch_worker::ue::metrics_read(phy_metrics_t* metrics_)
+// Encodes the grant into the subframe of the worker with enc or, if NULL, with the encoder of the worker 
+void phch_worker::pdsch_task::encode(srslte_enb_dl_pdsch_enc_t *enc)
 {
-  memcpy(metrics_, &metrics, sizeof(phy_metrics_t));
-  bzero(&metrics, sizeof(phy_metrics_t));
+  if (enc) {
+    res = srslte_enb_dl_put_pdsch_enc(&w->enb_dl, enc, &phy_grant, grant->softbuffer, grant->rnti, 
+                                      grant->grant.rv_idx, sf_idx, grant->data); 
+  } else {
+    res = srslte_enb_dl_put_pdsch(&w->enb_dl, &phy_grant, grant->softbuffer, grant->rnti, 
+                                  grant->grant.rv_idx, sf_idx, grant->data); 
+  }
 }
 
-void phch_worker::ue::metrics_dl(uint32_t mcs)
-{
-  metrics.dl.mcs = SRSLTE_VEC_CMA(mcs, metrics.dl.mcs, metrics.dl.n_samples);
-  metrics.dl.n_samples++;
-}
 
-void phch_worker::ue::metrics_ul(uint32_t mcs, float rssi, float sinr, uint32_t turbo_iters)
+
+/************ METRICS interface ********************/
+void phch_worker::get_stage_metrics(phy_stage_metrics_t *ul, phy_stage_metrics_t *dl)
 {
-  metrics.ul.mcs         = SRSLTE_VEC_CMA((float) mcs,         metrics.ul.mcs,         metrics.ul.n_samples);
-  metrics.ul.sinr        = SRSLTE_VEC_CMA((float) sinr,        metrics.ul.sinr,        metrics.ul.n_samples);
-  metrics.ul.rssi        = SRSLTE_VEC_CMA((float) sinr,        metrics.ul.rssi,        metrics.ul.n_samples);
-  metrics.ul.turbo_iters = SRSLTE_VEC_CMA((float) turbo_iters, metrics.ul.turbo_iters, metrics.ul.n_samples);  
-  metrics.ul.n_samples++;
+  memcpy(ul, &ul_stage_metrics, sizeof(phy_stage_metrics_t));
+  memcpy(dl, &dl_stage_metrics, sizeof(phy_stage_metrics_t));
+  bzero(&ul_stage_metrics, sizeof(phy_stage_metrics_t));
+  bzero(&dl_stage_metrics, sizeof(phy_stage_metrics_t));
 }
 
-
+void phch_worker::stage_metrics_add(phy_stage_metrics_t *m, bool late)
+{
+  struct timeval t[3];
+  memcpy(&t[1], &t_start, sizeof(struct timeval));
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  float us = (float) (t[0].tv_sec*1000000 + t[0].tv_usec); 
   
-
-
-
-
-
-
-
-
-
-
+  m->avg_us = SRSLTE_VEC_CMA(us, m->avg_us, m->n_samples);
+  m->max_us = SRSLTE_MAX(m->max_us, us);
+  m->n_samples++; 
+  if (late) {
+    m->nof_late++; 
+  }
+}
 
 
 void phch_worker::start_plot() {
@@ -47,7 +47,8 @@ using namespace std;
 namespace srsenb {
 
 phy::phy() : workers_pool(MAX_WORKERS), 
-             workers(MAX_WORKERS), 
+             dl_workers_pool(MAX_WORKERS), 
+             workers(2*MAX_WORKERS), 
              workers_common(txrx::MUTEX_X_WORKER*MAX_WORKERS)
 {
 }
@@ -90,8 +91,9 @@ bool phy::init(phy_args_t *args,
                srslte::log* log_h)
 {
   std::vector<void*> log_vec;
-  for (int i=0;i<args->nof_phy_threads;i++) {
-    log_vec[i] = (void*) log_h;
+  int nof_logs = args->pipeline ? args->nof_ul_threads + args->nof_dl_threads : args->nof_phy_threads; 
+  for (int i=0;i<nof_logs;i++) {
+    log_vec.push_back((void*) log_h);
   }
   init(args, cfg, radio_handler_, mac, log_vec);
   return true; 
@@ -107,7 +109,19 @@ bool phy::init(phy_args_t *args,
   mlockall(MCL_CURRENT | MCL_FUTURE);
   
   radio_handler = radio_handler_;
-  nof_workers = args->nof_phy_threads; 
+  if (args->pipeline) {
+    if (args->nof_ul_threads < 1 || args->nof_ul_threads > MAX_WORKERS || 
+        args->nof_dl_threads < 1 || args->nof_dl_threads > MAX_WORKERS) 
+    {
+      fprintf(stderr, "Error: the PHY pipeline needs 1 to %d UL and DL threads\n", MAX_WORKERS);
+      return false; 
+    }
+    nof_ul_workers = args->nof_ul_threads; 
+    nof_workers    = args->nof_ul_threads + args->nof_dl_threads; 
+  } else {
+    nof_ul_workers = 0; 
+    nof_workers    = args->nof_phy_threads; 
+  }
   
   workers_common.params = *args; 
 
@@ -115,17 +129,34 @@ bool phy::init(phy_args_t *args,
   
   parse_config(cfg);
   
-  // Add workers to workers pool and start threads
+  if (args->nof_grant_threads > 0) {
+    if (!workers_common.grant_pool_init(args->nof_grant_threads, GRANT_THREAD_PRIO)) {
+      fprintf(stderr, "Error starting the PHY grant threads\n");
+      return false; 
+    }
+  }
+  
+  // Add workers to workers pool and start threads. In pipeline mode, the first nof_ul_workers decode the UL and 
+  // the rest generate the DL in a pool of their own
   for (uint32_t i=0;i<nof_workers;i++) {
-    workers[i].init(&workers_common, (srslte::log*) log_vec[i]);
-    workers_pool.init_worker(i, &workers[i], WORKERS_THREAD_PRIO);    
+    if (!args->pipeline) {
+      workers[i].init(&workers_common, (srslte::log*) log_vec[i]);
+      workers_pool.init_worker(i, &workers[i], WORKERS_THREAD_PRIO);    
+    } else if (i < nof_ul_workers) {
+      workers[i].init(&workers_common, (srslte::log*) log_vec[i], phch_worker::STAGE_UL);
+      workers_pool.init_worker(i, &workers[i], WORKERS_THREAD_PRIO);    
+    } else {
+      workers[i].init(&workers_common, (srslte::log*) log_vec[i], phch_worker::STAGE_DL);
+      dl_workers_pool.init_worker(i-nof_ul_workers, &workers[i], WORKERS_THREAD_PRIO);    
+    }
   }
   
   prach.init(&cfg->cell, &prach_cfg, mac, (srslte::log*) log_vec[0], PRACH_WORKER_THREAD_PRIO);
   prach.set_max_prach_offset_us(args->max_prach_offset_us);
   
   // Warning this must be initialized after all workers have been added to the pool
-  tx_rx.init(radio_handler, &workers_pool, &workers_common, &prach, (srslte::log*) log_vec[0], SF_RECV_THREAD_PRIO);
+  tx_rx.init(radio_handler, &workers_pool, &workers_common, &prach, (srslte::log*) log_vec[0], SF_RECV_THREAD_PRIO, 
+             args->pipeline ? &dl_workers_pool : NULL);
     
   return true; 
 }
@@ -135,6 +166,7 @@ void phy::stop()
   tx_rx.stop();  
   workers_common.stop();
   workers_pool.stop();
+  dl_workers_pool.stop();
   prach.stop();
 }
 
@@ -152,12 +184,7 @@ int phy::add_rnti(uint16_t rnti)
   if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END) {
     workers_common.ack_add_rnti(rnti);
   }
-  for (uint32_t i=0;i<nof_workers;i++) {
-    if (workers[i].add_rnti(rnti)) {
-      return SRSLTE_ERROR; 
-    }
-  }
-  return SRSLTE_SUCCESS;
+  return workers_common.ue_db.add_rnti(rnti);
 }
 
 void phy::rem_rnti(uint16_t rnti)
@@ -165,43 +192,57 @@ void phy::rem_rnti(uint16_t rnti)
   if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END) {
     workers_common.ack_rem_rnti(rnti);
   }
-  for (uint32_t i=0;i<nof_workers;i++) {
-    workers[i].rem_rnti(rnti);
+  workers_common.ue_db.rem_rnti(rnti);
+  
+  // remove any pending grant for each subframe 
+  for (uint32_t i=0;i<10;i++) {
+    for (uint32_t j=0;j<workers_common.ul_grants[i].nof_grants;j++) {
+      if (workers_common.ul_grants[i].sched_grants[j].rnti == rnti) {
+        workers_common.ul_grants[i].sched_grants[j].rnti = 0; 
+      }
+    }
+    for (uint32_t j=0;j<workers_common.dl_grants[i].nof_grants;j++) {
+      if (workers_common.dl_grants[i].sched_grants[j].rnti == rnti) {
+        workers_common.dl_grants[i].sched_grants[j].rnti = 0; 
+      }
+    }
   }
 }
 
 void phy::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
 {
-  phy_metrics_t metrics_tmp[ENB_METRICS_MAX_USERS];
-
-  uint32_t nof_users = workers[0].get_nof_rnti(); 
   bzero(metrics, sizeof(phy_metrics_t)*ENB_METRICS_MAX_USERS);
-  int n_tot = 0; 
+  workers_common.ue_db.get_metrics(metrics);
+}
+
+void phy::get_mem_metrics(phy_ue_mem_metrics_t *metrics)
+{
+  workers_common.ue_db.get_mem_metrics(metrics);
+}
+
+void phy::get_stage_metrics(phy_stage_metrics_t *ul, phy_stage_metrics_t *dl)
+{
+  phy_stage_metrics_t m[2];
+  phy_stage_metrics_t *total[2] = {ul, dl};
+  
+  bzero(ul, sizeof(phy_stage_metrics_t));
+  bzero(dl, sizeof(phy_stage_metrics_t));
   for (uint32_t i=0;i<nof_workers;i++) {
-    workers[i].get_metrics(metrics_tmp);
-    for (uint32_t j=0;j<nof_users;j++) {
-      metrics[j].dl.n_samples   += metrics_tmp[j].dl.n_samples; 
-      metrics[j].dl.mcs         += metrics_tmp[j].dl.n_samples*metrics_tmp[j].dl.mcs;
-      
-      metrics[j].ul.n_samples   += metrics_tmp[j].ul.n_samples; 
-      metrics[j].ul.mcs         += metrics_tmp[j].ul.n_samples*metrics_tmp[j].ul.mcs;
-      metrics[j].ul.n           += metrics_tmp[j].ul.n_samples*metrics_tmp[j].ul.n;
-      metrics[j].ul.rssi        += metrics_tmp[j].ul.n_samples*metrics_tmp[j].ul.rssi;
-      metrics[j].ul.sinr        += metrics_tmp[j].ul.n_samples*metrics_tmp[j].ul.sinr;
-      metrics[j].ul.turbo_iters += metrics_tmp[j].ul.n_samples*metrics_tmp[j].ul.turbo_iters;
+    workers[i].get_stage_metrics(&m[0], &m[1]);
+    for (uint32_t s=0;s<2;s++) {
+      total[s]->avg_us    += m[s].n_samples*m[s].avg_us;
+      total[s]->max_us     = SRSLTE_MAX(total[s]->max_us, m[s].max_us);
+      total[s]->n_samples += m[s].n_samples; 
+      total[s]->nof_late  += m[s].nof_late; 
     }
   }
-  for (uint32_t j=0;j<nof_users;j++) {
-    metrics[j].dl.mcs         /= metrics[j].dl.n_samples;
-    metrics[j].ul.mcs         /= metrics[j].ul.n_samples;
-    metrics[j].ul.n           /= metrics[j].ul.n_samples;
-    metrics[j].ul.rssi        /= metrics[j].ul.n_samples;
-    metrics[j].ul.sinr        /= metrics[j].ul.n_samples;
-    metrics[j].ul.turbo_iters /= metrics[j].ul.n_samples;
+  for (uint32_t s=0;s<2;s++) {
+    if (total[s]->n_samples) {
+      total[s]->avg_us /= total[s]->n_samples; 
+    }
   }
 }
 
-
 /***** RRC->PHY interface **********/
 
 void phy::set_config_dedicated(uint16_t rnti, LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT* dedicated)
@@ -220,13 +261,15 @@ void phy::set_config_dedicated(uint16_t rnti, LIBLTE_RRC_PHYSICAL_CONFIG_DEDICAT
   bzero(&pucch_sched, sizeof(srslte_pucch_sched_t));
   pucch_sched.n_pucch_2        = dedicated->cqi_report_cnfg.report_periodic.pucch_resource_idx;
   pucch_sched.n_pucch_sr       = dedicated->sched_request_cnfg.sr_pucch_resource_idx;
+  pucch_sched.N_pucch_1        = workers_common.pucch_cfg.n1_pucch_an;
   
-  for (uint32_t i=0;i<nof_workers;i++) {
-    workers[i].set_config_dedicated(rnti, &uci_cfg, &pucch_sched, NULL, 
-                                    dedicated->sched_request_cnfg.sr_cnfg_idx, 
-                                    dedicated->cqi_report_cnfg.report_periodic_setup_present,
-                                    dedicated->cqi_report_cnfg.report_periodic.pmi_cnfg_idx, 
-                                    dedicated->cqi_report_cnfg.report_periodic.simult_ack_nack_and_cqi);
+  if (workers_common.ue_db.set_config_dedicated(rnti, &uci_cfg, &pucch_sched, NULL, 
+                                                dedicated->sched_request_cnfg.sr_cnfg_idx, 
+                                                dedicated->cqi_report_cnfg.report_periodic_setup_present,
+                                                dedicated->cqi_report_cnfg.report_periodic.pmi_cnfg_idx, 
+                                                dedicated->cqi_report_cnfg.report_periodic.simult_ack_nack_and_cqi)) 
+  {
+    fprintf(stderr, "Error setting config dedicated: rnti=0x%x does not exist\n", rnti);
   }
 }
 
@@ -0,0 +1,294 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <string.h>
+
+#include "phy/phy_ue_db.h"
+
+namespace srsenb {
+
+phy_ue_db::phy_ue_db()
+{
+  enb_ul      = NULL; 
+  enb_dl      = NULL; 
+  nof_workers = 0; 
+  pthread_mutex_init(&mutex, NULL);
+}
+
+phy_ue_db::~phy_ue_db()
+{
+  for (uint32_t i=0;i<ues.size();i++) {
+    if (ues[i]) {
+      delete ues[i]; 
+    }
+  }
+  pthread_mutex_destroy(&mutex);
+}
+
+void phy_ue_db::add_worker(srslte_enb_ul_t *enb_ul_, srslte_enb_dl_t *enb_dl_)
+{
+  pthread_mutex_lock(&mutex);
+  if (!enb_ul) {
+    enb_ul = enb_ul_; 
+    enb_dl = enb_dl_; 
+  } else {
+    srslte_enb_ul_share_users(enb_ul_, enb_ul);
+    srslte_enb_dl_share_users(enb_dl_, enb_dl);
+  }
+  nof_workers++; 
+  pthread_mutex_unlock(&mutex);
+}
+
+int phy_ue_db::add_rnti(uint16_t rnti)
+{
+  int ret = SRSLTE_SUCCESS; 
+  pthread_mutex_lock(&mutex);
+  if (rnti_idx.count(rnti)) {
+    fprintf(stderr, "Error adding rnti=0x%x, already exists\n", rnti);
+    ret = SRSLTE_ERROR; 
+  } else {
+    // A removed UE with the same RNTI may still be borrowed. It shares its sequences with the new one 
+    if (has_users(rnti, NULL)) {
+      srslte_enb_ul_cfg_ue(enb_ul, rnti, NULL, NULL, NULL);
+    } else if (srslte_enb_ul_add_rnti(enb_ul, rnti) || srslte_enb_dl_add_rnti(enb_dl, rnti)) {
+      ret = SRSLTE_ERROR; 
+    }
+    if (!ret) {
+      uint32_t idx; 
+      if (free_idx.empty()) {
+        idx = ues.size(); 
+        ues.push_back(NULL);
+      } else {
+        idx = free_idx.back(); 
+        free_idx.pop_back();
+      }
+      ue *u = new ue(rnti, idx); 
+      u->nof_bytes = sizeof(ue) + srslte_enb_ul_user_nof_bytes(enb_ul, rnti) + srslte_enb_dl_user_nof_bytes(enb_dl, rnti); 
+      ues[idx]       = u; 
+      rnti_idx[rnti] = idx; 
+    }
+  }
+  pthread_mutex_unlock(&mutex);
+  return ret; 
+}
+
+void phy_ue_db::rem_rnti(uint16_t rnti)
+{
+  pthread_mutex_lock(&mutex);
+  if (rnti_idx.count(rnti)) {
+    ue *u = ues[rnti_idx[rnti]]; 
+    rnti_idx.erase(rnti);
+    put(u); 
+  } else {
+    fprintf(stderr, "Error removing rnti=0x%x, does not exist\n", rnti);
+  }
+  pthread_mutex_unlock(&mutex);
+}
+
+// Drops a reference to u and frees it with the last one. Called with the mutex locked 
+void phy_ue_db::put(ue *u)
+{
+  if (--u->nof_refs == 0) {
+    // The sequences stay while another entry with the RNTI uses them 
+    if (!has_users(u->rnti, u)) {
+      srslte_enb_ul_rem_rnti(enb_ul, u->rnti);
+      srslte_enb_dl_rem_rnti(enb_dl, u->rnti);
+    }
+    ues[u->idx] = NULL; 
+    free_idx.push_back(u->idx);
+    delete u; 
+  }
+}
+
+// Whether an entry other than except uses the sequences of rnti. Called with the mutex locked 
+bool phy_ue_db::has_users(uint16_t rnti, ue *except)
+{
+  for (uint32_t i=0;i<ues.size();i++) {
+    if (ues[i] && ues[i] != except && ues[i]->rnti == rnti) {
+      return true; 
+    }
+  }
+  return false; 
+}
+
+int phy_ue_db::set_config_dedicated(uint16_t rnti, 
+                                    srslte_uci_cfg_t *uci_cfg, 
+                                    srslte_pucch_sched_t *pucch_sched,
+                                    srslte_refsignal_srs_cfg_t *srs_cfg, 
+                                    uint32_t I_sr, bool pucch_cqi, uint32_t pmi_idx, bool pucch_cqi_ack)
+{
+  int ret = SRSLTE_ERROR; 
+  pthread_mutex_lock(&mutex);
+  if (rnti_idx.count(rnti)) {
+    ue *u = ues[rnti_idx[rnti]]; 
+    
+    srslte_enb_ul_cfg_ue(enb_ul, rnti, uci_cfg, pucch_sched, srs_cfg);
+    
+    u->I_sr    = I_sr; 
+    u->I_sr_en = true; 
+    if (pucch_cqi) {
+      u->pmi_idx       = pmi_idx; 
+      u->cqi_en        = true;       
+      u->pucch_cqi_ack = pucch_cqi_ack; 
+    } else {
+      u->pmi_idx = 0; 
+      u->cqi_en  = false;             
+    }
+    ret = SRSLTE_SUCCESS; 
+  }
+  pthread_mutex_unlock(&mutex);
+  return ret; 
+}
+
+uint32_t phy_ue_db::acquire(std::vector<ue*> *ues_)
+{
+  ues_->clear();
+  pthread_mutex_lock(&mutex);
+  for (std::map<uint16_t, uint32_t>::iterator iter=rnti_idx.begin(); iter!=rnti_idx.end(); ++iter) {
+    ue *u = ues[iter->second]; 
+    u->nof_refs++; 
+    ues_->push_back(u);
+  }
+  uint32_t capacity = ues.size(); 
+  pthread_mutex_unlock(&mutex);
+  return capacity; 
+}
+
+void phy_ue_db::release(std::vector<ue*> *ues_)
+{
+  pthread_mutex_lock(&mutex);
+  for (uint32_t i=0;i<ues_->size();i++) {
+    put(ues_->at(i)); 
+  }
+  pthread_mutex_unlock(&mutex);
+  ues_->clear();
+}
+
+// Binary search in the UEs returned by acquire() 
+phy_ue_db::ue* phy_ue_db::find(std::vector<ue*> *ues_, uint16_t rnti)
+{
+  uint32_t lo = 0, hi = ues_->size(); 
+  while (lo < hi) {
+    uint32_t mid = (lo + hi)/2; 
+    if (ues_->at(mid)->rnti < rnti) {
+      lo = mid + 1; 
+    } else {
+      hi = mid; 
+    }
+  }
+  if (lo < ues_->size() && ues_->at(lo)->rnti == rnti) {
+    return ues_->at(lo); 
+  }
+  return NULL; 
+}
+
+uint32_t phy_ue_db::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
+{
+  uint32_t cnt = 0; 
+  pthread_mutex_lock(&mutex);
+  for (std::map<uint16_t, uint32_t>::iterator iter=rnti_idx.begin(); iter!=rnti_idx.end() && cnt < ENB_METRICS_MAX_USERS; ++iter) {
+    uint16_t rnti = iter->first; 
+    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END) {
+      ues[iter->second]->metrics_read(&metrics[cnt]);
+      cnt++; 
+    }
+  }
+  pthread_mutex_unlock(&mutex);
+  return cnt; 
+}
+
+void phy_ue_db::get_mem_metrics(phy_ue_mem_metrics_t *metrics)
+{
+  uint64_t nof_bytes = 0; 
+  bzero(metrics, sizeof(phy_ue_mem_metrics_t));
+  pthread_mutex_lock(&mutex);
+  for (std::map<uint16_t, uint32_t>::iterator iter=rnti_idx.begin(); iter!=rnti_idx.end(); ++iter) {
+    uint16_t rnti = iter->first; 
+    if (rnti >= SRSLTE_CRNTI_START && rnti <= SRSLTE_CRNTI_END) {
+      nof_bytes += ues[iter->second]->nof_bytes; 
+      metrics->nof_ues++; 
+    }
+  }
+  metrics->nof_workers = nof_workers; 
+  pthread_mutex_unlock(&mutex);
+  if (metrics->nof_ues) {
+    metrics->bytes_per_ue       = (float) nof_bytes/metrics->nof_ues; 
+    metrics->saved_bytes_per_ue = metrics->bytes_per_ue*(nof_workers>0?nof_workers-1:0); 
+  }
+}
+
+phy_ue_db::ue::ue(uint16_t rnti_, uint32_t idx_)
+{
+  rnti          = rnti_; 
+  idx           = idx_; 
+  I_sr          = 0; 
+  pmi_idx       = 0; 
+  I_sr_en       = false; 
+  cqi_en        = false; 
+  pucch_cqi_ack = false; 
+  nof_refs      = 1; 
+  nof_bytes     = 0; 
+  bzero(&metrics, sizeof(phy_metrics_t));
+  pthread_mutex_init(&metrics_mutex, NULL);
+}
+
+phy_ue_db::ue::~ue()
+{
+  pthread_mutex_destroy(&metrics_mutex);
+}
+
+void phy_ue_db::ue::metrics_read(phy_metrics_t* metrics_)
+{
+  pthread_mutex_lock(&metrics_mutex);
+  memcpy(metrics_, &metrics, sizeof(phy_metrics_t));
+  bzero(&metrics, sizeof(phy_metrics_t));
+  pthread_mutex_unlock(&metrics_mutex);
+}
+
+void phy_ue_db::ue::metrics_dl(uint32_t mcs)
+{
+  pthread_mutex_lock(&metrics_mutex);
+  metrics.dl.mcs = SRSLTE_VEC_CMA(mcs, metrics.dl.mcs, metrics.dl.n_samples);
+  metrics.dl.n_samples++;
+  pthread_mutex_unlock(&metrics_mutex);
+}
+
+void phy_ue_db::ue::metrics_ul(uint32_t mcs, float rssi, float sinr, uint32_t turbo_iters, 
+                               float turbo_iters_spent, float turbo_iters_saved)
+{
+  pthread_mutex_lock(&metrics_mutex);
+  metrics.ul.mcs         = SRSLTE_VEC_CMA((float) mcs,         metrics.ul.mcs,         metrics.ul.n_samples);
+  metrics.ul.sinr        = SRSLTE_VEC_CMA((float) sinr,        metrics.ul.sinr,        metrics.ul.n_samples);
+  metrics.ul.rssi        = SRSLTE_VEC_CMA((float) sinr,        metrics.ul.rssi,        metrics.ul.n_samples);
+  metrics.ul.turbo_iters = SRSLTE_VEC_CMA((float) turbo_iters, metrics.ul.turbo_iters, metrics.ul.n_samples);  
+  metrics.ul.turbo_iters_spent += turbo_iters_spent; 
+  metrics.ul.turbo_iters_saved += turbo_iters_saved; 
+  metrics.ul.n_samples++;
+  pthread_mutex_unlock(&metrics_mutex);
+}
+
+} // namespace srsenb
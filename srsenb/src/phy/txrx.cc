@@ -48,20 +48,30 @@ txrx::txrx()
   radio_h = NULL; 
   log_h   = NULL; 
   workers_pool = NULL; 
+  dl_workers_pool = NULL; 
   worker_com   = NULL; 
+  ul_drop_buffer = NULL; 
 }
 
-bool txrx::init(srslte::radio* radio_h_, srslte::thread_pool* workers_pool_, phch_common* worker_com_, prach_worker *prach_, srslte::log* log_h_, uint32_t prio_)
+bool txrx::init(srslte::radio* radio_h_, srslte::thread_pool* workers_pool_, phch_common* worker_com_, prach_worker *prach_, srslte::log* log_h_, uint32_t prio_, 
+                srslte::thread_pool* dl_workers_pool_)
 {
   radio_h      = radio_h_;
   log_h        = log_h_;     
   workers_pool = workers_pool_;
+  dl_workers_pool = dl_workers_pool_;
   worker_com   = worker_com_;
   prach        = prach_; 
   tx_mutex_cnt = 0; 
   running      = true; 
   
-  nof_tx_mutex = MUTEX_X_WORKER*workers_pool->get_nof_workers();
+  if (dl_workers_pool) {
+    // Pipeline mode: workers_pool decodes the UL, dl_workers_pool generates and transmits the DL
+    nof_tx_mutex = MUTEX_X_WORKER*dl_workers_pool->get_nof_workers();
+    ul_drop_buffer = (cf_t*) srslte_vec_malloc(SRSLTE_SF_LEN_PRB(worker_com->cell.nof_prb)*sizeof(cf_t));
+  } else {
+    nof_tx_mutex = MUTEX_X_WORKER*workers_pool->get_nof_workers();
+  }
   worker_com->set_nof_mutex(nof_tx_mutex);
     
   start(prio_);
@@ -72,11 +82,16 @@ void txrx::stop()
 {
   running = false; 
   wait_thread_finish();
+  if (ul_drop_buffer) {
+    free(ul_drop_buffer);
+    ul_drop_buffer = NULL; 
+  }
 }
 
 void txrx::run_thread()
 {
   phch_worker *worker = NULL;
+  phch_worker *dl_worker = NULL;
   cf_t *buffer = NULL;
   srslte_timestamp_t rx_time, tx_time; 
   uint32_t sf_len = SRSLTE_SF_LEN_PRB(worker_com->cell.nof_prb);
@@ -107,9 +122,16 @@ void txrx::run_thread()
   // Main loop
   while (running) {
     tti = (tti+1)%10240;        
-    worker = (phch_worker*) workers_pool->wait_worker(tti);
-    if (worker) {          
-      buffer = worker->get_buffer_rx();
+    if (dl_workers_pool) {
+      // The UL stage must not hold back the DL one: if no UL worker is free, this TTI is not decoded 
+      dl_worker = (phch_worker*) dl_workers_pool->wait_worker(tti);
+      worker    = dl_worker ? (phch_worker*) workers_pool->wait_worker_nb(tti) : NULL;
+    } else {
+      worker    = (phch_worker*) workers_pool->wait_worker(tti);
+      dl_worker = worker; 
+    }
+    if (dl_worker) {          
+      buffer = worker ? worker->get_buffer_rx() : ul_drop_buffer;
       
       radio_h->rx_now(buffer, sf_len, &rx_time);
                     
@@ -120,13 +142,21 @@ void txrx::run_thread()
       Debug("Settting TTI=%d, tx_mutex=%d, tx_time=%d:%f to worker %d\n", 
             tti, tx_mutex_cnt, 
             tx_time.full_secs, tx_time.frac_secs,
-            worker->get_id());
+            dl_worker->get_id());
       
-      worker->set_time(tti, tx_mutex_cnt, tx_time);
+      if (worker) {
+        worker->set_time(tti, tx_mutex_cnt, tx_time);
+        // Trigger phy worker execution
+        workers_pool->start_worker(worker);       
+      } else {
+        Warning("No UL worker available, skipping UL TTI=%d\n", tti);
+        worker_com->ul_stage_done(tti);
+      }
+      if (dl_worker != worker) {
+        dl_worker->set_time(tti, tx_mutex_cnt, tx_time);
+        dl_workers_pool->start_worker(dl_worker);       
+      }
       tx_mutex_cnt = (tx_mutex_cnt+1)%nof_tx_mutex;
-      
-      // Trigger phy worker execution
-      workers_pool->start_worker(worker);       
 
       // Trigger prach worker execution 
       prach->new_tti(tti, buffer);
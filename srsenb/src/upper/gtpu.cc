@@ -26,6 +26,7 @@
 
 #include "upper/gtpu.h"
 #include <unistd.h>
+#include <errno.h>
 
 using namespace srslte;
 
@@ -53,6 +54,9 @@ bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, srsenb::pdcp_
   
   srslte_netsink_set_nonblocking(&snk);
 
+  // Setup a thread to send uplink packets to the sink socket
+  tx_thread.init(this);
+
   // Setup a thread to receive packets from the src socket
   start(THREAD_PRIO);
   return true;
@@ -74,6 +78,7 @@ void gtpu::stop()
     }
     wait_thread_finish();
   }
+  tx_thread.stop();
 
   srslte_netsink_free(&snk);
   srslte_netsource_free(&src);
@@ -83,15 +88,31 @@ void gtpu::stop()
 void gtpu::write_pdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t* pdu)
 {
   gtpu_log->info_hex(pdu->msg, pdu->N_bytes, "TX PDU, RNTI: 0x%x, LCID: %d", rnti, lcid);
+  uint32_t teid_in;
+  rntilcid_to_teidin(rnti, lcid, &teid_in);
+
+  pthread_mutex_lock(&mutex); 
+  gtpu_teid_table::entry_t *bearer = bearers.find(teid_in);
+  uint32_t teid_out = bearer?bearer->teid_out:0;
+  pthread_mutex_unlock(&mutex); 
+
+  if (!bearer) {
+    gtpu_log->error("No bearer for UL PDU, RNTI: 0x%x, LCID: %d - dropping packet\n", rnti, lcid);
+    pool->deallocate(pdu);
+    return;
+  }
+
   gtpu_header_t header;
   header.flags        = 0x30;
   header.message_type = 0xFF;
   header.length       = pdu->N_bytes;
-  header.teid         = rnti_bearers[rnti].teids_out[lcid];
+  header.teid         = teid_out;
 
-  gtpu_write_header(&header, pdu);
-  srslte_netsink_write(&snk, pdu->msg, pdu->N_bytes);
-  pool->deallocate(pdu);
+  if (gtpu_write_header(&header, pdu)) {
+    tx_thread.push(pdu);
+  } else {
+    pool->deallocate(pdu);
+  }
 }
 
 // gtpu_interface_rrc
@@ -101,89 +122,214 @@ void gtpu::add_bearer(uint16_t rnti, uint32_t lcid, uint32_t teid_out, uint32_t
   rntilcid_to_teidin(rnti, lcid, teid_in);
   gtpu_log->info("Adding bearer for rnti: 0x%x, lcid: %d, teid_out: 0x%x, teid_in: 0x%x\n", rnti, lcid, teid_out, *teid_in);
 
-  // Initialize maps if it's a new RNTI
-  if(rnti_bearers.count(rnti) == 0) {
-    for(int i=0;i<SRSENB_N_RADIO_BEARERS;i++) {
-      rnti_bearers[rnti].teids_in[i]  = 0;
-      rnti_bearers[rnti].teids_out[i] = 0;
-    }
-  }
-
-  rnti_bearers[rnti].teids_in[lcid]  = *teid_in;
-  rnti_bearers[rnti].teids_out[lcid] = teid_out;
+  pthread_mutex_lock(&mutex); 
+  bearers.rem(*teid_in);
+  bearers.add(*teid_in, teid_out, rnti, lcid);
+  pthread_mutex_unlock(&mutex); 
 }
 
 void gtpu::rem_bearer(uint16_t rnti, uint32_t lcid)
 {
   gtpu_log->info("Removing bearer for rnti: 0x%x, lcid: %d\n", rnti, lcid);
+  uint32_t teid_in;
+  rntilcid_to_teidin(rnti, lcid, &teid_in);
 
-  rnti_bearers[rnti].teids_in[lcid]  = 0;
-  rnti_bearers[rnti].teids_out[lcid] = 0;
-
-  // Remove RNTI if all bearers are removed
-  bool rem = true;
-  for(int i=0;i<SRSENB_N_RADIO_BEARERS; i++) {
-    if(rnti_bearers[rnti].teids_in[i] != 0) {
-      rem = false;
-    }
-  }
-  if(rem) {
-    rnti_bearers.erase(rnti);
-  }
+  pthread_mutex_lock(&mutex); 
+  bearers.rem(teid_in);
+  pthread_mutex_unlock(&mutex); 
 }
 
 void gtpu::rem_user(uint16_t rnti)
 {
   pthread_mutex_lock(&mutex); 
-  rnti_bearers.erase(rnti);
+  for(uint32_t lcid=0;lcid<SRSENB_N_RADIO_BEARERS;lcid++) {
+    uint32_t teid_in;
+    rntilcid_to_teidin(rnti, lcid, &teid_in);
+    bearers.rem(teid_in);
+  }
   pthread_mutex_unlock(&mutex); 
 }
 
+/* Makes sure every slot of the receive batch has an empty buffer. Returns the number 
+ * of consecutive slots that could be filled from the pool. 
+ */
+uint32_t gtpu::allocate_rx_batch(srslte::byte_buffer_t **pdus, struct mmsghdr *msgs, struct iovec *iovs)
+{
+  for (uint32_t i=0;i<BATCH_SIZE;i++) {
+    if (!pdus[i]) {
+      pdus[i] = pool_allocate_bytes(RX_BUFFER_BYTES);
+      if (!pdus[i]) {
+        return i;
+      }
+    }
+    pdus[i]->reset();
+    iovs[i].iov_base            = pdus[i]->msg;
+    iovs[i].iov_len             = pdus[i]->get_tailroom();
+    msgs[i].msg_hdr.msg_iov     = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen  = 1;
+    msgs[i].msg_hdr.msg_name    = NULL;
+    msgs[i].msg_hdr.msg_namelen = 0;
+    msgs[i].msg_hdr.msg_flags   = 0;
+    msgs[i].msg_len             = 0;
+  }
+  return BATCH_SIZE;
+}
+
 void gtpu::run_thread()
 {
-  byte_buffer_t *pdu = pool_allocate;
+  srslte::byte_buffer_t *pdus[BATCH_SIZE];
+  struct mmsghdr         msgs[BATCH_SIZE];
+  struct iovec           iovs[BATCH_SIZE];
+  gtpu_header_t          header[BATCH_SIZE];
+  bool                   valid[BATCH_SIZE];
+  uint16_t               rnti[BATCH_SIZE];
+  uint16_t               lcid[BATCH_SIZE];
+
+  bzero(pdus, sizeof(pdus));
+  bzero(msgs, sizeof(msgs));
   run_enable = true;
 
   running=true; 
   while(run_enable) {
-    pdu->reset();
+    // Datagrams are received straight into pool buffers, after their headroom
+    uint32_t nof_buffers = allocate_rx_batch(pdus, msgs, iovs);
+    if (nof_buffers == 0) {
+      gtpu_log->console("GTPU Buffer pool empty. Trying again...\n");
+      usleep(10000);
+      continue;
+    }
     gtpu_log->debug("Waiting for read...\n");
-    pdu->N_bytes = srslte_netsource_read(&src, pdu->msg, SRSENB_MAX_BUFFER_SIZE_BYTES - SRSENB_BUFFER_HEADER_OFFSET);
-
-    
-    gtpu_header_t header;
-    gtpu_read_header(pdu, &header);
+    int n = recvmmsg(src.sockfd, msgs, nof_buffers, MSG_WAITFORONE, NULL);
+    if (n <= 0) {
+      if (n < 0 && errno != EINTR) {
+        gtpu_log->error("Error reading from GTPU socket: %s\n", strerror(errno));
+      }
+      continue;
+    }
 
-    uint16_t rnti = 0;
-    uint16_t lcid = 0;
-    teidin_to_rntilcid(header.teid, &rnti, &lcid);
+    for (int i=0;i<n;i++) {
+      pdus[i]->N_bytes = msgs[i].msg_len;
+      if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+        gtpu_log->error("GTPU PDU larger than %d bytes - dropping packet\n", pdus[i]->get_buffer_size());
+        valid[i] = false;
+        continue;
+      }
+      valid[i]         = pdus[i]->N_bytes >= GTPU_HEADER_LEN && gtpu_read_header(pdus[i], &header[i]);
+    }
 
+    // Resolve the TEIDs of the whole batch with a single lock of the bearer table
     pthread_mutex_lock(&mutex); 
-    bool user_exists = (rnti_bearers.count(rnti) > 0);
+    for (int i=0;i<n;i++) {
+      gtpu_teid_table::entry_t *bearer = valid[i]?bearers.find(header[i].teid):NULL;
+      if (bearer) {
+        rnti[i] = bearer->rnti;
+        lcid[i] = bearer->lcid;
+      } else if (valid[i]) {
+        rnti[i] = (header[i].teid >> 16) & 0xFFFF;
+        lcid[i] = header[i].teid & 0xFFFF;
+        valid[i] = false;
+        gtpu_log->error("Unrecognized RNTI for DL PDU: 0x%x - dropping packet\n", rnti[i]);
+      }
+    }
     pthread_mutex_unlock(&mutex); 
-    
-    if(!user_exists) {
-      gtpu_log->error("Unrecognized RNTI for DL PDU: 0x%x - dropping packet\n", rnti);
-      continue;
+
+    for (int i=0;i<n;i++) {
+      if (!valid[i]) {
+        continue;
+      }
+      if(lcid[i] < SRSENB_N_SRB || lcid[i] >= SRSENB_N_RADIO_BEARERS) {
+        gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid[i]);
+        continue;
+      }
+
+      gtpu_log->info_hex(pdus[i]->msg, pdus[i]->N_bytes, "RX GTPU PDU rnti=0x%x, lcid=%d", rnti[i], lcid[i]);
+
+      pdcp->write_sdu(rnti[i], lcid[i], pdus[i]);
+      pdus[i] = NULL;
+    }
+  }
+  for (uint32_t i=0;i<BATCH_SIZE;i++) {
+    if (pdus[i]) {
+      pool->deallocate(pdus[i]);
     }
+  }
+  running=false;
+}
 
-    if(lcid < SRSENB_N_SRB || lcid >= SRSENB_N_RADIO_BEARERS) {
-      gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid);
-      continue;
+/****************************************************************************
+ * Uplink transmit thread
+ * PDUs written by PDCP are queued and sent to the S-GW with a single sendmmsg 
+ * call for all the PDUs pending when the thread wakes up. 
+ ***************************************************************************/
+void gtpu::tx_process::init(gtpu *parent_)
+{
+  parent = parent_;
+  start(THREAD_PRIO);
+}
+
+void gtpu::tx_process::push(srslte::byte_buffer_t *pdu)
+{
+  if (!tx_queue.try_push(pdu)) {
+    parent->gtpu_log->warning("Dropped UL PDU: TX queue full\n");
+    parent->pool->deallocate(pdu);
+  }
+}
+
+void gtpu::tx_process::stop()
+{
+  // A NULL PDU wakes up and stops the thread
+  tx_queue.push(NULL);
+  wait_thread_finish();
+  srslte::byte_buffer_t *pdu;
+  while (tx_queue.try_pop(&pdu)) {
+    if (pdu) {
+      parent->pool->deallocate(pdu);
     }
+  }
+}
 
-    gtpu_log->info_hex(pdu->msg, pdu->N_bytes, "RX GTPU PDU rnti=0x%x, lcid=%d", rnti, lcid);
+void gtpu::tx_process::run_thread()
+{
+  srslte::byte_buffer_t *pdus[BATCH_SIZE];
+  struct mmsghdr         msgs[BATCH_SIZE];
+  struct iovec           iovs[BATCH_SIZE];
+
+  bzero(msgs, sizeof(msgs));
+  for (uint32_t i=0;i<BATCH_SIZE;i++) {
+    msgs[i].msg_hdr.msg_name    = &parent->snk.servaddr;
+    msgs[i].msg_hdr.msg_namelen = sizeof(parent->snk.servaddr);
+    msgs[i].msg_hdr.msg_iov     = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen  = 1;
+  }
 
-    pdcp->write_sdu(rnti, lcid, pdu);
-    do {
-      pdu = pool_allocate;
-      if (!pdu) {
-        gtpu_log->console("GTPU Buffer pool empty. Trying again...\n");
-        usleep(10000);
+  running = true;
+  while(running) {
+    uint32_t n = tx_queue.wait_pop(pdus, BATCH_SIZE);
+    for (uint32_t i=0;i<n;i++) {
+      if (!pdus[i]) {
+        // Release the PDUs queued after the NULL too
+        for (uint32_t j=i+1;j<n;j++) {
+          parent->pool->deallocate(pdus[j]);
+        }
+        running = false;
+        n = i;
+        break;
       }
-    } while(!pdu); 
+      iovs[i].iov_base = pdus[i]->msg;
+      iovs[i].iov_len  = pdus[i]->N_bytes;
+    }
+
+    if (n > 0) {
+      int sent = sendmmsg(parent->snk.sockfd, msgs, n, 0);
+      if (sent < (int) n) {
+        parent->gtpu_log->warning("Dropped %d of %d UL PDUs: %s\n", n - (sent>0?sent:0), n,
+                                  sent<0?strerror(errno):"socket busy");
+      }
+      for (uint32_t i=0;i<n;i++) {
+        parent->pool->deallocate(pdus[i]);
+      }
+    }
   }
-  running=false;
 }
 
 /****************************************************************************
@@ -224,6 +370,11 @@ bool gtpu::gtpu_write_header(gtpu_header_t *header, srslte::byte_buffer_t *pdu)
 
 bool gtpu::gtpu_read_header(srslte::byte_buffer_t *pdu, gtpu_header_t *header)
 {
+  if(pdu->N_bytes < GTPU_HEADER_LEN) {
+    gtpu_log->error("gtpu_read_header - PDU too short for header\n");
+    return false;
+  }
+
   uint8_t *ptr  = pdu->msg;
 
   pdu->msg      += GTPU_HEADER_LEN;
@@ -252,15 +403,104 @@ bool gtpu::gtpu_read_header(srslte::byte_buffer_t *pdu, gtpu_header_t *header)
 /****************************************************************************
  * TEID to RNIT/LCID helper functions
  ***************************************************************************/
-void gtpu::teidin_to_rntilcid(uint32_t teidin, uint16_t *rnti, uint16_t *lcid)
-{
-  *lcid = teidin & 0xFFFF;
-  *rnti = (teidin >> 16) & 0xFFFF;
-}
-
 void gtpu::rntilcid_to_teidin(uint16_t rnti, uint16_t lcid, uint32_t *teidin)
 {
   *teidin = (rnti << 16) | lcid;
 }
  
+/****************************************************************************
+ * TEID table
+ ***************************************************************************/
+gtpu_teid_table::gtpu_teid_table(uint32_t log2_capacity_)
+{
+  entries = NULL;
+  state   = NULL;
+  resize(log2_capacity_);
+}
+
+gtpu_teid_table::~gtpu_teid_table()
+{
+  delete [] entries;
+  delete [] state;
+}
+
+void gtpu_teid_table::resize(uint32_t new_log2_capacity)
+{
+  entry_t *old_entries  = entries;
+  uint8_t *old_state    = state;
+  uint32_t old_capacity = entries?capacity:0;
+
+  log2_capacity = new_log2_capacity;
+  capacity      = 1<<log2_capacity;
+  entries       = new entry_t[capacity];
+  state         = new uint8_t[capacity];
+  bzero(state, capacity);
+  nof_used      = 0;
+  nof_deleted   = 0;
+
+  for (uint32_t i=0;i<old_capacity;i++) {
+    if (old_state[i] == USED) {
+      add(old_entries[i].teid_in, old_entries[i].teid_out, old_entries[i].rnti, old_entries[i].lcid);
+    }
+  }
+  if (old_entries) {
+    delete [] old_entries;
+    delete [] old_state;
+  }
+}
+
+bool gtpu_teid_table::add(uint32_t teid_in, uint32_t teid_out, uint16_t rnti, uint16_t lcid)
+{
+  if (find(teid_in)) {
+    return false;
+  }
+  // Keep the load (including deleted slots) below 3/4 so that probe sequences stay short
+  if (4*(nof_used+nof_deleted+1) > 3*capacity) {
+    resize(4*(nof_used+1) > capacity?log2_capacity+1:log2_capacity);
+  }
+  uint32_t i = hash(teid_in);
+  while (state[i] == USED) {
+    i = (i+1) & (capacity-1);
+  }
+  if (state[i] == DELETED) {
+    nof_deleted--;
+  }
+  entries[i].teid_in  = teid_in;
+  entries[i].teid_out = teid_out;
+  entries[i].rnti     = rnti;
+  entries[i].lcid     = lcid;
+  state[i]            = USED;
+  nof_used++;
+  return true;
+}
+
+bool gtpu_teid_table::rem(uint32_t teid_in)
+{
+  entry_t *e = find(teid_in);
+  if (!e) {
+    return false;
+  }
+  state[e-entries] = DELETED;
+  nof_used--;
+  nof_deleted++;
+  return true;
+}
+
+gtpu_teid_table::entry_t* gtpu_teid_table::find(uint32_t teid_in)
+{
+  uint32_t i = hash(teid_in);
+  while (state[i] != EMPTY) {
+    if (state[i] == USED && entries[i].teid_in == teid_in) {
+      return &entries[i];
+    }
+    i = (i+1) & (capacity-1);
+  }
+  return NULL;
+}
+
+uint32_t gtpu_teid_table::size()
+{
+  return nof_used;
+}
+
 } // namespace srsenb
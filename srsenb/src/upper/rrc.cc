@@ -29,7 +29,6 @@
 
 using srslte::rb_id_text; 
 using srslte::byte_buffer_t;
-using srslte::bit_buffer_t;
 using srslte::rb_id_t; 
 
 namespace srsenb {
@@ -146,8 +145,7 @@ uint32_t rrc::generate_sibs()
   for (uint32_t i=0;i<nof_messages;i++) {
     LIBLTE_BIT_MSG_STRUCT bitbuffer;
     liblte_rrc_pack_bcch_dlsch_msg(&msg[i], &bitbuffer);
-    srslte_bit_pack_vector(bitbuffer.msg, sib_buffer[i].msg, bitbuffer.N_bits);
-    sib_buffer[i].N_bytes = (bitbuffer.N_bits-1)/8+1;
+    sib_buffer[i].N_bytes = liblte_pack(&bitbuffer, sib_buffer[i].msg);
   }
   return nof_messages; 
 }
@@ -245,7 +243,7 @@ void rrc::upd_user(uint16_t new_rnti, uint16_t old_rnti)
   // Send Reconfiguration to old_rnti if is RRC_CONNECT or RRC Release if already released here
   if (users.count(old_rnti) == 1) {
     if (users[old_rnti].is_connected()) {
-      users[old_rnti].send_connection_reconf_upd(pool_allocate);
+      users[old_rnti].send_connection_reconf_upd();
     } else {
       users[old_rnti].send_connection_release();
     }
@@ -298,8 +296,6 @@ void rrc::write_dl_info(uint16_t rnti, byte_buffer_t* sdu)
     memcpy(dl_dcch_msg.msg.dl_info_transfer.dedicated_info.msg, sdu->msg, sdu->N_bytes);
     dl_dcch_msg.msg.dl_info_transfer.dedicated_info.N_bytes = sdu->N_bytes;
     
-    sdu->reset();
-    
     users[rnti].send_dl_dcch(&dl_dcch_msg, sdu);
         
   } else {
@@ -503,7 +499,7 @@ bool rrc::is_paging_opportunity(uint32_t tti, uint32_t *payload_len)
   
   if (n > 0) {
     pcch_msg.paging_record_list_size = n;
-    liblte_rrc_pack_pcch_msg(&pcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf_paging);
+    liblte_rrc_pack_pcch_msg(&pcch_msg, &bit_buf_paging);
     uint32_t N_bytes = (bit_buf_paging.N_bits-1)/8+1;
 
     if (payload_len) {
@@ -522,7 +518,7 @@ void rrc::read_pdu_pcch(uint8_t *payload, uint32_t buffer_size)
 {
   uint32_t N_bytes = (bit_buf_paging.N_bits-1)/8+1;
   if (N_bytes <= buffer_size) {
-    srslte_bit_pack_vector(bit_buf_paging.msg, payload, bit_buf_paging.N_bits);    
+    liblte_pack(&bit_buf_paging, payload);
   }    
 }
 
@@ -537,9 +533,8 @@ void rrc::parse_ul_ccch(uint16_t rnti, byte_buffer_t *pdu)
   LIBLTE_RRC_UL_CCCH_MSG_STRUCT ul_ccch_msg;
   bzero(&ul_ccch_msg, sizeof(LIBLTE_RRC_UL_CCCH_MSG_STRUCT));
   
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-  bit_buf.N_bits = pdu->N_bytes*8;
-  liblte_rrc_unpack_ul_ccch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &ul_ccch_msg);
+  liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
+  liblte_rrc_unpack_ul_ccch_msg(&bit_buf, &ul_ccch_msg);
 
   rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                     "SRB0 - Rx: %s",
@@ -669,7 +664,7 @@ void rrc::configure_security(uint16_t rnti,
                              srslte::CIPHERING_ALGORITHM_ID_ENUM cipher_algo,
                              srslte::INTEGRITY_ALGORITHM_ID_ENUM integ_algo)
 {
-  // TODO: add k_up_enc, k_up_int support to PDCP
+  // DRBs are configured with k_up_enc when they are added
   pdcp->config_security(rnti, lcid, k_rrc_enc, k_rrc_int, cipher_algo, integ_algo);
 }
   
@@ -775,9 +770,8 @@ void rrc::ue::parse_ul_dcch(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_RRC_UL_DCCH_MSG_STRUCT ul_dcch_msg;
   bzero(&ul_dcch_msg, sizeof(LIBLTE_RRC_UL_DCCH_MSG_STRUCT));
   
-  srslte_bit_unpack_vector(pdu->msg, parent->bit_buf.msg, pdu->N_bytes*8);
-  parent->bit_buf.N_bits = pdu->N_bytes*8;
-  liblte_rrc_unpack_ul_dcch_msg((LIBLTE_BIT_MSG_STRUCT*)&parent->bit_buf, &ul_dcch_msg);
+  liblte_unpack(pdu->msg, pdu->N_bytes, &parent->bit_buf);
+  liblte_rrc_unpack_ul_dcch_msg(&parent->bit_buf, &ul_dcch_msg);
 
   parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                       "%s - Rx %s\n", 
@@ -861,6 +855,9 @@ void rrc::ue::handle_rrc_con_setup_complete(LIBLTE_RRC_CONNECTION_SETUP_COMPLETE
 void rrc::ue::handle_security_mode_complete(LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *msg)
 {
   parent->rrc_log->info("SecurityModeComplete transaction ID: %d\n", msg->rrc_transaction_id);
+
+  // SecurityModeComplete is the last message received unciphered
+  parent->pdcp->enable_encryption(rnti, srslte::RB_ID_SRB1);
 }
 
 void rrc::ue::handle_security_mode_failure(LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *msg)
@@ -901,8 +898,15 @@ void rrc::ue::set_security_key(uint8_t* key, uint32_t length)
 {
   memcpy(k_enb, key, length);
 
-  // Select algos (TODO: use security capabilities and config preferences)
-  cipher_algo = srslte::CIPHERING_ALGORITHM_ID_EEA0;
+  // Select algos (TODO: use config preferences). The first two bits of the
+  // capabilities are 128-EEA1 and 128-EEA2 (36.413 9.2.1.40)
+  if(security_capabilities.encryptionAlgorithms.buffer[1]) {
+    cipher_algo = srslte::CIPHERING_ALGORITHM_ID_128_EEA2;
+  } else if(security_capabilities.encryptionAlgorithms.buffer[0]) {
+    cipher_algo = srslte::CIPHERING_ALGORITHM_ID_128_EEA1;
+  } else {
+    cipher_algo = srslte::CIPHERING_ALGORITHM_ID_EEA0;
+  }
   integ_algo  = srslte::INTEGRITY_ALGORITHM_ID_128_EIA1;
 
   // Generate K_rrc_enc and K_rrc_int
@@ -1264,8 +1268,6 @@ void rrc::ue::send_connection_reconf_upd(srslte::byte_buffer_t *pdu)
   
   sr_get(&phy_cfg->sched_request_cnfg.sr_cnfg_idx, &phy_cfg->sched_request_cnfg.sr_pucch_resource_idx);
   
-  pdu->reset();
-  
   send_dl_dcch(&dl_dcch_msg, pdu);
   
   state = RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE;
@@ -1314,11 +1316,15 @@ void rrc::ue::send_connection_reconf(srslte::byte_buffer_t *pdu)
   // Configure SRB2 in RLC and PDCP
   parent->rlc->add_bearer(rnti, 2);
   parent->pdcp->add_bearer(rnti, 2);
+  parent->pdcp->config_security(rnti, 2, k_rrc_enc, k_rrc_int, cipher_algo, integ_algo);
+  parent->pdcp->enable_encryption(rnti, 2);
   
   // Configure DRB1 in RLC
   parent->rlc->add_bearer(rnti, 3, &conn_reconf->rr_cnfg_ded.drb_to_add_mod_list[0].rlc_cnfg);
   // Configure DRB1 in PDCP
   parent->pdcp->add_bearer(rnti, 3, &conn_reconf->rr_cnfg_ded.drb_to_add_mod_list[0].pdcp_cnfg);
+  parent->pdcp->config_security(rnti, 3, k_up_enc, k_up_int, cipher_algo, integ_algo);
+  parent->pdcp->enable_encryption(rnti, 3);
   // DRB1 has already been configured in GTPU through bearer setup
 
   // Add NAS Attach accept 
@@ -1327,8 +1333,6 @@ void rrc::ue::send_connection_reconf(srslte::byte_buffer_t *pdu)
   memcpy(conn_reconf->ded_info_nas_list[0].msg, parent->erab_info.msg, parent->erab_info.N_bytes);
   
   // Reuse same PDU
-  pdu->reset();
-  
   send_dl_dcch(&dl_dcch_msg, pdu);
   
   state = RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE;
@@ -1336,8 +1340,6 @@ void rrc::ue::send_connection_reconf(srslte::byte_buffer_t *pdu)
 
 void rrc::ue::send_connection_reconf_new_bearer(LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT *e)
 {
-  srslte::byte_buffer_t *pdu = parent->pool->allocate(__FUNCTION__);
-
   LIBLTE_RRC_DL_DCCH_MSG_STRUCT dl_dcch_msg;
   dl_dcch_msg.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG;
   dl_dcch_msg.msg.rrc_con_reconfig.rrc_transaction_id = (transaction_id++)%4;
@@ -1376,6 +1378,8 @@ void rrc::ue::send_connection_reconf_new_bearer(LIBLTE_S1AP_E_RABTOBESETUPLISTBE
     parent->rlc->add_bearer(rnti, lcid, &conn_reconf->rr_cnfg_ded.drb_to_add_mod_list[i].rlc_cnfg);
     // Configure DRB in PDCP
     parent->pdcp->add_bearer(rnti, lcid, &conn_reconf->rr_cnfg_ded.drb_to_add_mod_list[i].pdcp_cnfg);
+    parent->pdcp->config_security(rnti, lcid, k_up_enc, k_up_int, cipher_algo, integ_algo);
+    parent->pdcp->enable_encryption(rnti, lcid);
     // DRB has already been configured in GTPU through bearer setup
 
     // Add NAS message
@@ -1384,7 +1388,7 @@ void rrc::ue::send_connection_reconf_new_bearer(LIBLTE_S1AP_E_RABTOBESETUPLISTBE
     conn_reconf->N_ded_info_nas++;
   }
 
-  send_dl_dcch(&dl_dcch_msg, pdu);
+  send_dl_dcch(&dl_dcch_msg);
 }
 
 void rrc::ue::send_security_mode_command()
@@ -1420,12 +1424,11 @@ void rrc::ue::send_ue_cap_enquiry()
 
 void rrc::ue::send_dl_ccch(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg) 
 {
-  // Allocate a new PDU buffer, pack the message and send to PDCP 
-  byte_buffer_t *pdu = parent->pool->allocate(__FUNCTION__);
+  // Pack the message, allocate a PDU buffer of its size and send to PDCP 
+  liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, &parent->bit_buf);
+  byte_buffer_t *pdu = parent->pool->allocate_bytes((parent->bit_buf.N_bits+7)/8, __FUNCTION__);
   if (pdu) {
-    liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, (LIBLTE_BIT_MSG_STRUCT*) &parent->bit_buf);
-    srslte_bit_pack_vector(parent->bit_buf.msg, pdu->msg, parent->bit_buf.N_bits);
-    pdu->N_bytes = 1+(parent->bit_buf.N_bits-1)/8;
+    pdu->N_bytes = liblte_pack(&parent->bit_buf, pdu->msg);
     parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                           "SRB0 - rnti=0x%x, Sending: %s\n",
                           rnti,
@@ -1440,13 +1443,16 @@ void rrc::ue::send_dl_ccch(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
 
 void rrc::ue::send_dl_dcch(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg, byte_buffer_t *pdu) 
 {  
-  if (!pdu) {
-    pdu = parent->pool->allocate(__FUNCTION__);
+  // Pack the message first, a given pdu is reused only if it has room for it
+  liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, &parent->bit_buf);
+  uint32_t nof_bytes = (parent->bit_buf.N_bits+7)/8;
+  if (pdu) {
+    pdu = parent->pool->reallocate(pdu, nof_bytes, __FUNCTION__);
+  } else {
+    pdu = parent->pool->allocate_bytes(nof_bytes, __FUNCTION__);
   }
   if (pdu) {
-    liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*) &parent->bit_buf);
-    srslte_bit_pack_vector(parent->bit_buf.msg, pdu->msg, parent->bit_buf.N_bits);
-    pdu->N_bytes = 1+(parent->bit_buf.N_bits-1)/8;
+    pdu->N_bytes = liblte_pack(&parent->bit_buf, pdu->msg);
     parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                           "SRB1 - rnti=0x%x, Sending: %s\n",
                           rnti,
@@ -345,7 +345,7 @@ bool s1ap::setup_s1()
 {
   uint32_t                    tmp32;
   uint16_t                    tmp16;
-  srslte::byte_buffer_t       msg;
+  LIBLTE_BYTE_MSG_STRUCT      msg;
   LIBLTE_S1AP_S1AP_PDU_STRUCT pdu;
 
   pdu.choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
@@ -398,7 +398,7 @@ bool s1ap::setup_s1()
   s1setup->DefaultPagingDRX.ext = false;
   s1setup->DefaultPagingDRX.e   = LIBLTE_S1AP_PAGINGDRX_V128; // Todo: add to args, config file
 
-  liblte_s1ap_pack_s1ap_pdu(&pdu, (LIBLTE_BYTE_MSG_STRUCT*)&msg);
+  liblte_s1ap_pack_s1ap_pdu(&pdu, &msg);
   s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending s1SetupRequest");
 
   ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
@@ -419,8 +419,11 @@ bool s1ap::setup_s1()
 bool s1ap::handle_s1ap_rx_pdu(srslte::byte_buffer_t *pdu)
 {
   LIBLTE_S1AP_S1AP_PDU_STRUCT rx_pdu;
+  LIBLTE_BYTE_MSG_STRUCT      msg;
 
-  if(liblte_s1ap_unpack_s1ap_pdu((LIBLTE_BYTE_MSG_STRUCT*)pdu, &rx_pdu) != LIBLTE_SUCCESS) {
+  memcpy(msg.msg, pdu->msg, pdu->N_bytes);
+  msg.N_bytes = pdu->N_bytes;
+  if(liblte_s1ap_unpack_s1ap_pdu(&msg, &rx_pdu) != LIBLTE_SUCCESS) {
     s1ap_log->error("Failed to unpack received PDU\n");
     return false;
   }
@@ -512,7 +515,7 @@ bool s1ap::handle_dlnastransport(LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT
     s1ap_log->warning("Not handling SubscriberProfileIDforRFP\n");
   }
 
-  srslte::byte_buffer_t *pdu = pool_allocate;
+  srslte::byte_buffer_t *pdu = pool_allocate_bytes(msg->NAS_PDU.n_octets);
   memcpy(pdu->msg, msg->NAS_PDU.buffer, msg->NAS_PDU.n_octets);
   pdu->N_bytes = msg->NAS_PDU.n_octets;
   rrc->write_dl_info(rnti, pdu);
@@ -651,7 +654,7 @@ bool s1ap::send_initialuemessage(uint16_t rnti, srslte::byte_buffer_t *pdu, bool
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t msg;
+  LIBLTE_BYTE_MSG_STRUCT msg;
 
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
   tx_pdu.ext          = false;
@@ -701,7 +704,7 @@ bool s1ap::send_initialuemessage(uint16_t rnti, srslte::byte_buffer_t *pdu, bool
   initue->RRC_Establishment_Cause.ext = false;
   initue->RRC_Establishment_Cause.e   = LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_MO_SIGNALLING;
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)&msg);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
   s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending InitialUEMessage for RNTI:0x%x", rnti);
 
   ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
@@ -720,7 +723,7 @@ bool s1ap::send_ulnastransport(uint16_t rnti, srslte::byte_buffer_t *pdu)
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t msg;
+  LIBLTE_BYTE_MSG_STRUCT msg;
 
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
   tx_pdu.ext          = false;
@@ -751,7 +754,7 @@ bool s1ap::send_ulnastransport(uint16_t rnti, srslte::byte_buffer_t *pdu)
   // TAI
   memcpy(&ultx->TAI, &tai, sizeof(LIBLTE_S1AP_TAI_STRUCT));
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)&msg);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
   s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending UplinkNASTransport for RNTI:0x%x", rnti);
 
   ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
@@ -770,7 +773,7 @@ bool s1ap::send_uectxtreleaserequest(uint16_t rnti, LIBLTE_S1AP_CAUSE_STRUCT *ca
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t msg;
+  LIBLTE_BYTE_MSG_STRUCT msg;
 
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
   tx_pdu.ext          = false;
@@ -792,7 +795,7 @@ bool s1ap::send_uectxtreleaserequest(uint16_t rnti, LIBLTE_S1AP_CAUSE_STRUCT *ca
   // Cause
   memcpy(&req->Cause, cause, sizeof(LIBLTE_S1AP_CAUSE_STRUCT));
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)&msg);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
   s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending UEContextReleaseRequest for RNTI:0x%x", rnti);
 
   ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
@@ -811,7 +814,7 @@ bool s1ap::send_uectxtreleasecomplete(uint16_t rnti, uint32_t mme_ue_id, uint32_
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t msg;
+  LIBLTE_BYTE_MSG_STRUCT msg;
 
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
   tx_pdu.ext          = false;
@@ -829,7 +832,7 @@ bool s1ap::send_uectxtreleasecomplete(uint16_t rnti, uint32_t mme_ue_id, uint32_
   comp->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = enb_ue_id;
   comp->MME_UE_S1AP_ID.MME_UE_S1AP_ID = mme_ue_id;
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)&msg);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
   s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending UEContextReleaseComplete for RNTI:0x%x", rnti);
 
   ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
@@ -848,7 +851,7 @@ bool s1ap::send_initial_ctxt_setup_response(uint16_t rnti, LIBLTE_S1AP_MESSAGE_I
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t *buf = pool_allocate;
+  LIBLTE_BYTE_MSG_STRUCT msg;
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
 
   tx_pdu.ext          = false;
@@ -875,10 +878,10 @@ bool s1ap::send_initial_ctxt_setup_response(uint16_t rnti, LIBLTE_S1AP_MESSAGE_I
   res->MME_UE_S1AP_ID.MME_UE_S1AP_ID = ue_ctxt_map[rnti].MME_UE_S1AP_ID;
   res->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = ue_ctxt_map[rnti].eNB_UE_S1AP_ID;
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)buf);
-  s1ap_log->info_hex(buf->msg, buf->N_bytes, "Sending InitialContextSetupResponse for RNTI:0x%x", rnti);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
+  s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending InitialContextSetupResponse for RNTI:0x%x", rnti);
 
-  ssize_t n_sent = sctp_sendmsg(socket_fd, buf->msg, buf->N_bytes,
+  ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
                                 (struct sockaddr*)&mme_addr, sizeof(struct sockaddr_in),
                                 htonl(PPID), 0, ue_ctxt_map[rnti].stream_id, 0, 0);
   if(n_sent == -1) {
@@ -894,7 +897,7 @@ bool s1ap::send_erab_setup_response(uint16_t rnti, LIBLTE_S1AP_MESSAGE_E_RABSETU
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t *buf = pool_allocate;
+  LIBLTE_BYTE_MSG_STRUCT msg;
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
 
   tx_pdu.ext          = false;
@@ -921,10 +924,10 @@ bool s1ap::send_erab_setup_response(uint16_t rnti, LIBLTE_S1AP_MESSAGE_E_RABSETU
   res->MME_UE_S1AP_ID.MME_UE_S1AP_ID = ue_ctxt_map[rnti].MME_UE_S1AP_ID;
   res->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = ue_ctxt_map[rnti].eNB_UE_S1AP_ID;
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)buf);
-  s1ap_log->info_hex(buf->msg, buf->N_bytes, "Sending E_RABSetupResponse for RNTI:0x%x", rnti);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
+  s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending E_RABSetupResponse for RNTI:0x%x", rnti);
 
-  ssize_t n_sent = sctp_sendmsg(socket_fd, buf->msg, buf->N_bytes,
+  ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
                                 (struct sockaddr*)&mme_addr, sizeof(struct sockaddr_in),
                                 htonl(PPID), 0, ue_ctxt_map[rnti].stream_id, 0, 0);
   if(n_sent == -1) {
@@ -940,7 +943,7 @@ bool s1ap::send_initial_ctxt_setup_failure(uint16_t rnti)
   if(!mme_connected) {
     return false;
   }
-  srslte::byte_buffer_t *buf = pool_allocate;
+  LIBLTE_BYTE_MSG_STRUCT msg;
   LIBLTE_S1AP_S1AP_PDU_STRUCT tx_pdu;
   tx_pdu.ext         = false;
   tx_pdu.choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_UNSUCCESSFULOUTCOME;
@@ -961,10 +964,10 @@ bool s1ap::send_initial_ctxt_setup_failure(uint16_t rnti)
   fail->Cause.choice.radioNetwork.ext = false;
   fail->Cause.choice.radioNetwork.e   = LIBLTE_S1AP_CAUSERADIONETWORK_UNSPECIFIED;
 
-  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)&buf);
-  s1ap_log->info_hex(buf->msg, buf->N_bytes, "Sending InitialContextSetupFailure for RNTI:0x%x", rnti);
+  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
+  s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending InitialContextSetupFailure for RNTI:0x%x", rnti);
 
-  ssize_t n_sent = sctp_sendmsg(socket_fd, buf->msg, buf->N_bytes,
+  ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
                                 (struct sockaddr*)&mme_addr, sizeof(struct sockaddr_in),
                                 htonl(PPID), 0, ue_ctxt_map[rnti].stream_id, 0, 0);
   if(n_sent == -1) {
@@ -994,7 +997,7 @@ bool s1ap::send_initial_ctxt_setup_failure(uint16_t rnti)
 //  caps->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = ue_ctxt_map[rnti].eNB_UE_S1AP_ID;
 //  // TODO: caps->UERadioCapability.
 
-//  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT*)&msg);
+//  liblte_s1ap_pack_s1ap_pdu(&tx_pdu, &msg);
 //  s1ap_log->info_hex(msg.msg, msg.N_bytes, "Sending UERadioCapabilityInfo for RNTI:0x%x", rnti);
 
 //  ssize_t n_sent = sctp_sendmsg(socket_fd, msg.msg, msg.N_bytes,
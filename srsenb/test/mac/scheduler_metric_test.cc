@@ -0,0 +1,325 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Checks the decisions of the proportional-fair and max C/I metrics: HARQ
+ * retransmissions are ranked first, max C/I serves the UE with the best CQI,
+ * PF is fairer than max C/I by Jain's index, DL RBGs follow the sub-band CQI,
+ * and idle UEs are scheduled again as soon as they report data.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <vector>
+
+#include "mac/scheduler.h"
+#include "mac/scheduler_metric.h"
+#include "srslte/common/log_stdout.h"
+
+#define NOF_PRB  25
+#define LCID     3
+#define MAX_UES  10
+
+srslte::log_stdout log_out("SCHED");
+
+typedef struct {
+  srsenb::sched                          *sched;
+  uint32_t                                nof_ues;
+  uint64_t                                dl_bytes[MAX_UES];
+  srsenb::sched_interface::dl_sched_res_t dl_res[4];   // DL results of the last 4 TTIs, ACKed 4 TTIs later
+} test_cell_t;
+
+uint16_t ue_rnti(uint32_t i) {
+  return 0x46+i;
+}
+
+bool setup(test_cell_t *c, srsenb::sched *sched, srsenb::sched::metric_dl *dl_metric, srsenb::sched::metric_ul *ul_metric,
+           uint32_t nof_ues, const uint32_t *cqi)
+{
+  bzero(c, sizeof(test_cell_t));
+  c->sched   = sched;
+  c->nof_ues = nof_ues;
+
+  srsenb::sched_interface::cell_cfg_t cell_cfg;
+  bzero(&cell_cfg, sizeof(srsenb::sched_interface::cell_cfg_t));
+  cell_cfg.cell.id              = 1;
+  cell_cfg.cell.cp              = SRSLTE_CP_NORM;
+  cell_cfg.cell.nof_ports       = 1;
+  cell_cfg.cell.nof_prb         = NOF_PRB;
+  cell_cfg.cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell_cfg.cell.phich_resources = SRSLTE_PHICH_R_1;
+  cell_cfg.si_window_ms         = 40;
+
+  sched->init(NULL, &log_out);
+  sched->set_metric(dl_metric, ul_metric);
+  if (sched->cell_cfg(&cell_cfg)) {
+    return false;
+  }
+
+  srsenb::sched_interface::ue_cfg_t ue_cfg;
+  bzero(&ue_cfg, sizeof(srsenb::sched_interface::ue_cfg_t));
+  ue_cfg.maxharq_tx = 4;
+  srsenb::sched_interface::ue_bearer_cfg_t bearer_cfg;
+  bzero(&bearer_cfg, sizeof(srsenb::sched_interface::ue_bearer_cfg_t));
+  bearer_cfg.direction = srsenb::sched_interface::ue_bearer_cfg_t::BOTH;
+
+  for (uint32_t i=0;i<nof_ues;i++) {
+    sched->ue_cfg(ue_rnti(i), &ue_cfg);
+    sched->bearer_ue_cfg(ue_rnti(i), LCID, &bearer_cfg);
+    sched->dl_cqi_info(0, ue_rnti(i), cqi[i]);
+    sched->ul_cqi_info(0, ue_rnti(i), cqi[i], 0);
+  }
+  return true;
+}
+
+// Runs the DL scheduler for one TTI. The grants of 4 TTIs ago are ACKed, except the ones of nack_rnti
+srsenb::sched_interface::dl_sched_res_t* run_tti(test_cell_t *c, uint32_t tti, bool full_buffer, uint16_t nack_rnti = 0)
+{
+  srsenb::sched_interface::dl_sched_res_t *res = &c->dl_res[tti%4];
+  if (tti >= 4) {
+    for (uint32_t i=0;i<res->nof_data_elems;i++) {
+      uint16_t rnti = res->data[i].rnti;
+      bool     ack  = rnti != nack_rnti;
+      int      tbs  = c->sched->dl_ack_info(tti, rnti, ack);
+      if (ack && tbs > 0) {
+        c->dl_bytes[rnti-ue_rnti(0)] += tbs;
+      }
+    }
+  }
+  if (full_buffer) {
+    for (uint32_t i=0;i<c->nof_ues;i++) {
+      c->sched->dl_rlc_buffer_state(ue_rnti(i), LCID, 1e6, 0);
+    }
+  }
+  c->sched->dl_sched(tti, res);
+  return res;
+}
+
+bool is_scheduled(srsenb::sched_interface::dl_sched_res_t *res, uint16_t rnti)
+{
+  for (uint32_t i=0;i<res->nof_data_elems;i++) {
+    if (res->data[i].rnti == rnti) {
+      return true;
+    }
+  }
+  return false;
+}
+
+float jain_index(test_cell_t *c)
+{
+  double sum = 0, sum2 = 0;
+  for (uint32_t i=0;i<c->nof_ues;i++) {
+    sum  += c->dl_bytes[i];
+    sum2 += (double) c->dl_bytes[i]*c->dl_bytes[i];
+  }
+  return sum2>0?sum*sum/(c->nof_ues*sum2):0;
+}
+
+// A retransmission of a low-CQI UE goes before the new data of a high-CQI UE that would take all RBGs
+bool test_retx_first(float fairness)
+{
+  srsenb::sched        sched;
+  srsenb::dl_metric_pf dl_metric;
+  srsenb::ul_metric_pf ul_metric;
+  dl_metric.set_params(100, fairness);
+  ul_metric.set_params(100, fairness);
+
+  const uint32_t cqi[2] = {15, 3};
+  test_cell_t c;
+  if (!setup(&c, &sched, &dl_metric, &ul_metric, 2, cqi)) {
+    return false;
+  }
+  uint16_t good = ue_rnti(0), bad = ue_rnti(1);
+
+  // Only the low-CQI UE has data in the first TTI
+  sched.dl_rlc_buffer_state(bad, LCID, 100, 0);
+  if (!is_scheduled(run_tti(&c, 0, false), bad)) {
+    printf("Low-CQI UE not scheduled alone\n");
+    return false;
+  }
+  sched.dl_rlc_buffer_state(bad, LCID, 0, 0);
+
+  // Its transport block is NACKed in TTI 4 and the retransmission is due in TTI 8
+  for (uint32_t tti=1;tti<8;tti++) {
+    sched.dl_rlc_buffer_state(good, LCID, 1e6, 0);
+    if (is_scheduled(run_tti(&c, tti, false, bad), bad)) {
+      printf("Retransmission scheduled before it is due, tti=%d\n", tti);
+      return false;
+    }
+  }
+  sched.dl_rlc_buffer_state(good, LCID, 1e6, 0);
+  if (!is_scheduled(run_tti(&c, 8, false), bad)) {
+    printf("Retransmission not ranked first with fairness %.1f\n", fairness);
+    return false;
+  }
+  return true;
+}
+
+// With max C/I, a full-buffer UE with the best CQI takes the cell
+bool test_max_ci_best_cqi()
+{
+  srsenb::sched        sched;
+  srsenb::dl_metric_pf dl_metric;
+  srsenb::ul_metric_pf ul_metric;
+  dl_metric.set_params(100, 0.0);
+  ul_metric.set_params(100, 0.0);
+
+  const uint32_t cqi[3] = {5, 15, 10};
+  test_cell_t c;
+  if (!setup(&c, &sched, &dl_metric, &ul_metric, 3, cqi)) {
+    return false;
+  }
+  for (uint32_t tti=0;tti<200;tti++) {
+    run_tti(&c, tti, true);
+  }
+  if (c.dl_bytes[1] == 0 || c.dl_bytes[1] < 10*(c.dl_bytes[0]+c.dl_bytes[2])) {
+    printf("Max C/I DL bytes: cqi=5: %ld, cqi=15: %ld, cqi=10: %ld\n",
+           (long) c.dl_bytes[0], (long) c.dl_bytes[1], (long) c.dl_bytes[2]);
+    return false;
+  }
+  return true;
+}
+
+// Jain's index of the DL throughput of full-buffer UEs with different CQIs
+float run_fairness(float fairness)
+{
+  srsenb::sched        sched;
+  srsenb::dl_metric_pf dl_metric;
+  srsenb::ul_metric_pf ul_metric;
+  dl_metric.set_params(100, fairness);
+  ul_metric.set_params(100, fairness);
+
+  uint32_t cqi[MAX_UES];
+  for (uint32_t i=0;i<MAX_UES;i++) {
+    cqi[i] = 3+i;
+  }
+  test_cell_t c;
+  if (!setup(&c, &sched, &dl_metric, &ul_metric, MAX_UES, cqi)) {
+    return 0;
+  }
+  for (uint32_t tti=0;tti<1000;tti++) {
+    run_tti(&c, tti, true);
+  }
+  return jain_index(&c);
+}
+
+bool test_pf_fairer()
+{
+  float pf     = run_fairness(1.0);
+  float max_ci = run_fairness(0.0);
+  if (pf < 2*max_ci || pf < 0.5) {
+    printf("Jain's index PF %.3f, max C/I %.3f\n", pf, max_ci);
+    return false;
+  }
+  return true;
+}
+
+// A UE with a small buffer gets the RBGs where its sub-band CQI is best
+bool test_subband_rbg()
+{
+  srsenb::sched        sched;
+  srsenb::dl_metric_pf dl_metric;
+  srsenb::ul_metric_pf ul_metric;
+
+  const uint32_t cqi[1] = {7};
+  test_cell_t c;
+  if (!setup(&c, &sched, &dl_metric, &ul_metric, 1, cqi)) {
+    return false;
+  }
+  uint32_t P  = srslte_ra_type0_P(NOF_PRB);
+  uint32_t nb = (NOF_PRB+P-1)/P;
+  // Best sub-band CQI on the first three RBGs
+  uint32_t best_mask = 0;
+  for (uint32_t j=0;j<nb;j++) {
+    sched.dl_cqi_subband_info(0, ue_rnti(0), j*P, P, j<3?15:2);
+    if (j<3) {
+      best_mask |= 1<<(nb-j-1);
+    }
+  }
+  sched.dl_rlc_buffer_state(ue_rnti(0), LCID, 50, 0);
+  srsenb::sched_interface::dl_sched_res_t *res = run_tti(&c, 0, false);
+  uint32_t mask = res->nof_data_elems?res->data[0].dci.type0_alloc.rbg_bitmask:0;
+  if (!mask || (mask & ~best_mask)) {
+    printf("RBG mask 0x%x outside of the best sub-bands 0x%x\n", mask, best_mask);
+    return false;
+  }
+  return true;
+}
+
+// UEs leave the ready set while idle and are scheduled again on their next buffer report or SR
+bool test_idle_ues()
+{
+  srsenb::sched        sched;
+  srsenb::dl_metric_pf dl_metric;
+  srsenb::ul_metric_pf ul_metric;
+
+  const uint32_t cqi[2] = {10, 10};
+  test_cell_t c;
+  if (!setup(&c, &sched, &dl_metric, &ul_metric, 2, cqi)) {
+    return false;
+  }
+  srsenb::sched_interface::ul_sched_res_t ul_res;
+  for (uint32_t tti=0;tti<20;tti++) {
+    if (run_tti(&c, tti, false)->nof_data_elems) {
+      printf("DL grant without data\n");
+      return false;
+    }
+    sched.ul_sched(tti+4, &ul_res);
+  }
+  sched.dl_rlc_buffer_state(ue_rnti(1), LCID, 100, 0);
+  if (!is_scheduled(run_tti(&c, 20, false), ue_rnti(1))) {
+    printf("Idle UE not scheduled in the DL after a buffer report\n");
+    return false;
+  }
+  sched.ul_sr_info(20, ue_rnti(0));
+  sched.ul_sched(24, &ul_res);
+  if (ul_res.nof_dci_elems != 1 || ul_res.pusch[0].rnti != ue_rnti(0)) {
+    printf("Idle UE not scheduled in the UL after a SR\n");
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  log_out.set_level(srslte::LOG_LEVEL_NONE);
+
+  bool ok = true;
+  ok &= test_retx_first(1.0);
+  ok &= test_retx_first(0.0);
+  ok &= test_max_ci_best_cqi();
+  ok &= test_pf_fairer();
+  ok &= test_subband_rbg();
+  ok &= test_idle_ues();
+
+  if (ok) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    exit(1);
+  }
+}
@@ -0,0 +1,269 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/* Scheduler simulation benchmark. Runs the MAC scheduler alone for a number of 
+ * full-buffer UEs, each with its own average CQI and a random per-RBG sub-band CQI 
+ * around it. Transport blocks are ACKed with a probability that drops when the MCS 
+ * was chosen from a CQI above the one of the channel. For every policy and number 
+ * of UEs it reports the DL and UL cell throughput, Jain's fairness index of the UE 
+ * throughputs and the scheduling time per TTI. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <strings.h>
+#include <vector>
+#include <sys/time.h>
+
+#include "mac/scheduler.h"
+#include "mac/scheduler_metric.h"
+#include "srslte/common/log_stdout.h"
+
+uint32_t nof_prb  = 25; 
+uint32_t nof_ttis = 2000; 
+uint32_t nof_ues  = 0;     // 0 runs 1, 10, 50, 100, 200 and 500 UEs 
+char    *policy   = NULL;  // NULL runs all policies 
+
+void usage(char *prog) {
+  printf("Usage: %s [ctup]\n", prog);
+  printf("\t-c cell bandwidth in PRB [Default %d]\n", nof_prb);
+  printf("\t-t number of TTIs [Default %d]\n", nof_ttis);
+  printf("\t-u number of UEs [Default 1 to 500]\n");
+  printf("\t-p scheduling policy: rr, pf or max_ci [Default all]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ctup")) != -1) {
+    switch (opt) {
+    case 'c':
+      nof_prb = atoi(argv[optind]);
+      break;
+    case 't':
+      nof_ttis = atoi(argv[optind]);
+      break;
+    case 'u':
+      nof_ues = atoi(argv[optind]);
+      break;
+    case 'p':
+      policy = argv[optind];
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  uint16_t rnti; 
+  uint32_t cqi;                // Average (wideband) CQI 
+  uint32_t sb_cqi[25];         // Sub-band CQI per RBG 
+  uint64_t dl_bytes; 
+  uint64_t ul_bytes; 
+} sim_ue_t; 
+
+const static uint32_t CQI_PERIOD = 5; 
+const static uint32_t LCID       = 3; 
+
+// Transmissions above the channel CQI fail with a higher probability 
+bool sim_ack(uint32_t channel_cqi, uint32_t used_cqi) {
+  float bler = used_cqi > channel_cqi ? 0.5 : 0.1; 
+  return (float) rand()/RAND_MAX >= bler; 
+}
+
+float jain_index(std::vector<sim_ue_t> &ues, bool dl) {
+  double sum = 0, sum2 = 0; 
+  for (uint32_t i=0;i<ues.size();i++) {
+    double x = dl?ues[i].dl_bytes:ues[i].ul_bytes; 
+    sum  += x; 
+    sum2 += x*x; 
+  }
+  return sum2>0?sum*sum/(ues.size()*sum2):0; 
+}
+
+int run_sim(const char *name, srsenb::sched::metric_dl *dl_metric, srsenb::sched::metric_ul *ul_metric, uint32_t n_ues)
+{
+  srslte::log_stdout  log("SCHED");
+  srsenb::sched       sched; 
+  log.set_level(srslte::LOG_LEVEL_ERROR);
+  
+  srsenb::sched_interface::cell_cfg_t cell_cfg; 
+  bzero(&cell_cfg, sizeof(srsenb::sched_interface::cell_cfg_t));
+  cell_cfg.cell.id              = 1; 
+  cell_cfg.cell.cp              = SRSLTE_CP_NORM; 
+  cell_cfg.cell.nof_ports       = 1; 
+  cell_cfg.cell.nof_prb         = nof_prb; 
+  cell_cfg.cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell_cfg.cell.phich_resources = SRSLTE_PHICH_R_1;
+  cell_cfg.sibs[0].len          = 18;
+  cell_cfg.sibs[0].period_rf    = 8;
+  cell_cfg.si_window_ms         = 40;
+  
+  sched.init(NULL, &log);
+  sched.set_metric(dl_metric, ul_metric);
+  if (sched.cell_cfg(&cell_cfg)) {
+    fprintf(stderr, "Error configuring cell\n");
+    return -1; 
+  }
+  
+  srsenb::sched_interface::ue_cfg_t ue_cfg;
+  bzero(&ue_cfg, sizeof(srsenb::sched_interface::ue_cfg_t));
+  ue_cfg.maxharq_tx = 4; 
+  srsenb::sched_interface::ue_bearer_cfg_t bearer_cfg;
+  bzero(&bearer_cfg, sizeof(srsenb::sched_interface::ue_bearer_cfg_t));
+  bearer_cfg.direction = srsenb::sched_interface::ue_bearer_cfg_t::BOTH; 
+
+  std::vector<sim_ue_t> ues(n_ues); 
+  std::map<uint16_t, uint32_t> ue_idx; 
+  for (uint32_t i=0;i<n_ues;i++) {
+    bzero(&ues[i], sizeof(sim_ue_t));
+    ues[i].rnti = 0x46+i; 
+    ues[i].cqi  = 3 + rand()%13; 
+    ue_idx[ues[i].rnti] = i; 
+    sched.ue_cfg(ues[i].rnti, &ue_cfg);
+    sched.bearer_ue_cfg(ues[i].rnti, LCID, &bearer_cfg);
+    sched.ul_bsr(ues[i].rnti, LCID, 1e6);
+  }
+  
+  uint32_t P      = srslte_ra_type0_P(nof_prb); 
+  uint32_t nb     = (nof_prb+P-1)/P; 
+  double   sched_us = 0; 
+  
+  srsenb::sched_interface::dl_sched_res_t dl_res;
+  srsenb::sched_interface::ul_sched_res_t ul_res;
+  srsenb::sched_interface::dl_sched_res_t dl_pending[4]; 
+  
+  for (uint32_t tti=0;tti<nof_ttis;tti++) {
+    
+    // Channel and buffer state reports 
+    for (uint32_t i=0;i<n_ues;i++) {
+      if (tti%CQI_PERIOD == i%CQI_PERIOD) {
+        sched.dl_cqi_info(tti, ues[i].rnti, ues[i].cqi); 
+        sched.ul_cqi_info(tti, ues[i].rnti, ues[i].cqi, 0);
+        for (uint32_t j=0;j<nb;j++) {
+          int c = (int) ues[i].cqi + rand()%5 - 2; 
+          ues[i].sb_cqi[j] = (uint32_t) SRSLTE_MAX(1, SRSLTE_MIN(15, c)); 
+          sched.dl_cqi_subband_info(tti, ues[i].rnti, j*P, P, ues[i].sb_cqi[j]); 
+        }
+      }
+      sched.dl_rlc_buffer_state(ues[i].rnti, LCID, 1e6, 0); 
+    }
+    
+    // HARQ feedback for the DL grants of 4 TTIs ago 
+    srsenb::sched_interface::dl_sched_res_t *past = &dl_pending[tti%4]; 
+    if (tti >= 4) {
+      for (uint32_t i=0;i<past->nof_data_elems;i++) {
+        sim_ue_t *ue   = &ues[ue_idx[past->data[i].rnti]]; 
+        uint32_t  mcs  = past->data[i].dci.mcs_idx; 
+        uint32_t  mask = past->data[i].dci.type0_alloc.rbg_bitmask; 
+        uint32_t  cqi = 0, n = 0; 
+        for (uint32_t j=0;j<nb;j++) {
+          if (mask & (1<<(nb-j-1))) {
+            cqi += ue->sb_cqi[j]; 
+            n++; 
+          }
+        }
+        // MCS 28 needs about CQI 15 
+        bool ack = sim_ack(n?cqi/n:ue->cqi, 1+mcs/2); 
+        int  tbs = sched.dl_ack_info(tti, ue->rnti, ack); 
+        if (ack && tbs > 0) {
+          ue->dl_bytes += tbs; 
+        }
+      }
+    }
+    
+    struct timeval t[3]; 
+    gettimeofday(&t[1], NULL);
+    sched.dl_sched(tti, &dl_res);
+    sched.ul_sched((tti+4)%10240, &ul_res);
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    sched_us += t[0].tv_sec*1e6 + t[0].tv_usec; 
+    
+    memcpy(past, &dl_res, sizeof(srsenb::sched_interface::dl_sched_res_t));
+    for (uint32_t i=0;i<ul_res.nof_dci_elems;i++) {
+      sim_ue_t *ue = &ues[ue_idx[ul_res.pusch[i].rnti]]; 
+      bool ack = sim_ack(ue->cqi, 1+ul_res.pusch[i].dci.mcs_idx/2); 
+      sched.ul_crc_info((tti+4)%10240, ue->rnti, ack); 
+      if (ack) {
+        ue->ul_bytes += ul_res.pusch[i].tbs; 
+      }
+    }
+  }
+  
+  uint64_t dl_bytes = 0, ul_bytes = 0; 
+  for (uint32_t i=0;i<n_ues;i++) {
+    dl_bytes += ues[i].dl_bytes; 
+    ul_bytes += ues[i].ul_bytes; 
+  }
+  printf("%-7s %4d UEs: DL %6.2f Mbps (fairness %.3f), UL %6.2f Mbps (fairness %.3f), %6.1f us/TTI\n", 
+         name, n_ues, 8e-3*dl_bytes/nof_ttis, jain_index(ues, true), 8e-3*ul_bytes/nof_ttis, jain_index(ues, false), 
+         sched_us/nof_ttis); 
+  
+  // The metrics are reused by the next run 
+  sched.reset(); 
+  return 0; 
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+  
+  const uint32_t ue_counts[] = {1, 10, 50, 100, 200, 500}; 
+  uint32_t nof_counts = sizeof(ue_counts)/sizeof(uint32_t); 
+
+  srsenb::dl_metric_rr dl_rr; 
+  srsenb::ul_metric_rr ul_rr; 
+  srsenb::dl_metric_pf dl_pf; 
+  srsenb::ul_metric_pf ul_pf; 
+  
+  for (uint32_t p=0;p<3;p++) {
+    const char *names[3] = {"rr", "pf", "max_ci"}; 
+    if (policy && strcmp(policy, names[p])) {
+      continue; 
+    }
+    dl_pf.set_params(100, p==1?1.0:0.0);
+    ul_pf.set_params(100, p==1?1.0:0.0);
+    for (uint32_t i=0;i<nof_counts;i++) {
+      uint32_t n = nof_ues?nof_ues:ue_counts[i]; 
+      srand(1234); 
+      if (p == 0) {
+        run_sim(names[p], &dl_rr, &ul_rr, n); 
+      } else {
+        run_sim(names[p], &dl_pf, &ul_pf, n); 
+      }
+      if (nof_ues) {
+        break; 
+      }
+    }
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,164 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Checks the TBS tables of the scheduler against the linear search they replace. For every
+ * bandwidth, maximum MCS, CQI and number of control symbols, a UE with the tables and a UE
+ * without them must return the same grant sizes and minimum number of PRB, and the table
+ * entries must match sched_ue::alloc_tbs for every number of PRB.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+
+#include "mac/scheduler_ue.h"
+#include "mac/scheduler_tbs.h"
+#include "srslte/common/log_stdout.h"
+
+#define NOF_CQI              16
+#define MAX_NOF_CTRL_SYMBOLS 4
+
+srslte::log_stdout log_out("SCHED");
+
+uint32_t nof_errors = 0;
+
+void check(bool cond, const char *what, uint32_t nof_prb, int max_mcs, uint32_t cqi, uint32_t c, uint32_t n, int tab, int lin)
+{
+  if (!cond) {
+    if (nof_errors < 10) {
+      printf("%s mismatch: nof_prb=%d, max_mcs=%d, cqi=%d, ctrl_symbols=%d, n=%d, table=%d, search=%d\n",
+             what, nof_prb, max_mcs, cqi, c, n, tab, lin);
+    }
+    nof_errors++;
+  }
+}
+
+void test_cell(uint32_t nof_prb, int max_mcs)
+{
+  srsenb::sched_interface::cell_cfg_t cell_cfg;
+  bzero(&cell_cfg, sizeof(srsenb::sched_interface::cell_cfg_t));
+  cell_cfg.cell.id              = 1;
+  cell_cfg.cell.cp              = SRSLTE_CP_NORM;
+  cell_cfg.cell.nof_ports       = 1;
+  cell_cfg.cell.nof_prb         = nof_prb;
+  cell_cfg.cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell_cfg.cell.phich_resources = SRSLTE_PHICH_R_1;
+
+  srslte_regs_t regs;
+  srslte_regs_init(&regs, cell_cfg.cell);
+
+  srsenb::sched_tbs_table tbs_table;
+  tbs_table.init(&cell_cfg.cell, max_mcs, max_mcs);
+
+  srsenb::sched_ue ue_table, ue_search;
+  ue_table.set_cfg(0x46, NULL, &cell_cfg, &regs, &tbs_table, &log_out);
+  ue_search.set_cfg(0x46, NULL, &cell_cfg, &regs, NULL, &log_out);
+  ue_table.set_max_mcs(max_mcs, max_mcs);
+  ue_search.set_max_mcs(max_mcs, max_mcs);
+  ue_table.set_fixed_mcs(-1, -1);
+  ue_search.set_fixed_mcs(-1, -1);
+
+  uint32_t mcs_limit = max_mcs<0?28:max_mcs;
+  uint32_t P         = srslte_ra_type0_P(nof_prb);
+  uint32_t nof_rbg   = (nof_prb+P-1)/P;
+  uint32_t nof_re_ul = 2*(SRSLTE_CP_NSYMB(cell_cfg.cell.cp)-1)*SRSLTE_NRE;
+  int      mcs       = 0;
+
+  for (uint32_t cqi=0;cqi<NOF_CQI;cqi++) {
+    ue_table.set_dl_cqi(0, cqi);
+    ue_search.set_dl_cqi(0, cqi);
+    ue_table.set_ul_cqi(0, cqi, 0);
+    ue_search.set_ul_cqi(0, cqi, 0);
+
+    for (uint32_t c=1;c<=MAX_NOF_CTRL_SYMBOLS;c++) {
+      check(tbs_table.has_dl(cqi, c, mcs_limit), "has_dl", nof_prb, max_mcs, cqi, c, 0, 0, 1);
+
+      for (uint32_t n=1;n<=nof_prb;n++) {
+        int tbs = srsenb::sched_ue::alloc_tbs(cqi, n, srslte_ra_dl_approx_nof_re(cell_cfg.cell, n, c), 0, mcs_limit, &mcs);
+        int tab = tbs_table.get_tbs_dl(cqi, c, n);
+        check(tab == tbs, "DL TBS", nof_prb, max_mcs, cqi, c, n, tab, tbs);
+
+        // The minimum number of PRB only changes at the TBS of each number of PRB
+        for (int req=tbs;req<=tbs+1;req++) {
+          if (req > 0) {
+            int tab = ue_table.get_required_prb_dl(req, c);
+            int lin = ue_search.get_required_prb_dl(req, c);
+            check(tab == lin, "DL required PRB", nof_prb, max_mcs, cqi, c, req, tab, lin);
+          }
+        }
+      }
+      for (uint32_t r=1;r<=nof_rbg;r++) {
+        int tab = ue_table.get_dl_capacity(r, c);
+        int lin = ue_search.get_dl_capacity(r, c);
+        check(tab == lin, "DL capacity", nof_prb, max_mcs, cqi, c, r, tab, lin);
+      }
+    }
+
+    check(tbs_table.has_ul(cqi, mcs_limit), "has_ul", nof_prb, max_mcs, cqi, 0, 0, 0, 1);
+    for (uint32_t n=1;n<=nof_prb;n++) {
+      int tbs = srsenb::sched_ue::alloc_tbs(cqi, n, nof_re_ul*n, 0, mcs_limit, &mcs);
+      int tab = tbs_table.get_tbs_ul(cqi, n);
+      check(tab == tbs, "UL TBS", nof_prb, max_mcs, cqi, 0, n, tab, tbs);
+
+      // The UL search adds 4 bytes to the request
+      for (int req=tbs-4;req<=tbs-3;req++) {
+        if (req > 0) {
+          int tab = ue_table.get_required_prb_ul(req);
+          int lin = ue_search.get_required_prb_ul(req);
+          check(tab == lin, "UL required PRB", nof_prb, max_mcs, cqi, 0, req, tab, lin);
+        }
+      }
+      tab     = ue_table.get_ul_capacity(n);
+      int lin = ue_search.get_ul_capacity(n);
+      check(tab == lin, "UL capacity", nof_prb, max_mcs, cqi, 0, n, tab, lin);
+    }
+  }
+
+  // A different maximum MCS is not in the tables and falls back to the search
+  check(!tbs_table.has_dl(15, 1, mcs_limit==28?27:mcs_limit+1), "has_dl other MCS", nof_prb, max_mcs, 15, 1, 0, 1, 0);
+  check(!tbs_table.has_ul(15, mcs_limit==28?27:mcs_limit+1), "has_ul other MCS", nof_prb, max_mcs, 15, 0, 0, 1, 0);
+
+  srslte_regs_free(&regs);
+}
+
+int main(int argc, char **argv)
+{
+  log_out.set_level(srslte::LOG_LEVEL_NONE);
+
+  const uint32_t nof_prb[6] = {6, 15, 25, 50, 75, 100};
+  for (uint32_t i=0;i<6;i++) {
+    for (int max_mcs=-1;max_mcs<=28;max_mcs++) {
+      test_cell(nof_prb[i], max_mcs);
+    }
+  }
+
+  if (nof_errors) {
+    printf("%d mismatches\n", nof_errors);
+    exit(1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,200 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Checks the path of UL MAC PDUs from the UEs through the ul_pdu_queue: PDUs are
+ * delivered to the UE that received them, PDUs of a removed UE are not delivered
+ * to a new UE with the same RNTI, and every PDU returns to the pool, including the
+ * ones dropped on a full queue or left in the queue by clear().
+ */
+
+#include <stdio.h>
+#include <map>
+
+#include "mac/ue.h"
+#include "mac/scheduler.h"
+#include "srslte/common/log_stdout.h"
+
+#define NOF_PRB  6
+#define PDU_LEN  10
+#define LCID     3
+
+// Records the SDUs demultiplexed by the UEs
+class rlc_dummy : public srsenb::rlc_interface_mac
+{
+public:
+  rlc_dummy() {
+    reset();
+  }
+  void reset() {
+    nof_sdus = 0;
+    last_rnti = 0;
+    last_len = 0;
+  }
+  int  read_pdu(uint16_t rnti, uint32_t lcid, uint8_t *payload, uint32_t nof_bytes) {
+    return 0;
+  }
+  void read_pdu_bcch_dlsch(uint32_t sib_index, uint8_t *payload) {}
+  void read_pdu_pcch(uint8_t* payload, uint32_t buffer_size) {}
+  void write_pdu(uint16_t rnti, uint32_t lcid, uint8_t *payload, uint32_t nof_bytes) {
+    if (lcid == LCID) {
+      nof_sdus++;
+      last_rnti = rnti;
+      last_len  = nof_bytes;
+    }
+  }
+  uint32_t nof_sdus;
+  uint16_t last_rnti;
+  uint32_t last_len;
+};
+
+srslte::log_stdout        log_out("MAC");
+srsenb::sched             my_sched;
+rlc_dummy                 my_rlc;
+srslte::byte_buffer_pool *pool;
+
+std::map<uint16_t, srsenb::ue*> ue_db;
+uint32_t generation = 0;
+
+void add_ue(uint16_t rnti, srsenb::ul_pdu_queue *q)
+{
+  srsenb::sched_interface::ue_cfg_t uecfg;
+  bzero(&uecfg, sizeof(srsenb::sched_interface::ue_cfg_t));
+  my_sched.ue_cfg(rnti, &uecfg);
+
+  ue_db[rnti] = new srsenb::ue;
+  ue_db[rnti]->config(rnti, NOF_PRB, &my_sched, NULL, &my_rlc, &log_out, q, ++generation);
+}
+
+void rem_ue(uint16_t rnti)
+{
+  my_sched.ue_rem(rnti);
+  delete ue_db[rnti];
+  ue_db.erase(rnti);
+}
+
+// Receives a PDU with a single SDU in the buffer of the HARQ process of tti. Returns the buffer
+uint8_t* receive_pdu(uint16_t rnti, uint32_t tti)
+{
+  uint8_t *pdu = ue_db[rnti]->request_buffer(tti, PDU_LEN);
+  if (pdu) {
+    // Last subheader, no length field
+    pdu[0] = LCID;
+    for (uint32_t i=1;i<PDU_LEN;i++) {
+      pdu[i] = i;
+    }
+    ue_db[rnti]->push_pdu(tti, PDU_LEN);
+  }
+  return pdu;
+}
+
+// The per-thread cache of the pool is LIFO, so the last buffer returned is the next one allocated
+bool returned_to_pool(uint8_t *pdu)
+{
+  srslte::byte_buffer_t *b = pool->allocate_bytes(PDU_LEN);
+  bool ret = b && b->msg == pdu;
+  if (b) {
+    pool->deallocate(b);
+  }
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  bool ok = true;
+
+  log_out.set_level(srslte::LOG_LEVEL_ERROR);
+  my_sched.init(NULL, &log_out);
+  pool = srslte::byte_buffer_pool::get_instance();
+
+  srsenb::ul_pdu_queue q(4);
+
+  // PDUs are delivered to the UE that received them
+  add_ue(0x46, &q);
+  add_ue(0x47, &q);
+  receive_pdu(0x46, 0);
+  uint8_t *pdu = receive_pdu(0x47, 1);
+  if (q.process(ue_db, &log_out) != 2 || my_rlc.nof_sdus != 2 || my_rlc.last_rnti != 0x47 || my_rlc.last_len != PDU_LEN-1) {
+    printf("Delivered %d SDUs, last rnti=0x%x len=%d\n", my_rlc.nof_sdus, my_rlc.last_rnti, my_rlc.last_len);
+    ok = false;
+  }
+  if (!returned_to_pool(pdu)) {
+    printf("Processed PDU not returned to the pool\n");
+    ok = false;
+  }
+
+  // A PDU of a removed UE is not delivered to a new UE with the same RNTI
+  my_rlc.reset();
+  pdu = receive_pdu(0x46, 2);
+  rem_ue(0x46);
+  add_ue(0x46, &q);
+  if (q.process(ue_db, &log_out) != 1 || my_rlc.nof_sdus != 0) {
+    printf("PDU of a removed UE delivered to the new UE with its RNTI\n");
+    ok = false;
+  }
+  if (!returned_to_pool(pdu)) {
+    printf("Dropped PDU not returned to the pool\n");
+    ok = false;
+  }
+
+  // A PDU that does not fit in the queue is dropped
+  my_rlc.reset();
+  for (uint32_t i=0;i<4;i++) {
+    receive_pdu(0x47, i);
+  }
+  pdu = receive_pdu(0x47, 4);
+  if (!returned_to_pool(pdu)) {
+    printf("PDU dropped on a full queue not returned to the pool\n");
+    ok = false;
+  }
+  if (q.process(ue_db, &log_out) != 4 || my_rlc.nof_sdus != 4) {
+    printf("Delivered %d SDUs of 4 queued\n", my_rlc.nof_sdus);
+    ok = false;
+  }
+
+  // Queued PDUs are returned to the pool by clear(), as when the MAC stops
+  my_rlc.reset();
+  pdu = receive_pdu(0x47, 5);
+  q.clear();
+  if (q.process(ue_db, &log_out) != 0 || my_rlc.nof_sdus != 0) {
+    printf("PDU delivered after clear()\n");
+    ok = false;
+  }
+  if (!returned_to_pool(pdu)) {
+    printf("Cleared PDU not returned to the pool\n");
+    ok = false;
+  }
+
+  rem_ue(0x46);
+  rem_ue(0x47);
+
+  if (ok) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    exit(1);
+  }
+}
@@ -0,0 +1,189 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* GTP-U loopback benchmark. The GTP-U entity is bound to and sends to the loopback
+ * address, with the outgoing TEID of every bearer equal to its incoming TEID, so
+ * each UL PDU written by "PDCP" is received back as a DL PDU for the same bearer.
+ * Reports the number of packets per second and per second of CPU time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include "upper/gtpu.h"
+#include "srslte/common/log_stdout.h"
+
+uint32_t nof_packets = 200000;
+uint32_t packet_len  = 1400;
+uint32_t window      = 256;
+uint32_t nof_users   = 16;
+
+void usage(char *prog) {
+  printf("Usage: %s [nswu]\n", prog);
+  printf("\t-n number of packets [Default %d]\n", nof_packets);
+  printf("\t-s packet length in bytes [Default %d]\n", packet_len);
+  printf("\t-w max packets in flight [Default %d]\n", window);
+  printf("\t-u number of users [Default %d]\n", nof_users);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nswu")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_packets = atoi(argv[optind]);
+      break;
+    case 's':
+      packet_len = atoi(argv[optind]);
+      break;
+    case 'w':
+      window = atoi(argv[optind]);
+      break;
+    case 'u':
+      nof_users = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+class pdcp_dummy : public srsenb::pdcp_interface_gtpu
+{
+public:
+  pdcp_dummy() {
+    nof_rx = 0;
+    pool   = srslte::byte_buffer_pool::get_instance();
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&cvar, NULL);
+  }
+  void write_sdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *sdu) {
+    pool->deallocate(sdu);
+    pthread_mutex_lock(&mutex);
+    nof_rx++;
+    pthread_cond_signal(&cvar);
+    pthread_mutex_unlock(&mutex);
+  }
+  // Waits until at least nof_packets have been received or the timeout expires
+  bool wait_rx(uint32_t nof_packets, uint32_t timeout_ms) {
+    struct timeval  now;
+    struct timespec deadline;
+    gettimeofday(&now, NULL);
+    uint64_t usec = now.tv_usec + 1000*timeout_ms;
+    deadline.tv_sec  = now.tv_sec + usec/1000000;
+    deadline.tv_nsec = 1000*(usec%1000000);
+    pthread_mutex_lock(&mutex);
+    int ret = 0;
+    while (nof_rx < nof_packets && ret == 0) {
+      ret = pthread_cond_timedwait(&cvar, &mutex, &deadline);
+    }
+    bool ok = nof_rx >= nof_packets;
+    pthread_mutex_unlock(&mutex);
+    return ok;
+  }
+  uint32_t get_nof_rx() {
+    pthread_mutex_lock(&mutex);
+    uint32_t n = nof_rx;
+    pthread_mutex_unlock(&mutex);
+    return n;
+  }
+private:
+  srslte::byte_buffer_pool *pool;
+  uint32_t        nof_rx;
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar;
+};
+
+double cpu_secs() {
+  struct rusage r;
+  getrusage(RUSAGE_SELF, &r);
+  return r.ru_utime.tv_sec + r.ru_stime.tv_sec + 1e-6*(r.ru_utime.tv_usec + r.ru_stime.tv_usec);
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  srslte::log_stdout        log("GTPU");
+  srslte::byte_buffer_pool *pool = srslte::byte_buffer_pool::get_instance();
+  pdcp_dummy                pdcp;
+  srsenb::gtpu              gtpu;
+
+  log.set_level(srslte::LOG_LEVEL_ERROR);
+  if (!gtpu.init("127.0.0.1", "127.0.0.1", &pdcp, &log)) {
+    fprintf(stderr, "Error initiating GTPU\n");
+    exit(-1);
+  }
+
+  // Outgoing TEID equal to the incoming TEID loops every UL PDU back to the same bearer
+  for (uint32_t i=0;i<nof_users;i++) {
+    uint16_t rnti = 0x46 + i;
+    uint32_t teid_in;
+    gtpu.add_bearer(rnti, SRSENB_N_SRB, (rnti<<16) | SRSENB_N_SRB, &teid_in);
+  }
+
+  struct timeval t[2];
+  double cpu = cpu_secs();
+  gettimeofday(&t[0], NULL);
+  uint32_t nof_tx = 0;
+  while (nof_tx < nof_packets) {
+    if (nof_tx >= window && !pdcp.wait_rx(nof_tx - window + 1, 1000)) {
+      // Packets lost in the socket buffers are not coming back
+      break;
+    }
+    srslte::byte_buffer_t *pdu = pool_allocate;
+    if (!pdu) {
+      usleep(100);
+      continue;
+    }
+    memset(pdu->msg, nof_tx&0xff, packet_len);
+    pdu->N_bytes = packet_len;
+    gtpu.write_pdu(0x46 + nof_tx%nof_users, SRSENB_N_SRB, pdu);
+    nof_tx++;
+  }
+  pdcp.wait_rx(nof_tx, 1000);
+  gettimeofday(&t[1], NULL);
+  cpu = cpu_secs() - cpu;
+
+  uint32_t nof_rx = pdcp.get_nof_rx();
+  double   secs   = (t[1].tv_sec - t[0].tv_sec) + 1e-6*(t[1].tv_usec - t[0].tv_usec);
+  printf("Sent %d, received %d packets of %d bytes in %.2f s (%.2f s CPU)\n", nof_tx, nof_rx, packet_len, secs, cpu);
+  printf("%.1f kpackets/s, %.1f kpackets/s per core, %.1f Mbps\n",
+         secs>0?1e-3*nof_rx/secs:0, cpu>0?1e-3*nof_rx/cpu:0, secs>0?8e-6*nof_rx*packet_len/secs:0);
+
+  gtpu.stop();
+  srslte::byte_buffer_pool::cleanup();
+
+  if (nof_rx < nof_tx) {
+    printf("Error %d packets were lost\n", nof_tx - nof_rx);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
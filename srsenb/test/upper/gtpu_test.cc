@@ -0,0 +1,255 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* GTP-U functional test over the loopback address:
+ *  - TEID table add, find and removal, across resizes and deleted slots
+ *  - a burst of DL datagrams longer than one recvmmsg() batch reaches PDCP in order
+ *  - datagrams for unknown or removed TEIDs, truncated and too short datagrams are dropped
+ *  - UL PDUs sent with sendmmsg() come back for the bearer whose outgoing TEID they carry
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "upper/gtpu.h"
+#include "srslte/common/log_stdout.h"
+
+#define GTPU_PORT    2152
+#define BURST_LEN    (3*32+5)
+#define PAYLOAD_LEN  100
+#define TRUNC_LEN    20000
+#define TIMEOUT_MS   1000
+
+uint32_t nof_errors = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf(__VA_ARGS__); nof_errors++; }
+
+class pdcp_dummy : public srsenb::pdcp_interface_gtpu
+{
+public:
+  typedef struct {
+    uint16_t rnti;
+    uint32_t lcid;
+    uint32_t len;
+    uint32_t seq;
+  } rx_sdu_t;
+
+  pdcp_dummy() {
+    pool = srslte::byte_buffer_pool::get_instance();
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&cvar, NULL);
+  }
+  void write_sdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *sdu) {
+    rx_sdu_t s;
+    s.rnti = rnti;
+    s.lcid = lcid;
+    s.len  = sdu->N_bytes;
+    s.seq  = sdu->N_bytes >= 4?(sdu->msg[0]<<24 | sdu->msg[1]<<16 | sdu->msg[2]<<8 | sdu->msg[3]):0;
+    pool->deallocate(sdu);
+    pthread_mutex_lock(&mutex);
+    rx.push_back(s);
+    pthread_cond_signal(&cvar);
+    pthread_mutex_unlock(&mutex);
+  }
+  // Waits until at least nof_sdus have been received or the timeout expires
+  bool wait_rx(uint32_t nof_sdus) {
+    struct timeval  now;
+    struct timespec deadline;
+    gettimeofday(&now, NULL);
+    uint64_t usec = now.tv_usec + 1000*TIMEOUT_MS;
+    deadline.tv_sec  = now.tv_sec + usec/1000000;
+    deadline.tv_nsec = 1000*(usec%1000000);
+    pthread_mutex_lock(&mutex);
+    int ret = 0;
+    while (rx.size() < nof_sdus && ret == 0) {
+      ret = pthread_cond_timedwait(&cvar, &mutex, &deadline);
+    }
+    bool ok = rx.size() >= nof_sdus;
+    pthread_mutex_unlock(&mutex);
+    return ok;
+  }
+  std::vector<rx_sdu_t> take() {
+    pthread_mutex_lock(&mutex);
+    std::vector<rx_sdu_t> r;
+    r.swap(rx);
+    pthread_mutex_unlock(&mutex);
+    return r;
+  }
+private:
+  srslte::byte_buffer_pool *pool;
+  std::vector<rx_sdu_t>     rx;
+  pthread_mutex_t           mutex;
+  pthread_cond_t            cvar;
+};
+
+void test_teid_table()
+{
+  // Start small so that the table is resized several times
+  srsenb::gtpu_teid_table table(2);
+  const uint32_t N = 1000;
+
+  for (uint32_t i=0;i<N;i++) {
+    CHECK(table.add(i*7919, i, 0x46+i, 3), "TEID table: add of 0x%x failed\n", i*7919);
+  }
+  CHECK(!table.add(7919, 0, 0, 0), "TEID table: duplicated TEID added\n");
+  CHECK(table.size() == N, "TEID table: size %d, expected %d\n", table.size(), N);
+
+  // Remove the odd entries. The even ones must still be found through the deleted slots
+  for (uint32_t i=1;i<N;i+=2) {
+    CHECK(table.rem(i*7919), "TEID table: removal of 0x%x failed\n", i*7919);
+  }
+  CHECK(!table.rem(7919), "TEID table: removed TEID removed twice\n");
+  for (uint32_t i=0;i<N;i++) {
+    srsenb::gtpu_teid_table::entry_t *e = table.find(i*7919);
+    if (i%2) {
+      CHECK(!e, "TEID table: removed TEID 0x%x found\n", i*7919);
+    } else {
+      CHECK(e && e->teid_out == i && e->rnti == 0x46+i && e->lcid == 3, "TEID table: TEID 0x%x not found\n", i*7919);
+    }
+  }
+  CHECK(table.size() == N/2, "TEID table: size %d, expected %d\n", table.size(), N/2);
+
+  // Many add/remove cycles reuse the deleted slots without filling the table
+  for (uint32_t i=0;i<100*N;i++) {
+    uint32_t teid = 0x80000000 | i;
+    CHECK(table.add(teid, 0, 0, 0) && table.find(teid) && table.rem(teid), "TEID table: cycle %d failed\n", i);
+  }
+  CHECK(table.size() == N/2 && !table.find(0x80000000), "TEID table: size %d after cycles\n", table.size());
+}
+
+// Sends a GTP-U T-PDU with the given TEID and sequence number, padded to len bytes
+void send_datagram(int fd, struct sockaddr_in *addr, uint32_t teid, uint32_t seq, uint32_t len)
+{
+  std::vector<uint8_t> buf(len>GTPU_HEADER_LEN+4?len:GTPU_HEADER_LEN+4);
+  buf[0] = 0x30;
+  buf[1] = 0xFF;
+  srsenb::uint16_to_uint8(len-GTPU_HEADER_LEN, &buf[2]);
+  srsenb::uint32_to_uint8(teid, &buf[4]);
+  srsenb::uint32_to_uint8(seq, &buf[GTPU_HEADER_LEN]);
+  if (sendto(fd, &buf[0], len, 0, (struct sockaddr*) addr, sizeof(struct sockaddr_in)) != (int) len) {
+    perror("sendto");
+    nof_errors++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  srslte::log_stdout        log("GTPU");
+  srslte::byte_buffer_pool *pool = srslte::byte_buffer_pool::get_instance();
+  pdcp_dummy                pdcp;
+  srsenb::gtpu              gtpu;
+
+  test_teid_table();
+
+  log.set_level(srslte::LOG_LEVEL_NONE);
+  if (!gtpu.init("127.0.0.1", "127.0.0.1", &pdcp, &log)) {
+    fprintf(stderr, "Error initiating GTPU\n");
+    exit(-1);
+  }
+
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in addr;
+  bzero(&addr, sizeof(addr));
+  addr.sin_family      = AF_INET;
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  addr.sin_port        = htons(GTPU_PORT);
+
+  uint16_t rnti[2] = {0x46, 0x47};
+  uint32_t lcid    = SRSENB_N_SRB;
+  uint32_t teid_in[2];
+  gtpu.add_bearer(rnti[0], lcid, 0x1000, &teid_in[0]);
+  gtpu.add_bearer(rnti[1], lcid, 0x1001, &teid_in[1]);
+
+  // A burst longer than one recvmmsg() batch, alternating the two bearers
+  for (uint32_t i=0;i<BURST_LEN;i++) {
+    send_datagram(fd, &addr, teid_in[i%2], i, GTPU_HEADER_LEN+PAYLOAD_LEN);
+  }
+  CHECK(pdcp.wait_rx(BURST_LEN), "Burst: only some of the %d datagrams received\n", BURST_LEN);
+  std::vector<pdcp_dummy::rx_sdu_t> rx = pdcp.take();
+  for (uint32_t i=0;i<rx.size() && i<BURST_LEN;i++) {
+    CHECK(rx[i].seq == i && rx[i].rnti == rnti[i%2] && rx[i].lcid == lcid && rx[i].len == PAYLOAD_LEN,
+          "Burst: SDU %d is seq=%d, rnti=0x%x, lcid=%d, len=%d\n", i, rx[i].seq, rx[i].rnti, rx[i].lcid, rx[i].len);
+  }
+
+  // Datagrams to drop, each followed by a valid one that must be the only one received
+  gtpu.rem_bearer(rnti[1], lcid);
+  uint32_t seq = BURST_LEN;
+  const char *what[4] = {"unknown TEID", "removed TEID", "truncated", "too short"};
+  for (uint32_t k=0;k<4;k++) {
+    switch (k) {
+    case 0:
+      send_datagram(fd, &addr, 0x12345678, seq, GTPU_HEADER_LEN+PAYLOAD_LEN);
+      break;
+    case 1:
+      send_datagram(fd, &addr, teid_in[1], seq, GTPU_HEADER_LEN+PAYLOAD_LEN);
+      break;
+    case 2:
+      send_datagram(fd, &addr, teid_in[0], seq, TRUNC_LEN);
+      break;
+    case 3:
+      send_datagram(fd, &addr, teid_in[0], seq, GTPU_HEADER_LEN-1);
+      break;
+    }
+    send_datagram(fd, &addr, teid_in[0], seq+1, GTPU_HEADER_LEN+PAYLOAD_LEN);
+    pdcp.wait_rx(1);
+    usleep(10000);
+    rx = pdcp.take();
+    CHECK(rx.size() == 1 && rx[0].seq == seq+1, "Datagram with %s not dropped: %d SDUs received\n", what[k], (int) rx.size());
+    seq += 2;
+  }
+
+  // UL PDUs looped back through sendmmsg(): the outgoing TEID equals the incoming one
+  gtpu.rem_user(rnti[0]);
+  gtpu.add_bearer(rnti[0], lcid, (rnti[0]<<16) | lcid, &teid_in[0]);
+  for (uint32_t i=0;i<BURST_LEN;i++) {
+    srslte::byte_buffer_t *pdu = pool_allocate;
+    srsenb::uint32_to_uint8(i, pdu->msg);
+    pdu->N_bytes = PAYLOAD_LEN;
+    gtpu.write_pdu(rnti[0], lcid, pdu);
+  }
+  CHECK(pdcp.wait_rx(BURST_LEN), "UL: only some of the %d PDUs looped back\n", BURST_LEN);
+  rx = pdcp.take();
+  for (uint32_t i=0;i<rx.size() && i<BURST_LEN;i++) {
+    CHECK(rx[i].seq == i && rx[i].rnti == rnti[0] && rx[i].len == PAYLOAD_LEN,
+          "UL: SDU %d is seq=%d, rnti=0x%x, len=%d\n", i, rx[i].seq, rx[i].rnti, rx[i].len);
+  }
+
+  close(fd);
+  gtpu.stop();
+  srslte::byte_buffer_pool::cleanup();
+
+  if (nof_errors) {
+    printf("%d errors\n", nof_errors);
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
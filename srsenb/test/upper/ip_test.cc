@@ -471,8 +471,7 @@ void generate_cell_configuration(srsenb::sched_interface::cell_cfg_t *mac_cfg, s
   LIBLTE_BIT_MSG_STRUCT bitbuffer[2];
   for (int i=0;i<2;i++) {
     liblte_rrc_pack_bcch_dlsch_msg(&msg[i], &bitbuffer[i]);
-    srslte_bit_pack_vector(bitbuffer[i].msg, sib_buffer[i].msg, bitbuffer[i].N_bits);
-    sib_buffer[i].N_bytes = (bitbuffer[i].N_bits-1)/8+1;
+    sib_buffer[i].N_bytes = liblte_pack(&bitbuffer[i], sib_buffer[i].msg);
   }
 
   // Fill MAC scheduler configuration 
@@ -561,6 +560,10 @@ int main(int argc, char *argv[])
   phy_args.max_prach_offset_us = 50; 
   phy_args.nof_phy_threads = 1; 
   phy_args.pusch_max_its   = 5; 
+  phy_args.pusch_sf_max_its = 0; 
+  phy_args.pusch_cb_threads = 1; 
+  phy_args.pipeline        = false; 
+  phy_args.nof_grant_threads = 0; 
   
   generate_cell_configuration(&mac_cfg, &phy_cfg);
   
@@ -18,31 +18,32 @@ void rrc_plmn_test()
   plmn_in.mnc = 0xFF45;
 
   // 2-digit MNC test
-  uint8_t bit_buf[32];
-  uint8_t *ie_ptr = bit_buf;
+  uint8_t byte_buf[4];
+  memset(byte_buf, 0, sizeof(byte_buf));
+  LIBLTE_BIT_PTR ie_ptr = byte_buf;
 
   liblte_rrc_pack_plmn_identity_ie(&plmn_in, &ie_ptr);
-  uint8_t byte_buf[4];
-  liblte_pack(bit_buf, 22, byte_buf);
-  uint8_t ref[3] = {0x89, 0x19, 0x05};
+  assert(ie_ptr - byte_buf == 22);
+  uint8_t ref[3] = {0x89, 0x19, 0x14}; // 22 bits, MSB first
   for(int i=0;i<3;i++) {
     assert(ref[i] == byte_buf[i]);
   }
-  ie_ptr = bit_buf;
+  ie_ptr = byte_buf;
   liblte_rrc_unpack_plmn_identity_ie(&ie_ptr, &plmn_out);
   assert(plmn_in.mcc == plmn_out.mcc);
   assert(plmn_in.mnc == plmn_out.mnc);
 
   // 3-digit MNC test
   plmn_in.mnc = 0xF456;
-  ie_ptr = bit_buf;
+  memset(byte_buf, 0, sizeof(byte_buf));
+  ie_ptr = byte_buf;
   liblte_rrc_pack_plmn_identity_ie(&plmn_in, &ie_ptr);
-  liblte_pack(bit_buf, 26, byte_buf);
+  assert(ie_ptr - byte_buf == 26);
   uint8_t ref2[4] = {0x89, 0x1D, 0x15, 0x02};
   for(int i=0;i<3;i++) {
     assert(ref2[i] == byte_buf[i]);
   }
-  ie_ptr = bit_buf;
+  ie_ptr = byte_buf;
   liblte_rrc_unpack_plmn_identity_ie(&ie_ptr, &plmn_out);
   assert(plmn_in.mcc == plmn_out.mcc);
   assert(plmn_in.mnc == plmn_out.mnc);
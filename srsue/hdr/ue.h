@@ -103,6 +103,7 @@ typedef struct {
   int           usim_hex_limit;
   int           all_hex_limit;
   std::string   filename;
+  bool          deferred;
 }log_args_t;
 
 typedef struct {
@@ -114,6 +115,7 @@ typedef struct {
   float      metrics_period_secs;
   bool pregenerate_signals;
   int ue_cateogry;
+  uint32_t nof_tun_queues;
   
 }expert_args_t;
 
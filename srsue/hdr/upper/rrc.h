@@ -99,7 +99,7 @@ private:
   nas_interface_rrc    *nas;
   usim_interface_rrc   *usim;
 
-  srslte::bit_buffer_t  bit_buf;
+  LIBLTE_BIT_MSG_STRUCT bit_buf;
 
   pthread_mutex_t       mutex;
   
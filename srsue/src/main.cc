@@ -102,6 +102,7 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         ("log.all_hex_limit", bpo::value<int>(&args->log.all_hex_limit)->default_value(32),  "ALL log hex dump limit")
 
         ("log.filename",      bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"),"Log filename")
+        ("log.deferred",      bpo::value<bool>(&args->log.deferred)->default_value(false),"Format log messages in the logging thread")
 
         ("usim.algo",         bpo::value<string>(&args->usim.algo),        "USIM authentication algorithm")
         ("usim.op",           bpo::value<string>(&args->usim.op),          "USIM operator variant")
@@ -131,6 +132,10 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         ("expert.pregenerate_signals",
             bpo::value<bool>(&args->expert.pregenerate_signals)->default_value(false), 
             "Pregenerate uplink signals after attach. Improves CPU performance.")
+
+        ("expert.nof_tun_queues",
+            bpo::value<uint32_t>(&args->expert.nof_tun_queues)->default_value(1), 
+            "Number of TUN device queues, each read by its own thread (1 to 8)")
         
         ("expert.rssi_sensor_enabled", 
             bpo::value<bool>(&args->expert.phy.rssi_sensor_enabled)->default_value(true),  
@@ -308,6 +313,11 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         args->log.usim_hex_limit = args->log.all_hex_limit;
       }
     }
+
+    if (args->expert.nof_tun_queues < 1 || args->expert.nof_tun_queues > srslte::gw::GW_MAX_TUN_QUEUES) {
+      cout << "Error: expert.nof_tun_queues must be between 1 and " << srslte::gw::GW_MAX_TUN_QUEUES << endl;
+      exit(1);
+    }
 }
 
 static bool running    = true;
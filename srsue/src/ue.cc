@@ -75,7 +75,7 @@ bool ue::init(all_args_t *args_)
 {
   args     = args_;
   
-  logger.init(args->log.filename);
+  logger.init(args->log.filename, args->log.deferred);
   rf_log.init("RF  ", &logger);
   phy_log.init("PHY ", &logger, true);
   mac_log.init("MAC ", &logger, true);
@@ -191,7 +191,7 @@ bool ue::init(all_args_t *args_)
   rrc.set_ue_category(args->expert.ue_cateogry);
   
   nas.init(&usim, &rrc, &gw, &nas_log);
-  gw.init(&pdcp, &rrc, this, &gw_log);
+  gw.init(&pdcp, &rrc, this, &gw_log, args->expert.nof_tun_queues);
   usim.init(&args->usim, &usim_log);
 
   started = true;
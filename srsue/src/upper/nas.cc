@@ -31,6 +31,20 @@ using namespace srslte;
 
 namespace srsue{
 
+// The liblte NAS codec works on LIBLTE_BYTE_MSG_STRUCT, which does not share the
+// layout of the pooled byte_buffer_t
+static void pdu_to_msg(byte_buffer_t *pdu, LIBLTE_BYTE_MSG_STRUCT *msg)
+{
+  memcpy(msg->msg, pdu->msg, pdu->N_bytes);
+  msg->N_bytes = pdu->N_bytes;
+}
+
+static void msg_to_pdu(LIBLTE_BYTE_MSG_STRUCT *msg, byte_buffer_t *pdu)
+{
+  memcpy(pdu->msg, msg->msg, msg->N_bytes);
+  pdu->N_bytes = msg->N_bytes;
+}
+
 nas::nas()
   :state(EMM_STATE_DEREGISTERED)
   ,is_guti_set(false)
@@ -88,7 +102,9 @@ void nas::write_pdu(uint32_t lcid, byte_buffer_t *pdu)
   nas_log->info_hex(pdu->msg, pdu->N_bytes, "DL %s PDU", rb_id_text[lcid]);
 
   // Parse the message
-  liblte_mme_parse_msg_header((LIBLTE_BYTE_MSG_STRUCT*)pdu, &pd, &msg_type);
+  LIBLTE_BYTE_MSG_STRUCT nas_msg;
+  pdu_to_msg(pdu, &nas_msg);
+  liblte_mme_parse_msg_header(&nas_msg, &pd, &msg_type);
   switch(msg_type)
   {
   case LIBLTE_MME_MSG_TYPE_ATTACH_ACCEPT:
@@ -211,7 +227,9 @@ void nas::parse_attach_accept(uint32_t lcid, byte_buffer_t *pdu)
   nas_log->info("Received Attach Accept\n");
   count_dl++;
 
-  liblte_mme_unpack_attach_accept_msg((LIBLTE_BYTE_MSG_STRUCT*)pdu, &attach_accept);
+  LIBLTE_BYTE_MSG_STRUCT nas_msg;
+  pdu_to_msg(pdu, &nas_msg);
+  liblte_mme_unpack_attach_accept_msg(&nas_msg, &attach_accept);
 
   if(attach_accept.eps_attach_result == LIBLTE_MME_EPS_ATTACH_RESULT_EPS_ONLY)
   {
@@ -311,7 +329,9 @@ void nas::parse_attach_accept(uint32_t lcid, byte_buffer_t *pdu)
     liblte_mme_pack_attach_complete_msg(&attach_complete,
                                         LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
                                         count_ul,
-                                        (LIBLTE_BYTE_MSG_STRUCT*)pdu);
+                                        &nas_msg);
+    pdu = pool_reallocate(pdu, nas_msg.N_bytes);
+    msg_to_pdu(&nas_msg, pdu);
     integrity_generate(&k_nas_int[16],
                        count_ul,
                        lcid-1,
@@ -339,7 +359,9 @@ void nas::parse_attach_reject(uint32_t lcid, byte_buffer_t *pdu)
 {
   LIBLTE_MME_ATTACH_REJECT_MSG_STRUCT attach_rej;
 
-  liblte_mme_unpack_attach_reject_msg((LIBLTE_BYTE_MSG_STRUCT*)pdu, &attach_rej);
+  LIBLTE_BYTE_MSG_STRUCT nas_msg;
+  pdu_to_msg(pdu, &nas_msg);
+  liblte_mme_unpack_attach_reject_msg(&nas_msg, &attach_rej);
   nas_log->warning("Received Attach Reject. Cause= %02X\n", attach_rej.emm_cause);
   nas_log->console("Received Attach Reject. Cause= %02X\n", attach_rej.emm_cause);
   state = EMM_STATE_DEREGISTERED;
@@ -353,10 +375,9 @@ void nas::parse_authentication_request(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_MME_AUTHENTICATION_RESPONSE_MSG_STRUCT auth_res;
 
   nas_log->info("Received Authentication Request\n");;
-  liblte_mme_unpack_authentication_request_msg((LIBLTE_BYTE_MSG_STRUCT*)pdu, &auth_req);
-
-  // Reuse the pdu for the response message
-  pdu->reset();
+  LIBLTE_BYTE_MSG_STRUCT nas_msg;
+  pdu_to_msg(pdu, &nas_msg);
+  liblte_mme_unpack_authentication_request_msg(&nas_msg, &auth_req);
 
   // Generate authentication response using RAND, AUTN & KSI-ASME
   uint16 mcc, mnc;
@@ -376,7 +397,11 @@ void nas::parse_authentication_request(uint32_t lcid, byte_buffer_t *pdu)
     {
       auth_res.res[i] = res[i];
     }
-    liblte_mme_pack_authentication_response_msg(&auth_res, (LIBLTE_BYTE_MSG_STRUCT*)pdu);
+    liblte_mme_pack_authentication_response_msg(&auth_res, &nas_msg);
+
+    // Reuse the pdu for the response message if it has room
+    pdu = pool_reallocate(pdu, nas_msg.N_bytes);
+    msg_to_pdu(&nas_msg, pdu);
 
     nas_log->info("Sending Authentication Response\n");
     rrc->write_sdu(lcid, pdu);
@@ -410,7 +435,9 @@ void nas::parse_security_mode_command(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_MME_SECURITY_MODE_REJECT_MSG_STRUCT    sec_mode_rej;
 
   nas_log->info("Received Security Mode Command\n");
-  liblte_mme_unpack_security_mode_command_msg((LIBLTE_BYTE_MSG_STRUCT*)pdu, &sec_mode_cmd);
+  LIBLTE_BYTE_MSG_STRUCT nas_msg;
+  pdu_to_msg(pdu, &nas_msg);
+  liblte_mme_unpack_security_mode_command_msg(&nas_msg, &sec_mode_cmd);
 
   ksi = sec_mode_cmd.nas_ksi.nas_ksi;
   cipher_algo = (CIPHERING_ALGORITHM_ID_ENUM)sec_mode_cmd.selected_nas_sec_algs.type_of_eea;
@@ -478,12 +505,13 @@ void nas::parse_security_mode_command(uint32_t lcid, byte_buffer_t *pdu)
           sec_mode_comp.imeisv_present = false;
       }
 
-      // Reuse pdu for response
-      pdu->reset();
       liblte_mme_pack_security_mode_complete_msg(&sec_mode_comp,
                                                  LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
                                                  count_ul,
-                                                 (LIBLTE_BYTE_MSG_STRUCT*)pdu);
+                                                 &nas_msg);
+      // Reuse pdu for response
+      pdu = pool_reallocate(pdu, nas_msg.N_bytes);
+      msg_to_pdu(&nas_msg, pdu);
       integrity_generate(&k_nas_int[16],
                          count_ul,
                          lcid-1,
@@ -499,9 +527,10 @@ void nas::parse_security_mode_command(uint32_t lcid, byte_buffer_t *pdu)
   }
 
   if(!success) {
+    liblte_mme_pack_security_mode_reject_msg(&sec_mode_rej, &nas_msg);
     // Reuse pdu for response
-    pdu->reset();
-    liblte_mme_pack_security_mode_reject_msg(&sec_mode_rej, (LIBLTE_BYTE_MSG_STRUCT*)pdu);
+    pdu = pool_reallocate(pdu, nas_msg.N_bytes);
+    msg_to_pdu(&nas_msg, pdu);
   }
 
   rrc->write_sdu(lcid, pdu);
@@ -527,7 +556,6 @@ void nas::parse_emm_information(uint32_t lcid, byte_buffer_t *pdu)
 void nas::send_attach_request()
 {
   LIBLTE_MME_ATTACH_REQUEST_MSG_STRUCT  attach_req;
-  byte_buffer_t                  *msg = pool_allocate;
   u_int32_t                             i;
 
   attach_req.eps_attach_type = LIBLTE_MME_EPS_ATTACH_TYPE_EPS_ATTACH;
@@ -569,7 +597,10 @@ void nas::send_attach_request()
   attach_req.old_guti_type_present = false;
 
   // Pack the message
-  liblte_mme_pack_attach_request_msg(&attach_req, (LIBLTE_BYTE_MSG_STRUCT*)msg);
+  LIBLTE_BYTE_MSG_STRUCT nas_msg;
+  liblte_mme_pack_attach_request_msg(&attach_req, &nas_msg);
+  byte_buffer_t *msg = pool_allocate_bytes(nas_msg.N_bytes);
+  msg_to_pdu(&nas_msg, msg);
 
   nas_log->info("Sending attach request\n");
   rrc->write_sdu(RB_ID_SRB1, msg);
@@ -601,7 +632,7 @@ void nas::send_identity_response(){}
 
 void nas::send_service_request()
 {
-  byte_buffer_t *msg = pool_allocate;
+  byte_buffer_t *msg = pool_allocate_bytes(4);
   count_ul++;
 
   // Pack the service request message directly
@@ -251,10 +251,9 @@ void rrc::write_pdu_bcch_bch(byte_buffer_t *pdu)
   // Unpack the MIB
   rrc_log->info_hex(pdu->msg, pdu->N_bytes, "BCCH BCH message received.");
   rrc_log->info("BCCH BCH message Stack latency: %ld us\n", pdu->get_latency_us());
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-  bit_buf.N_bits = pdu->N_bytes*8;
+  liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
   pool->deallocate(pdu);
-  liblte_rrc_unpack_bcch_bch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &mib);
+  liblte_rrc_unpack_bcch_bch_msg(&bit_buf, &mib);
   rrc_log->info("MIB received BW=%s MHz\n", liblte_rrc_dl_bandwidth_text[mib.dl_bw]);
   rrc_log->console("MIB received BW=%s MHz\n", liblte_rrc_dl_bandwidth_text[mib.dl_bw]);
 
@@ -268,10 +267,9 @@ void rrc::write_pdu_bcch_dlsch(byte_buffer_t *pdu)
   rrc_log->info_hex(pdu->msg, pdu->N_bytes, "BCCH DLSCH message received.");
   rrc_log->info("BCCH DLSCH message Stack latency: %ld us\n", pdu->get_latency_us());
   LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT dlsch_msg;
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-  bit_buf.N_bits = pdu->N_bytes*8;
+  liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
   pool->deallocate(pdu);
-  liblte_rrc_unpack_bcch_dlsch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &dlsch_msg);
+  liblte_rrc_unpack_bcch_dlsch_msg(&bit_buf, &dlsch_msg);
 
   if (dlsch_msg.N_sibs > 0) {
     if (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1 == dlsch_msg.sibs[0].sib_type && RRC_STATE_SIB1_SEARCH == state) {
@@ -324,10 +322,9 @@ void rrc::write_pdu_pcch(byte_buffer_t *pdu)
     rrc_log->console("PCCH message received %d bytes\n", pdu->N_bytes);
     
     LIBLTE_RRC_PCCH_MSG_STRUCT pcch_msg;
-    srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-    bit_buf.N_bits = pdu->N_bytes*8;
+    liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
     pool->deallocate(pdu);
-    liblte_rrc_unpack_pcch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &pcch_msg);
+    liblte_rrc_unpack_pcch_msg(&bit_buf, &pcch_msg);
     
     if (pcch_msg.paging_record_list_size > LIBLTE_RRC_MAX_PAGE_REC) {
       pcch_msg.paging_record_list_size = LIBLTE_RRC_MAX_PAGE_REC;     
@@ -391,18 +388,11 @@ void rrc::send_con_request()
     ul_ccch_msg.msg.rrc_con_req.ue_id.random = 1000;
   }
   ul_ccch_msg.msg.rrc_con_req.cause = LIBLTE_RRC_CON_REQ_EST_CAUSE_MO_SIGNALLING;
-  liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, &bit_buf);
 
   // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  byte_buffer_t *pdcp_buf = pool_allocate;
-  srslte_bit_pack_vector(bit_buf.msg, pdcp_buf->msg, bit_buf.N_bits);
-  pdcp_buf->N_bytes = bit_buf.N_bits/8;
+  byte_buffer_t *pdcp_buf = pool_allocate_bytes((bit_buf.N_bits+7)/8);
+  pdcp_buf->N_bytes = liblte_pack(&bit_buf, pdcp_buf->msg);
   pdcp_buf->set_timestamp();
 
   // Set UE contention resolution ID in MAC
@@ -433,16 +423,14 @@ void rrc::send_con_restablish_request()
   LIBLTE_RRC_S_TMSI_STRUCT      s_tmsi;
 
   // Compute shortMAC-I
-  uint8_t varShortMAC[128], varShortMAC_packed[16];
-  bzero(varShortMAC, 128);
+  uint8_t varShortMAC_packed[16];
   bzero(varShortMAC_packed, 16);
-  uint8_t *msg_ptr = varShortMAC; 
+  LIBLTE_BIT_PTR msg_ptr = varShortMAC_packed;
   liblte_rrc_pack_cell_identity_ie(0x1a2d0, &msg_ptr);
   liblte_rrc_pack_phys_cell_id_ie(cell.id, &msg_ptr);
   mac_interface_rrc::ue_rnti_t ue_rnti; 
   mac->get_rntis(&ue_rnti);
   liblte_rrc_pack_c_rnti_ie(ue_rnti.crnti, &msg_ptr);
-  srslte_bit_pack_vector(varShortMAC, varShortMAC_packed, msg_ptr - varShortMAC);
   
   uint8_t mac_key[4];
   security_128_eia2(&k_rrc_int[16],
@@ -462,7 +450,7 @@ void rrc::send_con_restablish_request()
   ul_ccch_msg.msg.rrc_con_reest_req.ue_id.phys_cell_id = cell.id;
   ul_ccch_msg.msg.rrc_con_reest_req.ue_id.short_mac_i = mac_key[2]<<8 | mac_key[3];
   ul_ccch_msg.msg.rrc_con_reest_req.cause = LIBLTE_RRC_CON_REEST_REQ_CAUSE_OTHER_FAILURE;
-  liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_ccch_msg(&ul_ccch_msg, &bit_buf);
 
   rrc_log->info("Initiating RRC Connection Reestablishment Procedure\n");
   rrc_log->console("RRC Connection Reestablishment\n");
@@ -488,15 +476,8 @@ void rrc::send_con_restablish_request()
   rrc_log->info("Cell Selection finished. Initiating transmission of RRC Connection Reestablishment Request\n");
   
   // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  byte_buffer_t *pdcp_buf = pool_allocate;
-  srslte_bit_pack_vector(bit_buf.msg, pdcp_buf->msg, bit_buf.N_bits);
-  pdcp_buf->N_bytes = bit_buf.N_bits/8;
+  byte_buffer_t *pdcp_buf = pool_allocate_bytes((bit_buf.N_bits+7)/8);
+  pdcp_buf->N_bytes = liblte_pack(&bit_buf, pdcp_buf->msg);
 
   // Set UE contention resolution ID in MAC
   uint64_t uecri=0;
@@ -522,18 +503,11 @@ void rrc::send_con_restablish_complete()
   // Prepare ConnectionSetupComplete packet
   ul_dcch_msg.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_REEST_COMPLETE;
   ul_dcch_msg.msg.rrc_con_reest_complete.rrc_transaction_id = transaction_id;
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &bit_buf);
 
   // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  byte_buffer_t *pdcp_buf = pool_allocate;
-  srslte_bit_pack_vector(bit_buf.msg, pdcp_buf->msg, bit_buf.N_bits);
-  pdcp_buf->N_bytes = bit_buf.N_bits/8;
+  byte_buffer_t *pdcp_buf = pool_allocate_bytes((bit_buf.N_bits+7)/8);
+  pdcp_buf->N_bytes = liblte_pack(&bit_buf, pdcp_buf->msg);
 
   state = RRC_STATE_RRC_CONNECTED;
   rrc_log->console("RRC Connected\n");
@@ -553,18 +527,11 @@ void rrc::send_con_setup_complete(byte_buffer_t *nas_msg)
   ul_dcch_msg.msg.rrc_con_setup_complete.selected_plmn_id = 1;
   memcpy(ul_dcch_msg.msg.rrc_con_setup_complete.dedicated_info_nas.msg, nas_msg->msg, nas_msg->N_bytes);
   ul_dcch_msg.msg.rrc_con_setup_complete.dedicated_info_nas.N_bytes = nas_msg->N_bytes;
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &bit_buf);
 
   // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  byte_buffer_t *pdcp_buf = pool_allocate;
-  srslte_bit_pack_vector(bit_buf.msg, pdcp_buf->msg, bit_buf.N_bits);
-  pdcp_buf->N_bytes = bit_buf.N_bits/8;
+  byte_buffer_t *pdcp_buf = pool_allocate_bytes((bit_buf.N_bits+7)/8);
+  pdcp_buf->N_bytes = liblte_pack(&bit_buf, pdcp_buf->msg);
   pdcp_buf->set_timestamp();
 
   state = RRC_STATE_RRC_CONNECTED;
@@ -583,21 +550,13 @@ void rrc::send_ul_info_transfer(uint32_t lcid, byte_buffer_t *sdu)
   ul_dcch_msg.msg.ul_info_transfer.dedicated_info_type = LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_NAS;
   memcpy(ul_dcch_msg.msg.ul_info_transfer.dedicated_info.msg, sdu->msg, sdu->N_bytes);
   ul_dcch_msg.msg.ul_info_transfer.dedicated_info.N_bytes = sdu->N_bytes;
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &bit_buf);
 
-  // Reset and reuse sdu buffer
-  byte_buffer_t *pdu = sdu;
-  pdu->reset();
+  // Reuse sdu buffer if it has room for the message
+  byte_buffer_t *pdu = pool_reallocate(sdu, (bit_buf.N_bits+7)/8);
 
   // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  srslte_bit_pack_vector(bit_buf.msg, pdu->msg, bit_buf.N_bits);
-  pdu->N_bytes = bit_buf.N_bits/8;
+  pdu->N_bytes = liblte_pack(&bit_buf, pdu->msg);
   pdu->set_timestamp();
   pdu->set_timestamp();
 
@@ -611,17 +570,11 @@ void rrc::send_security_mode_complete(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_RRC_UL_DCCH_MSG_STRUCT ul_dcch_msg;
   ul_dcch_msg.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_COMPLETE;
   ul_dcch_msg.msg.security_mode_complete.rrc_transaction_id = transaction_id;
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &bit_buf);
 
-  // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  srslte_bit_pack_vector(bit_buf.msg, pdu->msg, bit_buf.N_bits);
-  pdu->N_bytes = bit_buf.N_bits/8;
+  // Byte align and pack the message bits for PDCP, reusing pdu if it has room
+  pdu = pool_reallocate(pdu, (bit_buf.N_bits+7)/8);
+  pdu->N_bytes = liblte_pack(&bit_buf, pdu->msg);
   pdu->set_timestamp();
 
   rrc_log->info("Sending Security Mode Complete\n");
@@ -635,17 +588,11 @@ void rrc::send_rrc_con_reconfig_complete(uint32_t lcid, byte_buffer_t *pdu)
 
   ul_dcch_msg.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_RECONFIG_COMPLETE;
   ul_dcch_msg.msg.rrc_con_reconfig_complete.rrc_transaction_id = transaction_id;
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &bit_buf);
 
-  // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  srslte_bit_pack_vector(bit_buf.msg, pdu->msg, bit_buf.N_bits);
-  pdu->N_bytes = bit_buf.N_bits/8;
+  // Byte align and pack the message bits for PDCP, reusing pdu if it has room
+  pdu = pool_reallocate(pdu, (bit_buf.N_bits+7)/8);
+  pdu->N_bytes = liblte_pack(&bit_buf, pdu->msg);
   pdu->set_timestamp();
 
   rrc_log->info("Sending RRC Connection Reconfig Complete\n");
@@ -722,17 +669,11 @@ void rrc::send_rrc_ue_cap_info(uint32_t lcid, byte_buffer_t *pdu)
   cap->inter_rat_params.cdma2000_hrpd_present  = false;
   cap->inter_rat_params.cdma2000_1xrtt_present = false;
 
-  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*)&bit_buf);
+  liblte_rrc_pack_ul_dcch_msg(&ul_dcch_msg, &bit_buf);
 
-  // Byte align and pack the message bits for PDCP
-  if((bit_buf.N_bits % 8) != 0)
-  {
-    for(uint32_t i=0; i<8-(bit_buf.N_bits % 8); i++)
-      bit_buf.msg[bit_buf.N_bits + i] = 0;
-    bit_buf.N_bits += 8 - (bit_buf.N_bits % 8);
-  }
-  srslte_bit_pack_vector(bit_buf.msg, pdu->msg, bit_buf.N_bits);
-  pdu->N_bytes = bit_buf.N_bits/8;
+  // Byte align and pack the message bits for PDCP, reusing pdu if it has room
+  pdu = pool_reallocate(pdu, (bit_buf.N_bits+7)/8);
+  pdu->N_bytes = liblte_pack(&bit_buf, pdu->msg);
   pdu->set_timestamp();
 
   rrc_log->info("Sending UE Capability Info\n");
@@ -745,11 +686,10 @@ void rrc::send_rrc_ue_cap_info(uint32_t lcid, byte_buffer_t *pdu)
 
 void rrc::parse_dl_ccch(byte_buffer_t *pdu)
 {
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-  bit_buf.N_bits = pdu->N_bytes*8;
+  liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
   pool->deallocate(pdu);
   bzero(&dl_ccch_msg, sizeof(LIBLTE_RRC_DL_CCCH_MSG_STRUCT));
-  liblte_rrc_unpack_dl_ccch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &dl_ccch_msg);
+  liblte_rrc_unpack_dl_ccch_msg(&bit_buf, &dl_ccch_msg);
 
   rrc_log->info("SRB0 - Received %s\n",
                 liblte_rrc_dl_ccch_msg_type_text[dl_ccch_msg.msg_type]);
@@ -788,9 +728,8 @@ void rrc::parse_dl_ccch(byte_buffer_t *pdu)
 
 void rrc::parse_dl_dcch(uint32_t lcid, byte_buffer_t *pdu)
 {
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-  bit_buf.N_bits = pdu->N_bytes*8;
-  liblte_rrc_unpack_dl_dcch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &dl_dcch_msg);
+  liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
+  liblte_rrc_unpack_dl_dcch_msg(&bit_buf, &dl_dcch_msg);
 
   rrc_log->info("%s - Received %s\n",
                 rb_id_text[lcid],
@@ -816,6 +755,9 @@ void rrc::parse_dl_dcch(uint32_t lcid, byte_buffer_t *pdu)
     usim->generate_as_keys(nas->get_ul_count(), k_rrc_enc, k_rrc_int, k_up_enc, k_up_int, cipher_algo, integ_algo);
     pdcp->config_security(lcid, k_rrc_enc, k_rrc_int, cipher_algo, integ_algo);
     send_security_mode_complete(lcid, pdu);
+
+    // SecurityModeComplete is the last message sent unciphered
+    pdcp->enable_encryption(lcid);
     break;
   case LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG:
     transaction_id = dl_dcch_msg.msg.rrc_con_reconfig.rrc_transaction_id;
@@ -1309,7 +1251,7 @@ void rrc::handle_rrc_con_reconfig(uint32_t lcid, LIBLTE_RRC_CONNECTION_RECONFIGU
   byte_buffer_t *nas_sdu;
   for(i=0;i<reconfig->N_ded_info_nas;i++)
   {
-    nas_sdu = pool_allocate;
+    nas_sdu = pool_allocate_bytes(reconfig->ded_info_nas_list[i].N_bytes);
     memcpy(nas_sdu->msg, &reconfig->ded_info_nas_list[i].msg, reconfig->ded_info_nas_list[i].N_bytes);
     nas_sdu->N_bytes = reconfig->ded_info_nas_list[i].N_bytes;
     nas->write_pdu(lcid, nas_sdu);
@@ -1320,8 +1262,10 @@ void rrc::add_srb(LIBLTE_RRC_SRB_TO_ADD_MOD_STRUCT *srb_cnfg)
 {
   // Setup PDCP
   pdcp->add_bearer(srb_cnfg->srb_id);
-  if(RB_ID_SRB2 == srb_cnfg->srb_id)
+  if(RB_ID_SRB2 == srb_cnfg->srb_id) {
     pdcp->config_security(srb_cnfg->srb_id, k_rrc_enc, k_rrc_int, cipher_algo, integ_algo);
+    pdcp->enable_encryption(srb_cnfg->srb_id);
+  }
 
   // Setup RLC
   if(srb_cnfg->rlc_cnfg_present)
@@ -1388,7 +1332,8 @@ void rrc::add_drb(LIBLTE_RRC_DRB_TO_ADD_MOD_STRUCT *drb_cnfg)
   
   // Setup PDCP
   pdcp->add_bearer(lcid, &drb_cnfg->pdcp_cnfg);
-  // TODO: setup PDCP security (using k_up_enc)
+  pdcp->config_security(lcid, k_up_enc, k_up_int, cipher_algo, integ_algo);
+  pdcp->enable_encryption(lcid);
 
   // Setup RLC
   rlc->add_bearer(lcid, &drb_cnfg->rlc_cnfg);
@@ -211,10 +211,9 @@ public:
     log_h->info_hex(pdu->msg, pdu->N_bytes, "BCCH DLSCH message received.");
     log_h->info("BCCH DLSCH message Stack latency: %ld us\n", pdu->get_latency_us());
     LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT dlsch_msg;
-    srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes*8);
-    bit_buf.N_bits = pdu->N_bytes*8;
+    liblte_unpack(pdu->msg, pdu->N_bytes, &bit_buf);
     pool->deallocate(pdu);
-    liblte_rrc_unpack_bcch_dlsch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &dlsch_msg);
+    liblte_rrc_unpack_bcch_dlsch_msg(&bit_buf, &dlsch_msg);
 
     if (dlsch_msg.N_sibs > 0) {
       if (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1 == dlsch_msg.sibs[0].sib_type && srsue::RRC_STATE_SIB1_SEARCH == state) {
@@ -336,7 +335,7 @@ private:
   srslte::rlc *rlc; 
   srsue::mac *mac; 
   srsue::phy *phy;  
-  srslte::bit_buffer_t bit_buf;
+  LIBLTE_BIT_MSG_STRUCT bit_buf;
   srsue::rrc_state_t state; 
   LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT sib1;
   LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT sib2;
@@ -119,9 +119,8 @@ void basic_test() {
                                0x07, 0x97, 0x09, 0x1f, 0xc3, 0x06, 0x00, 0x81,
                                0x00, 0x00, 0x11};
 
-  srslte_bit_unpack_vector(rrc_message, bit_buf.msg, rrc_message_len*8);
-  bit_buf.N_bits = rrc_message_len*8;
-  liblte_rrc_unpack_dl_dcch_msg((LIBLTE_BIT_MSG_STRUCT*)&bit_buf, &dl_dcch_msg);
+  liblte_unpack(rrc_message, rrc_message_len, &bit_buf);
+  liblte_rrc_unpack_dl_dcch_msg(&bit_buf, &dl_dcch_msg);
 
   printf("done\n");
 }